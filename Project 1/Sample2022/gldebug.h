@@ -0,0 +1,129 @@
+#ifndef GLDEBUG_H
+#define GLDEBUG_H
+
+#include <stdio.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "glew.h"
+#include <GL/gl.h>
+
+
+// gl error reporting that does not stall the pipeline:
+//
+//	glGetError( ) makes the driver catch up to where the program is before it can answer,
+//	so calling it after every gl call costs real frame time
+//	instead, the driver hands its errors and warnings to a callback (KHR_debug, core in gl 4.3)
+//	as they happen, and each GLDEBUG_CHECK( ) just charges whatever has come in since the
+//	last one to its own call site
+//
+//	all of this only exists if GLDEBUG is defined -- it is on in a Visual Studio Debug build
+//	(which defines _DEBUG), and can be turned on anywhere else with -DGLDEBUG
+//	without it, every one of the macros below compiles to nothing
+//
+//	if the driver does not have KHR_debug, GLDEBUG_CHECK( ) falls back to glGetError( )
+//
+//	use:
+//		GLDEBUG_CONTEXT( );			// before glutCreateWindow( ) -- ask for a debug context
+//		GLDEBUG_INIT( );			// after the window is open (and glewInit( ))
+//		...
+//		glTexImage2D( ... );
+//		GLDEBUG_CHECK( "mars texture" );	// errors since the last check belong to this site
+//		GLDEBUG_LABEL( GL_TEXTURE, MarsTex, "mars.bmp" );	// the name gl uses in its messages
+//		{
+//			GLDEBUG_GROUP( "Planets" );	// shows up in gl debuggers, and errors inside it
+//			...				// that were not checked are charged to it
+//		}
+//		GLDEBUG_PUSH( "Sun" );			// the same, for a group that is not a { }
+//		...
+//		GLDEBUG_POP( );
+//		GLDEBUG_PRINT( stderr );		// how many errors at each site
+
+#if !defined(GLDEBUG)  &&  defined(_DEBUG)
+#define GLDEBUG
+#endif
+
+#ifdef GLDEBUG
+
+#include "glut.h"
+#include "freeglut_ext.h"
+
+class GLDebugLog
+{
+  private:
+	struct Site
+	{
+		int		Errors;
+		int		Others;		// performance, portability, etc. warnings
+		std::string	First;		// the first message charged to it
+	};
+
+	bool				HaveCallback;	// false means glGetError( ) has to be used
+	int				Unclaimed;	// errors that have come in since the last check
+	int				UnclaimedOthers;
+	std::string			UnclaimedFirst;
+	std::map<std::string,Site>	Sites;		// by "site (file:line)"
+	std::vector<const char *>	Groups;		// the open debug groups, innermost last
+
+	void	Charge( const char *, const char *, int );
+	static void GLAPIENTRY
+		Message( GLenum, GLenum, GLuint, GLenum, GLsizei, const GLchar *, const void * );
+
+  public:
+		GLDebugLog( );
+
+	void	Check( const char *, const char *, int );
+	void	Discard( );
+	int	GetErrors( );
+	void	Init( bool = true );
+	void	Label( GLenum, GLuint, const char * );
+	void	PopGroup( const char *, int );
+	void	PrintStats( FILE * );
+	void	PushGroup( const char * );
+};
+
+extern GLDebugLog	GLDebug;
+
+
+// a debug group that lasts until the end of the { } it is in:
+
+class GLDebugGroup
+{
+  private:
+	const char *	File;
+	int		Line;
+
+  public:
+		GLDebugGroup( const char *, const char *, int );
+		~GLDebugGroup( );
+};
+
+#define GLDEBUG_JOIN2( a, b )		a##b
+#define GLDEBUG_JOIN( a, b )		GLDEBUG_JOIN2( a, b )
+
+#define GLDEBUG_CONTEXT( )		glutInitContextFlags( GLUT_DEBUG )
+#define GLDEBUG_INIT( )			GLDebug.Init( )
+#define GLDEBUG_CHECK( site )		GLDebug.Check( site, __FILE__, __LINE__ )
+#define GLDEBUG_DISCARD( )		GLDebug.Discard( )
+#define GLDEBUG_GROUP( name )		GLDebugGroup GLDEBUG_JOIN( glDebugGroup, __LINE__ )( name, __FILE__, __LINE__ )
+#define GLDEBUG_LABEL( type, id, name )	GLDebug.Label( type, id, name )
+#define GLDEBUG_POP( )			GLDebug.PopGroup( __FILE__, __LINE__ )
+#define GLDEBUG_PRINT( fp )		GLDebug.PrintStats( fp )
+#define GLDEBUG_PUSH( name )		GLDebug.PushGroup( name )
+
+#else
+
+#define GLDEBUG_CONTEXT( )		((void)0)
+#define GLDEBUG_INIT( )			((void)0)
+#define GLDEBUG_CHECK( site )		((void)0)
+#define GLDEBUG_DISCARD( )		((void)0)
+#define GLDEBUG_GROUP( name )		((void)0)
+#define GLDEBUG_LABEL( type, id, name )	((void)0)
+#define GLDEBUG_POP( )			((void)0)
+#define GLDEBUG_PRINT( fp )		((void)0)
+#define GLDEBUG_PUSH( name )		((void)0)
+
+#endif		// #ifdef GLDEBUG
+
+#endif		// #ifndef GLDEBUG_H
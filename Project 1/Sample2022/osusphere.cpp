@@ -12,89 +12,57 @@
 #define F_PI_2		((float)(F_PI/2.f))
 #endif
 
+#include "osusurface.cpp"
+
+
 inline
 void
-_DrawSphLatLng( float radius, float lat, float lng )
+_SphereLatLng( float u, float v, struct SurfaceVertex *p )
 {
 	// lat is in radians between -F_PI_2 and +F_PI_2
 	// lng is in radians between -F_PI and +F_PI
+	float lat = -F_PI_2 + F_PI * v;
+	float lng = -F_PI  + F_2_PI * u;
 	float xz =  cosf(lat);
-	float x = xz * sinf(lng);
-	float y = sinf(lat);
-	float z = xz * cosf(lng);
-	float nx = x;		// for a *sphere only*, the normal is the unitized position
-	float ny = y;		// for a *sphere only*, the normal is the unitized position
-	float nz = z;		// for a *sphere only*, the normal is the unitized position
-	float s = ( lng + F_PI )   / F_2_PI;
-	float t = ( lat + F_PI_2 ) / F_PI;
-	glTexCoord2f( s, t );
-	glNormal3f( nx, ny, nz );
-	glVertex3f( x*radius, y*radius, z*radius );
+	p->x = xz * sinf(lng);
+	p->y = sinf(lat);
+	p->z = xz * cosf(lng);
+	p->nx = p->x;		// for a *sphere only*, the normal is the unitized position
+	p->ny = p->y;		// for a *sphere only*, the normal is the unitized position
+	p->nz = p->z;		// for a *sphere only*, the normal is the unitized position
+	p->s = u;
+	p->t = v;
 }
 
 
+// add a sphere to a mesh (which can then be drawn, or put into a Mesh's buffers):
+
 void
-OsuSphere( float radius, int slices, int stacks )
+OsuSphere( float radius, int slices, int stacks, struct SurfaceMesh *mesh )
 {
 	// sanity check:
 	radius = (float)fabs(radius);
 	if( slices < 4 )		slices = 4;
 	if( stacks < 4 )		stacks = 4;
 
+	// the pole triangles that collapse to lines are dropped by BuildSurface( ):
 
-	glBegin( GL_TRIANGLES );
-
-	// south pole:
-	{
-		int istack = 0;
-		float north = -F_PI_2 + F_PI * (float)(istack + 1) / (float)stacks;
-		float south = -F_PI_2 + F_PI * (float)(istack + 0) / (float)stacks;
-		for (int islice = 0; islice < slices; islice++)
-		{
-			float west = -F_PI + F_2_PI * (float)(islice + 0) / (float)slices;
-			float east = -F_PI + F_2_PI * (float)(islice + 1) / (float)slices;
-
-			_DrawSphLatLng( radius, south, .5f * (east + west));
-			_DrawSphLatLng( radius, north, east);
-			_DrawSphLatLng( radius, north, west);
-		}
-	}
-
-	// north pole:
-	{
-		int istack = stacks - 1;
-		float north = -F_PI_2 + F_PI * (float)(istack + 1) / (float)stacks;
-		float south = -F_PI_2 + F_PI * (float)(istack + 0) / (float)stacks;
-		for (int islice = 0; islice < slices; islice++)
+	BuildSurface(
+		[=]( float u, float v, struct SurfaceVertex *p )
 		{
-			float west = -F_PI + F_2_PI * (float)(islice + 0) / (float)slices;
-			float east = -F_PI + F_2_PI * (float)(islice + 1) / (float)slices;
-
-			_DrawSphLatLng( radius, north, .5f*(east + west) );
-			_DrawSphLatLng( radius, south, west );
-			_DrawSphLatLng( radius, south, east );
-		}
-	}
-
-	// all the bands in between:
-	for (int istack = 1; istack < stacks-1; istack++)
-	{
-		float north = -F_PI_2 + F_PI * (float)(istack + 1) / (float)stacks;
-		float south = -F_PI_2 + F_PI * (float)(istack + 0) / (float)stacks;
-		for (int islice = 0; islice < slices; islice++)
-		{
-			float west = -F_PI + F_2_PI * (float)(islice + 0) / (float)slices;
-			float east = -F_PI + F_2_PI * (float)(islice + 1) / (float)slices;
-
-			_DrawSphLatLng( radius, north, west );
-			_DrawSphLatLng( radius, south, west );
-			_DrawSphLatLng( radius, north, east );
+			_SphereLatLng( u, v, p );
+			p->x *= radius;
+			p->y *= radius;
+			p->z *= radius;
+		},
+		slices, stacks, mesh );
+}
 
-			_DrawSphLatLng( radius, north, east );
-			_DrawSphLatLng( radius, south, west );
-			_DrawSphLatLng( radius, south, east );
-		}
-	}
 
-	glEnd( );
+void
+OsuSphere( float radius, int slices, int stacks )
+{
+	struct SurfaceMesh mesh;
+	OsuSphere( radius, slices, stacks, &mesh );
+	mesh.Draw( );
 }
@@ -14,51 +14,45 @@
 #endif
 
 
-void
-OsuTorus( float innerRadius, float outerRadius, int nsides, int nrings )
-{
-	float ringDelta = 2.0f * F_PI / (float)nrings;
-	float sideDelta = 2.0f * F_PI / (float)nsides;
+#include "osusurface.cpp"
 
-	float theta    = 0.0;
-	float cosTheta = 1.0;
-	float sinTheta = 0.0;
 
-	for( int i = 0; i < nrings; i++ )
-	{
-		float theta1 = theta + ringDelta;
-		float cosTheta1 = cosf(theta1);
-		float sinTheta1 = sinf(theta1);
+// add a torus to a mesh (which can then be drawn, or put into a Mesh's buffers):
 
-		float phi = 0.0;
-		float s0 = 1.f - (float)(i+0) / (float)nrings;
-		float s1 = 1.f - (float)(i+1) / (float)nrings;
+void
+OsuTorus( float innerRadius, float outerRadius, int nsides, int nrings, struct SurfaceMesh *mesh )
+{
+	if( nsides < 3 )	nsides = 3;
+	if( nrings < 3 )	nrings = 3;
 
-		glBegin( GL_TRIANGLE_STRIP );
+	// u goes around the rings, v goes around each side:
 
-		for( int j = 0; j <= nsides; j++ )
+	BuildSurface(
+		[=]( float u, float v, struct SurfaceVertex *p )
 		{
-			float cosPhi = cosf(phi);
-			float sinPhi = sinf(phi);
+			float theta = F_2_PI * u;
+			float phi   = F_2_PI * v;
+			float cosTheta = cosf(theta),  sinTheta = sinf(theta);
+			float cosPhi   = cosf(phi),    sinPhi   = sinf(phi);
 			float dist = outerRadius + innerRadius * cosPhi;
 
-			float t = 1.f - (float)j / (float)nsides;
-
-			glTexCoord2f( s0, t);
-			glNormal3f(cosTheta * cosPhi, sinPhi, -sinTheta * cosPhi);
-			glVertex3f(cosTheta * dist, innerRadius * sinPhi, -sinTheta * dist);
-
-			glTexCoord2f( s1, t );
-			glNormal3f( cosTheta1 * cosPhi, sinPhi,               -sinTheta1 * cosPhi );
-			glVertex3f( cosTheta1 * dist,   innerRadius * sinPhi, -sinTheta1 * dist );
-
-			phi += sideDelta;
-		}
+			p->s = 1.f - u;
+			p->t = 1.f - v;
+			p->nx =  cosTheta * cosPhi;
+			p->ny =  sinPhi;
+			p->nz = -sinTheta * cosPhi;
+			p->x  =  cosTheta * dist;
+			p->y  =  innerRadius * sinPhi;
+			p->z  = -sinTheta * dist;
+		},
+		nrings, nsides, mesh );
+}
 
-		glEnd( );
 
-		theta = theta1;
-		cosTheta = cosTheta1;
-		sinTheta = sinTheta1;
-	}
+void
+OsuTorus( float innerRadius, float outerRadius, int nsides, int nrings )
+{
+	struct SurfaceMesh mesh;
+	OsuTorus( innerRadius, outerRadius, nsides, nrings, &mesh );
+	mesh.Draw( );
 }
@@ -0,0 +1,75 @@
+#version 330 core
+
+// the fixed-function pipeline's texturing and fog, with nothing from the compatibility profile --
+// see pipeline.h
+
+#include "pipeline.glsl"
+
+#ifdef FLAT
+#define SHADE	flat
+#else
+#define SHADE
+#endif
+
+uniform bool		uTexturing;
+uniform bool		uTexReplace;	// GL_REPLACE, otherwise GL_MODULATE
+uniform sampler2D	uTexUnit;
+#ifdef POOLED
+uniform sampler2DArray	uTexLayers;
+flat in float		vLayer;		// < 0. for none
+#endif
+
+uniform int	uFogMode;		// 0 = off, 1 = GL_LINEAR, 2 = GL_EXP, 3 = GL_EXP2
+uniform vec4	uFogColor;
+uniform float	uFogDensity;
+uniform float	uFogStart;
+uniform float	uFogEnd;
+
+SHADE in vec4	vColor;
+in vec2		vST;
+in float	vFogDepth;
+#ifdef PER_FRAGMENT
+SHADE in vec3	vN;
+in vec3		vECposition;
+#endif
+
+out vec4	fFragColor;
+
+
+void
+main( )
+{
+	vec4 color = vColor;
+#ifdef PER_FRAGMENT
+	if( uLighting )
+		color = Lighting( vECposition, normalize( vN ), vColor );
+#endif
+
+#ifdef POOLED
+	if( uTexturing  &&  vLayer >= 0. )
+	{
+		vec4 texel = texture( uTexLayers, vec3( vST, vLayer ) );
+		color = uTexReplace  ?  texel  :  color * texel;
+	}
+#else
+	if( uTexturing )
+	{
+		vec4 texel = texture( uTexUnit, vST );
+		color = uTexReplace  ?  texel  :  color * texel;
+	}
+#endif
+
+	if( uFogMode != 0 )
+	{
+		float f;
+		if( uFogMode == 1 )
+			f = ( uFogEnd - vFogDepth ) / ( uFogEnd - uFogStart );
+		else if( uFogMode == 2 )
+			f = exp( -uFogDensity * vFogDepth );
+		else
+			f = exp( -( uFogDensity * vFogDepth ) * ( uFogDensity * vFogDepth ) );
+		color.rgb = mix( uFogColor.rgb, color.rgb, clamp( f, 0., 1. ) );
+	}
+
+	fFragColor = color;
+}
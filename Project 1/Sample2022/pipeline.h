@@ -0,0 +1,208 @@
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include <stdio.h>
+#include <vector>
+#include <map>
+#include <string>
+
+#include "glew.h"
+#include <GL/gl.h>
+
+#include "glm/glm.hpp"
+#include "glm/gtc/matrix_transform.hpp"
+
+#include "glslprogram.h"
+#include "glstate.cpp"
+#include "mesh.cpp"
+
+
+// the fixed-function pipeline, done either by gl or by a shader:
+//
+//	Display( ) makes the same calls either way -- they look like the gl calls they replace
+//	(Pipeline.Rotate( ) for glRotatef( ), Pipeline.Light( ) for glLightfv( ), etc.)
+//
+//	PIPELINE_FIXED_FUNCTION hands every call to gl (through GLState), exactly as before
+//	PIPELINE_CORE keeps the matrices (computed with glm), lights, material, fog, and texture
+//	environment itself, and Draw( ) hands them to pipeline.vert/pipeline.frag as uniforms --
+//	nothing that is drawn needs a fixed-function feature, so the driver can stay on its
+//	core-profile path
+//	the shaders light each vertex, the way gl does, so the two paths match --
+//	SetPerFragmentLighting( true ) lights each pixel instead, the way pattern.frag does
+//
+//	only the matrices and the things that the shader does are kept here --
+//	every other enable (GL_DEPTH_TEST, etc.) goes straight to GLState in both modes
+//	what the shader does:
+//		GL_LIGHTING, GL_LIGHT0 - GL_LIGHT3 (point, directional, and spot, with attenuation)
+//		glMaterial( ) for GL_FRONT, GL_COLOR_MATERIAL (GL_AMBIENT_AND_DIFFUSE)
+//		glShadeModel( )
+//		GL_TEXTURE_2D on unit 0, with GL_MODULATE or GL_REPLACE
+//		GL_FOG, in GL_LINEAR, GL_EXP, or GL_EXP2
+//	normals are always unitized, as if GL_NORMALIZE were on
+//
+//	DrawInstanced( ) draws every instance of a mesh, each moved by its own world matrix from
+//	the instance attribute at location 10 (see scenegraph.h) -- in the core pipeline only,
+//	since gl's own vertex processing cannot read it
+//
+//	the "POOLED" shader is for a GeometryPool's one big draw (see geometrypool.h) -- each object's
+//	world matrix and texture layer come from a buffer texture, found with gl_DrawIDARB if the
+//	driver has GL_ARB_shader_draw_parameters (CanDrawIds( ) says), otherwise with an instance attribute
+//
+//	SelfCheck( ) draws the same frame both ways and compares the pixels
+//
+//	OwnMatrices( true ) says that gl's matrices are only ever changed through the pipeline, so the
+//	copy kept here is what gl has -- GLState can then skip a light position or spot direction that
+//	is set again the same way under the same modelview (without it, those are always sent, since
+//	code that calls glRotatef( ) and the like directly would leave the copy here behind)
+//
+//	the shaders are built asynchronously (see GLSLProgram::CreateAsync( )) -- until they are all ready,
+//	the pipeline stays fixed-function, and Poll( ), once a frame, switches it to the core pipeline
+//	when they are, if that is what SetMode( ) asked for
+//
+//	use:
+//		Pipeline.Init( );				// after the window is open
+//		Pipeline.SetMode( PIPELINE_CORE );
+//		...
+//		Pipeline.Poll( );				// at the start of every Display( )
+//		Pipeline.MatrixMode( GL_PROJECTION );
+//		Pipeline.LoadIdentity( );
+//		Pipeline.Perspective( 70., 1., 0.1, 1000. );
+//		Pipeline.MatrixMode( GL_MODELVIEW );
+//		Pipeline.LoadIdentity( );
+//		Pipeline.LookAt( 2., 2., 4.,   0., 0., 0.,   0., 1., 0. );
+//		Pipeline.Enable( GL_LIGHTING );
+//		Pipeline.PushMatrix( );
+//			Pipeline.Translate( x, y, z );
+//			Pipeline.Draw( &Planet );
+//		Pipeline.PopMatrix( );
+
+const int PIPELINE_FIXED_FUNCTION = 0;
+const int PIPELINE_CORE           = 1;
+
+const int PIPELINE_LIGHTS = 4;			// the same as in pipeline.glsl
+
+const int PIPELINE_LAYERS_UNIT = 1;		// the texture units the "POOLED" shader reads its texture array
+const int PIPELINE_DRAWS_UNIT  = 2;		//	and its objects' buffer texture from
+const GLuint PIPELINE_DRAW_INDEX = 14;		// the instance attribute that says which object, without gl_DrawIDARB
+
+class RenderPipeline
+{
+  private:
+	struct PipelineLight
+	{
+		bool		On;
+		glm::vec4	Position;		// eye coordinates
+		glm::vec4	Ambient, Diffuse, Specular;
+		glm::vec3	SpotDirection;		// eye coordinates
+		float		SpotExponent;
+		float		SpotCutoff;		// degrees, 180. means it is not a spot light
+		glm::vec3	Attenuation;		// constant, linear, quadratic
+	};
+
+	// one variant's uniforms, looked up the first time it draws, so uploading them is only the Set( )s:
+
+	struct PipelineUniforms
+	{
+		unsigned int			State;		// what State it has the lights, material, and fog for
+		UniformHandle<glm::mat4>	ModelView, Projection;
+		UniformHandle<glm::mat3>	NormalMatrix;
+		UniformHandle<int>		Lighting, Texturing;
+		UniformHandle<int>		LightOn;
+		UniformHandle<glm::vec4>	LightPosition, LightAmbient, LightDiffuse, LightSpecular;
+		UniformHandle<glm::vec3>	SpotDirection, Attenuation;
+		UniformHandle<float>		SpotExponent, SpotCutoff;
+		UniformHandle<glm::vec4>	SceneAmbient;
+		UniformHandle<int>		ColorMaterial;
+		UniformHandle<glm::vec4>	MatAmbient, MatDiffuse, MatSpecular, MatEmission;
+		UniformHandle<float>		MatShininess;
+		UniformHandle<int>		TexUnit, TexLayers, Draws, TexReplace;
+		UniformHandle<int>		FogMode;
+		UniformHandle<glm::vec4>	FogColor;
+		UniformHandle<float>		FogDensity, FogStart, FogEnd;
+	};
+
+	int			Mode;
+	int			WantMode;		// what SetMode( ) asked for -- Mode, once the shaders are ready
+	bool			CanDoCore;		// the shaders compiled and linked
+	int			DrawIds;		// 1 if the "POOLED DRAW_ID" shader builds, 0 if not, -1 if not known yet
+	std::vector<GLSLProgram *>	Building;	// the variants Init( ) started that Poll( ) is waiting for
+	bool			PerFragment;
+	bool			OwnsMatrices;		// nothing changes gl's matrices behind the pipeline's back
+	GLSLVariants		Programs;		// "FLAT" and "PER_FRAGMENT" variants of pipeline.vert/.frag
+	GLSLProgram *		NowProgram;		// between Begin( ) and End( )
+	std::map<GLSLProgram *, PipelineUniforms>	Uploaded;	// each program's uniforms, and what State they have
+	unsigned int		State;			// changes every time something the shader uses does
+
+	GLenum			NowMatrixMode;
+	std::vector<glm::mat4>	ModelView;		// the stacks -- the current matrix is at the back
+	std::vector<glm::mat4>	Projection;
+
+	bool			Lighting, Texturing, ColorMaterial, FogOn;
+	GLenum			ShadeModelMode;
+	GLint			TexEnv;
+	glm::vec4		NowColor;
+	PipelineLight		Lights[PIPELINE_LIGHTS];
+	glm::vec4		SceneAmbient;
+	glm::vec4		MatAmbient, MatDiffuse, MatSpecular, MatEmission;
+	float			MatShininess;
+	GLint			FogMode;
+	float			FogDensity, FogStart, FogEnd;
+	glm::vec4		FogColor;
+
+	void		Changed( );
+	std::string	Defines( bool, bool, bool, bool );
+	PipelineUniforms &	GetUniforms( GLSLProgram * );
+	bool		IsEmulated( GLenum );
+	glm::mat4 &	Top( );
+	void		UploadState( GLSLProgram *, bool );
+
+  public:
+		RenderPipeline( );
+
+	bool	Begin( bool = false, bool = false, bool = false );
+	void	BindTexture( GLenum, GLuint );
+	bool	CanDrawIds( );
+	void	Color( float, float, float, float = 1. );
+	void	Disable( GLenum );
+	void	Draw( Mesh * );
+	bool	DrawInstanced( Mesh *, int );
+	void	Enable( GLenum );
+	void	End( );
+	void	Fogf( GLenum, float );
+	void	Fogfv( GLenum, const float * );
+	void	Fogi( GLenum, GLint );
+	void	GetFloatv( GLenum, float * );
+	int	GetMode( );
+	void	Init( );
+	bool	IsCore( );
+	void	Light( GLenum, GLenum, const float * );
+	void	Light( GLenum, GLenum, float );
+	void	LoadIdentity( );
+	void	LoadMatrix( const glm::mat4 & );
+	void	LoadMatrix( const float * );
+	void	LookAt( float, float, float,  float, float, float,  float, float, float );
+	void	Material( GLenum, GLenum, const float * );
+	void	Material( GLenum, GLenum, float );
+	void	MatrixMode( GLenum );
+	void	MultMatrix( const glm::mat4 & );
+	void	OwnMatrices( bool );
+	void	Ortho( float, float, float, float, float, float );
+	void	Ortho2D( float, float, float, float );
+	void	Perspective( float, float, float, float );
+	void	Poll( );
+	void	PopMatrix( );
+	void	PushMatrix( );
+	void	Rotate( float, float, float, float );
+	void	Scale( float, float, float );
+	float	SelfCheck( void (*)( ), int = 8 );
+	void	Set( GLenum, bool );
+	void	SetMode( int );
+	void	SetPerFragmentLighting( bool );
+	void	ShadeModel( GLenum );
+	void	TexEnvMode( GLint );
+	void	Translate( float, float, float );
+};
+
+extern RenderPipeline	Pipeline;
+
+#endif		// #ifndef PIPELINE_H
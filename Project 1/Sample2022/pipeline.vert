@@ -0,0 +1,88 @@
+#version 330 core
+
+// the fixed-function pipeline's vertex processing, with nothing from the compatibility profile --
+// see pipeline.h
+//	FLAT		glShadeModel( GL_FLAT ) -- the last vertex of each triangle colors all of it, like gl
+//	PER_FRAGMENT	light each pixel instead of each vertex
+//	INSTANCED	each instance is moved by its own world matrix (see scenegraph.h)
+//	POOLED		each draw of a GeometryPool's one big draw is moved by its own world matrix,
+//			and textured from its own layer (see geometrypool.h)
+//	DRAW_ID		... and finds them with gl_DrawIDARB
+
+#ifdef DRAW_ID
+#extension GL_ARB_shader_draw_parameters : require
+#endif
+
+#include "pipeline.glsl"
+
+#ifdef FLAT
+#define SHADE	flat
+#else
+#define SHADE
+#endif
+
+// the same locations that a Mesh puts its attributes at:
+
+layout( location = 0 ) in vec3 aVertex;
+layout( location = 2 ) in vec3 aNormal;
+layout( location = 3 ) in vec4 aColor;
+layout( location = 8 ) in vec2 aTexCoord;
+
+#ifdef INSTANCED
+layout( location = 10 ) in mat4 aWorld;		// locations 10 - 13, one per instance
+#endif
+
+#ifdef POOLED
+uniform samplerBuffer	uDraws;			// 5 texels per draw: the world matrix's columns, then the texture layer
+#ifdef DRAW_ID
+#define DRAW	gl_DrawIDARB
+#else
+layout( location = 14 ) in int aDrawIndex;	// one per draw, which each draw's baseInstance points at
+#define DRAW	aDrawIndex
+#endif
+flat out float	vLayer;
+#endif
+
+uniform mat4	uModelView;
+uniform mat4	uProjection;
+uniform mat3	uNormalMatrix;
+
+SHADE out vec4	vColor;		// lit, unless the lighting is done per fragment
+out vec2	vST;
+out float	vFogDepth;		// distance in front of the eye
+#ifdef PER_FRAGMENT
+SHADE out vec3	vN;
+out vec3	vECposition;
+#endif
+
+
+void
+main( )
+{
+#ifdef INSTANCED
+	vec4 ECposition = uModelView * aWorld * vec4( aVertex, 1. );
+	vec3 Normal = normalize( uNormalMatrix * mat3( aWorld ) * aNormal );
+#elif defined( POOLED )
+	int draw = 5 * DRAW;
+	mat4 world = mat4( texelFetch( uDraws, draw ), texelFetch( uDraws, draw+1 ), texelFetch( uDraws, draw+2 ), texelFetch( uDraws, draw+3 ) );
+	vLayer = texelFetch( uDraws, draw+4 ).x;
+	vec4 ECposition = uModelView * world * vec4( aVertex, 1. );
+	vec3 Normal = normalize( uNormalMatrix * mat3( world ) * aNormal );
+#else
+	vec4 ECposition = uModelView * vec4( aVertex, 1. );
+	vec3 Normal = normalize( uNormalMatrix * aNormal );
+#endif
+
+	vST = aTexCoord;
+	vFogDepth = abs( ECposition.z );
+
+#ifdef PER_FRAGMENT
+	vColor = aColor;
+	vN = Normal;
+	vECposition = ECposition.xyz;
+#else
+	vColor = uLighting  ?  Lighting( ECposition.xyz, Normal, aColor )  :  aColor;
+#endif
+
+	gl_Position = uProjection * ECposition;
+}
@@ -0,0 +1,55 @@
+// make this 120 for the mac:
+#version 330 compatibility
+
+// one horse of one carousel -- every horse of every carousel is an instance of the same mesh,
+// and this does what Display( ) used to do with glRotatef( ) and glTranslatef( ) for each one:
+
+uniform float	uTime;			// 0. - 1., from Animate( ) -- one turn of the carousel
+uniform float	uSeconds;		// for the bobbing
+uniform float	uRadius;		// how far the horses are from the pole
+uniform float	uBobHeight;		// how far up and down they go
+uniform float	uBobPeriod;		// seconds for one trip up and back down
+
+// the per-instance attributes (locations 10-13 and 14 are not used by a Mesh, see mesh.cpp):
+
+layout( location = 10 ) in mat4	aCarousel;	// where this horse's carousel stands
+layout( location = 14 ) in vec2	aSlot;		// degrees around the pole, phase of the bobbing (0. - 1.)
+
+// the mesh's own attributes are read as gl_Vertex and gl_Color
+
+mat4
+RotateY( float degrees )
+{
+	float c = cos( radians( degrees ) );
+	float s = sin( radians( degrees ) );
+	return mat4( c, 0., -s, 0.,   0., 1., 0., 0.,   s, 0., c, 0.,   0., 0., 0., 1. );
+}
+
+mat4
+RotateZ( float degrees )
+{
+	float c = cos( radians( degrees ) );
+	float s = sin( radians( degrees ) );
+	return mat4( c, s, 0., 0.,   -s, c, 0., 0.,   0., 0., 1., 0.,   0., 0., 0., 1. );
+}
+
+void
+main( )
+{
+	// straight up and down at a constant speed, like horsePositionY,
+	// and rocking back and forth, like theta:
+
+	float cycle = fract( uSeconds / uBobPeriod + aSlot.y );
+	float y = uBobHeight * ( 1. - 4. * abs( cycle - 0.5 ) );
+	float theta = 45. * sin( 2. * ( 2. * 3.14159265 * ( uTime + aSlot.y ) ) );
+
+	mat4 place = RotateY( 360. * uTime + aSlot.x );
+	place[3] = place * vec4( 0., y, uRadius, 1. );	// the translation, after the turn
+
+	vec4 vertex = aCarousel * place * RotateZ( theta ) * gl_Vertex;
+	vec4 ECposition = gl_ModelViewMatrix * vertex;
+	gl_Position = gl_ProjectionMatrix * ECposition;
+	gl_FogFragCoord = abs( ECposition.z );
+	gl_FrontColor = gl_Color;
+	gl_BackColor  = gl_Color;
+}
@@ -0,0 +1,3889 @@
+// Horse, made by meshheader from CarouselHorse0.10.550 -- do not edit this, run meshheader again instead
+//	2906 vertices, 972 triangles
+
+const int HorseNumVertices = 2906;
+const int HorseNumIndices  = 2916;
+
+const MeshVertex HorseVertices[ ] = {
+	{ 0.79f, 0.7099999f, -0.04000003f,   0.05716666f, 0.2286643f, 0.9718254f,   0.f, 0.f,   58, 58, 0, 255 },
+	{ 0.8f, 0.75f, -0.05000003f,   0.05716666f, 0.2286643f, 0.9718254f,   0.f, 0.f,   58, 58, 0, 255 },
+	{ 0.75f, 0.72f, -0.04000003f,   0.05716666f, 0.2286643f, 0.9718254f,   0.f, 0.f,   58, 58, 0, 255 },
+	{ 0.8f, 0.75f, -0.05000003f,   0.1360822f, -0.2721649f, -0.9525796f,   0.f, 0.f,   69, 69, 0, 255 },
+	{ 0.79f, 0.7099999f, -0.04000003f,   0.1360822f, -0.2721649f, -0.9525796f,   0.f, 0.f,   69, 69, 0, 255 },
+	{ 0.76f, 0.73f, -0.05000003f,   0.1360822f, -0.2721649f, -0.9525796f,   0.f, 0.f,   69, 69, 0, 255 },
+	{ 0.77f, 0.72f, -0.11f,   -0.6730366f, -0.1979517f, -0.7126267f,   0.f, 0.f,   50, 50, 0, 255 },
+	{ 0.75f, 0.6799999f, -0.08000003f,   -0.6730366f, -0.1979517f, -0.7126267f,   0.f, 0.f,   50, 50, 0, 255 },
+	{ 0.72f, 0.7099999f, -0.06000003f,   -0.6730366f, -0.1979517f, -0.7126267f,   0.f, 0.f,   50, 50, 0, 255 },
+	{ 0.76f, 0.73f, -0.05000003f,   0.5052471f, 0.3674516f, -0.7808359f,   0.f, 0.f,   94, 94, 0, 255 },
+	{ 0.79f, 0.7099999f, -0.04000003f,   0.5052471f, 0.3674516f, -0.7808359f,   0.f, 0.f,   94, 94, 0, 255 },
+	{ 0.75f, 0.6799999f, -0.08000003f,   0.5052471f, 0.3674516f, -0.7808359f,   0.f, 0.f,   94, 94, 0, 255 },
+	{ 0.48f, 0.35f, -0.11f,   0.5375459f, -0.4261034f, -0.7276539f,   0.f, 0.f,   109, 109, 0, 255 },
+	{ 0.62f, 0.39f, -0.03000003f,   0.5375459f, -0.4261034f, -0.7276539f,   0.f, 0.f,   109, 109, 0, 255 },
+	{ 0.51f, 0.1999999f, -2.229281e-08f,   0.5375459f, -0.4261034f, -0.7276539f,   0.f, 0.f,   109, 109, 0, 255 },
+	{ 0.62f, 0.39f, -0.03000003f,   0.7905842f, -0.5109872f, -0.3374442f,   0.f, 0.f,   130, 130, 0, 255 },
+	{ 0.65f, 0.41f, 0.009999971f,   0.7905842f, -0.5109872f, -0.3374442f,   0.f, 0.f,   130, 130, 0, 255 },
+	{ 0.51f, 0.1999999f, -2.229281e-08f,   0.7905842f, -0.5109872f, -0.3374442f,   0.f, 0.f,   130, 130, 0, 255 },
+	{ 0.61f, 0.51f, -0.1f,   0.5383168f, -0.390714f, -0.7466977f,   0.f, 0.f,   100, 100, 0, 255 },
+	{ 0.62f, 0.39f, -0.03000003f,   0.5383168f, -0.390714f, -0.7466977f,   0.f, 0.f,   100, 100, 0, 255 },
+	{ 0.48f, 0.35f, -0.11f,   0.5383168f, -0.390714f, -0.7466977f,   0.f, 0.f,   100, 100, 0, 255 },
+	{ 0.61f, 0.6f, -0.09000003f,   -0.05935824f, 0.1102367f, -0.9921313f,   0.f, 0.f,   28, 28, 0, 255 },
+	{ 0.61f, 0.51f, -0.1f,   -0.05935824f, 0.1102367f, -0.9921313f,   0.f, 0.f,   28, 28, 0, 255 },
+	{ 0.48f, 0.35f, -0.11f,   -0.05935824f, 0.1102367f, -0.9921313f,   0.f, 0.f,   28, 28, 0, 255 },
+	{ 0.76f, 0.73f, -0.05000003f,   0.890871f, 0.08908685f, -0.4454351f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ 0.75f, 0.6799999f, -0.08000003f,   0.890871f, 0.08908685f, -0.4454351f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ 0.74f, 0.73f, -0.09000003f,   0.890871f, 0.08908685f, -0.4454351f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ 0.75f, 0.72f, -0.04000003f,   -4.165036e-08f, 0.8944253f, -0.4472175f,   0.f, 0.f,   228, 228, 0, 255 },
+	{ 0.72f, 0.7099999f, -0.06000003f,   -4.165036e-08f, 0.8944253f, -0.4472175f,   0.f, 0.f,   228, 228, 0, 255 },
+	{ 0.71f, 0.72f, -0.04000003f,   -4.165036e-08f, 0.8944253f, -0.4472175f,   0.f, 0.f,   228, 228, 0, 255 },
+	{ 0.77f, 0.76f, -0.13f,   -0.4626838f, 0.8437122f, 0.2721643f,   0.f, 0.f,   215, 215, 0, 255 },
+	{ 0.72f, 0.7099999f, -0.06000003f,   -0.4626838f, 0.8437122f, 0.2721643f,   0.f, 0.f,   215, 215, 0, 255 },
+	{ 0.75f, 0.72f, -0.04000003f,   -0.4626838f, 0.8437122f, 0.2721643f,   0.f, 0.f,   215, 215, 0, 255 },
+	{ 0.77f, 0.76f, -0.13f,   0.6015676f, -0.7866665f, -0.1388241f,   0.f, 0.f,   201, 201, 0, 255 },
+	{ 0.82f, 0.8f, -0.14f,   0.6015676f, -0.7866665f, -0.1388241f,   0.f, 0.f,   201, 201, 0, 255 },
+	{ 0.74f, 0.73f, -0.09000003f,   0.6015676f, -0.7866665f, -0.1388241f,   0.f, 0.f,   201, 201, 0, 255 },
+	{ 0.82f, 0.8f, -0.14f,   0.5345223f, -0.8017839f, -0.2672609f,   0.f, 0.f,   204, 204, 0, 255 },
+	{ 0.76f, 0.73f, -0.05000003f,   0.5345223f, -0.8017839f, -0.2672609f,   0.f, 0.f,   204, 204, 0, 255 },
+	{ 0.74f, 0.73f, -0.09000003f,   0.5345223f, -0.8017839f, -0.2672609f,   0.f, 0.f,   204, 204, 0, 255 },
+	{ 0.77f, 0.72f, -0.11f,   0.5976146f, 0.3585686f, 0.7171369f,   0.f, 0.f,   91, 91, 0, 255 },
+	{ 0.77f, 0.76f, -0.13f,   0.5976146f, 0.3585686f, 0.7171369f,   0.f, 0.f,   91, 91, 0, 255 },
+	{ 0.74f, 0.73f, -0.09000003f,   0.5976146f, 0.3585686f, 0.7171369f,   0.f, 0.f,   91, 91, 0, 255 },
+	{ 0.75f, 0.72f, -0.04000003f,   -0.5825886f, 0.7828544f, 0.218471f,   0.f, 0.f,   200, 200, 0, 255 },
+	{ 0.82f, 0.8f, -0.14f,   -0.5825886f, 0.7828544f, 0.218471f,   0.f, 0.f,   200, 200, 0, 255 },
+	{ 0.77f, 0.76f, -0.13f,   -0.5825886f, 0.7828544f, 0.218471f,   0.f, 0.f,   200, 200, 0, 255 },
+	{ 0.82f, 0.8f, -0.14f,   -0.4238611f, 0.8284566f, 0.366062f,   0.f, 0.f,   211, 211, 0, 255 },
+	{ 0.75f, 0.72f, -0.04000003f,   -0.4238611f, 0.8284566f, 0.366062f,   0.f, 0.f,   211, 211, 0, 255 },
+	{ 0.8f, 0.75f, -0.05000003f,   -0.4238611f, 0.8284566f, 0.366062f,   0.f, 0.f,   211, 211, 0, 255 },
+	{ 0.8f, 0.75f, -0.05000003f,   0.4155809f, -0.831163f, -0.3694056f,   0.f, 0.f,   212, 212, 0, 255 },
+	{ 0.76f, 0.73f, -0.05000003f,   0.4155809f, -0.831163f, -0.3694056f,   0.f, 0.f,   212, 212, 0, 255 },
+	{ 0.82f, 0.8f, -0.14f,   0.4155809f, -0.831163f, -0.3694056f,   0.f, 0.f,   212, 212, 0, 255 },
+	{ -0.98f, -0.34f, 4.283716e-08f,   0.7071072f, -0.7071064f, -4.115905e-07f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ -1.03f, -0.39f, 4.502273e-08f,   0.7071072f, -0.7071064f, -4.115905e-07f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ -1.05f, -0.41f, -0.03999995f,   0.7071072f, -0.7071064f, -4.115905e-07f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ -0.98f, -0.34f, 4.283716e-08f,   0.7383048f, -0.452509f, -0.5001416f,   0.f, 0.f,   115, 115, 0, 255 },
+	{ -1.05f, -0.41f, -0.03999995f,   0.7383048f, -0.452509f, -0.5001416f,   0.f, 0.f,   115, 115, 0, 255 },
+	{ -1.02f, -0.35f, -0.04999996f,   0.7383048f, -0.452509f, -0.5001416f,   0.f, 0.f,   115, 115, 0, 255 },
+	{ -1.07f, -0.45f, 0.02000005f,   0.6882467f, -0.6882478f, -0.2294154f,   0.f, 0.f,   176, 176, 0, 255 },
+	{ -1.08f, -0.45f, -0.009999952f,   0.6882467f, -0.6882478f, -0.2294154f,   0.f, 0.f,   176, 176, 0, 255 },
+	{ -1.05f, -0.41f, -0.03999995f,   0.6882467f, -0.6882478f, -0.2294154f,   0.f, 0.f,   176, 176, 0, 255 },
+	{ -1.05f, -0.41f, -0.03999995f,   0.80829f, -0.5773509f, -0.1154695f,   0.f, 0.f,   147, 147, 0, 255 },
+	{ -1.03f, -0.39f, 4.502273e-08f,   0.80829f, -0.5773509f, -0.1154695f,   0.f, 0.f,   147, 147, 0, 255 },
+	{ -1.07f, -0.45f, 0.02000005f,   0.80829f, -0.5773509f, -0.1154695f,   0.f, 0.f,   147, 147, 0, 255 },
+	{ -0.43f, -0.06000006f, -0.22f,   0.0959539f, 0.1631218f, -0.9819288f,   0.f, 0.f,   42, 42, 0, 255 },
+	{ -0.6f, 0.03999996f, -0.22f,   0.0959539f, 0.1631218f, -0.9819288f,   0.f, 0.f,   42, 42, 0, 255 },
+	{ -0.31f, 0.04999995f, -0.19f,   0.0959539f, 0.1631218f, -0.9819288f,   0.f, 0.f,   42, 42, 0, 255 },
+	{ 0.4f, -0.05000007f, -0.23f,   0.3646273f, 0.1711516f, -0.9152891f,   0.f, 0.f,   44, 44, 0, 255 },
+	{ 0.27f, 0.12f, -0.25f,   0.3646273f, 0.1711516f, -0.9152891f,   0.f, 0.f,   44, 44, 0, 255 },
+	{ 0.43f, 0.1f, -0.19f,   0.3646273f, 0.1711516f, -0.9152891f,   0.f, 0.f,   44, 44, 0, 255 },
+	{ 0.27f, 0.12f, -0.25f,   0.2873221f, 0.1077459f, -0.9517546f,   0.f, 0.f,   27, 27, 0, 255 },
+	{ 0.4f, -0.05000007f, -0.23f,   0.2873221f, 0.1077459f, -0.9517546f,   0.f, 0.f,   27, 27, 0, 255 },
+	{ 0.26f, -0.02999997f, -0.27f,   0.2873221f, 0.1077459f, -0.9517546f,   0.f, 0.f,   27, 27, 0, 255 },
+	{ -1.1f, -0.34f, 4.808253e-08f,   -0.9508423f, 0.165364f, 0.2618277f,   0.f, 0.f,   42, 42, 0, 255 },
+	{ -1.02f, 0.12f, 4.458562e-08f,   -0.9508423f, 0.165364f, 0.2618277f,   0.f, 0.f,   42, 42, 0, 255 },
+	{ -1.07f, -0.12f, -0.02999995f,   -0.9508423f, 0.165364f, 0.2618277f,   0.f, 0.f,   42, 42, 0, 255 },
+	{ -0.91f, 0.11f, 3.977737e-08f,   0.4915389f, -0.573463f, -0.6553851f,   0.f, 0.f,   146, 146, 0, 255 },
+	{ -0.89f, 0.15f, -0.01999996f,   0.4915389f, -0.573463f, -0.6553851f,   0.f, 0.f,   146, 146, 0, 255 },
+	{ -0.84f, 0.17f, 3.671757e-08f,   0.4915389f, -0.573463f, -0.6553851f,   0.f, 0.f,   146, 146, 0, 255 },
+	{ -0.89f, 0.15f, -0.01999996f,   0.4364355f, -0.8728716f, -0.2182184f,   0.f, 0.f,   223, 223, 0, 255 },
+	{ -0.79f, 0.1999999f, -0.01999996f,   0.4364355f, -0.8728716f, -0.2182184f,   0.f, 0.f,   223, 223, 0, 255 },
+	{ -0.84f, 0.17f, 3.671757e-08f,   0.4364355f, -0.8728716f, -0.2182184f,   0.f, 0.f,   223, 223, 0, 255 },
+	{ -1.02f, 0.12f, 4.458562e-08f,   -0.7432943f, 0.6689646f, 0.f,   0.f, 0.f,   171, 171, 0, 255 },
+	{ -0.93f, 0.22f, 0.01000004f,   -0.7432943f, 0.6689646f, 0.f,   0.f, 0.f,   171, 171, 0, 255 },
+	{ -0.93f, 0.22f, -0.009999959f,   -0.7432943f, 0.6689646f, 0.f,   0.f, 0.f,   171, 171, 0, 255 },
+	{ -0.93f, 0.22f, 0.01000004f,   0.f, 1.f, 0.f,   0.f, 0.f,   255, 255, 0, 255 },
+	{ -0.78f, 0.22f, 3.409488e-08f,   0.f, 1.f, 0.f,   0.f, 0.f,   255, 255, 0, 255 },
+	{ -0.93f, 0.22f, -0.009999959f,   0.f, 1.f, 0.f,   0.f, 0.f,   255, 255, 0, 255 },
+	{ -0.91f, 0.11f, 3.977737e-08f,   0.8669106f, -0.2229198f, -0.4458396f,   0.f, 0.f,   57, 57, 0, 255 },
+	{ -1.f, -0.24f, 4.371139e-08f,   0.8669106f, -0.2229198f, -0.4458396f,   0.f, 0.f,   57, 57, 0, 255 },
+	{ -1.f, -0.16f, -0.03999995f,   0.8669106f, -0.2229198f, -0.4458396f,   0.f, 0.f,   57, 57, 0, 255 },
+	{ 0.33f, -0.85f, -0.14f,   -0.7022468f, -0.1170412f, -0.7022469f,   0.f, 0.f,   30, 30, 0, 255 },
+	{ 0.28f, -0.73f, -0.11f,   -0.7022468f, -0.1170412f, -0.7022469f,   0.f, 0.f,   30, 30, 0, 255 },
+	{ 0.33f, -0.67f, -0.17f,   -0.7022468f, -0.1170412f, -0.7022469f,   0.f, 0.f,   30, 30, 0, 255 },
+	{ 0.36f, -0.64f, -0.15f,   0.6350006f, -0.1270001f, -0.7620008f,   0.f, 0.f,   32, 32, 0, 255 },
+	{ 0.33f, -0.85f, -0.14f,   0.6350006f, -0.1270001f, -0.7620008f,   0.f, 0.f,   32, 32, 0, 255 },
+	{ 0.33f, -0.67f, -0.17f,   0.6350006f, -0.1270001f, -0.7620008f,   0.f, 0.f,   32, 32, 0, 255 },
+	{ 0.29f, -0.89f, -0.11f,   -0.6985638f, 0.03249135f, 0.7148098f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ 0.33f, -0.91f, -0.07000002f,   -0.6985638f, 0.03249135f, 0.7148098f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ 0.33f, -0.6900001f, -0.08000001f,   -0.6985638f, 0.03249135f, 0.7148098f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ 0.33f, -0.6900001f, -0.08000001f,   0.6244837f, -0.02602022f, 0.7806042f,   0.f, 0.f,   7, 7, 0, 255 },
+	{ 0.35f, -0.8100001f, -0.1f,   0.6244837f, -0.02602022f, 0.7806042f,   0.f, 0.f,   7, 7, 0, 255 },
+	{ 0.37f, -0.63f, -0.11f,   0.6244837f, -0.02602022f, 0.7806042f,   0.f, 0.f,   7, 7, 0, 255 },
+	{ 0.33f, -0.6900001f, -0.08000001f,   0.7860088f, 0.02807171f, 0.6175777f,   0.f, 0.f,   7, 7, 0, 255 },
+	{ 0.33f, -0.91f, -0.07000002f,   0.7860088f, 0.02807171f, 0.6175777f,   0.f, 0.f,   7, 7, 0, 255 },
+	{ 0.35f, -0.8100001f, -0.1f,   0.7860088f, 0.02807171f, 0.6175777f,   0.f, 0.f,   7, 7, 0, 255 },
+	{ 0.35f, -0.8100001f, -0.1f,   0.8318905f, 0.1247837f, -0.5407284f,   0.f, 0.f,   32, 32, 0, 255 },
+	{ 0.36f, -0.92f, -0.11f,   0.8318905f, 0.1247837f, -0.5407284f,   0.f, 0.f,   32, 32, 0, 255 },
+	{ 0.33f, -0.85f, -0.14f,   0.8318905f, 0.1247837f, -0.5407284f,   0.f, 0.f,   32, 32, 0, 255 },
+	{ 0.28f, -0.73f, -0.11f,   -0.4959006f, -0.03099375f, 0.867826f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ 0.29f, -0.89f, -0.11f,   -0.4959006f, -0.03099375f, 0.867826f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ 0.33f, -0.6900001f, -0.08000001f,   -0.4959006f, -0.03099375f, 0.867826f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ 0.36f, -0.64f, -0.15f,   0.9359584f, -0.1489025f, -0.3190765f,   0.f, 0.f,   38, 38, 0, 255 },
+	{ 0.35f, -0.8100001f, -0.1f,   0.9359584f, -0.1489025f, -0.3190765f,   0.f, 0.f,   38, 38, 0, 255 },
+	{ 0.33f, -0.85f, -0.14f,   0.9359584f, -0.1489025f, -0.3190765f,   0.f, 0.f,   38, 38, 0, 255 },
+	{ 0.67f, 0.61f, -0.09000003f,   -0.01840211f, 0.1104128f, -0.9937155f,   0.f, 0.f,   28, 28, 0, 255 },
+	{ 0.61f, 0.51f, -0.1f,   -0.01840211f, 0.1104128f, -0.9937155f,   0.f, 0.f,   28, 28, 0, 255 },
+	{ 0.61f, 0.6f, -0.09000003f,   -0.01840211f, 0.1104128f, -0.9937155f,   0.f, 0.f,   28, 28, 0, 255 },
+	{ 0.64f, 0.39f, -0.08000003f,   -0.8907728f, -0.2820778f, -0.3563088f,   0.f, 0.f,   72, 72, 0, 255 },
+	{ 0.62f, 0.39f, -0.03000003f,   -0.8907728f, -0.2820778f, -0.3563088f,   0.f, 0.f,   72, 72, 0, 255 },
+	{ 0.61f, 0.51f, -0.1f,   -0.8907728f, -0.2820778f, -0.3563088f,   0.f, 0.f,   72, 72, 0, 255 },
+	{ 0.61f, 0.6f, -0.09000003f,   -0.08420323f, 0.5052199f, -0.858873f,   0.f, 0.f,   129, 129, 0, 255 },
+	{ 0.64f, 0.6899999f, -0.04000003f,   -0.08420323f, 0.5052199f, -0.858873f,   0.f, 0.f,   129, 129, 0, 255 },
+	{ 0.67f, 0.61f, -0.09000003f,   -0.08420323f, 0.5052199f, -0.858873f,   0.f, 0.f,   129, 129, 0, 255 },
+	{ -0.79f, 0.1999999f, -0.01999996f,   -0.5438085f, 0.8317074f, -0.1119602f,   0.f, 0.f,   212, 212, 0, 255 },
+	{ -0.85f, 0.15f, -0.09999996f,   -0.5438085f, 0.8317074f, -0.1119602f,   0.f, 0.f,   212, 212, 0, 255 },
+	{ -0.84f, 0.17f, 3.671757e-08f,   -0.5438085f, 0.8317074f, -0.1119602f,   0.f, 0.f,   212, 212, 0, 255 },
+	{ -0.88f, 0.09000003f, 0.07000004f,   -0.8944268f, 0.4472144f, 3.323141e-07f,   0.f, 0.f,   114, 114, 0, 255 },
+	{ -0.84f, 0.17f, 3.671757e-08f,   -0.8944268f, 0.4472144f, 3.323141e-07f,   0.f, 0.f,   114, 114, 0, 255 },
+	{ -0.85f, 0.15f, -0.09999996f,   -0.8944268f, 0.4472144f, 3.323141e-07f,   0.f, 0.f,   114, 114, 0, 255 },
+	{ -0.89f, -0.00999999f, 0.06000004f,   -0.995031f, 0.09747232f, 0.02030671f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ -0.88f, 0.09000003f, 0.07000004f,   -0.995031f, 0.09747232f, 0.02030671f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ -0.9f, -0.06000006f, -0.19f,   -0.995031f, 0.09747232f, 0.02030671f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ -0.9f, -0.06000006f, -0.19f,   -0.961936f, 0.2621332f, -0.07723575f,   0.f, 0.f,   67, 67, 0, 255 },
+	{ -0.88f, 0.09000003f, 0.07000004f,   -0.961936f, 0.2621332f, -0.07723575f,   0.f, 0.f,   67, 67, 0, 255 },
+	{ -0.85f, 0.15f, -0.09999996f,   -0.961936f, 0.2621332f, -0.07723575f,   0.f, 0.f,   67, 67, 0, 255 },
+	{ 0.62f, 0.39f, -0.03000003f,   0.3937496f, -0.9056242f, 0.1574997f,   0.f, 0.f,   231, 231, 0, 255 },
+	{ 0.64f, 0.39f, -0.08000003f,   0.3937496f, -0.9056242f, 0.1574997f,   0.f, 0.f,   231, 231, 0, 255 },
+	{ 0.65f, 0.41f, 0.009999971f,   0.3937496f, -0.9056242f, 0.1574997f,   0.f, 0.f,   231, 231, 0, 255 },
+	{ 0.31f, 0.47f, -0.02000001f,   -0.4068396f, 0.5435124f, -0.7342179f,   0.f, 0.f,   139, 139, 0, 255 },
+	{ 0.64f, 0.6899999f, -0.04000003f,   -0.4068396f, 0.5435124f, -0.7342179f,   0.f, 0.f,   139, 139, 0, 255 },
+	{ 0.61f, 0.6f, -0.09000003f,   -0.4068396f, 0.5435124f, -0.7342179f,   0.f, 0.f,   139, 139, 0, 255 },
+	{ 0.64f, 0.6899999f, -0.04000003f,   -0.3644205f, 0.4737469f, -0.8017241f,   0.f, 0.f,   121, 121, 0, 255 },
+	{ 0.31f, 0.47f, -0.02000001f,   -0.3644205f, 0.4737469f, -0.8017241f,   0.f, 0.f,   121, 121, 0, 255 },
+	{ 0.37f, 0.55f, -1.617321e-08f,   -0.3644205f, 0.4737469f, -0.8017241f,   0.f, 0.f,   121, 121, 0, 255 },
+	{ -1.02f, 0.12f, 4.458562e-08f,   -0.7344454f, 0.6378075f, -0.2319301f,   0.f, 0.f,   163, 163, 0, 255 },
+	{ -0.93f, 0.22f, -0.009999959f,   -0.7344454f, 0.6378075f, -0.2319301f,   0.f, 0.f,   163, 163, 0, 255 },
+	{ -0.99f, 0.14f, -0.03999995f,   -0.7344454f, 0.6378075f, -0.2319301f,   0.f, 0.f,   163, 163, 0, 255 },
+	{ -0.99f, 0.14f, -0.03999995f,   -0.2153209f, 0.02870948f, -0.9761212f,   0.f, 0.f,   7, 7, 0, 255 },
+	{ -0.95f, 0.1f, -0.04999996f,   -0.2153209f, 0.02870948f, -0.9761212f,   0.f, 0.f,   7, 7, 0, 255 },
+	{ -1.07f, -0.12f, -0.02999995f,   -0.2153209f, 0.02870948f, -0.9761212f,   0.f, 0.f,   7, 7, 0, 255 },
+	{ -1.07f, -0.12f, -0.02999995f,   -0.830367f, 0.2360849f, -0.5047323f,   0.f, 0.f,   60, 60, 0, 255 },
+	{ -1.02f, 0.12f, 4.458562e-08f,   -0.830367f, 0.2360849f, -0.5047323f,   0.f, 0.f,   60, 60, 0, 255 },
+	{ -0.99f, 0.14f, -0.03999995f,   -0.830367f, 0.2360849f, -0.5047323f,   0.f, 0.f,   60, 60, 0, 255 },
+	{ -0.95f, 0.1f, -0.04999996f,   0.7856436f, -0.1739211f, -0.5937301f,   0.f, 0.f,   44, 44, 0, 255 },
+	{ -0.91f, 0.11f, 3.977737e-08f,   0.7856436f, -0.1739211f, -0.5937301f,   0.f, 0.f,   44, 44, 0, 255 },
+	{ -1.f, -0.16f, -0.03999995f,   0.7856436f, -0.1739211f, -0.5937301f,   0.f, 0.f,   44, 44, 0, 255 },
+	{ -0.99f, 0.14f, -0.03999995f,   -0.01503955f, 0.3609529f, -0.9324628f,   0.f, 0.f,   92, 92, 0, 255 },
+	{ -0.93f, 0.22f, -0.009999959f,   -0.01503955f, 0.3609529f, -0.9324628f,   0.f, 0.f,   92, 92, 0, 255 },
+	{ -0.79f, 0.1999999f, -0.01999996f,   -0.01503955f, 0.3609529f, -0.9324628f,   0.f, 0.f,   92, 92, 0, 255 },
+	{ -0.89f, 0.15f, -0.01999996f,   0.2182177f, -0.4364358f, -0.8728716f,   0.f, 0.f,   111, 111, 0, 255 },
+	{ -0.99f, 0.14f, -0.03999995f,   0.2182177f, -0.4364358f, -0.8728716f,   0.f, 0.f,   111, 111, 0, 255 },
+	{ -0.79f, 0.1999999f, -0.01999996f,   0.2182177f, -0.4364358f, -0.8728716f,   0.f, 0.f,   111, 111, 0, 255 },
+	{ -0.95f, 0.1f, -0.04999996f,   0.1456752f, 0.3745942f, -0.9156735f,   0.f, 0.f,   96, 96, 0, 255 },
+	{ -0.99f, 0.14f, -0.03999995f,   0.1456752f, 0.3745942f, -0.9156735f,   0.f, 0.f,   96, 96, 0, 255 },
+	{ -0.89f, 0.15f, -0.01999996f,   0.1456752f, 0.3745942f, -0.9156735f,   0.f, 0.f,   96, 96, 0, 255 },
+	{ -0.78f, 0.22f, 3.409488e-08f,   0.04787767f, 0.6942231f, -0.7181656f,   0.f, 0.f,   177, 177, 0, 255 },
+	{ -0.79f, 0.1999999f, -0.01999996f,   0.04787767f, 0.6942231f, -0.7181656f,   0.f, 0.f,   177, 177, 0, 255 },
+	{ -0.93f, 0.22f, -0.009999959f,   0.04787767f, 0.6942231f, -0.7181656f,   0.f, 0.f,   177, 177, 0, 255 },
+	{ -0.91f, 0.11f, 3.977737e-08f,   0.6943137f, -0.5680757f, -0.4418353f,   0.f, 0.f,   145, 145, 0, 255 },
+	{ -0.95f, 0.1f, -0.04999996f,   0.6943137f, -0.5680757f, -0.4418353f,   0.f, 0.f,   145, 145, 0, 255 },
+	{ -0.89f, 0.15f, -0.01999996f,   0.6943137f, -0.5680757f, -0.4418353f,   0.f, 0.f,   145, 145, 0, 255 },
+	{ -1.02f, -0.35f, -0.04999996f,   0.7847518f, -0.05009048f, -0.6177828f,   0.f, 0.f,   13, 13, 0, 255 },
+	{ -1.f, -0.16f, -0.03999995f,   0.7847518f, -0.05009048f, -0.6177828f,   0.f, 0.f,   13, 13, 0, 255 },
+	{ -0.98f, -0.34f, 4.283716e-08f,   0.7847518f, -0.05009048f, -0.6177828f,   0.f, 0.f,   13, 13, 0, 255 },
+	{ -1.f, -0.16f, -0.03999995f,   0.9128712f, 0.182574f, 0.3651479f,   0.f, 0.f,   47, 47, 0, 255 },
+	{ -1.f, -0.24f, 4.371139e-08f,   0.9128712f, 0.182574f, 0.3651479f,   0.f, 0.f,   47, 47, 0, 255 },
+	{ -0.98f, -0.34f, 4.283716e-08f,   0.9128712f, 0.182574f, 0.3651479f,   0.f, 0.f,   47, 47, 0, 255 },
+	{ -1.1f, -0.34f, 4.808253e-08f,   -0.98405f, 0.1157705f, -0.1350655f,   0.f, 0.f,   30, 30, 0, 255 },
+	{ -1.07f, -0.12f, -0.02999995f,   -0.98405f, 0.1157705f, -0.1350655f,   0.f, 0.f,   30, 30, 0, 255 },
+	{ -1.09f, -0.29f, -0.02999995f,   -0.98405f, 0.1157705f, -0.1350655f,   0.f, 0.f,   30, 30, 0, 255 },
+	{ -1.07f, -0.12f, -0.02999995f,   -0.1055735f, 0.06334415f, -0.9923919f,   0.f, 0.f,   16, 16, 0, 255 },
+	{ -1.f, -0.16f, -0.03999995f,   -0.1055735f, 0.06334415f, -0.9923919f,   0.f, 0.f,   16, 16, 0, 255 },
+	{ -1.02f, -0.35f, -0.04999996f,   -0.1055735f, 0.06334415f, -0.9923919f,   0.f, 0.f,   16, 16, 0, 255 },
+	{ -1.09f, -0.29f, -0.02999995f,   -0.2511088f, 0.02954218f, -0.967508f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ -1.07f, -0.12f, -0.02999995f,   -0.2511088f, 0.02954218f, -0.967508f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ -1.02f, -0.35f, -0.04999996f,   -0.2511088f, 0.02954218f, -0.967508f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ -1.08f, -0.45f, -0.009999952f,   -0.6040522f, -0.1359119f, -0.78527f,   0.f, 0.f,   35, 35, 0, 255 },
+	{ -1.09f, -0.29f, -0.02999995f,   -0.6040522f, -0.1359119f, -0.78527f,   0.f, 0.f,   35, 35, 0, 255 },
+	{ -1.05f, -0.41f, -0.03999995f,   -0.6040522f, -0.1359119f, -0.78527f,   0.f, 0.f,   35, 35, 0, 255 },
+	{ -1.1f, -0.34f, 4.808253e-08f,   -0.8694949f, -0.1144071f, -0.4805099f,   0.f, 0.f,   29, 29, 0, 255 },
+	{ -1.09f, -0.29f, -0.02999995f,   -0.8694949f, -0.1144071f, -0.4805099f,   0.f, 0.f,   29, 29, 0, 255 },
+	{ -1.08f, -0.45f, -0.009999952f,   -0.8694949f, -0.1144071f, -0.4805099f,   0.f, 0.f,   29, 29, 0, 255 },
+	{ -1.09f, -0.29f, -0.02999995f,   -0.2873113f, -0.0159619f, -0.9577042f,   0.f, 0.f,   4, 4, 0, 255 },
+	{ -1.02f, -0.35f, -0.04999996f,   -0.2873113f, -0.0159619f, -0.9577042f,   0.f, 0.f,   4, 4, 0, 255 },
+	{ -1.05f, -0.41f, -0.03999995f,   -0.2873113f, -0.0159619f, -0.9577042f,   0.f, 0.f,   4, 4, 0, 255 },
+	{ -1.f, -0.16f, -0.03999995f,   -0.1468965f, -0.009793129f, -0.9891034f,   0.f, 0.f,   2, 2, 0, 255 },
+	{ -1.07f, -0.12f, -0.02999995f,   -0.1468965f, -0.009793129f, -0.9891034f,   0.f, 0.f,   2, 2, 0, 255 },
+	{ -0.95f, 0.1f, -0.04999996f,   -0.1468965f, -0.009793129f, -0.9891034f,   0.f, 0.f,   2, 2, 0, 255 },
+	{ 1.f, 0.25f, -0.05000005f,   -0.316228f, 0.f, -0.9486833f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 1.f, 0.4f, -0.05000005f,   -0.316228f, 0.f, -0.9486833f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 1.03f, 0.26f, -0.06000004f,   -0.316228f, 0.f, -0.9486833f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 1.03f, 0.35f, -0.07000005f,   -0.6461595f, -0.08428159f, -0.7585345f,   0.f, 0.f,   21, 21, 0, 255 },
+	{ 1.03f, 0.26f, -0.06000004f,   -0.6461595f, -0.08428159f, -0.7585345f,   0.f, 0.f,   21, 21, 0, 255 },
+	{ 1.f, 0.4f, -0.05000005f,   -0.6461595f, -0.08428159f, -0.7585345f,   0.f, 0.f,   21, 21, 0, 255 },
+	{ 1.03f, 0.35f, -0.07000005f,   -0.0818544f, 0.3274186f, -0.9413272f,   0.f, 0.f,   83, 83, 0, 255 },
+	{ 1.f, 0.4f, -0.05000005f,   -0.0818544f, 0.3274186f, -0.9413272f,   0.f, 0.f,   83, 83, 0, 255 },
+	{ 1.07f, 0.36f, -0.07000005f,   -0.0818544f, 0.3274186f, -0.9413272f,   0.f, 0.f,   83, 83, 0, 255 },
+	{ 1.06f, 0.3099999f, -0.06000004f,   0.1810121f, -0.1086073f, -0.9774656f,   0.f, 0.f,   28, 28, 0, 255 },
+	{ 1.03f, 0.26f, -0.06000004f,   0.1810121f, -0.1086073f, -0.9774656f,   0.f, 0.f,   28, 28, 0, 255 },
+	{ 1.03f, 0.35f, -0.07000005f,   0.1810121f, -0.1086073f, -0.9774656f,   0.f, 0.f,   28, 28, 0, 255 },
+	{ 1.f, 0.25f, -0.05000005f,   -0.3651484f, -0.912871f, -0.182574f,   0.f, 0.f,   233, 233, 0, 255 },
+	{ 1.04f, 0.23f, -0.03000004f,   -0.3651484f, -0.912871f, -0.182574f,   0.f, 0.f,   233, 233, 0, 255 },
+	{ 1.02f, 0.23f, 0.009999955f,   -0.3651484f, -0.912871f, -0.182574f,   0.f, 0.f,   233, 233, 0, 255 },
+	{ 0.64f, 0.6899999f, -0.04000003f,   -0.3939203f, 0.9191446f, 0.f,   0.f, 0.f,   234, 234, 0, 255 },
+	{ 0.71f, 0.72f, 0.03999997f,   -0.3939203f, 0.9191446f, 0.f,   0.f, 0.f,   234, 234, 0, 255 },
+	{ 0.71f, 0.72f, -0.04000003f,   -0.3939203f, 0.9191446f, 0.f,   0.f, 0.f,   234, 234, 0, 255 },
+	{ 1.04f, 0.23f, -0.03000004f,   4.115909e-08f, -0.7071071f, -0.7071065f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ 1.f, 0.25f, -0.05000005f,   4.115909e-08f, -0.7071071f, -0.7071065f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ 1.03f, 0.26f, -0.06000004f,   4.115909e-08f, -0.7071071f, -0.7071065f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ 0.96f, 0.49f, -0.04000004f,   0.2901292f, 0.2321035f, -0.9284142f,   0.f, 0.f,   59, 59, 0, 255 },
+	{ 1.08f, 0.38f, -0.03000005f,   0.2901292f, 0.2321035f, -0.9284142f,   0.f, 0.f,   59, 59, 0, 255 },
+	{ 1.f, 0.4f, -0.05000005f,   0.2901292f, 0.2321035f, -0.9284142f,   0.f, 0.f,   59, 59, 0, 255 },
+	{ 0.93f, 0.4599999f, -0.05000004f,   0.07940228f, 0.09263614f, -0.992529f,   0.f, 0.f,   24, 24, 0, 255 },
+	{ 1.f, 0.4f, -0.05000005f,   0.07940228f, 0.09263614f, -0.992529f,   0.f, 0.f,   24, 24, 0, 255 },
+	{ 0.91f, 0.37f, -0.06000004f,   0.07940228f, 0.09263614f, -0.992529f,   0.f, 0.f,   24, 24, 0, 255 },
+	{ 0.96f, 0.49f, -0.04000004f,   0.1497193f, 0.1746727f, -0.9731771f,   0.f, 0.f,   45, 45, 0, 255 },
+	{ 1.f, 0.4f, -0.05000005f,   0.1497193f, 0.1746727f, -0.9731771f,   0.f, 0.f,   45, 45, 0, 255 },
+	{ 0.93f, 0.4599999f, -0.05000004f,   0.1497193f, 0.1746727f, -0.9731771f,   0.f, 0.f,   45, 45, 0, 255 },
+	{ 0.9f, 0.49f, -0.08000004f,   0.5430753f, -0.2036536f, -0.814613f,   0.f, 0.f,   52, 52, 0, 255 },
+	{ 0.93f, 0.5699999f, -0.08000004f,   0.5430753f, -0.2036536f, -0.814613f,   0.f, 0.f,   52, 52, 0, 255 },
+	{ 0.96f, 0.49f, -0.04000004f,   0.5430753f, -0.2036536f, -0.814613f,   0.f, 0.f,   52, 52, 0, 255 },
+	{ 0.96f, 0.49f, -0.04000004f,   0.5345226f, -0.2672599f, -0.8017841f,   0.f, 0.f,   68, 68, 0, 255 },
+	{ 0.93f, 0.4599999f, -0.05000004f,   0.5345226f, -0.2672599f, -0.8017841f,   0.f, 0.f,   68, 68, 0, 255 },
+	{ 0.9f, 0.49f, -0.08000004f,   0.5345226f, -0.2672599f, -0.8017841f,   0.f, 0.f,   68, 68, 0, 255 },
+	{ 1.07f, 0.36f, -0.07000005f,   -0.2822154f, -0.9407212f, 0.1881434f,   0.f, 0.f,   240, 240, 0, 255 },
+	{ 1.09f, 0.36f, -0.04000005f,   -0.2822154f, -0.9407212f, 0.1881434f,   0.f, 0.f,   240, 240, 0, 255 },
+	{ 1.05f, 0.37f, -0.05000005f,   -0.2822154f, -0.9407212f, 0.1881434f,   0.f, 0.f,   240, 240, 0, 255 },
+	{ 1.03f, 0.35f, -0.07000005f,   0.1961156f, -0.7844646f, 0.5883485f,   0.f, 0.f,   200, 200, 0, 255 },
+	{ 1.07f, 0.36f, -0.07000005f,   0.1961156f, -0.7844646f, 0.5883485f,   0.f, 0.f,   200, 200, 0, 255 },
+	{ 1.05f, 0.37f, -0.05000005f,   0.1961156f, -0.7844646f, 0.5883485f,   0.f, 0.f,   200, 200, 0, 255 },
+	{ 1.f, 0.4f, -0.05000005f,   0.3244425f, 0.8111075f, -0.4866639f,   0.f, 0.f,   207, 207, 0, 255 },
+	{ 1.08f, 0.38f, -0.03000005f,   0.3244425f, 0.8111075f, -0.4866639f,   0.f, 0.f,   207, 207, 0, 255 },
+	{ 1.07f, 0.36f, -0.07000005f,   0.3244425f, 0.8111075f, -0.4866639f,   0.f, 0.f,   207, 207, 0, 255 },
+	{ 1.08f, 0.38f, -0.03000005f,   0.6837636f, 0.569803f, -0.455842f,   0.f, 0.f,   145, 145, 0, 255 },
+	{ 1.09f, 0.36f, -0.04000005f,   0.6837636f, 0.569803f, -0.455842f,   0.f, 0.f,   145, 145, 0, 255 },
+	{ 1.07f, 0.36f, -0.07000005f,   0.6837636f, 0.569803f, -0.455842f,   0.f, 0.f,   145, 145, 0, 255 },
+	{ 0.75f, 0.72f, -0.04000003f,   0.f, 1.f, 0.f,   0.f, 0.f,   255, 255, 0, 255 },
+	{ 0.71f, 0.72f, -0.04000003f,   0.f, 1.f, 0.f,   0.f, 0.f,   255, 255, 0, 255 },
+	{ 0.71f, 0.72f, 0.03999997f,   0.f, 1.f, 0.f,   0.f, 0.f,   255, 255, 0, 255 },
+	{ 0.85f, 0.5599999f, -0.12f,   0.286039f, -0.09534635f, -0.9534626f,   0.f, 0.f,   24, 24, 0, 255 },
+	{ 0.88f, 0.55f, -0.11f,   0.286039f, -0.09534635f, -0.9534626f,   0.f, 0.f,   24, 24, 0, 255 },
+	{ 0.87f, 0.52f, -0.11f,   0.286039f, -0.09534635f, -0.9534626f,   0.f, 0.f,   24, 24, 0, 255 },
+	{ 1.06f, 0.3099999f, -0.06000004f,   0.2850614f, 0.2036154f, -0.9366327f,   0.f, 0.f,   52, 52, 0, 255 },
+	{ 1.05f, 0.37f, -0.05000005f,   0.2850614f, 0.2036154f, -0.9366327f,   0.f, 0.f,   52, 52, 0, 255 },
+	{ 1.09f, 0.36f, -0.04000005f,   0.2850614f, 0.2036154f, -0.9366327f,   0.f, 0.f,   52, 52, 0, 255 },
+	{ 0.92f, 0.53f, -0.09000004f,   0.4472125f, 0.8944278f, 1.301561e-06f,   0.f, 0.f,   228, 228, 0, 255 },
+	{ 0.88f, 0.55f, -0.11f,   0.4472125f, 0.8944278f, 1.301561e-06f,   0.f, 0.f,   228, 228, 0, 255 },
+	{ 0.9f, 0.54f, -0.09000004f,   0.4472125f, 0.8944278f, 1.301561e-06f,   0.f, 0.f,   228, 228, 0, 255 },
+	{ 0.72f, 0.7099999f, -0.06000003f,   -0.6270596f, -0.3483666f, -0.6967331f,   0.f, 0.f,   89, 89, 0, 255 },
+	{ 0.77f, 0.76f, -0.13f,   -0.6270596f, -0.3483666f, -0.6967331f,   0.f, 0.f,   89, 89, 0, 255 },
+	{ 0.77f, 0.72f, -0.11f,   -0.6270596f, -0.3483666f, -0.6967331f,   0.f, 0.f,   89, 89, 0, 255 },
+	{ 0.75f, 0.6799999f, -0.08000003f,   0.5948122f, 0.2703687f, 0.7570332f,   0.f, 0.f,   69, 69, 0, 255 },
+	{ 0.77f, 0.72f, -0.11f,   0.5948122f, 0.2703687f, 0.7570332f,   0.f, 0.f,   69, 69, 0, 255 },
+	{ 0.74f, 0.73f, -0.09000003f,   0.5948122f, 0.2703687f, 0.7570332f,   0.f, 0.f,   69, 69, 0, 255 },
+	{ 0.87f, 0.52f, -0.11f,   0.3905666f, -0.1301888f, -0.9113224f,   0.f, 0.f,   33, 33, 0, 255 },
+	{ 0.88f, 0.55f, -0.11f,   0.3905666f, -0.1301888f, -0.9113224f,   0.f, 0.f,   33, 33, 0, 255 },
+	{ 0.92f, 0.53f, -0.09000004f,   0.3905666f, -0.1301888f, -0.9113224f,   0.f, 0.f,   33, 33, 0, 255 },
+	{ 0.85f, 0.5599999f, -0.12f,   0.2280857f, -0.6082294f, -0.7602854f,   0.f, 0.f,   155, 155, 0, 255 },
+	{ 0.91f, 0.5699999f, -0.11f,   0.2280857f, -0.6082294f, -0.7602854f,   0.f, 0.f,   155, 155, 0, 255 },
+	{ 0.89f, 0.55f, -0.1f,   0.2280857f, -0.6082294f, -0.7602854f,   0.f, 0.f,   155, 155, 0, 255 },
+	{ 0.89f, 0.55f, -0.1f,   0.4082483f, 0.8164967f, -0.408248f,   0.f, 0.f,   208, 208, 0, 255 },
+	{ 0.88f, 0.55f, -0.11f,   0.4082483f, 0.8164967f, -0.408248f,   0.f, 0.f,   208, 208, 0, 255 },
+	{ 0.85f, 0.5599999f, -0.12f,   0.4082483f, 0.8164967f, -0.408248f,   0.f, 0.f,   208, 208, 0, 255 },
+	{ 0.9f, 0.54f, -0.09000004f,   0.1961159f, -0.5883489f, -0.7844642f,   0.f, 0.f,   150, 150, 0, 255 },
+	{ 0.89f, 0.55f, -0.1f,   0.1961159f, -0.5883489f, -0.7844642f,   0.f, 0.f,   150, 150, 0, 255 },
+	{ 0.91f, 0.5699999f, -0.11f,   0.1961159f, -0.5883489f, -0.7844642f,   0.f, 0.f,   150, 150, 0, 255 },
+	{ 0.91f, 0.5699999f, -0.11f,   -0.2407711f, -0.4815436f, -0.8427011f,   0.f, 0.f,   123, 123, 0, 255 },
+	{ 0.92f, 0.53f, -0.09000004f,   -0.2407711f, -0.4815436f, -0.8427011f,   0.f, 0.f,   123, 123, 0, 255 },
+	{ 0.9f, 0.54f, -0.09000004f,   -0.2407711f, -0.4815436f, -0.8427011f,   0.f, 0.f,   123, 123, 0, 255 },
+	{ 1.06f, 0.3099999f, -0.06000004f,   0.6467606f, -0.4042264f, -0.6467626f,   0.f, 0.f,   103, 103, 0, 255 },
+	{ 1.09f, 0.3099999f, -0.03000005f,   0.6467606f, -0.4042264f, -0.6467626f,   0.f, 0.f,   103, 103, 0, 255 },
+	{ 1.04f, 0.23f, -0.03000004f,   0.6467606f, -0.4042264f, -0.6467626f,   0.f, 0.f,   103, 103, 0, 255 },
+	{ 1.08f, 0.38f, -0.03000005f,   0.9102082f, 0.3982161f, 0.1137759f,   0.f, 0.f,   102, 102, 0, 255 },
+	{ 1.09f, 0.34f, 0.02999995f,   0.9102082f, 0.3982161f, 0.1137759f,   0.f, 0.f,   102, 102, 0, 255 },
+	{ 1.09f, 0.36f, -0.04000005f,   0.9102082f, 0.3982161f, 0.1137759f,   0.f, 0.f,   102, 102, 0, 255 },
+	{ 1.09f, 0.36f, -0.04000005f,   1.f, 0.f, 0.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 1.09f, 0.34f, 0.02999995f,   1.f, 0.f, 0.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 1.09f, 0.3099999f, -0.03000005f,   1.f, 0.f, 0.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 1.09f, 0.3099999f, -0.03000005f,   0.8479005f, -0.5299391f, 0.01514052f,   0.f, 0.f,   135, 135, 0, 255 },
+	{ 1.07f, 0.28f, 0.03999995f,   0.8479005f, -0.5299391f, 0.01514052f,   0.f, 0.f,   135, 135, 0, 255 },
+	{ 1.04f, 0.23f, -0.03000004f,   0.8479005f, -0.5299391f, 0.01514052f,   0.f, 0.f,   135, 135, 0, 255 },
+	{ 1.03f, 0.26f, -0.06000004f,   0.6694829f, -0.4016898f, -0.6248502f,   0.f, 0.f,   102, 102, 0, 255 },
+	{ 1.06f, 0.3099999f, -0.06000004f,   0.6694829f, -0.4016898f, -0.6248502f,   0.f, 0.f,   102, 102, 0, 255 },
+	{ 1.04f, 0.23f, -0.03000004f,   0.6694829f, -0.4016898f, -0.6248502f,   0.f, 0.f,   102, 102, 0, 255 },
+	{ 0.95f, 0.55f, -0.01000004f,   0.9045336f, 0.3015119f, -0.3015123f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ 0.97f, 0.51f, 0.009999957f,   0.9045336f, 0.3015119f, -0.3015123f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ 0.96f, 0.49f, -0.04000004f,   0.9045336f, 0.3015119f, -0.3015123f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ 0.93f, 0.5699999f, -0.08000004f,   0.9462837f, 0.2562852f, -0.1971423f,   0.f, 0.f,   65, 65, 0, 255 },
+	{ 0.95f, 0.55f, -0.01000004f,   0.9462837f, 0.2562852f, -0.1971423f,   0.f, 0.f,   65, 65, 0, 255 },
+	{ 0.96f, 0.49f, -0.04000004f,   0.9462837f, 0.2562852f, -0.1971423f,   0.f, 0.f,   65, 65, 0, 255 },
+	{ 0.97f, 0.51f, 0.009999957f,   0.639079f, 0.6615031f, -0.3924175f,   0.f, 0.f,   169, 169, 0, 255 },
+	{ 1.08f, 0.38f, -0.03000005f,   0.639079f, 0.6615031f, -0.3924175f,   0.f, 0.f,   169, 169, 0, 255 },
+	{ 0.96f, 0.49f, -0.04000004f,   0.639079f, 0.6615031f, -0.3924175f,   0.f, 0.f,   169, 169, 0, 255 },
+	{ 1.05f, 0.37f, -0.05000005f,   0.5661392f, 0.2264551f, -0.7925935f,   0.f, 0.f,   58, 58, 0, 255 },
+	{ 1.06f, 0.3099999f, -0.06000004f,   0.5661392f, 0.2264551f, -0.7925935f,   0.f, 0.f,   58, 58, 0, 255 },
+	{ 1.03f, 0.35f, -0.07000005f,   0.5661392f, 0.2264551f, -0.7925935f,   0.f, 0.f,   58, 58, 0, 255 },
+	{ 0.91f, 0.5699999f, -0.11f,   0.5833835f, 0.7130241f, -0.388922f,   0.f, 0.f,   182, 182, 0, 255 },
+	{ 0.82f, 0.66f, -0.08000004f,   0.5833835f, 0.7130241f, -0.388922f,   0.f, 0.f,   182, 182, 0, 255 },
+	{ 0.93f, 0.5699999f, -0.08000004f,   0.5833835f, 0.7130241f, -0.388922f,   0.f, 0.f,   182, 182, 0, 255 },
+	{ 0.79f, 0.7099999f, -0.04000003f,   0.5680752f, 0.694314f, -0.4418356f,   0.f, 0.f,   177, 177, 0, 255 },
+	{ 0.93f, 0.5699999f, -0.08000004f,   0.5680752f, 0.694314f, -0.4418356f,   0.f, 0.f,   177, 177, 0, 255 },
+	{ 0.82f, 0.66f, -0.08000004f,   0.5680752f, 0.694314f, -0.4418356f,   0.f, 0.f,   177, 177, 0, 255 },
+	{ 0.9f, 0.49f, -0.08000004f,   0.8479975f, -0.3179997f, 0.4240007f,   0.f, 0.f,   81, 81, 0, 255 },
+	{ 0.92f, 0.53f, -0.09000004f,   0.8479975f, -0.3179997f, 0.4240007f,   0.f, 0.f,   81, 81, 0, 255 },
+	{ 0.93f, 0.5699999f, -0.08000004f,   0.8479975f, -0.3179997f, 0.4240007f,   0.f, 0.f,   81, 81, 0, 255 },
+	{ 0.34f, -1.09f, -0.05000002f,   -0.909588f, -0.4134491f, -0.04134487f,   0.f, 0.f,   105, 105, 0, 255 },
+	{ 0.34f, -1.08f, -0.15f,   -0.909588f, -0.4134491f, -0.04134487f,   0.f, 0.f,   105, 105, 0, 255 },
+	{ 0.35f, -1.1f, -0.17f,   -0.909588f, -0.4134491f, -0.04134487f,   0.f, 0.f,   105, 105, 0, 255 },
+	{ 0.43f, -1.1f, -0.05000002f,   -0.105503f, -0.9495278f, -0.2954083f,   0.f, 0.f,   242, 242, 0, 255 },
+	{ 0.34f, -1.09f, -0.05000002f,   -0.105503f, -0.9495278f, -0.2954083f,   0.f, 0.f,   242, 242, 0, 255 },
+	{ 0.48f, -1.09f, -0.1f,   -0.105503f, -0.9495278f, -0.2954083f,   0.f, 0.f,   242, 242, 0, 255 },
+	{ -0.81f, -0.99f, -0.15f,   0.773166f, 0.3006757f, -0.5583981f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ -0.85f, -0.98f, -0.2f,   0.773166f, 0.3006757f, -0.5583981f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ -0.87f, -0.91f, -0.19f,   0.773166f, 0.3006757f, -0.5583981f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ 0.44f, -1.1f, -0.16f,   0.04759313f, -0.9899376f, 0.1332607f,   0.f, 0.f,   252, 252, 0, 255 },
+	{ 0.48f, -1.09f, -0.1f,   0.04759313f, -0.9899376f, 0.1332607f,   0.f, 0.f,   252, 252, 0, 255 },
+	{ 0.34f, -1.09f, -0.05000002f,   0.04759313f, -0.9899376f, 0.1332607f,   0.f, 0.f,   252, 252, 0, 255 },
+	{ 0.34f, -1.09f, -0.05000002f,   -0.00914281f, -0.9965669f, 0.08228526f,   0.f, 0.f,   254, 254, 0, 255 },
+	{ 0.35f, -1.1f, -0.17f,   -0.00914281f, -0.9965669f, 0.08228526f,   0.f, 0.f,   254, 254, 0, 255 },
+	{ 0.44f, -1.1f, -0.16f,   -0.00914281f, -0.9965669f, 0.08228526f,   0.f, 0.f,   254, 254, 0, 255 },
+	{ 0.48f, -1.09f, -0.1f,   0.768539f, 0.6273785f, -0.1254756f,   0.f, 0.f,   160, 160, 0, 255 },
+	{ 0.4f, -1.f, -0.14f,   0.768539f, 0.6273785f, -0.1254756f,   0.f, 0.f,   160, 160, 0, 255 },
+	{ 0.4f, -0.99f, -0.09000002f,   0.768539f, 0.6273785f, -0.1254756f,   0.f, 0.f,   160, 160, 0, 255 },
+	{ -0.94f, -0.96f, -0.16f,   -0.6225125f, -0.3260785f, -0.7114429f,   0.f, 0.f,   83, 83, 0, 255 },
+	{ -0.91f, -0.93f, -0.2f,   -0.6225125f, -0.3260785f, -0.7114429f,   0.f, 0.f,   83, 83, 0, 255 },
+	{ -0.89f, -0.99f, -0.19f,   -0.6225125f, -0.3260785f, -0.7114429f,   0.f, 0.f,   83, 83, 0, 255 },
+	{ -0.91f, -0.93f, -0.2f,   -0.1841779f, -0.2210132f, -0.9577221f,   0.f, 0.f,   56, 56, 0, 255 },
+	{ -0.85f, -0.98f, -0.2f,   -0.1841779f, -0.2210132f, -0.9577221f,   0.f, 0.f,   56, 56, 0, 255 },
+	{ -0.89f, -0.99f, -0.19f,   -0.1841779f, -0.2210132f, -0.9577221f,   0.f, 0.f,   56, 56, 0, 255 },
+	{ -0.85f, -0.98f, -0.2f,   0.1517942f, 0.1821533f, -0.9714828f,   0.f, 0.f,   46, 46, 0, 255 },
+	{ -0.91f, -0.93f, -0.2f,   0.1517942f, 0.1821533f, -0.9714828f,   0.f, 0.f,   46, 46, 0, 255 },
+	{ -0.87f, -0.91f, -0.19f,   0.1517942f, 0.1821533f, -0.9714828f,   0.f, 0.f,   46, 46, 0, 255 },
+	{ -0.96f, -0.91f, -0.17f,   -0.6115932f, -0.08737026f, 0.7863334f,   0.f, 0.f,   22, 22, 0, 255 },
+	{ -0.94f, -0.96f, -0.16f,   -0.6115932f, -0.08737026f, 0.7863334f,   0.f, 0.f,   22, 22, 0, 255 },
+	{ -0.92f, -0.92f, -0.14f,   -0.6115932f, -0.08737026f, 0.7863334f,   0.f, 0.f,   22, 22, 0, 255 },
+	{ -0.94f, -0.96f, -0.16f,   -0.5306685f, -0.1516198f, 0.8339078f,   0.f, 0.f,   39, 39, 0, 255 },
+	{ -0.89f, -0.97f, -0.13f,   -0.5306685f, -0.1516198f, 0.8339078f,   0.f, 0.f,   39, 39, 0, 255 },
+	{ -0.92f, -0.92f, -0.14f,   -0.5306685f, -0.1516198f, 0.8339078f,   0.f, 0.f,   39, 39, 0, 255 },
+	{ -0.83f, -1.f, -0.13f,   0.5461925f, 0.3901375f, 0.7412601f,   0.f, 0.f,   99, 99, 0, 255 },
+	{ -0.81f, -0.99f, -0.15f,   0.5461925f, 0.3901375f, 0.7412601f,   0.f, 0.f,   99, 99, 0, 255 },
+	{ -0.86f, -0.92f, -0.15f,   0.5461925f, 0.3901375f, 0.7412601f,   0.f, 0.f,   99, 99, 0, 255 },
+	{ -0.81f, -0.99f, -0.15f,   0.8123623f, 0.580259f, -0.0580258f,   0.f, 0.f,   148, 148, 0, 255 },
+	{ -0.87f, -0.91f, -0.19f,   0.8123623f, 0.580259f, -0.0580258f,   0.f, 0.f,   148, 148, 0, 255 },
+	{ -0.86f, -0.92f, -0.15f,   0.8123623f, 0.580259f, -0.0580258f,   0.f, 0.f,   148, 148, 0, 255 },
+	{ -0.91f, -0.93f, -0.2f,   -0.5827528f, -0.377075f, -0.7198706f,   0.f, 0.f,   96, 96, 0, 255 },
+	{ -0.94f, -0.96f, -0.16f,   -0.5827528f, -0.377075f, -0.7198706f,   0.f, 0.f,   96, 96, 0, 255 },
+	{ -0.96f, -0.91f, -0.17f,   -0.5827528f, -0.377075f, -0.7198706f,   0.f, 0.f,   96, 96, 0, 255 },
+	{ -0.86f, -0.92f, -0.15f,   0.1454787f, 0.2909573f, 0.9456108f,   0.f, 0.f,   74, 74, 0, 255 },
+	{ -0.89f, -0.97f, -0.13f,   0.1454787f, 0.2909573f, 0.9456108f,   0.f, 0.f,   74, 74, 0, 255 },
+	{ -0.83f, -1.f, -0.13f,   0.1454787f, 0.2909573f, 0.9456108f,   0.f, 0.f,   74, 74, 0, 255 },
+	{ 0.34f, -0.99f, -0.14f,   -0.987177f, 0.01762815f, -0.1586533f,   0.f, 0.f,   4, 4, 0, 255 },
+	{ 0.34f, -1.08f, -0.15f,   -0.987177f, 0.01762815f, -0.1586533f,   0.f, 0.f,   4, 4, 0, 255 },
+	{ 0.33f, -1.01f, -0.08000001f,   -0.987177f, 0.01762815f, -0.1586533f,   0.f, 0.f,   4, 4, 0, 255 },
+	{ 0.39f, -1.f, -0.07000002f,   -0.2074733f, 0.3206404f, 0.9241994f,   0.f, 0.f,   82, 82, 0, 255 },
+	{ 0.33f, -1.01f, -0.08000001f,   -0.2074733f, 0.3206404f, 0.9241994f,   0.f, 0.f,   82, 82, 0, 255 },
+	{ 0.34f, -1.09f, -0.05000002f,   -0.2074733f, 0.3206404f, 0.9241994f,   0.f, 0.f,   82, 82, 0, 255 },
+	{ 0.34f, -0.99f, -0.14f,   0.04443587f, 0.2666155f, -0.9627781f,   0.f, 0.f,   68, 68, 0, 255 },
+	{ 0.4f, -1.f, -0.14f,   0.04443587f, 0.2666155f, -0.9627781f,   0.f, 0.f,   68, 68, 0, 255 },
+	{ 0.35f, -1.1f, -0.17f,   0.04443587f, 0.2666155f, -0.9627781f,   0.f, 0.f,   68, 68, 0, 255 },
+	{ 0.34f, -1.08f, -0.15f,   -0.9915899f, -0.1287777f, -0.01287776f,   0.f, 0.f,   33, 33, 0, 255 },
+	{ 0.34f, -1.09f, -0.05000002f,   -0.9915899f, -0.1287777f, -0.01287776f,   0.f, 0.f,   33, 33, 0, 255 },
+	{ 0.33f, -1.01f, -0.08000001f,   -0.9915899f, -0.1287777f, -0.01287776f,   0.f, 0.f,   33, 33, 0, 255 },
+	{ 0.34f, -0.99f, -0.14f,   -0.8702855f, 0.05439281f, -0.4895352f,   0.f, 0.f,   14, 14, 0, 255 },
+	{ 0.35f, -1.1f, -0.17f,   -0.8702855f, 0.05439281f, -0.4895352f,   0.f, 0.f,   14, 14, 0, 255 },
+	{ 0.34f, -1.08f, -0.15f,   -0.8702855f, 0.05439281f, -0.4895352f,   0.f, 0.f,   14, 14, 0, 255 },
+	{ 0.29f, -0.96f, -0.08000001f,   -0.7664013f, -0.6131219f, 0.1916001f,   0.f, 0.f,   156, 156, 0, 255 },
+	{ 0.28f, -0.96f, -0.12f,   -0.7664013f, -0.6131219f, 0.1916001f,   0.f, 0.f,   156, 156, 0, 255 },
+	{ 0.33f, -1.01f, -0.08000001f,   -0.7664013f, -0.6131219f, 0.1916001f,   0.f, 0.f,   156, 156, 0, 255 },
+	{ 0.34f, -0.99f, -0.14f,   -0.4437602f, -0.3328205f, -0.8320502f,   0.f, 0.f,   85, 85, 0, 255 },
+	{ 0.28f, -0.96f, -0.12f,   -0.4437602f, -0.3328205f, -0.8320502f,   0.f, 0.f,   85, 85, 0, 255 },
+	{ 0.31f, -0.95f, -0.14f,   -0.4437602f, -0.3328205f, -0.8320502f,   0.f, 0.f,   85, 85, 0, 255 },
+	{ 0.28f, -0.96f, -0.12f,   -0.5094283f, -0.787299f, -0.3473373f,   0.f, 0.f,   201, 201, 0, 255 },
+	{ 0.34f, -0.99f, -0.14f,   -0.5094283f, -0.787299f, -0.3473373f,   0.f, 0.f,   201, 201, 0, 255 },
+	{ 0.33f, -1.01f, -0.08000001f,   -0.5094283f, -0.787299f, -0.3473373f,   0.f, 0.f,   201, 201, 0, 255 },
+	{ 0.48f, -1.09f, -0.1f,   0.7293435f, 0.4023962f, -0.553295f,   0.f, 0.f,   103, 103, 0, 255 },
+	{ 0.44f, -1.1f, -0.16f,   0.7293435f, 0.4023962f, -0.553295f,   0.f, 0.f,   103, 103, 0, 255 },
+	{ 0.4f, -1.f, -0.14f,   0.7293435f, 0.4023962f, -0.553295f,   0.f, 0.f,   103, 103, 0, 255 },
+	{ 0.44f, -1.1f, -0.16f,   0.10731f, 0.2360819f, -0.9657898f,   0.f, 0.f,   60, 60, 0, 255 },
+	{ 0.35f, -1.1f, -0.17f,   0.10731f, 0.2360819f, -0.9657898f,   0.f, 0.f,   60, 60, 0, 255 },
+	{ 0.4f, -1.f, -0.14f,   0.10731f, 0.2360819f, -0.9657898f,   0.f, 0.f,   60, 60, 0, 255 },
+	{ 0.34f, -1.09f, -0.05000002f,   0.02275669f, 0.20481f, 0.9785371f,   0.f, 0.f,   52, 52, 0, 255 },
+	{ 0.43f, -1.1f, -0.05000002f,   0.02275669f, 0.20481f, 0.9785371f,   0.f, 0.f,   52, 52, 0, 255 },
+	{ 0.39f, -1.f, -0.07000002f,   0.02275669f, 0.20481f, 0.9785371f,   0.f, 0.f,   52, 52, 0, 255 },
+	{ 0.39f, -1.f, -0.07000002f,   0.6135722f, 0.3834825f, 0.6902683f,   0.f, 0.f,   98, 98, 0, 255 },
+	{ 0.43f, -1.1f, -0.05000002f,   0.6135722f, 0.3834825f, 0.6902683f,   0.f, 0.f,   98, 98, 0, 255 },
+	{ 0.48f, -1.09f, -0.1f,   0.6135722f, 0.3834825f, 0.6902683f,   0.f, 0.f,   98, 98, 0, 255 },
+	{ 0.48f, -1.09f, -0.1f,   0.6674239f, 0.476731f, 0.5720778f,   0.f, 0.f,   122, 122, 0, 255 },
+	{ 0.4f, -0.99f, -0.09000002f,   0.6674239f, 0.476731f, 0.5720778f,   0.f, 0.f,   122, 122, 0, 255 },
+	{ 0.39f, -1.f, -0.07000002f,   0.6674239f, 0.476731f, 0.5720778f,   0.f, 0.f,   122, 122, 0, 255 },
+	{ -0.87f, -1.09f, -0.11f,   -0.8771974f, -0.4784713f, 0.03987258f,   0.f, 0.f,   122, 122, 0, 255 },
+	{ -0.88f, -1.08f, -0.2099999f,   -0.8771974f, -0.4784713f, 0.03987258f,   0.f, 0.f,   122, 122, 0, 255 },
+	{ -0.87f, -1.1f, -0.23f,   -0.8771974f, -0.4784713f, 0.03987258f,   0.f, 0.f,   122, 122, 0, 255 },
+	{ -0.79f, -1.1f, -0.09999996f,   -0.09124142f, -0.9671598f, -0.2372277f,   0.f, 0.f,   247, 247, 0, 255 },
+	{ -0.87f, -1.09f, -0.11f,   -0.09124142f, -0.9671598f, -0.2372277f,   0.f, 0.f,   247, 247, 0, 255 },
+	{ -0.74f, -1.09f, -0.16f,   -0.09124142f, -0.9671598f, -0.2372277f,   0.f, 0.f,   247, 247, 0, 255 },
+	{ -0.77f, -1.1f, -0.22f,   0.05317041f, -0.9889701f, 0.138243f,   0.f, 0.f,   252, 252, 0, 255 },
+	{ -0.74f, -1.09f, -0.16f,   0.05317041f, -0.9889701f, 0.138243f,   0.f, 0.f,   252, 252, 0, 255 },
+	{ -0.87f, -1.09f, -0.11f,   0.05317041f, -0.9889701f, 0.138243f,   0.f, 0.f,   252, 252, 0, 255 },
+	{ -0.87f, -1.09f, -0.11f,   -0.008304236f, -0.9965115f, 0.08304254f,   0.f, 0.f,   254, 254, 0, 255 },
+	{ -0.87f, -1.1f, -0.23f,   -0.008304236f, -0.9965115f, 0.08304254f,   0.f, 0.f,   254, 254, 0, 255 },
+	{ -0.77f, -1.1f, -0.22f,   -0.008304236f, -0.9965115f, 0.08304254f,   0.f, 0.f,   254, 254, 0, 255 },
+	{ -0.74f, -1.09f, -0.16f,   0.7864628f, 0.5734622f, -0.2293847f,   0.f, 0.f,   146, 146, 0, 255 },
+	{ -0.81f, -1.01f, -0.2f,   0.7864628f, 0.5734622f, -0.2293847f,   0.f, 0.f,   146, 146, 0, 255 },
+	{ -0.81f, -0.99f, -0.15f,   0.7864628f, 0.5734622f, -0.2293847f,   0.f, 0.f,   146, 146, 0, 255 },
+	{ 0.58f, 0.76f, 0.01999997f,   0.05438574f, -0.07530323f, 0.9956765f,   0.f, 0.f,   19, 19, 0, 255 },
+	{ 0.5f, 0.5699999f, 0.009999978f,   0.05438574f, -0.07530323f, 0.9956765f,   0.f, 0.f,   19, 19, 0, 255 },
+	{ 0.78f, 0.64f, -3.409488e-08f,   0.05438574f, -0.07530323f, 0.9956765f,   0.f, 0.f,   19, 19, 0, 255 },
+	{ 0.77f, 0.79f, -3.365777e-08f,   0.1036036f, 0.006906901f, 0.9945946f,   0.f, 0.f,   2, 2, 0, 255 },
+	{ 0.58f, 0.76f, 0.01999997f,   0.1036036f, 0.006906901f, 0.9945946f,   0.f, 0.f,   2, 2, 0, 255 },
+	{ 0.78f, 0.64f, -3.409488e-08f,   0.1036036f, 0.006906901f, 0.9945946f,   0.f, 0.f,   2, 2, 0, 255 },
+	{ 0.34f, 0.63f, 0.01999998f,   0.04935765f, -0.05922912f, 0.9970234f,   0.f, 0.f,   15, 15, 0, 255 },
+	{ 0.23f, 0.37f, 0.00999999f,   0.04935765f, -0.05922912f, 0.9970234f,   0.f, 0.f,   15, 15, 0, 255 },
+	{ 0.35f, 0.47f, 0.009999985f,   0.04935765f, -0.05922912f, 0.9970234f,   0.f, 0.f,   15, 15, 0, 255 },
+	{ 0.34f, 0.63f, 0.01999998f,   0.03989641f, -0.05984462f, 0.9974101f,   0.f, 0.f,   15, 15, 0, 255 },
+	{ 0.35f, 0.47f, 0.009999985f,   0.03989641f, -0.05984462f, 0.9974101f,   0.f, 0.f,   15, 15, 0, 255 },
+	{ 0.5f, 0.5699999f, 0.009999978f,   0.03989641f, -0.05984462f, 0.9974101f,   0.f, 0.f,   15, 15, 0, 255 },
+	{ 0.58f, 0.76f, 0.01999997f,   0.03682132f, -0.06797773f, 0.9970072f,   0.f, 0.f,   17, 17, 0, 255 },
+	{ 0.34f, 0.63f, 0.01999998f,   0.03682132f, -0.06797773f, 0.9970072f,   0.f, 0.f,   17, 17, 0, 255 },
+	{ 0.5f, 0.5699999f, 0.009999978f,   0.03682132f, -0.06797773f, 0.9970072f,   0.f, 0.f,   17, 17, 0, 255 },
+	{ 0.12f, 0.42f, -5.245366e-09f,   -0.09053569f, 0.f, 0.9958932f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.12f, 0.3f, -5.245366e-09f,   -0.09053569f, 0.f, 0.9958932f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.23f, 0.37f, 0.00999999f,   -0.09053569f, 0.f, 0.9958932f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.34f, 0.63f, 0.01999998f,   -0.0905357f, 0.f, 0.9958932f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.12f, 0.42f, -5.245366e-09f,   -0.0905357f, 0.f, 0.9958932f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.23f, 0.37f, 0.00999999f,   -0.0905357f, 0.f, 0.9958932f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.34f, 0.63f, 0.01999998f,   -0.6886138f, 0.7054091f, 0.167955f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ 0.32f, 0.62f, -0.02000001f,   -0.6886138f, 0.7054091f, 0.167955f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ 0.12f, 0.42f, -5.245366e-09f,   -0.6886138f, 0.7054091f, 0.167955f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ -0.92f, -0.92f, -0.14f,   -0.3889224f, 0.5833836f, 0.7130237f,   0.f, 0.f,   149, 149, 0, 255 },
+	{ -0.93f, -0.89f, -0.17f,   -0.3889224f, 0.5833836f, 0.7130237f,   0.f, 0.f,   149, 149, 0, 255 },
+	{ -0.96f, -0.91f, -0.17f,   -0.3889224f, 0.5833836f, 0.7130237f,   0.f, 0.f,   149, 149, 0, 255 },
+	{ -0.89f, -0.99f, -0.19f,   -0.9935275f, -0.09740455f, -0.05844267f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ -0.88f, -1.08f, -0.2099999f,   -0.9935275f, -0.09740455f, -0.05844267f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ -0.89f, -1.02f, -0.14f,   -0.9935275f, -0.09740455f, -0.05844267f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ -0.89f, -0.97f, -0.13f,   -0.9072649f, -0.08247864f, 0.4123925f,   0.f, 0.f,   21, 21, 0, 255 },
+	{ -0.89f, -1.02f, -0.14f,   -0.9072649f, -0.08247864f, 0.4123925f,   0.f, 0.f,   21, 21, 0, 255 },
+	{ -0.87f, -1.09f, -0.11f,   -0.9072649f, -0.08247864f, 0.4123925f,   0.f, 0.f,   21, 21, 0, 255 },
+	{ -0.83f, -1.f, -0.13f,   0.08908719f, 0.1781741f, 0.9799579f,   0.f, 0.f,   45, 45, 0, 255 },
+	{ -0.89f, -0.97f, -0.13f,   0.08908719f, 0.1781741f, 0.9799579f,   0.f, 0.f,   45, 45, 0, 255 },
+	{ -0.87f, -1.09f, -0.11f,   0.08908719f, 0.1781741f, 0.9799579f,   0.f, 0.f,   45, 45, 0, 255 },
+	{ -0.85f, -0.98f, -0.2f,   0.1605861f, 0.2141151f, -0.963518f,   0.f, 0.f,   55, 55, 0, 255 },
+	{ -0.81f, -1.01f, -0.2f,   0.1605861f, 0.2141151f, -0.963518f,   0.f, 0.f,   55, 55, 0, 255 },
+	{ -0.87f, -1.1f, -0.23f,   0.1605861f, 0.2141151f, -0.963518f,   0.f, 0.f,   55, 55, 0, 255 },
+	{ -0.89f, -0.99f, -0.19f,   -0.2803976f, 0.1784343f, -0.9431534f,   0.f, 0.f,   46, 46, 0, 255 },
+	{ -0.85f, -0.98f, -0.2f,   -0.2803976f, 0.1784343f, -0.9431534f,   0.f, 0.f,   46, 46, 0, 255 },
+	{ -0.88f, -1.08f, -0.2099999f,   -0.2803976f, 0.1784343f, -0.9431534f,   0.f, 0.f,   46, 46, 0, 255 },
+	{ -0.88f, -1.08f, -0.2099999f,   -0.9667597f, -0.2452968f, 0.07214623f,   0.f, 0.f,   63, 63, 0, 255 },
+	{ -0.87f, -1.09f, -0.11f,   -0.9667597f, -0.2452968f, 0.07214623f,   0.f, 0.f,   63, 63, 0, 255 },
+	{ -0.89f, -1.02f, -0.14f,   -0.9667597f, -0.2452968f, 0.07214623f,   0.f, 0.f,   63, 63, 0, 255 },
+	{ -0.85f, -0.98f, -0.2f,   -0.7177078f, 0.279108f, -0.637961f,   0.f, 0.f,   71, 71, 0, 255 },
+	{ -0.87f, -1.1f, -0.23f,   -0.7177078f, 0.279108f, -0.637961f,   0.f, 0.f,   71, 71, 0, 255 },
+	{ -0.88f, -1.08f, -0.2099999f,   -0.7177078f, 0.279108f, -0.637961f,   0.f, 0.f,   71, 71, 0, 255 },
+	{ -0.81f, -1.01f, -0.2f,   0.571454f, 0.7619398f, -0.3047756f,   0.f, 0.f,   194, 194, 0, 255 },
+	{ -0.85f, -0.98f, -0.2f,   0.571454f, 0.7619398f, -0.3047756f,   0.f, 0.f,   194, 194, 0, 255 },
+	{ -0.81f, -0.99f, -0.15f,   0.571454f, 0.7619398f, -0.3047756f,   0.f, 0.f,   194, 194, 0, 255 },
+	{ -0.89f, -0.97f, -0.13f,   -0.5315642f, -0.1661141f, 0.8305693f,   0.f, 0.f,   42, 42, 0, 255 },
+	{ -0.94f, -0.96f, -0.16f,   -0.5315642f, -0.1661141f, 0.8305693f,   0.f, 0.f,   42, 42, 0, 255 },
+	{ -0.89f, -1.02f, -0.14f,   -0.5315642f, -0.1661141f, 0.8305693f,   0.f, 0.f,   42, 42, 0, 255 },
+	{ -0.94f, -0.96f, -0.16f,   -0.6355522f, -0.6620343f, -0.3972202f,   0.f, 0.f,   169, 169, 0, 255 },
+	{ -0.89f, -0.99f, -0.19f,   -0.6355522f, -0.6620343f, -0.3972202f,   0.f, 0.f,   169, 169, 0, 255 },
+	{ -0.89f, -1.02f, -0.14f,   -0.6355522f, -0.6620343f, -0.3972202f,   0.f, 0.f,   169, 169, 0, 255 },
+	{ -0.74f, -1.09f, -0.16f,   0.7696319f, 0.4440183f, -0.4588186f,   0.f, 0.f,   113, 113, 0, 255 },
+	{ -0.77f, -1.1f, -0.22f,   0.7696319f, 0.4440183f, -0.4588186f,   0.f, 0.f,   113, 113, 0, 255 },
+	{ -0.81f, -1.01f, -0.2f,   0.7696319f, 0.4440183f, -0.4588186f,   0.f, 0.f,   113, 113, 0, 255 },
+	{ -0.77f, -1.1f, -0.22f,   0.09617548f, 0.2564681f, -0.9617559f,   0.f, 0.f,   65, 65, 0, 255 },
+	{ -0.87f, -1.1f, -0.23f,   0.09617548f, 0.2564681f, -0.9617559f,   0.f, 0.f,   65, 65, 0, 255 },
+	{ -0.81f, -1.01f, -0.2f,   0.09617548f, 0.2564681f, -0.9617559f,   0.f, 0.f,   65, 65, 0, 255 },
+	{ -0.87f, -1.09f, -0.11f,   -0.08872142f, 0.2534897f, 0.9632609f,   0.f, 0.f,   65, 65, 0, 255 },
+	{ -0.79f, -1.1f, -0.09999996f,   -0.08872142f, 0.2534897f, 0.9632609f,   0.f, 0.f,   65, 65, 0, 255 },
+	{ -0.83f, -1.f, -0.13f,   -0.08872142f, 0.2534897f, 0.9632609f,   0.f, 0.f,   65, 65, 0, 255 },
+	{ -0.83f, -1.f, -0.13f,   0.6501667f, 0.4448506f, 0.6159475f,   0.f, 0.f,   113, 113, 0, 255 },
+	{ -0.79f, -1.1f, -0.09999996f,   0.6501667f, 0.4448506f, 0.6159475f,   0.f, 0.f,   113, 113, 0, 255 },
+	{ -0.74f, -1.09f, -0.16f,   0.6501667f, 0.4448506f, 0.6159475f,   0.f, 0.f,   113, 113, 0, 255 },
+	{ -0.74f, -1.09f, -0.16f,   0.5793245f, 0.3310427f, 0.7448448f,   0.f, 0.f,   84, 84, 0, 255 },
+	{ -0.81f, -0.99f, -0.15f,   0.5793245f, 0.3310427f, 0.7448448f,   0.f, 0.f,   84, 84, 0, 255 },
+	{ -0.83f, -1.f, -0.13f,   0.5793245f, 0.3310427f, 0.7448448f,   0.f, 0.f,   84, 84, 0, 255 },
+	{ 0.28f, -0.73f, -0.11f,   -0.9610744f, -0.2621114f, 0.08737038f,   0.f, 0.f,   67, 67, 0, 255 },
+	{ 0.26f, -0.65f, -0.09000002f,   -0.9610744f, -0.2621114f, 0.08737038f,   0.f, 0.f,   67, 67, 0, 255 },
+	{ 0.26f, -0.66f, -0.12f,   -0.9610744f, -0.2621114f, 0.08737038f,   0.f, 0.f,   67, 67, 0, 255 },
+	{ 0.28f, -0.66f, -0.16f,   -0.2687315f, -0.5598574f, -0.7838004f,   0.f, 0.f,   143, 143, 0, 255 },
+	{ 0.33f, -0.67f, -0.17f,   -0.2687315f, -0.5598574f, -0.7838004f,   0.f, 0.f,   143, 143, 0, 255 },
+	{ 0.28f, -0.73f, -0.11f,   -0.2687315f, -0.5598574f, -0.7838004f,   0.f, 0.f,   143, 143, 0, 255 },
+	{ 0.27f, -0.59f, -0.15f,   -0.2646163f, 0.09923112f, -0.9592348f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ 0.31f, -0.58f, -0.16f,   -0.2646163f, 0.09923112f, -0.9592348f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ 0.28f, -0.66f, -0.16f,   -0.2646163f, 0.09923112f, -0.9592348f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ 0.28f, -0.66f, -0.16f,   -0.8520127f, -0.3042904f, -0.4260066f,   0.f, 0.f,   78, 78, 0, 255 },
+	{ 0.28f, -0.73f, -0.11f,   -0.8520127f, -0.3042904f, -0.4260066f,   0.f, 0.f,   78, 78, 0, 255 },
+	{ 0.26f, -0.66f, -0.12f,   -0.8520127f, -0.3042904f, -0.4260066f,   0.f, 0.f,   78, 78, 0, 255 },
+	{ 0.27f, -0.59f, -0.15f,   -0.9914308f, 0.1239291f, -0.04130966f,   0.f, 0.f,   32, 32, 0, 255 },
+	{ 0.26f, -0.66f, -0.12f,   -0.9914308f, 0.1239291f, -0.04130966f,   0.f, 0.f,   32, 32, 0, 255 },
+	{ 0.27f, -0.58f, -0.12f,   -0.9914308f, 0.1239291f, -0.04130966f,   0.f, 0.f,   32, 32, 0, 255 },
+	{ 0.26f, -0.65f, -0.09000002f,   -0.9914308f, 0.1239291f, -0.04130967f,   0.f, 0.f,   32, 32, 0, 255 },
+	{ 0.27f, -0.58f, -0.12f,   -0.9914308f, 0.1239291f, -0.04130967f,   0.f, 0.f,   32, 32, 0, 255 },
+	{ 0.26f, -0.66f, -0.12f,   -0.9914308f, 0.1239291f, -0.04130967f,   0.f, 0.f,   32, 32, 0, 255 },
+	{ 0.26f, -0.42f, -0.11f,   -0.4925166f, -0.08491673f, 0.8661504f,   0.f, 0.f,   22, 22, 0, 255 },
+	{ 0.27f, -0.58f, -0.12f,   -0.4925166f, -0.08491673f, 0.8661504f,   0.f, 0.f,   22, 22, 0, 255 },
+	{ 0.3f, -0.55f, -0.1f,   -0.4925166f, -0.08491673f, 0.8661504f,   0.f, 0.f,   22, 22, 0, 255 },
+	{ 0.3f, -0.55f, -0.1f,   -0.7369677f, 0.3524629f, 0.5767569f,   0.f, 0.f,   90, 90, 0, 255 },
+	{ 0.27f, -0.58f, -0.12f,   -0.7369677f, 0.3524629f, 0.5767569f,   0.f, 0.f,   90, 90, 0, 255 },
+	{ 0.26f, -0.65f, -0.09000002f,   -0.7369677f, 0.3524629f, 0.5767569f,   0.f, 0.f,   90, 90, 0, 255 },
+	{ 0.3f, -0.55f, -0.1f,   -0.f, 0.09053572f, 0.9958932f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ 0.32f, -0.55f, -0.1f,   -0.f, 0.09053572f, 0.9958932f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ 0.34f, -0.44f, -0.11f,   -0.f, 0.09053572f, 0.9958932f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ 0.33f, -0.55f, -0.1f,   -0.f, 0.09053572f, 0.9958932f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ 0.34f, -0.44f, -0.11f,   0.02075687f, 0.08302758f, 0.9963311f,   0.f, 0.f,   21, 21, 0, 255 },
+	{ 0.26f, -0.42f, -0.11f,   0.02075687f, 0.08302758f, 0.9963311f,   0.f, 0.f,   21, 21, 0, 255 },
+	{ 0.3f, -0.55f, -0.1f,   0.02075687f, 0.08302758f, 0.9963311f,   0.f, 0.f,   21, 21, 0, 255 },
+	{ 0.36f, -0.46f, -0.14f,   0.8378388f, 0.01948455f, 0.5455698f,   0.f, 0.f,   5, 5, 0, 255 },
+	{ 0.34f, -0.44f, -0.11f,   0.8378388f, 0.01948455f, 0.5455698f,   0.f, 0.f,   5, 5, 0, 255 },
+	{ 0.35f, -0.59f, -0.12f,   0.8378388f, 0.01948455f, 0.5455698f,   0.f, 0.f,   5, 5, 0, 255 },
+	{ 0.33f, -0.85f, -0.14f,   -0.5763088f, -0.03601926f, -0.8164379f,   0.f, 0.f,   9, 9, 0, 255 },
+	{ 0.29f, -0.89f, -0.11f,   -0.5763088f, -0.03601926f, -0.8164379f,   0.f, 0.f,   9, 9, 0, 255 },
+	{ 0.28f, -0.73f, -0.11f,   -0.5763088f, -0.03601926f, -0.8164379f,   0.f, 0.f,   9, 9, 0, 255 },
+	{ 0.33f, -0.41f, -0.18f,   0.7908686f, -0.01492215f, -0.611804f,   0.f, 0.f,   4, 4, 0, 255 },
+	{ 0.36f, -0.46f, -0.14f,   0.7908686f, -0.01492215f, -0.611804f,   0.f, 0.f,   4, 4, 0, 255 },
+	{ 0.35f, -0.58f, -0.15f,   0.7908686f, -0.01492215f, -0.611804f,   0.f, 0.f,   4, 4, 0, 255 },
+	{ 0.35f, -0.58f, -0.15f,   0.2401042f, -0.1412379f, -0.9604175f,   0.f, 0.f,   36, 36, 0, 255 },
+	{ 0.31f, -0.58f, -0.16f,   0.2401042f, -0.1412379f, -0.9604175f,   0.f, 0.f,   36, 36, 0, 255 },
+	{ 0.33f, -0.41f, -0.18f,   0.2401042f, -0.1412379f, -0.9604175f,   0.f, 0.f,   36, 36, 0, 255 },
+	{ 0.31f, -0.58f, -0.16f,   -0.2207552f, -0.08830222f, -0.9713237f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ 0.27f, -0.59f, -0.15f,   -0.2207552f, -0.08830222f, -0.9713237f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ 0.33f, -0.41f, -0.18f,   -0.2207552f, -0.08830222f, -0.9713237f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ 0.28f, -0.73f, -0.11f,   -0.3619609f, -0.3102526f, 0.8790492f,   0.f, 0.f,   79, 79, 0, 255 },
+	{ 0.3f, -0.64f, -0.07000002f,   -0.3619609f, -0.3102526f, 0.8790492f,   0.f, 0.f,   79, 79, 0, 255 },
+	{ 0.26f, -0.65f, -0.09000002f,   -0.3619609f, -0.3102526f, 0.8790492f,   0.f, 0.f,   79, 79, 0, 255 },
+	{ 0.35f, -0.8100001f, -0.1f,   0.9698054f, -0.119565f, -0.2125598f,   0.f, 0.f,   30, 30, 0, 255 },
+	{ 0.36f, -0.64f, -0.15f,   0.9698054f, -0.119565f, -0.2125598f,   0.f, 0.f,   30, 30, 0, 255 },
+	{ 0.37f, -0.63f, -0.11f,   0.9698054f, -0.119565f, -0.2125598f,   0.f, 0.f,   30, 30, 0, 255 },
+	{ 0.3f, -0.64f, -0.07000002f,   0.360831f, 0.03006934f, 0.9321463f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ 0.33f, -0.6900001f, -0.08000001f,   0.360831f, 0.03006934f, 0.9321463f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ 0.35f, -0.62f, -0.09000002f,   0.360831f, 0.03006934f, 0.9321463f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ 0.35f, -0.62f, -0.09000002f,   0.6811147f, -0.09081495f, 0.7265227f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ 0.33f, -0.6900001f, -0.08000001f,   0.6811147f, -0.09081495f, 0.7265227f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ 0.37f, -0.63f, -0.11f,   0.6811147f, -0.09081495f, 0.7265227f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ 0.33f, -0.6900001f, -0.08000001f,   -0.267895f, -0.3409564f, 0.9010999f,   0.f, 0.f,   87, 87, 0, 255 },
+	{ 0.3f, -0.64f, -0.07000002f,   -0.267895f, -0.3409564f, 0.9010999f,   0.f, 0.f,   87, 87, 0, 255 },
+	{ 0.28f, -0.73f, -0.11f,   -0.267895f, -0.3409564f, 0.9010999f,   0.f, 0.f,   87, 87, 0, 255 },
+	{ 0.29f, -0.89f, -0.11f,   -0.5854708f, 0.3193479f, 0.7451449f,   0.f, 0.f,   81, 81, 0, 255 },
+	{ 0.29f, -0.96f, -0.08000001f,   -0.5854708f, 0.3193479f, 0.7451449f,   0.f, 0.f,   81, 81, 0, 255 },
+	{ 0.33f, -0.91f, -0.07000002f,   -0.5854708f, 0.3193479f, 0.7451449f,   0.f, 0.f,   81, 81, 0, 255 },
+	{ 0.33f, -0.85f, -0.14f,   0.8834668f, 0.1963257f, -0.4253736f,   0.f, 0.f,   50, 50, 0, 255 },
+	{ 0.36f, -0.92f, -0.11f,   0.8834668f, 0.1963257f, -0.4253736f,   0.f, 0.f,   50, 50, 0, 255 },
+	{ 0.35f, -0.9400001f, -0.14f,   0.8834668f, 0.1963257f, -0.4253736f,   0.f, 0.f,   50, 50, 0, 255 },
+	{ 0.29f, -0.96f, -0.08000001f,   -0.1234284f, -0.09874288f, 0.9874287f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ 0.33f, -1.01f, -0.08000001f,   -0.1234284f, -0.09874288f, 0.9874287f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ 0.33f, -0.91f, -0.07000002f,   -0.1234284f, -0.09874288f, 0.9874287f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ 0.35f, -0.9400001f, -0.14f,   -0.f, 0.f, -1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.31f, -0.95f, -0.14f,   -0.f, 0.f, -1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.33f, -0.85f, -0.14f,   -0.f, 0.f, -1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.28f, -0.96f, -0.12f,   -0.5773503f, 0.1154701f, -0.8082904f,   0.f, 0.f,   29, 29, 0, 255 },
+	{ 0.33f, -0.85f, -0.14f,   -0.5773503f, 0.1154701f, -0.8082904f,   0.f, 0.f,   29, 29, 0, 255 },
+	{ 0.31f, -0.95f, -0.14f,   -0.5773503f, 0.1154701f, -0.8082904f,   0.f, 0.f,   29, 29, 0, 255 },
+	{ 0.4f, -0.99f, -0.09000002f,   0.7334546f, 0.5378667f, 0.4156244f,   0.f, 0.f,   137, 137, 0, 255 },
+	{ 0.36f, -0.92f, -0.11f,   0.7334546f, 0.5378667f, 0.4156244f,   0.f, 0.f,   137, 137, 0, 255 },
+	{ 0.33f, -0.91f, -0.07000002f,   0.7334546f, 0.5378667f, 0.4156244f,   0.f, 0.f,   137, 137, 0, 255 },
+	{ 0.33f, -0.91f, -0.07000002f,   0.8020936f, 0.0186535f, 0.5969069f,   0.f, 0.f,   5, 5, 0, 255 },
+	{ 0.36f, -0.92f, -0.11f,   0.8020936f, 0.0186535f, 0.5969069f,   0.f, 0.f,   5, 5, 0, 255 },
+	{ 0.35f, -0.8100001f, -0.1f,   0.8020936f, 0.0186535f, 0.5969069f,   0.f, 0.f,   5, 5, 0, 255 },
+	{ 0.27f, -0.59f, -0.15f,   -0.8926073f, -0.06375758f, -0.4463039f,   0.f, 0.f,   16, 16, 0, 255 },
+	{ 0.28f, -0.66f, -0.16f,   -0.8926073f, -0.06375758f, -0.4463039f,   0.f, 0.f,   16, 16, 0, 255 },
+	{ 0.26f, -0.66f, -0.12f,   -0.8926073f, -0.06375758f, -0.4463039f,   0.f, 0.f,   16, 16, 0, 255 },
+	{ 0.36f, -0.64f, -0.15f,   0.4944511f, 0.08240876f, -0.86529f,   0.f, 0.f,   21, 21, 0, 255 },
+	{ 0.33f, -0.67f, -0.17f,   0.4944511f, 0.08240876f, -0.86529f,   0.f, 0.f,   21, 21, 0, 255 },
+	{ 0.35f, -0.58f, -0.15f,   0.4944511f, 0.08240876f, -0.86529f,   0.f, 0.f,   21, 21, 0, 255 },
+	{ 0.31f, -0.58f, -0.16f,   -0.1824792f, 0.06842972f, -0.9808255f,   0.f, 0.f,   17, 17, 0, 255 },
+	{ 0.33f, -0.67f, -0.17f,   -0.1824792f, 0.06842972f, -0.9808255f,   0.f, 0.f,   17, 17, 0, 255 },
+	{ 0.28f, -0.66f, -0.16f,   -0.1824792f, 0.06842972f, -0.9808255f,   0.f, 0.f,   17, 17, 0, 255 },
+	{ 0.35f, -0.58f, -0.15f,   0.2394259f, 0.1596175f, -0.9577042f,   0.f, 0.f,   41, 41, 0, 255 },
+	{ 0.33f, -0.67f, -0.17f,   0.2394259f, 0.1596175f, -0.9577042f,   0.f, 0.f,   41, 41, 0, 255 },
+	{ 0.31f, -0.58f, -0.16f,   0.2394259f, 0.1596175f, -0.9577042f,   0.f, 0.f,   41, 41, 0, 255 },
+	{ 0.4f, -1.f, -0.14f,   0.f, 0.f, -1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.34f, -0.99f, -0.14f,   0.f, 0.f, -1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.35f, -0.9400001f, -0.14f,   0.f, 0.f, -1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.36f, -0.92f, -0.11f,   0.875755f, 0.473381f, -0.09467612f,   0.f, 0.f,   121, 121, 0, 255 },
+	{ 0.4f, -0.99f, -0.09000002f,   0.875755f, 0.473381f, -0.09467612f,   0.f, 0.f,   121, 121, 0, 255 },
+	{ 0.4f, -1.f, -0.14f,   0.875755f, 0.473381f, -0.09467612f,   0.f, 0.f,   121, 121, 0, 255 },
+	{ 0.39f, -1.f, -0.07000002f,   0.6837633f, 0.4558421f, 0.5698031f,   0.f, 0.f,   116, 116, 0, 255 },
+	{ 0.4f, -0.99f, -0.09000002f,   0.6837633f, 0.4558421f, 0.5698031f,   0.f, 0.f,   116, 116, 0, 255 },
+	{ 0.33f, -0.91f, -0.07000002f,   0.6837633f, 0.4558421f, 0.5698031f,   0.f, 0.f,   116, 116, 0, 255 },
+	{ 0.31f, -0.95f, -0.14f,   0.f, 0.f, -1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.36f, -0.92f, -0.11f,   0.6344159f, 0.5286806f, -0.5639268f,   0.f, 0.f,   135, 135, 0, 255 },
+	{ 0.4f, -1.f, -0.14f,   0.6344159f, 0.5286806f, -0.5639268f,   0.f, 0.f,   135, 135, 0, 255 },
+	{ 0.35f, -0.9400001f, -0.14f,   0.6344159f, 0.5286806f, -0.5639268f,   0.f, 0.f,   135, 135, 0, 255 },
+	{ 0.29f, -0.89f, -0.11f,   -0.9649438f, 0.1033868f, 0.2412357f,   0.f, 0.f,   26, 26, 0, 255 },
+	{ 0.28f, -0.96f, -0.12f,   -0.9649438f, 0.1033868f, 0.2412357f,   0.f, 0.f,   26, 26, 0, 255 },
+	{ 0.29f, -0.96f, -0.08000001f,   -0.9649438f, 0.1033868f, 0.2412357f,   0.f, 0.f,   26, 26, 0, 255 },
+	{ 0.33f, -0.91f, -0.07000002f,   -0.1476204f, -0.09841358f, 0.9841356f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ 0.33f, -1.01f, -0.08000001f,   -0.1476204f, -0.09841358f, 0.9841356f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ 0.39f, -1.f, -0.07000002f,   -0.1476204f, -0.09841358f, 0.9841356f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ 0.35f, -0.62f, -0.09000002f,   0.9045342f, 0.3015111f, 0.3015109f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ 0.35f, -0.59f, -0.12f,   0.9045342f, 0.3015111f, 0.3015109f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ 0.33f, -0.55f, -0.1f,   0.9045342f, 0.3015111f, 0.3015109f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ 0.35f, -0.59f, -0.12f,   0.7071069f, 0.f, 0.7071065f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.34f, -0.44f, -0.11f,   0.7071069f, 0.f, 0.7071065f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.33f, -0.55f, -0.1f,   0.7071069f, 0.f, 0.7071065f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.35f, -0.62f, -0.09000002f,   0.7276065f, 0.4850717f, 0.4850713f,   0.f, 0.f,   124, 124, 0, 255 },
+	{ 0.37f, -0.63f, -0.11f,   0.7276065f, 0.4850717f, 0.4850713f,   0.f, 0.f,   124, 124, 0, 255 },
+	{ 0.35f, -0.59f, -0.12f,   0.7276065f, 0.4850717f, 0.4850713f,   0.f, 0.f,   124, 124, 0, 255 },
+	{ 0.36f, -0.46f, -0.14f,   0.9963676f, -0.08078672f, -0.02692886f,   0.f, 0.f,   21, 21, 0, 255 },
+	{ 0.35f, -0.59f, -0.12f,   0.9963676f, -0.08078672f, -0.02692886f,   0.f, 0.f,   21, 21, 0, 255 },
+	{ 0.35f, -0.58f, -0.15f,   0.9963676f, -0.08078672f, -0.02692886f,   0.f, 0.f,   21, 21, 0, 255 },
+	{ 0.35f, -0.58f, -0.15f,   0.8669211f, 0.4728668f, 0.1576221f,   0.f, 0.f,   121, 121, 0, 255 },
+	{ 0.35f, -0.59f, -0.12f,   0.8669211f, 0.4728668f, 0.1576221f,   0.f, 0.f,   121, 121, 0, 255 },
+	{ 0.37f, -0.63f, -0.11f,   0.8669211f, 0.4728668f, 0.1576221f,   0.f, 0.f,   121, 121, 0, 255 },
+	{ 0.35f, -0.58f, -0.15f,   0.947943f, 0.157991f, -0.2764832f,   0.f, 0.f,   40, 40, 0, 255 },
+	{ 0.37f, -0.63f, -0.11f,   0.947943f, 0.157991f, -0.2764832f,   0.f, 0.f,   40, 40, 0, 255 },
+	{ 0.36f, -0.64f, -0.15f,   0.947943f, 0.157991f, -0.2764832f,   0.f, 0.f,   40, 40, 0, 255 },
+	{ 0.33f, -0.55f, -0.1f,   0.2871835f, 0.2153874f, 0.9333455f,   0.f, 0.f,   55, 55, 0, 255 },
+	{ 0.3f, -0.64f, -0.07000002f,   0.2871835f, 0.2153874f, 0.9333455f,   0.f, 0.f,   55, 55, 0, 255 },
+	{ 0.35f, -0.62f, -0.09000002f,   0.2871835f, 0.2153874f, 0.9333455f,   0.f, 0.f,   55, 55, 0, 255 },
+	{ 0.33f, -0.55f, -0.1f,   0.f, 0.3162279f, 0.9486833f,   0.f, 0.f,   81, 81, 0, 255 },
+	{ 0.3f, -0.55f, -0.1f,   0.f, 0.3162279f, 0.9486833f,   0.f, 0.f,   81, 81, 0, 255 },
+	{ 0.3f, -0.64f, -0.07000002f,   0.f, 0.3162279f, 0.9486833f,   0.f, 0.f,   81, 81, 0, 255 },
+	{ 0.3f, -0.64f, -0.07000002f,   -0.4842002f, 0.2766858f, 0.8300572f,   0.f, 0.f,   71, 71, 0, 255 },
+	{ 0.3f, -0.55f, -0.1f,   -0.4842002f, 0.2766858f, 0.8300572f,   0.f, 0.f,   71, 71, 0, 255 },
+	{ 0.26f, -0.65f, -0.09000002f,   -0.4842002f, 0.2766858f, 0.8300572f,   0.f, 0.f,   71, 71, 0, 255 },
+	{ -0.87f, -0.5700001f, -0.2f,   0.9941349f, -0.07647184f, -0.07647177f,   0.f, 0.f,   20, 20, 0, 255 },
+	{ -0.87f, -0.62f, -0.15f,   0.9941349f, -0.07647184f, -0.07647177f,   0.f, 0.f,   20, 20, 0, 255 },
+	{ -0.88f, -0.72f, -0.18f,   0.9941349f, -0.07647184f, -0.07647177f,   0.f, 0.f,   20, 20, 0, 255 },
+	{ -0.88f, -0.5700001f, -0.13f,   -0.1054745f, -0.1406325f, 0.9844275f,   0.f, 0.f,   36, 36, 0, 255 },
+	{ -0.92f, -0.54f, -0.13f,   -0.1054745f, -0.1406325f, 0.9844275f,   0.f, 0.f,   36, 36, 0, 255 },
+	{ -0.92f, -0.6800001f, -0.15f,   -0.1054745f, -0.1406325f, 0.9844275f,   0.f, 0.f,   36, 36, 0, 255 },
+	{ -0.92f, -0.6800001f, -0.15f,   -0.6592761f, -0.1063349f, 0.7443439f,   0.f, 0.f,   27, 27, 0, 255 },
+	{ -0.92f, -0.54f, -0.13f,   -0.6592761f, -0.1063349f, 0.7443439f,   0.f, 0.f,   27, 27, 0, 255 },
+	{ -0.97f, -0.58f, -0.18f,   -0.6592761f, -0.1063349f, 0.7443439f,   0.f, 0.f,   27, 27, 0, 255 },
+	{ -0.96f, -0.52f, -0.15f,   -0.9486828f, 0.f, 0.3162292f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.97f, -0.5100001f, -0.18f,   -0.9486828f, 0.f, 0.3162292f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.97f, -0.58f, -0.18f,   -0.9486828f, 0.f, 0.3162292f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.87f, -0.62f, -0.15f,   0.3456913f, -0.2880759f, 0.893034f,   0.f, 0.f,   73, 73, 0, 255 },
+	{ -0.88f, -0.5700001f, -0.13f,   0.3456913f, -0.2880759f, 0.893034f,   0.f, 0.f,   73, 73, 0, 255 },
+	{ -0.92f, -0.6800001f, -0.15f,   0.3456913f, -0.2880759f, 0.893034f,   0.f, 0.f,   73, 73, 0, 255 },
+	{ -0.9f, -0.54f, -0.2099999f,   0.2365727f, -0.08602648f, -0.9677979f,   0.f, 0.f,   22, 22, 0, 255 },
+	{ -0.87f, -0.5700001f, -0.2f,   0.2365727f, -0.08602648f, -0.9677979f,   0.f, 0.f,   22, 22, 0, 255 },
+	{ -0.92f, -0.8200001f, -0.19f,   0.2365727f, -0.08602648f, -0.9677979f,   0.f, 0.f,   22, 22, 0, 255 },
+	{ -0.93f, -0.89f, -0.17f,   -0.01978938f, 0.02968407f, 0.9993634f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ -0.97f, -0.58f, -0.18f,   -0.01978938f, 0.02968407f, 0.9993634f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ -0.96f, -0.91f, -0.17f,   -0.01978938f, 0.02968407f, 0.9993634f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ -0.92f, -0.8200001f, -0.19f,   0.01843609f, 0.09218259f, -0.9955714f,   0.f, 0.f,   24, 24, 0, 255 },
+	{ -0.88f, -0.72f, -0.18f,   0.01843609f, 0.09218259f, -0.9955714f,   0.f, 0.f,   24, 24, 0, 255 },
+	{ -0.91f, -0.93f, -0.2f,   0.01843609f, 0.09218259f, -0.9955714f,   0.f, 0.f,   24, 24, 0, 255 },
+	{ -0.88f, -0.72f, -0.18f,   0.2125333f, 0.06250972f, -0.9751524f,   0.f, 0.f,   16, 16, 0, 255 },
+	{ -0.87f, -0.91f, -0.19f,   0.2125333f, 0.06250972f, -0.9751524f,   0.f, 0.f,   16, 16, 0, 255 },
+	{ -0.91f, -0.93f, -0.2f,   0.2125333f, 0.06250972f, -0.9751524f,   0.f, 0.f,   16, 16, 0, 255 },
+	{ -0.87f, -0.5700001f, -0.2f,   0.5673268f, -0.1458841f, -0.8104678f,   0.f, 0.f,   37, 37, 0, 255 },
+	{ -0.88f, -0.72f, -0.18f,   0.5673268f, -0.1458841f, -0.8104678f,   0.f, 0.f,   37, 37, 0, 255 },
+	{ -0.92f, -0.8200001f, -0.19f,   0.5673268f, -0.1458841f, -0.8104678f,   0.f, 0.f,   37, 37, 0, 255 },
+	{ -0.92f, -0.8200001f, -0.19f,   -0.2425229f, -0.01010511f, -0.9700931f,   0.f, 0.f,   3, 3, 0, 255 },
+	{ -0.97f, -0.58f, -0.18f,   -0.2425229f, -0.01010511f, -0.9700931f,   0.f, 0.f,   3, 3, 0, 255 },
+	{ -0.93f, -0.58f, -0.19f,   -0.2425229f, -0.01010511f, -0.9700931f,   0.f, 0.f,   3, 3, 0, 255 },
+	{ -0.97f, -0.58f, -0.18f,   -0.3744979f, -0.0394209f, -0.9263894f,   0.f, 0.f,   10, 10, 0, 255 },
+	{ -0.92f, -0.8200001f, -0.19f,   -0.3744979f, -0.0394209f, -0.9263894f,   0.f, 0.f,   10, 10, 0, 255 },
+	{ -0.96f, -0.91f, -0.17f,   -0.3744979f, -0.0394209f, -0.9263894f,   0.f, 0.f,   10, 10, 0, 255 },
+	{ -0.67f, -0.44f, -0.14f,   0.4705885f, -0.7058822f, -0.5294117f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ -0.82f, -0.5100001f, -0.18f,   0.4705885f, -0.7058822f, -0.5294117f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ -0.67f, -0.38f, -0.22f,   0.4705885f, -0.7058822f, -0.5294117f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ -0.82f, -0.5100001f, -0.18f,   0.2902648f, -0.5711664f, -0.767799f,   0.f, 0.f,   146, 146, 0, 255 },
+	{ -0.86f, -0.49f, -0.2099999f,   0.2902648f, -0.5711664f, -0.767799f,   0.f, 0.f,   146, 146, 0, 255 },
+	{ -0.67f, -0.38f, -0.22f,   0.2902648f, -0.5711664f, -0.767799f,   0.f, 0.f,   146, 146, 0, 255 },
+	{ -0.86f, -0.49f, -0.2099999f,   -0.116819f, -0.01947002f, -0.9929624f,   0.f, 0.f,   5, 5, 0, 255 },
+	{ -0.8f, -0.34f, -0.22f,   -0.116819f, -0.01947002f, -0.9929624f,   0.f, 0.f,   5, 5, 0, 255 },
+	{ -0.64f, -0.28f, -0.24f,   -0.116819f, -0.01947002f, -0.9929624f,   0.f, 0.f,   5, 5, 0, 255 },
+	{ -0.67f, -0.38f, -0.22f,   0.07439502f, -0.2169857f, -0.9733358f,   0.f, 0.f,   55, 55, 0, 255 },
+	{ -0.86f, -0.49f, -0.2099999f,   0.07439502f, -0.2169857f, -0.9733358f,   0.f, 0.f,   55, 55, 0, 255 },
+	{ -0.64f, -0.28f, -0.24f,   0.07439502f, -0.2169857f, -0.9733358f,   0.f, 0.f,   55, 55, 0, 255 },
+	{ -0.67f, -0.44f, -0.14f,   0.5734622f, -0.6553856f, -0.4915393f,   0.f, 0.f,   167, 167, 0, 255 },
+	{ -0.67f, -0.38f, -0.22f,   0.5734622f, -0.6553856f, -0.4915393f,   0.f, 0.f,   167, 167, 0, 255 },
+	{ -0.53f, -0.31f, -0.15f,   0.5734622f, -0.6553856f, -0.4915393f,   0.f, 0.f,   167, 167, 0, 255 },
+	{ -0.84f, -0.4f, -0.13f,   -0.6417562f, 0.553238f, 0.5311089f,   0.f, 0.f,   141, 141, 0, 255 },
+	{ -0.89f, -0.41f, -0.18f,   -0.6417562f, 0.553238f, 0.5311089f,   0.f, 0.f,   141, 141, 0, 255 },
+	{ -0.96f, -0.52f, -0.15f,   -0.6417562f, 0.553238f, 0.5311089f,   0.f, 0.f,   141, 141, 0, 255 },
+	{ -0.97f, -0.5100001f, -0.18f,   -0.7071064f, 0.5656853f, 0.4242649f,   0.f, 0.f,   144, 144, 0, 255 },
+	{ -0.96f, -0.52f, -0.15f,   -0.7071064f, 0.5656853f, 0.4242649f,   0.f, 0.f,   144, 144, 0, 255 },
+	{ -0.89f, -0.41f, -0.18f,   -0.7071064f, 0.5656853f, 0.4242649f,   0.f, 0.f,   144, 144, 0, 255 },
+	{ -0.84f, -0.4f, -0.13f,   -0.7071066f, -2.871561e-07f, 0.7071069f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.87f, -0.3200001f, -0.16f,   -0.7071066f, -2.871561e-07f, 0.7071069f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.89f, -0.41f, -0.18f,   -0.7071066f, -2.871561e-07f, 0.7071069f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.87f, -0.3200001f, -0.16f,   -0.9389098f, 0.2590094f, -0.2266327f,   0.f, 0.f,   66, 66, 0, 255 },
+	{ -0.86f, -0.31f, -0.19f,   -0.9389098f, 0.2590094f, -0.2266327f,   0.f, 0.f,   66, 66, 0, 255 },
+	{ -0.89f, -0.41f, -0.18f,   -0.9389098f, 0.2590094f, -0.2266327f,   0.f, 0.f,   66, 66, 0, 255 },
+	{ -0.89f, -0.41f, -0.18f,   -0.4903416f, 0.1387759f, -0.8604105f,   0.f, 0.f,   35, 35, 0, 255 },
+	{ -0.8f, -0.34f, -0.22f,   -0.4903416f, 0.1387759f, -0.8604105f,   0.f, 0.f,   35, 35, 0, 255 },
+	{ -0.86f, -0.49f, -0.2099999f,   -0.4903416f, 0.1387759f, -0.8604105f,   0.f, 0.f,   35, 35, 0, 255 },
+	{ -0.86f, -0.49f, -0.2099999f,   -0.1306271f, 0.3047962f, -0.9434172f,   0.f, 0.f,   78, 78, 0, 255 },
+	{ -0.93f, -0.52f, -0.2099999f,   -0.1306271f, 0.3047962f, -0.9434172f,   0.f, 0.f,   78, 78, 0, 255 },
+	{ -0.89f, -0.41f, -0.18f,   -0.1306271f, 0.3047962f, -0.9434172f,   0.f, 0.f,   78, 78, 0, 255 },
+	{ -0.89f, -0.41f, -0.18f,   -0.4311242f, 0.03919309f, -0.901441f,   0.f, 0.f,   10, 10, 0, 255 },
+	{ -0.86f, -0.31f, -0.19f,   -0.4311242f, 0.03919309f, -0.901441f,   0.f, 0.f,   10, 10, 0, 255 },
+	{ -0.8f, -0.34f, -0.22f,   -0.4311242f, 0.03919309f, -0.901441f,   0.f, 0.f,   10, 10, 0, 255 },
+	{ -0.89f, -0.41f, -0.18f,   -0.4879498f, 0.3903599f, -0.7807203f,   0.f, 0.f,   100, 100, 0, 255 },
+	{ -0.93f, -0.52f, -0.2099999f,   -0.4879498f, 0.3903599f, -0.7807203f,   0.f, 0.f,   100, 100, 0, 255 },
+	{ -0.97f, -0.5100001f, -0.18f,   -0.4879498f, 0.3903599f, -0.7807203f,   0.f, 0.f,   100, 100, 0, 255 },
+	{ -0.89f, -0.97f, -0.13f,   0.3905672f, 0.130189f, 0.9113222f,   0.f, 0.f,   33, 33, 0, 255 },
+	{ -0.86f, -0.92f, -0.15f,   0.3905672f, 0.130189f, 0.9113222f,   0.f, 0.f,   33, 33, 0, 255 },
+	{ -0.89f, -0.83f, -0.15f,   0.3905672f, 0.130189f, 0.9113222f,   0.f, 0.f,   33, 33, 0, 255 },
+	{ -0.89f, -0.97f, -0.13f,   -0.09386454f, 0.1407971f, 0.9855788f,   0.f, 0.f,   36, 36, 0, 255 },
+	{ -0.89f, -0.83f, -0.15f,   -0.09386454f, 0.1407971f, 0.9855788f,   0.f, 0.f,   36, 36, 0, 255 },
+	{ -0.92f, -0.92f, -0.14f,   -0.09386454f, 0.1407971f, 0.9855788f,   0.f, 0.f,   36, 36, 0, 255 },
+	{ 0.25f, -0.33f, -0.19f,   -0.2279211f, -0.3418817f, -0.9116846f,   0.f, 0.f,   87, 87, 0, 255 },
+	{ 0.31f, -0.29f, -0.22f,   -0.2279211f, -0.3418817f, -0.9116846f,   0.f, 0.f,   87, 87, 0, 255 },
+	{ 0.33f, -0.41f, -0.18f,   -0.2279211f, -0.3418817f, -0.9116846f,   0.f, 0.f,   87, 87, 0, 255 },
+	{ -0.96f, -0.91f, -0.17f,   -0.5046161f, 0.03255589f, -0.8627298f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ -0.92f, -0.8200001f, -0.19f,   -0.5046161f, 0.03255589f, -0.8627298f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ -0.91f, -0.93f, -0.2f,   -0.5046161f, 0.03255589f, -0.8627298f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ -0.88f, -0.72f, -0.18f,   0.9718072f, 0.06310429f, -0.2271755f,   0.f, 0.f,   16, 16, 0, 255 },
+	{ -0.86f, -0.92f, -0.15f,   0.9718072f, 0.06310429f, -0.2271755f,   0.f, 0.f,   16, 16, 0, 255 },
+	{ -0.87f, -0.91f, -0.19f,   0.9718072f, 0.06310429f, -0.2271755f,   0.f, 0.f,   16, 16, 0, 255 },
+	{ -0.88f, -0.72f, -0.18f,   0.5321814f, 0.1773937f, 0.8278371f,   0.f, 0.f,   45, 45, 0, 255 },
+	{ -0.89f, -0.83f, -0.15f,   0.5321814f, 0.1773937f, 0.8278371f,   0.f, 0.f,   45, 45, 0, 255 },
+	{ -0.86f, -0.92f, -0.15f,   0.5321814f, 0.1773937f, 0.8278371f,   0.f, 0.f,   45, 45, 0, 255 },
+	{ 0.36f, -0.2600001f, -0.22f,   0.5263158f, -0.3157895f, -0.7894737f,   0.f, 0.f,   81, 81, 0, 255 },
+	{ 0.36f, -0.46f, -0.14f,   0.5263158f, -0.3157895f, -0.7894737f,   0.f, 0.f,   81, 81, 0, 255 },
+	{ 0.33f, -0.41f, -0.18f,   0.5263158f, -0.3157895f, -0.7894737f,   0.f, 0.f,   81, 81, 0, 255 },
+	{ 0.25f, -0.29f, -0.09000001f,   -0.03871269f, -0.1548516f, 0.9871789f,   0.f, 0.f,   39, 39, 0, 255 },
+	{ 0.26f, -0.42f, -0.11f,   -0.03871269f, -0.1548516f, 0.9871789f,   0.f, 0.f,   39, 39, 0, 255 },
+	{ 0.29f, -0.3f, -0.09000002f,   -0.03871269f, -0.1548516f, 0.9871789f,   0.f, 0.f,   39, 39, 0, 255 },
+	{ 0.23f, -0.35f, -0.14f,   -0.798697f, -0.08713064f, 0.5953919f,   0.f, 0.f,   22, 22, 0, 255 },
+	{ 0.27f, -0.58f, -0.12f,   -0.798697f, -0.08713064f, 0.5953919f,   0.f, 0.f,   22, 22, 0, 255 },
+	{ 0.26f, -0.42f, -0.11f,   -0.798697f, -0.08713064f, 0.5953919f,   0.f, 0.f,   22, 22, 0, 255 },
+	{ 0.33f, -0.41f, -0.18f,   -0.03086073f, -0.1543033f, -0.9875414f,   0.f, 0.f,   39, 39, 0, 255 },
+	{ 0.27f, -0.59f, -0.15f,   -0.03086073f, -0.1543033f, -0.9875414f,   0.f, 0.f,   39, 39, 0, 255 },
+	{ 0.25f, -0.33f, -0.19f,   -0.03086073f, -0.1543033f, -0.9875414f,   0.f, 0.f,   39, 39, 0, 255 },
+	{ 0.27f, -0.59f, -0.15f,   -0.9844982f, -0.1663941f, 0.05546462f,   0.f, 0.f,   42, 42, 0, 255 },
+	{ 0.27f, -0.58f, -0.12f,   -0.9844982f, -0.1663941f, 0.05546462f,   0.f, 0.f,   42, 42, 0, 255 },
+	{ 0.23f, -0.35f, -0.14f,   -0.9844982f, -0.1663941f, 0.05546462f,   0.f, 0.f,   42, 42, 0, 255 },
+	{ 0.25f, -0.33f, -0.19f,   -0.9007678f, -0.1329002f, -0.4134668f,   0.f, 0.f,   34, 34, 0, 255 },
+	{ 0.27f, -0.59f, -0.15f,   -0.9007678f, -0.1329002f, -0.4134668f,   0.f, 0.f,   34, 34, 0, 255 },
+	{ 0.23f, -0.35f, -0.14f,   -0.9007678f, -0.1329002f, -0.4134668f,   0.f, 0.f,   34, 34, 0, 255 },
+	{ 0.26f, -0.42f, -0.11f,   -0.03871285f, -0.1548516f, 0.9871789f,   0.f, 0.f,   39, 39, 0, 255 },
+	{ 0.34f, -0.44f, -0.11f,   -0.03871285f, -0.1548516f, 0.9871789f,   0.f, 0.f,   39, 39, 0, 255 },
+	{ 0.29f, -0.3f, -0.09000002f,   -0.03871285f, -0.1548516f, 0.9871789f,   0.f, 0.f,   39, 39, 0, 255 },
+	{ -0.92f, -0.8200001f, -0.19f,   -0.5338604f, -0.02224416f, -0.8452799f,   0.f, 0.f,   6, 6, 0, 255 },
+	{ -0.93f, -0.58f, -0.19f,   -0.5338604f, -0.02224416f, -0.8452799f,   0.f, 0.f,   6, 6, 0, 255 },
+	{ -0.9f, -0.54f, -0.2099999f,   -0.5338604f, -0.02224416f, -0.8452799f,   0.f, 0.f,   6, 6, 0, 255 },
+	{ -0.87f, -0.62f, -0.15f,   0.9953712f, -0.09479715f, -0.01579951f,   0.f, 0.f,   24, 24, 0, 255 },
+	{ -0.89f, -0.83f, -0.15f,   0.9953712f, -0.09479715f, -0.01579951f,   0.f, 0.f,   24, 24, 0, 255 },
+	{ -0.88f, -0.72f, -0.18f,   0.9953712f, -0.09479715f, -0.01579951f,   0.f, 0.f,   24, 24, 0, 255 },
+	{ -0.92f, -0.6800001f, -0.15f,   -0.f, 0.f, 1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.89f, -0.83f, -0.15f,   -0.f, 0.f, 1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.87f, -0.62f, -0.15f,   -0.f, 0.f, 1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.92f, -0.6800001f, -0.15f,   0.2037847f, 0.04075699f, 0.9781669f,   0.f, 0.f,   10, 10, 0, 255 },
+	{ -0.92f, -0.92f, -0.14f,   0.2037847f, 0.04075699f, 0.9781669f,   0.f, 0.f,   10, 10, 0, 255 },
+	{ -0.89f, -0.83f, -0.15f,   0.2037847f, 0.04075699f, 0.9781669f,   0.f, 0.f,   10, 10, 0, 255 },
+	{ -0.92f, -0.6800001f, -0.15f,   -0.5845215f, -0.04929702f, 0.8098793f,   0.f, 0.f,   13, 13, 0, 255 },
+	{ -0.97f, -0.58f, -0.18f,   -0.5845215f, -0.04929702f, 0.8098793f,   0.f, 0.f,   13, 13, 0, 255 },
+	{ -0.93f, -0.89f, -0.17f,   -0.5845215f, -0.04929702f, 0.8098793f,   0.f, 0.f,   13, 13, 0, 255 },
+	{ -0.93f, -0.89f, -0.17f,   -0.9444084f, 0.01368708f, 0.3284896f,   0.f, 0.f,   3, 3, 0, 255 },
+	{ -0.92f, -0.92f, -0.14f,   -0.9444084f, 0.01368708f, 0.3284896f,   0.f, 0.f,   3, 3, 0, 255 },
+	{ -0.92f, -0.6800001f, -0.15f,   -0.9444084f, 0.01368708f, 0.3284896f,   0.f, 0.f,   3, 3, 0, 255 },
+	{ -0.82f, -0.5100001f, -0.18f,   0.8210323f, -0.5597956f, 0.1119597f,   0.f, 0.f,   143, 143, 0, 255 },
+	{ -0.82f, -0.5f, -0.13f,   0.8210323f, -0.5597956f, 0.1119597f,   0.f, 0.f,   143, 143, 0, 255 },
+	{ -0.85f, -0.55f, -0.16f,   0.8210323f, -0.5597956f, 0.1119597f,   0.f, 0.f,   143, 143, 0, 255 },
+	{ -0.82f, -0.5f, -0.13f,   0.7219954f, -0.6188527f, 0.3094253f,   0.f, 0.f,   158, 158, 0, 255 },
+	{ -0.88f, -0.5700001f, -0.13f,   0.7219954f, -0.6188527f, 0.3094253f,   0.f, 0.f,   158, 158, 0, 255 },
+	{ -0.85f, -0.55f, -0.16f,   0.7219954f, -0.6188527f, 0.3094253f,   0.f, 0.f,   158, 158, 0, 255 },
+	{ -0.86f, -0.49f, -0.2099999f,   0.5353125f, -0.1703266f, -0.8273025f,   0.f, 0.f,   43, 43, 0, 255 },
+	{ -0.82f, -0.5100001f, -0.18f,   0.5353125f, -0.1703266f, -0.8273025f,   0.f, 0.f,   43, 43, 0, 255 },
+	{ -0.87f, -0.5700001f, -0.2f,   0.5353125f, -0.1703266f, -0.8273025f,   0.f, 0.f,   43, 43, 0, 255 },
+	{ -0.87f, -0.5700001f, -0.2f,   0.7784988f, -0.6227996f, -0.0778486f,   0.f, 0.f,   159, 159, 0, 255 },
+	{ -0.82f, -0.5100001f, -0.18f,   0.7784988f, -0.6227996f, -0.0778486f,   0.f, 0.f,   159, 159, 0, 255 },
+	{ -0.85f, -0.55f, -0.16f,   0.7784988f, -0.6227996f, -0.0778486f,   0.f, 0.f,   159, 159, 0, 255 },
+	{ -0.82f, -0.5f, -0.13f,   9.718148e-08f, 1.295752e-07f, 1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.92f, -0.54f, -0.13f,   9.718148e-08f, 1.295752e-07f, 1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.88f, -0.5700001f, -0.13f,   9.718148e-08f, 1.295752e-07f, 1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.9f, -0.54f, -0.2099999f,   0.1801874f, -0.1441498f, -0.9730125f,   0.f, 0.f,   37, 37, 0, 255 },
+	{ -0.86f, -0.49f, -0.2099999f,   0.1801874f, -0.1441498f, -0.9730125f,   0.f, 0.f,   37, 37, 0, 255 },
+	{ -0.87f, -0.5700001f, -0.2f,   0.1801874f, -0.1441498f, -0.9730125f,   0.f, 0.f,   37, 37, 0, 255 },
+	{ -0.93f, -0.52f, -0.2099999f,   0.f, 0.f, -1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.86f, -0.49f, -0.2099999f,   0.f, 0.f, -1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.9f, -0.54f, -0.2099999f,   0.f, 0.f, -1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.84f, 0.03999996f, -0.24f,   -0.3530023f, 0.01765021f, -0.935456f,   0.f, 0.f,   5, 5, 0, 255 },
+	{ -0.82f, -0.09000003f, -0.25f,   -0.3530023f, 0.01765021f, -0.935456f,   0.f, 0.f,   5, 5, 0, 255 },
+	{ -0.87f, -0.02999997f, -0.23f,   -0.3530023f, 0.01765021f, -0.935456f,   0.f, 0.f,   5, 5, 0, 255 },
+	{ -0.92f, -0.54f, -0.13f,   -0.3549145f, 0.2028085f, 0.912636f,   0.f, 0.f,   52, 52, 0, 255 },
+	{ -0.84f, -0.4f, -0.13f,   -0.3549145f, 0.2028085f, 0.912636f,   0.f, 0.f,   52, 52, 0, 255 },
+	{ -0.96f, -0.52f, -0.15f,   -0.3549145f, 0.2028085f, 0.912636f,   0.f, 0.f,   52, 52, 0, 255 },
+	{ -0.75f, -0.36f, -0.08999997f,   -0.3768223f, -0.07536441f, 0.9232146f,   0.f, 0.f,   19, 19, 0, 255 },
+	{ -0.84f, -0.4f, -0.13f,   -0.3768223f, -0.07536441f, 0.9232146f,   0.f, 0.f,   19, 19, 0, 255 },
+	{ -0.82f, -0.5f, -0.13f,   -0.3768223f, -0.07536441f, 0.9232146f,   0.f, 0.f,   19, 19, 0, 255 },
+	{ -0.92f, -0.54f, -0.13f,   -0.5427207f, -0.3015108f, 0.7839295f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ -0.96f, -0.52f, -0.15f,   -0.5427207f, -0.3015108f, 0.7839295f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ -0.97f, -0.58f, -0.18f,   -0.5427207f, -0.3015108f, 0.7839295f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ -0.82f, -0.5f, -0.13f,   0.3756266f, -0.9087737f, 0.1817556f,   0.f, 0.f,   232, 232, 0, 255 },
+	{ -0.82f, -0.5100001f, -0.18f,   0.3756266f, -0.9087737f, 0.1817556f,   0.f, 0.f,   232, 232, 0, 255 },
+	{ -0.67f, -0.44f, -0.14f,   0.3756266f, -0.9087737f, 0.1817556f,   0.f, 0.f,   232, 232, 0, 255 },
+	{ -0.67f, -0.44f, -0.14f,   0.6545935f, -0.6794517f, 0.3314401f,   0.f, 0.f,   173, 173, 0, 255 },
+	{ -0.53f, -0.31f, -0.15f,   0.6545935f, -0.6794517f, 0.3314401f,   0.f, 0.f,   173, 173, 0, 255 },
+	{ -0.55f, -0.3f, -0.08999998f,   0.6545935f, -0.6794517f, 0.3314401f,   0.f, 0.f,   173, 173, 0, 255 },
+	{ -0.82f, -0.5f, -0.13f,   1.379737e-07f, 2.759472e-08f, 1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.84f, -0.4f, -0.13f,   1.379737e-07f, 2.759472e-08f, 1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.92f, -0.54f, -0.13f,   1.379737e-07f, 2.759472e-08f, 1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.55f, -0.3f, -0.08999998f,   0.1765647f, -0.4617844f, 0.8692411f,   0.f, 0.f,   118, 118, 0, 255 },
+	{ -0.59f, -0.24f, -0.04999997f,   0.1765647f, -0.4617844f, 0.8692411f,   0.f, 0.f,   118, 118, 0, 255 },
+	{ -0.67f, -0.44f, -0.14f,   0.1765647f, -0.4617844f, 0.8692411f,   0.f, 0.f,   118, 118, 0, 255 },
+	{ -0.82f, -0.5f, -0.13f,   0.247453f, -0.4781861f, 0.8426774f,   0.f, 0.f,   122, 122, 0, 255 },
+	{ -0.67f, -0.44f, -0.14f,   0.247453f, -0.4781861f, 0.8426774f,   0.f, 0.f,   122, 122, 0, 255 },
+	{ -0.59f, -0.24f, -0.04999997f,   0.247453f, -0.4781861f, 0.8426774f,   0.f, 0.f,   122, 122, 0, 255 },
+	{ -0.59f, -0.24f, -0.04999997f,   -0.05525786f, -0.2486605f, 0.9670132f,   0.f, 0.f,   63, 63, 0, 255 },
+	{ -0.75f, -0.36f, -0.08999997f,   -0.05525786f, -0.2486605f, 0.9670132f,   0.f, 0.f,   63, 63, 0, 255 },
+	{ -0.82f, -0.5f, -0.13f,   -0.05525786f, -0.2486605f, 0.9670132f,   0.f, 0.f,   63, 63, 0, 255 },
+	{ -0.97f, -0.5100001f, -0.18f,   -0.5999996f, -0.f, -0.8000003f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.93f, -0.52f, -0.2099999f,   -0.5999996f, -0.f, -0.8000003f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.97f, -0.58f, -0.18f,   -0.5999996f, -0.f, -0.8000003f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.97f, -0.58f, -0.18f,   -0.2307689f, -0.3076923f, -0.923077f,   0.f, 0.f,   78, 78, 0, 255 },
+	{ -0.93f, -0.52f, -0.2099999f,   -0.2307689f, -0.3076923f, -0.923077f,   0.f, 0.f,   78, 78, 0, 255 },
+	{ -0.93f, -0.58f, -0.19f,   -0.2307689f, -0.3076923f, -0.923077f,   0.f, 0.f,   78, 78, 0, 255 },
+	{ -0.87f, -0.62f, -0.15f,   0.7401355f, -0.1168634f, 0.6622253f,   0.f, 0.f,   30, 30, 0, 255 },
+	{ -0.85f, -0.55f, -0.16f,   0.7401355f, -0.1168634f, 0.6622253f,   0.f, 0.f,   30, 30, 0, 255 },
+	{ -0.88f, -0.5700001f, -0.13f,   0.7401355f, -0.1168634f, 0.6622253f,   0.f, 0.f,   30, 30, 0, 255 },
+	{ -0.85f, -0.55f, -0.16f,   0.9045343f, -0.3015111f, -0.3015109f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ -0.87f, -0.62f, -0.15f,   0.9045343f, -0.3015111f, -0.3015109f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ -0.87f, -0.5700001f, -0.2f,   0.9045343f, -0.3015111f, -0.3015109f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ -0.93f, -0.58f, -0.19f,   -0.2062838f, -0.3094263f, -0.9282792f,   0.f, 0.f,   79, 79, 0, 255 },
+	{ -0.93f, -0.52f, -0.2099999f,   -0.2062838f, -0.3094263f, -0.9282792f,   0.f, 0.f,   79, 79, 0, 255 },
+	{ -0.9f, -0.54f, -0.2099999f,   -0.2062838f, -0.3094263f, -0.9282792f,   0.f, 0.f,   79, 79, 0, 255 },
+	{ -0.85f, 0.15f, -0.09999996f,   -0.5425902f, 0.6412425f, -0.5425901f,   0.f, 0.f,   164, 164, 0, 255 },
+	{ -0.72f, 0.15f, -0.23f,   -0.5425902f, 0.6412425f, -0.5425901f,   0.f, 0.f,   164, 164, 0, 255 },
+	{ -0.84f, 0.03999996f, -0.24f,   -0.5425902f, 0.6412425f, -0.5425901f,   0.f, 0.f,   164, 164, 0, 255 },
+	{ 0.21f, 0.2099999f, -0.16f,   -0.1566941f, 0.644185f, -0.7486473f,   0.f, 0.f,   164, 164, 0, 255 },
+	{ 0.32f, 0.26f, -0.14f,   -0.1566941f, 0.644185f, -0.7486473f,   0.f, 0.f,   164, 164, 0, 255 },
+	{ 0.27f, 0.12f, -0.25f,   -0.1566941f, 0.644185f, -0.7486473f,   0.f, 0.f,   164, 164, 0, 255 },
+	{ 0.16f, 0.07999992f, -0.23f,   -0.337408f, 0.5436014f, -0.7685398f,   0.f, 0.f,   139, 139, 0, 255 },
+	{ 0.21f, 0.2099999f, -0.16f,   -0.337408f, 0.5436014f, -0.7685398f,   0.f, 0.f,   139, 139, 0, 255 },
+	{ 0.27f, 0.12f, -0.25f,   -0.337408f, 0.5436014f, -0.7685398f,   0.f, 0.f,   139, 139, 0, 255 },
+	{ -0.6f, 0.03999996f, -0.22f,   0.08304548f, -4.39444e-08f, -0.9965457f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.84f, 0.03999996f, -0.24f,   0.08304548f, -4.39444e-08f, -0.9965457f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.72f, 0.15f, -0.23f,   0.08304548f, -4.39444e-08f, -0.9965457f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.9f, -0.06000006f, -0.19f,   -0.8717005f, 0.3531502f, -0.3397399f,   0.f, 0.f,   90, 90, 0, 255 },
+	{ -0.85f, 0.15f, -0.09999996f,   -0.8717005f, 0.3531502f, -0.3397399f,   0.f, 0.f,   90, 90, 0, 255 },
+	{ -0.84f, 0.03999996f, -0.24f,   -0.8717005f, 0.3531502f, -0.3397399f,   0.f, 0.f,   90, 90, 0, 255 },
+	{ -0.07000001f, 0.22f, -0.16f,   -0.01073469f, 0.8695114f, -0.4937962f,   0.f, 0.f,   222, 222, 0, 255 },
+	{ -0.05f, 0.26f, -0.09f,   -0.01073469f, 0.8695114f, -0.4937962f,   0.f, 0.f,   222, 222, 0, 255 },
+	{ 0.08f, 0.29f, -0.04f,   -0.01073469f, 0.8695114f, -0.4937962f,   0.f, 0.f,   222, 222, 0, 255 },
+	{ -0.05f, 0.26f, -0.09f,   -0.2913729f, 0.9554329f, -0.04743277f,   0.f, 0.f,   244, 244, 0, 255 },
+	{ -0.04f, 0.27f, 0.05f,   -0.2913729f, 0.9554329f, -0.04743277f,   0.f, 0.f,   244, 244, 0, 255 },
+	{ 0.06f, 0.3f, 0.04f,   -0.2913729f, 0.9554329f, -0.04743277f,   0.f, 0.f,   244, 244, 0, 255 },
+	{ 0.06f, 0.3f, 0.04f,   -0.1622213f, 0.9733286f, -0.1622213f,   0.f, 0.f,   248, 248, 0, 255 },
+	{ 0.08f, 0.29f, -0.04f,   -0.1622213f, 0.9733286f, -0.1622213f,   0.f, 0.f,   248, 248, 0, 255 },
+	{ -0.05f, 0.26f, -0.09f,   -0.1622213f, 0.9733286f, -0.1622213f,   0.f, 0.f,   248, 248, 0, 255 },
+	{ 0.15f, 0.27f, -0.11f,   -0.1211438f, 0.9158479f, -0.3828143f,   0.f, 0.f,   234, 234, 0, 255 },
+	{ -0.07000001f, 0.22f, -0.16f,   -0.1211438f, 0.9158479f, -0.3828143f,   0.f, 0.f,   234, 234, 0, 255 },
+	{ 0.08f, 0.29f, -0.04f,   -0.1211438f, 0.9158479f, -0.3828143f,   0.f, 0.f,   234, 234, 0, 255 },
+	{ -0.87f, -0.02999997f, -0.23f,   -0.8574933f, 0.3086986f, -0.4115947f,   0.f, 0.f,   79, 79, 0, 255 },
+	{ -0.9f, -0.06000006f, -0.19f,   -0.8574933f, 0.3086986f, -0.4115947f,   0.f, 0.f,   79, 79, 0, 255 },
+	{ -0.84f, 0.03999996f, -0.24f,   -0.8574933f, 0.3086986f, -0.4115947f,   0.f, 0.f,   79, 79, 0, 255 },
+	{ -0.89f, -0.04000008f, -0.09999996f,   -0.8978745f, -0.4327108f, 0.08113353f,   0.f, 0.f,   110, 110, 0, 255 },
+	{ -0.84f, -0.14f, -0.07999996f,   -0.8978745f, -0.4327108f, 0.08113353f,   0.f, 0.f,   110, 110, 0, 255 },
+	{ -0.89f, -0.00999999f, 0.06000004f,   -0.8978745f, -0.4327108f, 0.08113353f,   0.f, 0.f,   110, 110, 0, 255 },
+	{ -0.89f, -0.04000008f, -0.09999996f,   0.2936045f, -0.9395539f, 0.1761669f,   0.f, 0.f,   240, 240, 0, 255 },
+	{ -0.89f, -0.00999999f, 0.06000004f,   0.2936045f, -0.9395539f, 0.1761669f,   0.f, 0.f,   240, 240, 0, 255 },
+	{ -0.9f, -0.06000006f, -0.19f,   0.2936045f, -0.9395539f, 0.1761669f,   0.f, 0.f,   240, 240, 0, 255 },
+	{ 0.11f, -0.07000005f, -0.25f,   -0.05598434f, -0.270591f, -0.9610652f,   0.f, 0.f,   69, 69, 0, 255 },
+	{ 0.26f, -0.02999997f, -0.27f,   -0.05598434f, -0.270591f, -0.9610652f,   0.f, 0.f,   69, 69, 0, 255 },
+	{ 0.25f, -0.17f, -0.23f,   -0.05598434f, -0.270591f, -0.9610652f,   0.f, 0.f,   69, 69, 0, 255 },
+	{ 0.45f, 0.f, -1.967013e-08f,   0.9542639f, -0.1060292f, 0.2795319f,   0.f, 0.f,   27, 27, 0, 255 },
+	{ 0.43f, -0.18f, -1.87959e-08f,   0.9542639f, -0.1060292f, 0.2795319f,   0.f, 0.f,   27, 27, 0, 255 },
+	{ 0.48f, -0.01999998f, -0.11f,   0.9542639f, -0.1060292f, 0.2795319f,   0.f, 0.f,   27, 27, 0, 255 },
+	{ 0.43f, -0.18f, -1.87959e-08f,   0.9676528f, -0.2276829f, 0.1086668f,   0.f, 0.f,   58, 58, 0, 255 },
+	{ 0.44f, -0.19f, -0.11f,   0.9676528f, -0.2276829f, 0.1086668f,   0.f, 0.f,   58, 58, 0, 255 },
+	{ 0.48f, -0.01999998f, -0.11f,   0.9676528f, -0.2276829f, 0.1086668f,   0.f, 0.f,   58, 58, 0, 255 },
+	{ 0.2f, -0.27f, -0.07000001f,   -0.199007f, -0.8955335f, 0.3980151f,   0.f, 0.f,   228, 228, 0, 255 },
+	{ 0.25f, -0.29f, -0.09000001f,   -0.199007f, -0.8955335f, 0.3980151f,   0.f, 0.f,   228, 228, 0, 255 },
+	{ 0.25f, -0.25f, -1.092785e-08f,   -0.199007f, -0.8955335f, 0.3980151f,   0.f, 0.f,   228, 228, 0, 255 },
+	{ 0.25f, -0.17f, -0.23f,   0.1313373f, -0.4268464f, -0.8947361f,   0.f, 0.f,   109, 109, 0, 255 },
+	{ 0.23f, -0.2600001f, -0.19f,   0.1313373f, -0.4268464f, -0.8947361f,   0.f, 0.f,   109, 109, 0, 255 },
+	{ 0.12f, -0.21f, -0.23f,   0.1313373f, -0.4268464f, -0.8947361f,   0.f, 0.f,   109, 109, 0, 255 },
+	{ 0.25f, -0.25f, -1.092785e-08f,   0.3488988f, -0.856388f, 0.3806171f,   0.f, 0.f,   218, 218, 0, 255 },
+	{ 0.25f, -0.29f, -0.09000001f,   0.3488988f, -0.856388f, 0.3806171f,   0.f, 0.f,   218, 218, 0, 255 },
+	{ 0.34f, -0.24f, -0.06000001f,   0.3488988f, -0.856388f, 0.3806171f,   0.f, 0.f,   218, 218, 0, 255 },
+	{ 0.12f, -0.21f, -0.23f,   -0.01498906f, -0.6445248f, -0.7644365f,   0.f, 0.f,   164, 164, 0, 255 },
+	{ 0.23f, -0.2600001f, -0.19f,   -0.01498906f, -0.6445248f, -0.7644365f,   0.f, 0.f,   164, 164, 0, 255 },
+	{ 0.15f, -0.27f, -0.18f,   -0.01498906f, -0.6445248f, -0.7644365f,   0.f, 0.f,   164, 164, 0, 255 },
+	{ 0.12f, -0.21f, -0.23f,   0.04255792f, -0.1383135f, -0.9894737f,   0.f, 0.f,   35, 35, 0, 255 },
+	{ 0.11f, -0.07000005f, -0.25f,   0.04255792f, -0.1383135f, -0.9894737f,   0.f, 0.f,   35, 35, 0, 255 },
+	{ 0.25f, -0.17f, -0.23f,   0.04255792f, -0.1383135f, -0.9894737f,   0.f, 0.f,   35, 35, 0, 255 },
+	{ 0.45f, 0.f, -1.967013e-08f,   0.8692002f, -0.2607602f, -0.4201133f,   0.f, 0.f,   66, 66, 0, 255 },
+	{ 0.46f, 0.13f, -0.06000002f,   0.8692002f, -0.2607602f, -0.4201133f,   0.f, 0.f,   66, 66, 0, 255 },
+	{ 0.51f, 0.1999999f, -2.229281e-08f,   0.8692002f, -0.2607602f, -0.4201133f,   0.f, 0.f,   66, 66, 0, 255 },
+	{ 0.27f, 0.12f, -0.25f,   0.4598759f, 0.4412321f, -0.7706026f,   0.f, 0.f,   113, 113, 0, 255 },
+	{ 0.32f, 0.26f, -0.14f,   0.4598759f, 0.4412321f, -0.7706026f,   0.f, 0.f,   113, 113, 0, 255 },
+	{ 0.38f, 0.1799999f, -0.15f,   0.4598759f, 0.4412321f, -0.7706026f,   0.f, 0.f,   113, 113, 0, 255 },
+	{ 0.32f, 0.26f, -0.14f,   0.0807514f, 0.1830365f, -0.979784f,   0.f, 0.f,   47, 47, 0, 255 },
+	{ 0.48f, 0.35f, -0.11f,   0.0807514f, 0.1830365f, -0.979784f,   0.f, 0.f,   47, 47, 0, 255 },
+	{ 0.38f, 0.1799999f, -0.15f,   0.0807514f, 0.1830365f, -0.979784f,   0.f, 0.f,   47, 47, 0, 255 },
+	{ 0.38f, 0.1799999f, -0.15f,   0.7292861f, 0.6103815f, -0.3091539f,   0.f, 0.f,   156, 156, 0, 255 },
+	{ 0.46f, 0.13f, -0.06000002f,   0.7292861f, 0.6103815f, -0.3091539f,   0.f, 0.f,   156, 156, 0, 255 },
+	{ 0.43f, 0.1f, -0.19f,   0.7292861f, 0.6103815f, -0.3091539f,   0.f, 0.f,   156, 156, 0, 255 },
+	{ 0.38f, 0.1799999f, -0.15f,   0.3479938f, 0.584133f, -0.7332728f,   0.f, 0.f,   149, 149, 0, 255 },
+	{ 0.43f, 0.1f, -0.19f,   0.3479938f, 0.584133f, -0.7332728f,   0.f, 0.f,   149, 149, 0, 255 },
+	{ 0.27f, 0.12f, -0.25f,   0.3479938f, 0.584133f, -0.7332728f,   0.f, 0.f,   149, 149, 0, 255 },
+	{ 0.08f, 0.29f, -0.04f,   -0.4452052f, 0.6386138f, -0.6276661f,   0.f, 0.f,   163, 163, 0, 255 },
+	{ 0.31f, 0.47f, -0.02000001f,   -0.4452052f, 0.6386138f, -0.6276661f,   0.f, 0.f,   163, 163, 0, 255 },
+	{ 0.15f, 0.27f, -0.11f,   -0.4452052f, 0.6386138f, -0.6276661f,   0.f, 0.f,   163, 163, 0, 255 },
+	{ 0.11f, -0.07000005f, -0.25f,   -0.1789967f, 0.1884175f, -0.9656392f,   0.f, 0.f,   48, 48, 0, 255 },
+	{ 0.16f, 0.07999992f, -0.23f,   -0.1789967f, 0.1884175f, -0.9656392f,   0.f, 0.f,   48, 48, 0, 255 },
+	{ 0.26f, -0.02999997f, -0.27f,   -0.1789967f, 0.1884175f, -0.9656392f,   0.f, 0.f,   48, 48, 0, 255 },
+	{ 0.31f, 0.47f, -0.02000001f,   -0.5846594f, 0.7740558f, -0.2429217f,   0.f, 0.f,   197, 197, 0, 255 },
+	{ 0.08f, 0.29f, -0.04f,   -0.5846594f, 0.7740558f, -0.2429217f,   0.f, 0.f,   197, 197, 0, 255 },
+	{ 0.06f, 0.3f, 0.04f,   -0.5846594f, 0.7740558f, -0.2429217f,   0.f, 0.f,   197, 197, 0, 255 },
+	{ 0.21f, 0.2099999f, -0.16f,   -0.110368f, 0.5688184f, -0.8150243f,   0.f, 0.f,   145, 145, 0, 255 },
+	{ 0.15f, 0.27f, -0.11f,   -0.110368f, 0.5688184f, -0.8150243f,   0.f, 0.f,   145, 145, 0, 255 },
+	{ 0.32f, 0.26f, -0.14f,   -0.110368f, 0.5688184f, -0.8150243f,   0.f, 0.f,   145, 145, 0, 255 },
+	{ 0.15f, 0.27f, -0.11f,   0.1257817f, 0.7063116f, -0.6966368f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ 0.21f, 0.2099999f, -0.16f,   0.1257817f, 0.7063116f, -0.6966368f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ 0.09999999f, 0.1999999f, -0.19f,   0.1257817f, 0.7063116f, -0.6966368f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ 0.09999999f, 0.1999999f, -0.19f,   0.01070082f, 0.321021f, -0.9470116f,   0.f, 0.f,   82, 82, 0, 255 },
+	{ 0.16f, 0.07999992f, -0.23f,   0.01070082f, 0.321021f, -0.9470116f,   0.f, 0.f,   82, 82, 0, 255 },
+	{ -0.14f, 0.09000003f, -0.23f,   0.01070082f, 0.321021f, -0.9470116f,   0.f, 0.f,   82, 82, 0, 255 },
+	{ -0.14f, 0.09000003f, -0.23f,   -0.09101418f, 0.5096809f, -0.855536f,   0.f, 0.f,   130, 130, 0, 255 },
+	{ -0.07000001f, 0.22f, -0.16f,   -0.09101418f, 0.5096809f, -0.855536f,   0.f, 0.f,   130, 130, 0, 255 },
+	{ 0.09999999f, 0.1999999f, -0.19f,   -0.09101418f, 0.5096809f, -0.855536f,   0.f, 0.f,   130, 130, 0, 255 },
+	{ 0.16f, 0.07999992f, -0.23f,   0.2069388f, 0.400944f, -0.8924238f,   0.f, 0.f,   102, 102, 0, 255 },
+	{ 0.09999999f, 0.1999999f, -0.19f,   0.2069388f, 0.400944f, -0.8924238f,   0.f, 0.f,   102, 102, 0, 255 },
+	{ 0.21f, 0.2099999f, -0.16f,   0.2069388f, 0.400944f, -0.8924238f,   0.f, 0.f,   102, 102, 0, 255 },
+	{ 0.58f, 0.75f, -0.02000003f,   -0.1759231f, 0.9550121f, -0.2387528f,   0.f, 0.f,   244, 244, 0, 255 },
+	{ 0.58f, 0.76f, 0.01999997f,   -0.1759231f, 0.9550121f, -0.2387528f,   0.f, 0.f,   244, 244, 0, 255 },
+	{ 0.77f, 0.79f, -3.365777e-08f,   -0.1759231f, 0.9550121f, -0.2387528f,   0.f, 0.f,   244, 244, 0, 255 },
+	{ 0.58f, 0.76f, 0.01999997f,   -0.4364358f, 0.8728716f, -0.2182177f,   0.f, 0.f,   223, 223, 0, 255 },
+	{ 0.58f, 0.75f, -0.02000003f,   -0.4364358f, 0.8728716f, -0.2182177f,   0.f, 0.f,   223, 223, 0, 255 },
+	{ 0.32f, 0.62f, -0.02000001f,   -0.4364358f, 0.8728716f, -0.2182177f,   0.f, 0.f,   223, 223, 0, 255 },
+	{ 0.32f, 0.62f, -0.02000001f,   -0.4762033f, 0.8791444f, 0.01831586f,   0.f, 0.f,   224, 224, 0, 255 },
+	{ 0.34f, 0.63f, 0.01999998f,   -0.4762033f, 0.8791444f, 0.01831586f,   0.f, 0.f,   224, 224, 0, 255 },
+	{ 0.58f, 0.76f, 0.01999997f,   -0.4762033f, 0.8791444f, 0.01831586f,   0.f, 0.f,   224, 224, 0, 255 },
+	{ 0.35f, 0.47f, -0.01000001f,   0.03911798f, -0.0586771f, -0.9975103f,   0.f, 0.f,   15, 15, 0, 255 },
+	{ 0.32f, 0.62f, -0.02000001f,   0.03911798f, -0.0586771f, -0.9975103f,   0.f, 0.f,   15, 15, 0, 255 },
+	{ 0.5f, 0.5699999f, -0.01000002f,   0.03911798f, -0.0586771f, -0.9975103f,   0.f, 0.f,   15, 15, 0, 255 },
+	{ 0.32f, 0.62f, -0.02000001f,   0.03560089f, -0.07120186f, -0.9968264f,   0.f, 0.f,   18, 18, 0, 255 },
+	{ 0.58f, 0.75f, -0.02000003f,   0.03560089f, -0.07120186f, -0.9968264f,   0.f, 0.f,   18, 18, 0, 255 },
+	{ 0.5f, 0.5699999f, -0.01000002f,   0.03560089f, -0.07120186f, -0.9968264f,   0.f, 0.f,   18, 18, 0, 255 },
+	{ 0.5f, 0.5699999f, -0.01000002f,   0.05553838f, -0.0799753f, -0.9952485f,   0.f, 0.f,   20, 20, 0, 255 },
+	{ 0.58f, 0.75f, -0.02000003f,   0.05553838f, -0.0799753f, -0.9952485f,   0.f, 0.f,   20, 20, 0, 255 },
+	{ 0.78f, 0.64f, -3.409488e-08f,   0.05553838f, -0.0799753f, -0.9952485f,   0.f, 0.f,   20, 20, 0, 255 },
+	{ 0.58f, 0.75f, -0.02000003f,   0.1032489f, 0.006883263f, -0.9946318f,   0.f, 0.f,   2, 2, 0, 255 },
+	{ 0.77f, 0.79f, -3.365777e-08f,   0.1032489f, 0.006883263f, -0.9946318f,   0.f, 0.f,   2, 2, 0, 255 },
+	{ 0.78f, 0.64f, -3.409488e-08f,   0.1032489f, 0.006883263f, -0.9946318f,   0.f, 0.f,   2, 2, 0, 255 },
+	{ 0.23f, 0.37f, -0.01000001f,   0.04748784f, -0.05698543f, -0.997245f,   0.f, 0.f,   15, 15, 0, 255 },
+	{ 0.32f, 0.62f, -0.02000001f,   0.04748784f, -0.05698543f, -0.997245f,   0.f, 0.f,   15, 15, 0, 255 },
+	{ 0.35f, 0.47f, -0.01000001f,   0.04748784f, -0.05698543f, -0.997245f,   0.f, 0.f,   15, 15, 0, 255 },
+	{ 0.12f, 0.42f, -5.245366e-09f,   -0.09333893f, -0.006222605f, -0.9956149f,   0.f, 0.f,   2, 2, 0, 255 },
+	{ 0.32f, 0.62f, -0.02000001f,   -0.09333893f, -0.006222605f, -0.9956149f,   0.f, 0.f,   2, 2, 0, 255 },
+	{ 0.23f, 0.37f, -0.01000001f,   -0.09333893f, -0.006222605f, -0.9956149f,   0.f, 0.f,   2, 2, 0, 255 },
+	{ 0.12f, 0.3f, -5.245366e-09f,   -0.09053577f, 0.f, -0.9958932f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.12f, 0.42f, -5.245366e-09f,   -0.09053577f, 0.f, -0.9958932f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.23f, 0.37f, -0.01000001f,   -0.09053577f, 0.f, -0.9958932f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.14f, 0.09000003f, -0.23f,   0.007387246f, 0.221615f, -0.9751063f,   0.f, 0.f,   57, 57, 0, 255 },
+	{ 0.16f, 0.07999992f, -0.23f,   0.007387246f, 0.221615f, -0.9751063f,   0.f, 0.f,   57, 57, 0, 255 },
+	{ -0.08000001f, 0.f, -0.25f,   0.007387246f, 0.221615f, -0.9751063f,   0.f, 0.f,   57, 57, 0, 255 },
+	{ 0.11f, -0.07000005f, -0.25f,   0.04340384f, 0.1178103f, -0.9920871f,   0.f, 0.f,   30, 30, 0, 255 },
+	{ -0.08000001f, 0.f, -0.25f,   0.04340384f, 0.1178103f, -0.9920871f,   0.f, 0.f,   30, 30, 0, 255 },
+	{ 0.16f, 0.07999992f, -0.23f,   0.04340384f, 0.1178103f, -0.9920871f,   0.f, 0.f,   30, 30, 0, 255 },
+	{ -0.33f, 0.25f, -0.11f,   0.0716545f, 0.8956822f, -0.4388838f,   0.f, 0.f,   228, 228, 0, 255 },
+	{ -0.58f, 0.27f, -0.11f,   0.0716545f, 0.8956822f, -0.4388838f,   0.f, 0.f,   228, 228, 0, 255 },
+	{ -0.46f, 0.28f, -0.06999998f,   0.0716545f, 0.8956822f, -0.4388838f,   0.f, 0.f,   228, 228, 0, 255 },
+	{ -0.3f, 0.2099999f, -0.14f,   -0.09605278f, 0.5501178f, -0.8295446f,   0.f, 0.f,   140, 140, 0, 255 },
+	{ -0.33f, 0.25f, -0.11f,   -0.09605278f, 0.5501178f, -0.8295446f,   0.f, 0.f,   140, 140, 0, 255 },
+	{ -0.07000001f, 0.22f, -0.16f,   -0.09605278f, 0.5501178f, -0.8295446f,   0.f, 0.f,   140, 140, 0, 255 },
+	{ 0.09999999f, 0.1999999f, -0.19f,   -0.02516792f, 0.7600807f, -0.6493412f,   0.f, 0.f,   194, 194, 0, 255 },
+	{ -0.07000001f, 0.22f, -0.16f,   -0.02516792f, 0.7600807f, -0.6493412f,   0.f, 0.f,   194, 194, 0, 255 },
+	{ 0.15f, 0.27f, -0.11f,   -0.02516792f, 0.7600807f, -0.6493412f,   0.f, 0.f,   194, 194, 0, 255 },
+	{ -0.33f, 0.25f, -0.11f,   0.01185588f, 0.818059f, -0.575012f,   0.f, 0.f,   209, 209, 0, 255 },
+	{ -0.46f, 0.28f, -0.06999998f,   0.01185588f, 0.818059f, -0.575012f,   0.f, 0.f,   209, 209, 0, 255 },
+	{ -0.05f, 0.26f, -0.09f,   0.01185588f, 0.818059f, -0.575012f,   0.f, 0.f,   209, 209, 0, 255 },
+	{ -0.05f, 0.26f, -0.09f,   0.004519118f, 0.8676777f, -0.4971066f,   0.f, 0.f,   221, 221, 0, 255 },
+	{ -0.07000001f, 0.22f, -0.16f,   0.004519118f, 0.8676777f, -0.4971066f,   0.f, 0.f,   221, 221, 0, 255 },
+	{ -0.33f, 0.25f, -0.11f,   0.004519118f, 0.8676777f, -0.4971066f,   0.f, 0.f,   221, 221, 0, 255 },
+	{ -0.31f, 0.04999995f, -0.19f,   -0.2851132f, 0.302084f, -0.9096459f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ -0.3f, 0.2099999f, -0.14f,   -0.2851132f, 0.302084f, -0.9096459f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ -0.14f, 0.09000003f, -0.23f,   -0.2851132f, 0.302084f, -0.9096459f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ -0.08000001f, 0.f, -0.25f,   -0.2408837f, 0.05474607f, -0.9690087f,   0.f, 0.f,   14, 14, 0, 255 },
+	{ -0.31f, 0.04999995f, -0.19f,   -0.2408837f, 0.05474607f, -0.9690087f,   0.f, 0.f,   14, 14, 0, 255 },
+	{ -0.14f, 0.09000003f, -0.23f,   -0.2408837f, 0.05474607f, -0.9690087f,   0.f, 0.f,   14, 14, 0, 255 },
+	{ -0.13f, -0.14f, -0.24f,   -0.2483952f, 0.01953669f, -0.9684617f,   0.f, 0.f,   5, 5, 0, 255 },
+	{ -0.31f, 0.04999995f, -0.19f,   -0.2483952f, 0.01953669f, -0.9684617f,   0.f, 0.f,   5, 5, 0, 255 },
+	{ -0.08000001f, 0.f, -0.25f,   -0.2483952f, 0.01953669f, -0.9684617f,   0.f, 0.f,   5, 5, 0, 255 },
+	{ -0.14f, 0.09000003f, -0.23f,   -0.09648572f, 0.5116655f, -0.85375f,   0.f, 0.f,   130, 130, 0, 255 },
+	{ -0.3f, 0.2099999f, -0.14f,   -0.09648572f, 0.5116655f, -0.85375f,   0.f, 0.f,   130, 130, 0, 255 },
+	{ -0.07000001f, 0.22f, -0.16f,   -0.09648572f, 0.5116655f, -0.85375f,   0.f, 0.f,   130, 130, 0, 255 },
+	{ -0.77f, -0.21f, 0.06000003f,   -0.6577774f, -0.7517456f, -0.04698407f,   0.f, 0.f,   192, 192, 0, 255 },
+	{ -0.84f, -0.14f, -0.07999996f,   -0.6577774f, -0.7517456f, -0.04698407f,   0.f, 0.f,   192, 192, 0, 255 },
+	{ -0.75f, -0.22f, -0.05999997f,   -0.6577774f, -0.7517456f, -0.04698407f,   0.f, 0.f,   192, 192, 0, 255 },
+	{ -0.05000001f, -0.3200001f, -0.17f,   -0.1809752f, -0.4252915f, -0.8867779f,   0.f, 0.f,   108, 108, 0, 255 },
+	{ -0.24f, -0.2600001f, -0.16f,   -0.1809752f, -0.4252915f, -0.8867779f,   0.f, 0.f,   108, 108, 0, 255 },
+	{ -0.13f, -0.14f, -0.24f,   -0.1809752f, -0.4252915f, -0.8867779f,   0.f, 0.f,   108, 108, 0, 255 },
+	{ -0.64f, -0.23f, 0.04000003f,   -0.1429988f, -0.9879925f, 0.05849952f,   0.f, 0.f,   252, 252, 0, 255 },
+	{ -0.77f, -0.21f, 0.06000003f,   -0.1429988f, -0.9879925f, 0.05849952f,   0.f, 0.f,   252, 252, 0, 255 },
+	{ -0.75f, -0.22f, -0.05999997f,   -0.1429988f, -0.9879925f, 0.05849952f,   0.f, 0.f,   252, 252, 0, 255 },
+	{ 0.16f, 0.07999992f, -0.23f,   -0.2273331f, 0.1435789f, -0.9631743f,   0.f, 0.f,   37, 37, 0, 255 },
+	{ 0.27f, 0.12f, -0.25f,   -0.2273331f, 0.1435789f, -0.9631743f,   0.f, 0.f,   37, 37, 0, 255 },
+	{ 0.26f, -0.02999997f, -0.27f,   -0.2273331f, 0.1435789f, -0.9631743f,   0.f, 0.f,   37, 37, 0, 255 },
+	{ 0.34f, -0.24f, -0.06000001f,   0.3378647f, -0.8687951f, 0.3619981f,   0.f, 0.f,   222, 222, 0, 255 },
+	{ 0.43f, -0.18f, -1.87959e-08f,   0.3378647f, -0.8687951f, 0.3619981f,   0.f, 0.f,   222, 222, 0, 255 },
+	{ 0.25f, -0.25f, -1.092785e-08f,   0.3378647f, -0.8687951f, 0.3619981f,   0.f, 0.f,   222, 222, 0, 255 },
+	{ -0.39f, -0.28f, -0.009999983f,   -0.2967993f, -0.9539981f, -0.0424004f,   0.f, 0.f,   243, 243, 0, 255 },
+	{ -0.46f, -0.2600001f, 0.03000002f,   -0.2967993f, -0.9539981f, -0.0424004f,   0.f, 0.f,   243, 243, 0, 255 },
+	{ -0.51f, -0.24f, -0.06999998f,   -0.2967993f, -0.9539981f, -0.0424004f,   0.f, 0.f,   243, 243, 0, 255 },
+	{ -0.46f, -0.2600001f, 0.03000002f,   -0.04371658f, -0.9836212f, -0.1748664f,   0.f, 0.f,   251, 251, 0, 255 },
+	{ -0.59f, -0.24f, -0.04999997f,   -0.04371658f, -0.9836212f, -0.1748664f,   0.f, 0.f,   251, 251, 0, 255 },
+	{ -0.51f, -0.24f, -0.06999998f,   -0.04371658f, -0.9836212f, -0.1748664f,   0.f, 0.f,   251, 251, 0, 255 },
+	{ -0.51f, -0.24f, -0.06999998f,   0.3695524f, -0.9070828f, -0.2015735f,   0.f, 0.f,   231, 231, 0, 255 },
+	{ -0.48f, -0.21f, -0.15f,   0.3695524f, -0.9070828f, -0.2015735f,   0.f, 0.f,   231, 231, 0, 255 },
+	{ -0.39f, -0.18f, -0.12f,   0.3695524f, -0.9070828f, -0.2015735f,   0.f, 0.f,   231, 231, 0, 255 },
+	{ -0.54f, -0.24f, 0.05000002f,   -0.1045416f, -0.9931459f, 0.05227075f,   0.f, 0.f,   253, 253, 0, 255 },
+	{ -0.64f, -0.23f, 0.04000003f,   -0.1045416f, -0.9931459f, 0.05227075f,   0.f, 0.f,   253, 253, 0, 255 },
+	{ -0.59f, -0.24f, -0.04999997f,   -0.1045416f, -0.9931459f, 0.05227075f,   0.f, 0.f,   253, 253, 0, 255 },
+	{ -0.64f, -0.23f, 0.04000003f,   -0.1263916f, -0.9911771f, 0.03991313f,   0.f, 0.f,   253, 253, 0, 255 },
+	{ -0.75f, -0.22f, -0.05999997f,   -0.1263916f, -0.9911771f, 0.03991313f,   0.f, 0.f,   253, 253, 0, 255 },
+	{ -0.59f, -0.24f, -0.04999997f,   -0.1263916f, -0.9911771f, 0.03991313f,   0.f, 0.f,   253, 253, 0, 255 },
+	{ -0.54f, -0.24f, 0.05000002f,   -0.215666f, -0.9704949f, 0.1078329f,   0.f, 0.f,   247, 247, 0, 255 },
+	{ -0.59f, -0.24f, -0.04999997f,   -0.215666f, -0.9704949f, 0.1078329f,   0.f, 0.f,   247, 247, 0, 255 },
+	{ -0.46f, -0.2600001f, 0.03000002f,   -0.215666f, -0.9704949f, 0.1078329f,   0.f, 0.f,   247, 247, 0, 255 },
+	{ -0.31f, 0.04999995f, -0.19f,   0.4802529f, -0.2990254f, -0.8245853f,   0.f, 0.f,   76, 76, 0, 255 },
+	{ -0.38f, -0.09000003f, -0.18f,   0.4802529f, -0.2990254f, -0.8245853f,   0.f, 0.f,   76, 76, 0, 255 },
+	{ -0.43f, -0.06000006f, -0.22f,   0.4802529f, -0.2990254f, -0.8245853f,   0.f, 0.f,   76, 76, 0, 255 },
+	{ -0.38f, -0.09000003f, -0.18f,   -0.225021f, 0.04298161f, -0.9734054f,   0.f, 0.f,   11, 11, 0, 255 },
+	{ -0.31f, 0.04999995f, -0.19f,   -0.225021f, 0.04298161f, -0.9734054f,   0.f, 0.f,   11, 11, 0, 255 },
+	{ -0.13f, -0.14f, -0.24f,   -0.225021f, 0.04298161f, -0.9734054f,   0.f, 0.f,   11, 11, 0, 255 },
+	{ -0.48f, -0.21f, -0.15f,   0.4222423f, -0.5348401f, -0.7318862f,   0.f, 0.f,   136, 136, 0, 255 },
+	{ -0.38f, -0.09000003f, -0.18f,   0.4222423f, -0.5348401f, -0.7318862f,   0.f, 0.f,   136, 136, 0, 255 },
+	{ -0.39f, -0.18f, -0.12f,   0.4222423f, -0.5348401f, -0.7318862f,   0.f, 0.f,   136, 136, 0, 255 },
+	{ -0.38f, -0.09000003f, -0.18f,   0.5746956f, -0.2873477f, 0.7662613f,   0.f, 0.f,   73, 73, 0, 255 },
+	{ -0.48f, -0.21f, -0.15f,   0.5746956f, -0.2873477f, 0.7662613f,   0.f, 0.f,   73, 73, 0, 255 },
+	{ -0.53f, -0.31f, -0.15f,   0.5746956f, -0.2873477f, 0.7662613f,   0.f, 0.f,   73, 73, 0, 255 },
+	{ 0.31f, -0.29f, -0.22f,   0.1714284f, -0.2857142f, -0.9428572f,   0.f, 0.f,   73, 73, 0, 255 },
+	{ 0.36f, -0.2600001f, -0.22f,   0.1714284f, -0.2857142f, -0.9428572f,   0.f, 0.f,   73, 73, 0, 255 },
+	{ 0.33f, -0.41f, -0.18f,   0.1714284f, -0.2857142f, -0.9428572f,   0.f, 0.f,   73, 73, 0, 255 },
+	{ 0.33f, -0.85f, -0.14f,   -0.7071066f, 0.1979898f, -0.6788227f,   0.f, 0.f,   50, 50, 0, 255 },
+	{ 0.28f, -0.96f, -0.12f,   -0.7071066f, 0.1979898f, -0.6788227f,   0.f, 0.f,   50, 50, 0, 255 },
+	{ 0.29f, -0.89f, -0.11f,   -0.7071066f, 0.1979898f, -0.6788227f,   0.f, 0.f,   50, 50, 0, 255 },
+	{ 0.39f, -0.24f, -0.15f,   0.9095567f, -0.1057623f, 0.4018966f,   0.f, 0.f,   27, 27, 0, 255 },
+	{ 0.37f, -0.2600001f, -0.11f,   0.9095567f, -0.1057623f, 0.4018966f,   0.f, 0.f,   27, 27, 0, 255 },
+	{ 0.36f, -0.46f, -0.14f,   0.9095567f, -0.1057623f, 0.4018966f,   0.f, 0.f,   27, 27, 0, 255 },
+	{ 0.37f, -0.2600001f, -0.11f,   0.2628646f, -0.04381079f, 0.9638374f,   0.f, 0.f,   11, 11, 0, 255 },
+	{ 0.29f, -0.3f, -0.09000002f,   0.2628646f, -0.04381079f, 0.9638374f,   0.f, 0.f,   11, 11, 0, 255 },
+	{ 0.34f, -0.44f, -0.11f,   0.2628646f, -0.04381079f, 0.9638374f,   0.f, 0.f,   11, 11, 0, 255 },
+	{ 0.39f, -0.2f, -0.19f,   0.9801961f, -0.1400279f, -0.1400278f,   0.f, 0.f,   36, 36, 0, 255 },
+	{ 0.39f, -0.24f, -0.15f,   0.9801961f, -0.1400279f, -0.1400278f,   0.f, 0.f,   36, 36, 0, 255 },
+	{ 0.36f, -0.46f, -0.14f,   0.9801961f, -0.1400279f, -0.1400278f,   0.f, 0.f,   36, 36, 0, 255 },
+	{ 0.37f, -0.2600001f, -0.11f,   0.7826084f, -0.1304348f, 0.6086959f,   0.f, 0.f,   33, 33, 0, 255 },
+	{ 0.34f, -0.44f, -0.11f,   0.7826084f, -0.1304348f, 0.6086959f,   0.f, 0.f,   33, 33, 0, 255 },
+	{ 0.36f, -0.46f, -0.14f,   0.7826084f, -0.1304348f, 0.6086959f,   0.f, 0.f,   33, 33, 0, 255 },
+	{ 0.39f, -0.2f, -0.19f,   0.8581166f, -0.1906924f, -0.476731f,   0.f, 0.f,   49, 49, 0, 255 },
+	{ 0.36f, -0.46f, -0.14f,   0.8581166f, -0.1906924f, -0.476731f,   0.f, 0.f,   49, 49, 0, 255 },
+	{ 0.36f, -0.2600001f, -0.22f,   0.8581166f, -0.1906924f, -0.476731f,   0.f, 0.f,   49, 49, 0, 255 },
+	{ 0.48f, -0.01999998f, -0.11f,   0.8341708f, -0.01986121f, -0.5511485f,   0.f, 0.f,   5, 5, 0, 255 },
+	{ 0.4f, -0.05000007f, -0.23f,   0.8341708f, -0.01986121f, -0.5511485f,   0.f, 0.f,   5, 5, 0, 255 },
+	{ 0.43f, 0.1f, -0.19f,   0.8341708f, -0.01986121f, -0.5511485f,   0.f, 0.f,   5, 5, 0, 255 },
+	{ 0.43f, 0.1f, -0.19f,   0.9398229f, 0.2140707f, -0.2662831f,   0.f, 0.f,   55, 55, 0, 255 },
+	{ 0.46f, 0.13f, -0.06000002f,   0.9398229f, 0.2140707f, -0.2662831f,   0.f, 0.f,   55, 55, 0, 255 },
+	{ 0.48f, -0.01999998f, -0.11f,   0.9398229f, 0.2140707f, -0.2662831f,   0.f, 0.f,   55, 55, 0, 255 },
+	{ 0.45f, 0.f, -1.967013e-08f,   0.9658305f, 0.04361802f, 0.2554778f,   0.f, 0.f,   11, 11, 0, 255 },
+	{ 0.48f, -0.01999998f, -0.11f,   0.9658305f, 0.04361802f, 0.2554778f,   0.f, 0.f,   11, 11, 0, 255 },
+	{ 0.46f, 0.13f, -0.06000002f,   0.9658305f, 0.04361802f, 0.2554778f,   0.f, 0.f,   11, 11, 0, 255 },
+	{ 0.4f, -0.05000007f, -0.23f,   0.8430108f, -0.1903574f, -0.5030871f,   0.f, 0.f,   49, 49, 0, 255 },
+	{ 0.44f, -0.19f, -0.11f,   0.8430108f, -0.1903574f, -0.5030871f,   0.f, 0.f,   49, 49, 0, 255 },
+	{ 0.39f, -0.2f, -0.19f,   0.8430108f, -0.1903574f, -0.5030871f,   0.f, 0.f,   49, 49, 0, 255 },
+	{ 0.4f, -0.05000007f, -0.23f,   0.837756f, -0.197119f, -0.509224f,   0.f, 0.f,   50, 50, 0, 255 },
+	{ 0.48f, -0.01999998f, -0.11f,   0.837756f, -0.197119f, -0.509224f,   0.f, 0.f,   50, 50, 0, 255 },
+	{ 0.44f, -0.19f, -0.11f,   0.837756f, -0.197119f, -0.509224f,   0.f, 0.f,   50, 50, 0, 255 },
+	{ -0.51f, -0.24f, -0.06999998f,   0.08933105f, -0.7369817f, -0.6699836f,   0.f, 0.f,   188, 188, 0, 255 },
+	{ -0.39f, -0.18f, -0.12f,   0.08933105f, -0.7369817f, -0.6699836f,   0.f, 0.f,   188, 188, 0, 255 },
+	{ -0.39f, -0.28f, -0.009999983f,   0.08933105f, -0.7369817f, -0.6699836f,   0.f, 0.f,   188, 188, 0, 255 },
+	{ -0.3f, -0.34f, -0.02999999f,   -0.5294201f, -0.5913733f, -0.6082698f,   0.f, 0.f,   151, 151, 0, 255 },
+	{ -0.39f, -0.28f, -0.009999983f,   -0.5294201f, -0.5913733f, -0.6082698f,   0.f, 0.f,   151, 151, 0, 255 },
+	{ -0.24f, -0.2600001f, -0.16f,   -0.5294201f, -0.5913733f, -0.6082698f,   0.f, 0.f,   151, 151, 0, 255 },
+	{ -0.38f, -0.09000003f, -0.18f,   -0.2830911f, -0.3386983f, -0.8972976f,   0.f, 0.f,   86, 86, 0, 255 },
+	{ -0.13f, -0.14f, -0.24f,   -0.2830911f, -0.3386983f, -0.8972976f,   0.f, 0.f,   86, 86, 0, 255 },
+	{ -0.24f, -0.2600001f, -0.16f,   -0.2830911f, -0.3386983f, -0.8972976f,   0.f, 0.f,   86, 86, 0, 255 },
+	{ -0.39f, -0.18f, -0.12f,   -0.4496354f, -0.460341f, -0.7654503f,   0.f, 0.f,   117, 117, 0, 255 },
+	{ -0.38f, -0.09000003f, -0.18f,   -0.4496354f, -0.460341f, -0.7654503f,   0.f, 0.f,   117, 117, 0, 255 },
+	{ -0.24f, -0.2600001f, -0.16f,   -0.4496354f, -0.460341f, -0.7654503f,   0.f, 0.f,   117, 117, 0, 255 },
+	{ -0.3f, -0.34f, -0.02999999f,   -0.1292774f, -0.9228975f, -0.3626948f,   0.f, 0.f,   235, 235, 0, 255 },
+	{ -0.05000001f, -0.3200001f, -0.17f,   -0.1292774f, -0.9228975f, -0.3626948f,   0.f, 0.f,   235, 235, 0, 255 },
+	{ -0.17f, -0.37f, 7.430936e-09f,   -0.1292774f, -0.9228975f, -0.3626948f,   0.f, 0.f,   235, 235, 0, 255 },
+	{ 0.15f, -0.27f, -0.18f,   0.4093776f, -0.8931875f, -0.1860808f,   0.f, 0.f,   228, 228, 0, 255 },
+	{ 0.2f, -0.27f, -0.07000001f,   0.4093776f, -0.8931875f, -0.1860808f,   0.f, 0.f,   228, 228, 0, 255 },
+	{ 0.01999999f, -0.34f, -0.13f,   0.4093776f, -0.8931875f, -0.1860808f,   0.f, 0.f,   228, 228, 0, 255 },
+	{ 0.23f, -0.2600001f, -0.19f,   0.03832002f, -0.843042f, -0.5364808f,   0.f, 0.f,   215, 215, 0, 255 },
+	{ 0.21f, -0.28f, -0.16f,   0.03832002f, -0.843042f, -0.5364808f,   0.f, 0.f,   215, 215, 0, 255 },
+	{ 0.15f, -0.27f, -0.18f,   0.03832002f, -0.843042f, -0.5364808f,   0.f, 0.f,   215, 215, 0, 255 },
+	{ 0.21f, -0.28f, -0.16f,   -0.1920096f, -0.9775045f, 0.08727711f,   0.f, 0.f,   249, 249, 0, 255 },
+	{ 0.2f, -0.27f, -0.07000001f,   -0.1920096f, -0.9775045f, 0.08727711f,   0.f, 0.f,   249, 249, 0, 255 },
+	{ 0.15f, -0.27f, -0.18f,   -0.1920096f, -0.9775045f, 0.08727711f,   0.f, 0.f,   249, 249, 0, 255 },
+	{ 0.2f, -0.27f, -0.07000001f,   0.3464486f, -0.9365535f, 0.05329977f,   0.f, 0.f,   239, 239, 0, 255 },
+	{ 0.f, -0.34f, 0.f,   0.3464486f, -0.9365535f, 0.05329977f,   0.f, 0.f,   239, 239, 0, 255 },
+	{ 0.01999999f, -0.34f, -0.13f,   0.3464486f, -0.9365535f, 0.05329977f,   0.f, 0.f,   239, 239, 0, 255 },
+	{ 0.25f, -0.25f, -1.092785e-08f,   0.3385973f, -0.9405476f, 0.02687327f,   0.f, 0.f,   240, 240, 0, 255 },
+	{ 0.f, -0.34f, 0.f,   0.3385973f, -0.9405476f, 0.02687327f,   0.f, 0.f,   240, 240, 0, 255 },
+	{ 0.2f, -0.27f, -0.07000001f,   0.3385973f, -0.9405476f, 0.02687327f,   0.f, 0.f,   240, 240, 0, 255 },
+	{ 0.01999999f, -0.34f, -0.13f,   -0.07879848f, -0.9399543f, -0.3320794f,   0.f, 0.f,   240, 240, 0, 255 },
+	{ -0.17f, -0.37f, 7.430936e-09f,   -0.07879848f, -0.9399543f, -0.3320794f,   0.f, 0.f,   240, 240, 0, 255 },
+	{ -0.05000001f, -0.3200001f, -0.17f,   -0.07879848f, -0.9399543f, -0.3320794f,   0.f, 0.f,   240, 240, 0, 255 },
+	{ 0.01999999f, -0.34f, -0.13f,   0.1737231f, -0.9844317f, 0.02672662f,   0.f, 0.f,   251, 251, 0, 255 },
+	{ 0.f, -0.34f, 0.f,   0.1737231f, -0.9844317f, 0.02672662f,   0.f, 0.f,   251, 251, 0, 255 },
+	{ -0.17f, -0.37f, 7.430936e-09f,   0.1737231f, -0.9844317f, 0.02672662f,   0.f, 0.f,   251, 251, 0, 255 },
+	{ -0.13f, -0.14f, -0.24f,   -0.07225225f, -0.3892297f, -0.9183027f,   0.f, 0.f,   99, 99, 0, 255 },
+	{ 0.12f, -0.21f, -0.23f,   -0.07225225f, -0.3892297f, -0.9183027f,   0.f, 0.f,   99, 99, 0, 255 },
+	{ -0.05000001f, -0.3200001f, -0.17f,   -0.07225225f, -0.3892297f, -0.9183027f,   0.f, 0.f,   99, 99, 0, 255 },
+	{ 0.11f, -0.07000005f, -0.25f,   -0.02320339f, -0.06298059f, -0.997745f,   0.f, 0.f,   16, 16, 0, 255 },
+	{ -0.13f, -0.14f, -0.24f,   -0.02320339f, -0.06298059f, -0.997745f,   0.f, 0.f,   16, 16, 0, 255 },
+	{ -0.08000001f, 0.f, -0.25f,   -0.02320339f, -0.06298059f, -0.997745f,   0.f, 0.f,   16, 16, 0, 255 },
+	{ -0.13f, -0.14f, -0.24f,   -3.023929e-08f, -0.1414213f, -0.9899495f,   0.f, 0.f,   36, 36, 0, 255 },
+	{ 0.11f, -0.07000005f, -0.25f,   -3.023929e-08f, -0.1414213f, -0.9899495f,   0.f, 0.f,   36, 36, 0, 255 },
+	{ 0.12f, -0.21f, -0.23f,   -3.023929e-08f, -0.1414213f, -0.9899495f,   0.f, 0.f,   36, 36, 0, 255 },
+	{ -0.24f, -0.2600001f, -0.16f,   -0.2708464f, -0.7589996f, -0.5920826f,   0.f, 0.f,   194, 194, 0, 255 },
+	{ -0.05000001f, -0.3200001f, -0.17f,   -0.2708464f, -0.7589996f, -0.5920826f,   0.f, 0.f,   194, 194, 0, 255 },
+	{ -0.3f, -0.34f, -0.02999999f,   -0.2708464f, -0.7589996f, -0.5920826f,   0.f, 0.f,   194, 194, 0, 255 },
+	{ -0.39f, -0.28f, -0.009999983f,   -0.4978286f, -0.6417317f, -0.5833927f,   0.f, 0.f,   164, 164, 0, 255 },
+	{ -0.39f, -0.18f, -0.12f,   -0.4978286f, -0.6417317f, -0.5833927f,   0.f, 0.f,   164, 164, 0, 255 },
+	{ -0.24f, -0.2600001f, -0.16f,   -0.4978286f, -0.6417317f, -0.5833927f,   0.f, 0.f,   164, 164, 0, 255 },
+	{ 0.15f, -0.27f, -0.18f,   0.1548162f, -0.7482783f, -0.6450671f,   0.f, 0.f,   191, 191, 0, 255 },
+	{ 0.01999999f, -0.34f, -0.13f,   0.1548162f, -0.7482783f, -0.6450671f,   0.f, 0.f,   191, 191, 0, 255 },
+	{ -0.05000001f, -0.3200001f, -0.17f,   0.1548162f, -0.7482783f, -0.6450671f,   0.f, 0.f,   191, 191, 0, 255 },
+	{ -0.05000001f, -0.3200001f, -0.17f,   0.1111986f, -0.6028135f, -0.7900954f,   0.f, 0.f,   154, 154, 0, 255 },
+	{ 0.12f, -0.21f, -0.23f,   0.1111986f, -0.6028135f, -0.7900954f,   0.f, 0.f,   154, 154, 0, 255 },
+	{ 0.15f, -0.27f, -0.18f,   0.1111986f, -0.6028135f, -0.7900954f,   0.f, 0.f,   154, 154, 0, 255 },
+	{ 0.83f, 0.36f, -0.06000004f,   -0.1144071f, -0.9839019f, 0.1372884f,   0.f, 0.f,   251, 251, 0, 255 },
+	{ 0.78f, 0.37f, -0.03000003f,   -0.1144071f, -0.9839019f, 0.1372884f,   0.f, 0.f,   251, 251, 0, 255 },
+	{ 0.72f, 0.37f, -0.08000003f,   -0.1144071f, -0.9839019f, 0.1372884f,   0.f, 0.f,   251, 251, 0, 255 },
+	{ 0.78f, 0.37f, -0.03000003f,   -0.3706247f, -0.8153744f, 0.4447493f,   0.f, 0.f,   208, 208, 0, 255 },
+	{ 0.75f, 0.4f, -3.278354e-08f,   -0.3706247f, -0.8153744f, 0.4447493f,   0.f, 0.f,   208, 208, 0, 255 },
+	{ 0.72f, 0.37f, -0.08000003f,   -0.3706247f, -0.8153744f, 0.4447493f,   0.f, 0.f,   208, 208, 0, 255 },
+	{ 0.91f, 0.37f, -0.06000004f,   0.08108089f, -0.6486484f, -0.756757f,   0.f, 0.f,   165, 165, 0, 255 },
+	{ 0.91f, 0.3f, -3.977737e-08f,   0.08108089f, -0.6486484f, -0.756757f,   0.f, 0.f,   165, 165, 0, 255 },
+	{ 0.83f, 0.36f, -0.06000004f,   0.08108089f, -0.6486484f, -0.756757f,   0.f, 0.f,   165, 165, 0, 255 },
+	{ 0.91f, 0.3f, -3.977737e-08f,   -0.4528394f, -0.8553627f, -0.2515775f,   0.f, 0.f,   218, 218, 0, 255 },
+	{ 0.78f, 0.36f, 0.02999997f,   -0.4528394f, -0.8553627f, -0.2515775f,   0.f, 0.f,   218, 218, 0, 255 },
+	{ 0.83f, 0.36f, -0.06000004f,   -0.4528394f, -0.8553627f, -0.2515775f,   0.f, 0.f,   218, 218, 0, 255 },
+	{ 0.83f, 0.36f, -0.06000004f,   -0.2837547f, -0.9458501f, -0.1576415f,   0.f, 0.f,   241, 241, 0, 255 },
+	{ 0.78f, 0.36f, 0.02999997f,   -0.2837547f, -0.9458501f, -0.1576415f,   0.f, 0.f,   241, 241, 0, 255 },
+	{ 0.78f, 0.37f, -0.03000003f,   -0.2837547f, -0.9458501f, -0.1576415f,   0.f, 0.f,   241, 241, 0, 255 },
+	{ 0.96f, 0.25f, -0.03000004f,   -0.4454352f, 0.08908779f, -0.8908707f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ 0.91f, 0.3f, -3.977737e-08f,   -0.4454352f, 0.08908779f, -0.8908707f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ 1.f, 0.25f, -0.05000005f,   -0.4454352f, 0.08908779f, -0.8908707f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ 1.f, 0.25f, -0.05000005f,   -0.6166749f, -0.5123144f, -0.5977006f,   0.f, 0.f,   131, 131, 0, 255 },
+	{ 0.91f, 0.3f, -3.977737e-08f,   -0.6166749f, -0.5123144f, -0.5977006f,   0.f, 0.f,   131, 131, 0, 255 },
+	{ 0.91f, 0.37f, -0.06000004f,   -0.6166749f, -0.5123144f, -0.5977006f,   0.f, 0.f,   131, 131, 0, 255 },
+	{ 0.93f, 0.4599999f, -0.05000004f,   0.3572398f, 0.02435734f, -0.9336951f,   0.f, 0.f,   6, 6, 0, 255 },
+	{ 0.91f, 0.37f, -0.06000004f,   0.3572398f, 0.02435734f, -0.9336951f,   0.f, 0.f,   6, 6, 0, 255 },
+	{ 0.8f, 0.4499999f, -0.1f,   0.3572398f, 0.02435734f, -0.9336951f,   0.f, 0.f,   6, 6, 0, 255 },
+	{ 0.81f, 0.51f, -0.11f,   0.2690693f, -0.2018016f, -0.9417419f,   0.f, 0.f,   51, 51, 0, 255 },
+	{ 0.9f, 0.49f, -0.08000004f,   0.2690693f, -0.2018016f, -0.9417419f,   0.f, 0.f,   51, 51, 0, 255 },
+	{ 0.8f, 0.4499999f, -0.1f,   0.2690693f, -0.2018016f, -0.9417419f,   0.f, 0.f,   51, 51, 0, 255 },
+	{ 0.8f, 0.4499999f, -0.1f,   0.348743f, -0.4649892f, -0.8137341f,   0.f, 0.f,   119, 119, 0, 255 },
+	{ 0.9f, 0.49f, -0.08000004f,   0.348743f, -0.4649892f, -0.8137341f,   0.f, 0.f,   119, 119, 0, 255 },
+	{ 0.93f, 0.4599999f, -0.05000004f,   0.348743f, -0.4649892f, -0.8137341f,   0.f, 0.f,   119, 119, 0, 255 },
+	{ 0.91f, 0.37f, -0.06000004f,   0.1792792f, -0.2315693f, -0.9561561f,   0.f, 0.f,   59, 59, 0, 255 },
+	{ 0.75f, 0.37f, -0.09000003f,   0.1792792f, -0.2315693f, -0.9561561f,   0.f, 0.f,   59, 59, 0, 255 },
+	{ 0.8f, 0.4499999f, -0.1f,   0.1792792f, -0.2315693f, -0.9561561f,   0.f, 0.f,   59, 59, 0, 255 },
+	{ 0.91f, 0.37f, -0.06000004f,   0.1034481f, -0.8275866f, -0.5517236f,   0.f, 0.f,   211, 211, 0, 255 },
+	{ 0.83f, 0.36f, -0.06000004f,   0.1034481f, -0.8275866f, -0.5517236f,   0.f, 0.f,   211, 211, 0, 255 },
+	{ 0.75f, 0.37f, -0.09000003f,   0.1034481f, -0.8275866f, -0.5517236f,   0.f, 0.f,   211, 211, 0, 255 },
+	{ 0.83f, 0.36f, -0.06000004f,   -0.0578315f, -0.9831354f, -0.1734942f,   0.f, 0.f,   251, 251, 0, 255 },
+	{ 0.72f, 0.37f, -0.08000003f,   -0.0578315f, -0.9831354f, -0.1734942f,   0.f, 0.f,   251, 251, 0, 255 },
+	{ 0.75f, 0.37f, -0.09000003f,   -0.0578315f, -0.9831354f, -0.1734942f,   0.f, 0.f,   251, 251, 0, 255 },
+	{ 0.46f, 0.13f, -0.06000002f,   0.6639669f, -0.2226015f, -0.7138603f,   0.f, 0.f,   57, 57, 0, 255 },
+	{ 0.38f, 0.1799999f, -0.15f,   0.6639669f, -0.2226015f, -0.7138603f,   0.f, 0.f,   57, 57, 0, 255 },
+	{ 0.48f, 0.35f, -0.11f,   0.6639669f, -0.2226015f, -0.7138603f,   0.f, 0.f,   57, 57, 0, 255 },
+	{ 0.51f, 0.1999999f, -2.229281e-08f,   0.8513983f, -0.1886331f, -0.4894267f,   0.f, 0.f,   48, 48, 0, 255 },
+	{ 0.46f, 0.13f, -0.06000002f,   0.8513983f, -0.1886331f, -0.4894267f,   0.f, 0.f,   48, 48, 0, 255 },
+	{ 0.48f, 0.35f, -0.11f,   0.8513983f, -0.1886331f, -0.4894267f,   0.f, 0.f,   48, 48, 0, 255 },
+	{ -0.79f, 0.1999999f, -0.01999996f,   -0.4594935f, 0.7323162f, -0.502572f,   0.f, 0.f,   187, 187, 0, 255 },
+	{ -0.78f, 0.22f, 3.409488e-08f,   -0.4594935f, 0.7323162f, -0.502572f,   0.f, 0.f,   187, 187, 0, 255 },
+	{ -0.58f, 0.27f, -0.11f,   -0.4594935f, 0.7323162f, -0.502572f,   0.f, 0.f,   187, 187, 0, 255 },
+	{ -0.61f, 0.22f, -0.2f,   -0.3920257f, 0.8534366f, -0.3434556f,   0.f, 0.f,   218, 218, 0, 255 },
+	{ -0.85f, 0.15f, -0.09999996f,   -0.3920257f, 0.8534366f, -0.3434556f,   0.f, 0.f,   218, 218, 0, 255 },
+	{ -0.58f, 0.27f, -0.11f,   -0.3920257f, 0.8534366f, -0.3434556f,   0.f, 0.f,   218, 218, 0, 255 },
+	{ 0.15f, 0.27f, -0.11f,   -0.4250187f, 0.6317399f, -0.6482777f,   0.f, 0.f,   161, 161, 0, 255 },
+	{ 0.31f, 0.47f, -0.02000001f,   -0.4250187f, 0.6317399f, -0.6482777f,   0.f, 0.f,   161, 161, 0, 255 },
+	{ 0.61f, 0.6f, -0.09000003f,   -0.4250187f, 0.6317399f, -0.6482777f,   0.f, 0.f,   161, 161, 0, 255 },
+	{ 0.37f, 0.55f, -1.617321e-08f,   -0.5323782f, 0.558348f, -0.6362555f,   0.f, 0.f,   142, 142, 0, 255 },
+	{ 0.31f, 0.47f, -0.02000001f,   -0.5323782f, 0.558348f, -0.6362555f,   0.f, 0.f,   142, 142, 0, 255 },
+	{ 0.06f, 0.3f, 0.04f,   -0.5323782f, 0.558348f, -0.6362555f,   0.f, 0.f,   142, 142, 0, 255 },
+	{ 0.32f, 0.26f, -0.14f,   0.1973902f, -0.024241f, -0.9800252f,   0.f, 0.f,   6, 6, 0, 255 },
+	{ 0.61f, 0.6f, -0.09000003f,   0.1973902f, -0.024241f, -0.9800252f,   0.f, 0.f,   6, 6, 0, 255 },
+	{ 0.48f, 0.35f, -0.11f,   0.1973902f, -0.024241f, -0.9800252f,   0.f, 0.f,   6, 6, 0, 255 },
+	{ 0.61f, 0.6f, -0.09000003f,   -0.1519634f, 0.2694608f, -0.9509459f,   0.f, 0.f,   69, 69, 0, 255 },
+	{ 0.32f, 0.26f, -0.14f,   -0.1519634f, 0.2694608f, -0.9509459f,   0.f, 0.f,   69, 69, 0, 255 },
+	{ 0.15f, 0.27f, -0.11f,   -0.1519634f, 0.2694608f, -0.9509459f,   0.f, 0.f,   69, 69, 0, 255 },
+	{ -0.85f, 0.15f, -0.09999996f,   -0.4009515f, 0.8812995f, -0.250098f,   0.f, 0.f,   225, 225, 0, 255 },
+	{ -0.79f, 0.1999999f, -0.01999996f,   -0.4009515f, 0.8812995f, -0.250098f,   0.f, 0.f,   225, 225, 0, 255 },
+	{ -0.58f, 0.27f, -0.11f,   -0.4009515f, 0.8812995f, -0.250098f,   0.f, 0.f,   225, 225, 0, 255 },
+	{ -0.33f, 0.25f, -0.11f,   0.06897102f, 0.8621387f, -0.5019559f,   0.f, 0.f,   220, 220, 0, 255 },
+	{ -0.61f, 0.22f, -0.2f,   0.06897102f, 0.8621387f, -0.5019559f,   0.f, 0.f,   220, 220, 0, 255 },
+	{ -0.58f, 0.27f, -0.11f,   0.06897102f, 0.8621387f, -0.5019559f,   0.f, 0.f,   220, 220, 0, 255 },
+	{ -0.58f, 0.27f, -0.11f,   -0.06684363f, 0.9965785f, -0.04861356f,   0.f, 0.f,   254, 254, 0, 255 },
+	{ -0.54f, 0.28f, 0.04000002f,   -0.06684363f, 0.9965785f, -0.04861356f,   0.f, 0.f,   254, 254, 0, 255 },
+	{ -0.46f, 0.28f, -0.06999998f,   -0.06684363f, 0.9965785f, -0.04861356f,   0.f, 0.f,   254, 254, 0, 255 },
+	{ -0.58f, 0.27f, -0.11f,   -0.2425355f, 0.9701425f, -5.252999e-08f,   0.f, 0.f,   247, 247, 0, 255 },
+	{ -0.78f, 0.22f, 3.409488e-08f,   -0.2425355f, 0.9701425f, -5.252999e-08f,   0.f, 0.f,   247, 247, 0, 255 },
+	{ -0.54f, 0.28f, 0.04000002f,   -0.2425355f, 0.9701425f, -5.252999e-08f,   0.f, 0.f,   247, 247, 0, 255 },
+	{ 0.96f, 0.25f, -0.03000004f,   -0.7552634f, -0.5035089f, -0.4195903f,   0.f, 0.f,   128, 128, 0, 255 },
+	{ 0.95f, 0.24f, -4.152582e-08f,   -0.7552634f, -0.5035089f, -0.4195903f,   0.f, 0.f,   128, 128, 0, 255 },
+	{ 0.91f, 0.3f, -3.977737e-08f,   -0.7552634f, -0.5035089f, -0.4195903f,   0.f, 0.f,   128, 128, 0, 255 },
+	{ 0.85f, 0.67f, 0.03999996f,   0.6777896f, 0.7201516f, -0.1482668f,   0.f, 0.f,   184, 184, 0, 255 },
+	{ 0.93f, 0.5699999f, -0.08000004f,   0.6777896f, 0.7201516f, -0.1482668f,   0.f, 0.f,   184, 184, 0, 255 },
+	{ 0.79f, 0.7099999f, -0.04000003f,   0.6777896f, 0.7201516f, -0.1482668f,   0.f, 0.f,   184, 184, 0, 255 },
+	{ 0.79f, 0.7099999f, -0.04000003f,   0.232106f, 0.9284142f, 0.2901272f,   0.f, 0.f,   237, 237, 0, 255 },
+	{ 0.75f, 0.72f, -0.04000003f,   0.232106f, 0.9284142f, 0.2901272f,   0.f, 0.f,   237, 237, 0, 255 },
+	{ 0.85f, 0.67f, 0.03999996f,   0.232106f, 0.9284142f, 0.2901272f,   0.f, 0.f,   237, 237, 0, 255 },
+	{ 0.93f, 0.5699999f, -0.08000004f,   0.76114f, 0.6477785f, -0.03238897f,   0.f, 0.f,   165, 165, 0, 255 },
+	{ 0.85f, 0.67f, 0.03999996f,   0.76114f, 0.6477785f, -0.03238897f,   0.f, 0.f,   165, 165, 0, 255 },
+	{ 0.95f, 0.55f, -0.01000004f,   0.76114f, 0.6477785f, -0.03238897f,   0.f, 0.f,   165, 165, 0, 255 },
+	{ 1.09f, 0.36f, -0.04000005f,   0.7001389f, -0.140028f, -0.7001411f,   0.f, 0.f,   36, 36, 0, 255 },
+	{ 1.09f, 0.3099999f, -0.03000005f,   0.7001389f, -0.140028f, -0.7001411f,   0.f, 0.f,   36, 36, 0, 255 },
+	{ 1.06f, 0.3099999f, -0.06000004f,   0.7001389f, -0.140028f, -0.7001411f,   0.f, 0.f,   36, 36, 0, 255 },
+	{ 0.67f, 0.61f, -0.09000003f,   -0.3168845f, 0.414388f, -0.8531511f,   0.f, 0.f,   106, 106, 0, 255 },
+	{ 0.64f, 0.6899999f, -0.04000003f,   -0.3168845f, 0.414388f, -0.8531511f,   0.f, 0.f,   106, 106, 0, 255 },
+	{ 0.72f, 0.7099999f, -0.06000003f,   -0.3168845f, 0.414388f, -0.8531511f,   0.f, 0.f,   106, 106, 0, 255 },
+	{ 0.72f, 0.7099999f, -0.06000003f,   -0.2196927f, 0.3794695f, -0.8987425f,   0.f, 0.f,   97, 97, 0, 255 },
+	{ 0.75f, 0.6799999f, -0.08000003f,   -0.2196927f, 0.3794695f, -0.8987425f,   0.f, 0.f,   97, 97, 0, 255 },
+	{ 0.67f, 0.61f, -0.09000003f,   -0.2196927f, 0.3794695f, -0.8987425f,   0.f, 0.f,   97, 97, 0, 255 },
+	{ 0.81f, 0.51f, -0.11f,   0.05494176f, 0.1922968f, -0.9797976f,   0.f, 0.f,   49, 49, 0, 255 },
+	{ 0.75f, 0.6799999f, -0.08000003f,   0.05494176f, 0.1922968f, -0.9797976f,   0.f, 0.f,   49, 49, 0, 255 },
+	{ 0.82f, 0.66f, -0.08000004f,   0.05494176f, 0.1922968f, -0.9797976f,   0.f, 0.f,   49, 49, 0, 255 },
+	{ 0.81f, 0.51f, -0.11f,   -0.02215386f, 0.1661547f, -0.9858508f,   0.f, 0.f,   42, 42, 0, 255 },
+	{ 0.67f, 0.61f, -0.09000003f,   -0.02215386f, 0.1661547f, -0.9858508f,   0.f, 0.f,   42, 42, 0, 255 },
+	{ 0.75f, 0.6799999f, -0.08000003f,   -0.02215386f, 0.1661547f, -0.9858508f,   0.f, 0.f,   42, 42, 0, 255 },
+	{ 0.72f, 0.7099999f, -0.06000003f,   -0.3292927f, 0.7683472f, -0.548825f,   0.f, 0.f,   196, 196, 0, 255 },
+	{ 0.64f, 0.6899999f, -0.04000003f,   -0.3292927f, 0.7683472f, -0.548825f,   0.f, 0.f,   196, 196, 0, 255 },
+	{ 0.71f, 0.72f, -0.04000003f,   -0.3292927f, 0.7683472f, -0.548825f,   0.f, 0.f,   196, 196, 0, 255 },
+	{ 0.61f, 0.51f, -0.1f,   -0.04952197f, 0.128757f, -0.9904389f,   0.f, 0.f,   33, 33, 0, 255 },
+	{ 0.67f, 0.61f, -0.09000003f,   -0.04952197f, 0.128757f, -0.9904389f,   0.f, 0.f,   33, 33, 0, 255 },
+	{ 0.81f, 0.51f, -0.11f,   -0.04952197f, 0.128757f, -0.9904389f,   0.f, 0.f,   33, 33, 0, 255 },
+	{ 0.61f, 0.51f, -0.1f,   -0.04932473f, -0.1561947f, -0.9864939f,   0.f, 0.f,   40, 40, 0, 255 },
+	{ 0.81f, 0.51f, -0.11f,   -0.04932473f, -0.1561947f, -0.9864939f,   0.f, 0.f,   40, 40, 0, 255 },
+	{ 0.8f, 0.4499999f, -0.1f,   -0.04932473f, -0.1561947f, -0.9864939f,   0.f, 0.f,   40, 40, 0, 255 },
+	{ 0.85f, 0.5599999f, -0.12f,   0.0374503f, -0.224702f, -0.9737077f,   0.f, 0.f,   57, 57, 0, 255 },
+	{ 0.87f, 0.52f, -0.11f,   0.0374503f, -0.224702f, -0.9737077f,   0.f, 0.f,   57, 57, 0, 255 },
+	{ 0.81f, 0.51f, -0.11f,   0.0374503f, -0.224702f, -0.9737077f,   0.f, 0.f,   57, 57, 0, 255 },
+	{ 0.85f, 0.5599999f, -0.12f,   0.08720419f, 0.3924186f, -0.9156435f,   0.f, 0.f,   100, 100, 0, 255 },
+	{ 0.82f, 0.66f, -0.08000004f,   0.08720419f, 0.3924186f, -0.9156435f,   0.f, 0.f,   100, 100, 0, 255 },
+	{ 0.91f, 0.5699999f, -0.11f,   0.08720419f, 0.3924186f, -0.9156435f,   0.f, 0.f,   100, 100, 0, 255 },
+	{ 0.82f, 0.66f, -0.08000004f,   -0.4688641f, 0.2031746f, -0.8595851f,   0.f, 0.f,   52, 52, 0, 255 },
+	{ 0.85f, 0.5599999f, -0.12f,   -0.4688641f, 0.2031746f, -0.8595851f,   0.f, 0.f,   52, 52, 0, 255 },
+	{ 0.81f, 0.51f, -0.11f,   -0.4688641f, 0.2031746f, -0.8595851f,   0.f, 0.f,   52, 52, 0, 255 },
+	{ 0.87f, 0.52f, -0.11f,   0.4082481f, -0.408249f, -0.8164963f,   0.f, 0.f,   104, 104, 0, 255 },
+	{ 0.92f, 0.53f, -0.09000004f,   0.4082481f, -0.408249f, -0.8164963f,   0.f, 0.f,   104, 104, 0, 255 },
+	{ 0.9f, 0.49f, -0.08000004f,   0.4082481f, -0.408249f, -0.8164963f,   0.f, 0.f,   104, 104, 0, 255 },
+	{ 0.81f, 0.51f, -0.11f,   0.1078327f, -0.6469971f, -0.7548291f,   0.f, 0.f,   165, 165, 0, 255 },
+	{ 0.87f, 0.52f, -0.11f,   0.1078327f, -0.6469971f, -0.7548291f,   0.f, 0.f,   165, 165, 0, 255 },
+	{ 0.9f, 0.49f, -0.08000004f,   0.1078327f, -0.6469971f, -0.7548291f,   0.f, 0.f,   165, 165, 0, 255 },
+	{ 0.79f, 0.7099999f, -0.04000003f,   0.1946591f, 0.6813079f, -0.7056398f,   0.f, 0.f,   174, 174, 0, 255 },
+	{ 0.82f, 0.66f, -0.08000004f,   0.1946591f, 0.6813079f, -0.7056398f,   0.f, 0.f,   174, 174, 0, 255 },
+	{ 0.75f, 0.6799999f, -0.08000003f,   0.1946591f, 0.6813079f, -0.7056398f,   0.f, 0.f,   174, 174, 0, 255 },
+	{ 0.93f, 0.5699999f, -0.08000004f,   0.8300576f, -0.06917139f, -0.5533712f,   0.f, 0.f,   18, 18, 0, 255 },
+	{ 0.92f, 0.53f, -0.09000004f,   0.8300576f, -0.06917139f, -0.5533712f,   0.f, 0.f,   18, 18, 0, 255 },
+	{ 0.91f, 0.5699999f, -0.11f,   0.8300576f, -0.06917139f, -0.5533712f,   0.f, 0.f,   18, 18, 0, 255 },
+	{ 0.75f, 0.37f, -0.09000003f,   -0.03277134f, -0.1037757f, -0.9940607f,   0.f, 0.f,   26, 26, 0, 255 },
+	{ 0.61f, 0.51f, -0.1f,   -0.03277134f, -0.1037757f, -0.9940607f,   0.f, 0.f,   26, 26, 0, 255 },
+	{ 0.8f, 0.4499999f, -0.1f,   -0.03277134f, -0.1037757f, -0.9940607f,   0.f, 0.f,   26, 26, 0, 255 },
+	{ 1.f, 0.25f, -0.05000005f,   -0.408248f, -0.4082492f, -0.8164963f,   0.f, 0.f,   104, 104, 0, 255 },
+	{ 0.99f, 0.24f, -0.04000004f,   -0.408248f, -0.4082492f, -0.8164963f,   0.f, 0.f,   104, 104, 0, 255 },
+	{ 0.96f, 0.25f, -0.03000004f,   -0.408248f, -0.4082492f, -0.8164963f,   0.f, 0.f,   104, 104, 0, 255 },
+	{ 1.f, 0.4f, -0.05000005f,   0.1104315f, 0.f, -0.9938837f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 1.f, 0.25f, -0.05000005f,   0.1104315f, 0.f, -0.9938837f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.91f, 0.37f, -0.06000004f,   0.1104315f, 0.f, -0.9938837f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.65f, 0.41f, 0.009999971f,   -0.07474341f, -0.9716656f, 0.2242303f,   0.f, 0.f,   248, 248, 0, 255 },
+	{ 0.64f, 0.39f, -0.08000003f,   -0.07474341f, -0.9716656f, 0.2242303f,   0.f, 0.f,   248, 248, 0, 255 },
+	{ 0.75f, 0.4f, -3.278354e-08f,   -0.07474341f, -0.9716656f, 0.2242303f,   0.f, 0.f,   248, 248, 0, 255 },
+	{ 0.64f, 0.39f, -0.08000003f,   -0.123601f, -0.1931265f, -0.9733576f,   0.f, 0.f,   49, 49, 0, 255 },
+	{ 0.61f, 0.51f, -0.1f,   -0.123601f, -0.1931265f, -0.9733576f,   0.f, 0.f,   49, 49, 0, 255 },
+	{ 0.75f, 0.37f, -0.09000003f,   -0.123601f, -0.1931265f, -0.9733576f,   0.f, 0.f,   49, 49, 0, 255 },
+	{ 0.72f, 0.37f, -0.08000003f,   -0.1961161f, -0.7844654f, -0.5883474f,   0.f, 0.f,   200, 200, 0, 255 },
+	{ 0.64f, 0.39f, -0.08000003f,   -0.1961161f, -0.7844654f, -0.5883474f,   0.f, 0.f,   200, 200, 0, 255 },
+	{ 0.75f, 0.37f, -0.09000003f,   -0.1961161f, -0.7844654f, -0.5883474f,   0.f, 0.f,   200, 200, 0, 255 },
+	{ 0.64f, 0.39f, -0.08000003f,   -0.2207787f, -0.8831159f, 0.4139601f,   0.f, 0.f,   225, 225, 0, 255 },
+	{ 0.72f, 0.37f, -0.08000003f,   -0.2207787f, -0.8831159f, 0.4139601f,   0.f, 0.f,   225, 225, 0, 255 },
+	{ 0.75f, 0.4f, -3.278354e-08f,   -0.2207787f, -0.8831159f, 0.4139601f,   0.f, 0.f,   225, 225, 0, 255 },
+	{ 1.02f, 0.23f, 0.009999955f,   0.8574932f, 0.f, -0.5144954f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 1.02f, 0.22f, 0.009999955f,   0.8574932f, 0.f, -0.5144954f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.99f, 0.24f, -0.04000004f,   0.8574932f, 0.f, -0.5144954f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 1.f, 0.25f, -0.05000005f,   0.4082483f, -0.8164967f, -0.4082479f,   0.f, 0.f,   208, 208, 0, 255 },
+	{ 1.02f, 0.23f, 0.009999955f,   0.4082483f, -0.8164967f, -0.4082479f,   0.f, 0.f,   208, 208, 0, 255 },
+	{ 0.99f, 0.24f, -0.04000004f,   0.4082483f, -0.8164967f, -0.4082479f,   0.f, 0.f,   208, 208, 0, 255 },
+	{ 0.99f, 0.24f, -0.04000004f,   -0.2357021f, -0.9428091f, -0.2357022f,   0.f, 0.f,   240, 240, 0, 255 },
+	{ 1.02f, 0.22f, 0.009999955f,   -0.2357021f, -0.9428091f, -0.2357022f,   0.f, 0.f,   240, 240, 0, 255 },
+	{ 0.95f, 0.24f, -4.152582e-08f,   -0.2357021f, -0.9428091f, -0.2357022f,   0.f, 0.f,   240, 240, 0, 255 },
+	{ 0.96f, 0.25f, -0.03000004f,   -0.4082477f, -0.8164971f, -0.4082478f,   0.f, 0.f,   208, 208, 0, 255 },
+	{ 0.99f, 0.24f, -0.04000004f,   -0.4082477f, -0.8164971f, -0.4082478f,   0.f, 0.f,   208, 208, 0, 255 },
+	{ 0.95f, 0.24f, -4.152582e-08f,   -0.4082477f, -0.8164971f, -0.4082478f,   0.f, 0.f,   208, 208, 0, 255 },
+	{ 0.31f, -0.29f, -0.22f,   -0.3848839f, -0.1099669f, -0.9163906f,   0.f, 0.f,   28, 28, 0, 255 },
+	{ 0.25f, -0.33f, -0.19f,   -0.3848839f, -0.1099669f, -0.9163906f,   0.f, 0.f,   28, 28, 0, 255 },
+	{ 0.23f, -0.2600001f, -0.19f,   -0.3848839f, -0.1099669f, -0.9163906f,   0.f, 0.f,   28, 28, 0, 255 },
+	{ 0.31f, -0.29f, -0.22f,   -0.4285713f, -0.2857143f, -0.8571429f,   0.f, 0.f,   73, 73, 0, 255 },
+	{ 0.23f, -0.2600001f, -0.19f,   -0.4285713f, -0.2857143f, -0.8571429f,   0.f, 0.f,   73, 73, 0, 255 },
+	{ 0.25f, -0.17f, -0.23f,   -0.4285713f, -0.2857143f, -0.8571429f,   0.f, 0.f,   73, 73, 0, 255 },
+	{ 0.25f, -0.29f, -0.09000001f,   -0.546793f, -0.168244f, 0.8201898f,   0.f, 0.f,   43, 43, 0, 255 },
+	{ 0.22f, -0.29f, -0.11f,   -0.546793f, -0.168244f, 0.8201898f,   0.f, 0.f,   43, 43, 0, 255 },
+	{ 0.26f, -0.42f, -0.11f,   -0.546793f, -0.168244f, 0.8201898f,   0.f, 0.f,   43, 43, 0, 255 },
+	{ 0.39f, -0.24f, -0.15f,   0.8700629f, 0.09667408f, 0.4833681f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ 0.34f, -0.24f, -0.06000001f,   0.8700629f, 0.09667408f, 0.4833681f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ 0.37f, -0.2600001f, -0.11f,   0.8700629f, 0.09667408f, 0.4833681f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ 0.39f, -0.24f, -0.15f,   0.648643f, -0.7503908f, 0.1271847f,   0.f, 0.f,   191, 191, 0, 255 },
+	{ 0.44f, -0.19f, -0.11f,   0.648643f, -0.7503908f, 0.1271847f,   0.f, 0.f,   191, 191, 0, 255 },
+	{ 0.43f, -0.18f, -1.87959e-08f,   0.648643f, -0.7503908f, 0.1271847f,   0.f, 0.f,   191, 191, 0, 255 },
+	{ 0.34f, -0.24f, -0.06000001f,   0.4250915f, -0.8737991f, 0.2361619f,   0.f, 0.f,   223, 223, 0, 255 },
+	{ 0.39f, -0.24f, -0.15f,   0.4250915f, -0.8737991f, 0.2361619f,   0.f, 0.f,   223, 223, 0, 255 },
+	{ 0.43f, -0.18f, -1.87959e-08f,   0.4250915f, -0.8737991f, 0.2361619f,   0.f, 0.f,   223, 223, 0, 255 },
+	{ 0.23f, -0.2600001f, -0.19f,   -0.7419987f, -0.2119996f, -0.6359986f,   0.f, 0.f,   54, 54, 0, 255 },
+	{ 0.25f, -0.33f, -0.19f,   -0.7419987f, -0.2119996f, -0.6359986f,   0.f, 0.f,   54, 54, 0, 255 },
+	{ 0.21f, -0.28f, -0.16f,   -0.7419987f, -0.2119996f, -0.6359986f,   0.f, 0.f,   54, 54, 0, 255 },
+	{ 0.25f, -0.33f, -0.19f,   -0.8055347f, -0.3637899f, -0.4677294f,   0.f, 0.f,   93, 93, 0, 255 },
+	{ 0.23f, -0.35f, -0.14f,   -0.8055347f, -0.3637899f, -0.4677294f,   0.f, 0.f,   93, 93, 0, 255 },
+	{ 0.21f, -0.28f, -0.16f,   -0.8055347f, -0.3637899f, -0.4677294f,   0.f, 0.f,   93, 93, 0, 255 },
+	{ 0.21f, -0.28f, -0.16f,   -0.9614823f, -0.2330868f, 0.1456793f,   0.f, 0.f,   59, 59, 0, 255 },
+	{ 0.23f, -0.35f, -0.14f,   -0.9614823f, -0.2330868f, 0.1456793f,   0.f, 0.f,   59, 59, 0, 255 },
+	{ 0.22f, -0.29f, -0.11f,   -0.9614823f, -0.2330868f, 0.1456793f,   0.f, 0.f,   59, 59, 0, 255 },
+	{ -0.43f, -0.06000006f, -0.22f,   0.4169983f, -0.3958845f, -0.8181612f,   0.f, 0.f,   101, 101, 0, 255 },
+	{ -0.38f, -0.09000003f, -0.18f,   0.4169983f, -0.3958845f, -0.8181612f,   0.f, 0.f,   101, 101, 0, 255 },
+	{ -0.53f, -0.31f, -0.15f,   0.4169983f, -0.3958845f, -0.8181612f,   0.f, 0.f,   101, 101, 0, 255 },
+	{ 0.44f, -0.19f, -0.11f,   0.7863336f, -0.4368522f, -0.4368519f,   0.f, 0.f,   111, 111, 0, 255 },
+	{ 0.39f, -0.24f, -0.15f,   0.7863336f, -0.4368522f, -0.4368519f,   0.f, 0.f,   111, 111, 0, 255 },
+	{ 0.39f, -0.2f, -0.19f,   0.7863336f, -0.4368522f, -0.4368519f,   0.f, 0.f,   111, 111, 0, 255 },
+	{ -0.81f, -0.18f, -0.24f,   -0.03676868f, -0.1143916f, -0.9927551f,   0.f, 0.f,   29, 29, 0, 255 },
+	{ -0.82f, -0.09000003f, -0.25f,   -0.03676868f, -0.1143916f, -0.9927551f,   0.f, 0.f,   29, 29, 0, 255 },
+	{ -0.55f, -0.09000003f, -0.26f,   -0.03676868f, -0.1143916f, -0.9927551f,   0.f, 0.f,   29, 29, 0, 255 },
+	{ -0.84f, 0.03999996f, -0.24f,   0.08271534f, 0.08907809f, -0.992584f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ -0.6f, 0.03999996f, -0.22f,   0.08271534f, 0.08907809f, -0.992584f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ -0.82f, -0.09000003f, -0.25f,   0.08271534f, 0.08907809f, -0.992584f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ -0.43f, -0.06000006f, -0.22f,   0.2124026f, 0.3610846f, -0.9080216f,   0.f, 0.f,   92, 92, 0, 255 },
+	{ -0.55f, -0.09000003f, -0.26f,   0.2124026f, 0.3610846f, -0.9080216f,   0.f, 0.f,   92, 92, 0, 255 },
+	{ -0.6f, 0.03999996f, -0.22f,   0.2124026f, 0.3610846f, -0.9080216f,   0.f, 0.f,   92, 92, 0, 255 },
+	{ -0.55f, -0.09000003f, -0.26f,   -0.03551605f, 0.2813966f, -0.958934f,   0.f, 0.f,   72, 72, 0, 255 },
+	{ -0.82f, -0.09000003f, -0.25f,   -0.03551605f, 0.2813966f, -0.958934f,   0.f, 0.f,   72, 72, 0, 255 },
+	{ -0.6f, 0.03999996f, -0.22f,   -0.03551605f, 0.2813966f, -0.958934f,   0.f, 0.f,   72, 72, 0, 255 },
+	{ 0.26f, -0.02999997f, -0.27f,   -0.1290149f, -0.2638943f, -0.9558844f,   0.f, 0.f,   67, 67, 0, 255 },
+	{ 0.36f, -0.2600001f, -0.22f,   -0.1290149f, -0.2638943f, -0.9558844f,   0.f, 0.f,   67, 67, 0, 255 },
+	{ 0.25f, -0.17f, -0.23f,   -0.1290149f, -0.2638943f, -0.9558844f,   0.f, 0.f,   67, 67, 0, 255 },
+	{ 0.36f, -0.2600001f, -0.22f,   0.8553795f, -0.185952f, -0.4834746f,   0.f, 0.f,   47, 47, 0, 255 },
+	{ 0.4f, -0.05000007f, -0.23f,   0.8553795f, -0.185952f, -0.4834746f,   0.f, 0.f,   47, 47, 0, 255 },
+	{ 0.39f, -0.2f, -0.19f,   0.8553795f, -0.185952f, -0.4834746f,   0.f, 0.f,   47, 47, 0, 255 },
+	{ 0.36f, -0.2600001f, -0.22f,   0.2608396f, -0.09542918f, -0.960654f,   0.f, 0.f,   24, 24, 0, 255 },
+	{ 0.26f, -0.02999997f, -0.27f,   0.2608396f, -0.09542918f, -0.960654f,   0.f, 0.f,   24, 24, 0, 255 },
+	{ 0.4f, -0.05000007f, -0.23f,   0.2608396f, -0.09542918f, -0.960654f,   0.f, 0.f,   24, 24, 0, 255 },
+	{ 0.36f, -0.2600001f, -0.22f,   0.0383545f, -0.06392424f, -0.9972174f,   0.f, 0.f,   16, 16, 0, 255 },
+	{ 0.31f, -0.29f, -0.22f,   0.0383545f, -0.06392424f, -0.9972174f,   0.f, 0.f,   16, 16, 0, 255 },
+	{ 0.25f, -0.17f, -0.23f,   0.0383545f, -0.06392424f, -0.9972174f,   0.f, 0.f,   16, 16, 0, 255 },
+	{ -0.87f, -0.02999997f, -0.23f,   -0.6417939f, -0.2995035f, -0.7059731f,   0.f, 0.f,   76, 76, 0, 255 },
+	{ -0.82f, -0.09000003f, -0.25f,   -0.6417939f, -0.2995035f, -0.7059731f,   0.f, 0.f,   76, 76, 0, 255 },
+	{ -0.9f, -0.06000006f, -0.19f,   -0.6417939f, -0.2995035f, -0.7059731f,   0.f, 0.f,   76, 76, 0, 255 },
+	{ -0.9f, -0.06000006f, -0.19f,   -0.9848322f, -0.1103012f, 0.1339371f,   0.f, 0.f,   28, 28, 0, 255 },
+	{ -0.88f, -0.19f, -0.15f,   -0.9848322f, -0.1103012f, 0.1339371f,   0.f, 0.f,   28, 28, 0, 255 },
+	{ -0.89f, -0.04000008f, -0.09999996f,   -0.9848322f, -0.1103012f, 0.1339371f,   0.f, 0.f,   28, 28, 0, 255 },
+	{ 0.22f, -0.29f, -0.11f,   -0.9228348f, -0.2839491f, 0.2602864f,   0.f, 0.f,   72, 72, 0, 255 },
+	{ 0.23f, -0.35f, -0.14f,   -0.9228348f, -0.2839491f, 0.2602864f,   0.f, 0.f,   72, 72, 0, 255 },
+	{ 0.26f, -0.42f, -0.11f,   -0.9228348f, -0.2839491f, 0.2602864f,   0.f, 0.f,   72, 72, 0, 255 },
+	{ -0.55f, -0.3f, -0.08999998f,   0.8144507f, -0.5731323f, 0.09049466f,   0.f, 0.f,   146, 146, 0, 255 },
+	{ -0.48f, -0.21f, -0.15f,   0.8144507f, -0.5731323f, 0.09049466f,   0.f, 0.f,   146, 146, 0, 255 },
+	{ -0.51f, -0.24f, -0.06999998f,   0.8144507f, -0.5731323f, 0.09049466f,   0.f, 0.f,   146, 146, 0, 255 },
+	{ -0.88f, -0.19f, -0.15f,   -0.7507848f, -0.25339f, 0.6100128f,   0.f, 0.f,   65, 65, 0, 255 },
+	{ -0.84f, -0.14f, -0.07999996f,   -0.7507848f, -0.25339f, 0.6100128f,   0.f, 0.f,   65, 65, 0, 255 },
+	{ -0.89f, -0.04000008f, -0.09999996f,   -0.7507848f, -0.25339f, 0.6100128f,   0.f, 0.f,   65, 65, 0, 255 },
+	{ -0.84f, -0.4f, -0.13f,   -0.8290184f, -0.1056075f, 0.5491589f,   0.f, 0.f,   27, 27, 0, 255 },
+	{ -0.84f, -0.14f, -0.07999996f,   -0.8290184f, -0.1056075f, 0.5491589f,   0.f, 0.f,   27, 27, 0, 255 },
+	{ -0.88f, -0.19f, -0.15f,   -0.8290184f, -0.1056075f, 0.5491589f,   0.f, 0.f,   27, 27, 0, 255 },
+	{ -0.53f, -0.31f, -0.15f,   0.8381162f, -0.4190581f, 0.3492156f,   0.f, 0.f,   107, 107, 0, 255 },
+	{ -0.48f, -0.21f, -0.15f,   0.8381162f, -0.4190581f, 0.3492156f,   0.f, 0.f,   107, 107, 0, 255 },
+	{ -0.55f, -0.3f, -0.08999998f,   0.8381162f, -0.4190581f, 0.3492156f,   0.f, 0.f,   107, 107, 0, 255 },
+	{ -0.43f, -0.06000006f, -0.22f,   0.3566312f, -0.2139788f, -0.9094104f,   0.f, 0.f,   55, 55, 0, 255 },
+	{ -0.52f, -0.21f, -0.22f,   0.3566312f, -0.2139788f, -0.9094104f,   0.f, 0.f,   55, 55, 0, 255 },
+	{ -0.55f, -0.09000003f, -0.26f,   0.3566312f, -0.2139788f, -0.9094104f,   0.f, 0.f,   55, 55, 0, 255 },
+	{ -0.84f, -0.4f, -0.13f,   -0.830072f, -0.1059666f, 0.5474957f,   0.f, 0.f,   27, 27, 0, 255 },
+	{ -0.88f, -0.19f, -0.15f,   -0.830072f, -0.1059666f, 0.5474957f,   0.f, 0.f,   27, 27, 0, 255 },
+	{ -0.87f, -0.3200001f, -0.16f,   -0.830072f, -0.1059666f, 0.5474957f,   0.f, 0.f,   27, 27, 0, 255 },
+	{ -0.81f, -0.18f, -0.24f,   0.01256891f, -0.2513785f, -0.9678072f,   0.f, 0.f,   64, 64, 0, 255 },
+	{ -0.55f, -0.09000003f, -0.26f,   0.01256891f, -0.2513785f, -0.9678072f,   0.f, 0.f,   64, 64, 0, 255 },
+	{ -0.61f, -0.17f, -0.24f,   0.01256891f, -0.2513785f, -0.9678072f,   0.f, 0.f,   64, 64, 0, 255 },
+	{ -0.85f, 0.15f, -0.09999996f,   -0.4082485f, 0.8164964f, -0.4082485f,   0.f, 0.f,   208, 208, 0, 255 },
+	{ -0.61f, 0.22f, -0.2f,   -0.4082485f, 0.8164964f, -0.4082485f,   0.f, 0.f,   208, 208, 0, 255 },
+	{ -0.72f, 0.15f, -0.23f,   -0.4082485f, 0.8164964f, -0.4082485f,   0.f, 0.f,   208, 208, 0, 255 },
+	{ -0.84f, -0.4f, -0.13f,   -0.3231365f, -0.1982884f, 0.9253457f,   0.f, 0.f,   51, 51, 0, 255 },
+	{ -0.75f, -0.36f, -0.08999997f,   -0.3231365f, -0.1982884f, 0.9253457f,   0.f, 0.f,   51, 51, 0, 255 },
+	{ -0.75f, -0.22f, -0.05999997f,   -0.3231365f, -0.1982884f, 0.9253457f,   0.f, 0.f,   51, 51, 0, 255 },
+	{ -0.61f, 0.22f, -0.2f,   0.1622539f, 0.6670421f, -0.7271372f,   0.f, 0.f,   170, 170, 0, 255 },
+	{ -0.33f, 0.25f, -0.11f,   0.1622539f, 0.6670421f, -0.7271372f,   0.f, 0.f,   170, 170, 0, 255 },
+	{ -0.3f, 0.2099999f, -0.14f,   0.1622539f, 0.6670421f, -0.7271372f,   0.f, 0.f,   170, 170, 0, 255 },
+	{ -0.31f, 0.04999995f, -0.19f,   0.0884425f, 0.2920662f, -0.9523f,   0.f, 0.f,   74, 74, 0, 255 },
+	{ -0.6f, 0.03999996f, -0.22f,   0.0884425f, 0.2920662f, -0.9523f,   0.f, 0.f,   74, 74, 0, 255 },
+	{ -0.3f, 0.2099999f, -0.14f,   0.0884425f, 0.2920662f, -0.9523f,   0.f, 0.f,   74, 74, 0, 255 },
+	{ -0.72f, 0.15f, -0.23f,   0.1915315f, 0.1203912f, -0.9740748f,   0.f, 0.f,   31, 31, 0, 255 },
+	{ -0.3f, 0.2099999f, -0.14f,   0.1915315f, 0.1203912f, -0.9740748f,   0.f, 0.f,   31, 31, 0, 255 },
+	{ -0.6f, 0.03999996f, -0.22f,   0.1915315f, 0.1203912f, -0.9740748f,   0.f, 0.f,   31, 31, 0, 255 },
+	{ -0.3f, 0.2099999f, -0.14f,   0.1923393f, 0.1154035f, -0.9745191f,   0.f, 0.f,   29, 29, 0, 255 },
+	{ -0.72f, 0.15f, -0.23f,   0.1923393f, 0.1154035f, -0.9745191f,   0.f, 0.f,   29, 29, 0, 255 },
+	{ -0.61f, 0.22f, -0.2f,   0.1923393f, 0.1154035f, -0.9745191f,   0.f, 0.f,   29, 29, 0, 255 },
+	{ -0.55f, -0.3f, -0.08999998f,   0.218218f, -0.4364359f, 0.8728715f,   0.f, 0.f,   111, 111, 0, 255 },
+	{ -0.51f, -0.24f, -0.06999998f,   0.218218f, -0.4364359f, 0.8728715f,   0.f, 0.f,   111, 111, 0, 255 },
+	{ -0.59f, -0.24f, -0.04999997f,   0.218218f, -0.4364359f, 0.8728715f,   0.f, 0.f,   111, 111, 0, 255 },
+	{ -0.84f, -0.14f, -0.07999996f,   -0.3601756f, -0.1761728f, 0.9160986f,   0.f, 0.f,   45, 45, 0, 255 },
+	{ -0.84f, -0.4f, -0.13f,   -0.3601756f, -0.1761728f, 0.9160986f,   0.f, 0.f,   45, 45, 0, 255 },
+	{ -0.75f, -0.22f, -0.05999997f,   -0.3601756f, -0.1761728f, 0.9160986f,   0.f, 0.f,   45, 45, 0, 255 },
+	{ -0.75f, -0.36f, -0.08999997f,   -0.08697288f, -0.2087352f, 0.9740972f,   0.f, 0.f,   53, 53, 0, 255 },
+	{ -0.59f, -0.24f, -0.04999997f,   -0.08697288f, -0.2087352f, 0.9740972f,   0.f, 0.f,   53, 53, 0, 255 },
+	{ -0.75f, -0.22f, -0.05999997f,   -0.08697288f, -0.2087352f, 0.9740972f,   0.f, 0.f,   53, 53, 0, 255 },
+	{ -0.87f, -0.3200001f, -0.16f,   -0.9428092f, -0.04714042f, -0.329983f,   0.f, 0.f,   12, 12, 0, 255 },
+	{ -0.88f, -0.19f, -0.15f,   -0.9428092f, -0.04714042f, -0.329983f,   0.f, 0.f,   12, 12, 0, 255 },
+	{ -0.86f, -0.31f, -0.19f,   -0.9428092f, -0.04714042f, -0.329983f,   0.f, 0.f,   12, 12, 0, 255 },
+	{ 0.34f, -0.24f, -0.06000001f,   0.478471f, -0.6778343f, 0.5582169f,   0.f, 0.f,   173, 173, 0, 255 },
+	{ 0.29f, -0.3f, -0.09000002f,   0.478471f, -0.6778343f, 0.5582169f,   0.f, 0.f,   173, 173, 0, 255 },
+	{ 0.37f, -0.2600001f, -0.11f,   0.478471f, -0.6778343f, 0.5582169f,   0.f, 0.f,   173, 173, 0, 255 },
+	{ -0.86f, -0.31f, -0.19f,   -0.4973213f, -0.1381447f, -0.8564973f,   0.f, 0.f,   35, 35, 0, 255 },
+	{ -0.81f, -0.18f, -0.24f,   -0.4973213f, -0.1381447f, -0.8564973f,   0.f, 0.f,   35, 35, 0, 255 },
+	{ -0.8f, -0.34f, -0.22f,   -0.4973213f, -0.1381447f, -0.8564973f,   0.f, 0.f,   35, 35, 0, 255 },
+	{ 0.21f, -0.28f, -0.16f,   -0.7071065f, -0.7071071f, 7.717322e-08f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ 0.22f, -0.29f, -0.11f,   -0.7071065f, -0.7071071f, 7.717322e-08f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ 0.2f, -0.27f, -0.07000001f,   -0.7071065f, -0.7071071f, 7.717322e-08f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ 0.34f, -0.24f, -0.06000001f,   -0.09515403f, -0.380617f, 0.9198241f,   0.f, 0.f,   97, 97, 0, 255 },
+	{ 0.25f, -0.29f, -0.09000001f,   -0.09515403f, -0.380617f, 0.9198241f,   0.f, 0.f,   97, 97, 0, 255 },
+	{ 0.29f, -0.3f, -0.09000002f,   -0.09515403f, -0.380617f, 0.9198241f,   0.f, 0.f,   97, 97, 0, 255 },
+	{ 0.25f, -0.29f, -0.09000001f,   -0.2279209f, -0.9116847f, 0.3418815f,   0.f, 0.f,   232, 232, 0, 255 },
+	{ 0.2f, -0.27f, -0.07000001f,   -0.2279209f, -0.9116847f, 0.3418815f,   0.f, 0.f,   232, 232, 0, 255 },
+	{ 0.22f, -0.29f, -0.11f,   -0.2279209f, -0.9116847f, 0.3418815f,   0.f, 0.f,   232, 232, 0, 255 },
+	{ -0.67f, -0.38f, -0.22f,   0.3122422f, -0.2755079f, -0.9091756f,   0.f, 0.f,   70, 70, 0, 255 },
+	{ -0.64f, -0.28f, -0.24f,   0.3122422f, -0.2755079f, -0.9091756f,   0.f, 0.f,   70, 70, 0, 255 },
+	{ -0.52f, -0.21f, -0.22f,   0.3122422f, -0.2755079f, -0.9091756f,   0.f, 0.f,   70, 70, 0, 255 },
+	{ -0.64f, -0.28f, -0.24f,   0.1941436f, -0.0529482f, -0.9795431f,   0.f, 0.f,   14, 14, 0, 255 },
+	{ -0.61f, -0.17f, -0.24f,   0.1941436f, -0.0529482f, -0.9795431f,   0.f, 0.f,   14, 14, 0, 255 },
+	{ -0.52f, -0.21f, -0.22f,   0.1941436f, -0.0529482f, -0.9795431f,   0.f, 0.f,   14, 14, 0, 255 },
+	{ -0.53f, -0.31f, -0.15f,   0.5747048f, -0.5070927f, -0.6423173f,   0.f, 0.f,   129, 129, 0, 255 },
+	{ -0.67f, -0.38f, -0.22f,   0.5747048f, -0.5070927f, -0.6423173f,   0.f, 0.f,   129, 129, 0, 255 },
+	{ -0.52f, -0.21f, -0.22f,   0.5747048f, -0.5070927f, -0.6423173f,   0.f, 0.f,   129, 129, 0, 255 },
+	{ -0.52f, -0.21f, -0.22f,   0.7312325f, -0.4387395f, -0.5223089f,   0.f, 0.f,   112, 112, 0, 255 },
+	{ -0.43f, -0.06000006f, -0.22f,   0.7312325f, -0.4387395f, -0.5223089f,   0.f, 0.f,   112, 112, 0, 255 },
+	{ -0.53f, -0.31f, -0.15f,   0.7312325f, -0.4387395f, -0.5223089f,   0.f, 0.f,   112, 112, 0, 255 },
+	{ -0.55f, -0.09000003f, -0.26f,   0.07928947f, -0.2973359f, -0.951475f,   0.f, 0.f,   76, 76, 0, 255 },
+	{ -0.52f, -0.21f, -0.22f,   0.07928947f, -0.2973359f, -0.951475f,   0.f, 0.f,   76, 76, 0, 255 },
+	{ -0.61f, -0.17f, -0.24f,   0.07928947f, -0.2973359f, -0.951475f,   0.f, 0.f,   76, 76, 0, 255 },
+	{ -0.64f, -0.28f, -0.24f,   -0.07548512f, -0.1283247f, -0.9888552f,   0.f, 0.f,   33, 33, 0, 255 },
+	{ -0.8f, -0.34f, -0.22f,   -0.07548512f, -0.1283247f, -0.9888552f,   0.f, 0.f,   33, 33, 0, 255 },
+	{ -0.81f, -0.18f, -0.24f,   -0.07548512f, -0.1283247f, -0.9888552f,   0.f, 0.f,   33, 33, 0, 255 },
+	{ -0.81f, -0.18f, -0.24f,   -0.4776652f, -0.1492704f, -0.8657681f,   0.f, 0.f,   38, 38, 0, 255 },
+	{ -0.86f, -0.31f, -0.19f,   -0.4776652f, -0.1492704f, -0.8657681f,   0.f, 0.f,   38, 38, 0, 255 },
+	{ -0.82f, -0.09000003f, -0.25f,   -0.4776652f, -0.1492704f, -0.8657681f,   0.f, 0.f,   38, 38, 0, 255 },
+	{ -0.82f, -0.09000003f, -0.25f,   -0.6205983f, -0.09929565f, -0.7778162f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ -0.86f, -0.31f, -0.19f,   -0.6205983f, -0.09929565f, -0.7778162f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ -0.9f, -0.06000006f, -0.19f,   -0.6205983f, -0.09929565f, -0.7778162f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ -0.9f, -0.06000006f, -0.19f,   -0.9872482f, -0.1579596f, -0.01974485f,   0.f, 0.f,   40, 40, 0, 255 },
+	{ -0.86f, -0.31f, -0.19f,   -0.9872482f, -0.1579596f, -0.01974485f,   0.f, 0.f,   40, 40, 0, 255 },
+	{ -0.88f, -0.19f, -0.15f,   -0.9872482f, -0.1579596f, -0.01974485f,   0.f, 0.f,   40, 40, 0, 255 },
+	{ -0.61f, -0.17f, -0.24f,   0.f, 0.f, -1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.64f, -0.28f, -0.24f,   0.f, 0.f, -1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.81f, -0.18f, -0.24f,   0.f, 0.f, -1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.82f, 0.8f, 0.14f,   0.6015677f, -0.7866666f, 0.1388241f,   0.f, 0.f,   201, 201, 0, 255 },
+	{ 0.77f, 0.76f, 0.13f,   0.6015677f, -0.7866666f, 0.1388241f,   0.f, 0.f,   201, 201, 0, 255 },
+	{ 0.74f, 0.73f, 0.08999997f,   0.6015677f, -0.7866666f, 0.1388241f,   0.f, 0.f,   201, 201, 0, 255 },
+	{ 0.77f, 0.76f, 0.13f,   0.5976144f, 0.3585689f, -0.717137f,   0.f, 0.f,   91, 91, 0, 255 },
+	{ 0.77f, 0.72f, 0.11f,   0.5976144f, 0.3585689f, -0.717137f,   0.f, 0.f,   91, 91, 0, 255 },
+	{ 0.74f, 0.73f, 0.08999997f,   0.5976144f, 0.3585689f, -0.717137f,   0.f, 0.f,   91, 91, 0, 255 },
+	{ 0.75f, 0.72f, 0.03999997f,   -0.4238611f, 0.8284567f, -0.366062f,   0.f, 0.f,   211, 211, 0, 255 },
+	{ 0.82f, 0.8f, 0.14f,   -0.4238611f, 0.8284567f, -0.366062f,   0.f, 0.f,   211, 211, 0, 255 },
+	{ 0.8f, 0.75f, 0.04999997f,   -0.4238611f, 0.8284567f, -0.366062f,   0.f, 0.f,   211, 211, 0, 255 },
+	{ 0.82f, 0.8f, 0.14f,   -0.5825886f, 0.7828544f, -0.2184709f,   0.f, 0.f,   200, 200, 0, 255 },
+	{ 0.75f, 0.72f, 0.03999997f,   -0.5825886f, 0.7828544f, -0.2184709f,   0.f, 0.f,   200, 200, 0, 255 },
+	{ 0.77f, 0.76f, 0.13f,   -0.5825886f, 0.7828544f, -0.2184709f,   0.f, 0.f,   200, 200, 0, 255 },
+	{ 0.76f, 0.73f, 0.04999997f,   0.4155809f, -0.831163f, 0.3694055f,   0.f, 0.f,   212, 212, 0, 255 },
+	{ 0.8f, 0.75f, 0.04999997f,   0.4155809f, -0.831163f, 0.3694055f,   0.f, 0.f,   212, 212, 0, 255 },
+	{ 0.82f, 0.8f, 0.14f,   0.4155809f, -0.831163f, 0.3694055f,   0.f, 0.f,   212, 212, 0, 255 },
+	{ 0.76f, 0.73f, 0.04999997f,   0.5345224f, -0.801784f, 0.2672609f,   0.f, 0.f,   204, 204, 0, 255 },
+	{ 0.82f, 0.8f, 0.14f,   0.5345224f, -0.801784f, 0.2672609f,   0.f, 0.f,   204, 204, 0, 255 },
+	{ 0.74f, 0.73f, 0.08999997f,   0.5345224f, -0.801784f, 0.2672609f,   0.f, 0.f,   204, 204, 0, 255 },
+	{ 0.75f, 0.6799999f, 0.07999997f,   -0.6410161f, -0.2289339f, 0.7325896f,   0.f, 0.f,   58, 58, 0, 255 },
+	{ 0.77f, 0.72f, 0.11f,   -0.6410161f, -0.2289339f, 0.7325896f,   0.f, 0.f,   58, 58, 0, 255 },
+	{ 0.72f, 0.6999999f, 0.05999997f,   -0.6410161f, -0.2289339f, 0.7325896f,   0.f, 0.f,   58, 58, 0, 255 },
+	{ 0.78f, 0.7099999f, 0.03999997f,   0.6459433f, 0.2936093f, 0.7046636f,   0.f, 0.f,   75, 75, 0, 255 },
+	{ 0.76f, 0.73f, 0.04999997f,   0.6459433f, 0.2936093f, 0.7046636f,   0.f, 0.f,   75, 75, 0, 255 },
+	{ 0.75f, 0.6799999f, 0.07999997f,   0.6459433f, 0.2936093f, 0.7046636f,   0.f, 0.f,   75, 75, 0, 255 },
+	{ 0.78f, 0.7099999f, 0.03999997f,   0.1561732f, -0.3123468f, 0.9370428f,   0.f, 0.f,   80, 80, 0, 255 },
+	{ 0.8f, 0.75f, 0.04999997f,   0.1561732f, -0.3123468f, 0.9370428f,   0.f, 0.f,   80, 80, 0, 255 },
+	{ 0.76f, 0.73f, 0.04999997f,   0.1561732f, -0.3123468f, 0.9370428f,   0.f, 0.f,   80, 80, 0, 255 },
+	{ 0.75f, 0.72f, 0.03999997f,   0.3162312f, 0.9486822f, 0.f,   0.f, 0.f,   242, 242, 0, 255 },
+	{ 0.78f, 0.7099999f, 0.03999997f,   0.3162312f, 0.9486822f, 0.f,   0.f, 0.f,   242, 242, 0, 255 },
+	{ 0.75f, 0.72f, -0.04000003f,   0.3162312f, 0.9486822f, 0.f,   0.f, 0.f,   242, 242, 0, 255 },
+	{ 0.75f, 0.6799999f, 0.07999997f,   0.890871f, 0.08908686f, 0.445435f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ 0.76f, 0.73f, 0.04999997f,   0.890871f, 0.08908686f, 0.445435f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ 0.74f, 0.73f, 0.08999997f,   0.890871f, 0.08908686f, 0.445435f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ 0.72f, 0.6999999f, 0.05999997f,   5.144864e-08f, 0.707105f, 0.7071086f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ 0.75f, 0.72f, 0.03999997f,   5.144864e-08f, 0.707105f, 0.7071086f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ 0.71f, 0.72f, 0.03999997f,   5.144864e-08f, 0.707105f, 0.7071086f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ 0.8f, 0.75f, 0.04999997f,   0.06967389f, 0.2090192f, -0.9754264f,   0.f, 0.f,   53, 53, 0, 255 },
+	{ 0.78f, 0.7099999f, 0.03999997f,   0.06967389f, 0.2090192f, -0.9754264f,   0.f, 0.f,   53, 53, 0, 255 },
+	{ 0.75f, 0.72f, 0.03999997f,   0.06967389f, 0.2090192f, -0.9754264f,   0.f, 0.f,   53, 53, 0, 255 },
+	{ 0.88f, 0.55f, 0.11f,   0.4472125f, 0.8944278f, -1.366639e-06f,   0.f, 0.f,   228, 228, 0, 255 },
+	{ 0.92f, 0.53f, 0.08999997f,   0.4472125f, 0.8944278f, -1.366639e-06f,   0.f, 0.f,   228, 228, 0, 255 },
+	{ 0.9f, 0.54f, 0.08999997f,   0.4472125f, 0.8944278f, -1.366639e-06f,   0.f, 0.f,   228, 228, 0, 255 },
+	{ 0.77f, 0.76f, 0.13f,   -0.5819139f, -0.3636969f, 0.727393f,   0.f, 0.f,   93, 93, 0, 255 },
+	{ 0.72f, 0.6999999f, 0.05999997f,   -0.5819139f, -0.3636969f, 0.727393f,   0.f, 0.f,   93, 93, 0, 255 },
+	{ 0.77f, 0.72f, 0.11f,   -0.5819139f, -0.3636969f, 0.727393f,   0.f, 0.f,   93, 93, 0, 255 },
+	{ 0.77f, 0.72f, 0.11f,   0.594812f, 0.2703686f, -0.7570334f,   0.f, 0.f,   69, 69, 0, 255 },
+	{ 0.75f, 0.6799999f, 0.07999997f,   0.594812f, 0.2703686f, -0.7570334f,   0.f, 0.f,   69, 69, 0, 255 },
+	{ 0.74f, 0.73f, 0.08999997f,   0.594812f, 0.2703686f, -0.7570334f,   0.f, 0.f,   69, 69, 0, 255 },
+	{ 0.88f, 0.55f, 0.11f,   0.3905666f, -0.1301888f, 0.9113224f,   0.f, 0.f,   33, 33, 0, 255 },
+	{ 0.87f, 0.52f, 0.11f,   0.3905666f, -0.1301888f, 0.9113224f,   0.f, 0.f,   33, 33, 0, 255 },
+	{ 0.92f, 0.53f, 0.08999997f,   0.3905666f, -0.1301888f, 0.9113224f,   0.f, 0.f,   33, 33, 0, 255 },
+	{ 0.88f, 0.55f, 0.11f,   0.4082483f, 0.8164967f, 0.408248f,   0.f, 0.f,   208, 208, 0, 255 },
+	{ 0.89f, 0.55f, 0.09999996f,   0.4082483f, 0.8164967f, 0.408248f,   0.f, 0.f,   208, 208, 0, 255 },
+	{ 0.85f, 0.5599999f, 0.12f,   0.4082483f, 0.8164967f, 0.408248f,   0.f, 0.f,   208, 208, 0, 255 },
+	{ 0.91f, 0.5699999f, 0.11f,   0.2280857f, -0.6082294f, 0.7602854f,   0.f, 0.f,   155, 155, 0, 255 },
+	{ 0.85f, 0.5599999f, 0.12f,   0.2280857f, -0.6082294f, 0.7602854f,   0.f, 0.f,   155, 155, 0, 255 },
+	{ 0.89f, 0.55f, 0.09999996f,   0.2280857f, -0.6082294f, 0.7602854f,   0.f, 0.f,   155, 155, 0, 255 },
+	{ 0.92f, 0.53f, 0.08999997f,   -0.2407711f, -0.4815436f, 0.842701f,   0.f, 0.f,   123, 123, 0, 255 },
+	{ 0.91f, 0.5699999f, 0.11f,   -0.2407711f, -0.4815436f, 0.842701f,   0.f, 0.f,   123, 123, 0, 255 },
+	{ 0.9f, 0.54f, 0.08999997f,   -0.2407711f, -0.4815436f, 0.842701f,   0.f, 0.f,   123, 123, 0, 255 },
+	{ 0.89f, 0.55f, 0.09999996f,   0.1961159f, -0.5883489f, 0.7844643f,   0.f, 0.f,   150, 150, 0, 255 },
+	{ 0.9f, 0.54f, 0.08999997f,   0.1961159f, -0.5883489f, 0.7844643f,   0.f, 0.f,   150, 150, 0, 255 },
+	{ 0.91f, 0.5699999f, 0.11f,   0.1961159f, -0.5883489f, 0.7844643f,   0.f, 0.f,   150, 150, 0, 255 },
+	{ 0.72f, 0.6999999f, 0.05999997f,   -0.6304089f, 0.7516384f, -0.1939704f,   0.f, 0.f,   192, 192, 0, 255 },
+	{ 0.77f, 0.76f, 0.13f,   -0.6304089f, 0.7516384f, -0.1939704f,   0.f, 0.f,   192, 192, 0, 255 },
+	{ 0.75f, 0.72f, 0.03999997f,   -0.6304089f, 0.7516384f, -0.1939704f,   0.f, 0.f,   192, 192, 0, 255 },
+	{ -0.79f, 0.2099999f, 0.02000003f,   0.03061412f, 0.8877993f, 0.4592116f,   0.f, 0.f,   226, 226, 0, 255 },
+	{ -0.78f, 0.22f, 3.409488e-08f,   0.03061412f, 0.8877993f, 0.4592116f,   0.f, 0.f,   226, 226, 0, 255 },
+	{ -0.93f, 0.22f, 0.01000004f,   0.03061412f, 0.8877993f, 0.4592116f,   0.f, 0.f,   226, 226, 0, 255 },
+	{ -0.91f, 0.11f, 3.977737e-08f,   0.7427812f, -0.5570868f, 0.3713899f,   0.f, 0.f,   142, 142, 0, 255 },
+	{ -0.89f, 0.15f, 0.02000004f,   0.7427812f, -0.5570868f, 0.3713899f,   0.f, 0.f,   142, 142, 0, 255 },
+	{ -0.95f, 0.09000003f, 0.05000004f,   0.7427812f, -0.5570868f, 0.3713899f,   0.f, 0.f,   142, 142, 0, 255 },
+	{ -0.99f, 0.14f, 0.04000004f,   0.2174998f, -0.3624998f, 0.9062493f,   0.f, 0.f,   92, 92, 0, 255 },
+	{ -0.89f, 0.15f, 0.02000004f,   0.2174998f, -0.3624998f, 0.9062493f,   0.f, 0.f,   92, 92, 0, 255 },
+	{ -0.79f, 0.2099999f, 0.02000003f,   0.2174998f, -0.3624998f, 0.9062493f,   0.f, 0.f,   92, 92, 0, 255 },
+	{ -0.93f, 0.22f, 0.01000004f,   -0.03921931f, 0.3765078f, 0.9255829f,   0.f, 0.f,   96, 96, 0, 255 },
+	{ -0.99f, 0.14f, 0.04000004f,   -0.03921931f, 0.3765078f, 0.9255829f,   0.f, 0.f,   96, 96, 0, 255 },
+	{ -0.79f, 0.2099999f, 0.02000003f,   -0.03921931f, 0.3765078f, 0.9255829f,   0.f, 0.f,   96, 96, 0, 255 },
+	{ -0.99f, 0.14f, 0.04000004f,   0.1561738f, 0.3123478f, 0.9370425f,   0.f, 0.f,   80, 80, 0, 255 },
+	{ -0.95f, 0.09000003f, 0.05000004f,   0.1561738f, 0.3123478f, 0.9370425f,   0.f, 0.f,   80, 80, 0, 255 },
+	{ -0.89f, 0.15f, 0.02000004f,   0.1561738f, 0.3123478f, 0.9370425f,   0.f, 0.f,   80, 80, 0, 255 },
+	{ -0.89f, 0.15f, 0.02000004f,   0.4915389f, -0.573463f, 0.6553851f,   0.f, 0.f,   146, 146, 0, 255 },
+	{ -0.91f, 0.11f, 3.977737e-08f,   0.4915389f, -0.573463f, 0.6553851f,   0.f, 0.f,   146, 146, 0, 255 },
+	{ -0.84f, 0.17f, 3.671757e-08f,   0.4915389f, -0.573463f, 0.6553851f,   0.f, 0.f,   146, 146, 0, 255 },
+	{ -0.84f, 0.17f, 3.671757e-08f,   0.4728659f, -0.7881104f, 0.3940555f,   0.f, 0.f,   201, 201, 0, 255 },
+	{ -0.79f, 0.2099999f, 0.02000003f,   0.4728659f, -0.7881104f, 0.3940555f,   0.f, 0.f,   201, 201, 0, 255 },
+	{ -0.89f, 0.15f, 0.02000004f,   0.4728659f, -0.7881104f, 0.3940555f,   0.f, 0.f,   201, 201, 0, 255 },
+	{ -1.06f, -0.1f, 0.03000005f,   -0.1702503f, -0.005159067f, 0.9853874f,   0.f, 0.f,   1, 1, 0, 255 },
+	{ -1.f, -0.17f, 0.04000004f,   -0.1702503f, -0.005159067f, 0.9853874f,   0.f, 0.f,   1, 1, 0, 255 },
+	{ -0.95f, 0.09000003f, 0.05000004f,   -0.1702503f, -0.005159067f, 0.9853874f,   0.f, 0.f,   1, 1, 0, 255 },
+	{ -1.f, -0.17f, 0.04000004f,   -0.08960882f, 0.06517f, 0.9938425f,   0.f, 0.f,   17, 17, 0, 255 },
+	{ -1.06f, -0.1f, 0.03000005f,   -0.08960882f, 0.06517f, 0.9938425f,   0.f, 0.f,   17, 17, 0, 255 },
+	{ -1.02f, -0.35f, 0.05000005f,   -0.08960882f, 0.06517f, 0.9938425f,   0.f, 0.f,   17, 17, 0, 255 },
+	{ -1.06f, -0.1f, 0.03000005f,   -0.2438652f, 0.03850516f, 0.9690444f,   0.f, 0.f,   10, 10, 0, 255 },
+	{ -1.09f, -0.29f, 0.03000005f,   -0.2438652f, 0.03850516f, 0.9690444f,   0.f, 0.f,   10, 10, 0, 255 },
+	{ -1.02f, -0.35f, 0.05000005f,   -0.2438652f, 0.03850516f, 0.9690444f,   0.f, 0.f,   10, 10, 0, 255 },
+	{ -0.93f, 0.22f, 0.01000004f,   -0.7344453f, 0.6378075f, 0.2319301f,   0.f, 0.f,   163, 163, 0, 255 },
+	{ -1.02f, 0.12f, 4.458562e-08f,   -0.7344453f, 0.6378075f, 0.2319301f,   0.f, 0.f,   163, 163, 0, 255 },
+	{ -0.99f, 0.14f, 0.04000004f,   -0.7344453f, 0.6378075f, 0.2319301f,   0.f, 0.f,   163, 163, 0, 255 },
+	{ -0.95f, 0.09000003f, 0.05000004f,   0.8018284f, -0.1761592f, 0.5709984f,   0.f, 0.f,   45, 45, 0, 255 },
+	{ -1.f, -0.17f, 0.04000004f,   0.8018284f, -0.1761592f, 0.5709984f,   0.f, 0.f,   45, 45, 0, 255 },
+	{ -0.91f, 0.11f, 3.977737e-08f,   0.8018284f, -0.1761592f, 0.5709984f,   0.f, 0.f,   45, 45, 0, 255 },
+	{ -1.02f, 0.12f, 4.458562e-08f,   -0.8300405f, 0.2207552f, 0.5121522f,   0.f, 0.f,   56, 56, 0, 255 },
+	{ -1.06f, -0.1f, 0.03000005f,   -0.8300405f, 0.2207552f, 0.5121522f,   0.f, 0.f,   56, 56, 0, 255 },
+	{ -0.99f, 0.14f, 0.04000004f,   -0.8300405f, 0.2207552f, 0.5121522f,   0.f, 0.f,   56, 56, 0, 255 },
+	{ -0.95f, 0.09000003f, 0.05000004f,   -0.2160872f, 0.02235378f, 0.9761181f,   0.f, 0.f,   6, 6, 0, 255 },
+	{ -0.99f, 0.14f, 0.04000004f,   -0.2160872f, 0.02235378f, 0.9761181f,   0.f, 0.f,   6, 6, 0, 255 },
+	{ -1.06f, -0.1f, 0.03000005f,   -0.2160872f, 0.02235378f, 0.9761181f,   0.f, 0.f,   6, 6, 0, 255 },
+	{ 0.27f, 0.12f, 0.25f,   0.3646273f, 0.1711515f, 0.915289f,   0.f, 0.f,   44, 44, 0, 255 },
+	{ 0.4f, -0.05000007f, 0.23f,   0.3646273f, 0.1711515f, 0.915289f,   0.f, 0.f,   44, 44, 0, 255 },
+	{ 0.43f, 0.1f, 0.19f,   0.3646273f, 0.1711515f, 0.915289f,   0.f, 0.f,   44, 44, 0, 255 },
+	{ -1.1f, -0.34f, 4.808253e-08f,   -0.9300389f, -0.1972808f, 0.3100127f,   0.f, 0.f,   50, 50, 0, 255 },
+	{ -1.08f, -0.45f, -0.009999952f,   -0.9300389f, -0.1972808f, 0.3100127f,   0.f, 0.f,   50, 50, 0, 255 },
+	{ -1.07f, -0.45f, 0.02000005f,   -0.9300389f, -0.1972808f, 0.3100127f,   0.f, 0.f,   50, 50, 0, 255 },
+	{ -0.6f, 0.03999996f, 0.22f,   0.09595401f, 0.1631217f, 0.9819288f,   0.f, 0.f,   42, 42, 0, 255 },
+	{ -0.43f, -0.06000006f, 0.22f,   0.09595401f, 0.1631217f, 0.9819288f,   0.f, 0.f,   42, 42, 0, 255 },
+	{ -0.31f, 0.04999995f, 0.19f,   0.09595401f, 0.1631217f, 0.9819288f,   0.f, 0.f,   42, 42, 0, 255 },
+	{ 0.4f, -0.05000007f, 0.23f,   0.2873223f, 0.1077459f, 0.9517545f,   0.f, 0.f,   27, 27, 0, 255 },
+	{ 0.27f, 0.12f, 0.25f,   0.2873223f, 0.1077459f, 0.9517545f,   0.f, 0.f,   27, 27, 0, 255 },
+	{ 0.26f, -0.02999997f, 0.27f,   0.2873223f, 0.1077459f, 0.9517545f,   0.f, 0.f,   27, 27, 0, 255 },
+	{ 0.33f, -0.91f, 0.06999999f,   -0.6985638f, 0.03249135f, -0.7148098f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ 0.29f, -0.89f, 0.11f,   -0.6985638f, 0.03249135f, -0.7148098f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ 0.33f, -0.6900001f, 0.07999998f,   -0.6985638f, 0.03249135f, -0.7148098f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ 0.35f, -0.8100001f, 0.09999999f,   0.6244838f, -0.02602021f, -0.7806042f,   0.f, 0.f,   7, 7, 0, 255 },
+	{ 0.33f, -0.6900001f, 0.07999998f,   0.6244838f, -0.02602021f, -0.7806042f,   0.f, 0.f,   7, 7, 0, 255 },
+	{ 0.37f, -0.63f, 0.11f,   0.6244838f, -0.02602021f, -0.7806042f,   0.f, 0.f,   7, 7, 0, 255 },
+	{ 0.33f, -0.91f, 0.06999999f,   0.7860088f, 0.02807171f, -0.6175777f,   0.f, 0.f,   7, 7, 0, 255 },
+	{ 0.33f, -0.6900001f, 0.07999998f,   0.7860088f, 0.02807171f, -0.6175777f,   0.f, 0.f,   7, 7, 0, 255 },
+	{ 0.35f, -0.8100001f, 0.09999999f,   0.7860088f, 0.02807171f, -0.6175777f,   0.f, 0.f,   7, 7, 0, 255 },
+	{ -1.02f, 0.12f, 4.458562e-08f,   -0.9836089f, 0.1710625f, -0.05701885f,   0.f, 0.f,   44, 44, 0, 255 },
+	{ -1.1f, -0.34f, 4.808253e-08f,   -0.9836089f, 0.1710625f, -0.05701885f,   0.f, 0.f,   44, 44, 0, 255 },
+	{ -1.06f, -0.1f, 0.03000005f,   -0.9836089f, 0.1710625f, -0.05701885f,   0.f, 0.f,   44, 44, 0, 255 },
+	{ -1.f, -0.24f, 4.371139e-08f,   0.8878382f, -0.2283012f, 0.399527f,   0.f, 0.f,   58, 58, 0, 255 },
+	{ -0.91f, 0.11f, 3.977737e-08f,   0.8878382f, -0.2283012f, 0.399527f,   0.f, 0.f,   58, 58, 0, 255 },
+	{ -1.f, -0.17f, 0.04000004f,   0.8878382f, -0.2283012f, 0.399527f,   0.f, 0.f,   58, 58, 0, 255 },
+	{ -1.03f, -0.39f, 4.502273e-08f,   0.8451538f, -0.5070936f, 0.1690299f,   0.f, 0.f,   129, 129, 0, 255 },
+	{ -1.05f, -0.41f, 0.04000004f,   0.8451538f, -0.5070936f, 0.1690299f,   0.f, 0.f,   129, 129, 0, 255 },
+	{ -1.07f, -0.45f, 0.02000005f,   0.8451538f, -0.5070936f, 0.1690299f,   0.f, 0.f,   129, 129, 0, 255 },
+	{ -1.03f, -0.39f, 4.502273e-08f,   0.7071072f, -0.7071064f, 4.115905e-07f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ -0.98f, -0.34f, 4.283716e-08f,   0.7071072f, -0.7071064f, 4.115905e-07f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ -1.05f, -0.41f, 0.04000004f,   0.7071072f, -0.7071064f, 4.115905e-07f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ -1.05f, -0.41f, 0.04000004f,   0.7383048f, -0.452509f, 0.5001415f,   0.f, 0.f,   115, 115, 0, 255 },
+	{ -0.98f, -0.34f, 4.283716e-08f,   0.7383048f, -0.452509f, 0.5001415f,   0.f, 0.f,   115, 115, 0, 255 },
+	{ -1.02f, -0.35f, 0.05000005f,   0.7383048f, -0.452509f, 0.5001415f,   0.f, 0.f,   115, 115, 0, 255 },
+	{ 0.62f, 0.39f, 0.02999997f,   0.5383168f, -0.3907139f, 0.7466977f,   0.f, 0.f,   100, 100, 0, 255 },
+	{ 0.61f, 0.51f, 0.09999997f,   0.5383168f, -0.3907139f, 0.7466977f,   0.f, 0.f,   100, 100, 0, 255 },
+	{ 0.48f, 0.35f, 0.11f,   0.5383168f, -0.3907139f, 0.7466977f,   0.f, 0.f,   100, 100, 0, 255 },
+	{ 0.62f, 0.39f, 0.02999997f,   0.5375459f, -0.4261034f, 0.7276539f,   0.f, 0.f,   109, 109, 0, 255 },
+	{ 0.48f, 0.35f, 0.11f,   0.5375459f, -0.4261034f, 0.7276539f,   0.f, 0.f,   109, 109, 0, 255 },
+	{ 0.51f, 0.1999999f, -2.229281e-08f,   0.5375459f, -0.4261034f, 0.7276539f,   0.f, 0.f,   109, 109, 0, 255 },
+	{ 0.31f, 0.47f, 0.01999999f,   -0.3644204f, 0.4737469f, 0.8017242f,   0.f, 0.f,   121, 121, 0, 255 },
+	{ 0.64f, 0.6899999f, 0.03999997f,   -0.3644204f, 0.4737469f, 0.8017242f,   0.f, 0.f,   121, 121, 0, 255 },
+	{ 0.37f, 0.55f, -1.617321e-08f,   -0.3644204f, 0.4737469f, 0.8017242f,   0.f, 0.f,   121, 121, 0, 255 },
+	{ 0.64f, 0.6899999f, 0.03999997f,   -0.4068395f, 0.5435124f, 0.7342179f,   0.f, 0.f,   139, 139, 0, 255 },
+	{ 0.31f, 0.47f, 0.01999999f,   -0.4068395f, 0.5435124f, 0.7342179f,   0.f, 0.f,   139, 139, 0, 255 },
+	{ 0.61f, 0.6f, 0.08999997f,   -0.4068395f, 0.5435124f, 0.7342179f,   0.f, 0.f,   139, 139, 0, 255 },
+	{ 0.65f, 0.39f, 0.05999997f,   0.3481553f, -0.8703884f, -0.348155f,   0.f, 0.f,   222, 222, 0, 255 },
+	{ 0.62f, 0.39f, 0.02999997f,   0.3481553f, -0.8703884f, -0.348155f,   0.f, 0.f,   222, 222, 0, 255 },
+	{ 0.65f, 0.41f, 0.009999971f,   0.3481553f, -0.8703884f, -0.348155f,   0.f, 0.f,   222, 222, 0, 255 },
+	{ 0.37f, 0.55f, -1.617321e-08f,   -0.4603171f, 0.8877546f, 0.f,   0.f, 0.f,   226, 226, 0, 255 },
+	{ 0.64f, 0.6899999f, 0.03999997f,   -0.4603171f, 0.8877546f, 0.f,   0.f, 0.f,   226, 226, 0, 255 },
+	{ 0.64f, 0.6899999f, -0.04000003f,   -0.4603171f, 0.8877546f, 0.f,   0.f, 0.f,   226, 226, 0, 255 },
+	{ 0.61f, 0.51f, 0.09999997f,   -0.05935813f, 0.1102367f, 0.9921313f,   0.f, 0.f,   28, 28, 0, 255 },
+	{ 0.61f, 0.6f, 0.08999997f,   -0.05935813f, 0.1102367f, 0.9921313f,   0.f, 0.f,   28, 28, 0, 255 },
+	{ 0.48f, 0.35f, 0.11f,   -0.05935813f, 0.1102367f, 0.9921313f,   0.f, 0.f,   28, 28, 0, 255 },
+	{ 0.65f, 0.41f, 0.009999971f,   0.6853285f, -0.4828449f, 0.5451474f,   0.f, 0.f,   123, 123, 0, 255 },
+	{ 0.62f, 0.39f, 0.02999997f,   0.6853285f, -0.4828449f, 0.5451474f,   0.f, 0.f,   123, 123, 0, 255 },
+	{ 0.51f, 0.1999999f, -2.229281e-08f,   0.6853285f, -0.4828449f, 0.5451474f,   0.f, 0.f,   123, 123, 0, 255 },
+	{ -0.79f, 0.2099999f, 0.02000003f,   -0.6526058f, 0.7439708f, 0.1435728f,   0.f, 0.f,   190, 190, 0, 255 },
+	{ -0.84f, 0.17f, 3.671757e-08f,   -0.6526058f, 0.7439708f, 0.1435728f,   0.f, 0.f,   190, 190, 0, 255 },
+	{ -0.85f, 0.14f, 0.11f,   -0.6526058f, 0.7439708f, 0.1435728f,   0.f, 0.f,   190, 190, 0, 255 },
+	{ -0.84f, 0.17f, 3.671757e-08f,   -0.8741939f, 0.4827641f, 0.05219024f,   0.f, 0.f,   123, 123, 0, 255 },
+	{ -0.88f, 0.09000003f, 0.07000004f,   -0.8741939f, 0.4827641f, 0.05219024f,   0.f, 0.f,   123, 123, 0, 255 },
+	{ -0.85f, 0.14f, 0.11f,   -0.8741939f, 0.4827641f, 0.05219024f,   0.f, 0.f,   123, 123, 0, 255 },
+	{ -0.65f, 0.26f, 0.08000003f,   -0.4437564f, 0.826305f, 0.3468435f,   0.f, 0.f,   211, 211, 0, 255 },
+	{ -0.79f, 0.2099999f, 0.02000003f,   -0.4437564f, 0.826305f, 0.3468435f,   0.f, 0.f,   211, 211, 0, 255 },
+	{ -0.85f, 0.14f, 0.11f,   -0.4437564f, 0.826305f, 0.3468435f,   0.f, 0.f,   211, 211, 0, 255 },
+	{ 0.62f, 0.39f, 0.02999997f,   -0.8479986f, -0.3179992f, 0.4239989f,   0.f, 0.f,   81, 81, 0, 255 },
+	{ 0.65f, 0.39f, 0.08999997f,   -0.8479986f, -0.3179992f, 0.4239989f,   0.f, 0.f,   81, 81, 0, 255 },
+	{ 0.61f, 0.51f, 0.09999997f,   -0.8479986f, -0.3179992f, 0.4239989f,   0.f, 0.f,   81, 81, 0, 255 },
+	{ 0.61f, 0.51f, 0.09999997f,   -0.01840211f, 0.1104128f, 0.9937155f,   0.f, 0.f,   28, 28, 0, 255 },
+	{ 0.67f, 0.61f, 0.08999997f,   -0.01840211f, 0.1104128f, 0.9937155f,   0.f, 0.f,   28, 28, 0, 255 },
+	{ 0.61f, 0.6f, 0.08999997f,   -0.01840211f, 0.1104128f, 0.9937155f,   0.f, 0.f,   28, 28, 0, 255 },
+	{ 0.65f, 0.39f, 0.05999997f,   -0.f, -1.f, 0.f,   0.f, 0.f,   255, 255, 0, 255 },
+	{ 0.65f, 0.39f, 0.08999997f,   -0.f, -1.f, 0.f,   0.f, 0.f,   255, 255, 0, 255 },
+	{ 0.62f, 0.39f, 0.02999997f,   -0.f, -1.f, 0.f,   0.f, 0.f,   255, 255, 0, 255 },
+	{ -1.06f, -0.1f, 0.03000005f,   -0.9853985f, 0.1555897f, 0.06914961f,   0.f, 0.f,   40, 40, 0, 255 },
+	{ -1.1f, -0.34f, 4.808253e-08f,   -0.9853985f, 0.1555897f, 0.06914961f,   0.f, 0.f,   40, 40, 0, 255 },
+	{ -1.09f, -0.29f, 0.03000005f,   -0.9853985f, 0.1555897f, 0.06914961f,   0.f, 0.f,   40, 40, 0, 255 },
+	{ -1.f, -0.24f, 4.371139e-08f,   0.9274779f, 0.1854954f, -0.3246169f,   0.f, 0.f,   47, 47, 0, 255 },
+	{ -1.f, -0.17f, 0.04000004f,   0.9274779f, 0.1854954f, -0.3246169f,   0.f, 0.f,   47, 47, 0, 255 },
+	{ -0.98f, -0.34f, 4.283716e-08f,   0.9274779f, 0.1854954f, -0.3246169f,   0.f, 0.f,   47, 47, 0, 255 },
+	{ -1.f, -0.17f, 0.04000004f,   0.7849109f, -0.05291529f, 0.617345f,   0.f, 0.f,   13, 13, 0, 255 },
+	{ -1.02f, -0.35f, 0.05000005f,   0.7849109f, -0.05291529f, 0.617345f,   0.f, 0.f,   13, 13, 0, 255 },
+	{ -0.98f, -0.34f, 4.283716e-08f,   0.7849109f, -0.05291529f, 0.617345f,   0.f, 0.f,   13, 13, 0, 255 },
+	{ -1.09f, -0.29f, 0.03000005f,   -0.8475479f, -0.1379728f, 0.5124704f,   0.f, 0.f,   35, 35, 0, 255 },
+	{ -1.1f, -0.34f, 4.808253e-08f,   -0.8475479f, -0.1379728f, 0.5124704f,   0.f, 0.f,   35, 35, 0, 255 },
+	{ -1.07f, -0.45f, 0.02000005f,   -0.8475479f, -0.1379728f, 0.5124704f,   0.f, 0.f,   35, 35, 0, 255 },
+	{ -1.09f, -0.29f, 0.03000005f,   -0.5691794f, -0.1219671f, 0.8131167f,   0.f, 0.f,   31, 31, 0, 255 },
+	{ -1.07f, -0.45f, 0.02000005f,   -0.5691794f, -0.1219671f, 0.8131167f,   0.f, 0.f,   31, 31, 0, 255 },
+	{ -1.05f, -0.41f, 0.04000004f,   -0.5691794f, -0.1219671f, 0.8131167f,   0.f, 0.f,   31, 31, 0, 255 },
+	{ -1.02f, -0.35f, 0.05000005f,   -0.2873112f, -0.01596194f, 0.9577043f,   0.f, 0.f,   4, 4, 0, 255 },
+	{ -1.09f, -0.29f, 0.03000005f,   -0.2873112f, -0.01596194f, 0.9577043f,   0.f, 0.f,   4, 4, 0, 255 },
+	{ -1.05f, -0.41f, 0.04000004f,   -0.2873112f, -0.01596194f, 0.9577043f,   0.f, 0.f,   4, 4, 0, 255 },
+	{ 0.64f, 0.6899999f, 0.03999997f,   -0.08420323f, 0.5052199f, 0.858873f,   0.f, 0.f,   129, 129, 0, 255 },
+	{ 0.61f, 0.6f, 0.08999997f,   -0.08420323f, 0.5052199f, 0.858873f,   0.f, 0.f,   129, 129, 0, 255 },
+	{ 0.67f, 0.61f, 0.08999997f,   -0.08420323f, 0.5052199f, 0.858873f,   0.f, 0.f,   129, 129, 0, 255 },
+	{ 1.07f, 0.36f, 0.06999996f,   0.1961156f, -0.7844646f, -0.5883485f,   0.f, 0.f,   200, 200, 0, 255 },
+	{ 1.03f, 0.35f, 0.06999996f,   0.1961156f, -0.7844646f, -0.5883485f,   0.f, 0.f,   200, 200, 0, 255 },
+	{ 1.05f, 0.37f, 0.04999996f,   0.1961156f, -0.7844646f, -0.5883485f,   0.f, 0.f,   200, 200, 0, 255 },
+	{ 1.09f, 0.36f, 0.04999995f,   -0.2357017f, -0.9428094f, -0.2357014f,   0.f, 0.f,   240, 240, 0, 255 },
+	{ 1.07f, 0.36f, 0.06999996f,   -0.2357017f, -0.9428094f, -0.2357014f,   0.f, 0.f,   240, 240, 0, 255 },
+	{ 1.05f, 0.37f, 0.04999996f,   -0.2357017f, -0.9428094f, -0.2357014f,   0.f, 0.f,   240, 240, 0, 255 },
+	{ 1.f, 0.4f, 0.04999996f,   0.09141819f, 0.0571363f, 0.9941721f,   0.f, 0.f,   15, 15, 0, 255 },
+	{ 0.95f, 0.48f, 0.04999996f,   0.09141819f, 0.0571363f, 0.9941721f,   0.f, 0.f,   15, 15, 0, 255 },
+	{ 0.91f, 0.37f, 0.05999996f,   0.09141819f, 0.0571363f, 0.9941721f,   0.f, 0.f,   15, 15, 0, 255 },
+	{ 1.09f, 0.36f, 0.04999995f,   0.3762881f, 0.8466493f, 0.3762877f,   0.f, 0.f,   216, 216, 0, 255 },
+	{ 1.f, 0.4f, 0.04999996f,   0.3762881f, 0.8466493f, 0.3762877f,   0.f, 0.f,   216, 216, 0, 255 },
+	{ 1.07f, 0.36f, 0.06999996f,   0.3762881f, 0.8466493f, 0.3762877f,   0.f, 0.f,   216, 216, 0, 255 },
+	{ 1.f, 0.4f, 0.04999996f,   -0.0818544f, 0.3274186f, 0.9413272f,   0.f, 0.f,   83, 83, 0, 255 },
+	{ 1.03f, 0.35f, 0.06999996f,   -0.0818544f, 0.3274186f, 0.9413272f,   0.f, 0.f,   83, 83, 0, 255 },
+	{ 1.07f, 0.36f, 0.06999996f,   -0.0818544f, 0.3274186f, 0.9413272f,   0.f, 0.f,   83, 83, 0, 255 },
+	{ 1.03f, 0.26f, 0.05999995f,   0.1810121f, -0.1086073f, 0.9774656f,   0.f, 0.f,   28, 28, 0, 255 },
+	{ 1.06f, 0.3099999f, 0.05999995f,   0.1810121f, -0.1086073f, 0.9774656f,   0.f, 0.f,   28, 28, 0, 255 },
+	{ 1.03f, 0.35f, 0.06999996f,   0.1810121f, -0.1086073f, 0.9774656f,   0.f, 0.f,   28, 28, 0, 255 },
+	{ 1.09f, 0.34f, 0.02999995f,   0.927173f, -0.2649061f, 0.2649058f,   0.f, 0.f,   68, 68, 0, 255 },
+	{ 1.09f, 0.36f, 0.04999995f,   0.927173f, -0.2649061f, 0.2649058f,   0.f, 0.f,   68, 68, 0, 255 },
+	{ 1.07f, 0.28f, 0.03999995f,   0.927173f, -0.2649061f, 0.2649058f,   0.f, 0.f,   68, 68, 0, 255 },
+	{ 0.92f, 0.53f, 0.08999997f,   0.8300576f, -0.06917139f, 0.5533712f,   0.f, 0.f,   18, 18, 0, 255 },
+	{ 0.93f, 0.5699999f, 0.07999996f,   0.8300576f, -0.06917139f, 0.5533712f,   0.f, 0.f,   18, 18, 0, 255 },
+	{ 0.91f, 0.5699999f, 0.11f,   0.8300576f, -0.06917139f, 0.5533712f,   0.f, 0.f,   18, 18, 0, 255 },
+	{ 0.87f, 0.52f, 0.11f,   0.03745029f, -0.224702f, 0.9737077f,   0.f, 0.f,   57, 57, 0, 255 },
+	{ 0.85f, 0.5599999f, 0.12f,   0.03745029f, -0.224702f, 0.9737077f,   0.f, 0.f,   57, 57, 0, 255 },
+	{ 0.81f, 0.51f, 0.11f,   0.03745029f, -0.224702f, 0.9737077f,   0.f, 0.f,   57, 57, 0, 255 },
+	{ 0.85f, 0.5599999f, 0.12f,   -0.4688641f, 0.2031746f, 0.8595851f,   0.f, 0.f,   52, 52, 0, 255 },
+	{ 0.82f, 0.66f, 0.07999996f,   -0.4688641f, 0.2031746f, 0.8595851f,   0.f, 0.f,   52, 52, 0, 255 },
+	{ 0.81f, 0.51f, 0.11f,   -0.4688641f, 0.2031746f, 0.8595851f,   0.f, 0.f,   52, 52, 0, 255 },
+	{ 0.82f, 0.66f, 0.07999996f,   0.08720421f, 0.3924186f, 0.9156435f,   0.f, 0.f,   100, 100, 0, 255 },
+	{ 0.85f, 0.5599999f, 0.12f,   0.08720421f, 0.3924186f, 0.9156435f,   0.f, 0.f,   100, 100, 0, 255 },
+	{ 0.91f, 0.5699999f, 0.11f,   0.08720421f, 0.3924186f, 0.9156435f,   0.f, 0.f,   100, 100, 0, 255 },
+	{ 0.75f, 0.6799999f, 0.07999997f,   0.05494199f, 0.1922968f, 0.9797976f,   0.f, 0.f,   49, 49, 0, 255 },
+	{ 0.81f, 0.51f, 0.11f,   0.05494199f, 0.1922968f, 0.9797976f,   0.f, 0.f,   49, 49, 0, 255 },
+	{ 0.82f, 0.66f, 0.07999996f,   0.05494199f, 0.1922968f, 0.9797976f,   0.f, 0.f,   49, 49, 0, 255 },
+	{ 0.67f, 0.61f, 0.08999997f,   -0.0221538f, 0.1661547f, 0.9858508f,   0.f, 0.f,   42, 42, 0, 255 },
+	{ 0.81f, 0.51f, 0.11f,   -0.0221538f, 0.1661547f, 0.9858508f,   0.f, 0.f,   42, 42, 0, 255 },
+	{ 0.75f, 0.6799999f, 0.07999997f,   -0.0221538f, 0.1661547f, 0.9858508f,   0.f, 0.f,   42, 42, 0, 255 },
+	{ 0.64f, 0.6899999f, 0.03999997f,   -0.2628647f, 0.6133491f, 0.7447852f,   0.f, 0.f,   156, 156, 0, 255 },
+	{ 0.72f, 0.6999999f, 0.05999997f,   -0.2628647f, 0.6133491f, 0.7447852f,   0.f, 0.f,   156, 156, 0, 255 },
+	{ 0.71f, 0.72f, 0.03999997f,   -0.2628647f, 0.6133491f, 0.7447852f,   0.f, 0.f,   156, 156, 0, 255 },
+	{ 0.85f, 0.67f, 0.03999996f,   0.4274648f, 0.7480648f, 0.507615f,   0.f, 0.f,   191, 191, 0, 255 },
+	{ 0.78f, 0.7099999f, 0.03999997f,   0.4274648f, 0.7480648f, 0.507615f,   0.f, 0.f,   191, 191, 0, 255 },
+	{ 0.82f, 0.66f, 0.07999996f,   0.4274648f, 0.7480648f, 0.507615f,   0.f, 0.f,   191, 191, 0, 255 },
+	{ 0.82f, 0.66f, 0.07999996f,   0.2014532f, 0.7050866f, 0.6799042f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ 0.78f, 0.7099999f, 0.03999997f,   0.2014532f, 0.7050866f, 0.6799042f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ 0.75f, 0.6799999f, 0.07999997f,   0.2014532f, 0.7050866f, 0.6799042f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ 1.09f, 0.36f, 0.04999995f,   0.1675321f, 0.3769477f, 0.9109574f,   0.f, 0.f,   96, 96, 0, 255 },
+	{ 0.97f, 0.51f, 0.009999957f,   0.1675321f, 0.3769477f, 0.9109574f,   0.f, 0.f,   96, 96, 0, 255 },
+	{ 1.f, 0.4f, 0.04999996f,   0.1675321f, 0.3769477f, 0.9109574f,   0.f, 0.f,   96, 96, 0, 255 },
+	{ 1.f, 0.4f, 0.04999996f,   0.6552481f, 0.4095299f, 0.6347718f,   0.f, 0.f,   104, 104, 0, 255 },
+	{ 0.97f, 0.51f, 0.009999957f,   0.6552481f, 0.4095299f, 0.6347718f,   0.f, 0.f,   104, 104, 0, 255 },
+	{ 0.95f, 0.48f, 0.04999996f,   0.6552481f, 0.4095299f, 0.6347718f,   0.f, 0.f,   104, 104, 0, 255 },
+	{ 0.92f, 0.53f, 0.08999997f,   0.4082481f, -0.408249f, 0.8164963f,   0.f, 0.f,   104, 104, 0, 255 },
+	{ 0.87f, 0.52f, 0.11f,   0.4082481f, -0.408249f, 0.8164963f,   0.f, 0.f,   104, 104, 0, 255 },
+	{ 0.9f, 0.49f, 0.07999996f,   0.4082481f, -0.408249f, 0.8164963f,   0.f, 0.f,   104, 104, 0, 255 },
+	{ 0.87f, 0.52f, 0.11f,   0.1078327f, -0.6469971f, 0.7548291f,   0.f, 0.f,   165, 165, 0, 255 },
+	{ 0.81f, 0.51f, 0.11f,   0.1078327f, -0.6469971f, 0.7548291f,   0.f, 0.f,   165, 165, 0, 255 },
+	{ 0.9f, 0.49f, 0.07999996f,   0.1078327f, -0.6469971f, 0.7548291f,   0.f, 0.f,   165, 165, 0, 255 },
+	{ 0.93f, 0.5699999f, 0.07999996f,   0.4794249f, -0.1797847f, 0.8589699f,   0.f, 0.f,   46, 46, 0, 255 },
+	{ 0.9f, 0.49f, 0.07999996f,   0.4794249f, -0.1797847f, 0.8589699f,   0.f, 0.f,   46, 46, 0, 255 },
+	{ 0.95f, 0.48f, 0.04999996f,   0.4794249f, -0.1797847f, 0.8589699f,   0.f, 0.f,   46, 46, 0, 255 },
+	{ 0.93f, 0.5699999f, 0.07999996f,   0.5264599f, 0.6434507f, 0.5557078f,   0.f, 0.f,   164, 164, 0, 255 },
+	{ 0.85f, 0.67f, 0.03999996f,   0.5264599f, 0.6434507f, 0.5557078f,   0.f, 0.f,   164, 164, 0, 255 },
+	{ 0.82f, 0.66f, 0.07999996f,   0.5264599f, 0.6434507f, 0.5557078f,   0.f, 0.f,   164, 164, 0, 255 },
+	{ 0.82f, 0.66f, 0.07999996f,   0.5833835f, 0.7130241f, 0.3889219f,   0.f, 0.f,   182, 182, 0, 255 },
+	{ 0.91f, 0.5699999f, 0.11f,   0.5833835f, 0.7130241f, 0.3889219f,   0.f, 0.f,   182, 182, 0, 255 },
+	{ 0.93f, 0.5699999f, 0.07999996f,   0.5833835f, 0.7130241f, 0.3889219f,   0.f, 0.f,   182, 182, 0, 255 },
+	{ 1.06f, 0.3099999f, 0.05999995f,   0.5661392f, 0.2264551f, 0.7925935f,   0.f, 0.f,   58, 58, 0, 255 },
+	{ 1.05f, 0.37f, 0.04999996f,   0.5661392f, 0.2264551f, 0.7925935f,   0.f, 0.f,   58, 58, 0, 255 },
+	{ 1.03f, 0.35f, 0.06999996f,   0.5661392f, 0.2264551f, 0.7925935f,   0.f, 0.f,   58, 58, 0, 255 },
+	{ 0.92f, 0.53f, 0.08999997f,   0.8479975f, -0.3179997f, -0.4240006f,   0.f, 0.f,   81, 81, 0, 255 },
+	{ 0.9f, 0.49f, 0.07999996f,   0.8479975f, -0.3179997f, -0.4240006f,   0.f, 0.f,   81, 81, 0, 255 },
+	{ 0.93f, 0.5699999f, 0.07999996f,   0.8479975f, -0.3179997f, -0.4240006f,   0.f, 0.f,   81, 81, 0, 255 },
+	{ 0.88f, 0.55f, 0.11f,   0.286039f, -0.09534633f, 0.9534626f,   0.f, 0.f,   24, 24, 0, 255 },
+	{ 0.85f, 0.5599999f, 0.12f,   0.286039f, -0.09534633f, 0.9534626f,   0.f, 0.f,   24, 24, 0, 255 },
+	{ 0.87f, 0.52f, 0.11f,   0.286039f, -0.09534633f, 0.9534626f,   0.f, 0.f,   24, 24, 0, 255 },
+	{ 1.05f, 0.37f, 0.04999996f,   0.04279596f, 0.171184f, 0.9843092f,   0.f, 0.f,   44, 44, 0, 255 },
+	{ 1.06f, 0.3099999f, 0.05999995f,   0.04279596f, 0.171184f, 0.9843092f,   0.f, 0.f,   44, 44, 0, 255 },
+	{ 1.09f, 0.36f, 0.04999995f,   0.04279596f, 0.171184f, 0.9843092f,   0.f, 0.f,   44, 44, 0, 255 },
+	{ 1.04f, 0.23f, 0.009999954f,   2.793969e-08f, -0.8000003f, 0.5999997f,   0.f, 0.f,   204, 204, 0, 255 },
+	{ 0.99f, 0.26f, 0.04999996f,   2.793969e-08f, -0.8000003f, 0.5999997f,   0.f, 0.f,   204, 204, 0, 255 },
+	{ 1.02f, 0.23f, 0.009999955f,   2.793969e-08f, -0.8000003f, 0.5999997f,   0.f, 0.f,   204, 204, 0, 255 },
+	{ 0.99f, 0.26f, 0.04999996f,   -0.1230915f, -0.8616406f, 0.4923656f,   0.f, 0.f,   220, 220, 0, 255 },
+	{ 1.04f, 0.23f, 0.009999954f,   -0.1230915f, -0.8616406f, 0.4923656f,   0.f, 0.f,   220, 220, 0, 255 },
+	{ 1.03f, 0.26f, 0.05999995f,   -0.1230915f, -0.8616406f, 0.4923656f,   0.f, 0.f,   220, 220, 0, 255 },
+	{ 0.64f, 0.6899999f, 0.03999997f,   -0.3939203f, 0.9191446f, 0.f,   0.f, 0.f,   234, 234, 0, 255 },
+	{ 1.04f, 0.23f, -0.03000004f,   0.f, -1.f, 0.f,   0.f, 0.f,   255, 255, 0, 255 },
+	{ 1.04f, 0.23f, 0.009999954f,   0.f, -1.f, 0.f,   0.f, 0.f,   255, 255, 0, 255 },
+	{ 1.02f, 0.23f, 0.009999955f,   0.f, -1.f, 0.f,   0.f, 0.f,   255, 255, 0, 255 },
+	{ 1.03f, 0.26f, 0.05999995f,   -0.6461595f, -0.08428159f, 0.7585345f,   0.f, 0.f,   21, 21, 0, 255 },
+	{ 1.03f, 0.35f, 0.06999996f,   -0.6461595f, -0.08428159f, 0.7585345f,   0.f, 0.f,   21, 21, 0, 255 },
+	{ 1.f, 0.4f, 0.04999996f,   -0.6461595f, -0.08428159f, 0.7585345f,   0.f, 0.f,   21, 21, 0, 255 },
+	{ 1.f, 0.4f, 0.04999996f,   -0.2424994f, 0.01732137f, 0.9699969f,   0.f, 0.f,   4, 4, 0, 255 },
+	{ 0.99f, 0.26f, 0.04999996f,   -0.2424994f, 0.01732137f, 0.9699969f,   0.f, 0.f,   4, 4, 0, 255 },
+	{ 1.03f, 0.26f, 0.05999995f,   -0.2424994f, 0.01732137f, 0.9699969f,   0.f, 0.f,   4, 4, 0, 255 },
+	{ 1.07f, 0.28f, 0.03999995f,   0.5743656f, -0.6461633f, 0.5025706f,   0.f, 0.f,   165, 165, 0, 255 },
+	{ 1.03f, 0.26f, 0.05999995f,   0.5743656f, -0.6461633f, 0.5025706f,   0.f, 0.f,   165, 165, 0, 255 },
+	{ 1.04f, 0.23f, 0.009999954f,   0.5743656f, -0.6461633f, 0.5025706f,   0.f, 0.f,   165, 165, 0, 255 },
+	{ 1.04f, 0.23f, -0.03000004f,   0.8574921f, -0.5144973f, 0.f,   0.f, 0.f,   131, 131, 0, 255 },
+	{ 1.07f, 0.28f, 0.03999995f,   0.8574921f, -0.5144973f, 0.f,   0.f, 0.f,   131, 131, 0, 255 },
+	{ 1.04f, 0.23f, 0.009999954f,   0.8574921f, -0.5144973f, 0.f,   0.f, 0.f,   131, 131, 0, 255 },
+	{ 1.08f, 0.38f, -0.03000005f,   0.9901475f, 0.09901477f, -0.09901466f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ 1.09f, 0.36f, 0.04999995f,   0.9901475f, 0.09901477f, -0.09901466f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ 1.09f, 0.34f, 0.02999995f,   0.9901475f, 0.09901477f, -0.09901466f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ 1.09f, 0.34f, 0.02999995f,   0.945611f, -0.2909566f, 0.1454787f,   0.f, 0.f,   74, 74, 0, 255 },
+	{ 1.07f, 0.28f, 0.03999995f,   0.945611f, -0.2909566f, 0.1454787f,   0.f, 0.f,   74, 74, 0, 255 },
+	{ 1.09f, 0.3099999f, -0.03000005f,   0.945611f, -0.2909566f, 0.1454787f,   0.f, 0.f,   74, 74, 0, 255 },
+	{ 1.06f, 0.3099999f, 0.05999995f,   0.5488203f, -0.3292921f, 0.7683508f,   0.f, 0.f,   84, 84, 0, 255 },
+	{ 1.03f, 0.26f, 0.05999995f,   0.5488203f, -0.3292921f, 0.7683508f,   0.f, 0.f,   84, 84, 0, 255 },
+	{ 1.07f, 0.28f, 0.03999995f,   0.5488203f, -0.3292921f, 0.7683508f,   0.f, 0.f,   84, 84, 0, 255 },
+	{ 0.75f, 0.72f, -0.04000003f,   0.4946543f, 0.8656464f, -0.07728818f,   0.f, 0.f,   221, 221, 0, 255 },
+	{ 0.78f, 0.7099999f, 0.03999997f,   0.4946543f, 0.8656464f, -0.07728818f,   0.f, 0.f,   221, 221, 0, 255 },
+	{ 0.85f, 0.67f, 0.03999996f,   0.4946543f, 0.8656464f, -0.07728818f,   0.f, 0.f,   221, 221, 0, 255 },
+	{ 0.95f, 0.55f, -0.01000004f,   0.8728712f, 0.4800803f, 0.08728677f,   0.f, 0.f,   122, 122, 0, 255 },
+	{ 0.93f, 0.5699999f, 0.07999996f,   0.8728712f, 0.4800803f, 0.08728677f,   0.f, 0.f,   122, 122, 0, 255 },
+	{ 0.97f, 0.51f, 0.009999957f,   0.8728712f, 0.4800803f, 0.08728677f,   0.f, 0.f,   122, 122, 0, 255 },
+	{ 0.75f, 0.72f, -0.04000003f,   0.f, 1.f, -0.f,   0.f, 0.f,   255, 255, 0, 255 },
+	{ 0.71f, 0.72f, 0.03999997f,   0.f, 1.f, -0.f,   0.f, 0.f,   255, 255, 0, 255 },
+	{ 0.75f, 0.72f, 0.03999997f,   0.f, 1.f, -0.f,   0.f, 0.f,   255, 255, 0, 255 },
+	{ 1.08f, 0.38f, -0.03000005f,   0.7712408f, 0.6335194f, 0.06197467f,   0.f, 0.f,   162, 162, 0, 255 },
+	{ 0.97f, 0.51f, 0.009999957f,   0.7712408f, 0.6335194f, 0.06197467f,   0.f, 0.f,   162, 162, 0, 255 },
+	{ 1.09f, 0.36f, 0.04999995f,   0.7712408f, 0.6335194f, 0.06197467f,   0.f, 0.f,   162, 162, 0, 255 },
+	{ 0.97f, 0.51f, 0.009999957f,   0.8816751f, 0.0391852f, 0.4702272f,   0.f, 0.f,   10, 10, 0, 255 },
+	{ 0.93f, 0.5699999f, 0.07999996f,   0.8816751f, 0.0391852f, 0.4702272f,   0.f, 0.f,   10, 10, 0, 255 },
+	{ 0.95f, 0.48f, 0.04999996f,   0.8816751f, 0.0391852f, 0.4702272f,   0.f, 0.f,   10, 10, 0, 255 },
+	{ 0.4f, -1.f, 0.14f,   0.768539f, 0.6273785f, 0.1254756f,   0.f, 0.f,   160, 160, 0, 255 },
+	{ 0.48f, -1.09f, 0.09999998f,   0.768539f, 0.6273785f, 0.1254756f,   0.f, 0.f,   160, 160, 0, 255 },
+	{ 0.4f, -0.99f, 0.08999999f,   0.768539f, 0.6273785f, 0.1254756f,   0.f, 0.f,   160, 160, 0, 255 },
+	{ 0.44f, -1.1f, 0.16f,   0.7293436f, 0.4023962f, 0.5532949f,   0.f, 0.f,   103, 103, 0, 255 },
+	{ 0.48f, -1.09f, 0.09999998f,   0.7293436f, 0.4023962f, 0.5532949f,   0.f, 0.f,   103, 103, 0, 255 },
+	{ 0.4f, -1.f, 0.14f,   0.7293436f, 0.4023962f, 0.5532949f,   0.f, 0.f,   103, 103, 0, 255 },
+	{ 0.34f, -1.08f, 0.15f,   -0.987177f, 0.01762815f, 0.1586533f,   0.f, 0.f,   4, 4, 0, 255 },
+	{ 0.34f, -0.99f, 0.14f,   -0.987177f, 0.01762815f, 0.1586533f,   0.f, 0.f,   4, 4, 0, 255 },
+	{ 0.33f, -1.01f, 0.07999998f,   -0.987177f, 0.01762815f, 0.1586533f,   0.f, 0.f,   4, 4, 0, 255 },
+	{ 0.35f, -1.1f, 0.17f,   0.10731f, 0.2360819f, 0.9657898f,   0.f, 0.f,   60, 60, 0, 255 },
+	{ 0.44f, -1.1f, 0.16f,   0.10731f, 0.2360819f, 0.9657898f,   0.f, 0.f,   60, 60, 0, 255 },
+	{ 0.4f, -1.f, 0.14f,   0.10731f, 0.2360819f, 0.9657898f,   0.f, 0.f,   60, 60, 0, 255 },
+	{ -0.94f, -0.96f, 0.16f,   -0.5827528f, -0.377075f, 0.7198706f,   0.f, 0.f,   96, 96, 0, 255 },
+	{ -0.91f, -0.93f, 0.2f,   -0.5827528f, -0.377075f, 0.7198706f,   0.f, 0.f,   96, 96, 0, 255 },
+	{ -0.96f, -0.91f, 0.17f,   -0.5827528f, -0.377075f, 0.7198706f,   0.f, 0.f,   96, 96, 0, 255 },
+	{ -0.89f, -0.97f, 0.13f,   0.1454784f, 0.2909575f, -0.9456108f,   0.f, 0.f,   74, 74, 0, 255 },
+	{ -0.86f, -0.92f, 0.1500001f,   0.1454784f, 0.2909575f, -0.9456108f,   0.f, 0.f,   74, 74, 0, 255 },
+	{ -0.83f, -1.f, 0.13f,   0.1454784f, 0.2909575f, -0.9456108f,   0.f, 0.f,   74, 74, 0, 255 },
+	{ -0.94f, -0.96f, 0.16f,   -0.6115932f, -0.08737025f, -0.7863334f,   0.f, 0.f,   22, 22, 0, 255 },
+	{ -0.96f, -0.91f, 0.17f,   -0.6115932f, -0.08737025f, -0.7863334f,   0.f, 0.f,   22, 22, 0, 255 },
+	{ -0.92f, -0.92f, 0.14f,   -0.6115932f, -0.08737025f, -0.7863334f,   0.f, 0.f,   22, 22, 0, 255 },
+	{ -0.89f, -0.97f, 0.13f,   -0.5306685f, -0.1516198f, -0.8339078f,   0.f, 0.f,   39, 39, 0, 255 },
+	{ -0.94f, -0.96f, 0.16f,   -0.5306685f, -0.1516198f, -0.8339078f,   0.f, 0.f,   39, 39, 0, 255 },
+	{ -0.92f, -0.92f, 0.14f,   -0.5306685f, -0.1516198f, -0.8339078f,   0.f, 0.f,   39, 39, 0, 255 },
+	{ -0.91f, -0.93f, 0.2f,   0.1517944f, 0.1821529f, 0.9714828f,   0.f, 0.f,   46, 46, 0, 255 },
+	{ -0.85f, -0.98f, 0.2f,   0.1517944f, 0.1821529f, 0.9714828f,   0.f, 0.f,   46, 46, 0, 255 },
+	{ -0.87f, -0.91f, 0.19f,   0.1517944f, 0.1821529f, 0.9714828f,   0.f, 0.f,   46, 46, 0, 255 },
+	{ 0.34f, -1.09f, 0.04999999f,   -0.105503f, -0.9495278f, 0.2954083f,   0.f, 0.f,   242, 242, 0, 255 },
+	{ 0.43f, -1.1f, 0.04999998f,   -0.105503f, -0.9495278f, 0.2954083f,   0.f, 0.f,   242, 242, 0, 255 },
+	{ 0.48f, -1.09f, 0.09999998f,   -0.105503f, -0.9495278f, 0.2954083f,   0.f, 0.f,   242, 242, 0, 255 },
+	{ 0.48f, -1.09f, 0.09999998f,   0.04759311f, -0.9899376f, -0.1332607f,   0.f, 0.f,   252, 252, 0, 255 },
+	{ 0.44f, -1.1f, 0.16f,   0.04759311f, -0.9899376f, -0.1332607f,   0.f, 0.f,   252, 252, 0, 255 },
+	{ 0.34f, -1.09f, 0.04999999f,   0.04759311f, -0.9899376f, -0.1332607f,   0.f, 0.f,   252, 252, 0, 255 },
+	{ 0.35f, -1.1f, 0.17f,   -0.00914281f, -0.9965669f, -0.08228526f,   0.f, 0.f,   254, 254, 0, 255 },
+	{ 0.34f, -1.09f, 0.04999999f,   -0.00914281f, -0.9965669f, -0.08228526f,   0.f, 0.f,   254, 254, 0, 255 },
+	{ 0.44f, -1.1f, 0.16f,   -0.00914281f, -0.9965669f, -0.08228526f,   0.f, 0.f,   254, 254, 0, 255 },
+	{ 0.34f, -1.08f, 0.15f,   -0.909588f, -0.4134491f, 0.04134487f,   0.f, 0.f,   105, 105, 0, 255 },
+	{ 0.34f, -1.09f, 0.04999999f,   -0.909588f, -0.4134491f, 0.04134487f,   0.f, 0.f,   105, 105, 0, 255 },
+	{ 0.35f, -1.1f, 0.17f,   -0.909588f, -0.4134491f, 0.04134487f,   0.f, 0.f,   105, 105, 0, 255 },
+	{ -0.85f, -0.98f, 0.2f,   0.773166f, 0.3006755f, 0.5583981f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ -0.81f, -0.99f, 0.15f,   0.773166f, 0.3006755f, 0.5583981f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ -0.87f, -0.91f, 0.19f,   0.773166f, 0.3006755f, 0.5583981f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ -0.87f, -0.91f, 0.19f,   0.8123623f, 0.580259f, 0.05802578f,   0.f, 0.f,   148, 148, 0, 255 },
+	{ -0.81f, -0.99f, 0.15f,   0.8123623f, 0.580259f, 0.05802578f,   0.f, 0.f,   148, 148, 0, 255 },
+	{ -0.86f, -0.92f, 0.1500001f,   0.8123623f, 0.580259f, 0.05802578f,   0.f, 0.f,   148, 148, 0, 255 },
+	{ -0.81f, -0.99f, 0.15f,   0.5461923f, 0.3901377f, -0.7412601f,   0.f, 0.f,   99, 99, 0, 255 },
+	{ -0.83f, -1.f, 0.13f,   0.5461923f, 0.3901377f, -0.7412601f,   0.f, 0.f,   99, 99, 0, 255 },
+	{ -0.86f, -0.92f, 0.1500001f,   0.5461923f, 0.3901377f, -0.7412601f,   0.f, 0.f,   99, 99, 0, 255 },
+	{ 0.28f, -0.96f, 0.12f,   -0.4437602f, -0.3328205f, 0.8320502f,   0.f, 0.f,   85, 85, 0, 255 },
+	{ 0.34f, -0.99f, 0.14f,   -0.4437602f, -0.3328205f, 0.8320502f,   0.f, 0.f,   85, 85, 0, 255 },
+	{ 0.31f, -0.95f, 0.14f,   -0.4437602f, -0.3328205f, 0.8320502f,   0.f, 0.f,   85, 85, 0, 255 },
+	{ 0.34f, -0.99f, 0.14f,   -0.5094283f, -0.7872989f, 0.3473374f,   0.f, 0.f,   201, 201, 0, 255 },
+	{ 0.28f, -0.96f, 0.12f,   -0.5094283f, -0.7872989f, 0.3473374f,   0.f, 0.f,   201, 201, 0, 255 },
+	{ 0.33f, -1.01f, 0.07999998f,   -0.5094283f, -0.7872989f, 0.3473374f,   0.f, 0.f,   201, 201, 0, 255 },
+	{ 0.28f, -0.96f, 0.12f,   -0.7664013f, -0.6131219f, -0.1916001f,   0.f, 0.f,   156, 156, 0, 255 },
+	{ 0.29f, -0.96f, 0.07999998f,   -0.7664013f, -0.6131219f, -0.1916001f,   0.f, 0.f,   156, 156, 0, 255 },
+	{ 0.33f, -1.01f, 0.07999998f,   -0.7664013f, -0.6131219f, -0.1916001f,   0.f, 0.f,   156, 156, 0, 255 },
+	{ 0.34f, -0.99f, 0.14f,   -0.f, 0.f, 1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.4f, -1.f, 0.14f,   -0.f, 0.f, 1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.35f, -0.9400001f, 0.14f,   -0.f, 0.f, 1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.4f, -0.99f, 0.08999999f,   0.8757549f, 0.473381f, 0.09467611f,   0.f, 0.f,   121, 121, 0, 255 },
+	{ 0.36f, -0.92f, 0.11f,   0.8757549f, 0.473381f, 0.09467611f,   0.f, 0.f,   121, 121, 0, 255 },
+	{ 0.4f, -1.f, 0.14f,   0.8757549f, 0.473381f, 0.09467611f,   0.f, 0.f,   121, 121, 0, 255 },
+	{ 0.4f, -1.f, 0.14f,   0.6344159f, 0.5286806f, 0.5639268f,   0.f, 0.f,   135, 135, 0, 255 },
+	{ 0.36f, -0.92f, 0.11f,   0.6344159f, 0.5286806f, 0.5639268f,   0.f, 0.f,   135, 135, 0, 255 },
+	{ 0.35f, -0.9400001f, 0.14f,   0.6344159f, 0.5286806f, 0.5639268f,   0.f, 0.f,   135, 135, 0, 255 },
+	{ 0.4f, -0.99f, 0.08999999f,   0.6837633f, 0.4558421f, -0.5698031f,   0.f, 0.f,   116, 116, 0, 255 },
+	{ 0.39f, -1.f, 0.06999999f,   0.6837633f, 0.4558421f, -0.5698031f,   0.f, 0.f,   116, 116, 0, 255 },
+	{ 0.33f, -0.91f, 0.06999999f,   0.6837633f, 0.4558421f, -0.5698031f,   0.f, 0.f,   116, 116, 0, 255 },
+	{ 0.35f, -0.9400001f, 0.14f,   0.f, 0.f, 1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.31f, -0.95f, 0.14f,   0.f, 0.f, 1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.34f, -0.99f, 0.14f,   0.f, 0.f, 1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.43f, -1.1f, 0.04999998f,   0.02275661f, 0.2048101f, -0.9785371f,   0.f, 0.f,   52, 52, 0, 255 },
+	{ 0.34f, -1.09f, 0.04999999f,   0.02275661f, 0.2048101f, -0.9785371f,   0.f, 0.f,   52, 52, 0, 255 },
+	{ 0.39f, -1.f, 0.06999999f,   0.02275661f, 0.2048101f, -0.9785371f,   0.f, 0.f,   52, 52, 0, 255 },
+	{ 0.4f, -0.99f, 0.08999999f,   0.6674238f, 0.4767311f, -0.5720778f,   0.f, 0.f,   122, 122, 0, 255 },
+	{ 0.48f, -1.09f, 0.09999998f,   0.6674238f, 0.4767311f, -0.5720778f,   0.f, 0.f,   122, 122, 0, 255 },
+	{ 0.39f, -1.f, 0.06999999f,   0.6674238f, 0.4767311f, -0.5720778f,   0.f, 0.f,   122, 122, 0, 255 },
+	{ 0.43f, -1.1f, 0.04999998f,   0.6135721f, 0.3834826f, -0.6902683f,   0.f, 0.f,   98, 98, 0, 255 },
+	{ 0.39f, -1.f, 0.06999999f,   0.6135721f, 0.3834826f, -0.6902683f,   0.f, 0.f,   98, 98, 0, 255 },
+	{ 0.48f, -1.09f, 0.09999998f,   0.6135721f, 0.3834826f, -0.6902683f,   0.f, 0.f,   98, 98, 0, 255 },
+	{ 0.33f, -1.01f, 0.07999998f,   -0.2074733f, 0.3206404f, -0.9241994f,   0.f, 0.f,   82, 82, 0, 255 },
+	{ 0.39f, -1.f, 0.06999999f,   -0.2074733f, 0.3206404f, -0.9241994f,   0.f, 0.f,   82, 82, 0, 255 },
+	{ 0.34f, -1.09f, 0.04999999f,   -0.2074733f, 0.3206404f, -0.9241994f,   0.f, 0.f,   82, 82, 0, 255 },
+	{ 0.35f, -1.1f, 0.17f,   -0.8702855f, 0.05439281f, 0.4895352f,   0.f, 0.f,   14, 14, 0, 255 },
+	{ 0.34f, -0.99f, 0.14f,   -0.8702855f, 0.05439281f, 0.4895352f,   0.f, 0.f,   14, 14, 0, 255 },
+	{ 0.34f, -1.08f, 0.15f,   -0.8702855f, 0.05439281f, 0.4895352f,   0.f, 0.f,   14, 14, 0, 255 },
+	{ 0.4f, -1.f, 0.14f,   0.04443587f, 0.2666155f, 0.9627781f,   0.f, 0.f,   68, 68, 0, 255 },
+	{ 0.34f, -0.99f, 0.14f,   0.04443587f, 0.2666155f, 0.9627781f,   0.f, 0.f,   68, 68, 0, 255 },
+	{ 0.35f, -1.1f, 0.17f,   0.04443587f, 0.2666155f, 0.9627781f,   0.f, 0.f,   68, 68, 0, 255 },
+	{ 0.34f, -1.09f, 0.04999999f,   -0.9915899f, -0.1287777f, 0.01287776f,   0.f, 0.f,   33, 33, 0, 255 },
+	{ 0.34f, -1.08f, 0.15f,   -0.9915899f, -0.1287777f, 0.01287776f,   0.f, 0.f,   33, 33, 0, 255 },
+	{ 0.33f, -1.01f, 0.07999998f,   -0.9915899f, -0.1287777f, 0.01287776f,   0.f, 0.f,   33, 33, 0, 255 },
+	{ -0.88f, -1.08f, 0.21f,   -0.8771974f, -0.4784713f, -0.03987257f,   0.f, 0.f,   122, 122, 0, 255 },
+	{ -0.87f, -1.09f, 0.11f,   -0.8771974f, -0.4784713f, -0.03987257f,   0.f, 0.f,   122, 122, 0, 255 },
+	{ -0.87f, -1.1f, 0.23f,   -0.8771974f, -0.4784713f, -0.03987257f,   0.f, 0.f,   122, 122, 0, 255 },
+	{ -0.81f, -1.01f, 0.2f,   0.7864628f, 0.5734622f, 0.2293847f,   0.f, 0.f,   146, 146, 0, 255 },
+	{ -0.74f, -1.09f, 0.16f,   0.7864628f, 0.5734622f, 0.2293847f,   0.f, 0.f,   146, 146, 0, 255 },
+	{ -0.81f, -0.99f, 0.15f,   0.7864628f, 0.5734622f, 0.2293847f,   0.f, 0.f,   146, 146, 0, 255 },
+	{ -0.87f, -1.1f, 0.23f,   0.09617575f, 0.2564682f, 0.9617558f,   0.f, 0.f,   65, 65, 0, 255 },
+	{ -0.77f, -1.1f, 0.22f,   0.09617575f, 0.2564682f, 0.9617558f,   0.f, 0.f,   65, 65, 0, 255 },
+	{ -0.81f, -1.01f, 0.2f,   0.09617575f, 0.2564682f, 0.9617558f,   0.f, 0.f,   65, 65, 0, 255 },
+	{ -0.77f, -1.1f, 0.22f,   0.7696319f, 0.4440183f, 0.4588186f,   0.f, 0.f,   113, 113, 0, 255 },
+	{ -0.74f, -1.09f, 0.16f,   0.7696319f, 0.4440183f, 0.4588186f,   0.f, 0.f,   113, 113, 0, 255 },
+	{ -0.81f, -1.01f, 0.2f,   0.7696319f, 0.4440183f, 0.4588186f,   0.f, 0.f,   113, 113, 0, 255 },
+	{ -0.88f, -1.08f, 0.21f,   -0.9935275f, -0.09740455f, 0.05844267f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ -0.89f, -0.99f, 0.19f,   -0.9935275f, -0.09740455f, 0.05844267f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ -0.89f, -1.02f, 0.14f,   -0.9935275f, -0.09740455f, 0.05844267f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ -0.93f, -0.89f, 0.17f,   -0.3889224f, 0.5833836f, -0.7130237f,   0.f, 0.f,   149, 149, 0, 255 },
+	{ -0.92f, -0.92f, 0.14f,   -0.3889224f, 0.5833836f, -0.7130237f,   0.f, 0.f,   149, 149, 0, 255 },
+	{ -0.96f, -0.91f, 0.17f,   -0.3889224f, 0.5833836f, -0.7130237f,   0.f, 0.f,   149, 149, 0, 255 },
+	{ -0.87f, -1.09f, 0.11f,   -0.09124142f, -0.9671597f, 0.2372277f,   0.f, 0.f,   247, 247, 0, 255 },
+	{ -0.79f, -1.1f, 0.1f,   -0.09124142f, -0.9671597f, 0.2372277f,   0.f, 0.f,   247, 247, 0, 255 },
+	{ -0.74f, -1.09f, 0.16f,   -0.09124142f, -0.9671597f, 0.2372277f,   0.f, 0.f,   247, 247, 0, 255 },
+	{ -0.74f, -1.09f, 0.16f,   0.05317039f, -0.9889701f, -0.138243f,   0.f, 0.f,   252, 252, 0, 255 },
+	{ -0.77f, -1.1f, 0.22f,   0.05317039f, -0.9889701f, -0.138243f,   0.f, 0.f,   252, 252, 0, 255 },
+	{ -0.87f, -1.09f, 0.11f,   0.05317039f, -0.9889701f, -0.138243f,   0.f, 0.f,   252, 252, 0, 255 },
+	{ -0.87f, -1.1f, 0.23f,   -0.008304268f, -0.9965115f, -0.08304253f,   0.f, 0.f,   254, 254, 0, 255 },
+	{ -0.87f, -1.09f, 0.11f,   -0.008304268f, -0.9965115f, -0.08304253f,   0.f, 0.f,   254, 254, 0, 255 },
+	{ -0.77f, -1.1f, 0.22f,   -0.008304268f, -0.9965115f, -0.08304253f,   0.f, 0.f,   254, 254, 0, 255 },
+	{ -0.89f, -0.99f, 0.19f,   -0.6355522f, -0.6620343f, 0.3972202f,   0.f, 0.f,   169, 169, 0, 255 },
+	{ -0.94f, -0.96f, 0.16f,   -0.6355522f, -0.6620343f, 0.3972202f,   0.f, 0.f,   169, 169, 0, 255 },
+	{ -0.89f, -1.02f, 0.14f,   -0.6355522f, -0.6620343f, 0.3972202f,   0.f, 0.f,   169, 169, 0, 255 },
+	{ -0.94f, -0.96f, 0.16f,   -0.5315642f, -0.1661141f, -0.8305693f,   0.f, 0.f,   42, 42, 0, 255 },
+	{ -0.89f, -0.97f, 0.13f,   -0.5315642f, -0.1661141f, -0.8305693f,   0.f, 0.f,   42, 42, 0, 255 },
+	{ -0.89f, -1.02f, 0.14f,   -0.5315642f, -0.1661141f, -0.8305693f,   0.f, 0.f,   42, 42, 0, 255 },
+	{ -0.85f, -0.98f, 0.2f,   -0.1841773f, -0.221013f, 0.9577223f,   0.f, 0.f,   56, 56, 0, 255 },
+	{ -0.91f, -0.93f, 0.2f,   -0.1841773f, -0.221013f, 0.9577223f,   0.f, 0.f,   56, 56, 0, 255 },
+	{ -0.89f, -0.99f, 0.19f,   -0.1841773f, -0.221013f, 0.9577223f,   0.f, 0.f,   56, 56, 0, 255 },
+	{ -0.85f, -0.98f, 0.2f,   0.571454f, 0.7619398f, 0.3047756f,   0.f, 0.f,   194, 194, 0, 255 },
+	{ -0.81f, -1.01f, 0.2f,   0.571454f, 0.7619398f, 0.3047756f,   0.f, 0.f,   194, 194, 0, 255 },
+	{ -0.81f, -0.99f, 0.15f,   0.571454f, 0.7619398f, 0.3047756f,   0.f, 0.f,   194, 194, 0, 255 },
+	{ -0.91f, -0.93f, 0.2f,   -0.6225125f, -0.3260784f, 0.7114429f,   0.f, 0.f,   83, 83, 0, 255 },
+	{ -0.94f, -0.96f, 0.16f,   -0.6225125f, -0.3260784f, 0.7114429f,   0.f, 0.f,   83, 83, 0, 255 },
+	{ -0.89f, -0.99f, 0.19f,   -0.6225125f, -0.3260784f, 0.7114429f,   0.f, 0.f,   83, 83, 0, 255 },
+	{ -0.81f, -0.99f, 0.15f,   0.5793245f, 0.3310427f, -0.7448448f,   0.f, 0.f,   84, 84, 0, 255 },
+	{ -0.74f, -1.09f, 0.16f,   0.5793245f, 0.3310427f, -0.7448448f,   0.f, 0.f,   84, 84, 0, 255 },
+	{ -0.83f, -1.f, 0.13f,   0.5793245f, 0.3310427f, -0.7448448f,   0.f, 0.f,   84, 84, 0, 255 },
+	{ -0.79f, -1.1f, 0.1f,   0.6501667f, 0.4448505f, -0.6159475f,   0.f, 0.f,   113, 113, 0, 255 },
+	{ -0.83f, -1.f, 0.13f,   0.6501667f, 0.4448505f, -0.6159475f,   0.f, 0.f,   113, 113, 0, 255 },
+	{ -0.74f, -1.09f, 0.16f,   0.6501667f, 0.4448505f, -0.6159475f,   0.f, 0.f,   113, 113, 0, 255 },
+	{ -0.79f, -1.1f, 0.1f,   -0.08872144f, 0.2534895f, -0.9632609f,   0.f, 0.f,   65, 65, 0, 255 },
+	{ -0.87f, -1.09f, 0.11f,   -0.08872144f, 0.2534895f, -0.9632609f,   0.f, 0.f,   65, 65, 0, 255 },
+	{ -0.83f, -1.f, 0.13f,   -0.08872144f, 0.2534895f, -0.9632609f,   0.f, 0.f,   65, 65, 0, 255 },
+	{ -0.87f, -1.09f, 0.11f,   -0.9667597f, -0.2452968f, -0.07214622f,   0.f, 0.f,   63, 63, 0, 255 },
+	{ -0.88f, -1.08f, 0.21f,   -0.9667597f, -0.2452968f, -0.07214622f,   0.f, 0.f,   63, 63, 0, 255 },
+	{ -0.89f, -1.02f, 0.14f,   -0.9667597f, -0.2452968f, -0.07214622f,   0.f, 0.f,   63, 63, 0, 255 },
+	{ -0.89f, -0.97f, 0.13f,   0.08908673f, 0.1781741f, -0.9799579f,   0.f, 0.f,   45, 45, 0, 255 },
+	{ -0.83f, -1.f, 0.13f,   0.08908673f, 0.1781741f, -0.9799579f,   0.f, 0.f,   45, 45, 0, 255 },
+	{ -0.87f, -1.09f, 0.11f,   0.08908673f, 0.1781741f, -0.9799579f,   0.f, 0.f,   45, 45, 0, 255 },
+	{ -0.89f, -1.02f, 0.14f,   -0.907265f, -0.08247861f, -0.4123924f,   0.f, 0.f,   21, 21, 0, 255 },
+	{ -0.89f, -0.97f, 0.13f,   -0.907265f, -0.08247861f, -0.4123924f,   0.f, 0.f,   21, 21, 0, 255 },
+	{ -0.87f, -1.09f, 0.11f,   -0.907265f, -0.08247861f, -0.4123924f,   0.f, 0.f,   21, 21, 0, 255 },
+	{ -0.85f, -0.98f, 0.2f,   -0.280397f, 0.1784344f, 0.9431536f,   0.f, 0.f,   46, 46, 0, 255 },
+	{ -0.89f, -0.99f, 0.19f,   -0.280397f, 0.1784344f, 0.9431536f,   0.f, 0.f,   46, 46, 0, 255 },
+	{ -0.88f, -1.08f, 0.21f,   -0.280397f, 0.1784344f, 0.9431536f,   0.f, 0.f,   46, 46, 0, 255 },
+	{ -0.87f, -1.1f, 0.23f,   -0.7177077f, 0.2791082f, 0.6379611f,   0.f, 0.f,   71, 71, 0, 255 },
+	{ -0.85f, -0.98f, 0.2f,   -0.7177077f, 0.2791082f, 0.6379611f,   0.f, 0.f,   71, 71, 0, 255 },
+	{ -0.88f, -1.08f, 0.21f,   -0.7177077f, 0.2791082f, 0.6379611f,   0.f, 0.f,   71, 71, 0, 255 },
+	{ -0.81f, -1.01f, 0.2f,   0.1605862f, 0.2141153f, 0.9635179f,   0.f, 0.f,   55, 55, 0, 255 },
+	{ -0.85f, -0.98f, 0.2f,   0.1605862f, 0.2141153f, 0.9635179f,   0.f, 0.f,   55, 55, 0, 255 },
+	{ -0.87f, -1.1f, 0.23f,   0.1605862f, 0.2141153f, 0.9635179f,   0.f, 0.f,   55, 55, 0, 255 },
+	{ 0.36f, -0.64f, 0.15f,   0.9698054f, -0.119565f, 0.2125598f,   0.f, 0.f,   30, 30, 0, 255 },
+	{ 0.35f, -0.8100001f, 0.09999999f,   0.9698054f, -0.119565f, 0.2125598f,   0.f, 0.f,   30, 30, 0, 255 },
+	{ 0.37f, -0.63f, 0.11f,   0.9698054f, -0.119565f, 0.2125598f,   0.f, 0.f,   30, 30, 0, 255 },
+	{ 0.33f, -0.67f, 0.17f,   -0.2687315f, -0.5598575f, 0.7838004f,   0.f, 0.f,   143, 143, 0, 255 },
+	{ 0.28f, -0.66f, 0.16f,   -0.2687315f, -0.5598575f, 0.7838004f,   0.f, 0.f,   143, 143, 0, 255 },
+	{ 0.28f, -0.73f, 0.11f,   -0.2687315f, -0.5598575f, 0.7838004f,   0.f, 0.f,   143, 143, 0, 255 },
+	{ 0.3f, -0.64f, 0.06999999f,   -0.267895f, -0.3409565f, -0.9010999f,   0.f, 0.f,   87, 87, 0, 255 },
+	{ 0.33f, -0.6900001f, 0.07999998f,   -0.267895f, -0.3409565f, -0.9010999f,   0.f, 0.f,   87, 87, 0, 255 },
+	{ 0.28f, -0.73f, 0.11f,   -0.267895f, -0.3409565f, -0.9010999f,   0.f, 0.f,   87, 87, 0, 255 },
+	{ 0.3f, -0.64f, 0.06999999f,   -0.361961f, -0.3102526f, -0.8790492f,   0.f, 0.f,   79, 79, 0, 255 },
+	{ 0.28f, -0.73f, 0.11f,   -0.361961f, -0.3102526f, -0.8790492f,   0.f, 0.f,   79, 79, 0, 255 },
+	{ 0.26f, -0.65f, 0.08999999f,   -0.361961f, -0.3102526f, -0.8790492f,   0.f, 0.f,   79, 79, 0, 255 },
+	{ 0.27f, -0.58f, 0.12f,   -0.9914308f, 0.1239291f, 0.04130966f,   0.f, 0.f,   32, 32, 0, 255 },
+	{ 0.26f, -0.65f, 0.08999999f,   -0.9914308f, 0.1239291f, 0.04130966f,   0.f, 0.f,   32, 32, 0, 255 },
+	{ 0.26f, -0.66f, 0.12f,   -0.9914308f, 0.1239291f, 0.04130966f,   0.f, 0.f,   32, 32, 0, 255 },
+	{ 0.27f, -0.58f, 0.12f,   -0.4925166f, -0.08491673f, -0.8661504f,   0.f, 0.f,   22, 22, 0, 255 },
+	{ 0.26f, -0.42f, 0.11f,   -0.4925166f, -0.08491673f, -0.8661504f,   0.f, 0.f,   22, 22, 0, 255 },
+	{ 0.3f, -0.55f, 0.09999999f,   -0.4925166f, -0.08491673f, -0.8661504f,   0.f, 0.f,   22, 22, 0, 255 },
+	{ 0.27f, -0.58f, 0.12f,   -0.7369677f, 0.3524629f, -0.576757f,   0.f, 0.f,   90, 90, 0, 255 },
+	{ 0.3f, -0.55f, 0.09999999f,   -0.7369677f, 0.3524629f, -0.576757f,   0.f, 0.f,   90, 90, 0, 255 },
+	{ 0.26f, -0.65f, 0.08999999f,   -0.7369677f, 0.3524629f, -0.576757f,   0.f, 0.f,   90, 90, 0, 255 },
+	{ 0.28f, -0.73f, 0.11f,   -0.8520127f, -0.3042904f, 0.4260066f,   0.f, 0.f,   78, 78, 0, 255 },
+	{ 0.28f, -0.66f, 0.16f,   -0.8520127f, -0.3042904f, 0.4260066f,   0.f, 0.f,   78, 78, 0, 255 },
+	{ 0.26f, -0.66f, 0.12f,   -0.8520127f, -0.3042904f, 0.4260066f,   0.f, 0.f,   78, 78, 0, 255 },
+	{ 0.26f, -0.65f, 0.08999999f,   -0.9610744f, -0.2621114f, -0.0873704f,   0.f, 0.f,   67, 67, 0, 255 },
+	{ 0.28f, -0.73f, 0.11f,   -0.9610744f, -0.2621114f, -0.0873704f,   0.f, 0.f,   67, 67, 0, 255 },
+	{ 0.26f, -0.66f, 0.12f,   -0.9610744f, -0.2621114f, -0.0873704f,   0.f, 0.f,   67, 67, 0, 255 },
+	{ 0.33f, -0.85f, 0.14f,   0.6350006f, -0.1270001f, 0.7620008f,   0.f, 0.f,   32, 32, 0, 255 },
+	{ 0.36f, -0.64f, 0.15f,   0.6350006f, -0.1270001f, 0.7620008f,   0.f, 0.f,   32, 32, 0, 255 },
+	{ 0.33f, -0.67f, 0.17f,   0.6350006f, -0.1270001f, 0.7620008f,   0.f, 0.f,   32, 32, 0, 255 },
+	{ 0.29f, -0.89f, 0.11f,   -0.5763088f, -0.03601926f, 0.8164378f,   0.f, 0.f,   9, 9, 0, 255 },
+	{ 0.33f, -0.85f, 0.14f,   -0.5763088f, -0.03601926f, 0.8164378f,   0.f, 0.f,   9, 9, 0, 255 },
+	{ 0.28f, -0.73f, 0.11f,   -0.5763088f, -0.03601926f, 0.8164378f,   0.f, 0.f,   9, 9, 0, 255 },
+	{ 0.36f, -0.92f, 0.11f,   0.8318905f, 0.1247837f, 0.5407284f,   0.f, 0.f,   32, 32, 0, 255 },
+	{ 0.35f, -0.8100001f, 0.09999999f,   0.8318905f, 0.1247837f, 0.5407284f,   0.f, 0.f,   32, 32, 0, 255 },
+	{ 0.33f, -0.85f, 0.14f,   0.8318905f, 0.1247837f, 0.5407284f,   0.f, 0.f,   32, 32, 0, 255 },
+	{ 0.29f, -0.89f, 0.11f,   -0.4959006f, -0.03099375f, -0.867826f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ 0.28f, -0.73f, 0.11f,   -0.4959006f, -0.03099375f, -0.867826f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ 0.33f, -0.6900001f, 0.07999998f,   -0.4959006f, -0.03099375f, -0.867826f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ 0.35f, -0.8100001f, 0.09999999f,   0.9359584f, -0.1489025f, 0.3190764f,   0.f, 0.f,   38, 38, 0, 255 },
+	{ 0.36f, -0.64f, 0.15f,   0.9359584f, -0.1489025f, 0.3190764f,   0.f, 0.f,   38, 38, 0, 255 },
+	{ 0.33f, -0.85f, 0.14f,   0.9359584f, -0.1489025f, 0.3190764f,   0.f, 0.f,   38, 38, 0, 255 },
+	{ 0.28f, -0.73f, 0.11f,   -0.7022468f, -0.1170412f, 0.7022469f,   0.f, 0.f,   30, 30, 0, 255 },
+	{ 0.33f, -0.85f, 0.14f,   -0.7022468f, -0.1170412f, 0.7022469f,   0.f, 0.f,   30, 30, 0, 255 },
+	{ 0.33f, -0.67f, 0.17f,   -0.7022468f, -0.1170412f, 0.7022469f,   0.f, 0.f,   30, 30, 0, 255 },
+	{ 0.34f, -0.44f, 0.11f,   0.8378388f, 0.01948455f, -0.5455698f,   0.f, 0.f,   5, 5, 0, 255 },
+	{ 0.36f, -0.46f, 0.14f,   0.8378388f, 0.01948455f, -0.5455698f,   0.f, 0.f,   5, 5, 0, 255 },
+	{ 0.35f, -0.59f, 0.12f,   0.8378388f, 0.01948455f, -0.5455698f,   0.f, 0.f,   5, 5, 0, 255 },
+	{ 0.33f, -0.6900001f, 0.07999998f,   0.6811147f, -0.09081495f, -0.7265227f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ 0.35f, -0.62f, 0.08999999f,   0.6811147f, -0.09081495f, -0.7265227f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ 0.37f, -0.63f, 0.11f,   0.6811147f, -0.09081495f, -0.7265227f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ 0.33f, -0.6900001f, 0.07999998f,   0.360831f, 0.03006933f, -0.9321463f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ 0.3f, -0.64f, 0.06999999f,   0.360831f, 0.03006933f, -0.9321463f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ 0.35f, -0.62f, 0.08999999f,   0.360831f, 0.03006933f, -0.9321463f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ 0.36f, -0.46f, 0.14f,   0.7908686f, -0.01492215f, 0.611804f,   0.f, 0.f,   4, 4, 0, 255 },
+	{ 0.33f, -0.41f, 0.18f,   0.7908686f, -0.01492215f, 0.611804f,   0.f, 0.f,   4, 4, 0, 255 },
+	{ 0.35f, -0.58f, 0.15f,   0.7908686f, -0.01492215f, 0.611804f,   0.f, 0.f,   4, 4, 0, 255 },
+	{ 0.27f, -0.59f, 0.15f,   -0.2207552f, -0.08830222f, 0.9713237f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ 0.31f, -0.58f, 0.16f,   -0.2207552f, -0.08830222f, 0.9713237f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ 0.33f, -0.41f, 0.18f,   -0.2207552f, -0.08830222f, 0.9713237f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ 0.31f, -0.58f, 0.16f,   0.2401042f, -0.1412379f, 0.9604175f,   0.f, 0.f,   36, 36, 0, 255 },
+	{ 0.35f, -0.58f, 0.15f,   0.2401042f, -0.1412379f, 0.9604175f,   0.f, 0.f,   36, 36, 0, 255 },
+	{ 0.33f, -0.41f, 0.18f,   0.2401042f, -0.1412379f, 0.9604175f,   0.f, 0.f,   36, 36, 0, 255 },
+	{ 0.26f, -0.42f, 0.11f,   0.02075687f, 0.08302758f, -0.9963311f,   0.f, 0.f,   21, 21, 0, 255 },
+	{ 0.34f, -0.44f, 0.11f,   0.02075687f, 0.08302758f, -0.9963311f,   0.f, 0.f,   21, 21, 0, 255 },
+	{ 0.3f, -0.55f, 0.09999999f,   0.02075687f, 0.08302758f, -0.9963311f,   0.f, 0.f,   21, 21, 0, 255 },
+	{ 0.33f, -0.55f, 0.09999999f,   0.f, 0.09053572f, -0.9958932f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ 0.32f, -0.55f, 0.09999999f,   0.f, 0.09053572f, -0.9958932f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ 0.34f, -0.44f, 0.11f,   0.f, 0.09053572f, -0.9958932f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ 0.3f, -0.55f, 0.09999999f,   0.f, 0.09053572f, -0.9958932f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ 0.28f, -0.66f, 0.16f,   -0.8926073f, -0.06375757f, 0.4463039f,   0.f, 0.f,   16, 16, 0, 255 },
+	{ 0.27f, -0.59f, 0.15f,   -0.8926073f, -0.06375757f, 0.4463039f,   0.f, 0.f,   16, 16, 0, 255 },
+	{ 0.26f, -0.66f, 0.12f,   -0.8926073f, -0.06375757f, 0.4463039f,   0.f, 0.f,   16, 16, 0, 255 },
+	{ 0.33f, -0.67f, 0.17f,   0.4944511f, 0.08240877f, 0.86529f,   0.f, 0.f,   21, 21, 0, 255 },
+	{ 0.36f, -0.64f, 0.15f,   0.4944511f, 0.08240877f, 0.86529f,   0.f, 0.f,   21, 21, 0, 255 },
+	{ 0.35f, -0.58f, 0.15f,   0.4944511f, 0.08240877f, 0.86529f,   0.f, 0.f,   21, 21, 0, 255 },
+	{ 0.33f, -0.67f, 0.17f,   -0.1824792f, 0.06842973f, 0.9808255f,   0.f, 0.f,   17, 17, 0, 255 },
+	{ 0.31f, -0.58f, 0.16f,   -0.1824792f, 0.06842973f, 0.9808255f,   0.f, 0.f,   17, 17, 0, 255 },
+	{ 0.28f, -0.66f, 0.16f,   -0.1824792f, 0.06842973f, 0.9808255f,   0.f, 0.f,   17, 17, 0, 255 },
+	{ 0.33f, -0.67f, 0.17f,   0.2394259f, 0.1596175f, 0.9577042f,   0.f, 0.f,   41, 41, 0, 255 },
+	{ 0.35f, -0.58f, 0.15f,   0.2394259f, 0.1596175f, 0.9577042f,   0.f, 0.f,   41, 41, 0, 255 },
+	{ 0.31f, -0.58f, 0.16f,   0.2394259f, 0.1596175f, 0.9577042f,   0.f, 0.f,   41, 41, 0, 255 },
+	{ 0.3f, -0.64f, 0.06999999f,   0.2871835f, 0.2153874f, -0.9333455f,   0.f, 0.f,   55, 55, 0, 255 },
+	{ 0.33f, -0.55f, 0.09999999f,   0.2871835f, 0.2153874f, -0.9333455f,   0.f, 0.f,   55, 55, 0, 255 },
+	{ 0.35f, -0.62f, 0.08999999f,   0.2871835f, 0.2153874f, -0.9333455f,   0.f, 0.f,   55, 55, 0, 255 },
+	{ 0.28f, -0.96f, 0.12f,   -0.9649438f, 0.1033868f, -0.2412357f,   0.f, 0.f,   26, 26, 0, 255 },
+	{ 0.29f, -0.89f, 0.11f,   -0.9649438f, 0.1033868f, -0.2412357f,   0.f, 0.f,   26, 26, 0, 255 },
+	{ 0.29f, -0.96f, 0.07999998f,   -0.9649438f, 0.1033868f, -0.2412357f,   0.f, 0.f,   26, 26, 0, 255 },
+	{ 0.33f, -1.01f, 0.07999998f,   -0.1476204f, -0.09841358f, -0.9841356f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ 0.33f, -0.91f, 0.06999999f,   -0.1476204f, -0.09841358f, -0.9841356f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ 0.39f, -1.f, 0.06999999f,   -0.1476204f, -0.09841358f, -0.9841356f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ 0.29f, -0.96f, 0.07999998f,   -0.5854708f, 0.3193479f, -0.7451449f,   0.f, 0.f,   81, 81, 0, 255 },
+	{ 0.29f, -0.89f, 0.11f,   -0.5854708f, 0.3193479f, -0.7451449f,   0.f, 0.f,   81, 81, 0, 255 },
+	{ 0.33f, -0.91f, 0.06999999f,   -0.5854708f, 0.3193479f, -0.7451449f,   0.f, 0.f,   81, 81, 0, 255 },
+	{ 0.36f, -0.92f, 0.11f,   0.8834668f, 0.1963257f, 0.4253736f,   0.f, 0.f,   50, 50, 0, 255 },
+	{ 0.33f, -0.85f, 0.14f,   0.8834668f, 0.1963257f, 0.4253736f,   0.f, 0.f,   50, 50, 0, 255 },
+	{ 0.35f, -0.9400001f, 0.14f,   0.8834668f, 0.1963257f, 0.4253736f,   0.f, 0.f,   50, 50, 0, 255 },
+	{ 0.33f, -1.01f, 0.07999998f,   -0.1234284f, -0.09874288f, -0.9874287f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ 0.29f, -0.96f, 0.07999998f,   -0.1234284f, -0.09874288f, -0.9874287f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ 0.33f, -0.91f, 0.06999999f,   -0.1234284f, -0.09874288f, -0.9874287f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ 0.33f, -0.85f, 0.14f,   0.f, 0.f, 1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.33f, -0.85f, 0.14f,   -0.5773503f, 0.1154701f, 0.8082904f,   0.f, 0.f,   29, 29, 0, 255 },
+	{ 0.28f, -0.96f, 0.12f,   -0.5773503f, 0.1154701f, 0.8082904f,   0.f, 0.f,   29, 29, 0, 255 },
+	{ 0.31f, -0.95f, 0.14f,   -0.5773503f, 0.1154701f, 0.8082904f,   0.f, 0.f,   29, 29, 0, 255 },
+	{ 0.36f, -0.92f, 0.11f,   0.8020936f, 0.01865351f, -0.5969069f,   0.f, 0.f,   5, 5, 0, 255 },
+	{ 0.33f, -0.91f, 0.06999999f,   0.8020936f, 0.01865351f, -0.5969069f,   0.f, 0.f,   5, 5, 0, 255 },
+	{ 0.35f, -0.8100001f, 0.09999999f,   0.8020936f, 0.01865351f, -0.5969069f,   0.f, 0.f,   5, 5, 0, 255 },
+	{ 0.36f, -0.92f, 0.11f,   0.7334546f, 0.5378667f, -0.4156244f,   0.f, 0.f,   137, 137, 0, 255 },
+	{ 0.4f, -0.99f, 0.08999999f,   0.7334546f, 0.5378667f, -0.4156244f,   0.f, 0.f,   137, 137, 0, 255 },
+	{ 0.33f, -0.91f, 0.06999999f,   0.7334546f, 0.5378667f, -0.4156244f,   0.f, 0.f,   137, 137, 0, 255 },
+	{ 0.31f, -0.58f, 0.16f,   -0.2646163f, 0.09923112f, 0.9592348f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ 0.27f, -0.59f, 0.15f,   -0.2646163f, 0.09923112f, 0.9592348f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ 0.28f, -0.66f, 0.16f,   -0.2646163f, 0.09923112f, 0.9592348f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ 0.37f, -0.63f, 0.11f,   0.947943f, 0.157991f, 0.2764831f,   0.f, 0.f,   40, 40, 0, 255 },
+	{ 0.35f, -0.58f, 0.15f,   0.947943f, 0.157991f, 0.2764831f,   0.f, 0.f,   40, 40, 0, 255 },
+	{ 0.36f, -0.64f, 0.15f,   0.947943f, 0.157991f, 0.2764831f,   0.f, 0.f,   40, 40, 0, 255 },
+	{ 0.35f, -0.59f, 0.12f,   0.8669211f, 0.4728667f, -0.1576221f,   0.f, 0.f,   121, 121, 0, 255 },
+	{ 0.35f, -0.58f, 0.15f,   0.8669211f, 0.4728667f, -0.1576221f,   0.f, 0.f,   121, 121, 0, 255 },
+	{ 0.37f, -0.63f, 0.11f,   0.8669211f, 0.4728667f, -0.1576221f,   0.f, 0.f,   121, 121, 0, 255 },
+	{ 0.35f, -0.59f, 0.12f,   0.9963676f, -0.08078672f, 0.02692887f,   0.f, 0.f,   21, 21, 0, 255 },
+	{ 0.36f, -0.46f, 0.14f,   0.9963676f, -0.08078672f, 0.02692887f,   0.f, 0.f,   21, 21, 0, 255 },
+	{ 0.35f, -0.58f, 0.15f,   0.9963676f, -0.08078672f, 0.02692887f,   0.f, 0.f,   21, 21, 0, 255 },
+	{ 0.26f, -0.66f, 0.12f,   -0.9914308f, 0.1239291f, 0.04130964f,   0.f, 0.f,   32, 32, 0, 255 },
+	{ 0.27f, -0.59f, 0.15f,   -0.9914308f, 0.1239291f, 0.04130964f,   0.f, 0.f,   32, 32, 0, 255 },
+	{ 0.27f, -0.58f, 0.12f,   -0.9914308f, 0.1239291f, 0.04130964f,   0.f, 0.f,   32, 32, 0, 255 },
+	{ 0.3f, -0.55f, 0.09999999f,   0.f, 0.3162279f, -0.9486833f,   0.f, 0.f,   81, 81, 0, 255 },
+	{ 0.33f, -0.55f, 0.09999999f,   0.f, 0.3162279f, -0.9486833f,   0.f, 0.f,   81, 81, 0, 255 },
+	{ 0.3f, -0.64f, 0.06999999f,   0.f, 0.3162279f, -0.9486833f,   0.f, 0.f,   81, 81, 0, 255 },
+	{ 0.3f, -0.55f, 0.09999999f,   -0.4842002f, 0.2766858f, -0.8300572f,   0.f, 0.f,   71, 71, 0, 255 },
+	{ 0.3f, -0.64f, 0.06999999f,   -0.4842002f, 0.2766858f, -0.8300572f,   0.f, 0.f,   71, 71, 0, 255 },
+	{ 0.26f, -0.65f, 0.08999999f,   -0.4842002f, 0.2766858f, -0.8300572f,   0.f, 0.f,   71, 71, 0, 255 },
+	{ 0.35f, -0.59f, 0.12f,   0.9045342f, 0.3015111f, -0.3015109f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ 0.35f, -0.62f, 0.08999999f,   0.9045342f, 0.3015111f, -0.3015109f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ 0.33f, -0.55f, 0.09999999f,   0.9045342f, 0.3015111f, -0.3015109f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ 0.37f, -0.63f, 0.11f,   0.7276065f, 0.4850717f, -0.4850714f,   0.f, 0.f,   124, 124, 0, 255 },
+	{ 0.35f, -0.62f, 0.08999999f,   0.7276065f, 0.4850717f, -0.4850714f,   0.f, 0.f,   124, 124, 0, 255 },
+	{ 0.35f, -0.59f, 0.12f,   0.7276065f, 0.4850717f, -0.4850714f,   0.f, 0.f,   124, 124, 0, 255 },
+	{ 0.34f, -0.44f, 0.11f,   0.707107f, 0.f, -0.7071065f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.35f, -0.59f, 0.12f,   0.707107f, 0.f, -0.7071065f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.33f, -0.55f, 0.09999999f,   0.707107f, 0.f, -0.7071065f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.88f, -0.5700001f, 0.13f,   0.3456913f, -0.2880759f, -0.893034f,   0.f, 0.f,   73, 73, 0, 255 },
+	{ -0.87f, -0.62f, 0.1500001f,   0.3456913f, -0.2880759f, -0.893034f,   0.f, 0.f,   73, 73, 0, 255 },
+	{ -0.92f, -0.6800001f, 0.1500001f,   0.3456913f, -0.2880759f, -0.893034f,   0.f, 0.f,   73, 73, 0, 255 },
+	{ -0.97f, -0.58f, 0.1800001f,   -0.2425229f, -0.01010511f, 0.9700931f,   0.f, 0.f,   3, 3, 0, 255 },
+	{ -0.92f, -0.8200001f, 0.19f,   -0.2425229f, -0.01010511f, 0.9700931f,   0.f, 0.f,   3, 3, 0, 255 },
+	{ -0.93f, -0.58f, 0.19f,   -0.2425229f, -0.01010511f, 0.9700931f,   0.f, 0.f,   3, 3, 0, 255 },
+	{ -0.92f, -0.8200001f, 0.19f,   -0.3744979f, -0.0394209f, 0.9263893f,   0.f, 0.f,   10, 10, 0, 255 },
+	{ -0.97f, -0.58f, 0.1800001f,   -0.3744979f, -0.0394209f, 0.9263893f,   0.f, 0.f,   10, 10, 0, 255 },
+	{ -0.96f, -0.91f, 0.17f,   -0.3744979f, -0.0394209f, 0.9263893f,   0.f, 0.f,   10, 10, 0, 255 },
+	{ -0.87f, -0.62f, 0.1500001f,   0.9941349f, -0.07647185f, 0.07647178f,   0.f, 0.f,   20, 20, 0, 255 },
+	{ -0.87f, -0.5700001f, 0.2f,   0.9941349f, -0.07647185f, 0.07647178f,   0.f, 0.f,   20, 20, 0, 255 },
+	{ -0.88f, -0.72f, 0.1800001f,   0.9941349f, -0.07647185f, 0.07647178f,   0.f, 0.f,   20, 20, 0, 255 },
+	{ -0.92f, -0.54f, 0.13f,   -0.1054745f, -0.1406325f, -0.9844276f,   0.f, 0.f,   36, 36, 0, 255 },
+	{ -0.88f, -0.5700001f, 0.13f,   -0.1054745f, -0.1406325f, -0.9844276f,   0.f, 0.f,   36, 36, 0, 255 },
+	{ -0.92f, -0.6800001f, 0.1500001f,   -0.1054745f, -0.1406325f, -0.9844276f,   0.f, 0.f,   36, 36, 0, 255 },
+	{ -0.92f, -0.54f, 0.13f,   -0.659276f, -0.1063349f, -0.7443439f,   0.f, 0.f,   27, 27, 0, 255 },
+	{ -0.92f, -0.6800001f, 0.1500001f,   -0.659276f, -0.1063349f, -0.7443439f,   0.f, 0.f,   27, 27, 0, 255 },
+	{ -0.97f, -0.58f, 0.1800001f,   -0.659276f, -0.1063349f, -0.7443439f,   0.f, 0.f,   27, 27, 0, 255 },
+	{ -0.89f, -0.83f, 0.1500001f,   0.9953712f, -0.09479715f, 0.01579951f,   0.f, 0.f,   24, 24, 0, 255 },
+	{ -0.87f, -0.62f, 0.1500001f,   0.9953712f, -0.09479715f, 0.01579951f,   0.f, 0.f,   24, 24, 0, 255 },
+	{ -0.88f, -0.72f, 0.1800001f,   0.9953712f, -0.09479715f, 0.01579951f,   0.f, 0.f,   24, 24, 0, 255 },
+	{ -0.93f, -0.58f, 0.19f,   -0.5338604f, -0.02224416f, 0.8452799f,   0.f, 0.f,   6, 6, 0, 255 },
+	{ -0.92f, -0.8200001f, 0.19f,   -0.5338604f, -0.02224416f, 0.8452799f,   0.f, 0.f,   6, 6, 0, 255 },
+	{ -0.9f, -0.54f, 0.21f,   -0.5338604f, -0.02224416f, 0.8452799f,   0.f, 0.f,   6, 6, 0, 255 },
+	{ -0.88f, -0.72f, 0.1800001f,   0.01843609f, 0.09218259f, 0.9955714f,   0.f, 0.f,   24, 24, 0, 255 },
+	{ -0.92f, -0.8200001f, 0.19f,   0.01843609f, 0.09218259f, 0.9955714f,   0.f, 0.f,   24, 24, 0, 255 },
+	{ -0.91f, -0.93f, 0.2f,   0.01843609f, 0.09218259f, 0.9955714f,   0.f, 0.f,   24, 24, 0, 255 },
+	{ -0.97f, -0.58f, 0.1800001f,   -0.01978938f, 0.02968407f, -0.9993634f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ -0.93f, -0.89f, 0.17f,   -0.01978938f, 0.02968407f, -0.9993634f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ -0.96f, -0.91f, 0.17f,   -0.01978938f, 0.02968407f, -0.9993634f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ -0.87f, -0.91f, 0.19f,   0.2125333f, 0.06250972f, 0.9751524f,   0.f, 0.f,   16, 16, 0, 255 },
+	{ -0.88f, -0.72f, 0.1800001f,   0.2125333f, 0.06250972f, 0.9751524f,   0.f, 0.f,   16, 16, 0, 255 },
+	{ -0.91f, -0.93f, 0.2f,   0.2125333f, 0.06250972f, 0.9751524f,   0.f, 0.f,   16, 16, 0, 255 },
+	{ -0.87f, -0.5700001f, 0.2f,   0.2365727f, -0.08602647f, 0.9677979f,   0.f, 0.f,   22, 22, 0, 255 },
+	{ -0.9f, -0.54f, 0.21f,   0.2365727f, -0.08602647f, 0.9677979f,   0.f, 0.f,   22, 22, 0, 255 },
+	{ -0.92f, -0.8200001f, 0.19f,   0.2365727f, -0.08602647f, 0.9677979f,   0.f, 0.f,   22, 22, 0, 255 },
+	{ -0.88f, -0.72f, 0.1800001f,   0.5673268f, -0.1458841f, 0.8104678f,   0.f, 0.f,   37, 37, 0, 255 },
+	{ -0.87f, -0.5700001f, 0.2f,   0.5673268f, -0.1458841f, 0.8104678f,   0.f, 0.f,   37, 37, 0, 255 },
+	{ -0.92f, -0.8200001f, 0.19f,   0.5673268f, -0.1458841f, 0.8104678f,   0.f, 0.f,   37, 37, 0, 255 },
+	{ -0.8f, -0.34f, 0.22f,   -0.4903415f, 0.138776f, 0.8604106f,   0.f, 0.f,   35, 35, 0, 255 },
+	{ -0.89f, -0.41f, 0.1800001f,   -0.4903415f, 0.138776f, 0.8604106f,   0.f, 0.f,   35, 35, 0, 255 },
+	{ -0.86f, -0.49f, 0.21f,   -0.4903415f, 0.138776f, 0.8604106f,   0.f, 0.f,   35, 35, 0, 255 },
+	{ -0.86f, -0.31f, 0.19f,   -0.4311239f, 0.03919299f, 0.9014412f,   0.f, 0.f,   10, 10, 0, 255 },
+	{ -0.89f, -0.41f, 0.1800001f,   -0.4311239f, 0.03919299f, 0.9014412f,   0.f, 0.f,   10, 10, 0, 255 },
+	{ -0.8f, -0.34f, 0.22f,   -0.4311239f, 0.03919299f, 0.9014412f,   0.f, 0.f,   10, 10, 0, 255 },
+	{ -0.93f, -0.52f, 0.21f,   -0.4879498f, 0.3903599f, 0.7807203f,   0.f, 0.f,   100, 100, 0, 255 },
+	{ -0.89f, -0.41f, 0.1800001f,   -0.4879498f, 0.3903599f, 0.7807203f,   0.f, 0.f,   100, 100, 0, 255 },
+	{ -0.97f, -0.5100001f, 0.1800001f,   -0.4879498f, 0.3903599f, 0.7807203f,   0.f, 0.f,   100, 100, 0, 255 },
+	{ -0.93f, -0.52f, 0.21f,   -0.1306271f, 0.3047962f, 0.9434172f,   0.f, 0.f,   78, 78, 0, 255 },
+	{ -0.86f, -0.49f, 0.21f,   -0.1306271f, 0.3047962f, 0.9434172f,   0.f, 0.f,   78, 78, 0, 255 },
+	{ -0.89f, -0.41f, 0.1800001f,   -0.1306271f, 0.3047962f, 0.9434172f,   0.f, 0.f,   78, 78, 0, 255 },
+	{ -0.82f, -0.5100001f, 0.18f,   0.47084f, -0.7087377f, 0.5253575f,   0.f, 0.f,   181, 181, 0, 255 },
+	{ -0.67f, -0.44f, 0.14f,   0.47084f, -0.7087377f, 0.5253575f,   0.f, 0.f,   181, 181, 0, 255 },
+	{ -0.65f, -0.36f, 0.23f,   0.47084f, -0.7087377f, 0.5253575f,   0.f, 0.f,   181, 181, 0, 255 },
+	{ -0.86f, -0.49f, 0.21f,   0.2848068f, -0.5777512f, 0.7649108f,   0.f, 0.f,   147, 147, 0, 255 },
+	{ -0.82f, -0.5100001f, 0.18f,   0.2848068f, -0.5777512f, 0.7649108f,   0.f, 0.f,   147, 147, 0, 255 },
+	{ -0.65f, -0.36f, 0.23f,   0.2848068f, -0.5777512f, 0.7649108f,   0.f, 0.f,   147, 147, 0, 255 },
+	{ -0.8f, -0.34f, 0.22f,   -0.07149488f, -0.03785017f, 0.9967225f,   0.f, 0.f,   10, 10, 0, 255 },
+	{ -0.86f, -0.49f, 0.21f,   -0.07149488f, -0.03785017f, 0.9967225f,   0.f, 0.f,   10, 10, 0, 255 },
+	{ -0.65f, -0.36f, 0.23f,   -0.07149488f, -0.03785017f, 0.9967225f,   0.f, 0.f,   10, 10, 0, 255 },
+	{ -0.97f, -0.5100001f, 0.1800001f,   -0.9486828f, -0.f, -0.3162292f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.96f, -0.52f, 0.1500001f,   -0.9486828f, -0.f, -0.3162292f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.97f, -0.58f, 0.1800001f,   -0.9486828f, -0.f, -0.3162292f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.89f, -0.41f, 0.1800001f,   -0.6417563f, 0.5532381f, -0.5311087f,   0.f, 0.f,   141, 141, 0, 255 },
+	{ -0.84f, -0.4f, 0.13f,   -0.6417563f, 0.5532381f, -0.5311087f,   0.f, 0.f,   141, 141, 0, 255 },
+	{ -0.96f, -0.52f, 0.1500001f,   -0.6417563f, 0.5532381f, -0.5311087f,   0.f, 0.f,   141, 141, 0, 255 },
+	{ -0.96f, -0.52f, 0.1500001f,   -0.7071064f, 0.5656853f, -0.4242649f,   0.f, 0.f,   144, 144, 0, 255 },
+	{ -0.97f, -0.5100001f, 0.1800001f,   -0.7071064f, 0.5656853f, -0.4242649f,   0.f, 0.f,   144, 144, 0, 255 },
+	{ -0.89f, -0.41f, 0.1800001f,   -0.7071064f, 0.5656853f, -0.4242649f,   0.f, 0.f,   144, 144, 0, 255 },
+	{ -0.87f, -0.3200001f, 0.16f,   -0.7071068f, -2.010092e-07f, -0.7071067f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.84f, -0.4f, 0.13f,   -0.7071068f, -2.010092e-07f, -0.7071067f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.89f, -0.41f, 0.1800001f,   -0.7071068f, -2.010092e-07f, -0.7071067f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.86f, -0.31f, 0.19f,   -0.9389098f, 0.2590094f, 0.2266327f,   0.f, 0.f,   66, 66, 0, 255 },
+	{ -0.87f, -0.3200001f, 0.16f,   -0.9389098f, 0.2590094f, 0.2266327f,   0.f, 0.f,   66, 66, 0, 255 },
+	{ -0.89f, -0.41f, 0.1800001f,   -0.9389098f, 0.2590094f, 0.2266327f,   0.f, 0.f,   66, 66, 0, 255 },
+	{ 0.31f, -0.29f, 0.22f,   -0.2279211f, -0.3418817f, 0.9116847f,   0.f, 0.f,   87, 87, 0, 255 },
+	{ 0.25f, -0.33f, 0.19f,   -0.2279211f, -0.3418817f, 0.9116847f,   0.f, 0.f,   87, 87, 0, 255 },
+	{ 0.33f, -0.41f, 0.18f,   -0.2279211f, -0.3418817f, 0.9116847f,   0.f, 0.f,   87, 87, 0, 255 },
+	{ 0.27f, -0.58f, 0.12f,   -0.9844982f, -0.1663941f, -0.05546462f,   0.f, 0.f,   42, 42, 0, 255 },
+	{ 0.27f, -0.59f, 0.15f,   -0.9844982f, -0.1663941f, -0.05546462f,   0.f, 0.f,   42, 42, 0, 255 },
+	{ 0.23f, -0.35f, 0.14f,   -0.9844982f, -0.1663941f, -0.05546462f,   0.f, 0.f,   42, 42, 0, 255 },
+	{ 0.27f, -0.59f, 0.15f,   -0.03086073f, -0.1543033f, 0.9875414f,   0.f, 0.f,   39, 39, 0, 255 },
+	{ 0.33f, -0.41f, 0.18f,   -0.03086073f, -0.1543033f, 0.9875414f,   0.f, 0.f,   39, 39, 0, 255 },
+	{ 0.25f, -0.33f, 0.19f,   -0.03086073f, -0.1543033f, 0.9875414f,   0.f, 0.f,   39, 39, 0, 255 },
+	{ 0.27f, -0.59f, 0.15f,   -0.9007677f, -0.1329002f, 0.413467f,   0.f, 0.f,   34, 34, 0, 255 },
+	{ 0.25f, -0.33f, 0.19f,   -0.9007677f, -0.1329002f, 0.413467f,   0.f, 0.f,   34, 34, 0, 255 },
+	{ 0.23f, -0.35f, 0.14f,   -0.9007677f, -0.1329002f, 0.413467f,   0.f, 0.f,   34, 34, 0, 255 },
+	{ -0.86f, -0.92f, 0.1500001f,   0.9718072f, 0.06310429f, 0.2271755f,   0.f, 0.f,   16, 16, 0, 255 },
+	{ -0.88f, -0.72f, 0.1800001f,   0.9718072f, 0.06310429f, 0.2271755f,   0.f, 0.f,   16, 16, 0, 255 },
+	{ -0.87f, -0.91f, 0.19f,   0.9718072f, 0.06310429f, 0.2271755f,   0.f, 0.f,   16, 16, 0, 255 },
+	{ -0.89f, -0.83f, 0.1500001f,   -0.09386451f, 0.1407971f, -0.9855788f,   0.f, 0.f,   36, 36, 0, 255 },
+	{ -0.89f, -0.97f, 0.13f,   -0.09386451f, 0.1407971f, -0.9855788f,   0.f, 0.f,   36, 36, 0, 255 },
+	{ -0.92f, -0.92f, 0.14f,   -0.09386451f, 0.1407971f, -0.9855788f,   0.f, 0.f,   36, 36, 0, 255 },
+	{ -0.86f, -0.92f, 0.1500001f,   0.3905672f, 0.130189f, -0.9113222f,   0.f, 0.f,   33, 33, 0, 255 },
+	{ -0.89f, -0.97f, 0.13f,   0.3905672f, 0.130189f, -0.9113222f,   0.f, 0.f,   33, 33, 0, 255 },
+	{ -0.89f, -0.83f, 0.1500001f,   0.3905672f, 0.130189f, -0.9113222f,   0.f, 0.f,   33, 33, 0, 255 },
+	{ 0.27f, -0.58f, 0.12f,   -0.798697f, -0.08713063f, -0.5953918f,   0.f, 0.f,   22, 22, 0, 255 },
+	{ 0.23f, -0.35f, 0.14f,   -0.798697f, -0.08713063f, -0.5953918f,   0.f, 0.f,   22, 22, 0, 255 },
+	{ 0.26f, -0.42f, 0.11f,   -0.798697f, -0.08713063f, -0.5953918f,   0.f, 0.f,   22, 22, 0, 255 },
+	{ 0.26f, -0.42f, 0.11f,   -0.03871302f, -0.1548515f, -0.9871789f,   0.f, 0.f,   39, 39, 0, 255 },
+	{ 0.25f, -0.29f, 0.09f,   -0.03871302f, -0.1548515f, -0.9871789f,   0.f, 0.f,   39, 39, 0, 255 },
+	{ 0.29f, -0.3f, 0.08999999f,   -0.03871302f, -0.1548515f, -0.9871789f,   0.f, 0.f,   39, 39, 0, 255 },
+	{ 0.29f, -0.3f, 0.08999999f,   0.2628646f, -0.04381079f, -0.9638374f,   0.f, 0.f,   11, 11, 0, 255 },
+	{ 0.37f, -0.2600001f, 0.11f,   0.2628646f, -0.04381079f, -0.9638374f,   0.f, 0.f,   11, 11, 0, 255 },
+	{ 0.34f, -0.44f, 0.11f,   0.2628646f, -0.04381079f, -0.9638374f,   0.f, 0.f,   11, 11, 0, 255 },
+	{ 0.34f, -0.44f, 0.11f,   -0.03871285f, -0.1548516f, -0.9871789f,   0.f, 0.f,   39, 39, 0, 255 },
+	{ 0.26f, -0.42f, 0.11f,   -0.03871285f, -0.1548516f, -0.9871789f,   0.f, 0.f,   39, 39, 0, 255 },
+	{ 0.29f, -0.3f, 0.08999999f,   -0.03871285f, -0.1548516f, -0.9871789f,   0.f, 0.f,   39, 39, 0, 255 },
+	{ 0.36f, -0.46f, 0.14f,   0.5263157f, -0.3157895f, 0.7894737f,   0.f, 0.f,   81, 81, 0, 255 },
+	{ 0.36f, -0.2600001f, 0.22f,   0.5263157f, -0.3157895f, 0.7894737f,   0.f, 0.f,   81, 81, 0, 255 },
+	{ 0.33f, -0.41f, 0.18f,   0.5263157f, -0.3157895f, 0.7894737f,   0.f, 0.f,   81, 81, 0, 255 },
+	{ -0.97f, -0.58f, 0.1800001f,   -0.5845215f, -0.04929702f, -0.8098793f,   0.f, 0.f,   13, 13, 0, 255 },
+	{ -0.92f, -0.6800001f, 0.1500001f,   -0.5845215f, -0.04929702f, -0.8098793f,   0.f, 0.f,   13, 13, 0, 255 },
+	{ -0.93f, -0.89f, 0.17f,   -0.5845215f, -0.04929702f, -0.8098793f,   0.f, 0.f,   13, 13, 0, 255 },
+	{ -0.92f, -0.8200001f, 0.19f,   -0.504616f, 0.0325559f, 0.8627298f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ -0.96f, -0.91f, 0.17f,   -0.504616f, 0.0325559f, 0.8627298f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ -0.91f, -0.93f, 0.2f,   -0.504616f, 0.0325559f, 0.8627298f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ -0.89f, -0.83f, 0.1500001f,   0.5321814f, 0.1773937f, -0.8278372f,   0.f, 0.f,   45, 45, 0, 255 },
+	{ -0.88f, -0.72f, 0.1800001f,   0.5321814f, 0.1773937f, -0.8278372f,   0.f, 0.f,   45, 45, 0, 255 },
+	{ -0.86f, -0.92f, 0.1500001f,   0.5321814f, 0.1773937f, -0.8278372f,   0.f, 0.f,   45, 45, 0, 255 },
+	{ -0.92f, -0.92f, 0.14f,   -0.9444084f, 0.01368708f, -0.3284896f,   0.f, 0.f,   3, 3, 0, 255 },
+	{ -0.93f, -0.89f, 0.17f,   -0.9444084f, 0.01368708f, -0.3284896f,   0.f, 0.f,   3, 3, 0, 255 },
+	{ -0.92f, -0.6800001f, 0.1500001f,   -0.9444084f, 0.01368708f, -0.3284896f,   0.f, 0.f,   3, 3, 0, 255 },
+	{ -0.89f, -0.83f, 0.1500001f,   0.f, 0.f, -1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.92f, -0.6800001f, 0.1500001f,   0.f, 0.f, -1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.87f, -0.62f, 0.1500001f,   0.f, 0.f, -1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.92f, -0.92f, 0.14f,   0.2037847f, 0.04075699f, -0.9781669f,   0.f, 0.f,   10, 10, 0, 255 },
+	{ -0.92f, -0.6800001f, 0.1500001f,   0.2037847f, 0.04075699f, -0.9781669f,   0.f, 0.f,   10, 10, 0, 255 },
+	{ -0.89f, -0.83f, 0.1500001f,   0.2037847f, 0.04075699f, -0.9781669f,   0.f, 0.f,   10, 10, 0, 255 },
+	{ -0.86f, -0.49f, 0.21f,   0.f, 0.f, 1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.93f, -0.52f, 0.21f,   0.f, 0.f, 1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.9f, -0.54f, 0.21f,   0.f, 0.f, 1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.86f, -0.49f, 0.21f,   0.1801874f, -0.1441498f, 0.9730125f,   0.f, 0.f,   37, 37, 0, 255 },
+	{ -0.9f, -0.54f, 0.21f,   0.1801874f, -0.1441498f, 0.9730125f,   0.f, 0.f,   37, 37, 0, 255 },
+	{ -0.87f, -0.5700001f, 0.2f,   0.1801874f, -0.1441498f, 0.9730125f,   0.f, 0.f,   37, 37, 0, 255 },
+	{ -0.82f, -0.5100001f, 0.18f,   0.5353129f, -0.1703266f, 0.8273022f,   0.f, 0.f,   43, 43, 0, 255 },
+	{ -0.86f, -0.49f, 0.21f,   0.5353129f, -0.1703266f, 0.8273022f,   0.f, 0.f,   43, 43, 0, 255 },
+	{ -0.87f, -0.5700001f, 0.2f,   0.5353129f, -0.1703266f, 0.8273022f,   0.f, 0.f,   43, 43, 0, 255 },
+	{ -0.93f, -0.52f, 0.21f,   -0.2307689f, -0.3076923f, 0.923077f,   0.f, 0.f,   78, 78, 0, 255 },
+	{ -0.97f, -0.58f, 0.1800001f,   -0.2307689f, -0.3076923f, 0.923077f,   0.f, 0.f,   78, 78, 0, 255 },
+	{ -0.93f, -0.58f, 0.19f,   -0.2307689f, -0.3076923f, 0.923077f,   0.f, 0.f,   78, 78, 0, 255 },
+	{ -0.93f, -0.52f, 0.21f,   -0.5999996f, 0.f, 0.8000003f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.97f, -0.5100001f, 0.1800001f,   -0.5999996f, 0.f, 0.8000003f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.97f, -0.58f, 0.1800001f,   -0.5999996f, 0.f, 0.8000003f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.88f, -0.5700001f, 0.13f,   0.7219953f, -0.6188527f, -0.3094254f,   0.f, 0.f,   158, 158, 0, 255 },
+	{ -0.82f, -0.5f, 0.13f,   0.7219953f, -0.6188527f, -0.3094254f,   0.f, 0.f,   158, 158, 0, 255 },
+	{ -0.85f, -0.55f, 0.16f,   0.7219953f, -0.6188527f, -0.3094254f,   0.f, 0.f,   158, 158, 0, 255 },
+	{ -0.82f, -0.5100001f, 0.18f,   0.7784987f, -0.6227995f, 0.0778485f,   0.f, 0.f,   159, 159, 0, 255 },
+	{ -0.87f, -0.5700001f, 0.2f,   0.7784987f, -0.6227995f, 0.0778485f,   0.f, 0.f,   159, 159, 0, 255 },
+	{ -0.85f, -0.55f, 0.16f,   0.7784987f, -0.6227995f, 0.0778485f,   0.f, 0.f,   159, 159, 0, 255 },
+	{ -0.82f, -0.5f, 0.13f,   0.8210323f, -0.5597956f, -0.1119597f,   0.f, 0.f,   143, 143, 0, 255 },
+	{ -0.82f, -0.5100001f, 0.18f,   0.8210323f, -0.5597956f, -0.1119597f,   0.f, 0.f,   143, 143, 0, 255 },
+	{ -0.85f, -0.55f, 0.16f,   0.8210323f, -0.5597956f, -0.1119597f,   0.f, 0.f,   143, 143, 0, 255 },
+	{ -0.92f, -0.54f, 0.13f,   -9.718148e-08f, -1.295752e-07f, -1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.82f, -0.5f, 0.13f,   -9.718148e-08f, -1.295752e-07f, -1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.88f, -0.5700001f, 0.13f,   -9.718148e-08f, -1.295752e-07f, -1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.84f, -0.4f, 0.13f,   -0.3549145f, 0.2028083f, -0.912636f,   0.f, 0.f,   52, 52, 0, 255 },
+	{ -0.92f, -0.54f, 0.13f,   -0.3549145f, 0.2028083f, -0.912636f,   0.f, 0.f,   52, 52, 0, 255 },
+	{ -0.96f, -0.52f, 0.1500001f,   -0.3549145f, 0.2028083f, -0.912636f,   0.f, 0.f,   52, 52, 0, 255 },
+	{ -0.75f, -0.36f, 0.09000003f,   -0.2721656f, -0.1360827f, -0.9525793f,   0.f, 0.f,   35, 35, 0, 255 },
+	{ -0.64f, -0.23f, 0.04000003f,   -0.2721656f, -0.1360827f, -0.9525793f,   0.f, 0.f,   35, 35, 0, 255 },
+	{ -0.82f, -0.5f, 0.13f,   -0.2721656f, -0.1360827f, -0.9525793f,   0.f, 0.f,   35, 35, 0, 255 },
+	{ -0.67f, -0.44f, 0.14f,   0.2356216f, -0.4450628f, -0.8639453f,   0.f, 0.f,   113, 113, 0, 255 },
+	{ -0.82f, -0.5f, 0.13f,   0.2356216f, -0.4450628f, -0.8639453f,   0.f, 0.f,   113, 113, 0, 255 },
+	{ -0.64f, -0.23f, 0.04000003f,   0.2356216f, -0.4450628f, -0.8639453f,   0.f, 0.f,   113, 113, 0, 255 },
+	{ -0.64f, -0.23f, 0.04000003f,   0.04644245f, -0.4348703f, -0.8992947f,   0.f, 0.f,   111, 111, 0, 255 },
+	{ -0.54f, -0.24f, 0.05000002f,   0.04644245f, -0.4348703f, -0.8992947f,   0.f, 0.f,   111, 111, 0, 255 },
+	{ -0.67f, -0.44f, 0.14f,   0.04644245f, -0.4348703f, -0.8992947f,   0.f, 0.f,   111, 111, 0, 255 },
+	{ -0.84f, -0.4f, 0.13f,   -0.3768223f, -0.07536441f, -0.9232146f,   0.f, 0.f,   19, 19, 0, 255 },
+	{ -0.75f, -0.36f, 0.09000003f,   -0.3768223f, -0.07536441f, -0.9232146f,   0.f, 0.f,   19, 19, 0, 255 },
+	{ -0.82f, -0.5f, 0.13f,   -0.3768223f, -0.07536441f, -0.9232146f,   0.f, 0.f,   19, 19, 0, 255 },
+	{ -0.84f, -0.4f, 0.13f,   -1.379737e-07f, -2.759472e-08f, -1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.82f, -0.5f, 0.13f,   -1.379737e-07f, -2.759472e-08f, -1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.92f, -0.54f, 0.13f,   -1.379737e-07f, -2.759472e-08f, -1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ -0.65f, -0.36f, 0.23f,   0.5855393f, -0.6661183f, 0.4619849f,   0.f, 0.f,   170, 170, 0, 255 },
+	{ -0.67f, -0.44f, 0.14f,   0.5855393f, -0.6661183f, 0.4619849f,   0.f, 0.f,   170, 170, 0, 255 },
+	{ -0.53f, -0.31f, 0.15f,   0.5855393f, -0.6661183f, 0.4619849f,   0.f, 0.f,   170, 170, 0, 255 },
+	{ -0.53f, -0.31f, 0.15f,   0.6101797f, -0.6190876f, -0.4943795f,   0.f, 0.f,   158, 158, 0, 255 },
+	{ -0.67f, -0.44f, 0.14f,   0.6101797f, -0.6190876f, -0.4943795f,   0.f, 0.f,   158, 158, 0, 255 },
+	{ -0.54f, -0.24f, 0.05000002f,   0.6101797f, -0.6190876f, -0.4943795f,   0.f, 0.f,   158, 158, 0, 255 },
+	{ -0.52f, -0.25f, 0.09000003f,   0.6577053f, -0.5846274f, -0.47501f,   0.f, 0.f,   149, 149, 0, 255 },
+	{ -0.53f, -0.31f, 0.15f,   0.6577053f, -0.5846274f, -0.47501f,   0.f, 0.f,   149, 149, 0, 255 },
+	{ -0.54f, -0.24f, 0.05000002f,   0.6577053f, -0.5846274f, -0.47501f,   0.f, 0.f,   149, 149, 0, 255 },
+	{ -0.82f, -0.5100001f, 0.18f,   0.3756266f, -0.9087737f, -0.1817556f,   0.f, 0.f,   232, 232, 0, 255 },
+	{ -0.82f, -0.5f, 0.13f,   0.3756266f, -0.9087737f, -0.1817556f,   0.f, 0.f,   232, 232, 0, 255 },
+	{ -0.67f, -0.44f, 0.14f,   0.3756266f, -0.9087737f, -0.1817556f,   0.f, 0.f,   232, 232, 0, 255 },
+	{ -0.85f, -0.55f, 0.16f,   0.7401353f, -0.1168636f, -0.6622257f,   0.f, 0.f,   30, 30, 0, 255 },
+	{ -0.87f, -0.62f, 0.1500001f,   0.7401353f, -0.1168636f, -0.6622257f,   0.f, 0.f,   30, 30, 0, 255 },
+	{ -0.88f, -0.5700001f, 0.13f,   0.7401353f, -0.1168636f, -0.6622257f,   0.f, 0.f,   30, 30, 0, 255 },
+	{ -0.93f, -0.52f, 0.21f,   -0.2062838f, -0.3094263f, 0.9282792f,   0.f, 0.f,   79, 79, 0, 255 },
+	{ -0.93f, -0.58f, 0.19f,   -0.2062838f, -0.3094263f, 0.9282792f,   0.f, 0.f,   79, 79, 0, 255 },
+	{ -0.9f, -0.54f, 0.21f,   -0.2062838f, -0.3094263f, 0.9282792f,   0.f, 0.f,   79, 79, 0, 255 },
+	{ -0.96f, -0.52f, 0.1500001f,   -0.5427207f, -0.3015108f, -0.7839295f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ -0.92f, -0.54f, 0.13f,   -0.5427207f, -0.3015108f, -0.7839295f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ -0.97f, -0.58f, 0.1800001f,   -0.5427207f, -0.3015108f, -0.7839295f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ -0.87f, -0.62f, 0.1500001f,   0.9045343f, -0.301511f, 0.3015108f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ -0.85f, -0.55f, 0.16f,   0.9045343f, -0.301511f, 0.3015108f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ -0.87f, -0.5700001f, 0.2f,   0.9045343f, -0.301511f, 0.3015108f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ -0.85f, -0.02999997f, 0.24f,   0.08051736f, -0.002776508f, 0.9967493f,   0.f, 0.f,   1, 1, 0, 255 },
+	{ -0.6f, 0.03999996f, 0.22f,   0.08051736f, -0.002776508f, 0.9967493f,   0.f, 0.f,   1, 1, 0, 255 },
+	{ -0.72f, 0.15f, 0.23f,   0.08051736f, -0.002776508f, 0.9967493f,   0.f, 0.f,   1, 1, 0, 255 },
+	{ -0.78f, 0.22f, 3.409488e-08f,   -0.4140866f, 0.8799306f, 0.2329258f,   0.f, 0.f,   224, 224, 0, 255 },
+	{ -0.79f, 0.2099999f, 0.02000003f,   -0.4140866f, 0.8799306f, 0.2329258f,   0.f, 0.f,   224, 224, 0, 255 },
+	{ -0.65f, 0.26f, 0.08000003f,   -0.4140866f, 0.8799306f, 0.2329258f,   0.f, 0.f,   224, 224, 0, 255 },
+	{ -0.72f, 0.15f, 0.23f,   -0.5370826f, 0.6586859f, 0.526949f,   0.f, 0.f,   168, 168, 0, 255 },
+	{ -0.85f, 0.14f, 0.11f,   -0.5370826f, 0.6586859f, 0.526949f,   0.f, 0.f,   168, 168, 0, 255 },
+	{ -0.85f, 0.05999994f, 0.21f,   -0.5370826f, 0.6586859f, 0.526949f,   0.f, 0.f,   168, 168, 0, 255 },
+	{ -0.72f, 0.15f, 0.23f,   -0.3427735f, 0.2970704f, 0.8912101f,   0.f, 0.f,   76, 76, 0, 255 },
+	{ -0.85f, 0.05999994f, 0.21f,   -0.3427735f, 0.2970704f, 0.8912101f,   0.f, 0.f,   76, 76, 0, 255 },
+	{ -0.85f, -0.02999997f, 0.24f,   -0.3427735f, 0.2970704f, 0.8912101f,   0.f, 0.f,   76, 76, 0, 255 },
+	{ 0.21f, 0.2099999f, 0.16f,   -0.337408f, 0.5436015f, 0.7685397f,   0.f, 0.f,   139, 139, 0, 255 },
+	{ 0.16f, 0.07999992f, 0.23f,   -0.337408f, 0.5436015f, 0.7685397f,   0.f, 0.f,   139, 139, 0, 255 },
+	{ 0.27f, 0.12f, 0.25f,   -0.337408f, 0.5436015f, 0.7685397f,   0.f, 0.f,   139, 139, 0, 255 },
+	{ 0.32f, 0.26f, 0.14f,   0.459876f, 0.4412321f, 0.7706026f,   0.f, 0.f,   113, 113, 0, 255 },
+	{ 0.27f, 0.12f, 0.25f,   0.459876f, 0.4412321f, 0.7706026f,   0.f, 0.f,   113, 113, 0, 255 },
+	{ 0.38f, 0.1799999f, 0.15f,   0.459876f, 0.4412321f, 0.7706026f,   0.f, 0.f,   113, 113, 0, 255 },
+	{ 0.47f, 0.12f, 0.04999998f,   0.7358324f, 0.6084774f, 0.297163f,   0.f, 0.f,   155, 155, 0, 255 },
+	{ 0.38f, 0.1799999f, 0.15f,   0.7358324f, 0.6084774f, 0.297163f,   0.f, 0.f,   155, 155, 0, 255 },
+	{ 0.43f, 0.1f, 0.19f,   0.7358324f, 0.6084774f, 0.297163f,   0.f, 0.f,   155, 155, 0, 255 },
+	{ 0.43f, 0.1f, 0.19f,   0.3479938f, 0.584133f, 0.7332727f,   0.f, 0.f,   149, 149, 0, 255 },
+	{ 0.38f, 0.1799999f, 0.15f,   0.3479938f, 0.584133f, 0.7332727f,   0.f, 0.f,   149, 149, 0, 255 },
+	{ 0.27f, 0.12f, 0.25f,   0.3479938f, 0.584133f, 0.7332727f,   0.f, 0.f,   149, 149, 0, 255 },
+	{ 0.48f, 0.35f, 0.11f,   0.08075147f, 0.1830366f, 0.9797841f,   0.f, 0.f,   47, 47, 0, 255 },
+	{ 0.32f, 0.26f, 0.14f,   0.08075147f, 0.1830366f, 0.9797841f,   0.f, 0.f,   47, 47, 0, 255 },
+	{ 0.38f, 0.1799999f, 0.15f,   0.08075147f, 0.1830366f, 0.9797841f,   0.f, 0.f,   47, 47, 0, 255 },
+	{ 0.32f, 0.26f, 0.14f,   -0.1566941f, 0.644185f, 0.7486472f,   0.f, 0.f,   164, 164, 0, 255 },
+	{ 0.21f, 0.2099999f, 0.16f,   -0.1566941f, 0.644185f, 0.7486472f,   0.f, 0.f,   164, 164, 0, 255 },
+	{ 0.27f, 0.12f, 0.25f,   -0.1566941f, 0.644185f, 0.7486472f,   0.f, 0.f,   164, 164, 0, 255 },
+	{ -0.89f, -0.00999999f, 0.06000004f,   -0.9945832f, 0.1016361f, -0.02177914f,   0.f, 0.f,   26, 26, 0, 255 },
+	{ -0.9f, -0.08000004f, 0.19f,   -0.9945832f, 0.1016361f, -0.02177914f,   0.f, 0.f,   26, 26, 0, 255 },
+	{ -0.88f, 0.09000003f, 0.07000004f,   -0.9945832f, 0.1016361f, -0.02177914f,   0.f, 0.f,   26, 26, 0, 255 },
+	{ -0.04f, 0.27f, 0.05f,   -0.2467114f, 0.9219226f, 0.2986507f,   0.f, 0.f,   235, 235, 0, 255 },
+	{ -0.02999999f, 0.25f, 0.12f,   -0.2467114f, 0.9219226f, 0.2986507f,   0.f, 0.f,   235, 235, 0, 255 },
+	{ 0.06f, 0.3f, 0.04f,   -0.2467114f, 0.9219226f, 0.2986507f,   0.f, 0.f,   235, 235, 0, 255 },
+	{ -0.65f, 0.26f, 0.08000003f,   -0.4280314f, 0.8123864f, 0.3960019f,   0.f, 0.f,   207, 207, 0, 255 },
+	{ -0.85f, 0.14f, 0.11f,   -0.4280314f, 0.8123864f, 0.3960019f,   0.f, 0.f,   207, 207, 0, 255 },
+	{ -0.72f, 0.15f, 0.23f,   -0.4280314f, 0.8123864f, 0.3960019f,   0.f, 0.f,   207, 207, 0, 255 },
+	{ -0.9f, -0.08000004f, 0.19f,   -0.7844649f, 0.1961162f, 0.5883479f,   0.f, 0.f,   50, 50, 0, 255 },
+	{ -0.85f, -0.02999997f, 0.24f,   -0.7844649f, 0.1961162f, 0.5883479f,   0.f, 0.f,   50, 50, 0, 255 },
+	{ -0.85f, 0.05999994f, 0.21f,   -0.7844649f, 0.1961162f, 0.5883479f,   0.f, 0.f,   50, 50, 0, 255 },
+	{ -0.88f, 0.09000003f, 0.07000004f,   -0.920572f, 0.2916661f, 0.2597653f,   0.f, 0.f,   74, 74, 0, 255 },
+	{ -0.9f, -0.08000004f, 0.19f,   -0.920572f, 0.2916661f, 0.2597653f,   0.f, 0.f,   74, 74, 0, 255 },
+	{ -0.85f, 0.05999994f, 0.21f,   -0.920572f, 0.2916661f, 0.2597653f,   0.f, 0.f,   74, 74, 0, 255 },
+	{ -0.85f, 0.14f, 0.11f,   -0.9055386f, 0.3312944f, 0.2650357f,   0.f, 0.f,   84, 84, 0, 255 },
+	{ -0.88f, 0.09000003f, 0.07000004f,   -0.9055386f, 0.3312944f, 0.2650357f,   0.f, 0.f,   84, 84, 0, 255 },
+	{ -0.85f, 0.05999994f, 0.21f,   -0.9055386f, 0.3312944f, 0.2650357f,   0.f, 0.f,   84, 84, 0, 255 },
+	{ 0.23f, -0.2600001f, 0.19f,   0.1313375f, -0.4268464f, 0.894736f,   0.f, 0.f,   109, 109, 0, 255 },
+	{ 0.25f, -0.17f, 0.23f,   0.1313375f, -0.4268464f, 0.894736f,   0.f, 0.f,   109, 109, 0, 255 },
+	{ 0.12f, -0.21f, 0.23f,   0.1313375f, -0.4268464f, 0.894736f,   0.f, 0.f,   109, 109, 0, 255 },
+	{ 0.23f, -0.2600001f, 0.19f,   -0.01498881f, -0.6445248f, 0.7644365f,   0.f, 0.f,   164, 164, 0, 255 },
+	{ 0.12f, -0.21f, 0.23f,   -0.01498881f, -0.6445248f, 0.7644365f,   0.f, 0.f,   164, 164, 0, 255 },
+	{ 0.15f, -0.27f, 0.18f,   -0.01498881f, -0.6445248f, 0.7644365f,   0.f, 0.f,   164, 164, 0, 255 },
+	{ 0.44f, -0.19f, 0.11f,   0.9676528f, -0.2276829f, -0.1086668f,   0.f, 0.f,   58, 58, 0, 255 },
+	{ 0.43f, -0.18f, -1.87959e-08f,   0.9676528f, -0.2276829f, -0.1086668f,   0.f, 0.f,   58, 58, 0, 255 },
+	{ 0.48f, -0.01999998f, 0.11f,   0.9676528f, -0.2276829f, -0.1086668f,   0.f, 0.f,   58, 58, 0, 255 },
+	{ 0.2f, -0.27f, 0.06999999f,   -0.1920097f, -0.9775044f, -0.08727711f,   0.f, 0.f,   249, 249, 0, 255 },
+	{ 0.21f, -0.28f, 0.16f,   -0.1920097f, -0.9775044f, -0.08727711f,   0.f, 0.f,   249, 249, 0, 255 },
+	{ 0.15f, -0.27f, 0.18f,   -0.1920097f, -0.9775044f, -0.08727711f,   0.f, 0.f,   249, 249, 0, 255 },
+	{ 0.21f, -0.28f, 0.16f,   0.03832025f, -0.8430421f, 0.5364807f,   0.f, 0.f,   215, 215, 0, 255 },
+	{ 0.23f, -0.2600001f, 0.19f,   0.03832025f, -0.8430421f, 0.5364807f,   0.f, 0.f,   215, 215, 0, 255 },
+	{ 0.15f, -0.27f, 0.18f,   0.03832025f, -0.8430421f, 0.5364807f,   0.f, 0.f,   215, 215, 0, 255 },
+	{ 0.25f, -0.29f, 0.09f,   -0.199007f, -0.8955335f, -0.3980151f,   0.f, 0.f,   228, 228, 0, 255 },
+	{ 0.2f, -0.27f, 0.06999999f,   -0.199007f, -0.8955335f, -0.3980151f,   0.f, 0.f,   228, 228, 0, 255 },
+	{ 0.25f, -0.25f, -1.092785e-08f,   -0.199007f, -0.8955335f, -0.3980151f,   0.f, 0.f,   228, 228, 0, 255 },
+	{ 0.25f, -0.29f, 0.09f,   0.3488988f, -0.856388f, -0.3806171f,   0.f, 0.f,   218, 218, 0, 255 },
+	{ 0.25f, -0.25f, -1.092785e-08f,   0.3488988f, -0.856388f, -0.3806171f,   0.f, 0.f,   218, 218, 0, 255 },
+	{ 0.34f, -0.24f, 0.05999998f,   0.3488988f, -0.856388f, -0.3806171f,   0.f, 0.f,   218, 218, 0, 255 },
+	{ 0.15f, 0.27f, 0.11f,   -0.1103679f, 0.5688183f, 0.8150243f,   0.f, 0.f,   145, 145, 0, 255 },
+	{ 0.21f, 0.2099999f, 0.16f,   -0.1103679f, 0.5688183f, 0.8150243f,   0.f, 0.f,   145, 145, 0, 255 },
+	{ 0.32f, 0.26f, 0.14f,   -0.1103679f, 0.5688183f, 0.8150243f,   0.f, 0.f,   145, 145, 0, 255 },
+	{ 0.51f, 0.1999999f, -2.229281e-08f,   0.9157755f, -0.2747327f, 0.2930482f,   0.f, 0.f,   70, 70, 0, 255 },
+	{ 0.47f, 0.12f, 0.04999998f,   0.9157755f, -0.2747327f, 0.2930482f,   0.f, 0.f,   70, 70, 0, 255 },
+	{ 0.45f, 0.f, -1.967013e-08f,   0.9157755f, -0.2747327f, 0.2930482f,   0.f, 0.f,   70, 70, 0, 255 },
+	{ 0.26f, -0.02999997f, 0.27f,   -0.05598429f, -0.2705912f, 0.9610651f,   0.f, 0.f,   69, 69, 0, 255 },
+	{ 0.11f, -0.07000005f, 0.25f,   -0.05598429f, -0.2705912f, 0.9610651f,   0.f, 0.f,   69, 69, 0, 255 },
+	{ 0.25f, -0.17f, 0.23f,   -0.05598429f, -0.2705912f, 0.9610651f,   0.f, 0.f,   69, 69, 0, 255 },
+	{ 0.43f, -0.18f, -1.87959e-08f,   0.954264f, -0.1060292f, -0.2795319f,   0.f, 0.f,   27, 27, 0, 255 },
+	{ 0.45f, 0.f, -1.967013e-08f,   0.954264f, -0.1060292f, -0.2795319f,   0.f, 0.f,   27, 27, 0, 255 },
+	{ 0.48f, -0.01999998f, 0.11f,   0.954264f, -0.1060292f, -0.2795319f,   0.f, 0.f,   27, 27, 0, 255 },
+	{ 0.11f, -0.07000005f, 0.25f,   0.04255814f, -0.1383135f, 0.9894737f,   0.f, 0.f,   35, 35, 0, 255 },
+	{ 0.12f, -0.21f, 0.23f,   0.04255814f, -0.1383135f, 0.9894737f,   0.f, 0.f,   35, 35, 0, 255 },
+	{ 0.25f, -0.17f, 0.23f,   0.04255814f, -0.1383135f, 0.9894737f,   0.f, 0.f,   35, 35, 0, 255 },
+	{ 0.31f, 0.47f, 0.01999999f,   -0.5492823f, 0.6663422f, 0.5042589f,   0.f, 0.f,   170, 170, 0, 255 },
+	{ 0.11f, 0.29f, 0.04f,   -0.5492823f, 0.6663422f, 0.5042589f,   0.f, 0.f,   170, 170, 0, 255 },
+	{ 0.15f, 0.27f, 0.11f,   -0.5492823f, 0.6663422f, 0.5042589f,   0.f, 0.f,   170, 170, 0, 255 },
+	{ 0.11f, 0.29f, 0.04f,   0.01810417f, 0.09052094f, 0.99573f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ 0.31f, 0.47f, 0.01999999f,   0.01810417f, 0.09052094f, 0.99573f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ 0.06f, 0.3f, 0.04f,   0.01810417f, 0.09052094f, 0.99573f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ 0.16f, 0.07999992f, 0.23f,   -0.1789967f, 0.1884175f, 0.9656391f,   0.f, 0.f,   48, 48, 0, 255 },
+	{ 0.11f, -0.07000005f, 0.25f,   -0.1789967f, 0.1884175f, 0.9656391f,   0.f, 0.f,   48, 48, 0, 255 },
+	{ 0.26f, -0.02999997f, 0.27f,   -0.1789967f, 0.1884175f, 0.9656391f,   0.f, 0.f,   48, 48, 0, 255 },
+	{ 0.1f, 0.1999999f, 0.19f,   0.206939f, 0.4009441f, 0.8924237f,   0.f, 0.f,   102, 102, 0, 255 },
+	{ 0.16f, 0.07999992f, 0.23f,   0.206939f, 0.4009441f, 0.8924237f,   0.f, 0.f,   102, 102, 0, 255 },
+	{ 0.21f, 0.2099999f, 0.16f,   0.206939f, 0.4009441f, 0.8924237f,   0.f, 0.f,   102, 102, 0, 255 },
+	{ -0.3f, 0.2099999f, 0.14f,   -0.285113f, 0.3020839f, 0.909646f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ -0.31f, 0.04999995f, 0.19f,   -0.285113f, 0.3020839f, 0.909646f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ -0.14f, 0.09000003f, 0.23f,   -0.285113f, 0.3020839f, 0.909646f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ -0.31f, 0.04999995f, 0.19f,   -0.2408835f, 0.05474617f, 0.9690087f,   0.f, 0.f,   14, 14, 0, 255 },
+	{ -0.07999999f, 0.f, 0.25f,   -0.2408835f, 0.05474617f, 0.9690087f,   0.f, 0.f,   14, 14, 0, 255 },
+	{ -0.14f, 0.09000003f, 0.23f,   -0.2408835f, 0.05474617f, 0.9690087f,   0.f, 0.f,   14, 14, 0, 255 },
+	{ -0.31f, 0.04999995f, 0.19f,   -0.2483951f, 0.01953663f, 0.9684618f,   0.f, 0.f,   5, 5, 0, 255 },
+	{ -0.13f, -0.14f, 0.24f,   -0.2483951f, 0.01953663f, 0.9684618f,   0.f, 0.f,   5, 5, 0, 255 },
+	{ -0.07999999f, 0.f, 0.25f,   -0.2483951f, 0.01953663f, 0.9684618f,   0.f, 0.f,   5, 5, 0, 255 },
+	{ -0.02999999f, 0.25f, 0.12f,   -0.03459069f, 0.7817491f, 0.6226329f,   0.f, 0.f,   199, 199, 0, 255 },
+	{ -0.07999999f, 0.1999999f, 0.18f,   -0.03459069f, 0.7817491f, 0.6226329f,   0.f, 0.f,   199, 199, 0, 255 },
+	{ 0.1f, 0.1999999f, 0.19f,   -0.03459069f, 0.7817491f, 0.6226329f,   0.f, 0.f,   199, 199, 0, 255 },
+	{ -0.07999999f, 0.f, 0.25f,   0.04340384f, 0.1178103f, 0.9920871f,   0.f, 0.f,   30, 30, 0, 255 },
+	{ 0.11f, -0.07000005f, 0.25f,   0.04340384f, 0.1178103f, 0.9920871f,   0.f, 0.f,   30, 30, 0, 255 },
+	{ 0.16f, 0.07999992f, 0.23f,   0.04340384f, 0.1178103f, 0.9920871f,   0.f, 0.f,   30, 30, 0, 255 },
+	{ 0.16f, 0.07999992f, 0.23f,   0.007387247f, 0.221615f, 0.9751063f,   0.f, 0.f,   57, 57, 0, 255 },
+	{ -0.14f, 0.09000003f, 0.23f,   0.007387247f, 0.221615f, 0.9751063f,   0.f, 0.f,   57, 57, 0, 255 },
+	{ -0.07999999f, 0.f, 0.25f,   0.007387247f, 0.221615f, 0.9751063f,   0.f, 0.f,   57, 57, 0, 255 },
+	{ -0.07999999f, 0.1999999f, 0.18f,   -0.04992728f, 0.4357297f, 0.8986918f,   0.f, 0.f,   111, 111, 0, 255 },
+	{ -0.14f, 0.09000003f, 0.23f,   -0.04992728f, 0.4357297f, 0.8986918f,   0.f, 0.f,   111, 111, 0, 255 },
+	{ 0.1f, 0.1999999f, 0.19f,   -0.04992728f, 0.4357297f, 0.8986918f,   0.f, 0.f,   111, 111, 0, 255 },
+	{ 0.21f, 0.2099999f, 0.16f,   0.1257819f, 0.7063116f, 0.6966368f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ 0.15f, 0.27f, 0.11f,   0.1257819f, 0.7063116f, 0.6966368f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ 0.1f, 0.1999999f, 0.19f,   0.1257819f, 0.7063116f, 0.6966368f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ 0.16f, 0.07999992f, 0.23f,   0.01070082f, 0.321021f, 0.9470116f,   0.f, 0.f,   82, 82, 0, 255 },
+	{ 0.1f, 0.1999999f, 0.19f,   0.01070082f, 0.321021f, 0.9470116f,   0.f, 0.f,   82, 82, 0, 255 },
+	{ -0.14f, 0.09000003f, 0.23f,   0.01070082f, 0.321021f, 0.9470116f,   0.f, 0.f,   82, 82, 0, 255 },
+	{ -0.02999999f, 0.25f, 0.12f,   0.01435769f, 0.9619648f, 0.2727958f,   0.f, 0.f,   245, 245, 0, 255 },
+	{ -0.04f, 0.27f, 0.05f,   0.01435769f, 0.9619648f, 0.2727958f,   0.f, 0.f,   245, 245, 0, 255 },
+	{ -0.32f, 0.26f, 0.1f,   0.01435769f, 0.9619648f, 0.2727958f,   0.f, 0.f,   245, 245, 0, 255 },
+	{ 0.06f, 0.3f, 0.04f,   0.1934025f, 0.9670132f, 0.1657736f,   0.f, 0.f,   247, 247, 0, 255 },
+	{ 0.15f, 0.27f, 0.11f,   0.1934025f, 0.9670132f, 0.1657736f,   0.f, 0.f,   247, 247, 0, 255 },
+	{ 0.11f, 0.29f, 0.04f,   0.1934025f, 0.9670132f, 0.1657736f,   0.f, 0.f,   247, 247, 0, 255 },
+	{ -0.02999999f, 0.25f, 0.12f,   -0.04965016f, 0.7668211f, 0.6399376f,   0.f, 0.f,   196, 196, 0, 255 },
+	{ 0.1f, 0.1999999f, 0.19f,   -0.04965016f, 0.7668211f, 0.6399376f,   0.f, 0.f,   196, 196, 0, 255 },
+	{ 0.15f, 0.27f, 0.11f,   -0.04965016f, 0.7668211f, 0.6399376f,   0.f, 0.f,   196, 196, 0, 255 },
+	{ -0.02999999f, 0.25f, 0.12f,   -0.07171025f, 0.8800815f, 0.4693764f,   0.f, 0.f,   224, 224, 0, 255 },
+	{ 0.15f, 0.27f, 0.11f,   -0.07171025f, 0.8800815f, 0.4693764f,   0.f, 0.f,   224, 224, 0, 255 },
+	{ 0.06f, 0.3f, 0.04f,   -0.07171025f, 0.8800815f, 0.4693764f,   0.f, 0.f,   224, 224, 0, 255 },
+	{ -0.51f, 0.26f, 0.15f,   0.1914825f, 0.6586987f, 0.7276335f,   0.f, 0.f,   168, 168, 0, 255 },
+	{ -0.3f, 0.2099999f, 0.14f,   0.1914825f, 0.6586987f, 0.7276335f,   0.f, 0.f,   168, 168, 0, 255 },
+	{ -0.32f, 0.26f, 0.1f,   0.1914825f, 0.6586987f, 0.7276335f,   0.f, 0.f,   168, 168, 0, 255 },
+	{ -0.3f, 0.2099999f, 0.14f,   -0.1370481f, 0.4708835f, 0.8714852f,   0.f, 0.f,   120, 120, 0, 255 },
+	{ -0.14f, 0.09000003f, 0.23f,   -0.1370481f, 0.4708835f, 0.8714852f,   0.f, 0.f,   120, 120, 0, 255 },
+	{ -0.07999999f, 0.1999999f, 0.18f,   -0.1370481f, 0.4708835f, 0.8714852f,   0.f, 0.f,   120, 120, 0, 255 },
+	{ -0.07999999f, 0.1999999f, 0.18f,   -0.07325438f, 0.7953317f, 0.6017319f,   0.f, 0.f,   203, 203, 0, 255 },
+	{ -0.02999999f, 0.25f, 0.12f,   -0.07325438f, 0.7953317f, 0.6017319f,   0.f, 0.f,   203, 203, 0, 255 },
+	{ -0.3f, 0.2099999f, 0.14f,   -0.07325438f, 0.7953317f, 0.6017319f,   0.f, 0.f,   203, 203, 0, 255 },
+	{ -0.04f, 0.27f, 0.05f,   0.02139742f, 0.9971206f, -0.07275122f,   0.f, 0.f,   254, 254, 0, 255 },
+	{ -0.05f, 0.26f, -0.09f,   0.02139742f, 0.9971206f, -0.07275122f,   0.f, 0.f,   254, 254, 0, 255 },
+	{ -0.54f, 0.28f, 0.04000002f,   0.02139742f, 0.9971206f, -0.07275122f,   0.f, 0.f,   254, 254, 0, 255 },
+	{ -0.54f, 0.28f, 0.04000002f,   0.0138522f, 0.9627277f, 0.2701176f,   0.f, 0.f,   245, 245, 0, 255 },
+	{ -0.32f, 0.26f, 0.1f,   0.0138522f, 0.9627277f, 0.2701176f,   0.f, 0.f,   245, 245, 0, 255 },
+	{ -0.04f, 0.27f, 0.05f,   0.0138522f, 0.9627277f, 0.2701176f,   0.f, 0.f,   245, 245, 0, 255 },
+	{ -0.32f, 0.26f, 0.1f,   0.0439714f, 0.9849604f, 0.1670913f,   0.f, 0.f,   251, 251, 0, 255 },
+	{ -0.54f, 0.28f, 0.04000002f,   0.0439714f, 0.9849604f, 0.1670913f,   0.f, 0.f,   251, 251, 0, 255 },
+	{ -0.51f, 0.26f, 0.15f,   0.0439714f, 0.9849604f, 0.1670913f,   0.f, 0.f,   251, 251, 0, 255 },
+	{ -0.32f, 0.26f, 0.1f,   -0.03301443f, 0.6162685f, 0.7868439f,   0.f, 0.f,   157, 157, 0, 255 },
+	{ -0.3f, 0.2099999f, 0.14f,   -0.03301443f, 0.6162685f, 0.7868439f,   0.f, 0.f,   157, 157, 0, 255 },
+	{ -0.02999999f, 0.25f, 0.12f,   -0.03301443f, 0.6162685f, 0.7868439f,   0.f, 0.f,   157, 157, 0, 255 },
+	{ -0.46f, 0.28f, -0.06999998f,   0.05047606f, 0.9980504f, 0.03670987f,   0.f, 0.f,   255, 255, 0, 255 },
+	{ -0.54f, 0.28f, 0.04000002f,   0.05047606f, 0.9980504f, 0.03670987f,   0.f, 0.f,   255, 255, 0, 255 },
+	{ -0.05f, 0.26f, -0.09f,   0.05047606f, 0.9980504f, 0.03670987f,   0.f, 0.f,   255, 255, 0, 255 },
+	{ -0.24f, -0.2600001f, 0.16f,   -0.2012966f, -0.4088839f, 0.8901088f,   0.f, 0.f,   104, 104, 0, 255 },
+	{ -0.04999999f, -0.31f, 0.18f,   -0.2012966f, -0.4088839f, 0.8901088f,   0.f, 0.f,   104, 104, 0, 255 },
+	{ -0.13f, -0.14f, 0.24f,   -0.2012966f, -0.4088839f, 0.8901088f,   0.f, 0.f,   104, 104, 0, 255 },
+	{ -0.89f, -0.00999999f, 0.06000004f,   -0.9446325f, -0.3263273f, -0.03435052f,   0.f, 0.f,   83, 83, 0, 255 },
+	{ -0.84f, -0.14f, -0.07999996f,   -0.9446325f, -0.3263273f, -0.03435052f,   0.f, 0.f,   83, 83, 0, 255 },
+	{ -0.86f, -0.1f, 0.09000004f,   -0.9446325f, -0.3263273f, -0.03435052f,   0.f, 0.f,   83, 83, 0, 255 },
+	{ 0.43f, -0.18f, -1.87959e-08f,   0.3378647f, -0.8687951f, -0.3619981f,   0.f, 0.f,   222, 222, 0, 255 },
+	{ 0.34f, -0.24f, 0.05999998f,   0.3378647f, -0.8687951f, -0.3619981f,   0.f, 0.f,   222, 222, 0, 255 },
+	{ 0.25f, -0.25f, -1.092785e-08f,   0.3378647f, -0.8687951f, -0.3619981f,   0.f, 0.f,   222, 222, 0, 255 },
+	{ -0.86f, -0.1f, 0.09000004f,   -0.8554322f, -0.517484f, 0.02112174f,   0.f, 0.f,   132, 132, 0, 255 },
+	{ -0.84f, -0.14f, -0.07999996f,   -0.8554322f, -0.517484f, 0.02112174f,   0.f, 0.f,   132, 132, 0, 255 },
+	{ -0.83f, -0.15f, 0.08000004f,   -0.8554322f, -0.517484f, 0.02112174f,   0.f, 0.f,   132, 132, 0, 255 },
+	{ -0.84f, -0.14f, -0.07999996f,   -0.7071068f, -0.7071068f, 0.f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ -0.77f, -0.21f, 0.06000003f,   -0.7071068f, -0.7071068f, 0.f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ -0.83f, -0.15f, 0.08000004f,   -0.7071068f, -0.7071068f, 0.f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ -0.54f, -0.24f, 0.05000002f,   -0.2661234f, -0.9580433f, -0.1064486f,   0.f, 0.f,   244, 244, 0, 255 },
+	{ -0.46f, -0.2600001f, 0.03000002f,   -0.2661234f, -0.9580433f, -0.1064486f,   0.f, 0.f,   244, 244, 0, 255 },
+	{ -0.52f, -0.25f, 0.09000003f,   -0.2661234f, -0.9580433f, -0.1064486f,   0.f, 0.f,   244, 244, 0, 255 },
+	{ -0.52f, -0.25f, 0.09000003f,   0.3324479f, -0.8183336f, 0.4688374f,   0.f, 0.f,   209, 209, 0, 255 },
+	{ -0.46f, -0.2600001f, 0.03000002f,   0.3324479f, -0.8183336f, 0.4688374f,   0.f, 0.f,   209, 209, 0, 255 },
+	{ -0.39f, -0.18f, 0.12f,   0.3324479f, -0.8183336f, 0.4688374f,   0.f, 0.f,   209, 209, 0, 255 },
+	{ -0.48f, -0.21f, 0.15f,   0.3928373f, -0.8642418f, 0.3142692f,   0.f, 0.f,   220, 220, 0, 255 },
+	{ -0.52f, -0.25f, 0.09000003f,   0.3928373f, -0.8642418f, 0.3142692f,   0.f, 0.f,   220, 220, 0, 255 },
+	{ -0.39f, -0.18f, 0.12f,   0.3928373f, -0.8642418f, 0.3142692f,   0.f, 0.f,   220, 220, 0, 255 },
+	{ -0.31f, 0.04999995f, 0.19f,   -0.2250209f, 0.04298154f, 0.9734055f,   0.f, 0.f,   11, 11, 0, 255 },
+	{ -0.38f, -0.09000003f, 0.18f,   -0.2250209f, 0.04298154f, 0.9734055f,   0.f, 0.f,   11, 11, 0, 255 },
+	{ -0.13f, -0.14f, 0.24f,   -0.2250209f, 0.04298154f, 0.9734055f,   0.f, 0.f,   11, 11, 0, 255 },
+	{ -0.38f, -0.09000003f, 0.18f,   0.4802529f, -0.2990254f, 0.8245853f,   0.f, 0.f,   76, 76, 0, 255 },
+	{ -0.31f, 0.04999995f, 0.19f,   0.4802529f, -0.2990254f, 0.8245853f,   0.f, 0.f,   76, 76, 0, 255 },
+	{ -0.43f, -0.06000006f, 0.22f,   0.4802529f, -0.2990254f, 0.8245853f,   0.f, 0.f,   76, 76, 0, 255 },
+	{ -0.38f, -0.09000003f, 0.18f,   0.4222423f, -0.5348402f, 0.7318863f,   0.f, 0.f,   136, 136, 0, 255 },
+	{ -0.48f, -0.21f, 0.15f,   0.4222423f, -0.5348402f, 0.7318863f,   0.f, 0.f,   136, 136, 0, 255 },
+	{ -0.39f, -0.18f, 0.12f,   0.4222423f, -0.5348402f, 0.7318863f,   0.f, 0.f,   136, 136, 0, 255 },
+	{ -0.48f, -0.21f, 0.15f,   0.5746961f, -0.2873481f, -0.7662607f,   0.f, 0.f,   73, 73, 0, 255 },
+	{ -0.38f, -0.09000003f, 0.18f,   0.5746961f, -0.2873481f, -0.7662607f,   0.f, 0.f,   73, 73, 0, 255 },
+	{ -0.53f, -0.31f, 0.15f,   0.5746961f, -0.2873481f, -0.7662607f,   0.f, 0.f,   73, 73, 0, 255 },
+	{ 0.28f, -0.96f, 0.12f,   -0.7071065f, 0.1979898f, 0.6788228f,   0.f, 0.f,   50, 50, 0, 255 },
+	{ 0.33f, -0.85f, 0.14f,   -0.7071065f, 0.1979898f, 0.6788228f,   0.f, 0.f,   50, 50, 0, 255 },
+	{ 0.29f, -0.89f, 0.11f,   -0.7071065f, 0.1979898f, 0.6788228f,   0.f, 0.f,   50, 50, 0, 255 },
+	{ 0.36f, -0.46f, 0.14f,   0.8581166f, -0.1906924f, 0.476731f,   0.f, 0.f,   49, 49, 0, 255 },
+	{ 0.39f, -0.2f, 0.19f,   0.8581166f, -0.1906924f, 0.476731f,   0.f, 0.f,   49, 49, 0, 255 },
+	{ 0.36f, -0.2600001f, 0.22f,   0.8581166f, -0.1906924f, 0.476731f,   0.f, 0.f,   49, 49, 0, 255 },
+	{ 0.37f, -0.2600001f, 0.11f,   0.9095567f, -0.1057623f, -0.4018967f,   0.f, 0.f,   27, 27, 0, 255 },
+	{ 0.39f, -0.24f, 0.15f,   0.9095567f, -0.1057623f, -0.4018967f,   0.f, 0.f,   27, 27, 0, 255 },
+	{ 0.36f, -0.46f, 0.14f,   0.9095567f, -0.1057623f, -0.4018967f,   0.f, 0.f,   27, 27, 0, 255 },
+	{ 0.34f, -0.44f, 0.11f,   0.7826084f, -0.1304348f, -0.6086959f,   0.f, 0.f,   33, 33, 0, 255 },
+	{ 0.37f, -0.2600001f, 0.11f,   0.7826084f, -0.1304348f, -0.6086959f,   0.f, 0.f,   33, 33, 0, 255 },
+	{ 0.36f, -0.46f, 0.14f,   0.7826084f, -0.1304348f, -0.6086959f,   0.f, 0.f,   33, 33, 0, 255 },
+	{ 0.39f, -0.24f, 0.15f,   0.9801961f, -0.1400279f, 0.1400278f,   0.f, 0.f,   36, 36, 0, 255 },
+	{ 0.39f, -0.2f, 0.19f,   0.9801961f, -0.1400279f, 0.1400278f,   0.f, 0.f,   36, 36, 0, 255 },
+	{ 0.36f, -0.46f, 0.14f,   0.9801961f, -0.1400279f, 0.1400278f,   0.f, 0.f,   36, 36, 0, 255 },
+	{ 0.36f, -0.2600001f, 0.22f,   0.1714283f, -0.2857142f, 0.9428572f,   0.f, 0.f,   73, 73, 0, 255 },
+	{ 0.31f, -0.29f, 0.22f,   0.1714283f, -0.2857142f, 0.9428572f,   0.f, 0.f,   73, 73, 0, 255 },
+	{ 0.33f, -0.41f, 0.18f,   0.1714283f, -0.2857142f, 0.9428572f,   0.f, 0.f,   73, 73, 0, 255 },
+	{ 0.48f, -0.01999998f, 0.11f,   0.837756f, -0.197119f, 0.5092239f,   0.f, 0.f,   50, 50, 0, 255 },
+	{ 0.4f, -0.05000007f, 0.23f,   0.837756f, -0.197119f, 0.5092239f,   0.f, 0.f,   50, 50, 0, 255 },
+	{ 0.44f, -0.19f, 0.11f,   0.837756f, -0.197119f, 0.5092239f,   0.f, 0.f,   50, 50, 0, 255 },
+	{ 0.4f, -0.05000007f, 0.23f,   0.8341708f, -0.01986122f, 0.5511483f,   0.f, 0.f,   5, 5, 0, 255 },
+	{ 0.48f, -0.01999998f, 0.11f,   0.8341708f, -0.01986122f, 0.5511483f,   0.f, 0.f,   5, 5, 0, 255 },
+	{ 0.43f, 0.1f, 0.19f,   0.8341708f, -0.01986122f, 0.5511483f,   0.f, 0.f,   5, 5, 0, 255 },
+	{ 0.44f, -0.19f, 0.11f,   0.8430109f, -0.1903574f, 0.5030871f,   0.f, 0.f,   49, 49, 0, 255 },
+	{ 0.4f, -0.05000007f, 0.23f,   0.8430109f, -0.1903574f, 0.5030871f,   0.f, 0.f,   49, 49, 0, 255 },
+	{ 0.39f, -0.2f, 0.19f,   0.8430109f, -0.1903574f, 0.5030871f,   0.f, 0.f,   49, 49, 0, 255 },
+	{ 0.27f, 0.12f, 0.25f,   -0.2273331f, 0.143579f, 0.9631743f,   0.f, 0.f,   37, 37, 0, 255 },
+	{ 0.16f, 0.07999992f, 0.23f,   -0.2273331f, 0.143579f, 0.9631743f,   0.f, 0.f,   37, 37, 0, 255 },
+	{ 0.26f, -0.02999997f, 0.27f,   -0.2273331f, 0.143579f, 0.9631743f,   0.f, 0.f,   37, 37, 0, 255 },
+	{ 0.47f, 0.12f, 0.04999998f,   0.93576f, 0.1932547f, 0.2949677f,   0.f, 0.f,   49, 49, 0, 255 },
+	{ 0.43f, 0.1f, 0.19f,   0.93576f, 0.1932547f, 0.2949677f,   0.f, 0.f,   49, 49, 0, 255 },
+	{ 0.48f, -0.01999998f, 0.11f,   0.93576f, 0.1932547f, 0.2949677f,   0.f, 0.f,   49, 49, 0, 255 },
+	{ 0.48f, -0.01999998f, 0.11f,   0.9614587f, -0.04739593f, -0.2708335f,   0.f, 0.f,   12, 12, 0, 255 },
+	{ 0.45f, 0.f, -1.967013e-08f,   0.9614587f, -0.04739593f, -0.2708335f,   0.f, 0.f,   12, 12, 0, 255 },
+	{ 0.47f, 0.12f, 0.04999998f,   0.9614587f, -0.04739593f, -0.2708335f,   0.f, 0.f,   12, 12, 0, 255 },
+	{ -0.38f, -0.2600001f, 0.05000002f,   -0.489454f, -0.6102284f, 0.6229415f,   0.f, 0.f,   156, 156, 0, 255 },
+	{ -0.28f, -0.33f, 0.06000001f,   -0.489454f, -0.6102284f, 0.6229415f,   0.f, 0.f,   156, 156, 0, 255 },
+	{ -0.24f, -0.2600001f, 0.16f,   -0.489454f, -0.6102284f, 0.6229415f,   0.f, 0.f,   156, 156, 0, 255 },
+	{ -0.39f, -0.18f, 0.12f,   -0.1821478f, -0.6602854f, 0.7285913f,   0.f, 0.f,   168, 168, 0, 255 },
+	{ -0.46f, -0.2600001f, 0.03000002f,   -0.1821478f, -0.6602854f, 0.7285913f,   0.f, 0.f,   168, 168, 0, 255 },
+	{ -0.38f, -0.2600001f, 0.05000002f,   -0.1821478f, -0.6602854f, 0.7285913f,   0.f, 0.f,   168, 168, 0, 255 },
+	{ -0.3f, -0.34f, -0.02999999f,   -0.257418f, -0.9524478f, 0.1630315f,   0.f, 0.f,   243, 243, 0, 255 },
+	{ -0.17f, -0.37f, 7.430936e-09f,   -0.257418f, -0.9524478f, 0.1630315f,   0.f, 0.f,   243, 243, 0, 255 },
+	{ -0.28f, -0.33f, 0.06000001f,   -0.257418f, -0.9524478f, 0.1630315f,   0.f, 0.f,   243, 243, 0, 255 },
+	{ -0.09f, -0.36f, 0.08000001f,   -0.1793272f, -0.9380203f, 0.2965797f,   0.f, 0.f,   239, 239, 0, 255 },
+	{ -0.28f, -0.33f, 0.06000001f,   -0.1793272f, -0.9380203f, 0.2965797f,   0.f, 0.f,   239, 239, 0, 255 },
+	{ -0.17f, -0.37f, 7.430936e-09f,   -0.1793272f, -0.9380203f, 0.2965797f,   0.f, 0.f,   239, 239, 0, 255 },
+	{ -0.38f, -0.09000003f, 0.18f,   -0.4496354f, -0.460341f, 0.7654504f,   0.f, 0.f,   117, 117, 0, 255 },
+	{ -0.39f, -0.18f, 0.12f,   -0.4496354f, -0.460341f, 0.7654504f,   0.f, 0.f,   117, 117, 0, 255 },
+	{ -0.24f, -0.2600001f, 0.16f,   -0.4496354f, -0.460341f, 0.7654504f,   0.f, 0.f,   117, 117, 0, 255 },
+	{ -0.13f, -0.14f, 0.24f,   -0.283091f, -0.3386982f, 0.8972977f,   0.f, 0.f,   86, 86, 0, 255 },
+	{ -0.38f, -0.09000003f, 0.18f,   -0.283091f, -0.3386982f, 0.8972977f,   0.f, 0.f,   86, 86, 0, 255 },
+	{ -0.24f, -0.2600001f, 0.16f,   -0.283091f, -0.3386982f, 0.8972977f,   0.f, 0.f,   86, 86, 0, 255 },
+	{ 0.f, -0.34f, 0.f,   0.3464486f, -0.9365535f, -0.0532998f,   0.f, 0.f,   239, 239, 0, 255 },
+	{ 0.2f, -0.27f, 0.06999999f,   0.3464486f, -0.9365535f, -0.0532998f,   0.f, 0.f,   239, 239, 0, 255 },
+	{ 0.02000001f, -0.34f, 0.13f,   0.3464486f, -0.9365535f, -0.0532998f,   0.f, 0.f,   239, 239, 0, 255 },
+	{ 0.f, -0.34f, 0.f,   0.3385973f, -0.9405476f, -0.02687324f,   0.f, 0.f,   240, 240, 0, 255 },
+	{ 0.25f, -0.25f, -1.092785e-08f,   0.3385973f, -0.9405476f, -0.02687324f,   0.f, 0.f,   240, 240, 0, 255 },
+	{ 0.2f, -0.27f, 0.06999999f,   0.3385973f, -0.9405476f, -0.02687324f,   0.f, 0.f,   240, 240, 0, 255 },
+	{ 0.2f, -0.27f, 0.06999999f,   0.4093776f, -0.8931876f, 0.1860806f,   0.f, 0.f,   228, 228, 0, 255 },
+	{ 0.15f, -0.27f, 0.18f,   0.4093776f, -0.8931876f, 0.1860806f,   0.f, 0.f,   228, 228, 0, 255 },
+	{ 0.02000001f, -0.34f, 0.13f,   0.4093776f, -0.8931876f, 0.1860806f,   0.f, 0.f,   228, 228, 0, 255 },
+	{ 0.f, -0.34f, 0.f,   0.1917734f, -0.9809957f, -0.02950361f,   0.f, 0.f,   250, 250, 0, 255 },
+	{ 0.02000001f, -0.34f, 0.13f,   0.1917734f, -0.9809957f, -0.02950361f,   0.f, 0.f,   250, 250, 0, 255 },
+	{ -0.09f, -0.36f, 0.08000001f,   0.1917734f, -0.9809957f, -0.02950361f,   0.f, 0.f,   250, 250, 0, 255 },
+	{ -0.46f, -0.2600001f, 0.03000002f,   -0.08185445f, -0.9413275f, 0.3274179f,   0.f, 0.f,   240, 240, 0, 255 },
+	{ -0.39f, -0.28f, -0.009999983f,   -0.08185445f, -0.9413275f, 0.3274179f,   0.f, 0.f,   240, 240, 0, 255 },
+	{ -0.38f, -0.2600001f, 0.05000002f,   -0.08185445f, -0.9413275f, 0.3274179f,   0.f, 0.f,   240, 240, 0, 255 },
+	{ -0.39f, -0.28f, -0.009999983f,   -0.5106391f, -0.8346982f, 0.2062196f,   0.f, 0.f,   213, 213, 0, 255 },
+	{ -0.3f, -0.34f, -0.02999999f,   -0.5106391f, -0.8346982f, 0.2062196f,   0.f, 0.f,   213, 213, 0, 255 },
+	{ -0.28f, -0.33f, 0.06000001f,   -0.5106391f, -0.8346982f, 0.2062196f,   0.f, 0.f,   213, 213, 0, 255 },
+	{ -0.38f, -0.2600001f, 0.05000002f,   -0.5612501f, -0.7525855f, 0.3444032f,   0.f, 0.f,   192, 192, 0, 255 },
+	{ -0.39f, -0.28f, -0.009999983f,   -0.5612501f, -0.7525855f, 0.3444032f,   0.f, 0.f,   192, 192, 0, 255 },
+	{ -0.28f, -0.33f, 0.06000001f,   -0.5612501f, -0.7525855f, 0.3444032f,   0.f, 0.f,   192, 192, 0, 255 },
+	{ -0.17f, -0.37f, 7.430936e-09f,   0.1735623f, -0.983521f, -0.05062234f,   0.f, 0.f,   251, 251, 0, 255 },
+	{ 0.f, -0.34f, 0.f,   0.1735623f, -0.983521f, -0.05062234f,   0.f, 0.f,   251, 251, 0, 255 },
+	{ -0.09f, -0.36f, 0.08000001f,   0.1735623f, -0.983521f, -0.05062234f,   0.f, 0.f,   251, 251, 0, 255 },
+	{ 0.12f, -0.21f, 0.23f,   -0.0631044f, -0.3584327f, 0.9314203f,   0.f, 0.f,   91, 91, 0, 255 },
+	{ -0.13f, -0.14f, 0.24f,   -0.0631044f, -0.3584327f, 0.9314203f,   0.f, 0.f,   91, 91, 0, 255 },
+	{ -0.04999999f, -0.31f, 0.18f,   -0.0631044f, -0.3584327f, 0.9314203f,   0.f, 0.f,   91, 91, 0, 255 },
+	{ -0.13f, -0.14f, 0.24f,   -0.0232034f, -0.0629806f, 0.997745f,   0.f, 0.f,   16, 16, 0, 255 },
+	{ 0.11f, -0.07000005f, 0.25f,   -0.0232034f, -0.0629806f, 0.997745f,   0.f, 0.f,   16, 16, 0, 255 },
+	{ -0.07999999f, 0.f, 0.25f,   -0.0232034f, -0.0629806f, 0.997745f,   0.f, 0.f,   16, 16, 0, 255 },
+	{ 0.11f, -0.07000005f, 0.25f,   -3.023929e-08f, -0.1414213f, 0.9899495f,   0.f, 0.f,   36, 36, 0, 255 },
+	{ -0.13f, -0.14f, 0.24f,   -3.023929e-08f, -0.1414213f, 0.9899495f,   0.f, 0.f,   36, 36, 0, 255 },
+	{ 0.12f, -0.21f, 0.23f,   -3.023929e-08f, -0.1414213f, 0.9899495f,   0.f, 0.f,   36, 36, 0, 255 },
+	{ -0.04999999f, -0.31f, 0.18f,   -0.2599199f, -0.7391477f, 0.6213713f,   0.f, 0.f,   188, 188, 0, 255 },
+	{ -0.24f, -0.2600001f, 0.16f,   -0.2599199f, -0.7391477f, 0.6213713f,   0.f, 0.f,   188, 188, 0, 255 },
+	{ -0.28f, -0.33f, 0.06000001f,   -0.2599199f, -0.7391477f, 0.6213713f,   0.f, 0.f,   188, 188, 0, 255 },
+	{ -0.04999999f, -0.31f, 0.18f,   -0.1861511f, -0.8469881f, 0.4979547f,   0.f, 0.f,   216, 216, 0, 255 },
+	{ -0.28f, -0.33f, 0.06000001f,   -0.1861511f, -0.8469881f, 0.4979547f,   0.f, 0.f,   216, 216, 0, 255 },
+	{ -0.09f, -0.36f, 0.08000001f,   -0.1861511f, -0.8469881f, 0.4979547f,   0.f, 0.f,   216, 216, 0, 255 },
+	{ -0.39f, -0.18f, 0.12f,   -0.4906411f, -0.6077256f, 0.6244525f,   0.f, 0.f,   155, 155, 0, 255 },
+	{ -0.38f, -0.2600001f, 0.05000002f,   -0.4906411f, -0.6077256f, 0.6244525f,   0.f, 0.f,   155, 155, 0, 255 },
+	{ -0.24f, -0.2600001f, 0.16f,   -0.4906411f, -0.6077256f, 0.6244525f,   0.f, 0.f,   155, 155, 0, 255 },
+	{ 0.12f, -0.21f, 0.23f,   0.1199002f, -0.5995014f, 0.791342f,   0.f, 0.f,   153, 153, 0, 255 },
+	{ -0.04999999f, -0.31f, 0.18f,   0.1199002f, -0.5995014f, 0.791342f,   0.f, 0.f,   153, 153, 0, 255 },
+	{ 0.15f, -0.27f, 0.18f,   0.1199002f, -0.5995014f, 0.791342f,   0.f, 0.f,   153, 153, 0, 255 },
+	{ 0.02000001f, -0.34f, 0.13f,   0.1484783f, -0.7423923f, 0.6533054f,   0.f, 0.f,   189, 189, 0, 255 },
+	{ 0.15f, -0.27f, 0.18f,   0.1484783f, -0.7423923f, 0.6533054f,   0.f, 0.f,   189, 189, 0, 255 },
+	{ -0.04999999f, -0.31f, 0.18f,   0.1484783f, -0.7423923f, 0.6533054f,   0.f, 0.f,   189, 189, 0, 255 },
+	{ -0.09f, -0.36f, 0.08000001f,   -0.04918553f, -0.8853362f, 0.4623424f,   0.f, 0.f,   226, 226, 0, 255 },
+	{ 0.02000001f, -0.34f, 0.13f,   -0.04918553f, -0.8853362f, 0.4623424f,   0.f, 0.f,   226, 226, 0, 255 },
+	{ -0.04999999f, -0.31f, 0.18f,   -0.04918553f, -0.8853362f, 0.4623424f,   0.f, 0.f,   226, 226, 0, 255 },
+	{ 0.91f, 0.3f, -3.977737e-08f,   -0.8017837f, -0.5345225f, 0.267261f,   0.f, 0.f,   136, 136, 0, 255 },
+	{ 0.95f, 0.24f, -4.152582e-08f,   -0.8017837f, -0.5345225f, 0.267261f,   0.f, 0.f,   136, 136, 0, 255 },
+	{ 0.96f, 0.24f, 0.02999996f,   -0.8017837f, -0.5345225f, 0.267261f,   0.f, 0.f,   136, 136, 0, 255 },
+	{ 1.07f, 0.28f, 0.03999995f,   0.658279f, -0.2531844f, 0.7089192f,   0.f, 0.f,   65, 65, 0, 255 },
+	{ 1.09f, 0.36f, 0.04999995f,   0.658279f, -0.2531844f, 0.7089192f,   0.f, 0.f,   65, 65, 0, 255 },
+	{ 1.06f, 0.3099999f, 0.05999995f,   0.658279f, -0.2531844f, 0.7089192f,   0.f, 0.f,   65, 65, 0, 255 },
+	{ 0.85f, 0.67f, 0.03999996f,   0.7742744f, 0.6320604f, 0.03160305f,   0.f, 0.f,   161, 161, 0, 255 },
+	{ 0.93f, 0.5699999f, 0.07999996f,   0.7742744f, 0.6320604f, 0.03160305f,   0.f, 0.f,   161, 161, 0, 255 },
+	{ 0.95f, 0.55f, -0.01000004f,   0.7742744f, 0.6320604f, 0.03160305f,   0.f, 0.f,   161, 161, 0, 255 },
+	{ 0.78f, 0.36f, 0.02999997f,   -0.7548293f, -0.6469966f, -0.1078327f,   0.f, 0.f,   165, 165, 0, 255 },
+	{ 0.75f, 0.4f, -3.278354e-08f,   -0.7548293f, -0.6469966f, -0.1078327f,   0.f, 0.f,   165, 165, 0, 255 },
+	{ 0.78f, 0.37f, -0.03000003f,   -0.7548293f, -0.6469966f, -0.1078327f,   0.f, 0.f,   165, 165, 0, 255 },
+	{ 0.75f, 0.4f, -3.278354e-08f,   -0.6304884f, -0.7092994f, -0.3152439f,   0.f, 0.f,   181, 181, 0, 255 },
+	{ 0.78f, 0.36f, 0.02999997f,   -0.6304884f, -0.7092994f, -0.3152439f,   0.f, 0.f,   181, 181, 0, 255 },
+	{ 0.76f, 0.36f, 0.06999997f,   -0.6304884f, -0.7092994f, -0.3152439f,   0.f, 0.f,   181, 181, 0, 255 },
+	{ 0.91f, 0.3f, -3.977737e-08f,   0.08108093f, -0.6486484f, 0.756757f,   0.f, 0.f,   165, 165, 0, 255 },
+	{ 0.91f, 0.37f, 0.05999996f,   0.08108093f, -0.6486484f, 0.756757f,   0.f, 0.f,   165, 165, 0, 255 },
+	{ 0.83f, 0.36f, 0.05999996f,   0.08108093f, -0.6486484f, 0.756757f,   0.f, 0.f,   165, 165, 0, 255 },
+	{ 0.78f, 0.36f, 0.02999997f,   0.f, -1.f, 0.f,   0.f, 0.f,   255, 255, 0, 255 },
+	{ 0.83f, 0.36f, 0.05999996f,   0.f, -1.f, 0.f,   0.f, 0.f,   255, 255, 0, 255 },
+	{ 0.76f, 0.36f, 0.06999997f,   0.f, -1.f, 0.f,   0.f, 0.f,   255, 255, 0, 255 },
+	{ 0.78f, 0.36f, 0.02999997f,   -0.2797515f, -0.8392541f, 0.4662527f,   0.f, 0.f,   214, 214, 0, 255 },
+	{ 0.91f, 0.3f, -3.977737e-08f,   -0.2797515f, -0.8392541f, 0.4662527f,   0.f, 0.f,   214, 214, 0, 255 },
+	{ 0.83f, 0.36f, 0.05999996f,   -0.2797515f, -0.8392541f, 0.4662527f,   0.f, 0.f,   214, 214, 0, 255 },
+	{ 0.91f, 0.3f, -3.977737e-08f,   -0.6246622f, -0.5081996f, 0.5929f,   0.f, 0.f,   130, 130, 0, 255 },
+	{ 0.99f, 0.26f, 0.04999996f,   -0.6246622f, -0.5081996f, 0.5929f,   0.f, 0.f,   130, 130, 0, 255 },
+	{ 0.91f, 0.37f, 0.05999996f,   -0.6246622f, -0.5081996f, 0.5929f,   0.f, 0.f,   130, 130, 0, 255 },
+	{ 0.91f, 0.3f, -3.977737e-08f,   -0.5405136f, -0.03002802f, 0.8407993f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ 0.96f, 0.24f, 0.02999996f,   -0.5405136f, -0.03002802f, 0.8407993f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ 0.99f, 0.26f, 0.04999996f,   -0.5405136f, -0.03002802f, 0.8407993f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ -0.6f, 0.03999996f, 0.22f,   0.0884426f, 0.2920661f, 0.9523f,   0.f, 0.f,   74, 74, 0, 255 },
+	{ -0.31f, 0.04999995f, 0.19f,   0.0884426f, 0.2920661f, 0.9523f,   0.f, 0.f,   74, 74, 0, 255 },
+	{ -0.3f, 0.2099999f, 0.14f,   0.0884426f, 0.2920661f, 0.9523f,   0.f, 0.f,   74, 74, 0, 255 },
+	{ -0.3f, 0.2099999f, 0.14f,   0.1915316f, 0.1203913f, 0.9740748f,   0.f, 0.f,   31, 31, 0, 255 },
+	{ -0.72f, 0.15f, 0.23f,   0.1915316f, 0.1203913f, 0.9740748f,   0.f, 0.f,   31, 31, 0, 255 },
+	{ -0.6f, 0.03999996f, 0.22f,   0.1915316f, 0.1203913f, 0.9740748f,   0.f, 0.f,   31, 31, 0, 255 },
+	{ -0.72f, 0.15f, 0.23f,   0.1881211f, 0.1410908f, 0.9719587f,   0.f, 0.f,   36, 36, 0, 255 },
+	{ -0.3f, 0.2099999f, 0.14f,   0.1881211f, 0.1410908f, 0.9719587f,   0.f, 0.f,   36, 36, 0, 255 },
+	{ -0.61f, 0.2099999f, 0.2f,   0.1881211f, 0.1410908f, 0.9719587f,   0.f, 0.f,   36, 36, 0, 255 },
+	{ -0.61f, 0.2099999f, 0.2f,   -0.3278565f, 0.8282704f, 0.4543985f,   0.f, 0.f,   211, 211, 0, 255 },
+	{ -0.65f, 0.26f, 0.08000003f,   -0.3278565f, 0.8282704f, 0.4543985f,   0.f, 0.f,   211, 211, 0, 255 },
+	{ -0.72f, 0.15f, 0.23f,   -0.3278565f, 0.8282704f, 0.4543985f,   0.f, 0.f,   211, 211, 0, 255 },
+	{ -0.51f, 0.26f, 0.15f,   0.1628177f, 0.5155886f, 0.8412246f,   0.f, 0.f,   131, 131, 0, 255 },
+	{ -0.61f, 0.2099999f, 0.2f,   0.1628177f, 0.5155886f, 0.8412246f,   0.f, 0.f,   131, 131, 0, 255 },
+	{ -0.3f, 0.2099999f, 0.14f,   0.1628177f, 0.5155886f, 0.8412246f,   0.f, 0.f,   131, 131, 0, 255 },
+	{ -0.64f, -0.23f, 0.04000003f,   -0.1808475f, -0.2160122f, -0.9594962f,   0.f, 0.f,   55, 55, 0, 255 },
+	{ -0.75f, -0.36f, 0.09000003f,   -0.1808475f, -0.2160122f, -0.9594962f,   0.f, 0.f,   55, 55, 0, 255 },
+	{ -0.77f, -0.21f, 0.06000003f,   -0.1808475f, -0.2160122f, -0.9594962f,   0.f, 0.f,   55, 55, 0, 255 },
+	{ -0.75f, -0.36f, 0.09000003f,   -0.3099807f, -0.2260277f, -0.9234844f,   0.f, 0.f,   58, 58, 0, 255 },
+	{ -0.84f, -0.4f, 0.13f,   -0.3099807f, -0.2260277f, -0.9234844f,   0.f, 0.f,   58, 58, 0, 255 },
+	{ -0.77f, -0.21f, 0.06000003f,   -0.3099807f, -0.2260277f, -0.9234844f,   0.f, 0.f,   58, 58, 0, 255 },
+	{ -0.84f, -0.4f, 0.13f,   -0.4506059f, -0.157712f, -0.8786815f,   0.f, 0.f,   40, 40, 0, 255 },
+	{ -0.83f, -0.15f, 0.08000004f,   -0.4506059f, -0.157712f, -0.8786815f,   0.f, 0.f,   40, 40, 0, 255 },
+	{ -0.77f, -0.21f, 0.06000003f,   -0.4506059f, -0.157712f, -0.8786815f,   0.f, 0.f,   40, 40, 0, 255 },
+	{ 0.51f, 0.1999999f, -2.229281e-08f,   0.8779952f, -0.1562077f, 0.4524639f,   0.f, 0.f,   40, 40, 0, 255 },
+	{ 0.48f, 0.35f, 0.11f,   0.8779952f, -0.1562077f, 0.4524639f,   0.f, 0.f,   40, 40, 0, 255 },
+	{ 0.47f, 0.12f, 0.04999998f,   0.8779952f, -0.1562077f, 0.4524639f,   0.f, 0.f,   40, 40, 0, 255 },
+	{ 0.61f, 0.6f, 0.08999997f,   0.1973903f, -0.02424097f, 0.9800252f,   0.f, 0.f,   6, 6, 0, 255 },
+	{ 0.32f, 0.26f, 0.14f,   0.1973903f, -0.02424097f, 0.9800252f,   0.f, 0.f,   6, 6, 0, 255 },
+	{ 0.48f, 0.35f, 0.11f,   0.1973903f, -0.02424097f, 0.9800252f,   0.f, 0.f,   6, 6, 0, 255 },
+	{ 0.38f, 0.1799999f, 0.15f,   0.6573403f, -0.2168544f, 0.7217188f,   0.f, 0.f,   55, 55, 0, 255 },
+	{ 0.47f, 0.12f, 0.04999998f,   0.6573403f, -0.2168544f, 0.7217188f,   0.f, 0.f,   55, 55, 0, 255 },
+	{ 0.48f, 0.35f, 0.11f,   0.6573403f, -0.2168544f, 0.7217188f,   0.f, 0.f,   55, 55, 0, 255 },
+	{ 0.31f, 0.47f, 0.01999999f,   -0.1687935f, 0.3563412f, 0.918983f,   0.f, 0.f,   91, 91, 0, 255 },
+	{ 0.37f, 0.55f, -1.617321e-08f,   -0.1687935f, 0.3563412f, 0.918983f,   0.f, 0.f,   91, 91, 0, 255 },
+	{ 0.06f, 0.3f, 0.04f,   -0.1687935f, 0.3563412f, 0.918983f,   0.f, 0.f,   91, 91, 0, 255 },
+	{ 0.32f, 0.26f, 0.14f,   -0.1519633f, 0.2694608f, 0.9509459f,   0.f, 0.f,   69, 69, 0, 255 },
+	{ 0.61f, 0.6f, 0.08999997f,   -0.1519633f, 0.2694608f, 0.9509459f,   0.f, 0.f,   69, 69, 0, 255 },
+	{ 0.15f, 0.27f, 0.11f,   -0.1519633f, 0.2694608f, 0.9509459f,   0.f, 0.f,   69, 69, 0, 255 },
+	{ 0.31f, 0.47f, 0.01999999f,   -0.4250186f, 0.6317397f, 0.6482778f,   0.f, 0.f,   161, 161, 0, 255 },
+	{ 0.15f, 0.27f, 0.11f,   -0.4250186f, 0.6317397f, 0.6482778f,   0.f, 0.f,   161, 161, 0, 255 },
+	{ 0.61f, 0.6f, 0.08999997f,   -0.4250186f, 0.6317397f, 0.6482778f,   0.f, 0.f,   161, 161, 0, 255 },
+	{ -0.65f, 0.26f, 0.08000003f,   -0.102463f, 0.9733995f, 0.2049261f,   0.f, 0.f,   248, 248, 0, 255 },
+	{ -0.51f, 0.26f, 0.15f,   -0.102463f, 0.9733995f, 0.2049261f,   0.f, 0.f,   248, 248, 0, 255 },
+	{ -0.54f, 0.28f, 0.04000002f,   -0.102463f, 0.9733995f, 0.2049261f,   0.f, 0.f,   248, 248, 0, 255 },
+	{ -0.61f, 0.2099999f, 0.2f,   -0.2182181f, 0.8728713f, 0.4364362f,   0.f, 0.f,   223, 223, 0, 255 },
+	{ -0.51f, 0.26f, 0.15f,   -0.2182181f, 0.8728713f, 0.4364362f,   0.f, 0.f,   223, 223, 0, 255 },
+	{ -0.65f, 0.26f, 0.08000003f,   -0.2182181f, 0.8728713f, 0.4364362f,   0.f, 0.f,   223, 223, 0, 255 },
+	{ -0.78f, 0.22f, 3.409488e-08f,   -0.2210947f, 0.9672902f, -0.1243657f,   0.f, 0.f,   247, 247, 0, 255 },
+	{ -0.65f, 0.26f, 0.08000003f,   -0.2210947f, 0.9672902f, -0.1243657f,   0.f, 0.f,   247, 247, 0, 255 },
+	{ -0.54f, 0.28f, 0.04000002f,   -0.2210947f, 0.9672902f, -0.1243657f,   0.f, 0.f,   247, 247, 0, 255 },
+	{ 0.65f, 0.39f, 0.05999997f,   -0.2631172f, -0.9647639f, 0.f,   0.f, 0.f,   246, 246, 0, 255 },
+	{ 0.76f, 0.36f, 0.06999997f,   -0.2631172f, -0.9647639f, 0.f,   0.f, 0.f,   246, 246, 0, 255 },
+	{ 0.65f, 0.39f, 0.08999997f,   -0.2631172f, -0.9647639f, 0.f,   0.f, 0.f,   246, 246, 0, 255 },
+	{ 0.75f, 0.4f, -3.278354e-08f,   -0.1931567f, -0.8635251f, -0.4658486f,   0.f, 0.f,   220, 220, 0, 255 },
+	{ 0.76f, 0.36f, 0.06999997f,   -0.1931567f, -0.8635251f, -0.4658486f,   0.f, 0.f,   220, 220, 0, 255 },
+	{ 0.65f, 0.39f, 0.05999997f,   -0.1931567f, -0.8635251f, -0.4658486f,   0.f, 0.f,   220, 220, 0, 255 },
+	{ 1.02f, 0.22f, 0.009999955f,   -0.2860385f, -0.9534627f, 0.09534612f,   0.f, 0.f,   243, 243, 0, 255 },
+	{ 0.96f, 0.24f, 0.02999996f,   -0.2860385f, -0.9534627f, 0.09534612f,   0.f, 0.f,   243, 243, 0, 255 },
+	{ 0.95f, 0.24f, -4.152582e-08f,   -0.2860385f, -0.9534627f, 0.09534612f,   0.f, 0.f,   243, 243, 0, 255 },
+	{ 0.65f, 0.41f, 0.009999971f,   -0.1289022f, -0.9207308f, -0.368292f,   0.f, 0.f,   235, 235, 0, 255 },
+	{ 0.75f, 0.4f, -3.278354e-08f,   -0.1289022f, -0.9207308f, -0.368292f,   0.f, 0.f,   235, 235, 0, 255 },
+	{ 0.65f, 0.39f, 0.05999997f,   -0.1289022f, -0.9207308f, -0.368292f,   0.f, 0.f,   235, 235, 0, 255 },
+	{ 1.02f, 0.22f, 0.009999955f,   2.286613e-08f, -0.7071071f, 0.7071064f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ 0.99f, 0.26f, 0.04999996f,   2.286613e-08f, -0.7071071f, 0.7071064f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ 0.96f, 0.24f, 0.02999996f,   2.286613e-08f, -0.7071071f, 0.7071064f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ 1.02f, 0.23f, 0.009999955f,   0.8000003f, 0.f, 0.5999997f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.99f, 0.26f, 0.04999996f,   0.8000003f, 0.f, 0.5999997f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 1.02f, 0.22f, 0.009999955f,   0.8000003f, 0.f, 0.5999997f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.75f, 0.6799999f, 0.07999997f,   -0.2772021f, 0.4389037f, 0.8547061f,   0.f, 0.f,   112, 112, 0, 255 },
+	{ 0.72f, 0.6999999f, 0.05999997f,   -0.2772021f, 0.4389037f, 0.8547061f,   0.f, 0.f,   112, 112, 0, 255 },
+	{ 0.67f, 0.61f, 0.08999997f,   -0.2772021f, 0.4389037f, 0.8547061f,   0.f, 0.f,   112, 112, 0, 255 },
+	{ 0.64f, 0.6899999f, 0.03999997f,   -0.2691863f, 0.4358262f, 0.8588331f,   0.f, 0.f,   111, 111, 0, 255 },
+	{ 0.67f, 0.61f, 0.08999997f,   -0.2691863f, 0.4358262f, 0.8588331f,   0.f, 0.f,   111, 111, 0, 255 },
+	{ 0.72f, 0.6999999f, 0.05999997f,   -0.2691863f, 0.4358262f, 0.8588331f,   0.f, 0.f,   111, 111, 0, 255 },
+	{ 0.61f, 0.51f, 0.09999997f,   -0.03277122f, -0.1037755f, 0.9940607f,   0.f, 0.f,   26, 26, 0, 255 },
+	{ 0.75f, 0.37f, 0.08999997f,   -0.03277122f, -0.1037755f, 0.9940607f,   0.f, 0.f,   26, 26, 0, 255 },
+	{ 0.8f, 0.4499999f, 0.09999996f,   -0.03277122f, -0.1037755f, 0.9940607f,   0.f, 0.f,   26, 26, 0, 255 },
+	{ 0.61f, 0.51f, 0.09999997f,   -0.01778355f, -0.08891784f, 0.9958802f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ 0.65f, 0.39f, 0.08999997f,   -0.01778355f, -0.08891784f, 0.9958802f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ 0.75f, 0.37f, 0.08999997f,   -0.01778355f, -0.08891784f, 0.9958802f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ 0.81f, 0.51f, 0.11f,   -0.04932465f, -0.1561947f, 0.9864939f,   0.f, 0.f,   40, 40, 0, 255 },
+	{ 0.61f, 0.51f, 0.09999997f,   -0.04932465f, -0.1561947f, 0.9864939f,   0.f, 0.f,   40, 40, 0, 255 },
+	{ 0.8f, 0.4499999f, 0.09999996f,   -0.04932465f, -0.1561947f, 0.9864939f,   0.f, 0.f,   40, 40, 0, 255 },
+	{ 0.67f, 0.61f, 0.08999997f,   -0.04952191f, 0.128757f, 0.9904389f,   0.f, 0.f,   33, 33, 0, 255 },
+	{ 0.61f, 0.51f, 0.09999997f,   -0.04952191f, 0.128757f, 0.9904389f,   0.f, 0.f,   33, 33, 0, 255 },
+	{ 0.81f, 0.51f, 0.11f,   -0.04952191f, 0.128757f, 0.9904389f,   0.f, 0.f,   33, 33, 0, 255 },
+	{ 0.9f, 0.49f, 0.07999996f,   0.3619617f, -0.517087f, 0.7756318f,   0.f, 0.f,   132, 132, 0, 255 },
+	{ 0.8f, 0.4499999f, 0.09999996f,   0.3619617f, -0.517087f, 0.7756318f,   0.f, 0.f,   132, 132, 0, 255 },
+	{ 0.95f, 0.48f, 0.04999996f,   0.3619617f, -0.517087f, 0.7756318f,   0.f, 0.f,   132, 132, 0, 255 },
+	{ 0.91f, 0.37f, 0.05999996f,   0.321638f, -0.03092665f, 0.9463575f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ 0.95f, 0.48f, 0.04999996f,   0.321638f, -0.03092665f, 0.9463575f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ 0.8f, 0.4499999f, 0.09999996f,   0.321638f, -0.03092665f, 0.9463575f,   0.f, 0.f,   8, 8, 0, 255 },
+	{ 0.9f, 0.49f, 0.07999996f,   0.2690693f, -0.2018016f, 0.9417419f,   0.f, 0.f,   51, 51, 0, 255 },
+	{ 0.81f, 0.51f, 0.11f,   0.2690693f, -0.2018016f, 0.9417419f,   0.f, 0.f,   51, 51, 0, 255 },
+	{ 0.8f, 0.4499999f, 0.09999996f,   0.2690693f, -0.2018016f, 0.9417419f,   0.f, 0.f,   51, 51, 0, 255 },
+	{ 0.76f, 0.36f, 0.06999997f,   0.06757375f, -0.8784589f, 0.4730158f,   0.f, 0.f,   224, 224, 0, 255 },
+	{ 0.83f, 0.36f, 0.05999996f,   0.06757375f, -0.8784589f, 0.4730158f,   0.f, 0.f,   224, 224, 0, 255 },
+	{ 0.75f, 0.37f, 0.08999997f,   0.06757375f, -0.8784589f, 0.4730158f,   0.f, 0.f,   224, 224, 0, 255 },
+	{ 0.65f, 0.39f, 0.08999997f,   -0.182574f, -0.9128711f, 0.3651482f,   0.f, 0.f,   233, 233, 0, 255 },
+	{ 0.76f, 0.36f, 0.06999997f,   -0.182574f, -0.9128711f, 0.3651482f,   0.f, 0.f,   233, 233, 0, 255 },
+	{ 0.75f, 0.37f, 0.08999997f,   -0.182574f, -0.9128711f, 0.3651482f,   0.f, 0.f,   233, 233, 0, 255 },
+	{ 0.75f, 0.37f, 0.08999997f,   0.1792793f, -0.2315692f, 0.9561561f,   0.f, 0.f,   59, 59, 0, 255 },
+	{ 0.91f, 0.37f, 0.05999996f,   0.1792793f, -0.2315692f, 0.9561561f,   0.f, 0.f,   59, 59, 0, 255 },
+	{ 0.8f, 0.4499999f, 0.09999996f,   0.1792793f, -0.2315692f, 0.9561561f,   0.f, 0.f,   59, 59, 0, 255 },
+	{ 0.83f, 0.36f, 0.05999996f,   0.1034482f, -0.8275867f, 0.5517235f,   0.f, 0.f,   211, 211, 0, 255 },
+	{ 0.91f, 0.37f, 0.05999996f,   0.1034482f, -0.8275867f, 0.5517235f,   0.f, 0.f,   211, 211, 0, 255 },
+	{ 0.75f, 0.37f, 0.08999997f,   0.1034482f, -0.8275867f, 0.5517235f,   0.f, 0.f,   211, 211, 0, 255 },
+	{ 0.99f, 0.26f, 0.04999996f,   0.1130873f, -0.008077656f, 0.9935522f,   0.f, 0.f,   2, 2, 0, 255 },
+	{ 1.f, 0.4f, 0.04999996f,   0.1130873f, -0.008077656f, 0.9935522f,   0.f, 0.f,   2, 2, 0, 255 },
+	{ 0.91f, 0.37f, 0.05999996f,   0.1130873f, -0.008077656f, 0.9935522f,   0.f, 0.f,   2, 2, 0, 255 },
+	{ 0.31f, -0.29f, 0.22f,   0.0383545f, -0.06392424f, 0.9972174f,   0.f, 0.f,   16, 16, 0, 255 },
+	{ 0.36f, -0.2600001f, 0.22f,   0.0383545f, -0.06392424f, 0.9972174f,   0.f, 0.f,   16, 16, 0, 255 },
+	{ 0.25f, -0.17f, 0.23f,   0.0383545f, -0.06392424f, 0.9972174f,   0.f, 0.f,   16, 16, 0, 255 },
+	{ 0.36f, -0.2600001f, 0.22f,   -0.1290151f, -0.2638945f, 0.9558843f,   0.f, 0.f,   67, 67, 0, 255 },
+	{ 0.26f, -0.02999997f, 0.27f,   -0.1290151f, -0.2638945f, 0.9558843f,   0.f, 0.f,   67, 67, 0, 255 },
+	{ 0.25f, -0.17f, 0.23f,   -0.1290151f, -0.2638945f, 0.9558843f,   0.f, 0.f,   67, 67, 0, 255 },
+	{ 0.26f, -0.02999997f, 0.27f,   0.2608398f, -0.09542922f, 0.9606538f,   0.f, 0.f,   24, 24, 0, 255 },
+	{ 0.36f, -0.2600001f, 0.22f,   0.2608398f, -0.09542922f, 0.9606538f,   0.f, 0.f,   24, 24, 0, 255 },
+	{ 0.4f, -0.05000007f, 0.23f,   0.2608398f, -0.09542922f, 0.9606538f,   0.f, 0.f,   24, 24, 0, 255 },
+	{ 0.4f, -0.05000007f, 0.23f,   0.8553795f, -0.185952f, 0.4834746f,   0.f, 0.f,   47, 47, 0, 255 },
+	{ 0.36f, -0.2600001f, 0.22f,   0.8553795f, -0.185952f, 0.4834746f,   0.f, 0.f,   47, 47, 0, 255 },
+	{ 0.39f, -0.2f, 0.19f,   0.8553795f, -0.185952f, 0.4834746f,   0.f, 0.f,   47, 47, 0, 255 },
+	{ 0.23f, -0.35f, 0.14f,   -0.9614823f, -0.2330867f, -0.1456793f,   0.f, 0.f,   59, 59, 0, 255 },
+	{ 0.21f, -0.28f, 0.16f,   -0.9614823f, -0.2330867f, -0.1456793f,   0.f, 0.f,   59, 59, 0, 255 },
+	{ 0.22f, -0.29f, 0.11f,   -0.9614823f, -0.2330867f, -0.1456793f,   0.f, 0.f,   59, 59, 0, 255 },
+	{ 0.25f, -0.33f, 0.19f,   -0.7419984f, -0.2119993f, 0.635999f,   0.f, 0.f,   54, 54, 0, 255 },
+	{ 0.23f, -0.2600001f, 0.19f,   -0.7419984f, -0.2119993f, 0.635999f,   0.f, 0.f,   54, 54, 0, 255 },
+	{ 0.21f, -0.28f, 0.16f,   -0.7419984f, -0.2119993f, 0.635999f,   0.f, 0.f,   54, 54, 0, 255 },
+	{ 0.23f, -0.35f, 0.14f,   -0.8055345f, -0.3637899f, 0.4677296f,   0.f, 0.f,   93, 93, 0, 255 },
+	{ 0.25f, -0.33f, 0.19f,   -0.8055345f, -0.3637899f, 0.4677296f,   0.f, 0.f,   93, 93, 0, 255 },
+	{ 0.21f, -0.28f, 0.16f,   -0.8055345f, -0.3637899f, 0.4677296f,   0.f, 0.f,   93, 93, 0, 255 },
+	{ 0.22f, -0.29f, 0.11f,   -0.546793f, -0.1682439f, -0.8201898f,   0.f, 0.f,   43, 43, 0, 255 },
+	{ 0.25f, -0.29f, 0.09f,   -0.546793f, -0.1682439f, -0.8201898f,   0.f, 0.f,   43, 43, 0, 255 },
+	{ 0.26f, -0.42f, 0.11f,   -0.546793f, -0.1682439f, -0.8201898f,   0.f, 0.f,   43, 43, 0, 255 },
+	{ 0.23f, -0.2600001f, 0.19f,   -0.4285714f, -0.2857143f, 0.8571429f,   0.f, 0.f,   73, 73, 0, 255 },
+	{ 0.31f, -0.29f, 0.22f,   -0.4285714f, -0.2857143f, 0.8571429f,   0.f, 0.f,   73, 73, 0, 255 },
+	{ 0.25f, -0.17f, 0.23f,   -0.4285714f, -0.2857143f, 0.8571429f,   0.f, 0.f,   73, 73, 0, 255 },
+	{ 0.25f, -0.33f, 0.19f,   -0.384884f, -0.1099668f, 0.9163905f,   0.f, 0.f,   28, 28, 0, 255 },
+	{ 0.31f, -0.29f, 0.22f,   -0.384884f, -0.1099668f, 0.9163905f,   0.f, 0.f,   28, 28, 0, 255 },
+	{ 0.23f, -0.2600001f, 0.19f,   -0.384884f, -0.1099668f, 0.9163905f,   0.f, 0.f,   28, 28, 0, 255 },
+	{ -0.6f, 0.03999996f, 0.22f,   0.02875896f, 0.1783052f, 0.983555f,   0.f, 0.f,   45, 45, 0, 255 },
+	{ -0.85f, -0.02999997f, 0.24f,   0.02875896f, 0.1783052f, 0.983555f,   0.f, 0.f,   45, 45, 0, 255 },
+	{ -0.82f, -0.09000003f, 0.25f,   0.02875896f, 0.1783052f, 0.983555f,   0.f, 0.f,   45, 45, 0, 255 },
+	{ -0.55f, -0.09000003f, 0.26f,   0.2124028f, 0.3610846f, 0.9080215f,   0.f, 0.f,   92, 92, 0, 255 },
+	{ -0.43f, -0.06000006f, 0.22f,   0.2124028f, 0.3610846f, 0.9080215f,   0.f, 0.f,   92, 92, 0, 255 },
+	{ -0.6f, 0.03999996f, 0.22f,   0.2124028f, 0.3610846f, 0.9080215f,   0.f, 0.f,   92, 92, 0, 255 },
+	{ -0.82f, -0.09000003f, 0.25f,   -0.03551605f, 0.2813966f, 0.958934f,   0.f, 0.f,   72, 72, 0, 255 },
+	{ -0.55f, -0.09000003f, 0.26f,   -0.03551605f, 0.2813966f, 0.958934f,   0.f, 0.f,   72, 72, 0, 255 },
+	{ -0.6f, 0.03999996f, 0.22f,   -0.03551605f, 0.2813966f, 0.958934f,   0.f, 0.f,   72, 72, 0, 255 },
+	{ -0.88f, -0.19f, 0.1500001f,   -0.9815598f, -0.1262825f, -0.1435028f,   0.f, 0.f,   32, 32, 0, 255 },
+	{ -0.9f, -0.08000004f, 0.19f,   -0.9815598f, -0.1262825f, -0.1435028f,   0.f, 0.f,   32, 32, 0, 255 },
+	{ -0.89f, -0.00999999f, 0.06000004f,   -0.9815598f, -0.1262825f, -0.1435028f,   0.f, 0.f,   32, 32, 0, 255 },
+	{ -0.82f, -0.09000003f, 0.25f,   -0.6047079f, -0.1727737f, 0.7774816f,   0.f, 0.f,   44, 44, 0, 255 },
+	{ -0.85f, -0.02999997f, 0.24f,   -0.6047079f, -0.1727737f, 0.7774816f,   0.f, 0.f,   44, 44, 0, 255 },
+	{ -0.9f, -0.08000004f, 0.19f,   -0.6047079f, -0.1727737f, 0.7774816f,   0.f, 0.f,   44, 44, 0, 255 },
+	{ 0.23f, -0.35f, 0.14f,   -0.9228348f, -0.2839491f, -0.2602865f,   0.f, 0.f,   72, 72, 0, 255 },
+	{ 0.22f, -0.29f, 0.11f,   -0.9228348f, -0.2839491f, -0.2602865f,   0.f, 0.f,   72, 72, 0, 255 },
+	{ 0.26f, -0.42f, 0.11f,   -0.9228348f, -0.2839491f, -0.2602865f,   0.f, 0.f,   72, 72, 0, 255 },
+	{ 0.39f, -0.24f, 0.15f,   0.7863336f, -0.4368522f, 0.4368518f,   0.f, 0.f,   111, 111, 0, 255 },
+	{ 0.44f, -0.19f, 0.11f,   0.7863336f, -0.4368522f, 0.4368518f,   0.f, 0.f,   111, 111, 0, 255 },
+	{ 0.39f, -0.2f, 0.19f,   0.7863336f, -0.4368522f, 0.4368518f,   0.f, 0.f,   111, 111, 0, 255 },
+	{ -0.82f, -0.09000003f, 0.25f,   -0.03676867f, -0.1143916f, 0.9927551f,   0.f, 0.f,   29, 29, 0, 255 },
+	{ -0.81f, -0.18f, 0.24f,   -0.03676867f, -0.1143916f, 0.9927551f,   0.f, 0.f,   29, 29, 0, 255 },
+	{ -0.55f, -0.09000003f, 0.26f,   -0.03676867f, -0.1143916f, 0.9927551f,   0.f, 0.f,   29, 29, 0, 255 },
+	{ -0.38f, -0.09000003f, 0.18f,   0.4169984f, -0.3958845f, 0.8181612f,   0.f, 0.f,   101, 101, 0, 255 },
+	{ -0.43f, -0.06000006f, 0.22f,   0.4169984f, -0.3958845f, 0.8181612f,   0.f, 0.f,   101, 101, 0, 255 },
+	{ -0.53f, -0.31f, 0.15f,   0.4169984f, -0.3958845f, 0.8181612f,   0.f, 0.f,   101, 101, 0, 255 },
+	{ -0.65f, -0.36f, 0.23f,   0.6154575f, -0.492366f, 0.6154574f,   0.f, 0.f,   126, 126, 0, 255 },
+	{ -0.53f, -0.31f, 0.15f,   0.6154575f, -0.492366f, 0.6154574f,   0.f, 0.f,   126, 126, 0, 255 },
+	{ -0.52f, -0.21f, 0.22f,   0.6154575f, -0.492366f, 0.6154574f,   0.f, 0.f,   126, 126, 0, 255 },
+	{ -0.61f, -0.17f, 0.24f,   0.1781741f, -0.08908697f, 0.9799579f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ -0.65f, -0.36f, 0.23f,   0.1781741f, -0.08908697f, 0.9799579f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ -0.52f, -0.21f, 0.22f,   0.1781741f, -0.08908697f, 0.9799579f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ -0.52f, -0.21f, 0.22f,   0.07928947f, -0.2973359f, 0.951475f,   0.f, 0.f,   76, 76, 0, 255 },
+	{ -0.55f, -0.09000003f, 0.26f,   0.07928947f, -0.2973359f, 0.951475f,   0.f, 0.f,   76, 76, 0, 255 },
+	{ -0.61f, -0.17f, 0.24f,   0.07928947f, -0.2973359f, 0.951475f,   0.f, 0.f,   76, 76, 0, 255 },
+	{ -0.43f, -0.06000006f, 0.22f,   0.7312327f, -0.4387395f, 0.5223088f,   0.f, 0.f,   112, 112, 0, 255 },
+	{ -0.52f, -0.21f, 0.22f,   0.7312327f, -0.4387395f, 0.5223088f,   0.f, 0.f,   112, 112, 0, 255 },
+	{ -0.53f, -0.31f, 0.15f,   0.7312327f, -0.4387395f, 0.5223088f,   0.f, 0.f,   112, 112, 0, 255 },
+	{ -0.52f, -0.21f, 0.22f,   0.3566314f, -0.2139787f, 0.9094103f,   0.f, 0.f,   55, 55, 0, 255 },
+	{ -0.43f, -0.06000006f, 0.22f,   0.3566314f, -0.2139787f, 0.9094103f,   0.f, 0.f,   55, 55, 0, 255 },
+	{ -0.55f, -0.09000003f, 0.26f,   0.3566314f, -0.2139787f, 0.9094103f,   0.f, 0.f,   55, 55, 0, 255 },
+	{ -0.65f, -0.36f, 0.23f,   0.002655806f, -0.05311617f, 0.9985848f,   0.f, 0.f,   14, 14, 0, 255 },
+	{ -0.61f, -0.17f, 0.24f,   0.002655806f, -0.05311617f, 0.9985848f,   0.f, 0.f,   14, 14, 0, 255 },
+	{ -0.81f, -0.18f, 0.24f,   0.002655806f, -0.05311617f, 0.9985848f,   0.f, 0.f,   14, 14, 0, 255 },
+	{ -0.8f, -0.34f, 0.22f,   -0.08304189f, -0.1287149f, 0.9881986f,   0.f, 0.f,   33, 33, 0, 255 },
+	{ -0.65f, -0.36f, 0.23f,   -0.08304189f, -0.1287149f, 0.9881986f,   0.f, 0.f,   33, 33, 0, 255 },
+	{ -0.81f, -0.18f, 0.24f,   -0.08304189f, -0.1287149f, 0.9881986f,   0.f, 0.f,   33, 33, 0, 255 },
+	{ -0.86f, -0.1f, 0.09000004f,   -0.4678885f, -0.4159001f, -0.7798125f,   0.f, 0.f,   106, 106, 0, 255 },
+	{ -0.88f, -0.19f, 0.1500001f,   -0.4678885f, -0.4159001f, -0.7798125f,   0.f, 0.f,   106, 106, 0, 255 },
+	{ -0.89f, -0.00999999f, 0.06000004f,   -0.4678885f, -0.4159001f, -0.7798125f,   0.f, 0.f,   106, 106, 0, 255 },
+	{ -0.86f, -0.1f, 0.09000004f,   -0.6953208f, -0.2852601f, -0.6596633f,   0.f, 0.f,   73, 73, 0, 255 },
+	{ -0.83f, -0.15f, 0.08000004f,   -0.6953208f, -0.2852601f, -0.6596633f,   0.f, 0.f,   73, 73, 0, 255 },
+	{ -0.88f, -0.19f, 0.1500001f,   -0.6953208f, -0.2852601f, -0.6596633f,   0.f, 0.f,   73, 73, 0, 255 },
+	{ -0.55f, -0.09000003f, 0.26f,   0.01256891f, -0.2513785f, 0.9678072f,   0.f, 0.f,   64, 64, 0, 255 },
+	{ -0.81f, -0.18f, 0.24f,   0.01256891f, -0.2513785f, 0.9678072f,   0.f, 0.f,   64, 64, 0, 255 },
+	{ -0.61f, -0.17f, 0.24f,   0.01256891f, -0.2513785f, 0.9678072f,   0.f, 0.f,   64, 64, 0, 255 },
+	{ -0.83f, -0.15f, 0.08000004f,   -0.7849736f, -0.09115823f, -0.6127858f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ -0.84f, -0.4f, 0.13f,   -0.7849736f, -0.09115823f, -0.6127858f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ -0.88f, -0.19f, 0.1500001f,   -0.7849736f, -0.09115823f, -0.6127858f,   0.f, 0.f,   23, 23, 0, 255 },
+	{ -0.48f, -0.21f, 0.15f,   0.8571428f, -0.4285715f, -0.2857144f,   0.f, 0.f,   109, 109, 0, 255 },
+	{ -0.53f, -0.31f, 0.15f,   0.8571428f, -0.4285715f, -0.2857144f,   0.f, 0.f,   109, 109, 0, 255 },
+	{ -0.52f, -0.25f, 0.09000003f,   0.8571428f, -0.4285715f, -0.2857144f,   0.f, 0.f,   109, 109, 0, 255 },
+	{ -0.88f, -0.19f, 0.1500001f,   -0.8300723f, -0.1059666f, -0.5474954f,   0.f, 0.f,   27, 27, 0, 255 },
+	{ -0.84f, -0.4f, 0.13f,   -0.8300723f, -0.1059666f, -0.5474954f,   0.f, 0.f,   27, 27, 0, 255 },
+	{ -0.87f, -0.3200001f, 0.16f,   -0.8300723f, -0.1059666f, -0.5474954f,   0.f, 0.f,   27, 27, 0, 255 },
+	{ 0.44f, -0.19f, 0.11f,   0.648643f, -0.7503908f, -0.1271847f,   0.f, 0.f,   191, 191, 0, 255 },
+	{ 0.39f, -0.24f, 0.15f,   0.648643f, -0.7503908f, -0.1271847f,   0.f, 0.f,   191, 191, 0, 255 },
+	{ 0.43f, -0.18f, -1.87959e-08f,   0.648643f, -0.7503908f, -0.1271847f,   0.f, 0.f,   191, 191, 0, 255 },
+	{ 0.22f, -0.29f, 0.11f,   -0.7071065f, -0.7071071f, -8.084815e-08f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ 0.21f, -0.28f, 0.16f,   -0.7071065f, -0.7071071f, -8.084815e-08f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ 0.2f, -0.27f, 0.06999999f,   -0.7071065f, -0.7071071f, -8.084815e-08f,   0.f, 0.f,   180, 180, 0, 255 },
+	{ 0.39f, -0.24f, 0.15f,   0.4250915f, -0.8737991f, -0.2361619f,   0.f, 0.f,   223, 223, 0, 255 },
+	{ 0.34f, -0.24f, 0.05999998f,   0.4250915f, -0.8737991f, -0.2361619f,   0.f, 0.f,   223, 223, 0, 255 },
+	{ 0.43f, -0.18f, -1.87959e-08f,   0.4250915f, -0.8737991f, -0.2361619f,   0.f, 0.f,   223, 223, 0, 255 },
+	{ 0.34f, -0.24f, 0.05999998f,   0.8700629f, 0.09667397f, -0.4833681f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ 0.39f, -0.24f, 0.15f,   0.8700629f, 0.09667397f, -0.4833681f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ 0.37f, -0.2600001f, 0.11f,   0.8700629f, 0.09667397f, -0.4833681f,   0.f, 0.f,   25, 25, 0, 255 },
+	{ -0.81f, -0.18f, 0.24f,   -0.4973209f, -0.1381447f, 0.8564975f,   0.f, 0.f,   35, 35, 0, 255 },
+	{ -0.86f, -0.31f, 0.19f,   -0.4973209f, -0.1381447f, 0.8564975f,   0.f, 0.f,   35, 35, 0, 255 },
+	{ -0.8f, -0.34f, 0.22f,   -0.4973209f, -0.1381447f, 0.8564975f,   0.f, 0.f,   35, 35, 0, 255 },
+	{ -0.86f, -0.31f, 0.19f,   -0.4776649f, -0.1492704f, 0.8657683f,   0.f, 0.f,   38, 38, 0, 255 },
+	{ -0.81f, -0.18f, 0.24f,   -0.4776649f, -0.1492704f, 0.8657683f,   0.f, 0.f,   38, 38, 0, 255 },
+	{ -0.82f, -0.09000003f, 0.25f,   -0.4776649f, -0.1492704f, 0.8657683f,   0.f, 0.f,   38, 38, 0, 255 },
+	{ -0.86f, -0.31f, 0.19f,   -0.6050537f, -0.1052267f, 0.7892005f,   0.f, 0.f,   27, 27, 0, 255 },
+	{ -0.82f, -0.09000003f, 0.25f,   -0.6050537f, -0.1052267f, 0.7892005f,   0.f, 0.f,   27, 27, 0, 255 },
+	{ -0.9f, -0.08000004f, 0.19f,   -0.6050537f, -0.1052267f, 0.7892005f,   0.f, 0.f,   27, 27, 0, 255 },
+	{ -0.86f, -0.31f, 0.19f,   -0.9849858f, -0.1713018f, -0.02141281f,   0.f, 0.f,   44, 44, 0, 255 },
+	{ -0.9f, -0.08000004f, 0.19f,   -0.9849858f, -0.1713018f, -0.02141281f,   0.f, 0.f,   44, 44, 0, 255 },
+	{ -0.88f, -0.19f, 0.1500001f,   -0.9849858f, -0.1713018f, -0.02141281f,   0.f, 0.f,   44, 44, 0, 255 },
+	{ 0.25f, -0.29f, 0.09f,   -0.09515432f, -0.3806168f, -0.9198241f,   0.f, 0.f,   97, 97, 0, 255 },
+	{ 0.34f, -0.24f, 0.05999998f,   -0.09515432f, -0.3806168f, -0.9198241f,   0.f, 0.f,   97, 97, 0, 255 },
+	{ 0.29f, -0.3f, 0.08999999f,   -0.09515432f, -0.3806168f, -0.9198241f,   0.f, 0.f,   97, 97, 0, 255 },
+	{ 0.2f, -0.27f, 0.06999999f,   -0.2279209f, -0.9116847f, -0.3418815f,   0.f, 0.f,   232, 232, 0, 255 },
+	{ 0.25f, -0.29f, 0.09f,   -0.2279209f, -0.9116847f, -0.3418815f,   0.f, 0.f,   232, 232, 0, 255 },
+	{ 0.22f, -0.29f, 0.11f,   -0.2279209f, -0.9116847f, -0.3418815f,   0.f, 0.f,   232, 232, 0, 255 },
+	{ 0.29f, -0.3f, 0.08999999f,   0.478471f, -0.6778343f, -0.5582169f,   0.f, 0.f,   173, 173, 0, 255 },
+	{ 0.34f, -0.24f, 0.05999998f,   0.478471f, -0.6778343f, -0.5582169f,   0.f, 0.f,   173, 173, 0, 255 },
+	{ 0.37f, -0.2600001f, 0.11f,   0.478471f, -0.6778343f, -0.5582169f,   0.f, 0.f,   173, 173, 0, 255 },
+	{ -0.88f, -0.19f, 0.1500001f,   -0.9428092f, -0.04714041f, 0.329983f,   0.f, 0.f,   12, 12, 0, 255 },
+	{ -0.87f, -0.3200001f, 0.16f,   -0.9428092f, -0.04714041f, 0.329983f,   0.f, 0.f,   12, 12, 0, 255 },
+	{ -0.86f, -0.31f, 0.19f,   -0.9428092f, -0.04714041f, 0.329983f,   0.f, 0.f,   12, 12, 0, 255 },
+	{ 0.9f, 0.55f, -0.11f,   -0.f, 0.f, -1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.89f, 0.53f, -0.11f,   -0.f, 0.f, -1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.86f, 0.55f, -0.11f,   -0.f, 0.f, -1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.89f, 0.53f, 0.11f,   0.f, -0.f, 1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.9f, 0.55f, 0.11f,   0.f, -0.f, 1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.86f, 0.55f, 0.11f,   0.f, -0.f, 1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.87f, 0.53f, -0.1f,   -0.3713908f, -0.5570862f, -0.7427811f,   0.f, 0.f,   142, 142, 0, 255 },
+	{ 0.86f, 0.55f, -0.11f,   -0.3713908f, -0.5570862f, -0.7427811f,   0.f, 0.f,   142, 142, 0, 255 },
+	{ 0.89f, 0.53f, -0.11f,   -0.3713908f, -0.5570862f, -0.7427811f,   0.f, 0.f,   142, 142, 0, 255 },
+	{ 0.89f, 0.53f, -0.11f,   0.8164967f, -0.4082484f, -0.408248f,   0.f, 0.f,   104, 104, 0, 255 },
+	{ 0.9f, 0.55f, -0.11f,   0.8164967f, -0.4082484f, -0.408248f,   0.f, 0.f,   104, 104, 0, 255 },
+	{ 0.9f, 0.52f, -0.08000004f,   0.8164967f, -0.4082484f, -0.408248f,   0.f, 0.f,   104, 104, 0, 255 },
+	{ 0.9f, 0.52f, -0.08000004f,   0.9045332f, -0.3015129f, -0.3015126f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ 0.9f, 0.55f, -0.11f,   0.9045332f, -0.3015129f, -0.3015126f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ 0.91f, 0.55f, -0.08000004f,   0.9045332f, -0.3015129f, -0.3015126f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ 0.9f, 0.52f, -0.08000004f,   -0.1360828f, -0.9525794f, -0.2721653f,   0.f, 0.f,   243, 243, 0, 255 },
+	{ 0.87f, 0.53f, -0.1f,   -0.1360828f, -0.9525794f, -0.2721653f,   0.f, 0.f,   243, 243, 0, 255 },
+	{ 0.89f, 0.53f, -0.11f,   -0.1360828f, -0.9525794f, -0.2721653f,   0.f, 0.f,   243, 243, 0, 255 },
+	{ 0.9f, 0.5699999f, -0.09000004f,   0.4264015f, 0.6396024f, -0.6396018f,   0.f, 0.f,   163, 163, 0, 255 },
+	{ 0.9f, 0.55f, -0.11f,   0.4264015f, 0.6396024f, -0.6396018f,   0.f, 0.f,   163, 163, 0, 255 },
+	{ 0.87f, 0.5699999f, -0.11f,   0.4264015f, 0.6396024f, -0.6396018f,   0.f, 0.f,   163, 163, 0, 255 },
+	{ 0.91f, 0.55f, -0.08000004f,   0.9045331f, 0.3015128f, -0.3015125f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ 0.9f, 0.55f, -0.11f,   0.9045331f, 0.3015128f, -0.3015125f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ 0.9f, 0.5699999f, -0.09000004f,   0.9045331f, 0.3015128f, -0.3015125f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ 0.9f, 0.55f, 0.11f,   0.4264015f, 0.6396024f, 0.6396018f,   0.f, 0.f,   163, 163, 0, 255 },
+	{ 0.9f, 0.5699999f, 0.08999997f,   0.4264015f, 0.6396024f, 0.6396018f,   0.f, 0.f,   163, 163, 0, 255 },
+	{ 0.87f, 0.5699999f, 0.11f,   0.4264015f, 0.6396024f, 0.6396018f,   0.f, 0.f,   163, 163, 0, 255 },
+	{ 0.9f, 0.55f, 0.11f,   0.9045332f, 0.3015128f, 0.3015126f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ 0.91f, 0.55f, 0.07999996f,   0.9045332f, 0.3015128f, 0.3015126f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ 0.9f, 0.5699999f, 0.08999997f,   0.9045332f, 0.3015128f, 0.3015126f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ 0.9f, 0.55f, 0.11f,   0.8164967f, -0.4082484f, 0.408248f,   0.f, 0.f,   104, 104, 0, 255 },
+	{ 0.89f, 0.53f, 0.11f,   0.8164967f, -0.4082484f, 0.408248f,   0.f, 0.f,   104, 104, 0, 255 },
+	{ 0.9f, 0.52f, 0.07999996f,   0.8164967f, -0.4082484f, 0.408248f,   0.f, 0.f,   104, 104, 0, 255 },
+	{ 0.9f, 0.55f, 0.11f,   0.9045332f, -0.3015129f, 0.3015126f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ 0.9f, 0.52f, 0.07999996f,   0.9045332f, -0.3015129f, 0.3015126f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ 0.91f, 0.55f, 0.07999996f,   0.9045332f, -0.3015129f, 0.3015126f,   0.f, 0.f,   77, 77, 0, 255 },
+	{ 0.86f, 0.55f, 0.11f,   -0.3713908f, -0.5570862f, 0.7427811f,   0.f, 0.f,   142, 142, 0, 255 },
+	{ 0.87f, 0.53f, 0.09999996f,   -0.3713908f, -0.5570862f, 0.7427811f,   0.f, 0.f,   142, 142, 0, 255 },
+	{ 0.89f, 0.53f, 0.11f,   -0.3713908f, -0.5570862f, 0.7427811f,   0.f, 0.f,   142, 142, 0, 255 },
+	{ 0.9f, 0.55f, 0.11f,   0.f, 0.f, 1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.87f, 0.5699999f, 0.11f,   0.f, 0.f, 1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.86f, 0.55f, 0.11f,   0.f, 0.f, 1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.87f, 0.5699999f, -0.11f,   0.f, -0.f, -1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.9f, 0.55f, -0.11f,   0.f, -0.f, -1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.86f, 0.55f, -0.11f,   0.f, -0.f, -1.f,   0.f, 0.f,   0, 0, 0, 255 },
+	{ 0.87f, 0.53f, 0.09999996f,   -0.1360827f, -0.9525794f, 0.2721653f,   0.f, 0.f,   243, 243, 0, 255 },
+	{ 0.9f, 0.52f, 0.07999996f,   -0.1360827f, -0.9525794f, 0.2721653f,   0.f, 0.f,   243, 243, 0, 255 },
+	{ 0.89f, 0.53f, 0.11f,   -0.1360827f, -0.9525794f, 0.2721653f,   0.f, 0.f,   243, 243, 0, 255 },
+};
+
+const GLushort HorseIndices[ ] = {
+	    0,     1,     2,
+	    3,     4,     5,
+	    6,     7,     8,
+	    9,    10,    11,
+	   12,    13,    14,
+	   15,    16,    17,
+	   18,    19,    20,
+	   21,    22,    23,
+	   24,    25,    26,
+	   27,    28,    29,
+	   30,    31,    32,
+	   33,    34,    35,
+	   36,    37,    38,
+	   39,    40,    41,
+	   42,    43,    44,
+	   45,    46,    47,
+	   48,    49,    50,
+	   51,    52,    53,
+	   54,    55,    56,
+	   57,    58,    59,
+	   60,    61,    62,
+	   63,    64,    65,
+	   66,    67,    68,
+	   69,    70,    71,
+	   72,    73,    74,
+	   75,    76,    77,
+	   78,    79,    80,
+	   81,    82,    83,
+	   84,    85,    86,
+	   87,    88,    89,
+	   90,    91,    92,
+	   93,    94,    95,
+	   96,    97,    98,
+	   99,   100,   101,
+	  102,   103,   104,
+	  105,   106,   107,
+	  108,   109,   110,
+	  111,   112,   113,
+	  114,   115,   116,
+	  117,   118,   119,
+	  120,   121,   122,
+	  123,   124,   125,
+	  126,   127,   128,
+	  129,   130,   131,
+	  132,   133,   134,
+	  135,   136,   137,
+	  138,   139,   140,
+	  141,   142,   143,
+	  144,   145,   146,
+	  147,   148,   149,
+	  150,   151,   152,
+	  153,   154,   155,
+	  156,   157,   158,
+	  159,   160,   161,
+	  162,   163,   164,
+	  165,   166,   167,
+	  168,   169,   170,
+	  171,   172,   173,
+	  174,   175,   176,
+	  177,   178,   179,
+	  180,   181,   182,
+	  183,   184,   185,
+	  186,   187,   188,
+	  189,   190,   191,
+	  192,   193,   194,
+	  195,   196,   197,
+	  198,   199,   200,
+	  201,   202,   203,
+	  204,   205,   206,
+	  207,   208,   209,
+	  210,   211,   212,
+	  213,   214,   215,
+	  216,   217,   218,
+	  219,   220,   221,
+	  222,   223,   224,
+	  225,   226,   227,
+	  228,   229,   230,
+	  231,   232,   233,
+	  234,   235,   236,
+	  237,   238,   239,
+	  240,   241,   242,
+	  243,   244,   245,
+	  246,   247,   248,
+	  249,   250,   251,
+	  252,   253,   254,
+	  255,   256,   257,
+	  258,   259,   260,
+	  261,   262,   263,
+	  264,   265,   266,
+	  267,   268,   269,
+	  270,   271,   272,
+	  273,   274,   275,
+	  276,   277,   278,
+	  279,   280,   281,
+	  282,   283,   284,
+	  285,   286,   287,
+	  288,   289,   290,
+	  291,   292,   293,
+	  294,   295,   296,
+	  297,   298,   299,
+	  300,   301,   302,
+	  303,   304,   305,
+	  306,   307,   308,
+	  309,   310,   311,
+	  312,   313,   314,
+	  315,   316,   317,
+	  318,   319,   320,
+	  321,   322,   323,
+	  324,   325,   326,
+	  327,   328,   329,
+	  330,   331,   332,
+	  333,   334,   335,
+	  336,   337,   338,
+	  339,   340,   341,
+	  342,   343,   344,
+	  345,   346,   347,
+	  348,   349,   350,
+	  351,   352,   353,
+	  354,   355,   356,
+	  357,   358,   359,
+	  360,   361,   362,
+	  363,   364,   365,
+	  366,   367,   368,
+	  369,   370,   371,
+	  372,   373,   374,
+	  375,   376,   377,
+	  378,   379,   380,
+	  381,   382,   383,
+	  384,   385,   386,
+	  387,   388,   389,
+	  390,   391,   392,
+	  393,   394,   395,
+	  396,   397,   398,
+	  399,   400,   401,
+	  402,   403,   404,
+	  405,   406,   407,
+	  408,   409,   410,
+	  411,   412,   413,
+	  414,   415,   416,
+	  417,   418,   419,
+	  420,   421,   422,
+	  423,   424,   425,
+	  426,   427,   428,
+	  429,   430,   431,
+	  432,   433,   434,
+	  435,   436,   437,
+	  438,   439,   440,
+	  441,   442,   443,
+	  444,   445,   446,
+	  447,   448,   449,
+	  450,   451,   452,
+	  453,   454,   455,
+	  456,   457,   458,
+	  459,   460,   461,
+	  462,   463,   464,
+	  465,   466,   467,
+	  468,   469,   470,
+	  471,   472,   473,
+	  474,   475,   476,
+	  477,   478,   479,
+	  480,   481,   482,
+	  483,   484,   485,
+	  486,   487,   488,
+	  489,   490,   491,
+	  492,   493,   494,
+	  495,   496,   497,
+	  498,   499,   500,
+	  501,   502,   503,
+	  504,   505,   506,
+	  507,   508,   509,
+	  510,   511,   512,
+	  511,   513,   512,
+	  514,   515,   516,
+	  517,   518,   519,
+	  520,   521,   522,
+	  523,   524,   525,
+	  526,   527,   528,
+	  529,   530,   531,
+	  532,   533,   534,
+	  535,   536,   537,
+	  538,   539,   540,
+	  541,   542,   543,
+	  544,   545,   546,
+	  547,   548,   549,
+	  550,   551,   552,
+	  553,   554,   555,
+	  556,   557,   558,
+	  559,   560,   561,
+	  562,   563,   564,
+	  565,   566,   567,
+	  568,   569,   570,
+	  571,   572,   573,
+	  574,   575,   576,
+	  577,   578,   579,
+	  580,   581,   582,
+	  583,   584,   585,
+	  586,   587,   588,
+	  589,   582,   581,
+	  590,   591,   592,
+	  593,   594,   595,
+	  596,   597,   598,
+	  599,   600,   601,
+	  602,   603,   604,
+	  605,   606,   607,
+	  608,   609,   610,
+	  611,   612,   613,
+	  614,   615,   616,
+	  617,   618,   619,
+	  620,   621,   622,
+	  623,   624,   625,
+	  626,   627,   628,
+	  629,   630,   631,
+	  632,   633,   634,
+	  635,   636,   637,
+	  638,   639,   640,
+	  641,   642,   643,
+	  644,   645,   646,
+	  647,   648,   649,
+	  650,   651,   652,
+	  653,   654,   655,
+	  656,   657,   658,
+	  659,   660,   661,
+	  662,   663,   664,
+	  665,   666,   667,
+	  668,   669,   670,
+	  671,   672,   673,
+	  674,   675,   676,
+	  677,   678,   679,
+	  680,   681,   682,
+	  683,   684,   685,
+	  686,   687,   688,
+	  689,   690,   691,
+	  692,   693,   694,
+	  695,   696,   697,
+	  698,   699,   700,
+	  701,   702,   703,
+	  704,   705,   706,
+	  707,   708,   709,
+	  710,   711,   712,
+	  713,   714,   715,
+	  716,   717,   718,
+	  719,   720,   721,
+	  722,   723,   724,
+	  725,   726,   727,
+	  728,   729,   730,
+	  731,   732,   733,
+	  734,   735,   736,
+	  737,   738,   739,
+	  740,   741,   742,
+	  743,   744,   745,
+	  746,   747,   748,
+	  749,   750,   751,
+	  752,   753,   754,
+	  755,   756,   757,
+	  758,   759,   760,
+	  761,   762,   763,
+	  764,   765,   766,
+	  767,   768,   769,
+	  770,   771,   772,
+	  773,   774,   775,
+	  776,   777,   778,
+	  779,   780,   781,
+	  782,   783,   784,
+	  785,   786,   787,
+	  788,   789,   790,
+	  791,   792,   793,
+	  794,   795,   796,
+	  797,   798,   799,
+	  800,   801,   802,
+	  803,   804,   805,
+	  806,   807,   808,
+	  809,   810,   811,
+	  812,   813,   814,
+	  815,   816,   817,
+	  818,   819,   820,
+	  821,   822,   823,
+	  824,   825,   826,
+	  827,   828,   829,
+	  830,   831,   832,
+	  833,   834,   835,
+	  836,   837,   838,
+	  839,   840,   841,
+	  842,   843,   844,
+	  845,   846,   847,
+	  848,   849,   850,
+	  851,   852,   853,
+	  854,   855,   856,
+	  857,   858,   859,
+	  860,   861,   862,
+	  863,   864,   865,
+	  866,   867,   868,
+	  869,   870,   871,
+	  872,   873,   874,
+	  875,   876,   877,
+	  878,   879,   880,
+	  881,   882,   883,
+	  884,   885,   886,
+	  887,   888,   889,
+	  890,   891,   892,
+	  893,   894,   895,
+	  896,   897,   898,
+	  899,   900,   901,
+	  902,   903,   904,
+	  905,   906,   907,
+	  908,   909,   910,
+	  911,   912,   913,
+	  914,   915,   916,
+	  917,   918,   919,
+	  920,   921,   922,
+	  923,   924,   925,
+	  926,   927,   928,
+	  929,   930,   931,
+	  932,   933,   934,
+	  935,   936,   937,
+	  938,   939,   940,
+	  941,   942,   943,
+	  944,   945,   946,
+	  947,   948,   949,
+	  950,   951,   952,
+	  953,   954,   955,
+	  956,   957,   958,
+	  959,   960,   961,
+	  962,   963,   964,
+	  965,   966,   967,
+	  968,   969,   970,
+	  971,   972,   973,
+	  974,   975,   976,
+	  977,   978,   979,
+	  980,   981,   982,
+	  983,   984,   985,
+	  986,   987,   988,
+	  989,   990,   991,
+	  992,   993,   994,
+	  995,   996,   997,
+	  998,   999,  1000,
+	 1001,  1002,  1003,
+	 1004,  1005,  1006,
+	 1007,  1008,  1009,
+	 1010,  1011,  1012,
+	 1013,  1014,  1015,
+	 1016,  1017,  1018,
+	 1019,  1020,  1021,
+	 1022,  1023,  1024,
+	 1025,  1026,  1027,
+	 1028,  1029,  1030,
+	 1031,  1032,  1033,
+	 1034,  1035,  1036,
+	 1037,  1038,  1039,
+	 1040,  1041,  1042,
+	 1043,  1044,  1045,
+	 1046,  1047,  1048,
+	 1049,  1050,  1051,
+	 1052,  1053,  1054,
+	 1055,  1056,  1057,
+	 1058,  1059,  1060,
+	 1061,  1062,  1063,
+	 1064,  1065,  1066,
+	 1067,  1068,  1069,
+	 1070,  1071,  1072,
+	 1073,  1074,  1075,
+	 1076,  1077,  1078,
+	 1079,  1080,  1081,
+	 1082,  1083,  1084,
+	 1085,  1086,  1087,
+	 1088,  1089,  1090,
+	 1091,  1092,  1093,
+	 1094,  1095,  1096,
+	 1097,  1098,  1099,
+	 1100,  1101,  1102,
+	 1103,  1104,  1105,
+	 1106,  1107,  1108,
+	 1109,  1110,  1111,
+	 1112,  1113,  1114,
+	 1115,  1116,  1117,
+	 1118,  1119,  1120,
+	 1121,  1122,  1123,
+	 1124,  1125,  1126,
+	 1127,  1128,  1129,
+	 1130,  1131,  1132,
+	 1133,  1134,  1135,
+	 1136,  1137,  1138,
+	 1139,  1140,  1141,
+	 1142,  1143,  1144,
+	 1145,  1146,  1147,
+	 1148,  1149,  1150,
+	 1151,  1152,  1153,
+	 1154,  1155,  1156,
+	 1157,  1158,  1159,
+	 1160,  1161,  1162,
+	 1163,  1164,  1165,
+	 1166,  1167,  1168,
+	 1169,  1170,  1171,
+	 1172,  1173,  1174,
+	 1175,  1176,  1177,
+	 1178,  1179,  1180,
+	 1181,  1182,  1183,
+	 1184,  1185,  1186,
+	 1187,  1188,  1189,
+	 1190,  1191,  1192,
+	 1193,  1194,  1195,
+	 1196,  1197,  1198,
+	 1199,  1200,  1201,
+	 1202,  1203,  1204,
+	 1205,  1206,  1207,
+	 1208,  1209,  1210,
+	 1211,  1212,  1213,
+	 1214,  1215,  1216,
+	 1217,  1218,  1219,
+	 1220,  1221,  1222,
+	 1223,  1224,  1225,
+	 1226,  1227,  1228,
+	 1229,  1230,  1231,
+	 1232,  1233,  1234,
+	 1235,  1236,  1237,
+	 1238,  1239,  1240,
+	 1241,  1242,  1243,
+	 1244,  1245,  1246,
+	 1247,  1248,  1249,
+	 1250,  1251,  1252,
+	 1253,  1254,  1255,
+	 1256,  1257,  1258,
+	 1259,  1260,  1261,
+	 1262,  1263,  1264,
+	 1265,  1266,  1267,
+	 1268,  1269,  1270,
+	 1271,  1272,  1273,
+	 1274,  1275,  1276,
+	 1277,  1278,  1279,
+	 1280,  1281,  1282,
+	 1283,  1284,  1285,
+	 1286,  1287,  1288,
+	 1289,  1290,  1291,
+	 1292,  1293,  1294,
+	 1295,  1296,  1297,
+	 1298,  1299,  1300,
+	 1301,  1302,  1303,
+	 1304,  1305,  1306,
+	 1307,  1308,  1309,
+	 1310,  1311,  1312,
+	 1313,  1314,  1315,
+	 1316,  1317,  1318,
+	 1319,  1320,  1321,
+	 1322,  1323,  1324,
+	 1325,  1326,  1327,
+	 1328,  1329,  1330,
+	 1331,  1332,  1333,
+	 1334,  1335,  1336,
+	 1337,  1338,  1339,
+	 1340,  1341,  1342,
+	 1343,  1344,  1345,
+	 1346,  1347,  1348,
+	 1349,  1350,  1351,
+	 1352,  1353,  1354,
+	 1355,  1356,  1357,
+	 1358,  1359,  1360,
+	 1361,  1362,  1363,
+	 1364,  1365,  1366,
+	 1367,  1368,  1369,
+	 1370,  1371,  1372,
+	 1373,  1374,  1375,
+	 1376,  1377,  1378,
+	 1379,  1380,  1381,
+	 1382,  1383,  1384,
+	 1385,  1386,  1387,
+	 1388,  1389,  1390,
+	 1391,  1392,  1393,
+	 1394,  1395,  1396,
+	 1397,  1398,  1399,
+	 1400,  1401,  1402,
+	 1403,  1404,  1405,
+	 1406,  1407,  1408,
+	 1409,  1410,  1411,
+	 1412,  1413,  1414,
+	 1415,  1416,  1417,
+	 1418,  1419,  1420,
+	 1421,  1422,  1423,
+	 1424,  1425,  1426,
+	 1427,  1428,  1429,
+	 1430,  1431,  1432,
+	 1433,  1434,  1435,
+	 1436,  1437,  1438,
+	 1439,  1440,  1441,
+	 1442,  1443,  1444,
+	 1445,  1446,  1447,
+	 1448,  1449,  1450,
+	 1451,  1452,  1453,
+	 1454,  1455,  1456,
+	 1457,  1458,  1459,
+	 1460,  1461,  1462,
+	 1463,  1464,  1465,
+	 1466,  1467,  1468,
+	 1469,  1470,  1471,
+	 1472,  1473,  1474,
+	 1475,  1476,  1477,
+	 1478,  1479,  1480,
+	 1481,  1482,  1483,
+	 1484,  1485,  1486,
+	 1487,  1488,  1489,
+	 1490,  1491,  1492,
+	 1493,  1494,  1495,
+	 1496,  1497,  1498,
+	 1499,  1500,  1501,
+	 1502,  1503,  1504,
+	 1505,  1506,  1507,
+	 1508,  1509,  1510,
+	 1511,  1512,  1513,
+	 1514,  1515,  1516,
+	 1517,  1518,  1519,
+	 1520,  1521,  1522,
+	 1523,  1524,  1525,
+	 1526,  1527,  1528,
+	 1529,  1530,  1531,
+	 1532,  1533,  1534,
+	 1535,  1536,  1537,
+	 1538,  1539,  1540,
+	 1541,  1542,  1543,
+	 1544,  1545,  1546,
+	 1547,  1548,  1549,
+	 1550,  1551,  1552,
+	 1553,  1554,  1555,
+	 1556,  1557,  1558,
+	 1559,  1560,  1561,
+	 1562,  1563,  1564,
+	 1565,  1566,  1567,
+	 1568,  1569,  1570,
+	 1571,  1572,  1573,
+	 1574,  1575,  1576,
+	 1577,  1578,  1579,
+	 1580,  1581,  1582,
+	 1583,  1584,  1585,
+	 1586,  1587,  1588,
+	 1589,  1590,  1591,
+	 1592,  1593,  1594,
+	 1595,  1596,  1597,
+	 1598,  1599,  1600,
+	 1601,  1602,  1603,
+	 1604,  1605,  1606,
+	 1607,  1608,  1609,
+	 1610,  1611,  1612,
+	 1613,  1614,  1615,
+	 1616,  1617,  1618,
+	 1619,  1620,  1621,
+	 1622,  1623,  1624,
+	 1625,  1626,  1627,
+	 1628,  1629,  1630,
+	 1631,  1632,  1633,
+	 1634,  1635,  1636,
+	 1637,  1638,  1639,
+	 1640,  1641,  1642,
+	 1643,  1644,  1645,
+	 1646,  1647,  1648,
+	 1649,  1650,  1651,
+	 1652,  1653,  1654,
+	 1655,  1656,  1657,
+	 1658,  1659,  1660,
+	 1661,  1662,  1663,
+	 1664,  1665,  1666,
+	 1667,  1668,  1669,
+	 1670,  1671,  1672,
+	 1673,  1674,  1675,
+	 1676,  1677,  1678,
+	 1679,  1680,  1681,
+	 1682,  1683,  1684,
+	 1685,  1686,  1687,
+	 1688,  1689,  1690,
+	 1691,  1692,  1693,
+	 1694,  1695,  1696,
+	 1697,  1698,  1699,
+	 1700,  1701,  1702,
+	 1703,  1704,  1705,
+	 1706,  1707,  1708,
+	 1709,  1710,  1711,
+	 1712,  1713,  1714,
+	 1715,  1716,  1717,
+	 1718,  1719,  1720,
+	 1721,  1722,  1723,
+	 1724,  1725,  1726,
+	 1727,  1728,  1729,
+	 1730,  1731,  1732,
+	 1733,  1734,  1735,
+	 1736,  1737,  1738,
+	 1739,  1740,  1741,
+	 1742,  1743,  1744,
+	  213,  1745,   214,
+	 1746,  1747,  1748,
+	 1749,  1750,  1751,
+	 1752,  1753,  1754,
+	 1755,  1756,  1757,
+	 1758,  1759,  1760,
+	 1761,  1762,  1763,
+	 1764,  1765,  1766,
+	 1767,  1768,  1769,
+	 1770,  1771,  1772,
+	 1773,  1774,  1775,
+	 1776,  1777,  1778,
+	 1779,  1780,  1781,
+	 1782,  1783,  1784,
+	 1785,  1786,  1787,
+	 1788,  1789,  1790,
+	 1791,  1792,  1793,
+	 1794,  1795,  1796,
+	 1797,  1798,  1799,
+	 1800,  1801,  1802,
+	 1803,  1804,  1805,
+	 1806,  1807,  1808,
+	 1809,  1810,  1811,
+	 1812,  1813,  1814,
+	 1815,  1816,  1817,
+	 1818,  1819,  1820,
+	 1821,  1822,  1823,
+	 1824,  1825,  1826,
+	 1827,  1828,  1829,
+	 1830,  1831,  1832,
+	 1833,  1834,  1835,
+	 1836,  1837,  1838,
+	 1839,  1840,  1841,
+	 1842,  1843,  1844,
+	 1845,  1846,  1847,
+	 1848,  1849,  1850,
+	 1851,  1852,  1853,
+	 1854,  1855,  1856,
+	 1857,  1858,  1859,
+	 1860,  1861,  1862,
+	 1863,  1864,  1865,
+	 1866,  1867,  1868,
+	 1869,  1870,  1871,
+	 1872,  1873,  1874,
+	 1875,  1876,  1877,
+	 1878,  1879,  1880,
+	 1881,  1882,  1883,
+	 1884,  1885,  1886,
+	 1887,  1888,  1889,
+	 1890,  1891,  1892,
+	 1893,  1894,  1895,
+	 1896,  1897,  1898,
+	 1899,  1900,  1901,
+	 1902,  1903,  1904,
+	 1905,  1906,  1907,
+	 1908,  1909,  1910,
+	 1911,  1912,  1913,
+	 1914,  1915,  1916,
+	 1917,  1918,  1919,
+	 1920,  1921,  1922,
+	 1923,  1924,  1925,
+	 1926,  1927,  1928,
+	 1929,  1930,  1931,
+	 1932,  1933,  1934,
+	 1935,  1936,  1937,
+	 1938,  1939,  1940,
+	 1941,  1942,  1943,
+	 1944,  1945,  1946,
+	 1947,  1948,  1949,
+	 1950,  1951,  1952,
+	 1953,  1954,  1955,
+	 1956,  1957,  1958,
+	 1959,  1960,  1961,
+	 1962,  1963,  1964,
+	 1965,  1966,  1967,
+	 1968,  1969,  1970,
+	 1971,  1972,  1973,
+	 1974,  1975,  1976,
+	 1977,  1978,  1979,
+	 1980,  1981,  1982,
+	 1983,  1984,  1985,
+	 1986,  1987,  1988,
+	 1989,  1990,  1991,
+	 1992,  1993,  1994,
+	 1995,  1996,  1997,
+	 1998,  1999,  2000,
+	 2001,  2002,  2003,
+	 2004,  2005,  2006,
+	 2007,  2008,  2009,
+	 2010,  2011,  2012,
+	 2013,  2014,  2015,
+	 2014,  2016,  2015,
+	 2017,  2018,  2019,
+	 2020,  2021,  2022,
+	 2023,  2024,  2025,
+	 2026,  2027,  2028,
+	 2029,  2030,  2031,
+	 2032,  2033,  2034,
+	 2035,  2036,  2037,
+	 2038,  2039,  2040,
+	 2041,  2042,  2043,
+	 2044,  2045,  2046,
+	 1855,  1854,  2047,
+	 2048,  2049,  2050,
+	 2051,  2052,  2053,
+	 2054,  2055,  2056,
+	 2057,  2058,  2059,
+	 2060,  2061,  2062,
+	 2063,  2064,  2065,
+	 2066,  2067,  2068,
+	 2069,  2070,  2071,
+	 2072,  2073,  2074,
+	 2075,  2076,  2077,
+	 2078,  2079,  2080,
+	 2081,  2082,  2083,
+	 2084,  2085,  2086,
+	 2087,  2088,  2089,
+	 2090,  2091,  2092,
+	 2093,  2094,  2095,
+	 2096,  2097,  2098,
+	 2099,  2100,  2101,
+	 2102,  2103,  2104,
+	 2105,  2106,  2107,
+	 2108,  2109,  2110,
+	 2111,  2112,  2113,
+	 2114,  2115,  2116,
+	 2117,  2118,  2119,
+	 2120,  2121,  2122,
+	 2123,  2124,  2125,
+	 2126,  2127,  2128,
+	 2129,  2130,  2131,
+	 2132,  2133,  2134,
+	 2135,  2136,  2137,
+	 2138,  2139,  2140,
+	 2141,  2142,  2143,
+	 2144,  2145,  2146,
+	 2147,  2148,  2149,
+	 2150,  2151,  2152,
+	 2153,  2154,  2155,
+	 2156,  2157,  2158,
+	 2159,  2160,  2161,
+	 2162,  2163,  2164,
+	 2165,  2166,  2167,
+	 2168,  2169,  2170,
+	 2171,  2172,  2173,
+	 2174,  2175,  2176,
+	 2177,  2178,  2179,
+	 2180,  2181,  2182,
+	 2183,  2184,  2185,
+	 2186,  2187,  2188,
+	 2189,  2190,  2191,
+	 2192,  2193,  2194,
+	 2195,  2196,  2197,
+	 2198,  2199,  2200,
+	 2201,  2202,  2203,
+	 2204,  2205,  2206,
+	 2207,  2208,  2209,
+	 2210,  2211,  2212,
+	 2213,  2214,  2215,
+	 2216,  2217,  2218,
+	 2219,  2220,  2221,
+	 2222,  2223,  2224,
+	 2225,  2226,  2227,
+	 2228,  2229,  2230,
+	 2231,  2232,  2233,
+	 2234,  2235,  2236,
+	 2237,  2238,  2239,
+	 2240,  2241,  2242,
+	 2243,  2244,  2245,
+	 2246,  2247,  2248,
+	 2249,  2250,  2251,
+	 2252,  2253,  2254,
+	 2255,  2256,  2257,
+	 2258,  2259,  2260,
+	 2261,  2262,  2263,
+	 2264,  2265,  2266,
+	 2267,  2268,  2269,
+	 2270,  2271,  2272,
+	 2273,  2274,  2275,
+	 2276,  2277,  2278,
+	 2279,  2280,  2281,
+	 2282,  2283,  2284,
+	 2285,  2286,  2287,
+	 2288,  2289,  2290,
+	 2291,  2292,  2293,
+	 2294,  2295,  2296,
+	 2297,  2298,  2299,
+	 2300,  2301,  2302,
+	 2303,  2304,  2305,
+	 2306,  2307,  2308,
+	 2309,  2310,  2311,
+	 2312,  2313,  2314,
+	 2315,  2316,  2317,
+	 2318,  2319,  2320,
+	 2321,  2322,  2323,
+	 2324,  2325,  2326,
+	 2327,  2328,  2329,
+	 2330,  2331,  2332,
+	 2333,  2334,  2335,
+	 2336,  2337,  2338,
+	 2339,  2340,  2341,
+	 2342,  2343,  2344,
+	 2345,  2346,  2347,
+	 2348,  2349,  2350,
+	 2351,  2352,  2353,
+	 2354,  2355,  2356,
+	 2357,  2358,  2359,
+	 2360,  2361,  2362,
+	 2363,  2364,  2365,
+	 2366,  2367,  2368,
+	 2369,  2370,  2371,
+	 2372,  2373,  2374,
+	 2375,  2376,  2377,
+	 2378,  2379,  2380,
+	 2381,  2382,  2383,
+	 2384,  2385,  2386,
+	 2387,  2388,  2389,
+	 2390,  2391,  2392,
+	 2393,  2394,  2395,
+	 2396,  2397,  2398,
+	 2399,  2400,  2401,
+	 2402,  2403,  2404,
+	 2405,  2406,  2407,
+	 2408,  2409,  2410,
+	 2411,  2412,  2413,
+	 2414,  2415,  2416,
+	 2417,  2418,  2419,
+	 2420,  2421,  2422,
+	 2423,  2424,  2425,
+	 2426,  2427,  2428,
+	 2429,  2430,  2431,
+	 2432,  2433,  2434,
+	 2435,  2436,  2437,
+	 2438,  2439,  2440,
+	 2441,  2442,  2443,
+	 2444,  2445,  2446,
+	 2447,  2448,  2449,
+	 2450,  2451,  2452,
+	 2453,  2454,  2455,
+	 2456,  2457,  2458,
+	 2459,  2460,  2461,
+	 2462,  2463,  2464,
+	 2465,  2466,  2467,
+	 2468,  2469,  2470,
+	 2471,  2472,  2473,
+	 2474,  2475,  2476,
+	 2477,  2478,  2479,
+	 2480,  2481,  2482,
+	 2483,  2484,  2485,
+	 2486,  2487,  2488,
+	 2489,  2490,  2491,
+	 2492,  2493,  2494,
+	 2495,  2496,  2497,
+	 2498,  2499,  2500,
+	 2501,  2502,  2503,
+	 2504,  2505,  2506,
+	 2507,  2508,  2509,
+	 2510,  2511,  2512,
+	 2513,  2514,  2515,
+	 2516,  2517,  2518,
+	 2519,  2520,  2521,
+	 2522,  2523,  2524,
+	 2525,  2526,  2527,
+	 2528,  2529,  2530,
+	 2531,  2532,  2533,
+	 2534,  2535,  2536,
+	 2537,  2538,  2539,
+	 2540,  2541,  2542,
+	 2543,  2544,  2545,
+	 2546,  2547,  2548,
+	 2549,  2550,  2551,
+	 2552,  2553,  2554,
+	 2555,  2556,  2557,
+	 2558,  2559,  2560,
+	 2561,  2562,  2563,
+	 2564,  2565,  2566,
+	 2567,  2568,  2569,
+	 2570,  2571,  2572,
+	 2573,  2574,  2575,
+	 2576,  2577,  2578,
+	 2579,  2580,  2581,
+	 2582,  2583,  2584,
+	 2585,  2586,  2587,
+	 2588,  2589,  2590,
+	 2591,  2592,  2593,
+	 2594,  2595,  2596,
+	 2597,  2598,  2599,
+	 2600,  2601,  2602,
+	 2603,  2604,  2605,
+	 2606,  2607,  2608,
+	 2609,  2610,  2611,
+	 2612,  2613,  2614,
+	 2615,  2616,  2617,
+	 2618,  2619,  2620,
+	 2621,  2622,  2623,
+	 2624,  2625,  2626,
+	 2627,  2628,  2629,
+	 2630,  2631,  2632,
+	 2633,  2634,  2635,
+	 2636,  2637,  2638,
+	 2639,  2640,  2641,
+	 2642,  2643,  2644,
+	 2645,  2646,  2647,
+	 2648,  2649,  2650,
+	 2651,  2652,  2653,
+	 2654,  2655,  2656,
+	 2657,  2658,  2659,
+	 2660,  2661,  2662,
+	 2663,  2664,  2665,
+	 2666,  2667,  2668,
+	 2669,  2670,  2671,
+	 2672,  2673,  2674,
+	 2675,  2676,  2677,
+	 2678,  2679,  2680,
+	 2681,  2682,  2683,
+	 2684,  2685,  2686,
+	 2687,  2688,  2689,
+	 2690,  2691,  2692,
+	 2693,  2694,  2695,
+	 2696,  2697,  2698,
+	 2699,  2700,  2701,
+	 2702,  2703,  2704,
+	 2705,  2706,  2707,
+	 2708,  2709,  2710,
+	 2711,  2712,  2713,
+	 2714,  2715,  2716,
+	 2717,  2718,  2719,
+	 2720,  2721,  2722,
+	 2723,  2724,  2725,
+	 2726,  2727,  2728,
+	 2729,  2730,  2731,
+	 2732,  2733,  2734,
+	 2735,  2736,  2737,
+	 2738,  2739,  2740,
+	 2741,  2742,  2743,
+	 2744,  2745,  2746,
+	 2747,  2748,  2749,
+	 2750,  2751,  2752,
+	 2753,  2754,  2755,
+	 2756,  2757,  2758,
+	 2759,  2760,  2761,
+	 2762,  2763,  2764,
+	 2765,  2766,  2767,
+	 2768,  2769,  2770,
+	 2771,  2772,  2773,
+	 2774,  2775,  2776,
+	 2777,  2778,  2779,
+	 2780,  2781,  2782,
+	 2783,  2784,  2785,
+	 2786,  2787,  2788,
+	 2789,  2790,  2791,
+	 2792,  2793,  2794,
+	 2795,  2796,  2797,
+	 2798,  2799,  2800,
+	 2801,  2802,  2803,
+	 2804,  2805,  2806,
+	 2807,  2808,  2809,
+	 2810,  2811,  2812,
+	 2813,  2814,  2815,
+	 2816,  2817,  2818,
+	 2819,  2820,  2821,
+	 2822,  2823,  2824,
+	 2825,  2826,  2827,
+	 2828,  2829,  2830,
+	 2831,  2832,  2833,
+	 2834,  2835,  2836,
+	 2837,  2838,  2839,
+	 2840,  2841,  2842,
+	 2843,  2844,  2845,
+	 2846,  2847,  2848,
+	 2849,  2850,  2851,
+	 2852,  2853,  2854,
+	 2855,  2856,  2857,
+	 2858,  2859,  2860,
+	 2861,  2862,  2863,
+	 2864,  2865,  2866,
+	 2867,  2868,  2869,
+	 2870,  2871,  2872,
+	 2873,  2874,  2875,
+	 2876,  2877,  2878,
+	 2879,  2880,  2881,
+	 2882,  2883,  2884,
+	 2885,  2886,  2887,
+	 2888,  2889,  2890,
+	 2891,  2892,  2893,
+	 2894,  2895,  2896,
+	 2897,  2898,  2899,
+	 2900,  2901,  2902,
+	 2903,  2904,  2905,
+};
@@ -0,0 +1,353 @@
+// meshheader -- turn a model into a header of ready-to-upload vertex and index arrays:
+//
+//	the model is read, transformed, given normals and colors, and de-duplicated here, once,
+//	instead of every time the program starts -- the header it writes has a MeshVertex array
+//	in exactly the layout that Mesh::Upload( ) would have made, and an index array, so
+//	the program just does:
+//
+//		#include "carouselhorse.h"
+//		...
+//		HorseMesh.UploadEmbedded( HorseVertices, HorseNumVertices, HorseIndices, HorseNumIndices );
+//
+//	it reads .obj files (with LoadObjFile( )) and the .550 files that the carousel horse is in
+//	(a points array and a tris array, written as c code)
+//
+//	this is a program of its own, not part of sample.cpp -- build it with "make meshheader"
+//
+//	usage:
+//		meshheader [options] name file.obj|file.550  >  name.h
+//	options, which are done in this order:
+//		-rotatey degrees	rotate about the y axis
+//		-translate dx dy dz	then move
+//		-flat			give every triangle its own normal (always done for .550 files,
+//					which have no normals)
+//		-color r g b		the color of every vertex (the default is white)
+//		-fakelight		darken the color by how far the normal is from straight up or down,
+//					like the "fake lighting from above" that the horse has always had
+//
+//	for example, the carousel horse:
+//		meshheader -rotatey 90 -translate 0 -1.1 0 -color 1 1 0 -fakelight Horse CarouselHorse0.10.550 > carouselhorse.h
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <vector>
+#include <map>
+#include <string>
+
+// loadobjfile.cpp uses these, which sample.cpp would otherwise have:
+
+void
+Cross( float v1[3], float v2[3], float vout[3] )
+{
+	float tmp[3];
+	tmp[0] = v1[1] * v2[2] - v2[1] * v1[2];
+	tmp[1] = v2[0] * v1[2] - v1[0] * v2[2];
+	tmp[2] = v1[0] * v2[1] - v2[0] * v1[1];
+	vout[0] = tmp[0];
+	vout[1] = tmp[1];
+	vout[2] = tmp[2];
+}
+
+float
+Unit( float vin[3], float vout[3] )
+{
+	float dist = vin[0] * vin[0] + vin[1] * vin[1] + vin[2] * vin[2];
+	if( dist > 0.0 )
+	{
+		dist = sqrtf( dist );
+		vout[0] = vin[0] / dist;
+		vout[1] = vin[1] / dist;
+		vout[2] = vin[2] / dist;
+	}
+	else
+	{
+		vout[0] = vin[0];
+		vout[1] = vin[1];
+		vout[2] = vin[2];
+	}
+	return dist;
+}
+
+#include "loadobjfile.cpp"
+
+// the same as in mesh.h (which this does not include, so that it needs no gl extensions):
+
+struct MeshVertex
+{
+	float		x, y, z;
+	float		nx, ny, nz;
+	float		s, t;
+	unsigned char	r, g, b, a;
+};
+
+
+struct MeshHeaderOptions
+{
+	float		RotateY;
+	float		Translate[3];
+	bool		Flat;
+	float		Color[3];
+	bool		FakeLight;
+};
+
+
+// read the points and tris arrays of a .550 file:
+// (each triangle gets its own 3 vertices, which Flatten( ) gives a normal to)
+
+bool
+Read550( const char *name, struct SurfaceMesh *mesh )
+{
+	FILE *fp = fopen( name, "r" );
+	if( fp == NULL )
+	{
+		fprintf( stderr, "meshheader: cannot open '%s'\n", name );
+		return false;
+	}
+
+	std::vector<float> points;
+	std::vector<int> tris;
+	enum { NONE, POINTS, TRIS } section = NONE;
+	char line[256];
+	while( fgets( line, sizeof(line), fp ) != NULL )
+	{
+		if( strstr( line, "struct point" ) != NULL  &&  strchr( line, '[' ) != NULL )
+			section = POINTS;
+		else if( strstr( line, "struct tri" ) != NULL  &&  strchr( line, '[' ) != NULL )
+			section = TRIS;
+		else if( strstr( line, "struct edge" ) != NULL  &&  strchr( line, '[' ) != NULL )
+			section = NONE;
+		else if( strstr( line, "};" ) != NULL )
+			section = NONE;
+		else if( section == POINTS )
+		{
+			float x, y, z;
+			if( sscanf( line, " { %ff , %ff , %ff", &x, &y, &z ) == 3 )
+			{
+				points.push_back( x );
+				points.push_back( y );
+				points.push_back( z );
+			}
+		}
+		else if( section == TRIS )
+		{
+			int p0, p1, p2;
+			if( sscanf( line, " { %d , %d , %d", &p0, &p1, &p2 ) == 3 )
+			{
+				tris.push_back( p0 );
+				tris.push_back( p1 );
+				tris.push_back( p2 );
+			}
+		}
+	}
+	fclose( fp );
+
+	int numPoints = (int)points.size( ) / 3;
+	for( int i = 0; i < (int)tris.size( ); i++ )
+	{
+		int p = tris[i];
+		if( p < 0  ||  p >= numPoints )
+		{
+			fprintf( stderr, "meshheader: '%s' has a triangle with point %d, but only %d points\n", name, p, numPoints );
+			return false;
+		}
+		struct SurfaceVertex v;
+		v.s = v.t = 0.;
+		v.nx = v.ny = 0.;  v.nz = 1.;
+		v.x = points[3*p+0];
+		v.y = points[3*p+1];
+		v.z = points[3*p+2];
+		mesh->Vertices.push_back( v );
+		mesh->Indices.push_back( (GLuint)i );
+	}
+	return ! tris.empty( );
+}
+
+
+// give each triangle its own vertices, with the triangle's normal:
+
+void
+Flatten( struct SurfaceMesh *mesh )
+{
+	struct SurfaceMesh flat;
+	for( int i = 0; i + 2 < (int)mesh->Indices.size( ); i += 3 )
+	{
+		struct SurfaceVertex v[3];
+		for( int k = 0; k < 3; k++ )
+			v[k] = mesh->Vertices[ mesh->Indices[i+k] ];
+
+		float v01[3] = { v[1].x - v[0].x,  v[1].y - v[0].y,  v[1].z - v[0].z };
+		float v02[3] = { v[2].x - v[0].x,  v[2].y - v[0].y,  v[2].z - v[0].z };
+		float n[3];
+		Cross( v01, v02, n );
+		Unit( n, n );
+
+		for( int k = 0; k < 3; k++ )
+		{
+			v[k].nx = n[0];  v[k].ny = n[1];  v[k].nz = n[2];
+			flat.Indices.push_back( (GLuint)flat.Vertices.size( ) );
+			flat.Vertices.push_back( v[k] );
+		}
+	}
+	*mesh = flat;
+}
+
+
+// a float as a c literal that always has a . or an e in it, so the f is legal:
+
+std::string
+FloatLiteral( float f )
+{
+	char s[32];
+	snprintf( s, sizeof(s), "%.7g", f );
+	std::string lit( s );
+	if( lit.find_first_of( ".e" ) == std::string::npos )
+		lit += ".";
+	return lit + "f";
+}
+
+
+unsigned char
+ColorByte( float c )
+{
+	if( c < 0. )	c = 0.;
+	if( c > 1. )	c = 1.;
+	return (unsigned char)( 255.f * c + 0.5f );
+}
+
+
+int
+main( int argc, char *argv[ ] )
+{
+	struct MeshHeaderOptions opt;
+	opt.RotateY = 0.;
+	opt.Translate[0] = opt.Translate[1] = opt.Translate[2] = 0.;
+	opt.Flat = false;
+	opt.Color[0] = opt.Color[1] = opt.Color[2] = 1.;
+	opt.FakeLight = false;
+
+	int arg = 1;
+	for( ; arg < argc  &&  argv[arg][0] == '-'; arg++ )
+	{
+		if( strcmp( argv[arg], "-rotatey" ) == 0  &&  arg + 1 < argc )
+			opt.RotateY = (float)atof( argv[++arg] );
+		else if( strcmp( argv[arg], "-translate" ) == 0  &&  arg + 3 < argc )
+		{
+			for( int k = 0; k < 3; k++ )
+				opt.Translate[k] = (float)atof( argv[++arg] );
+		}
+		else if( strcmp( argv[arg], "-flat" ) == 0 )
+			opt.Flat = true;
+		else if( strcmp( argv[arg], "-color" ) == 0  &&  arg + 3 < argc )
+		{
+			for( int k = 0; k < 3; k++ )
+				opt.Color[k] = (float)atof( argv[++arg] );
+		}
+		else if( strcmp( argv[arg], "-fakelight" ) == 0 )
+			opt.FakeLight = true;
+		else
+		{
+			fprintf( stderr, "meshheader: don't know what to do with option '%s'\n", argv[arg] );
+			return 1;
+		}
+	}
+	if( arg + 2 != argc )
+	{
+		fprintf( stderr, "usage: meshheader [-rotatey degrees] [-translate dx dy dz] [-flat] [-color r g b] [-fakelight] name file.obj|file.550\n" );
+		return 1;
+	}
+	const char *name = argv[arg];
+	char *file = argv[arg+1];
+
+	// read it:
+
+	struct SurfaceMesh mesh;
+	const char *dot = strrchr( file, '.' );
+	bool is550 = dot != NULL  &&  strcmp( dot, ".550" ) == 0;
+	if( is550 )
+	{
+		if( ! Read550( file, &mesh ) )
+			return 1;
+		opt.Flat = true;
+	}
+	else if( LoadObjFile( file, &mesh ) != 0  ||  mesh.Vertices.empty( ) )
+	{
+		fprintf( stderr, "meshheader: could not read '%s'\n", file );
+		return 1;
+	}
+
+	// move it:
+
+	float c = cosf( opt.RotateY * (float)M_PI / 180.f );
+	float s = sinf( opt.RotateY * (float)M_PI / 180.f );
+	for( int i = 0; i < (int)mesh.Vertices.size( ); i++ )
+	{
+		struct SurfaceVertex &v = mesh.Vertices[i];
+		float x = v.x, z = v.z;
+		v.x =  c*x + s*z + opt.Translate[0];
+		v.y += opt.Translate[1];
+		v.z = -s*x + c*z + opt.Translate[2];
+		float nx = v.nx, nz = v.nz;
+		v.nx =  c*nx + s*nz;
+		v.nz = -s*nx + c*nz;
+	}
+	if( opt.Flat )
+		Flatten( &mesh );
+
+	// turn it into MeshVertex's, sharing the ones that came out the same:
+
+	std::vector<struct MeshVertex> vertices;
+	std::vector<unsigned int> indices;
+	std::map<std::string, unsigned int> seen;
+	for( int i = 0; i < (int)mesh.Indices.size( ); i++ )
+	{
+		const struct SurfaceVertex &sv = mesh.Vertices[ mesh.Indices[i] ];
+		struct MeshVertex v;
+		memset( &v, 0, sizeof(v) );
+		v.x = sv.x;    v.y = sv.y;    v.z = sv.z;
+		v.nx = sv.nx;  v.ny = sv.ny;  v.nz = sv.nz;
+		v.s = sv.s;    v.t = sv.t;
+		float shade = opt.FakeLight ? fabsf( sv.ny ) : 1.f;
+		v.r = ColorByte( shade * opt.Color[0] );
+		v.g = ColorByte( shade * opt.Color[1] );
+		v.b = ColorByte( shade * opt.Color[2] );
+		v.a = 255;
+
+		std::string key( (const char *)&v, sizeof(v) );
+		std::map<std::string, unsigned int>::iterator it = seen.find( key );
+		if( it == seen.end( ) )
+		{
+			it = seen.insert( std::pair<std::string, unsigned int>( key, (unsigned int)vertices.size( ) ) ).first;
+			vertices.push_back( v );
+		}
+		indices.push_back( it->second );
+	}
+
+	// write it:
+
+	bool shorts = vertices.size( ) <= 65536;
+	printf( "// %s, made by meshheader from %s -- do not edit this, run meshheader again instead\n", name, file );
+	printf( "//	%d vertices, %d triangles\n\n", (int)vertices.size( ), (int)indices.size( ) / 3 );
+	printf( "const int %sNumVertices = %d;\n", name, (int)vertices.size( ) );
+	printf( "const int %sNumIndices  = %d;\n\n", name, (int)indices.size( ) );
+
+	printf( "const MeshVertex %sVertices[ ] = {\n", name );
+	for( int i = 0; i < (int)vertices.size( ); i++ )
+	{
+		const struct MeshVertex &v = vertices[i];
+		printf( "\t{ %s, %s, %s,   %s, %s, %s,   %s, %s,   %d, %d, %d, %d },\n",
+			FloatLiteral( v.x ).c_str( ), FloatLiteral( v.y ).c_str( ), FloatLiteral( v.z ).c_str( ),
+			FloatLiteral( v.nx ).c_str( ), FloatLiteral( v.ny ).c_str( ), FloatLiteral( v.nz ).c_str( ),
+			FloatLiteral( v.s ).c_str( ), FloatLiteral( v.t ).c_str( ),
+			v.r, v.g, v.b, v.a );
+	}
+	printf( "};\n\n" );
+
+	printf( "const %s %sIndices[ ] = {\n", shorts ? "GLushort" : "GLuint", name );
+	for( int i = 0; i < (int)indices.size( ); i += 3 )
+		printf( "\t%5u, %5u, %5u,\n", indices[i], indices[i+1], indices[i+2] );
+	printf( "};\n" );
+	return 0;
+}
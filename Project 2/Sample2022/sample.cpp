@@ -104,6 +104,40 @@ enum ButtonVals
 	QUIT
 };
 
+// the carousel menu -- the original four horses drawn one at a time, or a number of carousels
+// drawn as instances of the one horse mesh:
+
+enum CarouselChoices
+{
+	FOUR_HORSES,
+	INSTANCED_1x4,
+	STRESS_100x8,
+	STRESS_1000x8,
+	STRESS_10000x8,
+	STRESS_1000x32
+};
+
+struct CarouselSize
+{
+	int		Carousels;
+	int		Horses;			// on each carousel
+	bool		Stagger;		// give every horse its own bobbing phase
+};
+
+const CarouselSize CarouselSizes[ ] =		// indexed by CarouselChoices
+{
+	{     1,  4, false },
+	{     1,  4, false },
+	{   100,  8, true  },
+	{  1000,  8, true  },
+	{ 10000,  8, true  },
+	{  1000, 32, true  }
+};
+
+const float CAROUSEL_SPACING  = 6.f;		// between carousel poles in the stress test
+const float CAROUSEL_RADIUS   = 2.f;		// pole to horse
+const int   CAROUSEL_REPORT   = 100;		// frames between frame-time reports
+
 // window background color (rgba):
 
 const GLfloat BACKCOLOR[ ] = { 0., 0., 0., 1. };
@@ -180,10 +214,6 @@ GLuint	AxesList;				// list to hold the axes
 int		AxesOn;					// != 0 means to draw the axes
 GLuint	BoxList;				// object display list
 GLuint	WireHorseList;			// object display list
-GLuint	HorseList;				// object display list
-GLuint	HorseList2;				// object display list
-GLuint	HorseList3;				// object display list
-GLuint	HorseList4;				// object display list
 GLuint	CircleList;				// object display list
 int		DebugOn;				// != 0 means to print debugging info
 int		DepthCueOn;				// != 0 means to use intensity depth cueing
@@ -197,6 +227,7 @@ int		ShadowsOn;				// != 0 means to turn shadows on
 float	Time;					// used for animation, this has a value between 0. and 1.
 int		Xmouse, Ymouse;			// mouse values
 float	Xrot, Yrot;				// rotation angles in degrees
+int		NowCarousel;			// one of the CarouselChoices
 
 
 // function prototypes:
@@ -204,6 +235,7 @@ float	Xrot, Yrot;				// rotation angles in degrees
 void	Animate( );
 void	Display( );
 void	DoAxesMenu( int );
+void	DoCarouselMenu( int );
 void	DoColorMenu( int );
 void	DoDepthBufferMenu( int );
 void	DoDepthFightingMenu( int );
@@ -213,11 +245,13 @@ void	DoMainMenu( int );
 void	DoProjectMenu( int );
 void	DoRasterString( float, float, float, char * );
 void	DoStrokeString( float, float, float, float, char * );
+void	DrawCarousels( );
 float	ElapsedSeconds( );
 void	InitGraphics( );
 void	InitLists( );
 void	InitMenus( );
 void	Keyboard( unsigned char, int, int );
+void	MakeCarousels( int, int, bool );
 void	MouseButton( int, int, int, int );
 void	MouseMotion( int, int );
 void	Reset( );
@@ -313,8 +347,24 @@ MulArray3(float factor, float a, float b, float c )
 //#include "bmptotexture.cpp"
 //#include "loadobjfile.cpp"
 //#include "keytime.cpp"
-//#include "glslprogram.cpp"
-#include "CarouselHorse0.10.550"
+#include "glslprogram.cpp"
+#include "mesh.cpp"
+#include "carouselhorse.h"
+
+Mesh		HorseMesh;			// the horse, in a vertex buffer instead of a display list
+
+// the instanced carousels:
+
+GLSLProgram	CarouselProgram;		// carousel.vert
+bool		CarouselShaderOn;		// it compiled and linked
+GLuint		CarouselBuffer;			// a mat4 and a vec2 for each horse
+int		NumHorses;			// in CarouselBuffer
+UniformHandle<float>	CarouselTime, CarouselSeconds, CarouselRadius, CarouselBobHeight, CarouselBobPeriod;
+GLuint		CarouselQueries[2];		// gpu time of the horses, this frame and last frame
+int		CarouselQueriesBegun;		// 0, 1, or 2 -- last frame's query can only be read once it has been begun
+int		ReportFrames;			// since the last frame-time report
+int		ReportStartMs;
+double		ReportGpuMs;
 
 
 // main program:
@@ -548,59 +598,69 @@ Display( )
 	// Calculate the horse's orientation angle (to make it face forward)
 	//float horseAngle = 360 * Time;
 
-	// Call the display list with the updated translation
-	glPushMatrix(); // Push the current matrix
-	//Rotate horse
-	//Translate to edge of circle
-	//glTranslatef(x, 0.0f, z);
-	//glRotatef(theta2, 0., 1., 0.);
-	glRotatef(360.f * Time, 0, 1, 0); 
-	glTranslatef(0., 0., 2.0f);	
-	glTranslatef(0.0f, horsePositionY, 0.0f); // Apply translation
-	glRotatef(theta, 0., 0., 1.);
-	glCallList(HorseList); // Render the horse
-	glPopMatrix(); // Restore the previous matrix
-
-	glPushMatrix(); // Push the current matrix
-	//Rotate horse
-	//Translate to edge of circle
-	//glTranslatef(x, 0.0f, z);
-	//glRotatef(theta2, 0., 1., 0.);
-	glRotatef(360.f * Time, 0, 1, 0);
-	glTranslatef(0., 0., -2.0f);
-	glRotatef(180, 0, 1, 0);
-	glTranslatef(0.0f, horsePositionY, 0.0f); // Apply translation
-	glRotatef(theta, 0., 0., 1.);
-	glCallList(HorseList); // Render the horse
-	glPopMatrix(); // Restore the previous matrix
-
-	glPushMatrix(); // Push the current matrix
-	//Rotate horse
-	//Translate to edge of circle
-	//glTranslatef(x, 0.0f, z);
-	//glRotatef(theta2, 0., 1., 0.);
-	glRotatef(360.f * Time, 0, 1, 0);
-	glTranslatef(2.0f, 0., 0.f);
-	glRotatef(90, 0, 1, 0);
-	glTranslatef(0.0f, horsePositionY, 0.0f); // Apply translation
-	glRotatef(theta, 0., 0., 1.);
-	glCallList(HorseList); // Render the horse
-	glPopMatrix(); // Restore the previous matrix
-
-	glPushMatrix(); // Push the current matrix
-	//Rotate horse
-	//Translate to edge of circle
-	//glTranslatef(x, 0.0f, z);
-	//glRotatef(theta2, 0., 1., 0.);
-	glRotatef(360.f * Time, 0, 1, 0);
-	glTranslatef(-2.0f, 0., 0.);
-	glRotatef(270, 0, 1, 0);
-	glTranslatef(0.0f, horsePositionY, 0.0f); // Apply translation
-	glRotatef(theta, 0., 0., 1.);
-	glCallList(HorseList); // Render the horse
-	glPopMatrix(); // Restore the previous matrix
-
-	//glCallList( HorseList );
+	// the carousel -- either the original four horses, or every horse of every carousel
+	// in one instanced draw, with carousel.vert doing the bobbing and rocking:
+
+	if( NowCarousel != FOUR_HORSES  &&  CarouselShaderOn )
+	{
+		DrawCarousels( );
+	}
+	else
+	{
+		// Call the display list with the updated translation
+		glPushMatrix(); // Push the current matrix
+		//Rotate horse
+		//Translate to edge of circle
+		//glTranslatef(x, 0.0f, z);
+		//glRotatef(theta2, 0., 1., 0.);
+		glRotatef(360.f * Time, 0, 1, 0); 
+		glTranslatef(0., 0., 2.0f);	
+		glTranslatef(0.0f, horsePositionY, 0.0f); // Apply translation
+		glRotatef(theta, 0., 0., 1.);
+		HorseMesh.Draw( ); // Render the horse
+		glPopMatrix(); // Restore the previous matrix
+
+		glPushMatrix(); // Push the current matrix
+		//Rotate horse
+		//Translate to edge of circle
+		//glTranslatef(x, 0.0f, z);
+		//glRotatef(theta2, 0., 1., 0.);
+		glRotatef(360.f * Time, 0, 1, 0);
+		glTranslatef(0., 0., -2.0f);
+		glRotatef(180, 0, 1, 0);
+		glTranslatef(0.0f, horsePositionY, 0.0f); // Apply translation
+		glRotatef(theta, 0., 0., 1.);
+		HorseMesh.Draw( ); // Render the horse
+		glPopMatrix(); // Restore the previous matrix
+
+		glPushMatrix(); // Push the current matrix
+		//Rotate horse
+		//Translate to edge of circle
+		//glTranslatef(x, 0.0f, z);
+		//glRotatef(theta2, 0., 1., 0.);
+		glRotatef(360.f * Time, 0, 1, 0);
+		glTranslatef(2.0f, 0., 0.f);
+		glRotatef(90, 0, 1, 0);
+		glTranslatef(0.0f, horsePositionY, 0.0f); // Apply translation
+		glRotatef(theta, 0., 0., 1.);
+		HorseMesh.Draw( ); // Render the horse
+		glPopMatrix(); // Restore the previous matrix
+
+		glPushMatrix(); // Push the current matrix
+		//Rotate horse
+		//Translate to edge of circle
+		//glTranslatef(x, 0.0f, z);
+		//glRotatef(theta2, 0., 1., 0.);
+		glRotatef(360.f * Time, 0, 1, 0);
+		glTranslatef(-2.0f, 0., 0.);
+		glRotatef(270, 0, 1, 0);
+		glTranslatef(0.0f, horsePositionY, 0.0f); // Apply translation
+		glRotatef(theta, 0., 0., 1.);
+		HorseMesh.Draw( ); // Render the horse
+		glPopMatrix(); // Restore the previous matrix
+	}
+
+	//HorseMesh.Draw( );
 
 	glCallList( CircleList );
 
@@ -745,6 +805,30 @@ DoMainMenu( int id )
 }
 
 
+void
+DoCarouselMenu( int id )
+{
+	NowCarousel = id;
+	if( id != FOUR_HORSES )
+	{
+		const CarouselSize &size = CarouselSizes[id];
+		MakeCarousels( size.Carousels, size.Horses, size.Stagger );
+
+		// back away far enough to see all of them:
+
+		int side = (int)ceil( sqrt( (float)size.Carousels ) );
+		Scale = 1.f / (float)side;
+		if( Scale < MINSCALE )
+			Scale = MINSCALE;
+	}
+	else
+		Scale = 1.f;
+
+	glutSetWindow( MainWindow );
+	glutPostRedisplay( );
+}
+
+
 void
 DoProjectMenu( int id )
 {
@@ -803,6 +887,110 @@ ElapsedSeconds( )
 }
 
 
+// draw every horse of every carousel with one glDrawElementsInstanced( ):
+//	the gpu time of the draw is measured with a timer query, which is read a frame later so
+//	that asking for it never makes the cpu wait -- in the stress tests (or with debugging on), every
+//	CAROUSEL_REPORT frames, the average gpu time and the average time from one frame to the next are printed
+
+void
+DrawCarousels( )
+{
+	if( CarouselQueries[0] == 0 )
+		glGenQueries( 2, CarouselQueries );
+
+	glBeginQuery( GL_TIME_ELAPSED, CarouselQueries[0] );
+	CarouselProgram.Use( );
+	CarouselTime.Set( Time );
+	CarouselSeconds.Set( ElapsedSeconds( ) );
+	CarouselRadius.Set( CAROUSEL_RADIUS );
+	CarouselBobHeight.Set( 1.f );
+	CarouselBobPeriod.Set( 2.f / ( 1000.f * horseSpeed ) );
+	HorseMesh.DrawInstanced( NumHorses );
+	CarouselProgram.UnUse( );
+	glEndQuery( GL_TIME_ELAPSED );
+	if( CarouselQueriesBegun < 2 )
+		CarouselQueriesBegun++;
+
+	GLuint available = 0;
+	if( CarouselQueriesBegun == 2 )
+		glGetQueryObjectuiv( CarouselQueries[1], GL_QUERY_RESULT_AVAILABLE, &available );
+	if( available )
+	{
+		GLuint64 ns = 0;
+		glGetQueryObjectui64v( CarouselQueries[1], GL_QUERY_RESULT, &ns );
+		ReportGpuMs += (double)ns / 1000000.;
+	}
+	GLuint swap = CarouselQueries[0];
+	CarouselQueries[0] = CarouselQueries[1];
+	CarouselQueries[1] = swap;
+
+	if( NowCarousel < STRESS_100x8  &&  DebugOn == 0 )
+	{
+		ReportFrames = 0;
+		ReportGpuMs = 0.;
+		return;
+	}
+
+	int ms = glutGet( GLUT_ELAPSED_TIME );
+	if( ReportFrames == 0 )
+		ReportStartMs = ms;
+	if( ++ReportFrames > CAROUSEL_REPORT )
+	{
+		const CarouselSize &size = CarouselSizes[NowCarousel];
+		fprintf( stderr, "Carousel: %d x %d = %d horses, %d triangles -- %.2f ms/frame, %.3f ms of gpu time for the horses\n",
+			size.Carousels, size.Horses, NumHorses, NumHorses * HorseMesh.GetNumTriangles( ),
+			(double)( ms - ReportStartMs ) / (double)CAROUSEL_REPORT, ReportGpuMs / (double)CAROUSEL_REPORT );
+		ReportFrames = 0;
+		ReportGpuMs = 0.;
+	}
+}
+
+
+// fill the instance buffer with carousels horses on each of carousels carousels,
+// which stand in a square grid centered at the origin:
+
+void
+MakeCarousels( int carousels, int horses, bool stagger )
+{
+	int side = (int)ceil( sqrt( (float)carousels ) );
+	float start = -0.5f * CAROUSEL_SPACING * (float)( side - 1 );
+
+	std::vector<float> instances;
+	instances.reserve( 18 * carousels * horses );
+	for( int c = 0; c < carousels; c++ )
+	{
+		float x = start + CAROUSEL_SPACING * (float)( c % side );
+		float z = start + CAROUSEL_SPACING * (float)( c / side );
+		float turn = stagger ? 37.f * (float)c : 0.f;		// so they do not all line up
+
+		for( int h = 0; h < horses; h++ )
+		{
+			// the carousel's transform -- a translation, in column order:
+
+			float m[16] = { 1., 0., 0., 0.,   0., 1., 0., 0.,   0., 0., 1., 0.,   x, 0., z, 1. };
+			instances.insert( instances.end( ), m, m + 16 );
+			instances.push_back( turn + 360.f * (float)h / (float)horses );
+			instances.push_back( stagger  ?  (float)h / (float)horses  :  0.f );
+		}
+	}
+	NumHorses = carousels * horses;
+
+	if( CarouselBuffer == 0 )
+		glGenBuffers( 1, &CarouselBuffer );
+	glBindBuffer( GL_ARRAY_BUFFER, CarouselBuffer );
+	glBufferData( GL_ARRAY_BUFFER, instances.size( )*sizeof(float), &instances[0], GL_STATIC_DRAW );
+	glBindBuffer( GL_ARRAY_BUFFER, 0 );
+
+	const GLsizei stride = 18 * sizeof(float);
+	for( int col = 0; col < 4; col++ )
+		HorseMesh.InstanceAttribute( 10 + col, 4, CarouselBuffer, stride, 4 * col * sizeof(float) );
+	HorseMesh.InstanceAttribute( 14, 2, CarouselBuffer, stride, 16 * sizeof(float) );
+
+	ReportFrames = 0;
+	ReportGpuMs = 0.;
+}
+
+
 // initialize the glui window:
 
 void
@@ -844,6 +1032,14 @@ InitMenus( )
 	glutAddMenuEntry( "Orthographic",  ORTHO );
 	glutAddMenuEntry( "Perspective",   PERSP );
 
+	int carouselmenu = glutCreateMenu( DoCarouselMenu );
+	glutAddMenuEntry( "Four Horses, One at a Time",		FOUR_HORSES );
+	glutAddMenuEntry( "Instanced",				INSTANCED_1x4 );
+	glutAddMenuEntry( "Stress: 100 Carousels x 8 Horses",	STRESS_100x8 );
+	glutAddMenuEntry( "Stress: 1000 Carousels x 8 Horses",	STRESS_1000x8 );
+	glutAddMenuEntry( "Stress: 10000 Carousels x 8 Horses",	STRESS_10000x8 );
+	glutAddMenuEntry( "Stress: 1000 Carousels x 32 Horses",	STRESS_1000x32 );
+
 	int mainmenu = glutCreateMenu( DoMainMenu );
 	glutAddSubMenu(   "Axes",          axesmenu);
 	glutAddSubMenu(   "Axis Colors",   colormenu);
@@ -858,6 +1054,7 @@ InitMenus( )
 
 	glutAddSubMenu(   "Depth Cue",     depthcuemenu);
 	glutAddSubMenu(   "Projection",    projmenu );
+	glutAddSubMenu(   "Carousel",      carouselmenu );
 	glutAddMenuEntry( "Reset",         RESET );
 	glutAddSubMenu(   "Debug",         debugmenu);
 	glutAddMenuEntry( "Quit",          QUIT );
@@ -947,8 +1144,8 @@ InitGraphics( )
 	glutIdleFunc( Animate );
 
 	// init the glew package (a window must be open to do this):
+	// (on every platform -- the horse's buffers and shader come through glew's entry points)
 
-#ifdef WIN32
 	GLenum err = glewInit( );
 	if( err != GLEW_OK )
 	{
@@ -957,10 +1154,18 @@ InitGraphics( )
 	else
 		fprintf( stderr, "GLEW initialized OK\n" );
 	fprintf( stderr, "Status: Using GLEW %s\n", glewGetString(GLEW_VERSION));
-#endif
 
 	// all other setups go here, such as GLSLProgram and KeyTime setups:
 
+	CarouselProgram.Init( );
+	CarouselShaderOn = CarouselProgram.Create( (char *)"carousel.vert" );
+	if( ! CarouselShaderOn )
+		fprintf( stderr, "carousel.vert did not build -- the horses are drawn one at a time\n" );
+	CarouselTime      = CarouselProgram.GetUniform<float>( "uTime" );
+	CarouselSeconds   = CarouselProgram.GetUniform<float>( "uSeconds" );
+	CarouselRadius    = CarouselProgram.GetUniform<float>( "uRadius" );
+	CarouselBobHeight = CarouselProgram.GetUniform<float>( "uBobHeight" );
+	CarouselBobPeriod = CarouselProgram.GetUniform<float>( "uBobPeriod" );
 }
 
 
@@ -978,153 +1183,12 @@ void InitLists() {
 
 	glutSetWindow(MainWindow);
 
-	// HorseList Begin
-
-	HorseList = glGenLists(1);
-	glNewList(HorseList, GL_COMPILE);
-	glPushMatrix();
-	glRotatef(90.f, 0., 1., 0.);
-	glTranslatef(0., -1.1f, 0.f);
-	glBegin(GL_TRIANGLES);
-	for (int i = 0; i < HORSEntris; i++)
-	{
-		struct point p0 = HORSEpoints[HORSEtris[i].p0];
-		struct point p1 = HORSEpoints[HORSEtris[i].p1];
-		struct point p2 = HORSEpoints[HORSEtris[i].p2];
-
-		// fake "lighting" from above:
-
-		float p01[3], p02[3], n[3];
-		p01[0] = p1.x - p0.x;
-		p01[1] = p1.y - p0.y;
-		p01[2] = p1.z - p0.z;
-		p02[0] = p2.x - p0.x;
-		p02[1] = p2.y - p0.y;
-		p02[2] = p2.z - p0.z;
-		Cross(p01, p02, n);
-		Unit(n, n);
-		n[1] = (float)fabs(n[1]);
-		// simulating a glColor3f( 1., 1., 0. ) = yellow:
-		glColor3f(1.f * n[1], 1.f * n[1], 0.f * n[1]);
-
-		glVertex3f(p0.x, p0.y, p0.z);
-		glVertex3f(p1.x, p1.y, p1.z);
-		glVertex3f(p2.x, p2.y, p2.z);
-	}
-	glEnd();
-	glPopMatrix();
-	glEndList();
-
-	// Horselist 2
-
-	HorseList2 = glGenLists(1);
-	glNewList(HorseList2, GL_COMPILE);
-	glPushMatrix();
-	glRotatef(90.f, 0., 1., 0.);
-	glTranslatef(0., -1.1f, 0.f);
-	glBegin(GL_TRIANGLES);
-	for (int i = 0; i < HORSEntris; i++)
-	{
-		struct point p0 = HORSEpoints[HORSEtris[i].p0];
-		struct point p1 = HORSEpoints[HORSEtris[i].p1];
-		struct point p2 = HORSEpoints[HORSEtris[i].p2];
-
-		// fake "lighting" from above:
-
-		float p01[3], p02[3], n[3];
-		p01[0] = p1.x - p0.x;
-		p01[1] = p1.y - p0.y;
-		p01[2] = p1.z - p0.z;
-		p02[0] = p2.x - p0.x;
-		p02[1] = p2.y - p0.y;
-		p02[2] = p2.z - p0.z;
-		Cross(p01, p02, n);
-		Unit(n, n);
-		n[1] = (float)fabs(n[1]);
-		// simulating a glColor3f( 1., 1., 0. ) = yellow:
-		glColor3f(1.f * n[1], 1.f * n[1], 0.f * n[1]);
-
-		glVertex3f(p0.x, p0.y, p0.z);
-		glVertex3f(p1.x, p1.y, p1.z);
-		glVertex3f(p2.x, p2.y, p2.z);
-	}
-	glEnd();
-	glPopMatrix();
-	glEndList();
+	// the horse:
+	// (carouselhorse.h already has the old display list's glRotatef( 90., 0., 1., 0. ) and
+	// glTranslatef( 0., -1.1, 0. ) applied to its points, and its fake lighting from above
+	// in its colors -- "make carouselhorse.h" makes it again from CarouselHorse0.10.550)
 
-	//HorseList3
-
-	HorseList3 = glGenLists(1);
-	glNewList(HorseList3, GL_COMPILE);
-	glPushMatrix();
-	glRotatef(90.f, 0., 1., 0.);
-	glTranslatef(0., -1.1f, 0.f);
-	glBegin(GL_TRIANGLES);
-	for (int i = 0; i < HORSEntris; i++)
-	{
-		struct point p0 = HORSEpoints[HORSEtris[i].p0];
-		struct point p1 = HORSEpoints[HORSEtris[i].p1];
-		struct point p2 = HORSEpoints[HORSEtris[i].p2];
-
-		// fake "lighting" from above:
-
-		float p01[3], p02[3], n[3];
-		p01[0] = p1.x - p0.x;
-		p01[1] = p1.y - p0.y;
-		p01[2] = p1.z - p0.z;
-		p02[0] = p2.x - p0.x;
-		p02[1] = p2.y - p0.y;
-		p02[2] = p2.z - p0.z;
-		Cross(p01, p02, n);
-		Unit(n, n);
-		n[1] = (float)fabs(n[1]);
-		// simulating a glColor3f( 1., 1., 0. ) = yellow:
-		glColor3f(1.f * n[1], 1.f * n[1], 0.f * n[1]);
-
-		glVertex3f(p0.x, p0.y, p0.z);
-		glVertex3f(p1.x, p1.y, p1.z);
-		glVertex3f(p2.x, p2.y, p2.z);
-	}
-	glEnd();
-	glPopMatrix();
-	glEndList();
-
-	// HorseList 4
-
-	HorseList4 = glGenLists(1);
-	glNewList(HorseList4, GL_COMPILE);
-	glPushMatrix();
-	glRotatef(90.f, 0., 1., 0.);
-	glTranslatef(0., -1.1f, 0.f);
-	glBegin(GL_TRIANGLES);
-	for (int i = 0; i < HORSEntris; i++)
-	{
-		struct point p0 = HORSEpoints[HORSEtris[i].p0];
-		struct point p1 = HORSEpoints[HORSEtris[i].p1];
-		struct point p2 = HORSEpoints[HORSEtris[i].p2];
-
-		// fake "lighting" from above:
-
-		float p01[3], p02[3], n[3];
-		p01[0] = p1.x - p0.x;
-		p01[1] = p1.y - p0.y;
-		p01[2] = p1.z - p0.z;
-		p02[0] = p2.x - p0.x;
-		p02[1] = p2.y - p0.y;
-		p02[2] = p2.z - p0.z;
-		Cross(p01, p02, n);
-		Unit(n, n);
-		n[1] = (float)fabs(n[1]);
-		// simulating a glColor3f( 1., 1., 0. ) = yellow:
-		glColor3f(1.f * n[1], 1.f * n[1], 0.f * n[1]);
-
-		glVertex3f(p0.x, p0.y, p0.z);
-		glVertex3f(p1.x, p1.y, p1.z);
-		glVertex3f(p2.x, p2.y, p2.z);
-	}
-	glEnd();
-	glPopMatrix();
-	glEndList();
+	HorseMesh.UploadEmbedded( HorseVertices, HorseNumVertices, HorseIndices, HorseNumIndices );
 
 	//CircleList begin
 
@@ -1314,6 +1378,7 @@ Reset( )
 	NowColor = YELLOW;
 	NowProjection = PERSP;
 	Xrot = Yrot = 0.;
+	DoCarouselMenu( INSTANCED_1x4 );	// this sets Scale too
 }
 
 
@@ -1,30 +1,36 @@
+#include "pipeline.cpp"
+
+
+// the lights go through the pipeline (and from there the state cache), so they work with either one,
+// and setting one up the same way every frame is nearly free:
+
 void
 SetPointLight( int ilight, float x, float y, float z,  float r, float g, float b )
 {
-	glLightfv( ilight, GL_POSITION,  Array3( x, y, z ) );
-	glLightf(  ilight, GL_SPOT_CUTOFF, 180.f );
-	glLightfv( ilight, GL_AMBIENT,   MulArray3( 0.1f,  1.f, 1.f, 1.f ) );
-	glLightfv( ilight, GL_DIFFUSE,   MulArray3( 0.6f, r, g, b ) );
-	glLightfv( ilight, GL_SPECULAR,  MulArray3( 0.4f, 1.f, 1.f, 1.f ) );
-	glLightf ( ilight, GL_CONSTANT_ATTENUATION, 1. );
-	glLightf ( ilight, GL_LINEAR_ATTENUATION, 0. );
-	glLightf ( ilight, GL_QUADRATIC_ATTENUATION, 0. );
-	glEnable( ilight );
+	Pipeline.Light( ilight, GL_POSITION,  Array3( x, y, z ) );
+	Pipeline.Light( ilight, GL_SPOT_CUTOFF, 180.f );
+	Pipeline.Light( ilight, GL_AMBIENT,   MulArray3( 0.1f,  1.f, 1.f, 1.f ) );
+	Pipeline.Light( ilight, GL_DIFFUSE,   MulArray3( 0.6f, r, g, b ) );
+	Pipeline.Light( ilight, GL_SPECULAR,  MulArray3( 0.4f, 1.f, 1.f, 1.f ) );
+	Pipeline.Light( ilight, GL_CONSTANT_ATTENUATION, 1. );
+	Pipeline.Light( ilight, GL_LINEAR_ATTENUATION, 0. );
+	Pipeline.Light( ilight, GL_QUADRATIC_ATTENUATION, 0. );
+	Pipeline.Enable( ilight );
 }
 
 void
 SetSpotLight( int ilight, float x, float y, float z,  float xdir, float ydir, float zdir, float r, float g, float b )
 {
-	glLightfv( ilight, GL_POSITION,  Array3( x, y, z ) );
-	glLightfv( ilight, GL_SPOT_DIRECTION,  Array3(xdir,ydir,zdir) );
-	glLightf(  ilight, GL_SPOT_EXPONENT, 1.f );
-	glLightf(  ilight, GL_SPOT_CUTOFF, 45.f );
-	glLightfv( ilight, GL_AMBIENT,   Array3( 0., 0., 0. ) );
-	glLightfv( ilight, GL_DIFFUSE,   Array3( r, g, b ) );
-	glLightfv( ilight, GL_SPECULAR,  Array3( r, g, b ) );
-	glLightf ( ilight, GL_CONSTANT_ATTENUATION, 1. );
-	glLightf ( ilight, GL_LINEAR_ATTENUATION, 0. );
-	glLightf ( ilight, GL_QUADRATIC_ATTENUATION, 0. );
-	glEnable( ilight );
+	Pipeline.Light( ilight, GL_POSITION,  Array3( x, y, z ) );
+	Pipeline.Light( ilight, GL_SPOT_DIRECTION,  Array3(xdir,ydir,zdir) );
+	Pipeline.Light( ilight, GL_SPOT_EXPONENT, 1.f );
+	Pipeline.Light( ilight, GL_SPOT_CUTOFF, 45.f );
+	Pipeline.Light( ilight, GL_AMBIENT,   Array3( 0., 0., 0. ) );
+	Pipeline.Light( ilight, GL_DIFFUSE,   Array3( r, g, b ) );
+	Pipeline.Light( ilight, GL_SPECULAR,  Array3( r, g, b ) );
+	Pipeline.Light( ilight, GL_CONSTANT_ATTENUATION, 1. );
+	Pipeline.Light( ilight, GL_LINEAR_ATTENUATION, 0. );
+	Pipeline.Light( ilight, GL_QUADRATIC_ATTENUATION, 0. );
+	Pipeline.Enable( ilight );
 }
 
@@ -0,0 +1,61 @@
+#ifndef GRID_H
+#define GRID_H
+
+#include <stdio.h>
+#include <vector>
+
+#include "glew.h"
+#include <GL/gl.h>
+
+#include "glslprogram.h"
+#include "frustum.cpp"
+
+
+// a big flat floor in the XZ plane, drawn as tiles:
+//
+//	there is only one tile's worth of indices -- the vertex shader (grid.vert) turns
+//	gl_VertexID into a grid position, and each tile is picked with a base vertex
+//	the tiles are frustum culled on the cpu and what is left is drawn with one
+//	glMultiDrawElementsBaseVertex( )
+//
+//	lighting, material, fog, and color all come from the usual fixed-function state,
+//	so call SetMaterial( ) / SetPointLight( ) just like for a display list
+
+class Grid
+{
+  private:
+	float			StartX, StartZ;		// where the grid starts
+	float			DeltaX, DeltaZ;		// change in x and z between the points
+	float			Height;			// height of the floor
+	int			CellsX, CellsZ;		// how many cells in x and z
+	int			TileSize;		// how many cells on a side of each tile
+	int			TilesX, TilesZ;		// how many tiles in x and z
+	int			VertsPerTile;
+
+	std::vector<float>	TileMin;		// per-tile bounding boxes, 3 floats each
+	std::vector<float>	TileMax;
+
+	GLuint			IndexBuffer;
+	GLuint			VertexArray;
+	GLsizei			IndicesPerTile;
+	GLSLProgram		Program;
+	bool			UseShader;
+
+	std::vector<GLsizei>	Counts;			// reused every frame for the multi-draw
+	std::vector<GLvoid *>	Offsets;
+	std::vector<GLint>	BaseVertices;
+
+	int			NumVisible;
+
+	void	DrawImmediate( );
+
+  public:
+		Grid( );
+
+	void	Draw( );
+	int	GetNumTiles( );
+	int	GetNumVisibleTiles( );
+	void	Init( float, float, float, float, int, int, float = 0., int = 32 );
+};
+
+#endif		// #ifndef GRID_H
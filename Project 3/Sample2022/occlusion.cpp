@@ -0,0 +1,566 @@
+#ifndef OCCLUSION_CPP
+#define OCCLUSION_CPP
+
+#include "occlusion.h"
+
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+
+// fewer occluder triangles than this are not worth starting threads for:
+
+const int OCCLUSION_MIN_TRIANGLES_PER_THREAD = 256;
+
+// an idle worker yields this many times before it starts sleeping between looks:
+// (Rasterize( ) comes once a frame, so a sleeping worker is usually what it finds)
+
+const int OCCLUSION_SPINS = 200;
+const int OCCLUSION_SLEEP_US = 200;
+
+// a box is tested against the first pyramid level where it covers no more than this many pixels across:
+// (each level up, a pixel is the farthest of 4, so a gap between two occluders spreads -- a crowd
+// member behind a row of others is usually only hidden at the finer levels)
+
+const int OCCLUSION_TEST_PIXELS = 16;
+
+
+// the width is rounded up to a multiple of 4, so the rasterizer can always do 4 pixels at a time:
+
+OcclusionCuller::OcclusionCuller( int width, int height ) : Started( 0 ), Finished( 0 ), Quit( false )
+{
+	Width = ( ( width < 4 ? 4 : width ) + 3 ) & ~3;
+	Height = height < 1  ?  1  :  height;
+
+	// each pyramid level is half the size of the one below it, down to 1x1:
+
+	int w = Width;
+	int h = Height;
+	while( true )
+	{
+		LevelWidths.push_back( w );
+		LevelHeights.push_back( h );
+		Levels.push_back( std::vector<float>( w*h, 1.f ) );
+		if( w == 1  &&  h == 1 )
+			break;
+		w = ( w + 1 ) / 2;
+		h = ( h + 1 ) / 2;
+	}
+
+	for( int i = 0; i < 16; i++ )
+		View[i] = ( i % 5 == 0 )  ?  1.f  :  0.f;
+	NumThreads = (int)std::thread::hardware_concurrency( );
+	if( NumThreads < 1 )
+		NumThreads = 1;
+	Bands = 1;
+	Occluders = BoxesTested = BoxesHidden = 0;
+	ThreadsUsed = 0;
+	RasterMs = 0.;
+}
+
+
+OcclusionCuller::~OcclusionCuller( )
+{
+	StopWorkers( );
+}
+
+
+// an occluder's triangles -- numVertices positions, stride bytes apart, and numIndices indices,
+// 3 per triangle -- placed in the world by the world matrix (NULL = where they are):
+
+void
+OcclusionCuller::AddOccluder( const float *xyz, size_t stride, int numVertices, const GLuint *indices, int numIndices, const float world[16] )
+{
+	float m[16];
+	for( int col = 0; col < 4; col++ )
+	{
+		for( int row = 0; row < 4; row++ )
+		{
+			if( world == NULL )
+				m[4*col+row] = View[4*col+row];
+			else
+				m[4*col+row] =	View[4*0+row] * world[4*col+0] + View[4*1+row] * world[4*col+1] +
+						View[4*2+row] * world[4*col+2] + View[4*3+row] * world[4*col+3];
+		}
+	}
+
+	// every vertex into clip coordinates, once:
+
+	std::vector<float> clip( 4*numVertices );
+	for( int i = 0; i < numVertices; i++ )
+	{
+		const float *p = (const float *)( (const unsigned char *)xyz + i*stride );
+		for( int row = 0; row < 4; row++ )
+			clip[4*i+row] = m[row] * p[0] + m[4+row] * p[1] + m[8+row] * p[2] + m[12+row];
+	}
+
+	for( int i = 0; i + 2 < numIndices; i += 3 )
+	{
+		float tri[3][4];
+		for( int k = 0; k < 3; k++ )
+			memcpy( tri[k], &clip[ 4*indices[i+k] ], 4*sizeof(float) );
+		ClipTriangle( tri );
+	}
+	Occluders++;
+}
+
+
+void
+OcclusionCuller::AddOccluder( const struct SurfaceMesh &mesh, const float world[16] )
+{
+	if( mesh.Vertices.empty( )  ||  mesh.Indices.empty( ) )
+		return;
+	AddOccluder( &mesh.Vertices[0].x, sizeof(struct SurfaceVertex), (int)mesh.Vertices.size( ),
+		&mesh.Indices[0], (int)mesh.Indices.size( ), world );
+}
+
+
+// a triangle that is all in front of the near plane, in clip coordinates, into window coordinates:
+
+void
+OcclusionCuller::AddTriangle( const float clip[3][4] )
+{
+	OccluderTriangle t;
+	float minX = 0., maxX = 0., minY = 0., maxY = 0., minZ = 0.;
+	for( int k = 0; k < 3; k++ )
+	{
+		float w = clip[k][3];
+		if( w <= 0. )
+			return;
+		t.X[k] = ( 0.5f * clip[k][0] / w + 0.5f ) * (float)Width;
+		t.Y[k] = ( 0.5f * clip[k][1] / w + 0.5f ) * (float)Height;
+		t.Z[k] =   0.5f * clip[k][2] / w + 0.5f;
+		if( k == 0  ||  t.X[k] < minX )		minX = t.X[k];
+		if( k == 0  ||  t.X[k] > maxX )		maxX = t.X[k];
+		if( k == 0  ||  t.Y[k] < minY )		minY = t.Y[k];
+		if( k == 0  ||  t.Y[k] > maxY )		maxY = t.Y[k];
+		if( k == 0  ||  t.Z[k] < minZ )		minZ = t.Z[k];
+	}
+
+	// off the screen, past the far plane, or edge-on:
+
+	if( maxX < 0.  ||  minX > (float)Width  ||  maxY < 0.  ||  minY > (float)Height  ||  minZ > 1. )
+		return;
+	float area = ( t.X[1] - t.X[0] ) * ( t.Y[2] - t.Y[0] ) - ( t.Y[1] - t.Y[0] ) * ( t.X[2] - t.X[0] );
+	if( fabsf( area ) < 1.e-6f )
+		return;
+
+	t.MinY = (int)floorf( minY );
+	t.MaxY = (int)floorf( maxY );
+	if( t.MinY < 0 )		t.MinY = 0;
+	if( t.MaxY > Height - 1 )	t.MaxY = Height - 1;
+	Triangles.push_back( t );
+}
+
+
+// start a frame -- everything is at the far plane until the occluders are drawn:
+
+void
+OcclusionCuller::Begin( const float projection[16], const float modelview[16] )
+{
+	for( int col = 0; col < 4; col++ )
+	{
+		for( int row = 0; row < 4; row++ )
+		{
+			View[4*col+row] =	projection[4*0+row] * modelview[4*col+0] + projection[4*1+row] * modelview[4*col+1] +
+						projection[4*2+row] * modelview[4*col+2] + projection[4*3+row] * modelview[4*col+3];
+		}
+	}
+	for( int l = 0; l < (int)Levels.size( ); l++ )
+		std::fill( Levels[l].begin( ), Levels[l].end( ), 1.f );
+	Triangles.clear( );
+	Occluders = BoxesTested = BoxesHidden = 0;
+}
+
+
+// the box from bmin to bmax, placed by the world matrix (NULL = where it is):
+// returns false if the occluders hide all of it (or it is off the screen)
+// (a box that reaches in front of the near plane is always visible -- it might be right in front of the eye)
+
+bool
+OcclusionCuller::BoxVisible( const float bmin[3], const float bmax[3], const float world[16] )
+{
+	BoxesTested++;
+
+	float m[16];
+	for( int col = 0; col < 4; col++ )
+	{
+		for( int row = 0; row < 4; row++ )
+		{
+			if( world == NULL )
+				m[4*col+row] = View[4*col+row];
+			else
+				m[4*col+row] =	View[4*0+row] * world[4*col+0] + View[4*1+row] * world[4*col+1] +
+						View[4*2+row] * world[4*col+2] + View[4*3+row] * world[4*col+3];
+		}
+	}
+
+	// the rectangle the corners cover on the screen, and the closest one:
+
+	float minX = 0., maxX = 0., minY = 0., maxY = 0., minZ = 0.;
+	for( int k = 0; k < 8; k++ )
+	{
+		float p[3] = { ( k & 1 ) ? bmax[0] : bmin[0], ( k & 2 ) ? bmax[1] : bmin[1], ( k & 4 ) ? bmax[2] : bmin[2] };
+		float c[4];
+		for( int row = 0; row < 4; row++ )
+			c[row] = m[row] * p[0] + m[4+row] * p[1] + m[8+row] * p[2] + m[12+row];
+		if( c[2] < -c[3]  ||  c[3] <= 0. )
+			return true;
+
+		float x = ( 0.5f * c[0] / c[3] + 0.5f ) * (float)Width;
+		float y = ( 0.5f * c[1] / c[3] + 0.5f ) * (float)Height;
+		float z =   0.5f * c[2] / c[3] + 0.5f;
+		if( k == 0  ||  x < minX )	minX = x;
+		if( k == 0  ||  x > maxX )	maxX = x;
+		if( k == 0  ||  y < minY )	minY = y;
+		if( k == 0  ||  y > maxY )	maxY = y;
+		if( k == 0  ||  z < minZ )	minZ = z;
+	}
+	if( maxX < 0.  ||  minX >= (float)Width  ||  maxY < 0.  ||  minY >= (float)Height )
+	{
+		BoxesHidden++;
+		return false;
+	}
+
+	int x0 = minX < 0.  ?  0  :  (int)minX;
+	int x1 = maxX >= (float)Width  ?  Width - 1  :  (int)maxX;
+	int y0 = minY < 0.  ?  0  :  (int)minY;
+	int y1 = maxY >= (float)Height  ?  Height - 1  :  (int)maxY;
+
+	// go up the pyramid until the rectangle is only a few pixels across:
+
+	int level = 0;
+	while( level < (int)Levels.size( ) - 1  &&
+	       ( ( x1 >> level ) - ( x0 >> level ) >= OCCLUSION_TEST_PIXELS  ||  ( y1 >> level ) - ( y0 >> level ) >= OCCLUSION_TEST_PIXELS ) )
+		level++;
+
+	const std::vector<float> &depth = Levels[level];
+	int w = LevelWidths[level];
+	for( int y = y0 >> level; y <= y1 >> level; y++ )
+	{
+		for( int x = x0 >> level; x <= x1 >> level; x++ )
+		{
+			if( depth[ y*w + x ] >= minZ )
+				return true;			// nothing in front of the box here
+		}
+	}
+	BoxesHidden++;
+	return false;
+}
+
+
+// each level's pixel is the farthest of the (up to) 4 below it:
+
+void
+OcclusionCuller::BuildPyramid( )
+{
+	for( int l = 1; l < (int)Levels.size( ); l++ )
+	{
+		const std::vector<float> &below = Levels[l-1];
+		int bw = LevelWidths[l-1];
+		int bh = LevelHeights[l-1];
+		std::vector<float> &level = Levels[l];
+		for( int y = 0; y < LevelHeights[l]; y++ )
+		{
+			int y2 = 2*y + 1 < bh  ?  2*y + 1  :  2*y;
+			for( int x = 0; x < LevelWidths[l]; x++ )
+			{
+				int x2 = 2*x + 1 < bw  ?  2*x + 1  :  2*x;
+				float a = below[ 2*y*bw + 2*x ];
+				float b = below[ 2*y*bw + x2 ];
+				float c = below[ y2*bw + 2*x ];
+				float d = below[ y2*bw + x2 ];
+				float far1 = a > b  ?  a  :  b;
+				float far2 = c > d  ?  c  :  d;
+				level[ y*LevelWidths[l] + x ] = far1 > far2  ?  far1  :  far2;
+			}
+		}
+	}
+}
+
+
+// cut off the part of a triangle that is behind the near plane (z < -w), which leaves 0, 1, or 2 triangles:
+
+void
+OcclusionCuller::ClipTriangle( float tri[3][4] )
+{
+	float d[3];
+	int inside = 0;
+	for( int k = 0; k < 3; k++ )
+	{
+		d[k] = tri[k][2] + tri[k][3];
+		if( d[k] >= 0. )
+			inside++;
+	}
+	if( inside == 3 )
+	{
+		AddTriangle( tri );
+		return;
+	}
+	if( inside == 0 )
+		return;
+
+	float poly[4][4];
+	int n = 0;
+	for( int k = 0; k < 3; k++ )
+	{
+		int next = ( k + 1 ) % 3;
+		if( d[k] >= 0. )
+			memcpy( poly[n++], tri[k], 4*sizeof(float) );
+		if( ( d[k] >= 0. ) != ( d[next] >= 0. ) )
+		{
+			float t = d[k] / ( d[k] - d[next] );
+			for( int c = 0; c < 4; c++ )
+				poly[n][c] = tri[k][c] + t * ( tri[next][c] - tri[k][c] );
+			n++;
+		}
+	}
+
+	float fan[3][4];
+	for( int k = 1; k + 1 < n; k++ )
+	{
+		memcpy( fan[0], poly[0], 4*sizeof(float) );
+		memcpy( fan[1], poly[k], 4*sizeof(float) );
+		memcpy( fan[2], poly[k+1], 4*sizeof(float) );
+		AddTriangle( fan );
+	}
+}
+
+
+// the depth at pixel (x,y), as of the last Rasterize( ):
+
+float
+OcclusionCuller::GetDepth( int x, int y )
+{
+	if( x < 0  ||  x >= Width  ||  y < 0  ||  y >= Height )
+		return 1.;
+	return Levels[0][ y*Width + x ];
+}
+
+
+int
+OcclusionCuller::GetHeight( )
+{
+	return Height;
+}
+
+
+int
+OcclusionCuller::GetNumBoxesHidden( )
+{
+	return BoxesHidden;
+}
+
+
+int
+OcclusionCuller::GetNumBoxesTested( )
+{
+	return BoxesTested;
+}
+
+
+int
+OcclusionCuller::GetNumTriangles( )
+{
+	return (int)Triangles.size( );
+}
+
+
+int
+OcclusionCuller::GetWidth( )
+{
+	return Width;
+}
+
+
+void
+OcclusionCuller::PrintStats( FILE *fp )
+{
+	fprintf( fp, "OcclusionCuller: %d occluders, %d triangles into %dx%d in %.3f ms on %d threads ; %d of %d boxes hidden\n",
+		Occluders, GetNumTriangles( ), Width, Height, RasterMs, ThreadsUsed, BoxesHidden, BoxesTested );
+}
+
+
+// draw the occluders into the depth buffer, and build the pyramid from it:
+
+void
+OcclusionCuller::Rasterize( )
+{
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now( );
+
+	int numThreads = NumThreads;
+	if( numThreads > (int)Triangles.size( ) / OCCLUSION_MIN_TRIANGLES_PER_THREAD )
+		numThreads = (int)Triangles.size( ) / OCCLUSION_MIN_TRIANGLES_PER_THREAD;
+	if( numThreads > Height )
+		numThreads = Height;
+
+	ThreadsUsed = numThreads < 1  ?  1  :  numThreads;
+	if( numThreads <= 1 )
+	{
+		RasterizeBand( 0, Height );
+	}
+	else
+	{
+		if( Workers.empty( ) )
+		{
+			Quit.store( false );
+			for( int it = 1; it < NumThreads; it++ )
+				Workers.push_back( std::thread( &OcclusionCuller::RunWorker, this, it, Started.load( std::memory_order_relaxed ) ) );
+		}
+
+		// every worker answers, even the ones with no band this time:
+
+		Bands = numThreads;
+		Finished.store( 0, std::memory_order_relaxed );
+		Started.store( Started.load( std::memory_order_relaxed ) + 1, std::memory_order_release );
+		RasterizeBand( 0, Height / numThreads );			// this thread does the first band
+		while( Finished.load( std::memory_order_acquire ) < (int)Workers.size( ) )
+			std::this_thread::yield( );
+	}
+
+	BuildPyramid( );
+	RasterMs = std::chrono::duration<double, std::milli>( std::chrono::steady_clock::now( ) - start ).count( );
+}
+
+
+// draw every triangle's rows from firstRow to lastRow-1:
+// (each pixel keeps the closest depth -- the edge and depth equations are evaluated at the pixel centers)
+
+void
+OcclusionCuller::RasterizeBand( int firstRow, int lastRow )
+{
+	std::vector<float> &depth = Levels[0];
+	for( int i = 0; i < (int)Triangles.size( ); i++ )
+	{
+		const OccluderTriangle &t = Triangles[i];
+		int y0 = t.MinY > firstRow  ?  t.MinY  :  firstRow;
+		int y1 = t.MaxY < lastRow - 1  ?  t.MaxY  :  lastRow - 1;
+		if( y0 > y1 )
+			continue;
+
+		// counterclockwise, so the inside is where all 3 edge equations are >= 0.:
+
+		int a = 0, b = 1, c = 2;
+		if( ( t.X[1] - t.X[0] ) * ( t.Y[2] - t.Y[0] ) - ( t.Y[1] - t.Y[0] ) * ( t.X[2] - t.X[0] ) < 0. )
+		{
+			b = 2;
+			c = 1;
+		}
+		int v[3] = { a, b, c };
+		float ea[3], eb[3], ec[3];			// edge k, from v[k] to v[k+1]:  ea*x + eb*y + ec
+		for( int k = 0; k < 3; k++ )
+		{
+			int p = v[k];
+			int q = v[(k+1)%3];
+			ea[k] = t.Y[p] - t.Y[q];
+			eb[k] = t.X[q] - t.X[p];
+			ec[k] = t.X[p] * t.Y[q] - t.Y[p] * t.X[q];
+		}
+
+		// the depth is a plane too -- each vertex's weight is the edge across from it over the area:
+
+		float area = ec[0] + ec[1] + ec[2];
+		float za = ( ea[1] * t.Z[v[0]] + ea[2] * t.Z[v[1]] + ea[0] * t.Z[v[2]] ) / area;
+		float zb = ( eb[1] * t.Z[v[0]] + eb[2] * t.Z[v[1]] + eb[0] * t.Z[v[2]] ) / area;
+		float zc = ( ec[1] * t.Z[v[0]] + ec[2] * t.Z[v[1]] + ec[0] * t.Z[v[2]] ) / area;
+
+		float minX = t.X[0], maxX = t.X[0];
+		for( int k = 1; k < 3; k++ )
+		{
+			if( t.X[k] < minX )	minX = t.X[k];
+			if( t.X[k] > maxX )	maxX = t.X[k];
+		}
+		int x0 = minX < 0.  ?  0  :  ( (int)minX & ~3 );
+		int x1 = maxX >= (float)Width  ?  Width - 1  :  (int)maxX;
+
+		for( int y = y0; y <= y1; y++ )
+		{
+			float py = (float)y + 0.5f;
+			float *row = &depth[ y*Width ];
+			int x = x0;
+#ifdef OCCLUSION_SSE
+			__m128 zero = _mm_setzero_ps( );
+			__m128 four = _mm_set1_ps( 4.f );
+			__m128 px = _mm_add_ps( _mm_set1_ps( (float)x0 ), _mm_set_ps( 3.5f, 2.5f, 1.5f, 0.5f ) );
+			__m128 a0 = _mm_set1_ps( ea[0] ), r0 = _mm_set1_ps( eb[0] * py + ec[0] );
+			__m128 a1 = _mm_set1_ps( ea[1] ), r1 = _mm_set1_ps( eb[1] * py + ec[1] );
+			__m128 a2 = _mm_set1_ps( ea[2] ), r2 = _mm_set1_ps( eb[2] * py + ec[2] );
+			__m128 az = _mm_set1_ps( za ),    rz = _mm_set1_ps( zb * py + zc );
+			for( ; x <= x1; x += 4, px = _mm_add_ps( px, four ) )
+			{
+				__m128 in = _mm_and_ps( _mm_cmpge_ps( _mm_add_ps( _mm_mul_ps( a0, px ), r0 ), zero ),
+						_mm_and_ps( _mm_cmpge_ps( _mm_add_ps( _mm_mul_ps( a1, px ), r1 ), zero ),
+							    _mm_cmpge_ps( _mm_add_ps( _mm_mul_ps( a2, px ), r2 ), zero ) ) );
+				if( _mm_movemask_ps( in ) == 0 )
+					continue;
+				__m128 old = _mm_loadu_ps( &row[x] );
+				__m128 z = _mm_min_ps( old, _mm_add_ps( _mm_mul_ps( az, px ), rz ) );
+				_mm_storeu_ps( &row[x], _mm_or_ps( _mm_and_ps( in, z ), _mm_andnot_ps( in, old ) ) );
+			}
+#endif
+			for( ; x <= x1; x++ )
+			{
+				float px = (float)x + 0.5f;
+				if( ea[0]*px + eb[0]*py + ec[0] < 0.  ||  ea[1]*px + eb[1]*py + ec[1] < 0.  ||  ea[2]*px + eb[2]*py + ec[2] < 0. )
+					continue;
+				float z = za*px + zb*py + zc;
+				if( z < row[x] )
+					row[x] = z;
+			}
+		}
+	}
+}
+
+
+// worker number band (1 to NumThreads-1) -- draw that band of each Rasterize( ) after the first done, until StopWorkers( ):
+// (done is handed in, not read here, since the Rasterize( ) that started the worker may already have gone on)
+
+void
+OcclusionCuller::RunWorker( int band, int done )
+{
+	int idle = 0;
+	while( true )
+	{
+		int started = Started.load( std::memory_order_acquire );
+		if( started != done )
+		{
+			if( band < Bands )
+				RasterizeBand( Height * band / Bands, Height * (band+1) / Bands );
+			done = started;
+			Finished.fetch_add( 1, std::memory_order_release );
+			idle = 0;
+		}
+		else if( Quit.load( std::memory_order_acquire ) )
+			break;
+		else if( ++idle < OCCLUSION_SPINS )
+			std::this_thread::yield( );
+		else
+			std::this_thread::sleep_for( std::chrono::microseconds( OCCLUSION_SLEEP_US ) );
+	}
+}
+
+
+void
+OcclusionCuller::StopWorkers( )
+{
+	Quit.store( true, std::memory_order_release );
+	for( int it = 0; it < (int)Workers.size( ); it++ )
+		Workers[it].join( );
+	Workers.clear( );
+}
+
+
+// how many threads Rasterize( ) may use (it uses fewer when there are not many triangles):
+
+void
+OcclusionCuller::SetThreads( int n )
+{
+	n = n < 1  ?  1  :  n;
+	if( n != NumThreads )
+		StopWorkers( );				// the next Rasterize( ) starts as many as it needs now
+	NumThreads = n;
+}
+
+#endif		// #ifndef OCCLUSION_CPP
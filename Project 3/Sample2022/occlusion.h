@@ -0,0 +1,102 @@
+#ifndef OCCLUSION_H
+#define OCCLUSION_H
+
+#include <stdio.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "osusurface.cpp"
+
+#if defined(__SSE2__)  ||  defined(_M_X64)  ||  ( defined(_M_IX86_FP)  &&  _M_IX86_FP >= 2 )
+#define OCCLUSION_SSE
+#include <emmintrin.h>
+#endif
+
+
+// software occlusion culling -- the frustum culler keeps what is behind the camera from being
+// drawn, this keeps what is behind other objects from being drawn:
+//
+//	a few big, close objects (the occluders) are drawn on the cpu into a small depth buffer
+//	(256x128 unless told otherwise), then every other object's bounding box is checked against it
+//	-- if every pixel the box covers already has something closer than the box's closest corner,
+//	the object cannot be seen
+//	nothing is read back from the gpu, so it works (and can be checked) without a window
+//
+//	the depth buffer is split into bands of rows, one per thread, and each thread draws every
+//	occluder triangle that touches its band -- the bands do not overlap, so the threads never
+//	wait on each other -- with 4 pixels at a time in SSE2 when the compiler has it
+//	the threads are started the first time they are needed and then kept, waiting for the next
+//	Rasterize( ) -- it hands them their bands the way FrameWorker hands its worker a frame, with
+//	two atomic counters, so nothing is created, joined, or locked in a frame
+//	then a hierarchical-Z pyramid is built from it: each level is half the size of the one below,
+//	and each of its pixels is the farthest of the 4 under it, so a box is tested against a few
+//	pixels of whichever level it covers only 2 or 3 of, instead of every pixel it covers
+//
+//	depths are gl window depths, 0. (near) to 1. (far)
+//	an occluder only hides something if it really covers it, so occluders must be solid (a cat, a
+//	wall), not something that can be seen through (a fence, a tree's leaves)
+//
+//	use:
+//		OcclusionCuller Occlusion;			// or ( width, height )
+//		...
+//		Occlusion.Begin( projection, modelview );	// column-major, like glGetFloatv( ) gives
+//		Occlusion.AddOccluder( CatSurface, world );	// a few times
+//		Occlusion.Rasterize( );
+//		if( Occlusion.BoxVisible( bmin, bmax, world ) )	// for everything else
+//			...draw it...
+
+class OcclusionCuller
+{
+  private:
+	struct OccluderTriangle
+	{
+		float		X[3], Y[3];		// in pixels
+		float		Z[3];			// 0. - 1.
+		int		MinY, MaxY;		// rows it touches
+	};
+
+	int				Width, Height;		// Width is a multiple of 4
+	float				View[16];		// projection * modelview
+	std::vector< std::vector<float> >	Levels;		// the hierarchical-Z pyramid -- Levels[0] is the
+								// depth buffer itself, row 0 at the bottom
+	std::vector<int>		LevelWidths, LevelHeights;
+	std::vector<OccluderTriangle>	Triangles;
+	int				NumThreads;		// the most Rasterize( ) may use
+	std::vector<std::thread>	Workers;		// NumThreads-1 of them, once they have been needed
+	std::atomic<int>		Started;		// Rasterize( )s handed to the workers -- only it writes this
+	std::atomic<int>		Finished;		// workers done with this one's bands -- only they add to it
+	std::atomic<bool>		Quit;
+	int				Bands;			// how many bands this Rasterize( ) is split into
+
+	int	Occluders, BoxesTested, BoxesHidden;
+	int	ThreadsUsed;			// by the last Rasterize( )
+	double	RasterMs;
+
+	void	AddTriangle( const float [3][4] );
+	void	BuildPyramid( );
+	void	ClipTriangle( float [3][4] );
+	void	RasterizeBand( int, int );
+	void	RunWorker( int, int );
+	void	StopWorkers( );
+
+  public:
+		OcclusionCuller( int = 256, int = 128 );
+		~OcclusionCuller( );
+
+	void	AddOccluder( const float *, size_t, int, const GLuint *, int, const float [16] );
+	void	AddOccluder( const struct SurfaceMesh &, const float [16] );
+	void	Begin( const float [16], const float [16] );
+	bool	BoxVisible( const float [3], const float [3], const float [16] = NULL );
+	float	GetDepth( int, int );
+	int	GetHeight( );
+	int	GetNumBoxesHidden( );
+	int	GetNumBoxesTested( );
+	int	GetNumTriangles( );
+	int	GetWidth( );
+	void	PrintStats( FILE * );
+	void	Rasterize( );
+	void	SetThreads( int );
+};
+
+#endif		// #ifndef OCCLUSION_H
@@ -0,0 +1,298 @@
+#include "renderqueue.h"
+
+#include <algorithm>
+
+
+// the key's fields, from the top bit down:
+
+const int QUEUE_PROGRAM_SHIFT  = 40;		// 24 bits
+const int QUEUE_TEXTURE_SHIFT  = 16;		// 24 bits
+const int QUEUE_MATERIAL_SHIFT =  0;		// 16 bits
+
+
+RenderQueue::RenderQueue( )
+{
+	ProgramBinds = ProgramBindsAvoided = 0;
+	TextureBinds = TextureBindsAvoided = 0;
+	MaterialBinds = MaterialBindsAvoided = 0;
+	Culling = true;
+	NumCulled = 0;
+}
+
+
+// materials are set with SetMaterial( ), so they are given the same way:
+
+int
+RenderQueue::AddMaterial( float r, float g, float b, float shininess )
+{
+	QueueMaterial m;
+	m.R = r;
+	m.G = g;
+	m.B = b;
+	m.Shininess = shininess;
+	Materials.push_back( m );
+	return (int)Materials.size( ) - 1;
+}
+
+
+void
+RenderQueue::Begin( )
+{
+	Packets.clear( );
+}
+
+
+int
+RenderQueue::ProgramId( GLSLProgram *program )
+{
+	if( program == NULL )
+		return 0;
+
+	for( int i = 0; i < (int)Programs.size( ); i++ )
+	{
+		if( Programs[i] == program )
+			return i + 1;
+	}
+	Programs.push_back( program );
+	return (int)Programs.size( );
+}
+
+
+// the transform is whatever the modelview matrix is right now:
+
+void
+RenderQueue::Submit( Mesh *geometry, GLSLProgram *program, GLuint texture, int material )
+{
+	if( geometry == NULL )
+		return;
+	if( material < QUEUE_NO_MATERIAL  ||  material >= (int)Materials.size( ) )
+	{
+		fprintf( stderr, "RenderQueue::Submit: there is no material %d\n", material );
+		material = QUEUE_NO_MATERIAL;
+	}
+
+	DrawPacket p;
+	p.Geometry = geometry;
+	p.Program = program;
+	p.Texture = texture;
+	p.Material = material;
+	Pipeline.GetFloatv( GL_MODELVIEW_MATRIX, p.Transform );
+
+	p.Key  = (unsigned long long)( ProgramId( program ) & 0xffffff ) << QUEUE_PROGRAM_SHIFT;
+	p.Key |= (unsigned long long)( texture & 0xffffff )               << QUEUE_TEXTURE_SHIFT;
+	p.Key |= (unsigned long long)( ( material + 1 ) & 0xffff )         << QUEUE_MATERIAL_SHIFT;
+	Packets.push_back( p );
+}
+
+
+// put the packets that are in view into Order:
+
+void
+RenderQueue::Cull( )
+{
+	int n = (int)Packets.size( );
+	Order.clear( );
+	NumCulled = 0;
+	if( ! Culling )
+	{
+		for( int i = 0; i < n; i++ )
+			Order.push_back( i );
+		return;
+	}
+
+	float projection[16];
+	Pipeline.GetFloatv( GL_PROJECTION_MATRIX, projection );
+	View.FromMatrix( projection );
+
+	// each mesh's sphere, in eye coordinates -- the radius grows by the biggest scale in the transform:
+
+	CullX.resize( n );
+	CullY.resize( n );
+	CullZ.resize( n );
+	CullR.resize( n );
+	CullVisible.resize( n );
+	for( int i = 0; i < n; i++ )
+	{
+		const float *m = Packets[i].Transform;
+		float c[3], r;
+		Packets[i].Geometry->GetBoundingSphere( c, &r );
+		CullX[i] = m[0]*c[0] + m[4]*c[1] + m[ 8]*c[2] + m[12];
+		CullY[i] = m[1]*c[0] + m[5]*c[1] + m[ 9]*c[2] + m[13];
+		CullZ[i] = m[2]*c[0] + m[6]*c[1] + m[10]*c[2] + m[14];
+		float scale = 0.;
+		for( int k = 0; k < 3; k++ )
+		{
+			float s = m[4*k+0]*m[4*k+0] + m[4*k+1]*m[4*k+1] + m[4*k+2]*m[4*k+2];
+			if( s > scale )
+				scale = s;
+		}
+		CullR[i] = r * sqrtf( scale );
+	}
+
+	View.SpheresVisible( n, &CullX[0], &CullY[0], &CullZ[0], &CullR[0], &CullVisible[0] );
+	for( int i = 0; i < n; i++ )
+	{
+		if( CullVisible[i] )
+			Order.push_back( i );
+		else
+			NumCulled++;
+	}
+}
+
+
+// sort, draw, and empty the queue:
+
+void
+RenderQueue::Flush( )
+{
+	ProgramBinds = ProgramBindsAvoided = 0;
+	TextureBinds = TextureBindsAvoided = 0;
+	MaterialBinds = MaterialBindsAvoided = 0;
+	Order.clear( );
+	NumCulled = 0;
+	if( Packets.empty( ) )
+		return;
+
+	Cull( );
+
+	// a stable sort keeps packets with the same key in the order they were submitted:
+
+	std::stable_sort( Order.begin( ), Order.end( ),
+		[this]( int a, int b ) { return Packets[a].Key < Packets[b].Key; } );
+
+	// nothing is known about what is bound when the first packet is drawn:
+
+	bool first = true;
+	GLSLProgram *nowProgram = NULL;
+	GLuint nowTexture = 0;
+	int nowMaterial = QUEUE_NO_MATERIAL;
+
+	Pipeline.MatrixMode( GL_MODELVIEW );
+	Pipeline.PushMatrix( );
+	for( int i = 0; i < (int)Order.size( ); i++ )
+	{
+		DrawPacket &p = Packets[ Order[i] ];
+
+		if( first  ||  p.Program != nowProgram )
+		{
+			if( p.Program != NULL )
+				p.Program->Use( );
+			else
+				FixedFunction.UseFixedFunction( );
+			nowProgram = p.Program;
+			ProgramBinds++;
+		}
+		else
+			ProgramBindsAvoided++;
+
+		if( first  ||  p.Texture != nowTexture )
+		{
+			Pipeline.BindTexture( GL_TEXTURE_2D, p.Texture );
+			nowTexture = p.Texture;
+			TextureBinds++;
+		}
+		else
+			TextureBindsAvoided++;
+
+		if( p.Material != QUEUE_NO_MATERIAL )
+		{
+			if( first  ||  p.Material != nowMaterial )
+			{
+				QueueMaterial &m = Materials[ p.Material ];
+				SetMaterial( m.R, m.G, m.B, m.Shininess );
+				nowMaterial = p.Material;
+				MaterialBinds++;
+			}
+			else
+				MaterialBindsAvoided++;
+		}
+
+		first = false;
+		// the fixed-function packets go through the pipeline, which draws them with its
+		// own shader when it is the core one:
+
+		Pipeline.LoadMatrix( p.Transform );
+		if( p.Program != NULL )
+			p.Geometry->Draw( );
+		else
+			Pipeline.Draw( p.Geometry );
+	}
+	Pipeline.PopMatrix( );
+
+	Packets.clear( );
+}
+
+
+int
+RenderQueue::GetNumCulled( )
+{
+	return NumCulled;
+}
+
+
+// the number that were drawn:
+
+int
+RenderQueue::GetNumPackets( )
+{
+	return (int)Order.size( );
+}
+
+
+int
+RenderQueue::GetProgramBinds( )
+{
+	return ProgramBinds;
+}
+
+
+int
+RenderQueue::GetProgramBindsAvoided( )
+{
+	return ProgramBindsAvoided;
+}
+
+
+int
+RenderQueue::GetTextureBinds( )
+{
+	return TextureBinds;
+}
+
+
+int
+RenderQueue::GetTextureBindsAvoided( )
+{
+	return TextureBindsAvoided;
+}
+
+
+int
+RenderQueue::GetMaterialBinds( )
+{
+	return MaterialBinds;
+}
+
+
+int
+RenderQueue::GetMaterialBindsAvoided( )
+{
+	return MaterialBindsAvoided;
+}
+
+
+// what the last Flush( ) did:
+
+void
+RenderQueue::PrintStats( FILE *fp )
+{
+	fprintf( fp, "RenderQueue: %d packets, %d culled -- programs %d bound, %d avoided ; textures %d bound, %d avoided ; materials %d set, %d avoided\n",
+		GetNumPackets( ), NumCulled, ProgramBinds, ProgramBindsAvoided, TextureBinds, TextureBindsAvoided, MaterialBinds, MaterialBindsAvoided );
+}
+
+
+void
+RenderQueue::SetCulling( bool culling )
+{
+	Culling = culling;
+}
@@ -0,0 +1,110 @@
+#ifndef RENDERQUEUE_H
+#define RENDERQUEUE_H
+
+#include <stdio.h>
+#include <vector>
+
+#include "glew.h"
+#include <GL/gl.h>
+
+#include "glslprogram.h"
+#include "frustum.cpp"
+#include "glstate.cpp"
+#include "mesh.cpp"
+#include "pipeline.cpp"
+
+
+// from setmaterial.cpp, which the sample includes:
+
+void	SetMaterial( float, float, float, float );
+
+
+// a render queue -- instead of drawing objects in the order the code happens to list them,
+// Display( ) submits them, and Flush( ) sorts and draws them:
+//
+//	each packet is a mesh, the program, texture, and material to draw it with, and the
+//	modelview matrix that was current (in Pipeline) when it was submitted
+//	the packets are sorted by a 64-bit key with the program in the top bits, then the texture,
+//	then the material, so everything that shares a program is drawn together, and within that
+//	everything that shares a texture, etc.
+//	Flush( ) then only binds a program, texture, or material when it is different from the last one
+//	(textures are bound through GLState, so the first one is skipped too if it is already bound)
+//
+//	before sorting, Flush( ) throws away the packets whose mesh's bounding sphere (moved by the
+//	packet's transform) is outside the view frustum -- the spheres are tested 4 at a time with
+//	Frustum::SpheresVisible( ) against the planes of the projection matrix alone, since the
+//	transforms already take the spheres into eye coordinates
+//	SetCulling( false ) draws everything, to compare against
+//
+//	use:
+//		int red = Queue.AddMaterial( 1., 0., 0., 30. );		// once
+//		...
+//		Queue.Begin( );
+//		Pipeline.PushMatrix( );
+//			Pipeline.Translate( ... );
+//			Queue.Submit( &Cat, NULL, CatTex, red );	// NULL = whichever Pipeline is on
+//		Pipeline.PopMatrix( );
+//		...
+//		Queue.Flush( );
+
+const int QUEUE_NO_MATERIAL = -1;		// leave the material alone
+const GLuint QUEUE_NO_TEXTURE = 0;
+
+struct DrawPacket
+{
+	unsigned long long	Key;
+	Mesh *			Geometry;
+	GLSLProgram *		Program;
+	GLuint			Texture;
+	int			Material;
+	float			Transform[16];
+};
+
+class RenderQueue
+{
+  private:
+	struct QueueMaterial
+	{
+		float		R, G, B;
+		float		Shininess;
+	};
+
+	std::vector<DrawPacket>		Packets;
+	std::vector<int>		Order;			// packets in sorted order
+	std::vector<QueueMaterial>	Materials;
+	std::vector<GLSLProgram *>	Programs;		// to turn a program into a small number for the key
+	GLSLProgram			FixedFunction;		// only used to get back to program 0
+
+	bool				Culling;
+	Frustum				View;			// in eye coordinates
+	std::vector<float>		CullX, CullY, CullZ, CullR;	// each packet's bounding sphere
+	std::vector<unsigned char>	CullVisible;
+	int				NumCulled;
+
+	int	ProgramBinds, ProgramBindsAvoided;
+	int	TextureBinds, TextureBindsAvoided;
+	int	MaterialBinds, MaterialBindsAvoided;
+
+	void	Cull( );
+	int	ProgramId( GLSLProgram * );
+
+  public:
+		RenderQueue( );
+
+	int	AddMaterial( float, float, float, float );
+	void	Begin( );
+	void	Flush( );
+	int	GetNumCulled( );
+	int	GetNumPackets( );
+	int	GetProgramBinds( );
+	int	GetProgramBindsAvoided( );
+	int	GetTextureBinds( );
+	int	GetTextureBindsAvoided( );
+	int	GetMaterialBinds( );
+	int	GetMaterialBindsAvoided( );
+	void	PrintStats( FILE * );
+	void	SetCulling( bool );
+	void	Submit( Mesh *, GLSLProgram *, GLuint, int );
+};
+
+#endif		// #ifndef RENDERQUEUE_H
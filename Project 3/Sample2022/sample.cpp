@@ -104,6 +104,24 @@ enum ButtonVals
 	QUIT
 };
 
+// the crowd of cats and ducks behind the floor -- the rows go back far enough that, from the
+// starting view, most of the crowd is hidden behind the first few rows:
+
+enum CrowdChoices
+{
+	CROWD_OFF,
+	CROWD_ON,
+	CROWD_OCCLUDED			// on, with the ones that are hidden behind others culled
+};
+
+const int	CROWD_ROWS      = 40;
+const int	CROWD_COLUMNS   = 8;
+const float	CROWD_SPACING   = 0.2f;
+const float	CROWD_Y         = -0.19f;	// so the eye is level with the middles of the cats
+const float	CROWD_Z         = -1.2f;	// the first row
+const int	CROWD_OCCLUDER_TRIANGLES = 160000;	// the members that cover the most of the screen are drawn
+						// into the occlusion buffer, until this many triangles
+
 // window background color (rgba):
 
 const GLfloat BACKCOLOR[ ] = { 0., 0., 0., 1. };
@@ -195,6 +213,7 @@ int		DepthCueOn;				// != 0 means to use intensity depth cueing
 int		DepthBufferOn;			// != 0 means to use the z-buffer
 int		DepthFightingOn;		// != 0 means to force the creation of z-fighting
 int		MainWindow;				// window id for main graphics window
+int		NowCrowd;				// CROWD_OFF, CROWD_ON, or CROWD_OCCLUDED
 int		NowColor;				// index into Colors[ ]
 int		NowProjection;		// ORTHO or PERSP
 float	Scale;					// scaling factor
@@ -210,6 +229,7 @@ void	Animate( );
 void	Display( );
 void	DoAxesMenu( int );
 void	DoColorMenu( int );
+void	DoCrowdMenu( int );
 void	DoDepthBufferMenu( int );
 void	DoDepthFightingMenu( int );
 void	DoDepthMenu( int );
@@ -227,6 +247,7 @@ void	MouseButton( int, int, int, int );
 void	MouseMotion( int, int );
 void	Reset( );
 void	Resize( int, int );
+void	SubmitCrowd( );
 void	Visibility( int );
 
 void			Axes( float );
@@ -236,12 +257,9 @@ float			Dot(float [3], float [3]);
 float			Unit(float [3], float [3]);
 float			Unit(float [3]);
 
-int		catDL;
-int		duckDL;
-int		bunnyDL;
-int		GridDL;
 int		colorNum;
 int		lightType;
+int		terrainOn;			// != 0 means to draw the terrain instead of the flat floor
 
 
 
@@ -298,8 +316,33 @@ MulArray3(float factor, float a, float b, float c )
 #include "loadobjfile.cpp"
 #include "keytime.cpp"
 #include "glslprogram.cpp"
+#include "grid.cpp"
+#include "terrain.cpp"
+#include "mesh.cpp"
+#include "renderqueue.cpp"
+#include "occlusion.cpp"
 #include "CarouselHorse0.10.550"
 
+Grid		Floor;				// the floor
+Terrain		Ground;				// the hilly floor
+Mesh		CatMesh, BunnyMesh, DuckMesh;	// the obj files
+RenderQueue	Queue;				// the obj files, sorted by material
+int		RedMaterial, GreenMaterial, BlueMaterial;
+
+// the crowd -- every member is a cat or a duck, placed by its own world matrix:
+
+struct CrowdMember
+{
+	Mesh *			Geometry;
+	struct SurfaceMesh *	Surface;		// the same triangles, for the occlusion buffer
+	int			Material;
+	float			World[16];
+};
+
+struct SurfaceMesh		CatSurface, DuckSurface;
+std::vector<CrowdMember>	Crowd;
+OcclusionCuller			Occlusion;
+
 
 // main program:
 
@@ -469,7 +512,15 @@ Display( )
 
 	//glCallList( BoxList );
 
-	glCallList( GridDL );
+	SetMaterial( 0.6f, 0.6f, 0.6f, 30.f );
+	if( terrainOn )
+	{
+		Ground.Draw( );
+		if( DebugOn != 0 )
+			Ground.PrintStats( stderr );
+	}
+	else
+		Floor.Draw( );
 
 	// Objects
 
@@ -480,24 +531,34 @@ Display( )
 	float x = radius * cos(45 * Time);
 	float z = radius * sin(45 * Time);
 
+	// the objects go through the render queue, which sets each material only once:
+
+	Queue.Begin( );
+
 	glPushMatrix();
 	glTranslatef(0., 0., 0.4f);
-	SetMaterial(1.0f, 0., 0., 0.);
-	glCallList(catDL);
+	glScalef(0.1, 0.1, 0.1);
+	Queue.Submit( &CatMesh, NULL, QUEUE_NO_TEXTURE, RedMaterial );
 	glPopMatrix();
 
 	glPushMatrix();
 	glTranslatef(0., 0., -0.4f);
-	SetMaterial(0.f, 1.f, 0., 64.);
-	glCallList(bunnyDL);
+	Queue.Submit( &BunnyMesh, NULL, QUEUE_NO_TEXTURE, GreenMaterial );
 	glPopMatrix();
 
 	glPushMatrix();
 	glTranslatef(0.4f, 0., 0.);
-	SetMaterial(0.f, 0., 1.f, 128.);
-	glCallList(duckDL);
+	glScalef(0.1, 0.1, 0.1);
+	Queue.Submit( &DuckMesh, NULL, QUEUE_NO_TEXTURE, BlueMaterial );
 	glPopMatrix();
 
+	if( NowCrowd != CROWD_OFF )
+		SubmitCrowd( );
+
+	Queue.Flush( );
+	if( DebugOn != 0 )
+		Queue.PrintStats( stderr );
+
 
 	float r = 0.;
 	float g = 0.;
@@ -628,6 +689,16 @@ DoColorMenu( int id )
 }
 
 
+void
+DoCrowdMenu( int id )
+{
+	NowCrowd = id;
+
+	glutSetWindow( MainWindow );
+	glutPostRedisplay( );
+}
+
+
 void
 DoDebugMenu( int id )
 {
@@ -797,6 +868,11 @@ InitMenus( )
 	glutAddMenuEntry( "Orthographic",  ORTHO );
 	glutAddMenuEntry( "Perspective",   PERSP );
 
+	int crowdmenu = glutCreateMenu( DoCrowdMenu );
+	glutAddMenuEntry( "Off",				CROWD_OFF );
+	glutAddMenuEntry( "On",					CROWD_ON );
+	glutAddMenuEntry( "On, with Occlusion Culling",		CROWD_OCCLUDED );
+
 	int mainmenu = glutCreateMenu( DoMainMenu );
 	glutAddSubMenu(   "Axes",          axesmenu);
 	glutAddSubMenu(   "Axis Colors",   colormenu);
@@ -811,6 +887,7 @@ InitMenus( )
 
 	glutAddSubMenu(   "Depth Cue",     depthcuemenu);
 	glutAddSubMenu(   "Projection",    projmenu );
+	glutAddSubMenu(   "Crowd",         crowdmenu );
 	glutAddMenuEntry( "Reset",         RESET );
 	glutAddSubMenu(   "Debug",         debugmenu);
 	glutAddMenuEntry( "Quit",          QUIT );
@@ -900,8 +977,8 @@ InitGraphics( )
 	glutIdleFunc( Animate );
 
 	// init the glew package (a window must be open to do this):
+	// (on every platform -- the grid, terrain and mesh buffers come through glew's entry points)
 
-#ifdef WIN32
 	GLenum err = glewInit( );
 	if( err != GLEW_OK )
 	{
@@ -910,7 +987,6 @@ InitGraphics( )
 	else
 		fprintf( stderr, "GLEW initialized OK\n" );
 	fprintf( stderr, "Status: Using GLEW %s\n", glewGetString(GLEW_VERSION));
-#endif
 
 	// all other setups go here, such as GLSLProgram and KeyTime setups:
 
@@ -945,50 +1021,71 @@ InitLists( )
 
 	// Create the objects:
 
-	catDL = glGenLists(1);
-	glNewList(catDL, GL_COMPILE);
-	glPushMatrix();
-	glScalef(0.1, 0.1, 0.1);
-	glColor3f(0, 0, 1);
-	LoadObjFile((char*)"Obj_cat.obj");
-	glPopMatrix();
-	glEndList();
+	// (the cat and the duck are kept on the cpu too, to be occluders for the crowd)
 
-	bunnyDL = glGenLists(1);
-	glNewList(bunnyDL, GL_COMPILE);
-	glPushMatrix();
-	glColor3f(0, 1, 0);
-	LoadObjFile((char*)"Obj_bunny.obj");
-	glPopMatrix();
-	glEndList();
+	struct SurfaceMesh obj;
 
-	duckDL = glGenLists(1);
-	glNewList(duckDL, GL_COMPILE);
-	glPushMatrix();
-	glScalef(0.1, 0.1, 0.1);
-	glColor3f(1, 0, 0);
-	LoadObjFile((char*)"Obj_ducky.obj");
-	glPopMatrix();
-	glEndList();
-	
-	// Create the grid:
+	LoadObjFile((char*)"Obj_cat.obj", &CatSurface);
+	CatMesh.AddSurface( CatSurface );
+	CatMesh.Upload( );
+
+	LoadObjFile((char*)"Obj_bunny.obj", &obj);
+	BunnyMesh.AddSurface( obj );
+	BunnyMesh.Upload( );
+
+	LoadObjFile((char*)"Obj_ducky.obj", &DuckSurface);
+	DuckMesh.AddSurface( DuckSurface );
+	DuckMesh.Upload( );
+
+	if( DebugOn != 0 )
+		fprintf( stderr, "Meshes use %zu bytes of buffer memory\n", Mesh::GetTotalGpuBytes( ) );
+
+	RedMaterial   = Queue.AddMaterial( 1.f, 0.f, 0.f,   0.f );
+	GreenMaterial = Queue.AddMaterial( 0.f, 1.f, 0.f,  64.f );
+	BlueMaterial  = Queue.AddMaterial( 0.f, 0.f, 1.f, 128.f );
+
+	// the crowd stands in rows behind the floor, each member turned a different way:
 
-	GridDL = glGenLists(1);
-	glNewList(GridDL, GL_COMPILE);
-	SetMaterial(0.6f, 0.6f, 0.6f, 30.f);
-	glNormal3f(0., 1., 0.);
-	for (int i = 0; i < NZ; i++)
+	Crowd.clear( );
+	for( int row = 0; row < CROWD_ROWS; row++ )
 	{
-		glBegin(GL_QUAD_STRIP);
-		for (int j = 0; j < NX; j++)
+		for( int col = 0; col < CROWD_COLUMNS; col++ )
 		{
-			// YGRID = 0
-			glVertex3f(X0 + DX * (float)j, 0, Z0 + DZ * (float)(i + 0));
-			glVertex3f(X0 + DX * (float)j, 0, Z0 + DZ * (float)(i + 1));
+			CrowdMember m;
+			bool cat = ( row + col ) % 2 == 0;
+			m.Geometry = cat  ?  &CatMesh  :  &DuckMesh;
+			m.Surface  = cat  ?  &CatSurface  :  &DuckSurface;
+			m.Material = cat  ?  RedMaterial  :  BlueMaterial;
+
+			float angle = (float)( 37 * ( row*CROWD_COLUMNS + col ) ) * F_PI / 180.f;
+			float c = 0.1f * cosf( angle );
+			float s = 0.1f * sinf( angle );
+			float world[16] =
+			{
+				   c,  0.,   -s,  0.,
+				  0., 0.1f,  0.,  0.,
+				   s,  0.,    c,  0.,
+				-0.5f * CROWD_SPACING * (float)( CROWD_COLUMNS - 1 ) + CROWD_SPACING * (float)col,
+				CROWD_Y,
+				CROWD_Z - CROWD_SPACING * (float)row,
+				  1.
+			};
+			memcpy( m.World, world, sizeof(world) );
+			Crowd.push_back( m );
 		}
-		glEnd();
 	}
-	glEndList();
+	
+	// Create the grid:
+
+	// (the grid is tiled and drawn by the vertex shader, so it does not need a display list)
+
+	Floor.Init( X0, Z0, XSIDE, ZSIDE, NX, NZ );
+
+	// the terrain covers the same square as the floor, with hills a tenth as tall ('t' switches to it):
+
+	Ground.GenerateHeightMap( 513, 6 );
+	Ground.Init( X0, Z0, XSIDE, 0.1f * XSIDE, 6 );
+	terrainOn = 0;
 
 	// create the axes:
 
@@ -1043,6 +1140,10 @@ Keyboard( unsigned char c, int x, int y )
 		case 'O':
 			NowProjection = ORTHO;
 			break;
+		case 't':
+		case 'T':
+			terrainOn = ! terrainOn;
+			break;
 
 		case 'q':
 		case 'Q':
@@ -1172,6 +1273,7 @@ Reset( )
 	ShadowsOn = 0;
 	NowColor = YELLOW;
 	NowProjection = PERSP;
+	NowCrowd = CROWD_OFF;
 	Xrot = Yrot = 0.;
 }
 
@@ -1189,6 +1291,79 @@ Resize( int width, int height )
 }
 
 
+// put the crowd into the render queue -- with occlusion culling on, the members that cover the
+// most of the screen are drawn into the occlusion buffer first, and the members whose boxes are
+// hidden behind them are left out:
+// (the budget is in triangles, not members -- a cat covers more than a duck with a fifth of the
+// triangles, so the buffer gets more members, with fewer gaps between them for the ones behind to
+// show through)
+
+void
+SubmitCrowd( )
+{
+	float projection[16], modelview[16];
+	glGetFloatv( GL_PROJECTION_MATRIX, projection );
+	glGetFloatv( GL_MODELVIEW_MATRIX, modelview );
+
+	bool occlusion = NowCrowd == CROWD_OCCLUDED;
+	std::vector<bool> occluder( Crowd.size( ), false );
+	if( occlusion )
+	{
+		// how much of the screen each member's bounding sphere covers:
+		// (its radius over its distance in front of the eye, squared -- the world matrices only scale evenly --
+		// and negated, so the biggest sort first)
+
+		std::vector< std::pair<float,int> > scores;
+		for( int i = 0; i < (int)Crowd.size( ); i++ )
+		{
+			const float *w = Crowd[i].World;
+			float c[3], r;
+			Crowd[i].Geometry->GetBoundingSphere( c, &r );
+			r *= sqrtf( w[0]*w[0] + w[1]*w[1] + w[2]*w[2] );
+			float wc[3];
+			for( int k = 0; k < 3; k++ )
+				wc[k] = w[k]*c[0] + w[4+k]*c[1] + w[8+k]*c[2] + w[12+k];
+			float ez = modelview[2]*wc[0] + modelview[6]*wc[1] + modelview[10]*wc[2] + modelview[14];
+			if( -ez > r )
+				scores.push_back( std::make_pair( -( r*r ) / ( ez*ez ), i ) );
+		}
+		std::sort( scores.begin( ), scores.end( ) );
+
+		Occlusion.Begin( projection, modelview );
+		int triangles = 0;
+		for( int k = 0; k < (int)scores.size( ); k++ )
+		{
+			CrowdMember &m = Crowd[ scores[k].second ];
+			if( triangles + m.Geometry->GetNumTriangles( ) > CROWD_OCCLUDER_TRIANGLES )
+				continue;
+			triangles += m.Geometry->GetNumTriangles( );
+			Occlusion.AddOccluder( *m.Surface, m.World );
+			occluder[ scores[k].second ] = true;
+		}
+		Occlusion.Rasterize( );
+	}
+
+	for( int i = 0; i < (int)Crowd.size( ); i++ )
+	{
+		CrowdMember &m = Crowd[i];
+		if( occlusion  &&  ! occluder[i] )
+		{
+			float bmin[3], bmax[3];
+			m.Geometry->GetBoundingBox( bmin, bmax );
+			if( ! Occlusion.BoxVisible( bmin, bmax, m.World ) )
+				continue;
+		}
+		glPushMatrix( );
+			glMultMatrixf( m.World );
+			Queue.Submit( m.Geometry, NULL, QUEUE_NO_TEXTURE, m.Material );
+		glPopMatrix( );
+	}
+
+	if( occlusion  &&  DebugOn != 0 )
+		Occlusion.PrintStats( stderr );
+}
+
+
 // handle a change to the window's visibility:
 
 void
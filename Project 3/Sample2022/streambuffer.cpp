@@ -0,0 +1,213 @@
+#ifndef STREAMBUFFER_CPP
+#define STREAMBUFFER_CPP
+
+#include "streambuffer.h"
+#include "gldebug.cpp"
+
+#include <string.h>
+#include <chrono>
+
+
+StreamBuffer::StreamBuffer( )
+{
+	Target = GL_ARRAY_BUFFER;
+	Buffer = 0;
+	Name = "StreamBuffer";
+	Mapped = NULL;
+	RegionSize = 0;
+	Alignment = 16;
+	NowRegion = 0;
+	Used = Flushed = 0;
+	for( int i = 0; i < STREAM_FRAMES; i++ )
+		Fences[i] = 0;
+	Frames = Stalls = Overflows = 0;
+	StallMs = 0.;
+	MostUsed = 0;
+}
+
+
+// STREAM_FRAMES regions of bytesPerFrame each, with everything handed out on alignment-byte boundaries:
+// (doing it again, between frames, makes a new buffer of the new size -- that is the only time storage is ever allocated)
+
+void
+StreamBuffer::Init( GLenum target, GLsizeiptr bytesPerFrame, GLint alignment, const char *name )
+{
+	if( Buffer != 0 )
+	{
+		for( int i = 0; i < STREAM_FRAMES; i++ )
+		{
+			if( Fences[i] != 0 )
+				glDeleteSync( Fences[i] );
+			Fences[i] = 0;
+		}
+		glDeleteBuffers( 1, &Buffer );		// unmaps it too
+		Buffer = 0;
+		Mapped = NULL;
+	}
+
+	Target = target;
+	Name = name;
+	Alignment = alignment < 1  ?  1  :  alignment;
+	RegionSize = ( ( bytesPerFrame + Alignment - 1 ) / Alignment ) * Alignment;
+	GLsizeiptr total = RegionSize * STREAM_FRAMES;
+	NowRegion = 0;
+	Used = Flushed = 0;
+
+	glGenBuffers( 1, &Buffer );
+	glBindBuffer( Target, Buffer );
+	GLDEBUG_LABEL( GL_BUFFER, Buffer, Name );
+	if( glBufferStorage != NULL )
+	{
+		GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		glBufferStorage( Target, total, NULL, flags );
+		Mapped = (GLubyte *) glMapBufferRange( Target, 0, total, flags );
+	}
+	if( Mapped == NULL )
+	{
+		glBufferData( Target, total, NULL, GL_STREAM_DRAW );
+		Staging.resize( RegionSize );
+	}
+	else
+		Staging.clear( );
+	glBindBuffer( Target, 0 );
+}
+
+
+// wait until the gpu is done with the region this frame is going to write over:
+
+void
+StreamBuffer::BeginFrame( )
+{
+	GLsync fence = Fences[NowRegion];
+	if( fence != 0 )
+	{
+		if( glClientWaitSync( fence, 0, 0 ) == GL_TIMEOUT_EXPIRED )
+		{
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now( );
+			Stalls++;
+			while( glClientWaitSync( fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000 ) == GL_TIMEOUT_EXPIRED )
+				;
+			StallMs += std::chrono::duration<double, std::milli>( std::chrono::steady_clock::now( ) - start ).count( );
+		}
+		glDeleteSync( fence );
+		Fences[NowRegion] = 0;
+	}
+	Used = Flushed = 0;
+	Frames++;
+}
+
+
+// room for size bytes in this frame's region -- returns where to write them, and puts where they
+// are in the buffer in *offset:
+// (NULL if there is no room left)
+
+void *
+StreamBuffer::Allocate( GLsizeiptr size, GLintptr *offset )
+{
+	GLsizeiptr start = ( ( Used + Alignment - 1 ) / Alignment ) * Alignment;
+	if( start + size > RegionSize )
+	{
+		if( Overflows++ == 0 )
+			fprintf( stderr, "StreamBuffer::Allocate: no room in %s for %d more bytes -- Init( ) it with more than %d bytes per frame\n",
+				Name, (int)size, (int)RegionSize );
+		return NULL;
+	}
+
+	Used = start + size;
+	if( Used > MostUsed )
+		MostUsed = Used;
+	*offset = NowRegion * RegionSize + start;
+	if( Mapped != NULL )
+		return Mapped + *offset;
+	return &Staging[start];
+}
+
+
+// copy a block into this frame's region, and return where it went:
+// (-1 if there is no room left)
+
+GLintptr
+StreamBuffer::Push( const void *data, GLsizeiptr size )
+{
+	GLintptr offset;
+	void *p = Allocate( size, &offset );
+	if( p == NULL )
+		return -1;
+	memcpy( p, data, size );
+	Flush( );
+	return offset;
+}
+
+
+// make what has been written since the last Flush( ) visible to the gpu:
+// (a persistent, coherent mapping needs nothing -- otherwise it is copied in through a mapping that
+// does not wait, since the fence in BeginFrame( ) already made sure the gpu is not reading it)
+
+void
+StreamBuffer::Flush( )
+{
+	if( Mapped != NULL  ||  Used == Flushed )
+		return;
+
+	GLsizeiptr size = Used - Flushed;
+	glBindBuffer( Target, Buffer );
+	GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT;
+	void *p = glMapBufferRange( Target, NowRegion * RegionSize + Flushed, size, flags );
+	if( p != NULL )
+	{
+		memcpy( p, &Staging[Flushed], size );
+		glUnmapBuffer( Target );
+	}
+	glBindBuffer( Target, 0 );
+	Flushed = Used;
+}
+
+
+// mark where the gpu will be done with this frame's region, and move on to the next one:
+
+void
+StreamBuffer::EndFrame( )
+{
+	Flush( );
+	Fences[NowRegion] = glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
+	NowRegion = ( NowRegion + 1 ) % STREAM_FRAMES;
+}
+
+
+GLuint
+StreamBuffer::GetBuffer( )
+{
+	return Buffer;
+}
+
+
+GLsizeiptr
+StreamBuffer::GetRegionSize( )
+{
+	return RegionSize;
+}
+
+
+int
+StreamBuffer::GetStalls( )
+{
+	return Stalls;
+}
+
+
+bool
+StreamBuffer::IsPersistent( )
+{
+	return Mapped != NULL;
+}
+
+
+void
+StreamBuffer::PrintStats( FILE *fp )
+{
+	fprintf( fp, "StreamBuffer %s: %s, %d x %d bytes ; %d frames, most used %d bytes, %d stalls (%.3f ms waiting), %d overflows\n",
+		Name, Mapped != NULL  ?  "persistently mapped"  :  "copied in", STREAM_FRAMES, (int)RegionSize,
+		Frames, (int)MostUsed, Stalls, StallMs, Overflows );
+}
+
+#endif		// #ifndef STREAMBUFFER_CPP
@@ -0,0 +1,428 @@
+#include "terrain.h"
+
+#include "glm/gtc/noise.hpp"
+#include "glm/gtc/type_ptr.hpp"
+
+
+Terrain::Terrain( )
+{
+	MapSize = 0;
+	NumLods = 0;
+	GridDim = 0;
+	HeightTexture = 0;
+	IndexBuffer = 0;
+	VertexArray = 0;
+	NumIndices = 0;
+	Valid = false;
+}
+
+
+// make a heightmap out of several octaves of perlin noise:
+
+void
+Terrain::GenerateHeightMap( int size, int octaves, int seed )
+{
+	if( size < 2 )		size = 2;
+	if( octaves < 1 )	octaves = 1;
+
+	MapSize = size;
+	Heights.resize( size * size );
+
+	glm::vec2 offset( 17.31f * (float)seed, 5.79f * (float)seed );
+	float lo =  1.e+37f;
+	float hi = -1.e+37f;
+	for( int j = 0; j < size; j++ )
+	{
+		for( int i = 0; i < size; i++ )
+		{
+			glm::vec2 p = offset + 4.f * glm::vec2( (float)i, (float)j ) / (float)( size - 1 );
+			float h = 0.;
+			float amplitude = 1.;
+			for( int o = 0; o < octaves; o++ )
+			{
+				h += amplitude * glm::perlin( p );
+				p *= 2.f;
+				amplitude *= 0.5f;
+			}
+			Heights[ j*size + i ] = h;
+			if( h < lo )	lo = h;
+			if( h > hi )	hi = h;
+		}
+	}
+
+	// scale to 0. - 1.:
+
+	float range = hi > lo ? hi - lo : 1.f;
+	for( int k = 0; k < size*size; k++ )
+		Heights[k] = ( Heights[k] - lo ) / range;
+}
+
+
+// use the red channel of an rgb image, such as what BmpToTexture( ) returns
+// (only a square piece of it is used if it is not square):
+
+void
+Terrain::SetHeightMap( unsigned char *rgb, int width, int height )
+{
+	if( rgb == NULL )
+	{
+		fprintf( stderr, "Terrain: no heightmap image\n" );
+		return;
+	}
+
+	MapSize = width < height ? width : height;
+	Heights.resize( MapSize * MapSize );
+	for( int j = 0; j < MapSize; j++ )
+	{
+		for( int i = 0; i < MapSize; i++ )
+		{
+			Heights[ j*MapSize + i ] = (float)rgb[ 3*( j*width + i ) ] / 255.f;
+		}
+	}
+}
+
+
+// x0,z0 is where the terrain starts, size is the length of a side, and heightScale is how
+// tall a heightmap value of 1. is
+// numLods is the number of quadtree levels, gridDim is how many cells there are along the
+// side of every node, and finestRange is how far from the camera the finest level reaches
+// (0. means twice the size of a finest node)
+
+void
+Terrain::Init( float x0, float z0, float size, float heightScale, int numLods, int gridDim, float finestRange )
+{
+	if( MapSize == 0 )
+		GenerateHeightMap( 257 );
+
+	if( numLods < 1 )			numLods = 1;
+	if( numLods > TERRAIN_MAX_LODS )	numLods = TERRAIN_MAX_LODS;
+	if( gridDim < 2 )			gridDim = 2;
+	if( gridDim > 254 )			gridDim = 254;		// keeps a patch's indices in a GLushort
+	gridDim &= ~1;						// morphing needs an even number of cells
+
+	StartX = x0;
+	StartZ = z0;
+	Size = size;
+	HeightScale = heightScale;
+	NumLods = numLods;
+	GridDim = gridDim;
+
+	// each level reaches twice as far as the one below it, and morphs over the last third:
+
+	float leafSize = size / (float)( 1 << ( numLods - 1 ) );
+	Ranges[0] = finestRange > 0. ? finestRange : 2.f * leafSize;
+	for( int lod = 1; lod < numLods; lod++ )
+		Ranges[lod] = 2.f * Ranges[lod-1];
+	for( int lod = 0; lod < numLods; lod++ )
+	{
+		float previous = lod > 0 ? Ranges[lod-1] : 0.f;
+		MorphStart[lod] = previous + 0.66f * ( Ranges[lod] - previous );
+	}
+
+	BuildMinMax( );
+
+	// the heightmap texture (on texture unit 1, so it does not get in the way of GL_TEXTURE_2D on unit 0):
+
+	if( HeightTexture == 0 )
+		glGenTextures( 1, &HeightTexture );
+	glActiveTexture( GL_TEXTURE1 );
+	glBindTexture( GL_TEXTURE_2D, HeightTexture );
+	glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
+	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE );
+	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE );
+	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
+	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR );
+	glTexImage2D( GL_TEXTURE_2D, 0, GL_R32F, MapSize, MapSize, 0, GL_RED, GL_FLOAT, &Heights[0] );
+	glBindTexture( GL_TEXTURE_2D, 0 );
+	glActiveTexture( GL_TEXTURE0 );
+
+	// the heights stay on the cpu too -- Init( ) can be called again, with another size or
+	// number of levels, and BuildMinMax( ) needs them then
+
+	// one patch, shared by every node:
+
+	std::vector<GLushort> indices;
+	for( int iz = 0; iz < gridDim; iz++ )
+	{
+		for( int ix = 0; ix < gridDim; ix++ )
+		{
+			GLushort i00 = (GLushort)( (iz+0)*(gridDim+1) + (ix+0) );
+			GLushort i10 = (GLushort)( (iz+0)*(gridDim+1) + (ix+1) );
+			GLushort i01 = (GLushort)( (iz+1)*(gridDim+1) + (ix+0) );
+			GLushort i11 = (GLushort)( (iz+1)*(gridDim+1) + (ix+1) );
+			indices.push_back( i00 );	indices.push_back( i01 );	indices.push_back( i11 );
+			indices.push_back( i00 );	indices.push_back( i11 );	indices.push_back( i10 );
+		}
+	}
+	NumIndices = (GLsizei)indices.size( );
+
+	if( VertexArray == 0 )
+	{
+		glGenVertexArrays( 1, &VertexArray );
+		glGenBuffers( 1, &IndexBuffer );
+	}
+	glBindVertexArray( VertexArray );
+	glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, IndexBuffer );
+	glBufferData( GL_ELEMENT_ARRAY_BUFFER, indices.size( )*sizeof(GLushort), &indices[0], GL_STATIC_DRAW );
+
+	// the only vertex attribute is the per-node x0, z0, size, lod -- Draw( ) points it at
+	// wherever in the stream buffer that frame's nodes went:
+
+	glEnableVertexAttribArray( 1 );
+	glVertexAttribDivisor( 1, 1 );
+	glBindVertexArray( 0 );
+
+	Program.Init( );
+	Valid = Program.Create( (char *)"terrain.vert" );
+	if( ! Valid )
+	{
+		fprintf( stderr, "Terrain: cannot create the terrain.vert shader\n" );
+		return;
+	}
+
+	Program.Use( );
+	Program.SetUniformVariable( (char *)"uHeightMap",   1 );
+	Program.SetUniformVariable( (char *)"uGridDim",     gridDim );
+	Program.SetUniformVariable( (char *)"uStart",       StartX, 0.f, StartZ );
+	Program.SetUniformVariable( (char *)"uSize",        Size );
+	Program.SetUniformVariable( (char *)"uHeightScale", HeightScale );
+	Program.SetUniformVariable( (char *)"uMapSize",     (float)MapSize );
+	// glslprogram has no way to set a uniform array, so go around it:
+	GLint program;
+	glGetIntegerv( GL_CURRENT_PROGRAM, &program );
+	GLint loc = glGetUniformLocation( (GLuint)program, "uMorph" );
+	if( loc >= 0 )
+	{
+		float morph[2*TERRAIN_MAX_LODS];
+		for( int lod = 0; lod < NumLods; lod++ )
+		{
+			morph[2*lod+0] = MorphStart[lod];
+			morph[2*lod+1] = Ranges[lod];
+		}
+		glUniform2fv( loc, NumLods, morph );
+	}
+	Program.UnUse( );
+
+	fprintf( stderr, "Terrain: %dx%d heightmap, %d levels, finest range %.3f, coarsest range %.3f\n",
+		MapSize, MapSize, NumLods, Ranges[0], Ranges[NumLods-1] );
+}
+
+
+// the min and max heights of every node, built from the finest level up:
+
+void
+Terrain::BuildMinMax( )
+{
+	LevelStart.resize( NumLods + 1 );
+	int total = 0;
+	for( int level = 0; level < NumLods; level++ )
+	{
+		LevelStart[level] = total;
+		total += ( 1 << level ) * ( 1 << level );
+	}
+	LevelStart[NumLods] = total;
+	NodeMin.resize( total );
+	NodeMax.resize( total );
+
+	int finest = NumLods - 1;
+	int n = 1 << finest;
+	for( int j = 0; j < n; j++ )
+	{
+		for( int i = 0; i < n; i++ )
+		{
+			// texels under this node, including its edges:
+			int ti0 = (int)floorf( (float)( MapSize - 1 ) * (float)(i+0) / (float)n );
+			int ti1 = (int)ceilf(  (float)( MapSize - 1 ) * (float)(i+1) / (float)n );
+			int tj0 = (int)floorf( (float)( MapSize - 1 ) * (float)(j+0) / (float)n );
+			int tj1 = (int)ceilf(  (float)( MapSize - 1 ) * (float)(j+1) / (float)n );
+			float lo =  1.e+37f;
+			float hi = -1.e+37f;
+			for( int tj = tj0; tj <= tj1; tj++ )
+			{
+				for( int ti = ti0; ti <= ti1; ti++ )
+				{
+					float h = Heights[ tj*MapSize + ti ];
+					if( h < lo )	lo = h;
+					if( h > hi )	hi = h;
+				}
+			}
+			NodeMin[ LevelStart[finest] + j*n + i ] = lo;
+			NodeMax[ LevelStart[finest] + j*n + i ] = hi;
+		}
+	}
+
+	for( int level = finest - 1; level >= 0; level-- )
+	{
+		int n = 1 << level;
+		for( int j = 0; j < n; j++ )
+		{
+			for( int i = 0; i < n; i++ )
+			{
+				int c = LevelStart[level+1] + ( 2*j )*( 2*n ) + 2*i;	// first child
+				float lo = NodeMin[c];
+				float hi = NodeMax[c];
+				int children[3] = { c + 1, c + 2*n, c + 2*n + 1 };
+				for( int k = 0; k < 3; k++ )
+				{
+					if( NodeMin[ children[k] ] < lo )	lo = NodeMin[ children[k] ];
+					if( NodeMax[ children[k] ] > hi )	hi = NodeMax[ children[k] ];
+				}
+				NodeMin[ LevelStart[level] + j*n + i ] = lo;
+				NodeMax[ LevelStart[level] + j*n + i ] = hi;
+			}
+		}
+	}
+}
+
+
+void
+Terrain::NodeBox( int level, int i, int j, float bmin[3], float bmax[3] )
+{
+	int n = 1 << level;
+	float nodeSize = Size / (float)n;
+	bmin[0] = StartX + nodeSize * (float)i;
+	bmin[1] = HeightScale * NodeMin[ LevelStart[level] + j*n + i ];
+	bmin[2] = StartZ + nodeSize * (float)j;
+	bmax[0] = bmin[0] + nodeSize;
+	bmax[1] = HeightScale * NodeMax[ LevelStart[level] + j*n + i ];
+	bmax[2] = bmin[2] + nodeSize;
+}
+
+
+inline
+bool
+_BoxInSphere( float bmin[3], float bmax[3], glm::vec3 center, float radius )
+{
+	float d2 = 0.;
+	for( int k = 0; k < 3; k++ )
+	{
+		float c = center[k];
+		if( c < bmin[k] )	d2 += ( bmin[k] - c ) * ( bmin[k] - c );
+		if( c > bmax[k] )	d2 += ( c - bmax[k] ) * ( c - bmax[k] );
+	}
+	return d2 <= radius * radius;
+}
+
+
+// returns false if this node is too far away for its level, so the caller has to draw it at the coarser level:
+
+bool
+Terrain::Select( int level, int i, int j, const Frustum &frustum, glm::vec3 eye )
+{
+	float bmin[3], bmax[3];
+	NodeBox( level, i, j, bmin, bmax );
+
+	int lod = NumLods - 1 - level;
+	if( ! _BoxInSphere( bmin, bmax, eye, Ranges[lod] ) )
+		return false;
+
+	if( ! frustum.BoxVisible( bmin, bmax ) )
+		return true;			// nothing to draw, but it has been taken care of
+
+	if( lod == 0  ||  ! _BoxInSphere( bmin, bmax, eye, Ranges[lod-1] ) )
+	{
+		float node[4] = { bmin[0], bmin[2], bmax[0] - bmin[0], (float)lod };
+		Selected.insert( Selected.end( ), node, node+4 );
+		return true;
+	}
+
+	// some of it is close enough for the finer level:
+	// a child that is too far for that level is drawn at it anyway, but completely morphed,
+	// which puts its vertices right where this level's would be
+
+	for( int k = 0; k < 4; k++ )
+	{
+		int ci = 2*i + ( k & 1 );
+		int cj = 2*j + ( k >> 1 );
+		if( ! Select( level + 1, ci, cj, frustum, eye ) )
+		{
+			float cmin[3], cmax[3];
+			NodeBox( level + 1, ci, cj, cmin, cmax );
+			if( frustum.BoxVisible( cmin, cmax ) )
+			{
+				float node[4] = { cmin[0], cmin[2], cmax[0] - cmin[0], (float)( lod - 1 ) };
+				Selected.insert( Selected.end( ), node, node+4 );
+			}
+		}
+	}
+	return true;
+}
+
+
+void
+Terrain::Draw( )
+{
+	if( ! Valid )
+		return;
+
+	// where the eye is in the terrain's own coordinates:
+
+	float mv[16];
+	glGetFloatv( GL_MODELVIEW_MATRIX, mv );
+	glm::vec4 eye = glm::inverse( glm::make_mat4( mv ) ) * glm::vec4( 0., 0., 0., 1. );
+	glm::vec3 eye3 = glm::vec3( eye ) / eye.w;
+
+	Frustum frustum;
+	frustum.FromCurrentMatrices( );
+
+	Selected.clear( );
+	if( ! Select( 0, 0, 0, frustum, eye3 ) )
+	{
+		// the whole terrain is beyond even the coarsest level's range:
+		float bmin[3], bmax[3];
+		NodeBox( 0, 0, 0, bmin, bmax );
+		if( frustum.BoxVisible( bmin, bmax ) )
+		{
+			float node[4] = { bmin[0], bmin[2], Size, (float)( NumLods - 1 ) };
+			Selected.insert( Selected.end( ), node, node+4 );
+		}
+	}
+
+	int numSelected = GetNumSelectedNodes( );
+	if( numSelected == 0 )
+		return;
+
+	GLsizeiptr bytes = Selected.size( )*sizeof(float);
+	if( bytes > Instances.GetRegionSize( ) )
+		Instances.Init( GL_ARRAY_BUFFER, 2*bytes, 16, "Terrain nodes" );
+	Instances.BeginFrame( );
+	GLintptr offset = Instances.Push( &Selected[0], bytes );
+
+	Program.Use( );
+	Program.SetUniformVariable( (char *)"uEye", eye3.x, eye3.y, eye3.z );
+	Program.SetUniformVariable( (char *)"uLighting", glIsEnabled( GL_LIGHTING ) ? 1 : 0 );
+	glActiveTexture( GL_TEXTURE1 );
+	glBindTexture( GL_TEXTURE_2D, HeightTexture );
+	glBindVertexArray( VertexArray );
+	glBindBuffer( GL_ARRAY_BUFFER, Instances.GetBuffer( ) );
+	glVertexAttribPointer( 1, 4, GL_FLOAT, GL_FALSE, 4*sizeof(float), (GLvoid *)offset );
+	glDrawElementsInstanced( GL_TRIANGLES, NumIndices, GL_UNSIGNED_SHORT, (GLvoid *)0, numSelected );
+	glBindVertexArray( 0 );
+	glBindBuffer( GL_ARRAY_BUFFER, 0 );
+	glBindTexture( GL_TEXTURE_2D, 0 );
+	glActiveTexture( GL_TEXTURE0 );
+	Program.UnUse( );
+	Instances.EndFrame( );
+}
+
+
+int
+Terrain::GetNumSelectedNodes( )
+{
+	return (int)Selected.size( ) / 4;
+}
+
+
+int
+Terrain::GetNumTriangles( )
+{
+	return GetNumSelectedNodes( ) * NumIndices / 3;
+}
+
+
+void
+Terrain::PrintStats( FILE *fp )
+{
+	fprintf( fp, "Terrain: %d nodes, %d triangles ; ", GetNumSelectedNodes( ), GetNumTriangles( ) );
+	Instances.PrintStats( fp );
+}
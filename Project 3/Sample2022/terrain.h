@@ -0,0 +1,84 @@
+#ifndef TERRAIN_H
+#define TERRAIN_H
+
+#include <stdio.h>
+#include <vector>
+
+#include "glew.h"
+#include <GL/gl.h>
+
+#include "glm/glm.hpp"
+
+#include "glslprogram.h"
+#include "frustum.cpp"
+#include "streambuffer.cpp"
+
+
+// a heightfield terrain drawn with continuous distance-dependent level of detail (CDLOD):
+//
+//	the heightmap lives in a float texture and is sampled in the vertex shader (terrain.vert)
+//	a quadtree of square nodes is built over it -- each node only stores its min and max height
+//	every frame the quadtree is walked from the top: a node close enough to the camera is split
+//	into its 4 children, a node that is not is drawn whole, and nodes outside the frustum are skipped
+//	every selected node is drawn with the same GridDim x GridDim patch, in one instanced draw
+//	vertices near the far edge of a level's range are morphed onto the next coarser grid, so
+//	neighboring nodes of different levels meet without cracks
+//
+//	since the finest level covers a fixed distance around the camera and each coarser level
+//	covers twice the distance with nodes twice the size, the number of triangles drawn stays
+//	about the same however big the terrain is
+//
+//	use:
+//		Terrain.GenerateHeightMap( 513, 6 );			// or SetHeightMap( BmpToTexture(...), w, h )
+//		Terrain.Init( x0, z0, size, heightScale );
+//		...
+//		SetMaterial( ... );
+//		Terrain.Draw( );
+
+const int TERRAIN_MAX_LODS = 16;
+
+class Terrain
+{
+  private:
+	std::vector<float>	Heights;		// the heightmap, 0. to 1.
+	int			MapSize;		// heightmap is MapSize x MapSize
+
+	float			StartX, StartZ;		// where the terrain starts
+	float			Size;			// length of each side
+	float			HeightScale;		// height of a 1. in the heightmap
+	int			NumLods;
+	int			GridDim;		// cells on a side of each patch
+	float			Ranges[TERRAIN_MAX_LODS];
+	float			MorphStart[TERRAIN_MAX_LODS];
+
+	std::vector<float>	NodeMin;		// min and max height of every quadtree node,
+	std::vector<float>	NodeMax;		//	level by level, coarsest first
+	std::vector<int>	LevelStart;
+
+	std::vector<float>	Selected;		// x0, z0, size, lod of each node to draw this frame
+
+	GLuint			HeightTexture;
+	GLuint			IndexBuffer;
+	StreamBuffer		Instances;		// Selected, written straight in every frame
+	GLuint			VertexArray;
+	GLsizei			NumIndices;
+	GLSLProgram		Program;
+	bool			Valid;
+
+	void	BuildMinMax( );
+	void	NodeBox( int, int, int, float [3], float [3] );
+	bool	Select( int, int, int, const Frustum &, glm::vec3 );
+
+  public:
+		Terrain( );
+
+	void	Draw( );
+	void	GenerateHeightMap( int, int = 6, int = 0 );
+	int	GetNumSelectedNodes( );
+	int	GetNumTriangles( );
+	void	PrintStats( FILE * );
+	void	Init( float, float, float, float, int = 8, int = 32, float = 0. );
+	void	SetHeightMap( unsigned char *, int, int );
+};
+
+#endif		// #ifndef TERRAIN_H
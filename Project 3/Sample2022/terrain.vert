@@ -0,0 +1,110 @@
+// make this 120 for the mac:
+#version 330 compatibility
+
+// each instance is one quadtree node and each vertex is one point of its
+// uGridDim x uGridDim patch, found from gl_VertexID:
+
+layout( location = 1 ) in vec4	aNode;		// x0, z0, size, lod
+
+uniform sampler2D	uHeightMap;
+uniform int		uGridDim;		// cells on a side of each patch
+uniform vec3		uStart;			// where the terrain starts
+uniform float		uSize;			// length of each side
+uniform float		uHeightScale;		// height of a 1. in the heightmap
+uniform float		uMapSize;		// heightmap is uMapSize x uMapSize
+uniform vec2		uMorph[16];		// where each lod starts and finishes morphing
+uniform vec3		uEye;			// the eye, in the terrain's coordinates
+uniform int		uLighting;		// != 0 means GL_LIGHTING is on
+
+// there is no fragment shader, so the fixed-function fragment stage does fog
+// and texturing with what is written here
+
+float
+Height( vec2 xz )
+{
+	// put the heightmap corners right on the texel centers:
+	vec2 st = ( ( xz - uStart.xz ) / uSize * ( uMapSize - 1. ) + 0.5 ) / uMapSize;
+	return uHeightScale * textureLod( uHeightMap, st, 0. ).r;
+}
+
+void
+main( )
+{
+	int ix = gl_VertexID % ( uGridDim + 1 );
+	int iz = gl_VertexID / ( uGridDim + 1 );
+	float cell = aNode.z / float(uGridDim);
+	vec2 xz = aNode.xy + cell * vec2( float(ix), float(iz) );
+
+	// slide the odd vertices onto the even ones as this node gets close to the end of its range,
+	// so that at the far edge it looks exactly like the next coarser level:
+
+	vec2 morph = uMorph[ int(aNode.w) ];
+	float dist = distance( uEye, vec3( xz.x, Height( xz ), xz.y ) );
+	float t = clamp( ( dist - morph.x ) / ( morph.y - morph.x ), 0., 1. );
+	xz -= t * cell * vec2( float( ix & 1 ), float( iz & 1 ) );
+
+	float h = Height( xz );
+	vec4 vertex = vec4( xz.x, h, xz.y, 1. );
+	vec4 ECposition = gl_ModelViewMatrix * vertex;
+	gl_Position = gl_ModelViewProjectionMatrix * vertex;
+	gl_FogFragCoord = abs( ECposition.z );
+	gl_TexCoord[0] = vec4( ( xz - uStart.xz ) / uSize, 0., 1. );
+
+	if( uLighting == 0 )
+	{
+		gl_FrontColor = gl_Color;
+		gl_BackColor  = gl_Color;
+		return;
+	}
+
+	// normal from the heightmap's central differences:
+
+	float step = uSize / ( uMapSize - 1. );
+	float hl = Height( xz - vec2( step, 0. ) );
+	float hr = Height( xz + vec2( step, 0. ) );
+	float hd = Height( xz - vec2( 0., step ) );
+	float hu = Height( xz + vec2( 0., step ) );
+	vec3 normal = vec3( hl - hr, 2. * step, hd - hu );
+
+	// the same per-vertex lighting the fixed-function pipeline does for GL_LIGHT0:
+
+	vec3 N = normalize( gl_NormalMatrix * normal );
+	vec4 color = gl_FrontLightModelProduct.sceneColor;
+
+	vec3 L;
+	float atten = 1.;
+	if( gl_LightSource[0].position.w == 0. )
+	{
+		L = normalize( gl_LightSource[0].position.xyz );
+	}
+	else
+	{
+		vec3 toLight = gl_LightSource[0].position.xyz - ECposition.xyz;
+		float dist = length( toLight );
+		L = toLight / dist;
+		atten = 1. / ( gl_LightSource[0].constantAttenuation +
+				gl_LightSource[0].linearAttenuation * dist +
+				gl_LightSource[0].quadraticAttenuation * dist * dist );
+		if( gl_LightSource[0].spotCutoff != 180. )
+		{
+			float spot = dot( -L, normalize( gl_LightSource[0].spotDirection ) );
+			if( spot < gl_LightSource[0].spotCosCutoff )
+				atten = 0.;
+			else
+				atten *= pow( spot, gl_LightSource[0].spotExponent );
+		}
+	}
+
+	float nl = max( dot( N, L ), 0. );
+	color += atten * gl_FrontLightProduct[0].ambient;
+	color += atten * nl * gl_FrontLightProduct[0].diffuse;
+	if( nl > 0. )
+	{
+		vec3 H = normalize( L + vec3( 0., 0., 1. ) );
+		color += atten * pow( max( dot( N, H ), 0. ), gl_FrontMaterial.shininess ) * gl_FrontLightProduct[0].specular;
+	}
+
+	color.a = gl_FrontMaterial.diffuse.a;
+	gl_FrontColor = clamp( color, 0., 1. );
+	gl_BackColor  = gl_FrontColor;
+}
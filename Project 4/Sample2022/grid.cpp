@@ -0,0 +1,198 @@
+#include "grid.h"
+
+
+Grid::Grid( )
+{
+	CellsX = CellsZ = 0;
+	TilesX = TilesZ = 0;
+	IndexBuffer = 0;
+	VertexArray = 0;
+	IndicesPerTile = 0;
+	UseShader = false;
+	NumVisible = 0;
+}
+
+
+// x0,z0 is where the grid starts, xside,zside is how big it is,
+// nx,nz is how many cells it has each way, and y is its height:
+
+void
+Grid::Init( float x0, float z0, float xside, float zside, int nx, int nz, float y, int tileSize )
+{
+	if( nx < 1 )		nx = 1;
+	if( nz < 1 )		nz = 1;
+	if( tileSize < 1 )	tileSize = 1;
+	if( tileSize > 254 )	tileSize = 254;		// keeps one tile's indices in a GLushort
+
+	StartX = x0;
+	StartZ = z0;
+	CellsX = nx;
+	CellsZ = nz;
+	DeltaX = xside / (float)nx;
+	DeltaZ = zside / (float)nz;
+	Height = y;
+	TileSize = tileSize;
+	TilesX = ( nx + tileSize - 1 ) / tileSize;
+	TilesZ = ( nz + tileSize - 1 ) / tileSize;
+	VertsPerTile = ( tileSize + 1 ) * ( tileSize + 1 );
+
+	// the bounding box of each tile:
+
+	int numTiles = TilesX * TilesZ;
+	TileMin.resize( 3*numTiles );
+	TileMax.resize( 3*numTiles );
+	for( int tz = 0; tz < TilesZ; tz++ )
+	{
+		for( int tx = 0; tx < TilesX; tx++ )
+		{
+			int t = tz*TilesX + tx;
+			int ix1 = ( tx+1 ) * tileSize;	if( ix1 > nx )	ix1 = nx;
+			int iz1 = ( tz+1 ) * tileSize;	if( iz1 > nz )	iz1 = nz;
+			TileMin[3*t+0] = StartX + DeltaX * (float)( tx * tileSize );
+			TileMin[3*t+1] = Height;
+			TileMin[3*t+2] = StartZ + DeltaZ * (float)( tz * tileSize );
+			TileMax[3*t+0] = StartX + DeltaX * (float)ix1;
+			TileMax[3*t+1] = Height;
+			TileMax[3*t+2] = StartZ + DeltaZ * (float)iz1;
+		}
+	}
+
+	Counts.reserve( numTiles );
+	Offsets.reserve( numTiles );
+	BaseVertices.reserve( numTiles );
+
+	// one tile's worth of triangles, shared by every tile:
+
+	std::vector<GLushort> indices;
+	indices.reserve( 6 * tileSize * tileSize );
+	for( int iz = 0; iz < tileSize; iz++ )
+	{
+		for( int ix = 0; ix < tileSize; ix++ )
+		{
+			GLushort i00 = (GLushort)( (iz+0)*(tileSize+1) + (ix+0) );
+			GLushort i10 = (GLushort)( (iz+0)*(tileSize+1) + (ix+1) );
+			GLushort i01 = (GLushort)( (iz+1)*(tileSize+1) + (ix+0) );
+			GLushort i11 = (GLushort)( (iz+1)*(tileSize+1) + (ix+1) );
+			indices.push_back( i00 );	indices.push_back( i01 );	indices.push_back( i11 );
+			indices.push_back( i00 );	indices.push_back( i11 );	indices.push_back( i10 );
+		}
+	}
+	IndicesPerTile = (GLsizei)indices.size( );
+
+	if( IndexBuffer == 0 )
+		glGenBuffers( 1, &IndexBuffer );
+	glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, IndexBuffer );
+	glBufferData( GL_ELEMENT_ARRAY_BUFFER, indices.size( )*sizeof(GLushort), &indices[0], GL_STATIC_DRAW );
+	glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, 0 );
+
+	// there are no vertex attributes at all, but a vertex array object keeps the
+	// index buffer binding in one place:
+
+	if( VertexArray == 0 )
+		glGenVertexArrays( 1, &VertexArray );
+	glBindVertexArray( VertexArray );
+	glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, IndexBuffer );
+	glBindVertexArray( 0 );
+
+	Program.Init( );
+	UseShader = Program.Create( (char *)"grid.vert" );
+	if( ! UseShader )
+	{
+		fprintf( stderr, "Grid: cannot create the grid.vert shader -- drawing the grid the slow way\n" );
+		return;
+	}
+
+	Program.Use( );
+	Program.SetUniformVariable( (char *)"uTileSize", tileSize );
+	Program.SetUniformVariable( (char *)"uTilesX",   TilesX );
+	Program.SetUniformVariable( (char *)"uNX",       nx );
+	Program.SetUniformVariable( (char *)"uNZ",       nz );
+	Program.SetUniformVariable( (char *)"uOrigin",   StartX, Height, StartZ );
+	Program.SetUniformVariable( (char *)"uDX",       DeltaX );
+	Program.SetUniformVariable( (char *)"uDZ",       DeltaZ );
+	Program.UnUse( );
+}
+
+
+void
+Grid::Draw( )
+{
+	if( CellsX == 0 )
+		return;
+
+	// cull the tiles against the frustum of the current matrices:
+
+	Frustum frustum;
+	frustum.FromCurrentMatrices( );
+
+	Counts.clear( );
+	Offsets.clear( );
+	BaseVertices.clear( );
+	int numTiles = TilesX * TilesZ;
+	for( int t = 0; t < numTiles; t++ )
+	{
+		if( frustum.BoxVisible( &TileMin[3*t], &TileMax[3*t] ) )
+		{
+			Counts.push_back( IndicesPerTile );
+			Offsets.push_back( (GLvoid *)0 );
+			BaseVertices.push_back( t * VertsPerTile );
+		}
+	}
+	NumVisible = (int)Counts.size( );
+	if( NumVisible == 0 )
+		return;
+
+	if( ! UseShader )
+	{
+		DrawImmediate( );
+		return;
+	}
+
+	Program.Use( );
+	Program.SetUniformVariable( (char *)"uLighting", glIsEnabled( GL_LIGHTING ) ? 1 : 0 );
+	glBindVertexArray( VertexArray );
+	glMultiDrawElementsBaseVertex( GL_TRIANGLES, &Counts[0], GL_UNSIGNED_SHORT, (const GLvoid **)&Offsets[0], NumVisible, &BaseVertices[0] );
+	glBindVertexArray( 0 );
+	Program.UnUse( );
+}
+
+
+// if there are no shaders, draw the visible tiles as quad strips:
+
+void
+Grid::DrawImmediate( )
+{
+	glNormal3f( 0., 1., 0. );
+	for( int i = 0; i < NumVisible; i++ )
+	{
+		int t = BaseVertices[i] / VertsPerTile;
+		int ix0 = ( t % TilesX ) * TileSize;
+		int iz0 = ( t / TilesX ) * TileSize;
+		int ix1 = ix0 + TileSize;	if( ix1 > CellsX )	ix1 = CellsX;
+		int iz1 = iz0 + TileSize;	if( iz1 > CellsZ )	iz1 = CellsZ;
+		for( int iz = iz0; iz < iz1; iz++ )
+		{
+			glBegin( GL_QUAD_STRIP );
+			for( int ix = ix0; ix <= ix1; ix++ )
+			{
+				glVertex3f( StartX + DeltaX * (float)ix, Height, StartZ + DeltaZ * (float)(iz + 0) );
+				glVertex3f( StartX + DeltaX * (float)ix, Height, StartZ + DeltaZ * (float)(iz + 1) );
+			}
+			glEnd( );
+		}
+	}
+}
+
+
+int
+Grid::GetNumTiles( )
+{
+	return TilesX * TilesZ;
+}
+
+
+int
+Grid::GetNumVisibleTiles( )
+{
+	return NumVisible;
+}
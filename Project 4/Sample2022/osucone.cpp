@@ -13,27 +13,32 @@
 #endif
 
 
+#include "osusurface.cpp"
+
+
 inline
 void
-_DrawConeLatLng( int ilat, int ilng, int numlats, int numlngs, float radbot, float radtop, float height )
+_ConeLatLng( float u, float v, float radbot, float radtop, float height, struct SurfaceVertex *p )
 {
-	float t = (float)ilat / (float)(numlats-1);
-	float y = t * height;
-	float rad = t * radtop + ( 1.f - t ) * radbot;
-	float lng = -F_PI  +  2.f * F_PI * (float)ilng / (float)(numlngs-1);
+	float y = v * height;
+	float rad = v * radtop + ( 1.f - v ) * radbot;
+	float lng = -F_PI  +  2.f * F_PI * u;
 	float x =  cosf( lng );
 	float z = -sinf( lng );
-	float s = (float)ilng / (float)(numlngs-1);
-	glTexCoord2f( s, t );
+	p->s = u;
+	p->t = v;
 	float n[3] = { height*x, radbot - radtop, height*z };
 	Unit( n, n );
-	glNormal3fv( n );
-	glVertex3f( rad * x, y,rad * z );
+	p->nx = n[0];	p->ny = n[1];	p->nz = n[2];
+	p->x = rad * x;	p->y = y;	p->z = rad * z;
 }
 
 
+// add a cone to a mesh (which can then be drawn, or put into a Mesh's buffers):
+// (a cone with both radii 0. is just a line, so nothing is added)
+
 void
-OsuCone( float radBot, float radTop, float height, int slices, int stacks )
+OsuCone( float radBot, float radTop, float height, int slices, int stacks, struct SurfaceMesh *mesh )
 {
 	// sanity check:
 	radBot = (float)fabs( (double)radBot );
@@ -43,79 +48,79 @@ OsuCone( float radBot, float radTop, float height, int slices, int stacks )
 	if( slices < 4 )	slices = 4;
 	if( stacks < 4 )	stacks = 4;
 
-	// gracefully handle degenerate case:
-
 	if( radBot == 0.  &&  radTop == 0. )
-	{
-		glBegin( GL_LINES );
-			glTexCoord2f( 0., 0. );
-			glNormal3f( 0., -1., 0. );
-			glVertex3f( 0., 0., 0. );
-
-			glTexCoord2f( 0., 1. );
-			glNormal3f( 0., 1., 0. );
-			glVertex3f( 0., height, 0. );
-		glEnd( );
 		return;
-	}
-
-	int numLngs = slices;
-	int numLats = stacks;
 
+	// slices and stacks count grid lines, so there is one less grid cell each way:
 
-	// draw the sides:
+	int numLngs = slices - 1;
+	int numLats = stacks - 1;
 
-	for( int ilat = 0; ilat < numLats-1; ilat++ )
-	{
-		glBegin( GL_TRIANGLE_STRIP );
-
-		_DrawConeLatLng( ilat+0, 0, numLats, numLngs, radBot, radTop, height );
-		_DrawConeLatLng( ilat+1, 0, numLats, numLngs, radBot, radTop, height );
+	// the sides:
 
-		for( int ilng = 1; ilng < numLngs; ilng++ )
+	BuildSurface(
+		[=]( float u, float v, struct SurfaceVertex *p )
 		{
-			_DrawConeLatLng( ilat+0, ilng, numLats, numLngs, radBot, radTop, height );
-			_DrawConeLatLng( ilat+1, ilng, numLats, numLngs, radBot, radTop, height );
-		}
-
-		glEnd( );
-	}
+			_ConeLatLng( u, v, radBot, radTop, height, p );
+		},
+		numLngs, numLats, mesh );
 
-	// draw the bottom circle:
+	// the bottom circle (v goes from the center out, so it faces down):
 
 	if( radBot != 0. )
 	{
+		BuildSurface(
+			[=]( float u, float v, struct SurfaceVertex *p )
+			{
+				float lng = -F_PI  +  2.f * F_PI * u;
+				p->s = u;		p->t = 0.;
+				p->nx = 0.;		p->ny = -1.;	p->nz = 0.;
+				p->x = v * radBot * cosf( lng );
+				p->y = 0.;
+				p->z = -v * radBot * sinf( lng );
+			},
+			numLngs, 1, mesh );
+	}
 
-		glBegin( GL_TRIANGLES );
-		for( int ilng = numLngs-1; ilng >= 0; ilng-- )
-		{
-			_DrawConeLatLng( 0, ilng+1, numLats, numLngs, radBot, radTop, height );
-			_DrawConeLatLng( 0, ilng+0, numLats, numLngs, radBot, radTop, height );
+	// the top circle (v goes from the edge in, so it faces up):
 
-			float s = (float)ilng / (float)(numLngs-1);
-			glTexCoord2f( s, 0. );
-			glNormal3f( 0., -1., 0. );
-			glVertex3f( 0., 0., 0. );
-		}
-		glEnd( );
+	if( radTop != 0. )
+	{
+		BuildSurface(
+			[=]( float u, float v, struct SurfaceVertex *p )
+			{
+				float lng = -F_PI  +  2.f * F_PI * u;
+				p->s = u;		p->t = 1.;
+				p->nx = 0.;		p->ny = 1.;		p->nz = 0.;
+				p->x = ( 1.f - v ) * radTop * cosf( lng );
+				p->y = height;
+				p->z = -( 1.f - v ) * radTop * sinf( lng );
+			},
+			numLngs, 1, mesh );
 	}
+}
 
 
-	// draw the top circle:
+void
+OsuCone( float radBot, float radTop, float height, int slices, int stacks )
+{
+	// gracefully handle degenerate case:
 
-	if( radTop != 0. )
+	if( radBot == 0.  &&  radTop == 0. )
 	{
-		glBegin( GL_TRIANGLES );
-		for( int ilng = 0; ilng < numLngs-1; ilng++ )
-		{
-			float s = (float)ilng / (float)(numLngs-1);
-			glTexCoord2f( s, 1. );
-			glNormal3f( 0.,  1., 0. );
-			glVertex3f( 0., height, 0. );
+		glBegin( GL_LINES );
+			glTexCoord2f( 0., 0. );
+			glNormal3f( 0., -1., 0. );
+			glVertex3f( 0., 0., 0. );
 
-			_DrawConeLatLng( numLats-1, ilng+0, numLats, numLngs, radBot, radTop, height );
-			_DrawConeLatLng( numLats-1, ilng+1, numLats, numLngs, radBot, radTop, height );
-		}
+			glTexCoord2f( 0., 1. );
+			glNormal3f( 0., 1., 0. );
+			glVertex3f( 0., height, 0. );
 		glEnd( );
+		return;
 	}
+
+	struct SurfaceMesh mesh;
+	OsuCone( radBot, radTop, height, slices, stacks, &mesh );
+	mesh.Draw( );
 }
@@ -235,9 +235,10 @@ float			Unit(float [3], float [3]);
 float			Unit(float [3]);
 
 int		catDL;
+float		CatCenter[3];		// the cat's bounding sphere, as the display list scales it
+float		CatRadius;
 int		duckDL;
 int		bunnyDL;
-int		GridDL;
 int		colorNum;
 int		lightType;
 
@@ -306,8 +307,13 @@ MulArray3(float factor, float a, float b, float c )
 #include "loadobjfile.cpp"
 #include "keytime.cpp"
 #include "glslprogram.cpp"
+#include "grid.cpp"
+#include "frustum.cpp"
 #include "CarouselHorse0.10.550"
 
+Grid		Floor;				// the floor
+Frustum		CatView;			// in each cat's own coordinates, just before it is drawn
+
 
 
 Keytimes Xpos;
@@ -665,9 +671,8 @@ Display( )
 	// draw the box object by calling up its display list:
 
 	//glCallList( BoxList );
-	glPushMatrix();
-	glCallList( GridDL );
-	glPopMatrix();
+	SetMaterial( 0.6f, 0.6f, 0.6f, 30.f );
+	Floor.Draw( );
 
 
 	// Objects
@@ -679,19 +684,28 @@ Display( )
 	float x = radius * cos(45 * Time);
 	float z = radius * sin(45 * Time);
 
+	// each cat is only drawn if its bounding sphere is in the view:
+
+	CatView.ResetCounters( );
 	glPushMatrix();
 	glTranslatef(0., 0., 0.4f);
 	SetMaterial(CatR.GetValue(nowSecs), CatG.GetValue(nowSecs), CatB.GetValue(nowSecs), 0.);
 	glTranslatef(Xpos.GetValue(nowSecs), Ypos.GetValue(nowSecs), 0);
-	glCallList(catDL);
+	CatView.FromCurrentMatrices( );
+	if( CatView.SphereVisible( CatCenter, CatRadius ) )
+		glCallList(catDL);
 	glPopMatrix();
 
 	glPushMatrix();
 	glTranslatef(0., 0., -0.5f);
 	SetMaterial(Cat2R.GetValue(nowSecs), Cat2G.GetValue(nowSecs), Cat2B.GetValue(nowSecs), 0.);
 	glTranslatef(X2pos.GetValue(nowSecs), Y2pos.GetValue(nowSecs), Z2pos.GetValue(nowSecs));
-	glCallList(catDL);
+	CatView.FromCurrentMatrices( );
+	if( CatView.SphereVisible( CatCenter, CatRadius ) )
+		glCallList(catDL);
 	glPopMatrix();
+	if( DebugOn != 0 )
+		CatView.PrintStats( stderr, "cats" );
 
 
 	float r = 1.;
@@ -1065,8 +1079,8 @@ InitGraphics( )
 	glutIdleFunc( Animate );
 
 	// init the glew package (a window must be open to do this):
+	// (on every platform -- the grid's buffers and shader come through glew's entry points)
 
-#ifdef WIN32
 	GLenum err = glewInit( );
 	if( err != GLEW_OK )
 	{
@@ -1075,7 +1089,6 @@ InitGraphics( )
 	else
 		fprintf( stderr, "GLEW initialized OK\n" );
 	fprintf( stderr, "Status: Using GLEW %s\n", glewGetString(GLEW_VERSION));
-#endif
 
 	// all other setups go here, such as GLSLProgram and KeyTime setups:
 
@@ -1110,12 +1123,22 @@ InitLists( )
 
 	// Create the objects:
 
+	// the cat is loaded here, rather than inside the list, so that its bounding sphere can be kept
+	// for frustum culling:
+
+	struct SurfaceMesh cat;
+	LoadObjFile( (char *)"Obj_cat.obj", &cat );
+	cat.BoundingSphere( CatCenter, &CatRadius );
+	for( int k = 0; k < 3; k++ )
+		CatCenter[k] *= 0.1f;
+	CatRadius *= 0.1f;
+
 	catDL = glGenLists(1);
 	glNewList(catDL, GL_COMPILE);
 	glPushMatrix();
 	glScalef(0.1, 0.1, 0.1);
 	glColor3f(0, 0, 1);
-	LoadObjFile((char*)"Obj_cat.obj");
+	cat.Draw( );
 	glPopMatrix();
 	glEndList();
 
@@ -1138,22 +1161,9 @@ InitLists( )
 	
 	// Create the grid:
 
-	GridDL = glGenLists(1);
-	glNewList(GridDL, GL_COMPILE);
-	SetMaterial(0.6f, 0.6f, 0.6f, 30.f);
-	glNormal3f(0., 1., 0.);
-	for (int i = 0; i < NZ; i++)
-	{
-		glBegin(GL_QUAD_STRIP);
-		for (int j = 0; j < NX; j++)
-		{
-			// YGRID = 0
-			glVertex3f(X0 + DX * (float)j, 0, Z0 + DZ * (float)(i + 0));
-			glVertex3f(X0 + DX * (float)j, 0, Z0 + DZ * (float)(i + 1));
-		}
-		glEnd();
-	}
-	glEndList();
+	// (the grid is tiled and drawn by the vertex shader, so it does not need a display list)
+
+	Floor.Init( X0, Z0, XSIDE, ZSIDE, NX, NZ );
 
 	// create the axes:
 
@@ -18,7 +18,11 @@
 #include <GL/glu.h>
 #include "glut.h"
 #include <map>
+#include <string>
+#include <vector>
 #include <stdarg.h>
+#include "glm/glm.hpp"
+#include "gldebug.h"
 
 inline int GetOSU( int flag )
 {
@@ -28,50 +32,142 @@ inline int GetOSU( int flag )
 }
 
 
-void	CheckGlErrors( const char* );
+// errors are caught by the driver's debug callback, and charged to the CheckGlErrors( ) after them
+// (see gldebug.h) -- outside a GLDEBUG build this is nothing at all:
+
+#define CheckGlErrors( caller )		GLDEBUG_CHECK( caller )
+
+
+// uniform names are looked up by a hash of the name, not by the pointer to it,
+// so the same name always finds the same location
+// the hash is FNV-1a, and is done by the compiler if the name is a constant:
+//	constexpr UniformName KA( "uKa" );
+
+constexpr unsigned int
+UniformHash( const char *name, unsigned int h = 2166136261u )
+{
+	return *name == '\0'  ?  h  :  UniformHash( name + 1, ( h ^ (unsigned char)*name ) * 16777619u );
+}
+
+struct UniformName
+{
+	unsigned int	Hash;
+	const char *	Name;
+
+	constexpr UniformName( const char *name ) : Hash( UniformHash( name ) ), Name( name ) { }
+};
+
+
+// a uniform that has been looked up once, and remembers its program, location, and type:
+//
+//	setting it is one gl call -- no lookup, no strings, and if glProgramUniform*( ) is there,
+//	the program does not even have to be bound, so a whole batch of uniforms in different
+//	programs can be set without any glUseProgram( ) in between
+//	T is int, float, glm::vec2, glm::vec3, glm::vec4, glm::mat3, or glm::mat4
+//
+//	use:
+//		UniformHandle<float> Ka;
+//		...
+//		Pattern.Create( "pattern.vert", "pattern.frag" );
+//		Ka = Pattern.GetUniform<float>( "uKa" );	// once
+//		...
+//		Ka.Set( 0.1f );					// every frame
+
+template <class T>
+class UniformHandle
+{
+  public:
+	GLuint	Program;
+	GLint	Location;		// -1 if the program does not use it
+
+		UniformHandle( ) : Program( 0 ), Location( -1 ) { }
+
+	bool	IsValid( ) const	{ return Location >= 0; }
+	void	Set( const T & ) const;
+	void	Set( const T *, int ) const;	// an array
+};
 
 
 
 class GLSLProgram
 {
   private:
+	struct ShaderSource
+	{
+		GLenum		Type;
+		char *		File;
+		std::string	Text;
+	};
+
 	std::map<char *, int>	AttributeLocs;
 	char *			Ffile;
 	unsigned int		Fshader;
 	bool			IncludeGstap;
 	GLuint			Program;
-	std::map<char *, int>	UniformLocs;
+	std::map<unsigned int, int>	UniformLocs;	// by UniformHash( name )
 	bool			Valid;
 	char *			Vfile;
 	GLuint			Vshader;
 	bool			Verbose;
+	std::string		Defines;		// from Define( ), as #define lines
+	std::vector<std::pair<std::string, GLuint> >	BlockBindings;	// from SetUniformBlockBinding( )
+	std::vector<std::pair<GLuint, char *> >		Shaders;	// compiling, and their files
+	unsigned long long	CacheKey;
+	bool			Async;			// CreateHelper( ) should not wait for the driver
+	bool			Pending;		// still being compiled and linked
 
-	static int		CurrentProgram;
+	static GLuint		CurrentProgram;
+	static int		CanDoProgramUniform;	// -1 until it has been checked
+	static char *		BinaryCacheDir;		// NULL means no program binary cache
+	static int		BinaryCacheHits, BinaryCacheMisses;
+	static int		CanDoParallelCompile;	// -1 until it has been checked
+	static GLSLProgram *	Fallback;
+	static std::vector<GLSLProgram *>	PendingPrograms;
 
+	void	ApplyBlockBinding( const char *, GLuint );
+	void	ApplyBlockBindings( );
 	void	AttachShader( GLuint );
 	bool	CanDoFragmentShaders;
 	bool	CanDoVertexShaders;
 	int	CompileShader( GLuint );
+	bool	CheckShader( GLuint, char * );
+	void	CompileShaderSource( const ShaderSource & );
 	bool	CreateHelper( char *, ... );
+	bool	FinishBuild( );
 	int	GetAttributeLocation( char * );
 	int	GetUniformLocation( char * );
+	int	GetUniformLocation( UniformName );
+	bool	ExpandIncludes( const std::string &, const std::string &, std::string &, std::vector<std::string> & );
+	void	InjectDefines( std::string & );
+	unsigned long long	HashSources( const std::vector<ShaderSource> & );
+	bool	LinkProgram( );
+	bool	LoadProgramBinary( unsigned long long );
+	void	SaveProgramBinary( unsigned long long );
+	static GLuint	SwitchProgram( GLuint );
 
 
   public:
 		GLSLProgram( );
 
+	void	ClearDefines( );
 	bool	Create( char *, char * = NULL, char * = NULL, char * = NULL, char * = NULL, char * = NULL );
+	bool	CreateAsync( char *, char * = NULL, char * = NULL, char * = NULL, char * = NULL, char * = NULL );
+	void	Define( const char *, const char * = "1" );
 	void	DisableVertexAttribArray( const char * );
 	void	EnableVertexAttribArray( const char * );
 	void	Init( );
 	bool	IsExtensionSupported( const char * );
 	bool	IsNotValid( );
+	bool	IsReady( );
 	bool	IsValid( );
+	template <class T>
+	UniformHandle<T>	GetUniform( UniformName );
 	void	SetAttributePointer3fv( char *, float * );
 	void	SetAttributeVariable( char *, int );
 	void	SetAttributeVariable( char *, float );
 	void	SetAttributeVariable( char *, float, float, float );
 	void	SetAttributeVariable( char *, float[3] );
+	void	SetUniformBlockBinding( char *, GLuint );
 	void	VertexAttrib3f( const char *, float, float, float );
 	void	SetUniformVariable( char *, int );
 	void	SetUniformVariable( char *, float );
@@ -82,6 +178,81 @@ class GLSLProgram
 	void	Use( );
 	void	Use( GLuint );
 	void	UseFixedFunction( );
+
+	static int	GetBinaryCacheHits( );
+	static int	GetBinaryCacheMisses( );
+	static bool	HasProgramUniform( );
+	static int	PollPending( );
+	static void	ProgramUniform( GLuint, GLint, const int *, int );
+	static void	ProgramUniform( GLuint, GLint, const float *, int );
+	static void	ProgramUniform( GLuint, GLint, const glm::vec2 *, int );
+	static void	ProgramUniform( GLuint, GLint, const glm::vec3 *, int );
+	static void	ProgramUniform( GLuint, GLint, const glm::vec4 *, int );
+	static void	ProgramUniform( GLuint, GLint, const glm::mat3 *, int );
+	static void	ProgramUniform( GLuint, GLint, const glm::mat4 *, int );
+	static void	SetBinaryCacheDirectory( const char * );
+	static void	SetFallbackProgram( GLSLProgram * );
 };
 
+
+// every variant of one set of shader files that has been asked for, each compiled with different #defines:
+//
+//	a variant is named by its defines, separated by spaces -- "ELLIPSE", "ELLIPSE LIGHTS=2", or "" for none
+//	the order does not matter: "A B" and "B A" are the same variant
+//	a variant is only compiled the first time it is asked for, and then kept
+//	it is compiled with CreateAsync( ), so it draws with the fallback program until it is ready
+//	(with the program binary cache on, it is usually ready right away)
+//
+//	use:
+//		GLSLVariants Pattern;
+//		Pattern.Init( "pattern.vert", "pattern.frag" );
+//		Pattern.SetUniformBlockBinding( "FrameBlock", UBO_FRAME );	// for every variant
+//		...
+//		GLSLProgram *p = Pattern.Get( ellipseOn ? "ELLIPSE" : "" );
+//		p->Use( );
+
+class GLSLVariants
+{
+  private:
+	char *					Vfile;
+	char *					Ffile;
+	std::map<std::string, GLSLProgram *>	Programs;	// by the sorted define list
+	std::vector<std::pair<std::string, GLuint> >	BlockBindings;
+
+  public:
+		GLSLVariants( );
+
+	GLSLProgram *	Get( const char * );
+	int		GetNumVariants( );
+	void		Init( const char *, const char * );
+	void		SetUniformBlockBinding( const char *, GLuint );
+};
+
+
+template <class T>
+UniformHandle<T>
+GLSLProgram::GetUniform( UniformName name )
+{
+	UniformHandle<T> u;
+	u.Program = this->Program;
+	u.Location = GetUniformLocation( name );
+	return u;
+}
+
+
+template <class T>
+void
+UniformHandle<T>::Set( const T &value ) const
+{
+	GLSLProgram::ProgramUniform( Program, Location, &value, 1 );
+}
+
+
+template <class T>
+void
+UniformHandle<T>::Set( const T *values, int count ) const
+{
+	GLSLProgram::ProgramUniform( Program, Location, values, count );
+}
+
 #endif		// #ifndef GLSLPROGRAM_CPP
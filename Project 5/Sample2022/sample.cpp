@@ -1133,7 +1133,7 @@ InitLists( )
 	// Create the grid:
 
 	GridDL = glGenLists(1);
-	glNewList(GridDL, GL_COMPILE);
+	GLState.BeginList(GridDL, GL_COMPILE);		// SetMaterial( ) goes through GLState, which has to know
 	SetMaterial(0.6f, 0.6f, 0.6f, 30.f);
 	glNormal3f(0., 1., 0.);
 	for (int i = 0; i < NZ; i++)
@@ -1147,7 +1147,7 @@ InitLists( )
 		}
 		glEnd();
 	}
-	glEndList();
+	GLState.EndList();
 
 	SphereDL = glGenLists(1);
 	glNewList(SphereDL, GL_COMPILE);
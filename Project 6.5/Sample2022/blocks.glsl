@@ -0,0 +1,21 @@
+// the uniform blocks that every program shares -- these match the structs in uniformbuffer.h
+// (a shader gets these with:  #include "blocks.glsl" )
+
+// the camera and the light:
+
+layout( std140 ) uniform FrameBlock
+{
+	mat4	uProjection;
+	mat4	uView;
+	vec4	uLightPosition;		// eye coordinates
+	vec4	uLightColor;		// used as the specular color
+};
+
+// lighting coefficients -- these are set once and left alone:
+
+layout( std140 ) uniform MaterialBlock
+{
+	vec4	uColor;			// object color
+	float	uKa, uKd, uKs;		// coefficients of each type of lighting -- make sum to 1.0
+	float	uShininess;		// specular exponent
+};
@@ -0,0 +1,290 @@
+#ifndef OSUSURFACE_CPP
+#define OSUSURFACE_CPP
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <ctype.h>
+
+#include <GL/gl.h>
+
+#include <vector>
+#include <thread>
+
+#ifndef F_PI
+#define F_PI		((float)(M_PI))
+#define F_2_PI		((float)(2.f*F_PI))
+#define F_PI_2		((float)(F_PI/2.f))
+#endif
+
+
+// a generic parametric-surface mesher:
+//
+//	a surface is just a function that takes (u,v), both between 0. and 1., and fills in
+//	the texture coordinate, normal, and position of that point:
+//
+//		void MySurface( float u, float v, struct SurfaceVertex *p );
+//
+//	BuildSurface( ) evaluates it on a (nu+1) x (nv+1) grid, appends the vertices and the
+//	triangle indices to a SurfaceMesh, and throws away triangles that have collapsed
+//	to a line (poles, cone tips, disk centers)
+//
+//	the front face of each triangle is on the side that  dP/du x dP/dv  points to
+//
+//	big grids have their rows evaluated in parallel, so the surface function must not
+//	change any global state
+
+
+// same layout as glInterleavedArrays( GL_T2F_N3F_V3F, ... ):
+
+struct SurfaceVertex
+{
+	float s, t;
+	float nx, ny, nz;
+	float x, y, z;
+};
+
+
+struct SurfaceMesh
+{
+	std::vector<struct SurfaceVertex>	Vertices;
+	std::vector<GLuint>			Indices;
+
+	void	BoundingSphere( float [3], float * ) const;
+	void	Clear( )	{ Vertices.clear( );  Indices.clear( ); }
+	void	Draw( );
+};
+
+
+// fewer grid points than this are not worth starting threads for:
+
+const int SURFACE_MIN_POINTS_PER_THREAD = 8192;
+
+
+inline
+bool
+_SurfaceSamePoint( struct SurfaceVertex *a, struct SurfaceVertex *b )
+{
+	float dx = a->x - b->x;
+	float dy = a->y - b->y;
+	float dz = a->z - b->z;
+	float aa = a->x*a->x + a->y*a->y + a->z*a->z;
+	return  dx*dx + dy*dy + dz*dz  <=  1.e-10f * ( 1.f + aa );
+}
+
+
+template< class SURFACEFUNC >
+void
+_SurfaceRows( SURFACEFUNC f, int nu, int nv, int firstRow, int lastRow, struct SurfaceVertex *out )
+{
+	for( int iv = firstRow; iv < lastRow; iv++ )
+	{
+		float v = (float)iv / (float)nv;
+		struct SurfaceVertex *row = &out[ iv*(nu+1) ];
+		for( int iu = 0; iu <= nu; iu++ )
+		{
+			f( (float)iu / (float)nu, v, &row[iu] );
+		}
+	}
+}
+
+
+template< class SURFACEFUNC >
+void
+BuildSurface( SURFACEFUNC f, int nu, int nv, struct SurfaceMesh *mesh )
+{
+	if( nu < 1 )	nu = 1;
+	if( nv < 1 )	nv = 1;
+
+	int numRows   = nv + 1;
+	int numPoints = ( nu + 1 ) * numRows;
+	int first     = (int)mesh->Vertices.size( );
+	mesh->Vertices.resize( first + numPoints );
+	struct SurfaceVertex *out = &mesh->Vertices[first];
+
+	// evaluate the grid, splitting the rows among threads if it is big enough:
+
+	int numThreads = (int)std::thread::hardware_concurrency( );
+	if( numThreads > numPoints / SURFACE_MIN_POINTS_PER_THREAD )
+		numThreads = numPoints / SURFACE_MIN_POINTS_PER_THREAD;
+	if( numThreads > numRows )
+		numThreads = numRows;
+
+	if( numThreads <= 1 )
+	{
+		_SurfaceRows( f, nu, nv, 0, numRows, out );
+	}
+	else
+	{
+		std::vector<std::thread> threads;
+		for( int it = 1; it < numThreads; it++ )
+		{
+			int firstRow = numRows * it / numThreads;
+			int lastRow  = numRows * (it+1) / numThreads;
+			threads.push_back( std::thread( _SurfaceRows<SURFACEFUNC>, f, nu, nv, firstRow, lastRow, out ) );
+		}
+		_SurfaceRows( f, nu, nv, 0, numRows / numThreads, out );		// this thread does the first chunk
+		for( int it = 0; it < (int)threads.size( ); it++ )
+			threads[it].join( );
+	}
+
+	// two triangles per grid cell, skipping the ones that have collapsed:
+
+	mesh->Indices.reserve( mesh->Indices.size( ) + 6*nu*nv );
+	for( int iv = 0; iv < nv; iv++ )
+	{
+		for( int iu = 0; iu < nu; iu++ )
+		{
+			GLuint i00 = first + (iv+0)*(nu+1) + (iu+0);
+			GLuint i10 = first + (iv+0)*(nu+1) + (iu+1);
+			GLuint i01 = first + (iv+1)*(nu+1) + (iu+0);
+			GLuint i11 = first + (iv+1)*(nu+1) + (iu+1);
+
+			struct SurfaceVertex *p00 = &mesh->Vertices[i00];
+			struct SurfaceVertex *p10 = &mesh->Vertices[i10];
+			struct SurfaceVertex *p01 = &mesh->Vertices[i01];
+			struct SurfaceVertex *p11 = &mesh->Vertices[i11];
+
+			if( ! _SurfaceSamePoint( p00, p10 )  &&  ! _SurfaceSamePoint( p10, p11 )  &&  ! _SurfaceSamePoint( p11, p00 ) )
+			{
+				mesh->Indices.push_back( i00 );
+				mesh->Indices.push_back( i10 );
+				mesh->Indices.push_back( i11 );
+			}
+
+			if( ! _SurfaceSamePoint( p00, p11 )  &&  ! _SurfaceSamePoint( p11, p01 )  &&  ! _SurfaceSamePoint( p01, p00 ) )
+			{
+				mesh->Indices.push_back( i00 );
+				mesh->Indices.push_back( i11 );
+				mesh->Indices.push_back( i01 );
+			}
+		}
+	}
+}
+
+
+// a sphere around every vertex, for frustum culling -- it is centered in the box around them,
+// and reaches the farthest one:
+
+void
+SurfaceMesh::BoundingSphere( float center[3], float *radius ) const
+{
+	center[0] = center[1] = center[2] = 0.;
+	*radius = 0.;
+	if( Vertices.empty( ) )
+		return;
+
+	float lo[3] = { Vertices[0].x, Vertices[0].y, Vertices[0].z };
+	float hi[3] = { Vertices[0].x, Vertices[0].y, Vertices[0].z };
+	for( int i = 1; i < (int)Vertices.size( ); i++ )
+	{
+		float p[3] = { Vertices[i].x, Vertices[i].y, Vertices[i].z };
+		for( int k = 0; k < 3; k++ )
+		{
+			if( p[k] < lo[k] )	lo[k] = p[k];
+			if( p[k] > hi[k] )	hi[k] = p[k];
+		}
+	}
+	for( int k = 0; k < 3; k++ )
+		center[k] = 0.5f * ( lo[k] + hi[k] );
+
+	float r2 = 0.;
+	for( int i = 0; i < (int)Vertices.size( ); i++ )
+	{
+		float dx = Vertices[i].x - center[0];
+		float dy = Vertices[i].y - center[1];
+		float dz = Vertices[i].z - center[2];
+		float d2 = dx*dx + dy*dy + dz*dz;
+		if( d2 > r2 )
+			r2 = d2;
+	}
+	*radius = sqrtf( r2 );
+}
+
+
+// draw the mesh with client-side vertex arrays
+// (this works inside a glNewList( ) -- the arrays get copied into the display list)
+
+void
+SurfaceMesh::Draw( )
+{
+	if( Indices.empty( ) )
+		return;
+
+	glPushClientAttrib( GL_CLIENT_VERTEX_ARRAY_BIT );
+	glInterleavedArrays( GL_T2F_N3F_V3F, 0, &Vertices[0] );
+	glDrawElements( GL_TRIANGLES, (GLsizei)Indices.size( ), GL_UNSIGNED_INT, &Indices[0] );
+	glPopClientAttrib( );
+}
+
+
+// new shapes are just one more surface function -- for example, a flat ring for a planet
+// (the t texture coordinate goes from the inside edge to the outside edge):
+
+void
+OsuRing( float innerRadius, float outerRadius, int slices )
+{
+	if( slices < 4 )	slices = 4;
+
+	struct SurfaceMesh mesh;
+	BuildSurface(
+		[=]( float u, float v, struct SurfaceVertex *p )
+		{
+			float lng = -F_PI + F_2_PI * u;
+			float rad = outerRadius + v * ( innerRadius - outerRadius );
+			p->s = u;		p->t = 1.f - v;
+			p->nx = 0.;		p->ny = 1.;		p->nz = 0.;
+			p->x = rad * sinf( lng );
+			p->y = 0.;
+			p->z = rad * cosf( lng );
+		},
+		slices, 1, &mesh );
+	mesh.Draw( );
+}
+
+
+// and a superquadric (e1 and e2 control the squareness in latitude and longitude;
+//	1.,1. is a sphere, small numbers are boxier, 2. makes points):
+
+inline
+float
+_SuperPow( float c, float e )
+{
+	float a = powf( (float)fabs( c ), e );
+	return c < 0. ? -a : a;
+}
+
+
+void
+OsuSuperquadric( float radius, float e1, float e2, int slices, int stacks )
+{
+	if( slices < 4 )	slices = 4;
+	if( stacks < 4 )	stacks = 4;
+
+	struct SurfaceMesh mesh;
+	BuildSurface(
+		[=]( float u, float v, struct SurfaceVertex *p )
+		{
+			float lat = -F_PI_2 + F_PI * v;
+			float lng = -F_PI + F_2_PI * u;
+			float clat = cosf( lat ), slat = sinf( lat );
+			float clng = cosf( lng ), slng = sinf( lng );
+			p->s = u;		p->t = v;
+			p->x = radius * _SuperPow( clat, e1 ) * _SuperPow( slng, e2 );
+			p->y = radius * _SuperPow( slat, e1 );
+			p->z = radius * _SuperPow( clat, e1 ) * _SuperPow( clng, e2 );
+			p->nx = _SuperPow( clat, 2.f-e1 ) * _SuperPow( slng, 2.f-e2 );
+			p->ny = _SuperPow( slat, 2.f-e1 );
+			p->nz = _SuperPow( clat, 2.f-e1 ) * _SuperPow( clng, 2.f-e2 );
+			float len = sqrtf( p->nx*p->nx + p->ny*p->ny + p->nz*p->nz );
+			if( len > 0. )
+			{
+				p->nx /= len;	p->ny /= len;	p->nz /= len;
+			}
+		},
+		slices, stacks, &mesh );
+	mesh.Draw( );
+}
+
+#endif		// #ifndef OSUSURFACE_CPP
@@ -1,16 +1,22 @@
 // make this 120 for the mac:
 #version 330 compatibility
 
-// lighting uniform variables -- these can be set once and left alone:
-uniform float   uKa, uKd, uKs;		// coefficients of each type of lighting -- make sum to 1.0
-uniform vec3    uColor;			// object color
-uniform vec3    uSpecularColor;		// light color
-uniform float   uShininess;		// specular exponent
+// the light and the lighting coefficients, shared by every program:
 
-// ellipse-equation uniform variables -- these should be set every time Display( ) is called:
+#include "blocks.glsl"
 
-uniform float	uSc, uTc;
-uniform float	uRs, uRt;
+// the ellipse is only compiled in when the program asks for the ELLIPSE variant:
+
+#ifdef ELLIPSE
+
+// ellipse-equation variables -- these are set every time Display( ) is called:
+
+layout( std140 ) uniform EllipseBlock
+{
+	vec4	uEllipse;		// ( sc, tc, rs, rt )
+};
+
+#endif
 
 // in variables from the vertex shader and interpolated in the rasterizer:
 
@@ -31,11 +37,17 @@ main( )
 
 	// determine the color using the ellipse equation:
 
-	vec3 myColor = uColor;
+	vec3 myColor = uColor.rgb;
+#ifdef ELLIPSE
+	float uSc = uEllipse.x;
+	float uTc = uEllipse.y;
+	float uRs = uEllipse.z;
+	float uRt = uEllipse.w;
 	if( ((s-uSc)/uRs)*((s-uSc)/uRs) + ((t-uTc)/uRt)*((t-uTc)/uRt) <= 1 )
 	{
 		myColor = vec3( 1., 1., 0. );
 	}
+#endif
 
 	// apply the per-fragmewnt lighting to myColor:
 
@@ -50,6 +62,6 @@ main( )
 		vec3 ref = normalize(  reflect( -Light, Normal )  );
 		ss = pow( max( dot(Eye,ref),0. ), uShininess );
 	}
-	vec3 specular = uKs * ss * uSpecularColor;
+	vec3 specular = uKs * ss * uLightColor.rgb;
 	gl_FragColor = vec4( ambient + diffuse + specular,  1. );
 }
\ No newline at end of file
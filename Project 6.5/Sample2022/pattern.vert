@@ -8,9 +8,9 @@ out  vec3  vL;	  // vector from point to light
 out  vec3  vE;	  // vector from point to eye
 out  vec2  vST;	  // (s,t) texture coordinates
 
-// where the light is:
+// the camera and the light, shared by every program:
 
-const vec3 LightPosition = vec3(  0., 5., 5. );
+#include "blocks.glsl"
 
 void
 main( )
@@ -18,9 +18,9 @@ main( )
 	vST = gl_MultiTexCoord0.st;
 	vec4 ECposition = gl_ModelViewMatrix * gl_Vertex;
 	vN = normalize( gl_NormalMatrix * gl_Normal );  // normal vector
-	vL = LightPosition - ECposition.xyz;	    // vector from the point
+	vL = uLightPosition.xyz - ECposition.xyz;	    // vector from the point
 							// to the light position
 	vE = vec3( 0., 0., 0. ) - ECposition.xyz;       // vector from the point
 							// to the eye position
-	gl_Position = gl_ModelViewProjectionMatrix * gl_Vertex;
+	gl_Position = uProjection * ECposition;
 }
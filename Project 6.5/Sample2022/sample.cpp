@@ -241,13 +241,16 @@ MulArray3(float factor, float a, float b, float c )
 //#include "loadobjfile.cpp"
 #include "keytime.cpp"
 #include "glslprogram.cpp"
+#include "uniformbuffer.cpp"
 
 float NowS0, NowT0, NowD;
 float sc, tc, rs, rt;
 bool KeytimePatternOn;
 bool TimePatternOn;
 
-GLSLProgram Pattern;
+GLSLVariants Pattern;			// with and without the ellipse
+UniformBuffer PatternMaterial;		// the pattern's lighting coefficients, uploaded once
+UniformRing Uniforms;			// the frame block and the ellipse, new every frame
 Keytimes Sc;
 Keytimes Tc;
 
@@ -407,9 +410,25 @@ Display( )
 	glEnable( GL_NORMALIZE );
 
 
-	// set the uniform variables that will change over time:
+	// the camera and light go to every program at once, through the frame block:
+
+	GLDEBUG_PUSH( "Pattern" );
+	Uniforms.BeginFrame( );
+	FrameBlock frame;
+	glGetFloatv( GL_PROJECTION_MATRIX, &frame.Projection[0][0] );
+	glGetFloatv( GL_MODELVIEW_MATRIX, &frame.View[0][0] );
+	frame.LightPosition = glm::vec4( 0., 5., 5., 1. );
+	frame.LightColor = glm::vec4( 1., 1., 1., 1. );
+	Uniforms.Bind( UBO_FRAME, &frame, sizeof(frame) );
+	PatternMaterial.Bind( );
+
+	// the ellipse is only there when one of the patterns is on, so otherwise
+	// use the variant that does not have it compiled in at all:
 
-	Pattern.Use();
+	GLSLProgram *pattern = Pattern.Get( ( KeytimePatternOn || TimePatternOn )  ?  "ELLIPSE"  :  "" );
+	pattern->Use();
+
+	// set the uniform variables that will change over time:
 
 	// Calculate scaling factors based on time
 	float scale_factor_s = sin(Time);  // Adjust the amplitude and frequency as needed
@@ -433,14 +452,14 @@ Display( )
 
 
 	// Update the uniform variables
-	Pattern.SetUniformVariable("uSc", sc);
-	Pattern.SetUniformVariable("uTc", tc);
-	Pattern.SetUniformVariable("uRs", sin_radius);
-	Pattern.SetUniformVariable("uRt", cos_radius);
+	glm::vec4 ellipse( sc, tc, sin_radius, cos_radius );
+	Uniforms.Bind( UBO_DRAW, &ellipse, sizeof(ellipse) );
 
 	glCallList( SphereList );
 
-	Pattern.UnUse( );       // Pattern.Use(0);  also works
+	pattern->UnUse( );       // pattern->Use(0);  also works
+	Uniforms.EndFrame( );
+	GLDEBUG_POP( );
 
 
 	// draw some gratuitous text that just rotates on top of the scene:
@@ -665,6 +684,10 @@ InitGraphics( )
 	glutInitWindowPosition( 0, 0 );
 	glutInitWindowSize( INIT_WINDOW_SIZE, INIT_WINDOW_SIZE );
 
+	// in a GLDEBUG build, ask for a context that reports its errors through a callback:
+
+	GLDEBUG_CONTEXT( );
+
 	// open the window and set its title:
 
 	MainWindow = glutCreateWindow( WINDOWTITLE );
@@ -724,8 +747,8 @@ InitGraphics( )
 	glutIdleFunc( Animate );
 
 	// init the glew package (a window must be open to do this):
+	// (on every platform -- the uniform buffers and rings come through glew's entry points)
 
-#ifdef WIN32
 	GLenum err = glewInit( );
 	if( err != GLEW_OK )
 	{
@@ -734,27 +757,42 @@ InitGraphics( )
 	else
 		fprintf( stderr, "GLEW initialized OK\n" );
 	fprintf( stderr, "Status: Using GLEW %s\n", glewGetString(GLEW_VERSION));
-#endif
+
+	GLDEBUG_INIT( );
 
 	// all other setups go here, such as GLSLProgram and KeyTime setups:
 
-	Pattern.Init( );
-	bool valid = Pattern.Create( "pattern.vert", "pattern.frag" );
-	if( !valid )
-		fprintf( stderr, "Could not create the Pattern shader!\n" );
-	else
-		fprintf( stderr, "Pattern shader created!\n" );
+	// linked programs are kept in shadercache/, so the next run does not have to compile them:
+
+	GLSLProgram::SetBinaryCacheDirectory( "shadercache" );
+
+	// each variant of the pattern shader is compiled the first time it is asked for:
+
+	Pattern.Init( "pattern.vert", "pattern.frag" );
+
+	// the uniform variables are all in uniform blocks -- connect them to their binding points:
+
+	Pattern.SetUniformBlockBinding( "FrameBlock", UBO_FRAME );
+	Pattern.SetUniformBlockBinding( "MaterialBlock", UBO_MATERIAL );
+	Pattern.SetUniformBlockBinding( "EllipseBlock", UBO_DRAW );
+
+	// start both variants compiling now, so the driver works on them while everything else is set up
+	// (until one is ready, it draws with the fixed-function pipeline):
+
+	Pattern.Get( "" );
+	Pattern.Get( "ELLIPSE" );
 
 	// set the uniform variables that will not change:
-	
-	Pattern.Use( );
-	Pattern.SetUniformVariable( "uKa", 0.1f );
-	Pattern.SetUniformVariable( "uKd", 0.5f );
-	Pattern.SetUniformVariable( "uKs", 0.4f );
-	Pattern.SetUniformVariable( "uColor", 1.f, 0.5f, 0.f );
-	Pattern.SetUniformVariable( "uSpecularColor", 1.f, 1.f, 1.f );
-	Pattern.SetUniformVariable( "uShininess", 12.f );
-	Pattern.UnUse( );
+
+	MaterialBlock orange;
+	orange.Color = glm::vec4( 1., 0.5, 0., 1. );
+	orange.Ka = 0.1f;
+	orange.Kd = 0.5f;
+	orange.Ks = 0.4f;
+	orange.Shininess = 12.f;
+	PatternMaterial.Init( sizeof(orange), UBO_MATERIAL, &orange );
+
+	Uniforms.Init( 4 * 1024 );
 }
 
 
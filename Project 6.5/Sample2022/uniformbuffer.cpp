@@ -0,0 +1,115 @@
+#ifndef UNIFORMBUFFER_CPP
+#define UNIFORMBUFFER_CPP
+
+#include "uniformbuffer.h"
+#include "gldebug.cpp"
+
+#include <string.h>
+
+
+UniformBuffer::UniformBuffer( )
+{
+	Buffer = 0;
+	Size = 0;
+	Binding = 0;
+}
+
+
+void
+UniformBuffer::Init( GLsizeiptr size, GLuint binding, const void *data )
+{
+	Size = size;
+	Binding = binding;
+	if( Buffer == 0 )
+		glGenBuffers( 1, &Buffer );
+	glBindBuffer( GL_UNIFORM_BUFFER, Buffer );
+	GLDEBUG_LABEL( GL_BUFFER, Buffer, "UniformBuffer" );
+	glBufferData( GL_UNIFORM_BUFFER, size, data, GL_STATIC_DRAW );
+	glBindBuffer( GL_UNIFORM_BUFFER, 0 );
+}
+
+
+// replace everything in it:
+
+void
+UniformBuffer::Update( const void *data )
+{
+	glBindBuffer( GL_UNIFORM_BUFFER, Buffer );
+	glBufferSubData( GL_UNIFORM_BUFFER, 0, Size, data );
+	glBindBuffer( GL_UNIFORM_BUFFER, 0 );
+}
+
+
+// make it the block that its binding point gives every program:
+
+void
+UniformBuffer::Bind( )
+{
+	glBindBufferBase( GL_UNIFORM_BUFFER, Binding, Buffer );
+}
+
+
+// the ring is UNIFORM_RING_FRAMES pieces of bytesPerFrame each:
+
+void
+UniformRing::Init( GLsizeiptr bytesPerFrame )
+{
+	GLint alignment = 256;
+	glGetIntegerv( GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment );
+	Stream.Init( GL_UNIFORM_BUFFER, bytesPerFrame, alignment < 1  ?  256  :  alignment, "UniformRing" );
+}
+
+
+// wait until the gpu is done with the piece of the ring this frame is going to write over:
+
+void
+UniformRing::BeginFrame( )
+{
+	Stream.BeginFrame( );
+}
+
+
+// copy a block into this frame's piece of the ring, and return where it went:
+// (-1 if there is no room left)
+
+GLintptr
+UniformRing::Push( const void *data, GLsizeiptr size )
+{
+	return Stream.Push( data, size );
+}
+
+
+// push a block and make it the one the binding point gives every program:
+
+void
+UniformRing::Bind( GLuint binding, const void *data, GLsizeiptr size )
+{
+	GLintptr offset = Push( data, size );
+	if( offset >= 0 )
+		glBindBufferRange( GL_UNIFORM_BUFFER, binding, Stream.GetBuffer( ), offset, size );
+}
+
+
+// mark where the gpu will be done with this frame's piece:
+
+void
+UniformRing::EndFrame( )
+{
+	Stream.EndFrame( );
+}
+
+
+int
+UniformRing::GetStalls( )
+{
+	return Stream.GetStalls( );
+}
+
+
+void
+UniformRing::PrintStats( FILE *fp )
+{
+	Stream.PrintStats( fp );
+}
+
+#endif		// #ifndef UNIFORMBUFFER_CPP
@@ -0,0 +1,113 @@
+#ifndef UNIFORMBUFFER_H
+#define UNIFORMBUFFER_H
+
+#include <stdio.h>
+
+#include "glew.h"
+#include <GL/gl.h>
+
+#include "glm/glm.hpp"
+#include "gldebug.h"
+
+#include "streambuffer.cpp"
+
+
+// uniform buffer objects -- uniforms that live in a buffer, so that every program that
+// declares the same block sees the same values, and they are set once instead of once per program:
+//
+//	the blocks below are std140, and match these declarations in a shader:
+//
+//		layout( std140 ) uniform FrameBlock
+//		{
+//			mat4	uProjection;
+//			mat4	uView;
+//			vec4	uLightPosition;		// eye coordinates
+//			vec4	uLightColor;
+//		};
+//
+//		layout( std140 ) uniform MaterialBlock
+//		{
+//			vec4	uColor;
+//			float	uKa, uKd, uKs;
+//			float	uShininess;
+//		};
+//
+//	each program connects its blocks to the binding points once, after it is created:
+//		Pattern.SetUniformBlockBinding( "FrameBlock",    UBO_FRAME );
+//		Pattern.SetUniformBlockBinding( "MaterialBlock", UBO_MATERIAL );
+//
+//	things that are set once (materials) go in a UniformBuffer
+//	things that change every frame or every draw go in the UniformRing, which hands out
+//	a new piece of one big buffer for each Push( ), so nothing the gpu is still reading gets overwritten
+//
+//	use:
+//		UniformBuffer Orange;
+//		UniformRing Ring;
+//		Orange.Init( sizeof(MaterialBlock), UBO_MATERIAL, &orange );	// once
+//		Ring.Init( 64*1024 );
+//		...
+//		Ring.BeginFrame( );
+//		Ring.Bind( UBO_FRAME, &frame, sizeof(frame) );
+//		Orange.Bind( );
+//		...draw...
+//		Ring.EndFrame( );
+
+const GLuint UBO_FRAME    = 0;		// binding points
+const GLuint UBO_MATERIAL = 1;
+const GLuint UBO_DRAW     = 2;		// whatever a shader wants per draw
+
+struct FrameBlock
+{
+	glm::mat4	Projection;
+	glm::mat4	View;
+	glm::vec4	LightPosition;
+	glm::vec4	LightColor;
+};
+
+struct MaterialBlock
+{
+	glm::vec4	Color;
+	float		Ka, Kd, Ks;
+	float		Shininess;
+};
+
+static_assert( sizeof(FrameBlock) == 160,  "FrameBlock does not match its std140 layout" );
+static_assert( sizeof(MaterialBlock) == 32, "MaterialBlock does not match its std140 layout" );
+
+
+class UniformBuffer
+{
+  private:
+	GLuint		Buffer;
+	GLsizeiptr	Size;
+	GLuint		Binding;
+
+  public:
+		UniformBuffer( );
+
+	void	Bind( );
+	void	Init( GLsizeiptr, GLuint, const void * = NULL );
+	void	Update( const void * );
+};
+
+
+const int UNIFORM_RING_FRAMES = STREAM_FRAMES;	// how many frames the gpu might be behind
+
+// a StreamBuffer of uniform blocks, handed out on GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT boundaries:
+
+class UniformRing
+{
+  private:
+	StreamBuffer	Stream;
+
+  public:
+	void	BeginFrame( );
+	void	Bind( GLuint, const void *, GLsizeiptr );
+	void	EndFrame( );
+	int	GetStalls( );
+	void	Init( GLsizeiptr );
+	void	PrintStats( FILE * );
+	GLintptr	Push( const void *, GLsizeiptr );
+};
+
+#endif		// #ifndef UNIFORMBUFFER_H
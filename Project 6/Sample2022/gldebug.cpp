@@ -0,0 +1,276 @@
+#ifndef GLDEBUG_CPP
+#define GLDEBUG_CPP
+
+#include "gldebug.h"
+
+#ifdef GLDEBUG
+
+#include <string.h>
+
+
+GLDebugLog	GLDebug;
+
+// these come from the driver, not from glew, so they are there even if glewInit( ) was never called:
+
+static PFNGLDEBUGMESSAGECALLBACKPROC	GLDebugMessageCallback;
+static PFNGLDEBUGMESSAGECONTROLPROC	GLDebugMessageControl;
+static PFNGLOBJECTLABELPROC		GLDebugObjectLabel;
+static PFNGLPUSHDEBUGGROUPPROC		GLDebugPushGroup;
+static PFNGLPOPDEBUGGROUPPROC		GLDebugPopGroup;
+
+
+// look for the core name first, then the KHR one:
+
+static GLUTproc
+GLDebugGetProc( const char *name )
+{
+	GLUTproc proc = glutGetProcAddress( name );
+	if( proc == NULL )
+	{
+		std::string khr = std::string( name ) + "KHR";
+		proc = glutGetProcAddress( khr.c_str( ) );
+	}
+	return proc;
+}
+
+
+static const char *
+GLDebugErrorName( GLenum gle )
+{
+	switch( gle )
+	{
+		case GL_INVALID_ENUM:			return "Invalid enum.";
+		case GL_INVALID_VALUE:			return "Invalid value.";
+		case GL_INVALID_OPERATION:		return "Invalid Operation.";
+		case GL_STACK_OVERFLOW:			return "Stack overflow.";
+		case GL_STACK_UNDERFLOW:		return "Stack underflow.";
+		case GL_OUT_OF_MEMORY:			return "Out of memory.";
+		case GL_INVALID_FRAMEBUFFER_OPERATION:	return "Invalid framebuffer operation.";
+		default:				return "Unknown error.";
+	}
+}
+
+
+GLDebugLog::GLDebugLog( )
+{
+	HaveCallback = false;
+	Unclaimed = UnclaimedOthers = 0;
+}
+
+
+// hook up the callback -- a window (and its context) must be open to do this:
+//
+//	synchronous means the driver calls Message( ) from inside the gl call that went wrong,
+//	so the error always lands on the right GLDEBUG_CHECK( )
+//	the driver is slower that way, but this is a debug build
+
+void
+GLDebugLog::Init( bool synchronous )
+{
+	GLDebugMessageCallback = (PFNGLDEBUGMESSAGECALLBACKPROC) GLDebugGetProc( "glDebugMessageCallback" );
+	GLDebugMessageControl  = (PFNGLDEBUGMESSAGECONTROLPROC)  GLDebugGetProc( "glDebugMessageControl" );
+	GLDebugObjectLabel     = (PFNGLOBJECTLABELPROC)          GLDebugGetProc( "glObjectLabel" );
+	GLDebugPushGroup       = (PFNGLPUSHDEBUGGROUPPROC)       GLDebugGetProc( "glPushDebugGroup" );
+	GLDebugPopGroup        = (PFNGLPOPDEBUGGROUPPROC)        GLDebugGetProc( "glPopDebugGroup" );
+
+	if( GLDebugMessageCallback == NULL  ||  GLDebugMessageControl == NULL )
+	{
+		fprintf( stderr, "GLDebug: the driver does not have KHR_debug -- checking with glGetError( ) instead\n" );
+		HaveCallback = false;
+		return;
+	}
+
+	glEnable( GL_DEBUG_OUTPUT );
+	if( synchronous )
+		glEnable( GL_DEBUG_OUTPUT_SYNCHRONOUS );
+	else
+		glDisable( GL_DEBUG_OUTPUT_SYNCHRONOUS );
+
+	// the driver says a lot of things that are just for information -- leave those out:
+
+	( *GLDebugMessageControl )( GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, NULL, GL_FALSE );
+	( *GLDebugMessageCallback )( Message, this );
+	HaveCallback = true;
+
+	// anything that went wrong before now has no site, and is not in the callback's list:
+
+	while( glGetError( ) != GL_NO_ERROR )
+		;
+}
+
+
+// the driver calls this -- it only counts, since nothing can be said about where it came from
+// until the next check:
+
+void GLAPIENTRY
+GLDebugLog::Message( GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length,
+	const GLchar *message, const void *userParam )
+{
+	GLDebugLog *log = (GLDebugLog *) userParam;
+	if( severity == GL_DEBUG_SEVERITY_NOTIFICATION  ||  source == GL_DEBUG_SOURCE_APPLICATION )
+		return;
+
+	if( type == GL_DEBUG_TYPE_ERROR )
+		log->Unclaimed++;
+	else
+		log->UnclaimedOthers++;
+
+	if( log->UnclaimedFirst.empty( )  ||  ( type == GL_DEBUG_TYPE_ERROR  &&  log->Unclaimed == 1 ) )
+	{
+		log->UnclaimedFirst = std::string( message, length >= 0 ? (size_t)length : strlen( message ) );
+		if( ! log->Groups.empty( ) )
+			log->UnclaimedFirst = std::string( "[" ) + log->Groups.back( ) + "] " + log->UnclaimedFirst;
+	}
+}
+
+
+// charge what has come in since the last check to this site:
+
+void
+GLDebugLog::Check( const char *site, const char *file, int line )
+{
+	if( ! HaveCallback )
+	{
+		for( GLenum gle = glGetError( ); gle != GL_NO_ERROR; gle = glGetError( ) )
+		{
+			if( Unclaimed++ == 0 )
+				UnclaimedFirst = GLDebugErrorName( gle );
+		}
+	}
+
+	if( Unclaimed == 0  &&  UnclaimedOthers == 0 )
+		return;
+	Charge( site, file, line );
+}
+
+
+void
+GLDebugLog::Charge( const char *site, const char *file, int line )
+{
+	const char *slash = strrchr( file, '/' );
+	const char *back  = strrchr( file, '\\' );
+	if( back > slash )
+		slash = back;
+	if( slash != NULL )
+		file = slash + 1;
+
+	char where[32];
+	snprintf( where, sizeof(where), ":%d)", line );
+	std::string key = std::string( site ) + " (" + file + where;
+
+	std::map<std::string,Site>::iterator it = Sites.find( key );
+	if( it == Sites.end( ) )
+	{
+		// the first time at a site, say what happened -- after that, just count it:
+
+		fprintf( stderr, "GL %s discovered from caller %s: %s\n",
+			Unclaimed > 0 ? "Error" : "warning", key.c_str( ), UnclaimedFirst.c_str( ) );
+		Site s;
+		s.Errors = s.Others = 0;
+		s.First = UnclaimedFirst;
+		it = Sites.insert( std::pair<std::string,Site>( key, s ) ).first;
+	}
+	it->second.Errors += Unclaimed;
+	it->second.Others += UnclaimedOthers;
+
+	Unclaimed = UnclaimedOthers = 0;
+	UnclaimedFirst.clear( );
+}
+
+
+// forget what has come in since the last check -- for errors that are expected:
+
+void
+GLDebugLog::Discard( )
+{
+	if( ! HaveCallback )
+	{
+		while( glGetError( ) != GL_NO_ERROR )
+			;
+	}
+	Unclaimed = UnclaimedOthers = 0;
+	UnclaimedFirst.clear( );
+}
+
+
+int
+GLDebugLog::GetErrors( )
+{
+	int errors = Unclaimed;
+	for( std::map<std::string,Site>::iterator it = Sites.begin( ); it != Sites.end( ); it++ )
+		errors += it->second.Errors;
+	return errors;
+}
+
+
+// give a gl object a name that shows up in the driver's messages and in gl debuggers:
+// (the object has to have been bound once, so that it really exists)
+
+void
+GLDebugLog::Label( GLenum type, GLuint id, const char *name )
+{
+	if( GLDebugObjectLabel != NULL  &&  id != 0 )
+		( *GLDebugObjectLabel )( type, id, -1, name );
+}
+
+
+void
+GLDebugLog::PushGroup( const char *name )
+{
+	Groups.push_back( name );
+	if( GLDebugPushGroup != NULL )
+		( *GLDebugPushGroup )( GL_DEBUG_SOURCE_APPLICATION, 0, -1, name );
+}
+
+
+// whatever was not checked inside the group is charged to the group:
+
+void
+GLDebugLog::PopGroup( const char *file, int line )
+{
+	if( Groups.empty( ) )
+		return;
+	Check( Groups.back( ), file, line );
+	if( GLDebugPopGroup != NULL )
+		( *GLDebugPopGroup )( );
+	Groups.pop_back( );
+}
+
+
+void
+GLDebugLog::PrintStats( FILE *fp )
+{
+	if( Sites.empty( )  &&  Unclaimed == 0 )
+	{
+		fprintf( fp, "GLDebug: no gl errors\n" );
+		return;
+	}
+
+	fprintf( fp, "GLDebug: %d gl errors\n", GetErrors( ) );
+	for( std::map<std::string,Site>::iterator it = Sites.begin( ); it != Sites.end( ); it++ )
+	{
+		fprintf( fp, "\t%5d errors, %5d warnings\t%s\n",
+			it->second.Errors, it->second.Others, it->first.c_str( ) );
+		fprintf( fp, "\t\t\t\t\tfirst: %s\n", it->second.First.c_str( ) );
+	}
+	if( Unclaimed > 0 )
+		fprintf( fp, "\t%5d errors since the last check\n", Unclaimed );
+}
+
+
+GLDebugGroup::GLDebugGroup( const char *name, const char *file, int line )
+{
+	File = file;
+	Line = line;
+	GLDebug.PushGroup( name );
+}
+
+
+GLDebugGroup::~GLDebugGroup( )
+{
+	GLDebug.PopGroup( File, Line );
+}
+
+#endif		// #ifdef GLDEBUG
+
+#endif		// #ifndef GLDEBUG_CPP
@@ -1,4 +1,14 @@
 #include "glslprogram.h"
+#include "freeglut_ext.h"
+#include "gldebug.cpp"
+
+#include <algorithm>
+
+#ifdef WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#endif
 
 
 struct GLshadertype
@@ -35,9 +45,33 @@ GetExtension( char *file )
 }
 
 
-GLSLProgram::GLSLProgram( )
+// read a whole file into a string:
+
+static bool
+ReadTextFile( const char *file, std::string &text )
 {
+	FILE *in = fopen( file, "rb" );
+	if( in == NULL )
+		return false;
 
+	fseek( in, 0, SEEK_END );
+	long length = ftell( in );
+	fseek( in, 0, SEEK_SET );		// rewind
+	text.resize( length );
+	if( length > 0 )
+		fread( &text[0], sizeof(GLchar), length, in );
+	fclose( in );
+	return true;
+}
+
+
+GLSLProgram::GLSLProgram( )
+{
+	Program = 0;
+	Valid = false;
+	Verbose = false;
+	Async = false;
+	Pending = false;
 }
 
 
@@ -53,19 +87,119 @@ GLSLProgram::Create( char *file0, char *file1, char *file2, char *file3, char *
 }
 
 
+// asynchronous creation -- the shaders are handed to the driver and this returns right away:
+//
+//	with GL_KHR_parallel_shader_compile (or the ARB one), the driver compiles and links on its own
+//	threads, and IsReady( ) asks it, without waiting, whether it is done
+//	without it, there is no portable way to get a second context through glut, so the compile
+//	is still just started here, and it is finished (waiting, if the driver is not done yet) the
+//	first time IsReady( ) is called -- with the driver's own background compiling, that still
+//	overlaps with whatever the program does in between
+//
+//	until it is ready, Use( ) binds the fallback program (SetFallbackProgram( ), or the fixed-function
+//	pipeline if there is none), so the scene still draws
+//
+//	use:
+//		A.CreateAsync( "a.vert", "a.frag" );
+//		B.CreateAsync( "b.vert", "b.frag" );	// all of them, up front
+//		...load textures, models, etc....
+//		while( GLSLProgram::PollPending( ) > 0 )	// if everything has to be there before the first frame
+//			;
+
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR	0x91B1
+#endif
+
+typedef void (GLAPIENTRY *MaxShaderCompilerThreadsProc)( GLuint );
+
+int			GLSLProgram::CanDoParallelCompile = -1;
+GLSLProgram *		GLSLProgram::Fallback = NULL;
+std::vector<GLSLProgram *>	GLSLProgram::PendingPrograms;
+
+
+bool
+GLSLProgram::CreateAsync( char *file0, char *file1, char *file2, char *file3, char * file4, char *file5 )
+{
+	if( CanDoParallelCompile < 0 )
+	{
+		CanDoParallelCompile = 0;
+		const char *threads = NULL;
+		if( IsExtensionSupported( "GL_KHR_parallel_shader_compile" ) )
+			threads = "glMaxShaderCompilerThreadsKHR";
+		else if( IsExtensionSupported( "GL_ARB_parallel_shader_compile" ) )
+			threads = "glMaxShaderCompilerThreadsARB";
+		if( threads != NULL )
+		{
+			CanDoParallelCompile = 1;
+			MaxShaderCompilerThreadsProc maxThreads = (MaxShaderCompilerThreadsProc) glutGetProcAddress( threads );
+			if( maxThreads != NULL )
+				( *maxThreads )( 0xffffffff );		// as many as the driver wants
+		}
+	}
+
+	Async = true;
+	bool valid = CreateHelper( file0, file1, file2, file3, file4, file5, NULL );
+	Async = false;
+	return valid;
+}
+
+
+// true when the program is built (whether or not it built successfully -- see IsValid( )):
+
+bool
+GLSLProgram::IsReady( )
+{
+	if( ! Pending )
+		return true;
+
+	if( CanDoParallelCompile > 0 )
+	{
+		GLint done = GL_FALSE;
+		glGetProgramiv( Program, GL_COMPLETION_STATUS_KHR, &done );
+		if( done == GL_FALSE )
+			return false;
+	}
+
+	FinishBuild( );
+	return true;
+}
+
+
+// check on every program that is still being built, and return how many still are:
+
+int
+GLSLProgram::PollPending( )
+{
+	std::vector<GLSLProgram *> still;
+	for( int i = 0; i < (int)PendingPrograms.size( ); i++ )
+	{
+		if( ! PendingPrograms[i]->IsReady( ) )
+			still.push_back( PendingPrograms[i] );
+	}
+	PendingPrograms.swap( still );
+	return (int)PendingPrograms.size( );
+}
+
+
+void
+GLSLProgram::SetFallbackProgram( GLSLProgram *fallback )
+{
+	Fallback = fallback;
+}
+
+
 // this is the varargs version of the Create method
 
 bool
 GLSLProgram::CreateHelper( char *file0, ... )
 {
-	GLsizei n = 0;
-	GLchar *buf;
 	Valid = true;
 
 	Vshader = Fshader = 0;
 	Program = 0;
 	AttributeLocs.clear();
 	UniformLocs.clear();
+	Shaders.clear( );
 
 	if( Program == 0 )
 	{
@@ -81,6 +215,10 @@ GLSLProgram::CreateHelper( char *file0, ... )
 	// I am depending on the caller passing in a NULL as the final argument.
 	// If they don't, bad things will happen.
 
+	// all of the source is read before anything is compiled,
+	// so that the program binary cache can be checked first:
+
+	std::vector<ShaderSource> sources;
 	char *file = file0;
 	int type;
 	while( file != NULL )
@@ -92,7 +230,7 @@ GLSLProgram::CreateHelper( char *file0, ... )
 		int maxShaderTypes = sizeof(ShaderTypes) / sizeof(struct GLshadertype);
 		for( int i = 0; i < maxShaderTypes; i++ )
 		{
-			if( strcmp( extension, ShaderTypes[i].extension ) == 0 )
+			if( extension != NULL  &&  strcmp( extension, ShaderTypes[i].extension ) == 0 )
 			{
 				// fprintf( stderr, "Legal extension = '%s'\n", extension );
 				type = i;
@@ -100,7 +238,6 @@ GLSLProgram::CreateHelper( char *file0, ... )
 			}
 		}
 
-		GLuint shader;
 		bool SkipToNextVararg = false;
 		if( type < 0 )
 		{
@@ -127,10 +264,6 @@ GLSLProgram::CreateHelper( char *file0, ... )
 						Valid = false;
 						SkipToNextVararg = true;
 					}
-					else
-					{
-						shader = glCreateShader( GL_VERTEX_SHADER );
-					}
 					break;
 
 				case GL_FRAGMENT_SHADER:
@@ -140,25 +273,17 @@ GLSLProgram::CreateHelper( char *file0, ... )
 						Valid = false;
 						SkipToNextVararg = true;
 					}
-					else
-					{
-						shader = glCreateShader( GL_FRAGMENT_SHADER );
-					}
 					break;
 			}
 		}
 
 
-		// read the shader source into a buffer:
+		// read the shader source into a buffer, and run it through the #include and #define handling:
 
 		if( ! SkipToNextVararg )
 		{
-			FILE * in;
-			int length;
-			FILE * logfile;
-
-			in = fopen( file, "rb" );
-			if( in == NULL )
+			std::string text;
+			if( ! ReadTextFile( file, text ) )
 			{
 				fprintf( stderr, "Cannot open shader file '%s'\n", file );
 				Valid = false;
@@ -167,79 +292,309 @@ GLSLProgram::CreateHelper( char *file0, ... )
 
 			if( ! SkipToNextVararg )
 			{
-				fseek( in, 0, SEEK_END );
-				length = ftell( in );
-				fseek( in, 0, SEEK_SET );		// rewind
+				ShaderSource s;
+				s.Type = ShaderTypes[type].name;
+				s.File = file;
+				std::vector<std::string> files;
+				if( ExpandIncludes( file, text, s.Text, files ) )
+				{
+					InjectDefines( s.Text );
+					sources.push_back( s );
+				}
+			}
+		}
+
+		// go to the next vararg file:
+
+		file = va_arg( args, char * );
+	}
+
+	va_end( args );
 
-				buf = new GLchar[length+1];
-				fread( buf, sizeof(GLchar), length, in );
-				buf[length] = '\0';
-				fclose( in ) ;
+#ifdef GLDEBUG
+	std::string label;
+	for( int i = 0; i < (int)sources.size( ); i++ )
+	{
+		if( i != 0 )
+			label += " + ";
+		label += sources[i].File;
+	}
+	GLDEBUG_LABEL( GL_PROGRAM, Program, label.c_str( ) );
+#endif
+
+	// if this exact program has been linked on this exact driver before, just load it:
+
+	CacheKey = 0;
+	if( Valid  &&  BinaryCacheDir != NULL )
+	{
+		CacheKey = HashSources( sources );
+		if( LoadProgramBinary( CacheKey ) )
+		{
+			ApplyBlockBindings( );
+			return Valid;
+		}
+	}
+
+	// hand everything to the driver, and only then ask how it went,
+	// so a driver that compiles in the background can do them all at once:
+
+	for( int i = 0; i < (int)sources.size( ); i++ )
+		CompileShaderSource( sources[i] );
+
+	if( BinaryCacheDir != NULL  &&  glProgramParameteri != NULL )
+		glProgramParameteri( Program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE );
+	glLinkProgram( Program );
+	CheckGlErrors( "Link Shader 1");
+
+	if( Async )
+	{
+		Pending = true;
+		PendingPrograms.push_back( this );
+		return Valid;
+	}
+	return FinishBuild( );
+}
+
+
+// everything that has to wait for the compile and link to be done:
+
+bool
+GLSLProgram::FinishBuild( )
+{
+	for( int i = 0; i < (int)Shaders.size( ); i++ )
+		CheckShader( Shaders[i].first, Shaders[i].second );
+	Shaders.clear( );
+
+	LinkProgram( );
+
+	if( Valid )
+		ApplyBlockBindings( );
+	if( Valid  &&  BinaryCacheDir != NULL )
+		SaveProgramBinary( CacheKey );
+
+	Pending = false;
+	return Valid;
+}
+
+
+// the preprocessing that gl does not do:
+//
+//	#include "file" is replaced by the file, which is looked for next to the file that includes it
+//	each file is only included once, so they do not need include guards
+//	#line directives are put around what is included, so compile errors still give the right
+//	line -- the second number is which file: 0 is the one given to Create( ), 1 is the first
+//	one it includes, etc.
+//
+//	anything given to Define( ) goes right after the #version line, so the same file can be
+//	compiled with features turned on and off (see GLSLVariants)
+
+// is this line an #include "file"?
+
+static bool
+IsInclude( const std::string &line, std::string &name )
+{
+	const char *p = line.c_str( );
+	while( *p == ' '  ||  *p == '\t' )	p++;
+	if( *p++ != '#' )
+		return false;
+	while( *p == ' '  ||  *p == '\t' )	p++;
+	if( strncmp( p, "include", 7 ) != 0 )
+		return false;
+	p += 7;
+	while( *p == ' '  ||  *p == '\t' )	p++;
+	if( *p++ != '"' )
+		return false;
+	const char *end = strchr( p, '"' );
+	if( end == NULL )
+		return false;
+	name.assign( p, end - p );
+	return true;
+}
 
-				GLchar *strings[2];
-				int n = 0;
-				strings[n] = buf;
-				n++;
 
-				// Tell GL about the source:
+bool
+GLSLProgram::ExpandIncludes( const std::string &file, const std::string &text, std::string &out, std::vector<std::string> &files )
+{
+	int number = (int)files.size( );
+	files.push_back( file );
 
-				glShaderSource( shader, n, (const GLchar **)strings, NULL );
-				delete [ ] buf;
-				CheckGlErrors( "Shader Source" );
+	// included files are found relative to this one:
 
-				// compile:
+	std::string dir;
+	size_t slash = file.find_last_of( "/\\" );
+	if( slash != std::string::npos )
+		dir = file.substr( 0, slash + 1 );
 
-				glCompileShader( shader );
-				GLint infoLogLen;
-				GLint compileStatus;
-				CheckGlErrors( "CompileShader:" );
-				glGetShaderiv( shader, GL_COMPILE_STATUS, &compileStatus );
+	char directive[64];
+	int line = 1;
+	size_t pos = 0;
+	while( pos < text.size( ) )
+	{
+		size_t end = text.find( '\n', pos );
+		end = ( end == std::string::npos )  ?  text.size( )  :  end + 1;
+		std::string l = text.substr( pos, end - pos );
 
-				if( compileStatus == 0 )
+		std::string name;
+		if( ! IsInclude( l, name ) )
+			out += l;
+		else
+		{
+			std::string path = ( name[0] == '/' )  ?  name  :  dir + name;
+			bool already = false;
+			for( int i = 0; i < (int)files.size( ); i++ )
+				already = already  ||  files[i] == path;
+
+			if( already )
+				out += "\n";
+			else
+			{
+				std::string included;
+				if( ! ReadTextFile( path.c_str( ), included ) )
 				{
-					fprintf( stderr, "Shader '%s' did not compile.\n", file );
-					glGetShaderiv( shader, GL_INFO_LOG_LENGTH, &infoLogLen );
-					if( infoLogLen > 0 )
-					{
-						GLchar *infoLog = new GLchar[infoLogLen+1];
-						glGetShaderInfoLog( shader, infoLogLen, NULL, infoLog);
-						infoLog[infoLogLen] = '\0';
-						logfile = fopen( "glsllog.txt", "w");
-						if( logfile != NULL )
-						{
-							fprintf( logfile, "\n%s\n", infoLog );
-							fclose( logfile );
-						}
-						fprintf( stderr, "\n%s\n", infoLog );
-						delete [ ] infoLog;
-					}
-					glDeleteShader( shader );
+					fprintf( stderr, "Cannot open '%s', which '%s' includes on line %d\n", path.c_str( ), file.c_str( ), line );
 					Valid = false;
+					return false;
 				}
-				else
-				{
-					if( Verbose )
-						fprintf( stderr, "Shader '%s' compiled.\n", file );
-
-					glAttachShader( this->Program, shader );
-				}
+				snprintf( directive, sizeof(directive), "#line 1 %d\n", (int)files.size( ) );
+				out += directive;
+				if( ! ExpandIncludes( path, included, out, files ) )
+					return false;
+				if( ! out.empty( )  &&  out[out.size( ) - 1] != '\n' )
+					out += "\n";
+				snprintf( directive, sizeof(directive), "#line %d %d\n", line + 1, number );
+				out += directive;
 			}
 		}
 
+		pos = end;
+		line++;
+	}
+	return true;
+}
 
 
-		// go to the next vararg file:
+void
+GLSLProgram::InjectDefines( std::string &text )
+{
+	if( Defines.empty( ) )
+		return;
 
-		file = va_arg( args, char * );
+	// find the #version line, which has to stay first:
+
+	int line = 1;
+	size_t after = 0;
+	size_t pos = 0;
+	while( pos < text.size( ) )
+	{
+		size_t end = text.find( '\n', pos );
+		end = ( end == std::string::npos )  ?  text.size( )  :  end + 1;
+		size_t first = text.find_first_not_of( " \t", pos );
+		if( first != std::string::npos  &&  text.compare( first, 8, "#version" ) == 0 )
+		{
+			after = end;
+			break;
+		}
+		pos = end;
+		line++;
 	}
+	if( after == 0 )
+		line = 0;		// no #version -- the defines go first
+
+	char directive[64];
+	snprintf( directive, sizeof(directive), "#line %d 0\n", line + 1 );
+	std::string defines = Defines + directive;
+	if( after > 0  &&  text[after - 1] != '\n' )
+		defines = "\n" + defines;
+	text.insert( after, defines );
+}
 
-	va_end( args );
 
-	// link the entire shader program:
+void
+GLSLProgram::Define( const char *name, const char *value )
+{
+	Defines += "#define ";
+	Defines += name;
+	Defines += " ";
+	Defines += value;
+	Defines += "\n";
+}
 
-	glLinkProgram( Program );
-	CheckGlErrors( "Link Shader 1");
 
+void
+GLSLProgram::ClearDefines( )
+{
+	Defines.clear( );
+}
+
+
+// start compiling one shader, and attach it to the program:
+// (whether it compiled is checked later, in CheckShader( ))
+
+void
+GLSLProgram::CompileShaderSource( const ShaderSource &s )
+{
+	GLuint shader = glCreateShader( s.Type );
+
+	// Tell GL about the source:
+
+	const GLchar *strings[1];
+	strings[0] = s.Text.c_str( );
+	glShaderSource( shader, 1, strings, NULL );
+	CheckGlErrors( "Shader Source" );
+
+	// compile:
+
+	glCompileShader( shader );
+	CheckGlErrors( "CompileShader:" );
+	GLDEBUG_LABEL( GL_SHADER, shader, s.File );
+	glAttachShader( this->Program, shader );
+	Shaders.push_back( std::pair<GLuint, char *>( shader, s.File ) );
+}
+
+
+bool
+GLSLProgram::CheckShader( GLuint shader, char *file )
+{
+	GLint infoLogLen;
+	GLint compileStatus;
+	glGetShaderiv( shader, GL_COMPILE_STATUS, &compileStatus );
+
+	if( compileStatus == 0 )
+	{
+		fprintf( stderr, "Shader '%s' did not compile.\n", file );
+		glGetShaderiv( shader, GL_INFO_LOG_LENGTH, &infoLogLen );
+		if( infoLogLen > 0 )
+		{
+			GLchar *infoLog = new GLchar[infoLogLen+1];
+			glGetShaderInfoLog( shader, infoLogLen, NULL, infoLog);
+			infoLog[infoLogLen] = '\0';
+			FILE *logfile = fopen( "glsllog.txt", "w");
+			if( logfile != NULL )
+			{
+				fprintf( logfile, "\n%s\n", infoLog );
+				fclose( logfile );
+			}
+			fprintf( stderr, "\n%s\n", infoLog );
+			delete [ ] infoLog;
+		}
+		glDeleteShader( shader );
+		Valid = false;
+		return false;
+	}
+
+	if( Verbose )
+		fprintf( stderr, "Shader '%s' compiled.\n", file );
+
+	glDeleteShader( shader );		// it goes away when the program does
+	return true;
+}
+
+
+// see how linking the entire shader program went:
+
+bool
+GLSLProgram::LinkProgram( )
+{
 	GLchar* infoLog;
 	GLint infoLogLen;
 	GLint linkStatus;
@@ -267,14 +622,21 @@ GLSLProgram::CreateHelper( char *file0, ... )
 		if( Verbose )
 			fprintf( stderr, "Shader Program linked.\n" );
 		// validate the program:
+		// (this is against the state right now -- every sampler uniform is still on unit 0 until the
+		// program sets them, so a shader with samplers of different types fails here and then draws
+		// fine, and so this is only a warning)
 
 		GLint status;
 		glValidateProgram( Program );
 		glGetProgramiv( Program, GL_VALIDATE_STATUS, &status );
 		if( status == GL_FALSE )
 		{
-			fprintf( stderr, "Program is invalid.\n" );
-			Valid = false;
+			if( Verbose )
+			{
+				GLchar log[1024];
+				glGetProgramInfoLog( Program, sizeof(log), NULL, log );
+				fprintf( stderr, "Program does not validate yet: %s\n", log );
+			}
 		}
 		else
 		{
@@ -287,6 +649,188 @@ GLSLProgram::CreateHelper( char *file0, ... )
 }
 
 
+// the program binary cache:
+//
+//	after a program is linked, glGetProgramBinary( ) hands back whatever the driver turned it into,
+//	and that is saved in a file whose name is a hash of everything that went into it --
+//	the source of every shader (with whatever #defines it has in it) and the driver's
+//	vendor, renderer, and version strings, since a binary only works on the driver that made it
+//	the next time the same program is created, glProgramBinary( ) loads it without compiling anything
+//	if the driver says no (it was updated, say), the program is compiled from source after all,
+//	and the binary is replaced
+
+char *	GLSLProgram::BinaryCacheDir = NULL;
+int	GLSLProgram::BinaryCacheHits = 0;
+int	GLSLProgram::BinaryCacheMisses = 0;
+
+const char GLSL_BINARY_MAGIC[8] = { 'G', 'L', 'S', 'L', 'B', 'I', 'N', '1' };
+
+
+// NULL turns the cache off, which is how it starts
+// the directory is created if it is not there yet:
+
+void
+GLSLProgram::SetBinaryCacheDirectory( const char *dir )
+{
+	delete [ ] BinaryCacheDir;
+	BinaryCacheDir = NULL;
+	if( dir != NULL )
+	{
+		BinaryCacheDir = new char[ strlen(dir) + 1 ];
+		strcpy( BinaryCacheDir, dir );
+#ifdef WIN32
+		_mkdir( dir );
+#else
+		mkdir( dir, 0755 );
+#endif
+	}
+}
+
+
+int
+GLSLProgram::GetBinaryCacheHits( )
+{
+	return BinaryCacheHits;
+}
+
+
+int
+GLSLProgram::GetBinaryCacheMisses( )
+{
+	return BinaryCacheMisses;
+}
+
+
+// 64-bit FNV-1a:
+
+static unsigned long long
+HashBytes( unsigned long long h, const void *bytes, size_t n )
+{
+	const unsigned char *p = (const unsigned char *)bytes;
+	for( size_t i = 0; i < n; i++ )
+	{
+		h ^= p[i];
+		h *= 1099511628211ull;
+	}
+	return h;
+}
+
+
+static unsigned long long
+HashString( unsigned long long h, const char *s )
+{
+	if( s == NULL )
+		s = "";
+	return HashBytes( h, s, strlen(s) + 1 );		// the '\0' keeps "ab"+"c" from matching "a"+"bc"
+}
+
+
+unsigned long long
+GLSLProgram::HashSources( const std::vector<ShaderSource> &sources )
+{
+	unsigned long long h = 14695981039346656037ull;
+	h = HashString( h, (const char *)glGetString( GL_VENDOR ) );
+	h = HashString( h, (const char *)glGetString( GL_RENDERER ) );
+	h = HashString( h, (const char *)glGetString( GL_VERSION ) );
+	for( int i = 0; i < (int)sources.size( ); i++ )
+	{
+		h = HashBytes( h, &sources[i].Type, sizeof(GLenum) );
+		h = HashString( h, sources[i].Text.c_str( ) );
+	}
+	return h;
+}
+
+
+static void
+BinaryCacheFile( char *path, size_t size, const char *dir, unsigned long long key )
+{
+	snprintf( path, size, "%s/%016llx.glslbin", dir, key );
+}
+
+
+bool
+GLSLProgram::LoadProgramBinary( unsigned long long key )
+{
+	if( glProgramBinary == NULL )
+		return false;
+
+	char path[1024];
+	BinaryCacheFile( path, sizeof(path), BinaryCacheDir, key );
+	FILE *fp = fopen( path, "rb" );
+	if( fp == NULL )
+	{
+		BinaryCacheMisses++;
+		return false;
+	}
+
+	char magic[8];
+	GLenum format;
+	GLint length;
+	bool ok = fread( magic, 1, 8, fp ) == 8  &&  memcmp( magic, GLSL_BINARY_MAGIC, 8 ) == 0;
+	ok = ok  &&  fread( &format, sizeof(GLenum), 1, fp ) == 1;
+	ok = ok  &&  fread( &length, sizeof(GLint), 1, fp ) == 1  &&  length > 0;
+	std::vector<GLubyte> binary;
+	if( ok )
+	{
+		binary.resize( length );
+		ok = fread( &binary[0], 1, length, fp ) == (size_t)length;
+	}
+	fclose( fp );
+
+	GLint linkStatus = 0;
+	if( ok )
+	{
+		glProgramBinary( Program, format, &binary[0], length );
+		glGetProgramiv( Program, GL_LINK_STATUS, &linkStatus );
+	}
+	GLDEBUG_DISCARD( );		// a rejected binary can leave an error behind -- it is not one of ours
+
+	if( linkStatus == 0 )
+	{
+		if( Verbose )
+			fprintf( stderr, "Program binary '%s' was not accepted -- compiling from source\n", path );
+		BinaryCacheMisses++;
+		return false;
+	}
+
+	if( Verbose )
+		fprintf( stderr, "Shader Program loaded from '%s'\n", path );
+	BinaryCacheHits++;
+	return true;
+}
+
+
+void
+GLSLProgram::SaveProgramBinary( unsigned long long key )
+{
+	if( glGetProgramBinary == NULL )
+		return;
+
+	GLint length = 0;
+	glGetProgramiv( Program, GL_PROGRAM_BINARY_LENGTH, &length );
+	if( length <= 0 )
+		return;		// this driver does not hand out binaries
+
+	std::vector<GLubyte> binary( length );
+	GLenum format;
+	glGetProgramBinary( Program, length, &length, &format, &binary[0] );
+
+	char path[1024];
+	BinaryCacheFile( path, sizeof(path), BinaryCacheDir, key );
+	FILE *fp = fopen( path, "wb" );
+	if( fp == NULL )
+	{
+		fprintf( stderr, "Cannot write the program binary '%s'\n", path );
+		return;
+	}
+	fwrite( GLSL_BINARY_MAGIC, 1, 8, fp );
+	fwrite( &format, sizeof(GLenum), 1, fp );
+	fwrite( &length, sizeof(GLint), 1, fp );
+	fwrite( &binary[0], 1, length, fp );
+	fclose( fp );
+}
+
+
 void
 GLSLProgram::DisableVertexAttribArray( const char *name )
 {
@@ -354,9 +898,16 @@ GLSLProgram::UnUse( )
 }
 
 
+// a program that is still being built asynchronously draws with the fallback program instead:
+
 void
 GLSLProgram::Use( )
 {
+	if( Pending  &&  ! IsReady( ) )
+	{
+		Use( Fallback != NULL  ?  Fallback->Program  :  0 );
+		return;
+	}
 	Use( this->Program );
 };
 
@@ -459,29 +1010,32 @@ GLSLProgram::SetAttributeVariable( char* name, float vals[3] )
 int
 GLSLProgram::GetUniformLocation( char *name )
 {
-	std::map<char *, int>::iterator pos;
+	return GetUniformLocation( UniformName( name ) );
+};
+
 
-	pos = UniformLocs.find( name );
-	//if( Verbose )
-		//fprintf( stderr, "Uniform: pos = 0x%016x ; size = %d ; end = 0x%016x\n", pos, UniformLocs.size(), UniformLocs.end() );
+int
+GLSLProgram::GetUniformLocation( UniformName name )
+{
+	std::map<unsigned int, int>::iterator pos;
+
+	pos = UniformLocs.find( name.Hash );
 	if( pos == UniformLocs.end() )
 	{
-		GLuint loc = glGetUniformLocation( this->Program, name );
-		UniformLocs[name] = loc;
+		GLint loc = glGetUniformLocation( this->Program, name.Name );
+		UniformLocs[name.Hash] = loc;
 		if( Verbose )
-			fprintf( stderr, "Location of '%s' in Program %d = %d\n", name, this->Program, loc );
+			fprintf( stderr, "Location of '%s' in Program %d = %d\n", name.Name, this->Program, loc );
+		return loc;
 	}
-	else
+
+	if( Verbose )
 	{
-		if( Verbose )
-		{
-			fprintf( stderr, "Location = %d\n", UniformLocs[name] );
-			if( UniformLocs[name] == -1 )
-				fprintf( stderr, "Location of uniform variable '%s' is -1\n", name );
-		}
+		fprintf( stderr, "Location = %d\n", pos->second );
+		if( pos->second == -1 )
+			fprintf( stderr, "Location of uniform variable '%s' is -1\n", name.Name );
 	}
-
-	return UniformLocs[name];
+	return pos->second;
 };
 
 
@@ -525,8 +1079,6 @@ void
 GLSLProgram::SetUniformVariable( char* name, float vals[3] )
 {
 	int loc;
-	fprintf( stderr, "Found a 3-element array\n" );
-
 	if( ( loc = GetUniformLocation( name ) )  >= 0 )
 	{
 		this->Use();
@@ -535,6 +1087,42 @@ GLSLProgram::SetUniformVariable( char* name, float vals[3] )
 };
 
 
+// connect a uniform block to a binding point -- see uniformbuffer.h:
+
+void
+GLSLProgram::SetUniformBlockBinding( char *name, GLuint binding )
+{
+	// it is remembered, so that it can be set again if the program is re-created,
+	// and so that it can be given before the program is done linking:
+
+	BlockBindings.push_back( std::pair<std::string, GLuint>( name, binding ) );
+	if( Program != 0  &&  Valid  &&  ! Pending )
+		ApplyBlockBinding( name, binding );
+};
+
+
+void
+GLSLProgram::ApplyBlockBinding( const char *name, GLuint binding )
+{
+	GLuint index = glGetUniformBlockIndex( this->Program, name );
+	if( index == GL_INVALID_INDEX )
+	{
+		if( Verbose )
+			fprintf( stderr, "Program %d has no uniform block '%s'\n", this->Program, name );
+		return;
+	}
+	glUniformBlockBinding( this->Program, index, binding );
+}
+
+
+void
+GLSLProgram::ApplyBlockBindings( )
+{
+	for( int i = 0; i < (int)BlockBindings.size( ); i++ )
+		ApplyBlockBinding( BlockBindings[i].first.c_str( ), BlockBindings[i].second );
+}
+
+
 bool
 GLSLProgram::IsExtensionSupported( const char *extension )
 {
@@ -568,43 +1156,234 @@ GLSLProgram::IsExtensionSupported( const char *extension )
 }
 
 
-int GLSLProgram::CurrentProgram = 0;
+GLSLVariants::GLSLVariants( )
+{
+	Vfile = Ffile = NULL;
+}
 
 
+void
+GLSLVariants::Init( const char *vfile, const char *ffile )
+{
+	Vfile = new char[ strlen(vfile) + 1 ];
+	strcpy( Vfile, vfile );
+	Ffile = new char[ strlen(ffile) + 1 ];
+	strcpy( Ffile, ffile );
+}
 
 
-#ifndef CHECK_GL_ERRORS
-#define CHECK_GL_ERRORS
+// remembered, so that variants compiled later get it too:
+
 void
-CheckGlErrors( const char* caller )
+GLSLVariants::SetUniformBlockBinding( const char *name, GLuint binding )
+{
+	BlockBindings.push_back( std::pair<std::string, GLuint>( name, binding ) );
+
+	std::map<std::string, GLSLProgram *>::iterator it;
+	for( it = Programs.begin( ); it != Programs.end( ); it++ )
+		it->second->SetUniformBlockBinding( (char *)name, binding );
+}
+
+
+GLSLProgram *
+GLSLVariants::Get( const char *defines )
 {
-	unsigned int gle = glGetError();
+	// split the defines apart and sort them, so the key does not depend on their order:
 
-	if( gle != GL_NO_ERROR )
+	std::vector<std::string> names;
+	for( const char *p = defines; p != NULL  &&  *p != '\0'; )
 	{
-		fprintf( stderr, "GL Error discovered from caller %s: ", caller );
-		switch (gle)
-		{
-			case GL_INVALID_ENUM:
-				fprintf( stderr, "Invalid enum.\n" );
-				break;
-			case GL_INVALID_VALUE:
-				fprintf( stderr, "Invalid value.\n" );
-				break;
-			case GL_INVALID_OPERATION:
-				fprintf( stderr, "Invalid Operation.\n" );
-				break;
-			case GL_STACK_OVERFLOW:
-				fprintf( stderr, "Stack overflow.\n" );
-				break;
-			case GL_STACK_UNDERFLOW:
-				fprintf(stderr, "Stack underflow.\n" );
-				break;
-			case GL_OUT_OF_MEMORY:
-				fprintf( stderr, "Out of memory.\n" );
-				break;
-		}
+		while( *p == ' ' )	p++;
+		const char *end = p;
+		while( *end != ' '  &&  *end != '\0' )	end++;
+		if( end > p )
+			names.push_back( std::string( p, end - p ) );
+		p = end;
+	}
+	std::sort( names.begin( ), names.end( ) );
+
+	std::string key;
+	for( int i = 0; i < (int)names.size( ); i++ )
+	{
+		if( i != 0 )
+			key += " ";
+		key += names[i];
+	}
+
+	std::map<std::string, GLSLProgram *>::iterator it = Programs.find( key );
+	if( it != Programs.end( ) )
+		return it->second;
+
+	// the first time this variant has been asked for:
+
+	GLSLProgram *program = new GLSLProgram( );
+	program->Init( );
+	for( int i = 0; i < (int)names.size( ); i++ )
+	{
+		size_t equals = names[i].find( '=' );
+		if( equals == std::string::npos )
+			program->Define( names[i].c_str( ) );
+		else
+			program->Define( names[i].substr( 0, equals ).c_str( ), names[i].substr( equals + 1 ).c_str( ) );
+	}
+	for( int i = 0; i < (int)BlockBindings.size( ); i++ )
+		program->SetUniformBlockBinding( (char *)BlockBindings[i].first.c_str( ), BlockBindings[i].second );
+
+	// it is built asynchronously, so asking for a new variant in the middle of a frame does not stall it:
+
+	if( ! program->CreateAsync( Vfile, Ffile ) )
+		fprintf( stderr, "The '%s' variant of %s + %s did not build\n", key.c_str( ), Vfile, Ffile );
+	Programs[key] = program;
+	return program;
+}
+
+
+int
+GLSLVariants::GetNumVariants( )
+{
+	return (int)Programs.size( );
+}
+
+
+GLuint GLSLProgram::CurrentProgram = 0;
+int GLSLProgram::CanDoProgramUniform = -1;
+
+
+// glProgramUniform*( ) sets a uniform in a program without having to bind it:
+// (gl 4.1, or GL_ARB_separate_shader_objects)
+
+bool
+GLSLProgram::HasProgramUniform( )
+{
+	if( CanDoProgramUniform < 0 )
+		CanDoProgramUniform = ( glProgramUniform1fv != NULL )  ?  1  :  0;
+	return CanDoProgramUniform != 0;
+}
+
+
+// without it, the program is bound just long enough to set the uniform:
+
+GLuint
+GLSLProgram::SwitchProgram( GLuint p )
+{
+	GLuint was = CurrentProgram;
+	if( p != CurrentProgram )
+	{
+		glUseProgram( p );
+		CurrentProgram = p;
+	}
+	return was;
+}
+
+
+void
+GLSLProgram::ProgramUniform( GLuint program, GLint loc, const int *v, int n )
+{
+	if( loc < 0 )
 		return;
+	if( HasProgramUniform( ) )
+		glProgramUniform1iv( program, loc, n, v );
+	else
+	{
+		GLuint was = SwitchProgram( program );
+		glUniform1iv( loc, n, v );
+		SwitchProgram( was );
 	}
 }
-#endif
+
+
+void
+GLSLProgram::ProgramUniform( GLuint program, GLint loc, const float *v, int n )
+{
+	if( loc < 0 )
+		return;
+	if( HasProgramUniform( ) )
+		glProgramUniform1fv( program, loc, n, v );
+	else
+	{
+		GLuint was = SwitchProgram( program );
+		glUniform1fv( loc, n, v );
+		SwitchProgram( was );
+	}
+}
+
+
+void
+GLSLProgram::ProgramUniform( GLuint program, GLint loc, const glm::vec2 *v, int n )
+{
+	if( loc < 0 )
+		return;
+	if( HasProgramUniform( ) )
+		glProgramUniform2fv( program, loc, n, &(*v)[0] );
+	else
+	{
+		GLuint was = SwitchProgram( program );
+		glUniform2fv( loc, n, &(*v)[0] );
+		SwitchProgram( was );
+	}
+}
+
+
+void
+GLSLProgram::ProgramUniform( GLuint program, GLint loc, const glm::vec3 *v, int n )
+{
+	if( loc < 0 )
+		return;
+	if( HasProgramUniform( ) )
+		glProgramUniform3fv( program, loc, n, &(*v)[0] );
+	else
+	{
+		GLuint was = SwitchProgram( program );
+		glUniform3fv( loc, n, &(*v)[0] );
+		SwitchProgram( was );
+	}
+}
+
+
+void
+GLSLProgram::ProgramUniform( GLuint program, GLint loc, const glm::vec4 *v, int n )
+{
+	if( loc < 0 )
+		return;
+	if( HasProgramUniform( ) )
+		glProgramUniform4fv( program, loc, n, &(*v)[0] );
+	else
+	{
+		GLuint was = SwitchProgram( program );
+		glUniform4fv( loc, n, &(*v)[0] );
+		SwitchProgram( was );
+	}
+}
+
+
+void
+GLSLProgram::ProgramUniform( GLuint program, GLint loc, const glm::mat3 *m, int n )
+{
+	if( loc < 0 )
+		return;
+	if( HasProgramUniform( ) )
+		glProgramUniformMatrix3fv( program, loc, n, GL_FALSE, &(*m)[0][0] );
+	else
+	{
+		GLuint was = SwitchProgram( program );
+		glUniformMatrix3fv( loc, n, GL_FALSE, &(*m)[0][0] );
+		SwitchProgram( was );
+	}
+}
+
+
+void
+GLSLProgram::ProgramUniform( GLuint program, GLint loc, const glm::mat4 *m, int n )
+{
+	if( loc < 0 )
+		return;
+	if( HasProgramUniform( ) )
+		glProgramUniformMatrix4fv( program, loc, n, GL_FALSE, &(*m)[0][0] );
+	else
+	{
+		GLuint was = SwitchProgram( program );
+		glUniformMatrix4fv( loc, n, GL_FALSE, &(*m)[0][0] );
+		SwitchProgram( was );
+	}
+}
+
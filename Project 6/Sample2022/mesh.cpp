@@ -0,0 +1,539 @@
+#ifndef MESH_CPP
+#define MESH_CPP
+
+#include "mesh.h"
+
+#include <stddef.h>
+#include <string.h>
+
+
+size_t Mesh::TotalGpuBytes = 0;
+
+
+Mesh::Mesh( )
+{
+	NowNormal[0] = 0.;	NowNormal[1] = 0.;	NowNormal[2] = 1.;
+	NowTexCoord[0] = 0.;	NowTexCoord[1] = 0.;
+	NowColor[0] = NowColor[1] = NowColor[2] = NowColor[3] = 255;
+	HasNormals = HasTexCoords = HasColors = false;
+	Topology = GL_TRIANGLES;
+
+	Layout = MESH_INTERLEAVED;
+	VertexArray = 0;
+	VertexBuffer = 0;
+	IndexBuffer = 0;
+	IndexType = GL_UNSIGNED_INT;
+	NumIndices = 0;
+	NumVertices = 0;
+	Stride = 0;
+	PositionOffset = NormalOffset = TexCoordOffset = ColorOffset = 0;
+	GpuBytes = 0;
+	BoundCenter[0] = BoundCenter[1] = BoundCenter[2] = 0.;
+	BoundRadius = 0.;
+	for( int k = 0; k < 3; k++ )
+		BoundMin[k] = BoundMax[k] = 0.;
+}
+
+
+// throw away the cpu copy (what has been uploaded stays until the next Upload( )):
+
+void
+Mesh::Clear( )
+{
+	Positions.clear( );
+	Normals.clear( );
+	TexCoords.clear( );
+	Colors.clear( );
+	Indices.clear( );
+	HasNormals = HasTexCoords = HasColors = false;
+}
+
+
+void
+Mesh::Normal( float nx, float ny, float nz )
+{
+	NowNormal[0] = nx;
+	NowNormal[1] = ny;
+	NowNormal[2] = nz;
+	HasNormals = true;
+}
+
+
+void
+Mesh::TexCoord( float s, float t )
+{
+	NowTexCoord[0] = s;
+	NowTexCoord[1] = t;
+	HasTexCoords = true;
+}
+
+
+void
+Mesh::Color( float r, float g, float b, float a )
+{
+	float rgba[4] = { r, g, b, a };
+	for( int i = 0; i < 4; i++ )
+	{
+		float c = rgba[i];
+		if( c < 0. )	c = 0.;
+		if( c > 1. )	c = 1.;
+		NowColor[i] = (GLubyte)( 255.f * c + 0.5f );
+	}
+	HasColors = true;
+}
+
+
+// returns the new vertex's index, for Triangle( ):
+
+int
+Mesh::Vertex( float x, float y, float z )
+{
+	Positions.push_back( x );
+	Positions.push_back( y );
+	Positions.push_back( z );
+	Normals.insert( Normals.end( ), NowNormal, NowNormal+3 );
+	TexCoords.insert( TexCoords.end( ), NowTexCoord, NowTexCoord+2 );
+	Colors.insert( Colors.end( ), NowColor, NowColor+4 );
+	return (int)Positions.size( )/3 - 1;
+}
+
+
+void
+Mesh::Triangle( int i0, int i1, int i2 )
+{
+	Indices.push_back( (GLuint)i0 );
+	Indices.push_back( (GLuint)i1 );
+	Indices.push_back( (GLuint)i2 );
+}
+
+
+void
+Mesh::SetTopology( GLenum topology )
+{
+	Topology = topology;
+}
+
+
+// append a SurfaceMesh's triangles:
+
+void
+Mesh::AddSurface( const struct SurfaceMesh &surface )
+{
+	// any vertices already here and not indexed need indices now, so they stay in order:
+	int base = (int)Positions.size( ) / 3;
+	if( Indices.empty( ) )
+	{
+		for( int i = 0; i < base; i++ )
+			Indices.push_back( (GLuint)i );
+	}
+
+	for( int i = 0; i < (int)surface.Vertices.size( ); i++ )
+	{
+		const struct SurfaceVertex &v = surface.Vertices[i];
+		Normal( v.nx, v.ny, v.nz );
+		TexCoord( v.s, v.t );
+		Vertex( v.x, v.y, v.z );
+	}
+	for( int i = 0; i < (int)surface.Indices.size( ); i++ )
+		Indices.push_back( (GLuint)base + surface.Indices[i] );
+}
+
+
+// copy the cpu copy into the buffers:
+// (usage is GL_STATIC_DRAW for geometry that never changes, GL_DYNAMIC_DRAW if UpdatePositions( ) is
+// going to be called a lot)
+
+void
+Mesh::Upload( MeshLayout layout, GLenum usage )
+{
+	NumVertices = (int)Positions.size( ) / 3;
+	if( NumVertices == 0 )
+	{
+		NumIndices = 0;
+		return;
+	}
+	Layout = layout;
+	FitBound( (const GLubyte *)&Positions[0], NumVertices, 3*sizeof(float) );
+
+	// where each attribute goes:
+
+	size_t psize = 3*sizeof(float);
+	size_t nsize = HasNormals   ? 3*sizeof(float)   : 0;
+	size_t tsize = HasTexCoords ? 2*sizeof(float)   : 0;
+	size_t csize = HasColors    ? 4*sizeof(GLubyte) : 0;
+	size_t vsize = psize + nsize + tsize + csize;
+	if( layout == MESH_INTERLEAVED )
+	{
+		Stride = (GLsizei)vsize;
+		PositionOffset = 0;
+		NormalOffset   = psize;
+		TexCoordOffset = psize + nsize;
+		ColorOffset    = psize + nsize + tsize;
+	}
+	else
+	{
+		Stride = 0;
+		PositionOffset = 0;
+		NormalOffset   = NumVertices * psize;
+		TexCoordOffset = NumVertices * ( psize + nsize );
+		ColorOffset    = NumVertices * ( psize + nsize + tsize );
+	}
+
+	std::vector<GLubyte> data( NumVertices * vsize );
+	bool interleaved = layout == MESH_INTERLEAVED;
+	for( int i = 0; i < NumVertices; i++ )
+	{
+		memcpy( &data[ PositionOffset + i*( interleaved ? vsize : psize ) ], &Positions[3*i], psize );
+		if( HasNormals )
+			memcpy( &data[ NormalOffset + i*( interleaved ? vsize : nsize ) ], &Normals[3*i], nsize );
+		if( HasTexCoords )
+			memcpy( &data[ TexCoordOffset + i*( interleaved ? vsize : tsize ) ], &TexCoords[2*i], tsize );
+		if( HasColors )
+			memcpy( &data[ ColorOffset + i*( interleaved ? vsize : csize ) ], &Colors[4*i], csize );
+	}
+
+	// small meshes get 16-bit indices:
+
+	std::vector<GLuint> sequential;
+	std::vector<GLuint> *indices = &Indices;
+	if( Indices.empty( ) )
+	{
+		for( int i = 0; i < NumVertices; i++ )
+			sequential.push_back( (GLuint)i );
+		indices = &sequential;
+	}
+	NumIndices = (GLsizei)indices->size( );
+
+	std::vector<GLushort> shorts;
+	const GLvoid *indexData = &(*indices)[0];
+	size_t indexBytes = NumIndices * sizeof(GLuint);
+	IndexType = GL_UNSIGNED_INT;
+	if( NumVertices <= 65536 )
+	{
+		shorts.assign( indices->begin( ), indices->end( ) );
+		indexData = &shorts[0];
+		indexBytes = NumIndices * sizeof(GLushort);
+		IndexType = GL_UNSIGNED_SHORT;
+	}
+
+	UploadBuffers( &data[0], data.size( ), indexData, indexBytes, usage );
+}
+
+
+// upload a mesh that was made ahead of time by meshheader (see meshheader.cpp, in Project 2):
+//	the arrays are already in the layout that Upload( ) would have made, so they go
+//	straight into the buffers -- nothing is computed or copied on the cpu
+//	there is no cpu copy afterwards either, so UpdatePositions( ) cannot be used
+
+void
+Mesh::UploadEmbedded( const MeshVertex *vertices, int numVertices, const GLushort *indices, int numIndices )
+{
+	UploadEmbedded( vertices, numVertices, indices, numIndices, GL_UNSIGNED_SHORT );
+}
+
+
+void
+Mesh::UploadEmbedded( const MeshVertex *vertices, int numVertices, const GLuint *indices, int numIndices )
+{
+	UploadEmbedded( vertices, numVertices, indices, numIndices, GL_UNSIGNED_INT );
+}
+
+
+void
+Mesh::UploadEmbedded( const MeshVertex *vertices, int numVertices, const GLvoid *indices, int numIndices, GLenum indexType )
+{
+	Clear( );
+	NumVertices = numVertices;
+	NumIndices = numIndices;
+	if( NumVertices == 0  ||  NumIndices == 0 )
+	{
+		NumIndices = 0;
+		return;
+	}
+
+	Layout = MESH_INTERLEAVED;
+	HasNormals = HasTexCoords = HasColors = true;
+	Stride = (GLsizei)sizeof(MeshVertex);
+	PositionOffset = offsetof( MeshVertex, x );
+	NormalOffset   = offsetof( MeshVertex, nx );
+	TexCoordOffset = offsetof( MeshVertex, s );
+	ColorOffset    = offsetof( MeshVertex, r );
+	IndexType = indexType;
+
+	FitBound( (const GLubyte *)&vertices[0].x, numVertices, sizeof(MeshVertex) );
+	size_t indexSize = ( indexType == GL_UNSIGNED_SHORT )  ?  sizeof(GLushort)  :  sizeof(GLuint);
+	UploadBuffers( vertices, numVertices * sizeof(MeshVertex), indices, numIndices * indexSize, GL_STATIC_DRAW );
+}
+
+
+// put the vertices and the indices into the buffers, and point the vertex array object at them,
+// using the layout in Stride and the offsets:
+
+void
+Mesh::UploadBuffers( const GLvoid *data, size_t dataBytes, const GLvoid *indexData, size_t indexBytes, GLenum usage )
+{
+	if( VertexArray == 0 )
+	{
+		glGenVertexArrays( 1, &VertexArray );
+		glGenBuffers( 1, &VertexBuffer );
+		glGenBuffers( 1, &IndexBuffer );
+	}
+
+	glBindVertexArray( VertexArray );
+	glBindBuffer( GL_ARRAY_BUFFER, VertexBuffer );
+	glBufferData( GL_ARRAY_BUFFER, dataBytes, data, usage );
+	glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, IndexBuffer );
+	glBufferData( GL_ELEMENT_ARRAY_BUFFER, indexBytes, indexData, usage );
+
+	// both the fixed-function arrays and the generic attributes, see mesh.h:
+
+	glEnableClientState( GL_VERTEX_ARRAY );
+	glVertexPointer( 3, GL_FLOAT, Stride, (GLvoid *)PositionOffset );
+	glEnableVertexAttribArray( MESH_POSITION );
+	glVertexAttribPointer( MESH_POSITION, 3, GL_FLOAT, GL_FALSE, Stride, (GLvoid *)PositionOffset );
+
+	if( HasNormals )
+	{
+		glEnableClientState( GL_NORMAL_ARRAY );
+		glNormalPointer( GL_FLOAT, Stride, (GLvoid *)NormalOffset );
+		glEnableVertexAttribArray( MESH_NORMAL );
+		glVertexAttribPointer( MESH_NORMAL, 3, GL_FLOAT, GL_FALSE, Stride, (GLvoid *)NormalOffset );
+	}
+	else
+	{
+		glDisableClientState( GL_NORMAL_ARRAY );
+		glDisableVertexAttribArray( MESH_NORMAL );
+	}
+
+	if( HasTexCoords )
+	{
+		glClientActiveTexture( GL_TEXTURE0 );
+		glEnableClientState( GL_TEXTURE_COORD_ARRAY );
+		glTexCoordPointer( 2, GL_FLOAT, Stride, (GLvoid *)TexCoordOffset );
+		glEnableVertexAttribArray( MESH_TEXCOORD );
+		glVertexAttribPointer( MESH_TEXCOORD, 2, GL_FLOAT, GL_FALSE, Stride, (GLvoid *)TexCoordOffset );
+	}
+	else
+	{
+		glDisableClientState( GL_TEXTURE_COORD_ARRAY );
+		glDisableVertexAttribArray( MESH_TEXCOORD );
+	}
+
+	if( HasColors )
+	{
+		glEnableClientState( GL_COLOR_ARRAY );
+		glColorPointer( 4, GL_UNSIGNED_BYTE, Stride, (GLvoid *)ColorOffset );
+		glEnableVertexAttribArray( MESH_COLOR );
+		glVertexAttribPointer( MESH_COLOR, 4, GL_UNSIGNED_BYTE, GL_TRUE, Stride, (GLvoid *)ColorOffset );
+	}
+	else
+	{
+		glDisableClientState( GL_COLOR_ARRAY );
+		glDisableVertexAttribArray( MESH_COLOR );
+	}
+
+	glBindVertexArray( 0 );
+	glBindBuffer( GL_ARRAY_BUFFER, 0 );
+	glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, 0 );
+
+	TotalGpuBytes -= GpuBytes;
+	GpuBytes = dataBytes + indexBytes;
+	TotalGpuBytes += GpuBytes;
+}
+
+
+// change count positions, starting at vertex first, both in the cpu copy and in the buffer
+// (xyz has 3*count floats):
+
+void
+Mesh::UpdatePositions( int first, int count, const float *xyz )
+{
+	if( first < 0  ||  count <= 0  ||  first + count > (int)Positions.size( )/3 )
+	{
+		fprintf( stderr, "Mesh::UpdatePositions: vertices %d - %d are out of range\n", first, first + count - 1 );
+		return;
+	}
+	memcpy( &Positions[3*first], xyz, 3*count*sizeof(float) );
+	GrowBound( xyz, count );
+
+	if( first + count > NumVertices )
+		return;					// not uploaded yet -- the next Upload( ) takes care of it
+
+	glBindBuffer( GL_ARRAY_BUFFER, VertexBuffer );
+	if( Layout == MESH_SOA )
+	{
+		// the positions are all together, so this is one copy:
+		glBufferSubData( GL_ARRAY_BUFFER, PositionOffset + 3*first*sizeof(float), 3*count*sizeof(float), xyz );
+	}
+	else
+	{
+		// the positions are spread out, so write them in place:
+		GLubyte *p = (GLubyte *)glMapBufferRange( GL_ARRAY_BUFFER, first*Stride, count*Stride, GL_MAP_WRITE_BIT );
+		if( p != NULL )
+		{
+			for( int i = 0; i < count; i++ )
+				memcpy( p + i*Stride + PositionOffset, &xyz[3*i], 3*sizeof(float) );
+			glUnmapBuffer( GL_ARRAY_BUFFER );
+		}
+	}
+	glBindBuffer( GL_ARRAY_BUFFER, 0 );
+}
+
+
+void
+Mesh::Draw( )
+{
+	DrawInstanced( 1 );
+}
+
+
+// with instances > 1, a shader uses gl_InstanceID to tell them apart:
+
+void
+Mesh::DrawInstanced( int instances )
+{
+	if( VertexArray == 0 )
+		Upload( );
+	if( NumIndices == 0  ||  instances <= 0 )
+		return;
+
+	glBindVertexArray( VertexArray );
+	if( instances == 1 )
+		glDrawElements( Topology, NumIndices, IndexType, (GLvoid *)0 );
+	else
+		glDrawElementsInstanced( Topology, NumIndices, IndexType, (GLvoid *)0, instances );
+	glBindVertexArray( 0 );
+}
+
+
+// read a per-instance attribute from buffer, starting at offset bytes, stride bytes apart:
+//	components is 1-4 floats -- a mat4 is 4 of these, at 4 locations in a row
+//	use locations that are not MESH_POSITION, etc. -- 10-15 are free (nvidia aliases them to
+//	texture units 2-7, which a Mesh never uses)
+
+void
+Mesh::InstanceAttribute( GLuint location, int components, GLuint buffer, GLsizei stride, size_t offset )
+{
+	if( VertexArray == 0 )
+		Upload( );
+
+	glBindVertexArray( VertexArray );
+	glBindBuffer( GL_ARRAY_BUFFER, buffer );
+	glEnableVertexAttribArray( location );
+	glVertexAttribPointer( location, components, GL_FLOAT, GL_FALSE, stride, (GLvoid *)offset );
+	glVertexAttribDivisor( location, 1 );
+	glBindVertexArray( 0 );
+	glBindBuffer( GL_ARRAY_BUFFER, 0 );
+}
+
+
+// the sphere and the box are in the mesh's own coordinates:
+
+void
+Mesh::GetBoundingBox( float bmin[3], float bmax[3] )
+{
+	for( int k = 0; k < 3; k++ )
+	{
+		bmin[k] = BoundMin[k];
+		bmax[k] = BoundMax[k];
+	}
+}
+
+
+void
+Mesh::GetBoundingSphere( float center[3], float *radius )
+{
+	center[0] = BoundCenter[0];
+	center[1] = BoundCenter[1];
+	center[2] = BoundCenter[2];
+	*radius = BoundRadius;
+}
+
+
+// the box around n positions, stride bytes apart, and the sphere centered in it that reaches the farthest one:
+
+void
+Mesh::FitBound( const GLubyte *xyz, int n, size_t stride )
+{
+	float *lo = BoundMin;
+	float *hi = BoundMax;
+	for( int i = 0; i < n; i++ )
+	{
+		const float *p = (const float *)( xyz + i*stride );
+		for( int k = 0; k < 3; k++ )
+		{
+			if( i == 0  ||  p[k] < lo[k] )	lo[k] = p[k];
+			if( i == 0  ||  p[k] > hi[k] )	hi[k] = p[k];
+		}
+	}
+	BoundRadius = 0.;
+	if( n == 0 )
+		return;
+	for( int k = 0; k < 3; k++ )
+		BoundCenter[k] = 0.5f * ( lo[k] + hi[k] );
+	for( int i = 0; i < n; i++ )
+		GrowBound( (const float *)( xyz + i*stride ), 1 );
+}
+
+
+// make the box and the sphere big enough to hold n more positions (without moving the sphere's center):
+
+void
+Mesh::GrowBound( const float *xyz, int n )
+{
+	for( int i = 0; i < n; i++ )
+	{
+		float dx = xyz[3*i+0] - BoundCenter[0];
+		float dy = xyz[3*i+1] - BoundCenter[1];
+		float dz = xyz[3*i+2] - BoundCenter[2];
+		float d = sqrtf( dx*dx + dy*dy + dz*dz );
+		if( d > BoundRadius )
+			BoundRadius = d;
+		for( int k = 0; k < 3; k++ )
+		{
+			if( xyz[3*i+k] < BoundMin[k] )	BoundMin[k] = xyz[3*i+k];
+			if( xyz[3*i+k] > BoundMax[k] )	BoundMax[k] = xyz[3*i+k];
+		}
+	}
+}
+
+
+size_t
+Mesh::GetGpuBytes( )
+{
+	return GpuBytes;
+}
+
+
+size_t
+Mesh::GetTotalGpuBytes( )
+{
+	return TotalGpuBytes;
+}
+
+
+// (a mesh from UploadEmbedded( ) has no cpu copy, so what is in its buffers is counted instead)
+
+int
+Mesh::GetNumVertices( )
+{
+	if( Positions.empty( ) )
+		return NumVertices;
+	return (int)Positions.size( ) / 3;
+}
+
+
+int
+Mesh::GetNumTriangles( )
+{
+	int n = Indices.empty( ) ? (int)Positions.size( )/3 : (int)Indices.size( );
+	if( Positions.empty( ) )
+		n = NumIndices;
+	if( Topology == GL_TRIANGLES )
+		return n / 3;
+	if( Topology == GL_TRIANGLE_STRIP  ||  Topology == GL_TRIANGLE_FAN )
+		return n > 2 ? n - 2 : 0;
+	return 0;
+}
+
+#endif		// #ifndef MESH_CPP
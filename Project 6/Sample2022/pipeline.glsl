@@ -0,0 +1,72 @@
+// the lights and the material of the fixed-function pipeline -- see pipeline.h:
+
+const int PIPELINE_LIGHTS = 4;		// the same as in pipeline.h
+
+uniform bool	uLighting;
+uniform bool	uColorMaterial;		// the color takes the place of the ambient and diffuse material
+
+uniform bool	uLightOn[PIPELINE_LIGHTS];
+uniform vec4	uLightPosition[PIPELINE_LIGHTS];	// eye coordinates, w = 0. for a directional light
+uniform vec4	uLightAmbient[PIPELINE_LIGHTS];
+uniform vec4	uLightDiffuse[PIPELINE_LIGHTS];
+uniform vec4	uLightSpecular[PIPELINE_LIGHTS];
+uniform vec3	uSpotDirection[PIPELINE_LIGHTS];	// eye coordinates
+uniform float	uSpotExponent[PIPELINE_LIGHTS];
+uniform float	uSpotCutoff[PIPELINE_LIGHTS];		// degrees, 180. means not a spot light
+uniform vec3	uAttenuation[PIPELINE_LIGHTS];		// constant, linear, quadratic
+uniform vec4	uSceneAmbient;
+
+uniform vec4	uMatAmbient;
+uniform vec4	uMatDiffuse;
+uniform vec4	uMatSpecular;
+uniform vec4	uMatEmission;
+uniform float	uMatShininess;
+
+
+// the gl lighting equation, with the eye at infinity (GL_LIGHT_MODEL_LOCAL_VIEWER is off):
+
+vec4
+Lighting( vec3 ECposition, vec3 Normal, vec4 color )
+{
+	vec4 ambient = uColorMaterial ? color : uMatAmbient;
+	vec4 diffuse = uColorMaterial ? color : uMatDiffuse;
+	vec3 sum = uMatEmission.rgb + uSceneAmbient.rgb * ambient.rgb;
+
+	for( int i = 0; i < PIPELINE_LIGHTS; i++ )
+	{
+		if( ! uLightOn[i] )
+			continue;
+
+		vec3 Light;
+		float attenuation = 1.;
+		if( uLightPosition[i].w != 0. )
+		{
+			vec3 toLight = uLightPosition[i].xyz / uLightPosition[i].w - ECposition;
+			float d = length( toLight );
+			Light = toLight / d;
+			attenuation = 1. / ( uAttenuation[i].x + uAttenuation[i].y * d + uAttenuation[i].z * d * d );
+		}
+		else
+			Light = normalize( uLightPosition[i].xyz );
+
+		if( uSpotCutoff[i] != 180. )
+		{
+			float c = dot( -Light, normalize( uSpotDirection[i] ) );
+			attenuation *= ( c >= cos( radians( uSpotCutoff[i] ) ) )  ?  pow( max( c, 0. ), uSpotExponent[i] )  :  0.;
+		}
+
+		vec3 term = uLightAmbient[i].rgb * ambient.rgb;
+		float d = dot( Normal, Light );
+		if( d > 0. )			// only do diffuse and specular if the light can see the point
+		{
+			term += d * uLightDiffuse[i].rgb * diffuse.rgb;
+			vec3 H = normalize( Light + vec3( 0., 0., 1. ) );
+			float s = max( dot( Normal, H ), 0. );
+			if( s > 0.  ||  uMatShininess == 0. )
+				term += pow( s, uMatShininess ) * uLightSpecular[i].rgb * uMatSpecular.rgb;
+		}
+		sum += attenuation * term;
+	}
+
+	return vec4( clamp( sum, 0., 1. ), diffuse.a );
+}
@@ -0,0 +1,370 @@
+#ifndef BODIES_CPP
+#define BODIES_CPP
+
+#include "bodies.h"
+
+#include <string.h>
+#include <chrono>
+
+
+BodyStore::BodyStore( )
+{
+	MoveMs = 0.;
+}
+
+
+// add a body going around parent (a body that AddBody( ) returned, or NO_BODY) -- it starts out
+// with no orbit, no spin, and no texture:
+// returns the new body
+
+int
+BodyStore::AddBody( const char *name, int parent, float distance, float radius, Mesh *mesh, int flags )
+{
+	int body = (int)Parents.size( );
+	if( parent != NO_BODY  &&  ( parent < 0  ||  parent >= body ) )
+	{
+		fprintf( stderr, "BodyStore::AddBody: there is no body %d to be the parent\n", parent );
+		parent = NO_BODY;
+	}
+
+	Names.push_back( name != NULL  ?  name  :  "" );
+	Parents.push_back( parent );
+	Distances.push_back( distance );
+	Radii.push_back( radius );
+	Meshes.push_back( mesh );
+	Textures.push_back( 0 );
+	Flags.push_back( flags );
+	Nodes.push_back( -1 );
+	OrbitOf.push_back( -1 );
+	SpinOf.push_back( -1 );
+	return body;
+}
+
+
+// give every body its nodes in scene, which should have just been cleared:
+
+void
+BodyStore::Build( SceneGraph &scene )
+{
+	int n = GetNumBodies( );
+	for( int i = 0; i < n; i++ )
+	{
+		int parent = Parents[i] == NO_BODY  ?  SCENE_ROOT  :  Nodes[ Parents[i] ];
+
+		int k = OrbitOf[i];
+		if( k >= 0 )
+		{
+			OrbitNodes[k] = scene.AddNode( parent, false );
+			parent = OrbitNodes[k];
+		}
+
+		Nodes[i] = scene.AddNode( parent, ( Flags[i] & BODY_INSTANCED ) != 0 );
+		scene.SetTranslation( Nodes[i], 0., 0., Distances[i] );
+		scene.SetScale( Nodes[i], Radii[i] );
+
+		k = SpinOf[i];
+		if( k >= 0 )
+			SpinNodes[k] = Nodes[i];
+	}
+}
+
+
+// get rid of every body (the textures are kept, so a scene that is loaded again does not load them again):
+
+void
+BodyStore::Clear( )
+{
+	Names.clear( );
+	Parents.clear( );
+	Distances.clear( );
+	Radii.clear( );
+	Meshes.clear( );
+	Textures.clear( );
+	Flags.clear( );
+	Nodes.clear( );
+	OrbitOf.clear( );
+	OrbitBodies.clear( );
+	OrbitNodes.clear( );
+	OrbitRates.clear( );
+	OrbitPhases.clear( );
+	OrbitTilts.clear( );
+	SpinOf.clear( );
+	SpinBodies.clear( );
+	SpinNodes.clear( );
+	SpinRates.clear( );
+	TextureFiles.clear( );
+}
+
+
+// the body with this name, or NO_BODY:
+
+int
+BodyStore::Find( const char *name )
+{
+	for( int i = 0; i < (int)Names.size( ); i++ )
+	{
+		if( Names[i] == name )
+			return i;
+	}
+	return NO_BODY;
+}
+
+
+float
+BodyStore::GetDistance( int body )
+{
+	return Distances[body];
+}
+
+
+int
+BodyStore::GetFlags( int body )
+{
+	return Flags[body];
+}
+
+
+Mesh *
+BodyStore::GetMesh( int body )
+{
+	return Meshes[body];
+}
+
+
+const char *
+BodyStore::GetName( int body )
+{
+	return Names[body].c_str( );
+}
+
+
+// the body's node in the scene graph -- its world matrix is the scene graph's GetWorld( ) of it:
+
+int
+BodyStore::GetNode( int body )
+{
+	return Nodes[body];
+}
+
+
+int
+BodyStore::GetNumBodies( )
+{
+	return (int)Parents.size( );
+}
+
+
+int
+BodyStore::GetParent( int body )
+{
+	return Parents[body];
+}
+
+
+float
+BodyStore::GetRadius( int body )
+{
+	return Radii[body];
+}
+
+
+GLuint
+BodyStore::GetTexture( int body )
+{
+	return Textures[body];
+}
+
+
+// add the bodies in a scene file, each drawn with mesh:
+// returns false if the file cannot be read
+// (a line that does not make sense is skipped, and said so)
+
+bool
+BodyStore::Load( const char *file, Mesh *mesh )
+{
+	FILE *fp = fopen( file, "r" );
+	if( fp == NULL )
+	{
+		fprintf( stderr, "Cannot open scene file '%s'\n", file );
+		return false;
+	}
+
+	char line[512];
+	int lineNumber = 0;
+	int loaded = 0;
+	while( fgets( line, sizeof(line), fp ) != NULL )
+	{
+		lineNumber++;
+		char *comment = strchr( line, '#' );
+		if( comment != NULL )
+			*comment = '\0';
+
+		char name[64], parentName[64], texture[256];
+		float distance, radius, orbitRate, orbitPhase, orbitTilt, spinRate;
+		int used = 0;
+		int fields = sscanf( line, "%63s %63s %f %f %f %f %f %f %255s%n", name, parentName, &distance, &radius,
+					&orbitRate, &orbitPhase, &orbitTilt, &spinRate, texture, &used );
+		if( fields <= 0 )
+			continue;			// a blank line
+		if( fields < 9 )
+		{
+			fprintf( stderr, "%s, line %d: a body needs a name, parent, distance, radius, orbit rate, orbit phase, orbit tilt, spin rate, and texture\n",
+				file, lineNumber );
+			continue;
+		}
+
+		int parent = NO_BODY;
+		if( strcmp( parentName, "-" ) != 0 )
+		{
+			parent = Find( parentName );
+			if( parent == NO_BODY )
+			{
+				fprintf( stderr, "%s, line %d: there is no body called '%s' before '%s'\n", file, lineNumber, parentName, name );
+				continue;
+			}
+		}
+
+		int flags = 0;
+		for( char *word = strtok( &line[used], " \t\r\n" ); word != NULL; word = strtok( NULL, " \t\r\n" ) )
+		{
+			if( strcmp( word, "instanced" ) == 0 )
+				flags |= BODY_INSTANCED;
+			else if( strcmp( word, "glows" ) == 0 )
+				flags |= BODY_GLOWS;
+			else if( strcmp( word, "ring" ) == 0 )
+				flags |= BODY_RING;
+			else
+				fprintf( stderr, "%s, line %d: don't know the flag '%s'\n", file, lineNumber, word );
+		}
+
+		int body = AddBody( name, parent, distance, radius, mesh, flags );
+		if( orbitRate != 0.  ||  orbitPhase != 0.  ||  orbitTilt != 0. )
+			SetOrbit( body, orbitRate, orbitPhase, orbitTilt );
+		if( spinRate != 0. )
+			SetSpin( body, spinRate );
+		if( strcmp( texture, "-" ) != 0 )
+		{
+			TextureFiles.resize( body + 1 );
+			TextureFiles[body] = texture;
+		}
+		loaded++;
+	}
+	fclose( fp );
+
+	fprintf( stderr, "Loaded %d bodies from '%s'\n", loaded, file );
+	return true;
+}
+
+
+// make the textures the scene files named, with load( file ) -- a file that has been loaded
+// before, by this scene or one before it, is not loaded again:
+
+void
+BodyStore::LoadTextures( GLuint (*load)( const char * ) )
+{
+	for( int i = 0; i < (int)TextureFiles.size( ); i++ )
+	{
+		const std::string &file = TextureFiles[i];
+		if( file.empty( ) )
+			continue;
+
+		std::map<std::string,GLuint>::iterator it = TextureObjects.find( file );
+		if( it == TextureObjects.end( ) )
+			it = TextureObjects.insert( std::make_pair( file, ( *load )( file.c_str( ) ) ) ).first;
+		Textures[i] = it->second;
+	}
+	TextureFiles.clear( );
+}
+
+
+// the orbit system and the spin system -- turn everything to where it is at time:
+// (this only marks the nodes, the scene graph's Update( ) computes their matrices)
+
+void
+BodyStore::Move( SceneGraph &scene, float time )
+{
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now( );
+
+	const glm::vec3 xAxis( 1., 0., 0. );
+	const glm::vec3 yAxis( 0., 1., 0. );
+	const float twoPi = glm::two_pi<float>( );
+
+	int n = (int)OrbitNodes.size( );
+	for( int k = 0; k < n; k++ )
+	{
+		glm::quat tilt = glm::angleAxis( glm::radians( OrbitTilts[k] ), xAxis );
+		glm::quat turn = glm::angleAxis( twoPi * ( OrbitRates[k] * time + OrbitPhases[k] ), yAxis );
+		scene.SetRotation( OrbitNodes[k], tilt * turn );
+	}
+
+	n = (int)SpinNodes.size( );
+	for( int k = 0; k < n; k++ )
+		scene.SetRotation( SpinNodes[k], glm::angleAxis( twoPi * SpinRates[k] * time, yAxis ) );
+
+	MoveMs = std::chrono::duration<double, std::milli>( std::chrono::steady_clock::now( ) - start ).count( );
+}
+
+
+void
+BodyStore::PrintStats( FILE *fp )
+{
+	fprintf( fp, "BodyStore: %d bodies, %d orbits and %d spins moved in %.3f ms\n",
+		GetNumBodies( ), (int)OrbitNodes.size( ), (int)SpinNodes.size( ), MoveMs );
+}
+
+
+// put the bodies that have all of the flags in with, and none of the ones in without, into bodies:
+// returns how many there are
+
+int
+BodyStore::Select( int with, int without, std::vector<int> &bodies )
+{
+	bodies.clear( );
+	int n = GetNumBodies( );
+	for( int i = 0; i < n; i++ )
+	{
+		if( ( Flags[i] & with ) == with  &&  ( Flags[i] & without ) == 0 )
+			bodies.push_back( i );
+	}
+	return (int)bodies.size( );
+}
+
+
+// give a body an orbit, or change the one it has:
+
+void
+BodyStore::SetOrbit( int body, float rate, float phase, float tilt )
+{
+	int k = OrbitOf[body];
+	if( k < 0 )
+	{
+		k = OrbitOf[body] = (int)OrbitBodies.size( );
+		OrbitBodies.push_back( body );
+		OrbitNodes.push_back( -1 );
+		OrbitRates.push_back( 0. );
+		OrbitPhases.push_back( 0. );
+		OrbitTilts.push_back( 0. );
+	}
+	OrbitRates[k] = rate;
+	OrbitPhases[k] = phase;
+	OrbitTilts[k] = tilt;
+}
+
+
+// give a body a spin, or change the one it has:
+
+void
+BodyStore::SetSpin( int body, float rate )
+{
+	int k = SpinOf[body];
+	if( k < 0 )
+	{
+		k = SpinOf[body] = (int)SpinBodies.size( );
+		SpinBodies.push_back( body );
+		SpinNodes.push_back( -1 );
+		SpinRates.push_back( 0. );
+	}
+	SpinRates[k] = rate;
+}
+
+#endif		// #ifndef BODIES_CPP
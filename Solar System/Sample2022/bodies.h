@@ -0,0 +1,112 @@
+#ifndef BODIES_H
+#define BODIES_H
+
+#include <stdio.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "scenegraph.cpp"
+
+class Mesh;
+
+
+// the bodies in a scene -- a sun, planets, moons, satellites -- kept as an entity-component store
+// instead of a handful of globals for each one:
+//
+//	a body is just a number, and what it has is kept in arrays, one array per value, so a system
+//	that only needs some of the values only goes through those arrays
+//	every body has a parent (or NO_BODY), a distance from it, a radius, a mesh, a texture, and flags
+//	a body that goes around its parent also has an orbit, and one that turns has a spin -- these are
+//	only kept for the bodies that have them, packed together, so Move( ) is one short loop over each
+//
+//	distances and radii are in the parent's units (a moon 2. from its planet is 2 planet radii out),
+//	or in world units for a body with no parent
+//	rates are in revolutions per Time, phases in revolutions, and tilts in degrees about x
+//	a body is at (0.,0.,distance) from its parent when its orbit is at phase 0.
+//
+//	Build( ) gives every body a node in a scene graph (and another under it for an orbit), so the
+//	scene graph does all the matrix work -- bodies must be added after their parents
+//
+//	a scene file has a line for each body:
+//		name  parent  distance  radius  orbit-rate  orbit-phase  orbit-tilt  spin-rate  texture  flags...
+//	parent and texture are - for none, the flags are any of: instanced  glows  ring
+//	and # starts a comment
+//
+//	use:
+//		BodyStore Bodies;
+//		Bodies.Load( "solarsystem.txt", &PlanetMesh );
+//		Bodies.LoadTextures( LoadTexture );		// GLuint LoadTexture( const char *file )
+//		int moon = Bodies.AddBody( NULL, planet, 2., 0.1, &MoonMesh, BODY_INSTANCED );
+//		Bodies.SetOrbit( moon, 5., 0., 10. );
+//		Bodies.Build( Solar );
+//		...
+//		Bodies.Move( Solar, Time );			// every frame, then Solar.Update( )
+
+const int NO_BODY = -1;
+
+// the flags:
+
+const int BODY_INSTANCED = 1;		// drawn as one of its mesh's instances, from the scene graph's instance buffer
+const int BODY_GLOWS     = 2;		// lights itself, so it is drawn without lighting
+const int BODY_RING      = 4;		// its orbit is drawn
+
+class BodyStore
+{
+  private:
+	// every body has these -- entry i is body i's:
+
+	std::vector<std::string>	Names;			// "" for the ones that do not need one
+	std::vector<int>		Parents;
+	std::vector<float>		Distances;
+	std::vector<float>		Radii;
+	std::vector<Mesh *>		Meshes;
+	std::vector<GLuint>		Textures;		// 0 for none
+	std::vector<int>		Flags;
+	std::vector<int>		Nodes;			// in the scene graph, from Build( )
+
+	// orbits, for the bodies that have one:
+
+	std::vector<int>		OrbitOf;		// by body, or -1
+	std::vector<int>		OrbitBodies;
+	std::vector<int>		OrbitNodes;
+	std::vector<float>		OrbitRates, OrbitPhases, OrbitTilts;
+
+	// spins, for the bodies that have one:
+
+	std::vector<int>		SpinOf;			// by body, or -1
+	std::vector<int>		SpinBodies;
+	std::vector<int>		SpinNodes;
+	std::vector<float>		SpinRates;
+
+	std::vector<std::string>	TextureFiles;		// by body, until LoadTextures( )
+	std::map<std::string,GLuint>	TextureObjects;		// every texture ever loaded, by file, so they are only loaded once
+
+	double	MoveMs;			// by the last Move( )
+
+  public:
+		BodyStore( );
+
+	int		AddBody( const char *, int, float, float, Mesh *, int = 0 );
+	void		Build( SceneGraph & );
+	void		Clear( );
+	int		Find( const char * );
+	float		GetDistance( int );
+	int		GetFlags( int );
+	Mesh *		GetMesh( int );
+	const char *	GetName( int );
+	int		GetNode( int );
+	int		GetNumBodies( );
+	int		GetParent( int );
+	float		GetRadius( int );
+	GLuint		GetTexture( int );
+	bool		Load( const char *, Mesh * );
+	void		LoadTextures( GLuint (*)( const char * ) );
+	void		Move( SceneGraph &, float );
+	void		PrintStats( FILE * );
+	int		Select( int, int, std::vector<int> & );
+	void		SetOrbit( int, float, float, float );
+	void		SetSpin( int, float );
+};
+
+#endif		// #ifndef BODIES_H
@@ -0,0 +1,423 @@
+#ifndef BVH_CPP
+#define BVH_CPP
+
+#include "bvh.h"
+
+#include <float.h>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+
+// where the ray goes into the box (and whether it does before TMax):
+// (a direction of 0. makes an inverse of +-infinity, and then the comparisons come out right)
+
+bool
+BvhRay::HitBox( const float bmin[3], const float bmax[3], float *tEnter ) const
+{
+	float t0 = 0.;
+	float t1 = TMax;
+	for( int k = 0; k < 3; k++ )
+	{
+		float ta = ( bmin[k] - Origin[k] ) * InvDirection[k];
+		float tb = ( bmax[k] - Origin[k] ) * InvDirection[k];
+		if( ta > tb )
+			std::swap( ta, tb );
+		if( ta > t0 )	t0 = ta;
+		if( tb < t1 )	t1 = tb;
+	}
+	*tEnter = t0;
+	return t0 <= t1;
+}
+
+
+// the ray is origin + t*direction, for t from 0. to tmax:
+
+void
+BvhRay::Set( const float origin[3], const float direction[3], float tmax )
+{
+	for( int k = 0; k < 3; k++ )
+	{
+		Origin[k] = origin[k];
+		Direction[k] = direction[k];
+		InvDirection[k] = 1.f / direction[k];
+	}
+	TMax = tmax;
+	NodesVisited = ItemsTested = 0;
+}
+
+
+Bvh::Bvh( )
+{
+	BuildMin = BuildMax = NULL;
+	NumThreads = (int)std::thread::hardware_concurrency( );
+	if( NumThreads < 1 )
+		NumThreads = 1;
+	ThreadsUsed = 0;
+	BuildMs = 0.;
+}
+
+
+// half the surface area of a box -- what the surface area heuristic compares:
+
+static float
+BvhArea( const float bmin[3], const float bmax[3] )
+{
+	float dx = bmax[0] - bmin[0];
+	float dy = bmax[1] - bmin[1];
+	float dz = bmax[2] - bmin[2];
+	return dx*dy + dy*dz + dz*dx;
+}
+
+
+// make the tree for n items -- item i's box goes from bmin[3*i] to bmax[3*i]:
+
+void
+Bvh::Build( int n, const float *bmin, const float *bmax )
+{
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now( );
+
+	Items.resize( n );
+	Centers.resize( 3*n );
+	for( int i = 0; i < n; i++ )
+	{
+		Items[i] = i;
+		for( int k = 0; k < 3; k++ )
+			Centers[3*i+k] = 0.5f * ( bmin[3*i+k] + bmax[3*i+k] );
+	}
+
+	// no leaf is empty, so there are never more than 2n-1 nodes:
+
+	Nodes.clear( );
+	ThreadsUsed = 1;
+	if( n > 0 )
+	{
+		Nodes.resize( 2*n - 1 );
+		BuildMin = bmin;
+		BuildMax = bmax;
+		std::atomic<int> next( 1 ), used( 1 );
+		BuildNode( 0, 0, n, 0, NumThreads, &next, &used );
+		Nodes.resize( next );
+		ThreadsUsed = used;
+		BuildMin = BuildMax = NULL;
+	}
+	Centers.clear( );
+
+	BuildMs = std::chrono::duration<double, std::milli>( std::chrono::steady_clock::now( ) - start ).count( );
+}
+
+
+// node index holds the items from first to first+count-1 -- split it where the surface area heuristic
+// says to, if splitting it is better than leaving it a leaf:
+// (next gives out the node numbers, two at a time, so threads building different subtrees do not collide)
+
+void
+Bvh::BuildNode( int index, int first, int count, int depth, int threads, std::atomic<int> *next, std::atomic<int> *used )
+{
+	BvhNode &node = Nodes[index];
+	node.First = first;
+	node.Count = count;
+	node.Left = node.Right = -1;
+	FitNode( node, BuildMin, BuildMax );
+	if( count <= BVH_LEAF  ||  depth >= BVH_MAX_DEPTH )
+		return;
+
+	// the box around the items' centers -- the bins divide that up:
+
+	float lo[3], hi[3];
+	for( int k = 0; k < 3; k++ )
+		lo[k] = hi[k] = Centers[ 3*Items[first] + k ];
+	for( int i = first + 1; i < first + count; i++ )
+	{
+		const float *c = &Centers[ 3*Items[i] ];
+		for( int k = 0; k < 3; k++ )
+		{
+			if( c[k] < lo[k] )	lo[k] = c[k];
+			if( c[k] > hi[k] )	hi[k] = c[k];
+		}
+	}
+
+	int bestAxis = -1;
+	int bestBin = 0;
+	float bestCost = 0.;
+	for( int axis = 0; axis < 3; axis++ )
+	{
+		float extent = hi[axis] - lo[axis];
+		if( extent <= 0. )
+			continue;
+		float scale = (float)BVH_BINS / extent;
+
+		int binCount[BVH_BINS];
+		float binMin[BVH_BINS][3], binMax[BVH_BINS][3];
+		for( int b = 0; b < BVH_BINS; b++ )
+		{
+			binCount[b] = 0;
+			for( int k = 0; k < 3; k++ )
+			{
+				binMin[b][k] =  FLT_MAX;
+				binMax[b][k] = -FLT_MAX;
+			}
+		}
+		for( int i = first; i < first + count; i++ )
+		{
+			int item = Items[i];
+			int b = (int)( ( Centers[3*item+axis] - lo[axis] ) * scale );
+			if( b > BVH_BINS - 1 )
+				b = BVH_BINS - 1;
+			const float *mn = &BuildMin[3*item];
+			const float *mx = &BuildMax[3*item];
+			for( int k = 0; k < 3; k++ )
+			{
+				binMin[b][k] = mn[k] < binMin[b][k]  ?  mn[k]  :  binMin[b][k];
+				binMax[b][k] = mx[k] > binMax[b][k]  ?  mx[k]  :  binMax[b][k];
+			}
+			binCount[b]++;
+		}
+
+		// the cost of splitting after each bin -- the left side's, sweeping up, then the right side's, sweeping down:
+
+		float leftCost[BVH_BINS];
+		float mn[3], mx[3];
+		int n = 0;
+		for( int b = 0; b < BVH_BINS - 1; b++ )
+		{
+			if( binCount[b] > 0 )
+			{
+				for( int k = 0; k < 3; k++ )
+				{
+					if( n == 0  ||  binMin[b][k] < mn[k] )	mn[k] = binMin[b][k];
+					if( n == 0  ||  binMax[b][k] > mx[k] )	mx[k] = binMax[b][k];
+				}
+				n += binCount[b];
+			}
+			leftCost[b] = n == 0  ?  0.f  :  BvhArea( mn, mx ) * (float)n;
+		}
+		n = 0;
+		for( int b = BVH_BINS - 1; b > 0; b-- )
+		{
+			if( binCount[b] > 0 )
+			{
+				for( int k = 0; k < 3; k++ )
+				{
+					if( n == 0  ||  binMin[b][k] < mn[k] )	mn[k] = binMin[b][k];
+					if( n == 0  ||  binMax[b][k] > mx[k] )	mx[k] = binMax[b][k];
+				}
+				n += binCount[b];
+			}
+			if( n == 0  ||  n == count )
+				continue;
+			float cost = leftCost[b-1] + BvhArea( mn, mx ) * (float)n;
+			if( bestAxis < 0  ||  cost < bestCost )
+			{
+				bestAxis = axis;
+				bestBin = b - 1;
+				bestCost = cost;
+			}
+		}
+	}
+
+	// a split costs one more box test, and then each side's items, as likely as a ray is to go into that side --
+	// a leaf costs all of its items:
+
+	float area = BvhArea( node.Min, node.Max );
+	int mid;
+	if( bestAxis >= 0 )
+	{
+		if( area > 0.  &&  count <= BVH_MAX_LEAF  &&  1.f + bestCost / area >= (float)count )
+			return;
+		float scale = (float)BVH_BINS / ( hi[bestAxis] - lo[bestAxis] );
+		float low = lo[bestAxis];
+		const std::vector<float> &centers = Centers;
+		int *split = std::partition( &Items[first], &Items[first] + count,
+			[&centers, bestAxis, bestBin, scale, low]( int item )
+			{
+				int b = (int)( ( centers[3*item+bestAxis] - low ) * scale );
+				return ( b > BVH_BINS - 1  ?  BVH_BINS - 1  :  b ) <= bestBin;
+			} );
+		mid = (int)( split - &Items[0] );
+		if( mid == first  ||  mid == first + count )
+			mid = first + count / 2;
+	}
+	else
+	{
+		// every center is in the same place -- just halve a node that is too big to be a leaf:
+
+		if( count <= BVH_MAX_LEAF )
+			return;
+		mid = first + count / 2;
+	}
+
+	int left = next->fetch_add( 2 );
+	int right = left + 1;
+	node.Left = left;
+	node.Right = right;
+
+	if( threads > 1  &&  count >= BVH_MIN_ITEMS_PER_THREAD )
+	{
+		int half = threads / 2;
+		std::thread t( &Bvh::BuildNode, this, left, first, mid - first, depth + 1, half, next, used );
+		used->fetch_add( 1 );
+		BuildNode( right, mid, first + count - mid, depth + 1, threads - half, next, used );
+		t.join( );
+	}
+	else
+	{
+		BuildNode( left, first, mid - first, depth + 1, 1, next, used );
+		BuildNode( right, mid, first + count - mid, depth + 1, 1, next, used );
+	}
+}
+
+
+// a leaf's box is the box around its items':
+
+void
+Bvh::FitNode( BvhNode &node, const float *bmin, const float *bmax )
+{
+	for( int i = node.First; i < node.First + node.Count; i++ )
+	{
+		int item = Items[i];
+		for( int k = 0; k < 3; k++ )
+		{
+			if( i == node.First  ||  bmin[3*item+k] < node.Min[k] )	node.Min[k] = bmin[3*item+k];
+			if( i == node.First  ||  bmax[3*item+k] > node.Max[k] )	node.Max[k] = bmax[3*item+k];
+		}
+	}
+}
+
+
+// the box around everything:
+
+void
+Bvh::GetBounds( float bmin[3], float bmax[3] )
+{
+	for( int k = 0; k < 3; k++ )
+	{
+		bmin[k] = Nodes.empty( )  ?  0.f  :  Nodes[0].Min[k];
+		bmax[k] = Nodes.empty( )  ?  0.f  :  Nodes[0].Max[k];
+	}
+}
+
+
+int
+Bvh::GetNumItems( )
+{
+	return (int)Items.size( );
+}
+
+
+int
+Bvh::GetNumNodes( )
+{
+	return (int)Nodes.size( );
+}
+
+
+void
+Bvh::PrintStats( FILE *fp, const char *what )
+{
+	fprintf( fp, "Bvh (%s): %d items, %d nodes, built in %.3f ms on %d threads\n",
+		what, GetNumItems( ), GetNumNodes( ), BuildMs, ThreadsUsed );
+}
+
+
+// fit the node boxes to where the items' boxes are now, children first:
+
+void
+Bvh::Refit( const float *bmin, const float *bmax )
+{
+	for( int i = (int)Nodes.size( ) - 1; i >= 0; i-- )
+	{
+		BvhNode &node = Nodes[i];
+		if( node.Left < 0 )
+		{
+			FitNode( node, bmin, bmax );
+			continue;
+		}
+		const BvhNode &a = Nodes[node.Left];
+		const BvhNode &b = Nodes[node.Right];
+		for( int k = 0; k < 3; k++ )
+		{
+			node.Min[k] = a.Min[k] < b.Min[k]  ?  a.Min[k]  :  b.Min[k];
+			node.Max[k] = a.Max[k] > b.Max[k]  ?  a.Max[k]  :  b.Max[k];
+		}
+	}
+}
+
+
+// how many threads Build( ) may use (it uses fewer when there are not many items):
+
+void
+Bvh::SetThreads( int threads )
+{
+	NumThreads = threads < 1  ?  1  :  threads;
+}
+
+
+// follow the ray down the tree, nearer child first:
+// returns whether HitItem( ) hit anything
+
+bool
+Bvh::Trace( BvhRay &ray )
+{
+	if( Nodes.empty( ) )
+		return false;
+
+	float t;
+	if( ! ray.HitBox( Nodes[0].Min, Nodes[0].Max, &t ) )
+		return false;
+
+	// each node on the stack is one the ray goes into, at tStack:
+
+	int nodeStack[ 2*BVH_MAX_DEPTH + 2 ];
+	float tStack[ 2*BVH_MAX_DEPTH + 2 ];
+	int top = 0;
+	nodeStack[top] = 0;
+	tStack[top] = t;
+	top++;
+
+	bool hit = false;
+	while( top > 0 )
+	{
+		top--;
+		if( tStack[top] > ray.TMax )
+			continue;			// something nearer has been hit since it was pushed
+		const BvhNode &node = Nodes[ nodeStack[top] ];
+		ray.NodesVisited++;
+
+		if( node.Left < 0 )
+		{
+			for( int i = node.First; i < node.First + node.Count; i++ )
+			{
+				ray.ItemsTested++;
+				if( ray.HitItem( Items[i] ) )
+					hit = true;
+			}
+			continue;
+		}
+
+		float tLeft, tRight;
+		bool left = ray.HitBox( Nodes[node.Left].Min, Nodes[node.Left].Max, &tLeft );
+		bool right = ray.HitBox( Nodes[node.Right].Min, Nodes[node.Right].Max, &tRight );
+		if( left  &&  right  &&  tLeft <= tRight )
+		{
+			nodeStack[top] = node.Right;	tStack[top] = tRight;	top++;
+			nodeStack[top] = node.Left;	tStack[top] = tLeft;	top++;
+		}
+		else if( left  &&  right )
+		{
+			nodeStack[top] = node.Left;	tStack[top] = tLeft;	top++;
+			nodeStack[top] = node.Right;	tStack[top] = tRight;	top++;
+		}
+		else if( left )
+		{
+			nodeStack[top] = node.Left;	tStack[top] = tLeft;	top++;
+		}
+		else if( right )
+		{
+			nodeStack[top] = node.Right;	tStack[top] = tRight;	top++;
+		}
+	}
+	return hit;
+}
+
+#endif		// #ifndef BVH_CPP
@@ -0,0 +1,90 @@
+#ifndef BVH_H
+#define BVH_H
+
+#include <stdio.h>
+#include <atomic>
+#include <vector>
+
+
+// a bounding volume hierarchy of boxes, for finding what a ray hits without testing everything:
+//
+//	each item is an axis-aligned box, known by the number it was given to Build( ) with --
+//	a triangle, or a whole object
+//	Build( ) sorts them into a binary tree of boxes with the surface area heuristic: each node is
+//	split where the chance of a ray going into each side (the side's surface area) times the number
+//	of items on that side is smallest, trying BVH_BINS places along each axis
+//	the two halves of a big node are built at the same time on different threads
+//
+//	when the items move, Refit( ) grows and shrinks the node boxes to fit without changing the
+//	tree -- that is cheap, but if they wander far from where they were, Build( ) should be done again
+//
+//	Trace( ) goes down the tree nearest box first, and calls the ray's HitItem( ) for each item in a
+//	leaf it reaches -- HitItem( ) makes TMax smaller when it hits something, so boxes farther than
+//	that are skipped from then on
+//
+//	use:
+//		struct MyRay : public BvhRay { bool HitItem( int item ) { ... } };
+//		Bvh Tree;
+//		Tree.Build( n, bmin, bmax );			// 3 floats per item in each
+//		...
+//		MyRay ray;
+//		ray.Set( origin, direction, tmax );
+//		if( Tree.Trace( ray ) )
+//			...
+
+const int BVH_BINS = 16;
+const int BVH_LEAF = 4;				// a node this small is never split
+const int BVH_MAX_LEAF = 16;			// a node this big is always split
+const int BVH_MIN_ITEMS_PER_THREAD = 4096;	// a node smaller than this does not get a thread of its own
+const int BVH_MAX_DEPTH = 64;			// a node this deep is a leaf, however big it is
+
+// a ray for Trace( ) -- HitItem( ) says whether the item is hit closer than TMax, and if it is, makes TMax that close:
+
+struct BvhRay
+{
+	float		Origin[3], Direction[3];
+	float		InvDirection[3];
+	float		TMax;
+	int		NodesVisited, ItemsTested;
+
+	bool		HitBox( const float [3], const float [3], float * ) const;
+	void		Set( const float [3], const float [3], float );
+	virtual bool	HitItem( int ) = 0;
+	virtual		~BvhRay( ) { }
+};
+
+class Bvh
+{
+  private:
+	struct BvhNode
+	{
+		float		Min[3], Max[3];
+		int		Left, Right;		// children, or -1 for a leaf
+		int		First, Count;		// the items under it, in tree order
+	};
+
+	std::vector<BvhNode>	Nodes;			// parents before their children
+	std::vector<int>	Items;			// which item is at each place in tree order
+	std::vector<float>	Centers;		// 3 per item, while building
+	const float		*BuildMin, *BuildMax;	// while building
+	int			NumThreads;		// the most Build( ) may use
+	int			ThreadsUsed;		// by the last Build( )
+	double			BuildMs;
+
+	void	BuildNode( int, int, int, int, int, std::atomic<int> *, std::atomic<int> * );
+	void	FitNode( BvhNode &, const float *, const float * );
+
+  public:
+		Bvh( );
+
+	void	Build( int, const float *, const float * );
+	void	GetBounds( float [3], float [3] );
+	int	GetNumItems( );
+	int	GetNumNodes( );
+	void	PrintStats( FILE *, const char * );
+	void	Refit( const float *, const float * );
+	void	SetThreads( int );
+	bool	Trace( BvhRay & );
+};
+
+#endif		// #ifndef BVH_H
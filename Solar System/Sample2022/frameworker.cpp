@@ -0,0 +1,194 @@
+#ifndef FRAMEWORKER_CPP
+#define FRAMEWORKER_CPP
+
+#include "frameworker.h"
+
+#include <chrono>
+
+
+// an idle worker yields this many times before it starts sleeping between looks:
+// (so a frame that comes right away is picked up right away, but a frozen or hidden window
+// does not keep a processor busy)
+
+const int FRAME_SPINS = 200;
+const int FRAME_SLEEP_US = 200;
+
+
+static double
+_FrameNowMs( )
+{
+	return std::chrono::duration<double, std::milli>( std::chrono::steady_clock::now( ).time_since_epoch( ) ).count( );
+}
+
+
+FrameWorker::FrameWorker( ) : Requested( 0 ), Prepared( 0 ), Quit( false ), PrepareUs( 0 )
+{
+	Capture = Prepare = NULL;
+	Ready = -1;
+	Frames = Waits = 0;
+	WaitMs = SubmitMs = LastNextMs = 0.;
+}
+
+
+FrameWorker::~FrameWorker( )
+{
+	Stop( );
+}
+
+
+// wait for the worker, and forget the packet it has ready:
+// (for when the gl thread changed the scene, so that packet is out of date -- the next Next( ) gets
+// a new one ready first, and waits for it)
+
+void
+FrameWorker::Discard( )
+{
+	Wait( );
+	Ready = -1;
+}
+
+
+// hand the worker the next frame, and return the packet of the frame before it, to draw:
+
+int
+FrameWorker::Next( )
+{
+	double now = _FrameNowMs( );
+	if( Frames > 0 )
+		SubmitMs += now - LastNextMs;
+	Frames++;
+
+	// without a worker, it is all done right here:
+
+	if( Capture == NULL )
+	{
+		fprintf( stderr, "FrameWorker::Next: Start( ) was never called\n" );
+		return 0;
+	}
+	if( ! Worker.joinable( ) )
+	{
+		Capture( 0 );
+		double start = _FrameNowMs( );
+		Prepare( 0 );
+		LastNextMs = _FrameNowMs( );
+		PrepareUs.fetch_add( (long long)( 1000. * ( LastNextMs - start ) ), std::memory_order_relaxed );
+		return 0;
+	}
+
+	// if there is nothing on its way (the first frame, or after a Discard( )), start one and wait for it:
+
+	if( Ready < 0 )
+	{
+		int first = Requested.load( std::memory_order_relaxed );
+		Capture( first % FRAME_PACKETS );
+		Requested.store( first + 1, std::memory_order_release );
+	}
+
+	int requested = Requested.load( std::memory_order_relaxed );
+	WaitFor( requested );
+	Ready = ( requested - 1 ) % FRAME_PACKETS;
+
+	// the other packet was drawn last frame, so it is free to capture into:
+
+	Capture( requested % FRAME_PACKETS );
+	Requested.store( requested + 1, std::memory_order_release );
+
+	LastNextMs = _FrameNowMs( );
+	return Ready;
+}
+
+
+void
+FrameWorker::PrintStats( FILE *fp )
+{
+	int n = Frames > 1  ?  Frames - 1  :  1;
+	fprintf( fp, "FrameWorker: %d frames, %s ; %.3f ms preparing and %.3f ms drawing a frame ; waited for the worker %d times (%.3f ms)\n",
+		Frames, Worker.joinable( )  ?  "with a worker"  :  "all on the gl thread", (double)PrepareUs.load( std::memory_order_relaxed ) / 1000. / (double)n, SubmitMs / (double)n, Waits, WaitMs );
+}
+
+
+// the worker -- prepare each frame it is handed, in order, until Stop( ):
+
+void
+FrameWorker::Run( )
+{
+	int done = Prepared.load( std::memory_order_relaxed );
+	int idle = 0;
+	while( true )
+	{
+		if( Requested.load( std::memory_order_acquire ) != done )
+		{
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now( );
+			Prepare( done % FRAME_PACKETS );
+			long long us = std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::steady_clock::now( ) - start ).count( );
+			PrepareUs.fetch_add( us, std::memory_order_relaxed );
+			done++;
+			Prepared.store( done, std::memory_order_release );
+			idle = 0;
+		}
+		else if( Quit.load( std::memory_order_acquire ) )
+			break;
+		else if( ++idle < FRAME_SPINS )
+			std::this_thread::yield( );
+		else
+			std::this_thread::sleep_for( std::chrono::microseconds( FRAME_SLEEP_US ) );
+	}
+}
+
+
+// capture( packet ) copies what prepare( packet ) needs, on the gl thread -- prepare( packet ) runs on the worker:
+// (or, if worker is false, right after it, in Next( ) -- on one processor, the worker would only add
+// a frame of lag)
+
+void
+FrameWorker::Start( void (*capture)( int ), void (*prepare)( int ), bool worker )
+{
+	Stop( );
+	Capture = capture;
+	Prepare = prepare;
+	Requested.store( 0 );
+	Prepared.store( 0 );
+	Quit.store( false );
+	Ready = -1;
+	if( worker )
+		Worker = std::thread( &FrameWorker::Run, this );
+}
+
+
+// let the worker finish what it was handed, and end it:
+// (Next( ) then does everything on the gl thread)
+
+void
+FrameWorker::Stop( )
+{
+	if( ! Worker.joinable( ) )
+		return;
+	Quit.store( true, std::memory_order_release );
+	Worker.join( );
+	Ready = -1;
+}
+
+
+// until the worker has finished every frame it has been handed:
+
+void
+FrameWorker::Wait( )
+{
+	WaitFor( Requested.load( std::memory_order_relaxed ) );
+}
+
+
+void
+FrameWorker::WaitFor( int frame )
+{
+	if( Prepared.load( std::memory_order_acquire ) >= frame )
+		return;
+
+	double start = _FrameNowMs( );
+	Waits++;
+	while( Prepared.load( std::memory_order_acquire ) < frame )
+		std::this_thread::yield( );
+	WaitMs += _FrameNowMs( ) - start;
+}
+
+#endif		// #ifndef FRAMEWORKER_CPP
@@ -0,0 +1,74 @@
+#ifndef FRAMEWORKER_H
+#define FRAMEWORKER_H
+
+#include <stdio.h>
+#include <atomic>
+#include <thread>
+
+
+// a worker thread that gets the next frame ready while the gl thread draws this one:
+//
+//	everything a frame needs that is not a gl call -- moving the scene, culling it, sorting what is
+//	left into draw lists -- goes into a frame packet, and there are FRAME_PACKETS of them: the gl
+//	thread draws from one while the worker fills the other, and they trade every frame
+//	so a frame takes as long as the longer of the two, instead of both of them one after the other
+//
+//	the packets themselves belong to the program -- the worker only says which one is which:
+//		capture( packet ) runs on the gl thread, and copies whatever the worker will need -- the time,
+//		the viewing matrices, the menu settings -- into the packet, so the worker never reads
+//		anything the gl thread (or a glut callback) might be changing
+//		prepare( packet ) runs on the worker, and fills in the rest of it
+//	Next( ) waits for the packet being prepared (on a second processor, it is usually done already),
+//	captures and starts the other one, and returns the ready one to draw -- so what is drawn is
+//	always what was captured the frame before
+//
+//	the hand-off is two atomic counters, one that only the gl thread writes and one that only the
+//	worker does -- there are no locks, and nothing is allocated once the packets have grown to size
+//	while a packet is being prepared, the worker owns whatever prepare( ) touches (the scene graph,
+//	say) -- the gl thread must Wait( ) before it reads or changes any of that itself, and Discard( )
+//	if what it did makes the packet that is ready wrong
+//
+//	use:
+//		FramePacket Packets[FRAME_PACKETS];
+//		FrameWorker Frames;
+//		Frames.Start( Capture, Prepare );		// once
+//		...
+//		int packet = Frames.Next( );			// in Display( )
+//		...draw Packets[packet]...
+
+const int FRAME_PACKETS = 2;
+
+class FrameWorker
+{
+  private:
+	void			(*Capture)( int );
+	void			(*Prepare)( int );
+	std::thread		Worker;
+	std::atomic<int>	Requested;		// frames handed to the worker -- only the gl thread writes it
+	std::atomic<int>	Prepared;		// frames it has finished -- only the worker writes it
+	std::atomic<bool>	Quit;
+	int			Ready;			// the packet Next( ) returned, or -1
+
+	int			Frames;
+	int			Waits;			// Next( )s that had to wait for the worker
+	double			WaitMs;
+	std::atomic<long long>	PrepareUs;		// on the worker, altogether
+	double			SubmitMs;		// on the gl thread, between Next( )s
+	double			LastNextMs;
+
+	void	Run( );
+	void	WaitFor( int );
+
+  public:
+		FrameWorker( );
+		~FrameWorker( );
+
+	void	Discard( );
+	int	Next( );
+	void	PrintStats( FILE * );
+	void	Start( void (*)( int ), void (*)( int ), bool = true );
+	void	Stop( );
+	void	Wait( );
+};
+
+#endif		// #ifndef FRAMEWORKER_H
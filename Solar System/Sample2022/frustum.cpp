@@ -0,0 +1,251 @@
+#ifndef FRUSTUM_CPP
+#define FRUSTUM_CPP
+
+#include <stdio.h>
+#include <math.h>
+
+#include <GL/gl.h>
+
+#if defined(__SSE2__)  ||  defined(_M_X64)  ||  ( defined(_M_IX86_FP)  &&  _M_IX86_FP >= 2 )
+#define FRUSTUM_SSE
+#include <emmintrin.h>
+#endif
+
+
+// the 6 planes of a viewing frustum, pulled out of a projection*modelview matrix
+//
+//	each plane is  a*x + b*y + c*z + d >= 0.  for points that are inside,
+//	in the coordinate system the modelview matrix was taken in
+//	(so FromCurrentMatrices( ) right before drawing an object gives planes in that
+//	object's own coordinates)
+//
+//	SpheresVisible( ) tests a whole array of spheres (x's, y's, z's, and radii in separate
+//	arrays), 4 at a time with SSE2 when the compiler has it
+//	ClassifySphere( ) also says when a sphere is all the way inside, which is what a
+//	hierarchy of spheres needs to know to stop testing (see spheretree.h)
+//	the sphere tests count how many they did and how many were culled, until ResetCounters( )
+
+const int FRUSTUM_OUTSIDE    = 0;
+const int FRUSTUM_INTERSECTS = 1;
+const int FRUSTUM_INSIDE     = 2;
+
+struct Frustum
+{
+	float		Planes[6][4];		// left, right, bottom, top, near, far
+	mutable int	Tested, Culled;		// spheres, since ResetCounters( )
+
+		Frustum( );
+
+	void	FromMatrix( const float [16] );
+	void	FromMatrices( const float [16], const float [16] );
+	void	FromCurrentMatrices( );
+	bool	BoxVisible( const float [3], const float [3] ) const;
+	int	ClassifySphere( const float [3], float ) const;
+	void	PrintStats( FILE *, const char * ) const;
+	void	ResetCounters( );
+	bool	SphereVisible( const float [3], float ) const;
+	int	SpheresVisible( int, const float *, const float *, const float *, const float *, unsigned char * ) const;
+};
+
+
+Frustum::Frustum( )
+{
+	for( int p = 0; p < 6; p++ )
+	{
+		Planes[p][0] = Planes[p][1] = Planes[p][2] = 0.;
+		Planes[p][3] = 1.;			// everything is inside until there are real planes
+	}
+	Tested = Culled = 0;
+}
+
+
+// m is column-major, as glGetFloatv( ) returns it:
+
+void
+Frustum::FromMatrix( const float m[16] )
+{
+	for( int i = 0; i < 3; i++ )
+	{
+		for( int k = 0; k < 4; k++ )
+		{
+			Planes[2*i+0][k] = m[4*k+3] + m[4*k+i];
+			Planes[2*i+1][k] = m[4*k+3] - m[4*k+i];
+		}
+	}
+
+	for( int p = 0; p < 6; p++ )
+	{
+		float len = sqrtf( Planes[p][0]*Planes[p][0] + Planes[p][1]*Planes[p][1] + Planes[p][2]*Planes[p][2] );
+		if( len > 0. )
+		{
+			for( int k = 0; k < 4; k++ )
+				Planes[p][k] /= len;
+		}
+	}
+}
+
+
+// projection * modelview, from gl:
+// (in the core pipeline, gl does not have the matrices -- get them from Pipeline.GetFloatv( )
+// and use FromMatrices( ) instead)
+
+void
+Frustum::FromCurrentMatrices( )
+{
+	float p[16], mv[16];
+	glGetFloatv( GL_PROJECTION_MATRIX, p );
+	glGetFloatv( GL_MODELVIEW_MATRIX, mv );
+	FromMatrices( p, mv );
+}
+
+
+// projection * modelview, both column-major:
+
+void
+Frustum::FromMatrices( const float p[16], const float mv[16] )
+{
+	float m[16];
+	for( int col = 0; col < 4; col++ )
+	{
+		for( int row = 0; row < 4; row++ )
+		{
+			m[4*col+row] =	p[4*0+row] * mv[4*col+0] + p[4*1+row] * mv[4*col+1] +
+					p[4*2+row] * mv[4*col+2] + p[4*3+row] * mv[4*col+3];
+		}
+	}
+	FromMatrix( m );
+}
+
+
+// an axis-aligned box is outside if its most-inside corner is outside any one plane:
+
+bool
+Frustum::BoxVisible( const float bmin[3], const float bmax[3] ) const
+{
+	for( int p = 0; p < 6; p++ )
+	{
+		const float *pl = Planes[p];
+		float x = pl[0] >= 0. ? bmax[0] : bmin[0];
+		float y = pl[1] >= 0. ? bmax[1] : bmin[1];
+		float z = pl[2] >= 0. ? bmax[2] : bmin[2];
+		if( pl[0]*x + pl[1]*y + pl[2]*z + pl[3] < 0. )
+			return false;
+	}
+	return true;
+}
+
+
+// outside if it is all the way outside any one plane, inside if it is all the way inside all of them:
+
+int
+Frustum::ClassifySphere( const float center[3], float radius ) const
+{
+	Tested++;
+	int result = FRUSTUM_INSIDE;
+	for( int p = 0; p < 6; p++ )
+	{
+		const float *pl = Planes[p];
+		float d = pl[0]*center[0] + pl[1]*center[1] + pl[2]*center[2] + pl[3];
+		if( d < -radius )
+		{
+			Culled++;
+			return FRUSTUM_OUTSIDE;
+		}
+		if( d < radius )
+			result = FRUSTUM_INTERSECTS;
+	}
+	return result;
+}
+
+
+void
+Frustum::PrintStats( FILE *fp, const char *what ) const
+{
+	fprintf( fp, "Frustum (%s): %d spheres tested, %d culled, %d visible\n", what, Tested, Culled, Tested - Culled );
+}
+
+
+void
+Frustum::ResetCounters( )
+{
+	Tested = Culled = 0;
+}
+
+
+bool
+Frustum::SphereVisible( const float center[3], float radius ) const
+{
+	Tested++;
+	for( int p = 0; p < 6; p++ )
+	{
+		const float *pl = Planes[p];
+		if( pl[0]*center[0] + pl[1]*center[1] + pl[2]*center[2] + pl[3] < -radius )
+		{
+			Culled++;
+			return false;
+		}
+	}
+	return true;
+}
+
+
+// n spheres at once -- visible[i] is set to 1 or 0, and the number that are visible is returned:
+
+int
+Frustum::SpheresVisible( int n, const float *x, const float *y, const float *z, const float *r, unsigned char *visible ) const
+{
+	int count = 0;
+	int i = 0;
+
+#ifdef FRUSTUM_SSE
+	__m128 a[6], b[6], c[6], d[6];
+	for( int p = 0; p < 6; p++ )
+	{
+		a[p] = _mm_set1_ps( Planes[p][0] );
+		b[p] = _mm_set1_ps( Planes[p][1] );
+		c[p] = _mm_set1_ps( Planes[p][2] );
+		d[p] = _mm_set1_ps( Planes[p][3] );
+	}
+	for( ; i + 4 <= n; i += 4 )
+	{
+		__m128 sx = _mm_loadu_ps( &x[i] );
+		__m128 sy = _mm_loadu_ps( &y[i] );
+		__m128 sz = _mm_loadu_ps( &z[i] );
+		__m128 minusR = _mm_sub_ps( _mm_setzero_ps( ), _mm_loadu_ps( &r[i] ) );
+		__m128 out = _mm_setzero_ps( );
+		for( int p = 0; p < 6; p++ )
+		{
+			__m128 dist = _mm_add_ps( _mm_add_ps( _mm_mul_ps( a[p], sx ), _mm_mul_ps( b[p], sy ) ),
+						  _mm_add_ps( _mm_mul_ps( c[p], sz ), d[p] ) );
+			out = _mm_or_ps( out, _mm_cmplt_ps( dist, minusR ) );
+		}
+		int mask = _mm_movemask_ps( out );
+		for( int k = 0; k < 4; k++ )
+		{
+			visible[i+k] = ( mask & ( 1 << k ) ) ? 0 : 1;
+			count += visible[i+k];
+		}
+	}
+#endif
+
+	for( ; i < n; i++ )
+	{
+		visible[i] = 1;
+		for( int p = 0; p < 6; p++ )
+		{
+			const float *pl = Planes[p];
+			if( pl[0]*x[i] + pl[1]*y[i] + pl[2]*z[i] + pl[3] < -r[i] )
+			{
+				visible[i] = 0;
+				break;
+			}
+		}
+		count += visible[i];
+	}
+
+	Tested += n;
+	Culled += n - count;
+	return count;
+}
+
+#endif		// #ifndef FRUSTUM_CPP
@@ -0,0 +1,454 @@
+#ifndef GEOMETRYPOOL_CPP
+#define GEOMETRYPOOL_CPP
+
+#include "geometrypool.h"
+
+#include <math.h>
+#include <stddef.h>
+#include <chrono>
+
+#include "glm/gtc/type_ptr.hpp"
+
+
+GeometryPool::GeometryPool( )
+{
+	MeshesChanged = false;
+	VertexArray = VertexBuffer = IndexBuffer = 0;
+	TexturesChanged = false;
+	LayerTexture = 0;
+	LayerWidth = LayerHeight = 0;
+	DrawTexture = 0;
+	DrawIndexBuffer = 0;
+	NumDrawIndices = 0;
+	NumCalls = 0;
+	Indirect = false;
+	SubmitUs = 0.;
+}
+
+
+int
+GeometryPool::AddMesh( const struct SurfaceMesh &surface )
+{
+	PoolMesh mesh;
+	mesh.FirstIndex = (GLuint)Indices.size( );
+	mesh.NumIndices = (GLuint)surface.Indices.size( );
+	mesh.BaseVertex = (GLint)Vertices.size( );
+	surface.BoundingSphere( mesh.Center, &mesh.Radius );
+
+	for( int i = 0; i < (int)surface.Vertices.size( ); i++ )
+	{
+		const struct SurfaceVertex &sv = surface.Vertices[i];
+		PoolVertex v = { sv.x, sv.y, sv.z,  sv.nx, sv.ny, sv.nz,  sv.s, sv.t };
+		Vertices.push_back( v );
+	}
+	Indices.insert( Indices.end( ), surface.Indices.begin( ), surface.Indices.end( ) );
+	Meshes.push_back( mesh );
+	MeshesChanged = true;
+	return (int)Meshes.size( ) - 1;
+}
+
+
+// a mesh made ahead of time by meshheader (its colors are not used):
+
+int
+GeometryPool::AddMesh( const MeshVertex *vertices, int numVertices, const GLuint *indices, int numIndices )
+{
+	PoolMesh mesh;
+	mesh.FirstIndex = (GLuint)Indices.size( );
+	mesh.NumIndices = (GLuint)numIndices;
+	mesh.BaseVertex = (GLint)Vertices.size( );
+
+	// the sphere around the box around the vertices:
+
+	float bmin[3] = { 0., 0., 0. }, bmax[3] = { 0., 0., 0. };
+	for( int i = 0; i < numVertices; i++ )
+	{
+		const MeshVertex &mv = vertices[i];
+		PoolVertex v = { mv.x, mv.y, mv.z,  mv.nx, mv.ny, mv.nz,  mv.s, mv.t };
+		Vertices.push_back( v );
+		const float p[3] = { mv.x, mv.y, mv.z };
+		for( int k = 0; k < 3; k++ )
+		{
+			if( i == 0  ||  p[k] < bmin[k] )	bmin[k] = p[k];
+			if( i == 0  ||  p[k] > bmax[k] )	bmax[k] = p[k];
+		}
+	}
+	for( int k = 0; k < 3; k++ )
+		mesh.Center[k] = 0.5f * ( bmin[k] + bmax[k] );
+	mesh.Radius = 0.;
+	for( int i = 0; i < numVertices; i++ )
+	{
+		float dx = vertices[i].x - mesh.Center[0];
+		float dy = vertices[i].y - mesh.Center[1];
+		float dz = vertices[i].z - mesh.Center[2];
+		float d = sqrtf( dx*dx + dy*dy + dz*dz );
+		if( d > mesh.Radius )
+			mesh.Radius = d;
+	}
+
+	Indices.insert( Indices.end( ), indices, indices + numIndices );
+	Meshes.push_back( mesh );
+	MeshesChanged = true;
+	return (int)Meshes.size( ) - 1;
+}
+
+
+// a texture object that objects can be drawn with -- returns its layer:
+// (adding the same one again gives back the same layer)
+
+int
+GeometryPool::AddTexture( GLuint texture )
+{
+	if( texture == 0 )
+		return POOL_NO_TEXTURE;
+	std::map<GLuint,int>::iterator it = Layers.find( texture );
+	if( it != Layers.end( ) )
+		return it->second;
+
+	int layer = (int)Textures.size( );
+	Textures.push_back( texture );
+	Layers[texture] = layer;
+	TexturesChanged = true;
+	return layer;
+}
+
+
+// start a new frame's worth of objects:
+
+void
+GeometryPool::Begin( )
+{
+	Objects.clear( );
+}
+
+
+// one object -- a mesh that AddMesh( ) returned, where it is in the world, and a layer that
+// AddTexture( ) returned:
+
+void
+GeometryPool::Submit( int mesh, const glm::mat4 &world, int layer )
+{
+	if( mesh < 0  ||  mesh >= (int)Meshes.size( ) )
+	{
+		fprintf( stderr, "GeometryPool::Submit: there is no mesh %d\n", mesh );
+		return;
+	}
+	PoolObject object;
+	object.Mesh = mesh;
+	object.Layer = layer;
+	object.World = world;
+	Objects.push_back( object );
+}
+
+
+// which objects' bounding spheres are in the frustum of the pipeline's matrices:
+// (the spheres are moved into the world by each object's matrix, and grown by its biggest scale)
+
+void
+GeometryPool::Cull( )
+{
+	int n = (int)Objects.size( );
+	CullX.resize( n );
+	CullY.resize( n );
+	CullZ.resize( n );
+	CullR.resize( n );
+	CullVisible.resize( n );
+	for( int i = 0; i < n; i++ )
+	{
+		const PoolObject &object = Objects[i];
+		const PoolMesh &mesh = Meshes[object.Mesh];
+		const glm::mat4 &m = object.World;
+		glm::vec4 c = m * glm::vec4( mesh.Center[0], mesh.Center[1], mesh.Center[2], 1. );
+		float scale = glm::max( glm::length( glm::vec3( m[0] ) ), glm::max( glm::length( glm::vec3( m[1] ) ), glm::length( glm::vec3( m[2] ) ) ) );
+		CullX[i] = c.x;
+		CullY[i] = c.y;
+		CullZ[i] = c.z;
+		CullR[i] = mesh.Radius * scale;
+	}
+
+	float projection[16], modelview[16];
+	Pipeline.GetFloatv( GL_PROJECTION_MATRIX, projection );
+	Pipeline.GetFloatv( GL_MODELVIEW_MATRIX, modelview );
+	Frustum view;
+	view.FromMatrices( projection, modelview );
+
+	Visible.clear( );
+	if( n > 0 )
+		view.SpheresVisible( n, &CullX[0], &CullY[0], &CullZ[0], &CullR[0], &CullVisible[0] );
+	for( int i = 0; i < n; i++ )
+	{
+		if( CullVisible[i] )
+			Visible.push_back( i );
+	}
+}
+
+
+void
+GeometryPool::Draw( )
+{
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now( );
+	NumCalls = 0;
+	Indirect = false;
+
+	if( MeshesChanged )
+		UploadMeshes( );
+	if( TexturesChanged )
+		UploadTextures( );
+	Cull( );
+	int n = (int)Visible.size( );
+	if( n == 0 )
+		return;
+
+	if( ! Pipeline.IsCore( )  ||  glMultiDrawElementsIndirect == NULL  ||  glTexBufferRange == NULL )
+	{
+		DrawOneAtATime( );
+		SubmitUs = std::chrono::duration<double, std::micro>( std::chrono::steady_clock::now( ) - start ).count( );
+		return;
+	}
+
+	// this frame's commands and per-draw data go straight into the stream buffers:
+
+	GLsizeiptr commandBytes = n * sizeof(DrawElementsIndirectCommand);
+	GLsizeiptr dataBytes = n * 5 * sizeof(glm::vec4);
+	if( commandBytes > Commands.GetRegionSize( ) )
+		Commands.Init( GL_DRAW_INDIRECT_BUFFER, 2*commandBytes, 16, "GeometryPool commands" );
+	if( dataBytes > DrawData.GetRegionSize( ) )
+	{
+		GLint alignment = 16;
+		glGetIntegerv( GL_TEXTURE_BUFFER_OFFSET_ALIGNMENT, &alignment );
+		DrawData.Init( GL_TEXTURE_BUFFER, 2*dataBytes, alignment < 16  ?  16  :  alignment, "GeometryPool draws" );
+	}
+	Commands.BeginFrame( );
+	DrawData.BeginFrame( );
+	GLintptr commandOffset, dataOffset;
+	DrawElementsIndirectCommand *commands = (DrawElementsIndirectCommand *) Commands.Allocate( commandBytes, &commandOffset );
+	glm::vec4 *data = (glm::vec4 *) DrawData.Allocate( dataBytes, &dataOffset );
+	for( int i = 0; i < n; i++ )
+	{
+		const PoolObject &object = Objects[ Visible[i] ];
+		const PoolMesh &mesh = Meshes[object.Mesh];
+		DrawElementsIndirectCommand &c = commands[i];
+		c.Count = mesh.NumIndices;
+		c.InstanceCount = 1;
+		c.FirstIndex = mesh.FirstIndex;
+		c.BaseVertex = mesh.BaseVertex;
+		c.BaseInstance = (GLuint)i;			// for the baseInstance way -- gl_DrawIDARB does not need it
+		glm::vec4 *d = &data[5*i];
+		d[0] = object.World[0];
+		d[1] = object.World[1];
+		d[2] = object.World[2];
+		d[3] = object.World[3];
+		d[4] = glm::vec4( (float)object.Layer, 0., 0., 0. );
+	}
+	Commands.Flush( );
+	DrawData.Flush( );
+
+	// without gl_DrawIDARB, each draw finds its index in an instance attribute of 0, 1, 2, ...
+	// (only made bigger when there are more objects than ever before):
+
+	bool drawIds = Pipeline.CanDrawIds( );
+	if( ! drawIds  &&  n > NumDrawIndices )
+	{
+		NumDrawIndices = 2*n;
+		std::vector<GLint> indices( NumDrawIndices );
+		for( int i = 0; i < NumDrawIndices; i++ )
+			indices[i] = i;
+		if( DrawIndexBuffer == 0 )
+			glGenBuffers( 1, &DrawIndexBuffer );
+		glBindVertexArray( VertexArray );
+		glBindBuffer( GL_ARRAY_BUFFER, DrawIndexBuffer );
+		glBufferData( GL_ARRAY_BUFFER, NumDrawIndices*sizeof(GLint), &indices[0], GL_STATIC_DRAW );
+		glEnableVertexAttribArray( PIPELINE_DRAW_INDEX );
+		glVertexAttribIPointer( PIPELINE_DRAW_INDEX, 1, GL_INT, sizeof(GLint), (GLvoid *)0 );
+		glVertexAttribDivisor( PIPELINE_DRAW_INDEX, 1 );
+		glBindVertexArray( 0 );
+		glBindBuffer( GL_ARRAY_BUFFER, 0 );
+	}
+
+	if( DrawTexture == 0 )
+		glGenTextures( 1, &DrawTexture );
+	Pipeline.Begin( false, false, true );
+	glActiveTexture( GL_TEXTURE0 + PIPELINE_DRAWS_UNIT );
+	glBindTexture( GL_TEXTURE_BUFFER, DrawTexture );
+	glTexBufferRange( GL_TEXTURE_BUFFER, GL_RGBA32F, DrawData.GetBuffer( ), dataOffset, dataBytes );
+	glActiveTexture( GL_TEXTURE0 + PIPELINE_LAYERS_UNIT );
+	glBindTexture( GL_TEXTURE_2D_ARRAY, LayerTexture );
+	glActiveTexture( GL_TEXTURE0 );
+
+	glBindVertexArray( VertexArray );
+	glBindBuffer( GL_DRAW_INDIRECT_BUFFER, Commands.GetBuffer( ) );
+	glMultiDrawElementsIndirect( GL_TRIANGLES, GL_UNSIGNED_INT, (GLvoid *)commandOffset, n, 0 );
+	glBindBuffer( GL_DRAW_INDIRECT_BUFFER, 0 );
+	glBindVertexArray( 0 );
+
+	glActiveTexture( GL_TEXTURE0 + PIPELINE_DRAWS_UNIT );
+	glBindTexture( GL_TEXTURE_BUFFER, 0 );
+	glActiveTexture( GL_TEXTURE0 + PIPELINE_LAYERS_UNIT );
+	glBindTexture( GL_TEXTURE_2D_ARRAY, 0 );
+	glActiveTexture( GL_TEXTURE0 );
+	Pipeline.End( );
+	Commands.EndFrame( );
+	DrawData.EndFrame( );
+
+	NumCalls = 1;
+	Indirect = true;
+	SubmitUs = std::chrono::duration<double, std::micro>( std::chrono::steady_clock::now( ) - start ).count( );
+}
+
+
+// each visible object with its own draw, its own matrix, and its own texture bound:
+
+void
+GeometryPool::DrawOneAtATime( )
+{
+	for( int i = 0; i < (int)Visible.size( ); i++ )
+	{
+		const PoolObject &object = Objects[ Visible[i] ];
+		const PoolMesh &mesh = Meshes[object.Mesh];
+		Pipeline.PushMatrix( );
+		Pipeline.MultMatrix( object.World );
+		Pipeline.BindTexture( GL_TEXTURE_2D, object.Layer != POOL_NO_TEXTURE  ?  Textures[object.Layer]  :  0 );
+		bool core = Pipeline.Begin( );
+		glBindVertexArray( VertexArray );
+		glDrawElementsBaseVertex( GL_TRIANGLES, mesh.NumIndices, GL_UNSIGNED_INT,
+			(GLvoid *)( mesh.FirstIndex*sizeof(GLuint) ), mesh.BaseVertex );
+		glBindVertexArray( 0 );
+		if( core )
+			Pipeline.End( );
+		Pipeline.PopMatrix( );
+	}
+	NumCalls = (int)Visible.size( );
+}
+
+
+int
+GeometryPool::GetNumDrawn( )
+{
+	return (int)Visible.size( );
+}
+
+
+int
+GeometryPool::GetNumMeshes( )
+{
+	return (int)Meshes.size( );
+}
+
+
+int
+GeometryPool::GetNumObjects( )
+{
+	return (int)Objects.size( );
+}
+
+
+void
+GeometryPool::PrintStats( FILE *fp )
+{
+	const char *how = ! Indirect  ?  "one at a time"  :  ( Pipeline.CanDrawIds( )  ?  "indirect, gl_DrawIDARB"  :  "indirect, baseInstance" );
+	fprintf( fp, "GeometryPool: %d meshes (%d vertices, %d triangles), %d texture layers of %d x %d ; %d objects, %d culled, %d drawn with %d draw calls (%s) in %.1f us\n",
+		GetNumMeshes( ), (int)Vertices.size( ), (int)Indices.size( ) / 3, (int)Textures.size( ), LayerWidth, LayerHeight,
+		GetNumObjects( ), GetNumObjects( ) - GetNumDrawn( ), GetNumDrawn( ), NumCalls, how, SubmitUs );
+}
+
+
+// put every mesh into the buffers, and point a vertex array object at them:
+// (both the fixed-function arrays and the generic attributes, like a Mesh, see mesh.h)
+
+void
+GeometryPool::UploadMeshes( )
+{
+	if( VertexArray == 0 )
+	{
+		glGenVertexArrays( 1, &VertexArray );
+		glGenBuffers( 1, &VertexBuffer );
+		glGenBuffers( 1, &IndexBuffer );
+	}
+
+	GLsizei stride = sizeof(PoolVertex);
+	glBindVertexArray( VertexArray );
+	glBindBuffer( GL_ARRAY_BUFFER, VertexBuffer );
+	GLDEBUG_LABEL( GL_BUFFER, VertexBuffer, "GeometryPool vertices" );
+	glBufferData( GL_ARRAY_BUFFER, Vertices.size( )*sizeof(PoolVertex), Vertices.empty( )  ?  NULL  :  &Vertices[0], GL_STATIC_DRAW );
+	glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, IndexBuffer );
+	GLDEBUG_LABEL( GL_BUFFER, IndexBuffer, "GeometryPool indices" );
+	glBufferData( GL_ELEMENT_ARRAY_BUFFER, Indices.size( )*sizeof(GLuint), Indices.empty( )  ?  NULL  :  &Indices[0], GL_STATIC_DRAW );
+
+	glEnableClientState( GL_VERTEX_ARRAY );
+	glVertexPointer( 3, GL_FLOAT, stride, (GLvoid *)offsetof( PoolVertex, x ) );
+	glEnableVertexAttribArray( MESH_POSITION );
+	glVertexAttribPointer( MESH_POSITION, 3, GL_FLOAT, GL_FALSE, stride, (GLvoid *)offsetof( PoolVertex, x ) );
+
+	glEnableClientState( GL_NORMAL_ARRAY );
+	glNormalPointer( GL_FLOAT, stride, (GLvoid *)offsetof( PoolVertex, nx ) );
+	glEnableVertexAttribArray( MESH_NORMAL );
+	glVertexAttribPointer( MESH_NORMAL, 3, GL_FLOAT, GL_FALSE, stride, (GLvoid *)offsetof( PoolVertex, nx ) );
+
+	glClientActiveTexture( GL_TEXTURE0 );
+	glEnableClientState( GL_TEXTURE_COORD_ARRAY );
+	glTexCoordPointer( 2, GL_FLOAT, stride, (GLvoid *)offsetof( PoolVertex, s ) );
+	glEnableVertexAttribArray( MESH_TEXCOORD );
+	glVertexAttribPointer( MESH_TEXCOORD, 2, GL_FLOAT, GL_FALSE, stride, (GLvoid *)offsetof( PoolVertex, s ) );
+
+	glBindVertexArray( 0 );
+	glBindBuffer( GL_ARRAY_BUFFER, 0 );
+	glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, 0 );
+	MeshesChanged = false;
+}
+
+
+// copy every texture into its layer of the array, stretched to the size of the biggest one:
+// (the copies are done by the gpu, with glBlitFramebuffer( ))
+
+void
+GeometryPool::UploadTextures( )
+{
+	TexturesChanged = false;
+	int numLayers = (int)Textures.size( );
+	if( numLayers == 0 )
+		return;
+
+	LayerWidth = LayerHeight = 1;
+	std::vector<int> widths( numLayers ), heights( numLayers );
+	for( int i = 0; i < numLayers; i++ )
+	{
+		GLState.BindTexture( GL_TEXTURE_2D, Textures[i] );		// through GLState, which keeps track of unit 0
+		glGetTexLevelParameteriv( GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &widths[i] );
+		glGetTexLevelParameteriv( GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &heights[i] );
+		if( widths[i] > LayerWidth )	LayerWidth = widths[i];
+		if( heights[i] > LayerHeight )	LayerHeight = heights[i];
+	}
+	GLState.BindTexture( GL_TEXTURE_2D, 0 );
+
+	if( LayerTexture != 0 )
+		glDeleteTextures( 1, &LayerTexture );
+	glGenTextures( 1, &LayerTexture );
+	glBindTexture( GL_TEXTURE_2D_ARRAY, LayerTexture );
+	GLDEBUG_LABEL( GL_TEXTURE, LayerTexture, "GeometryPool layers" );
+	glTexParameteri( GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT );
+	glTexParameteri( GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_REPEAT );
+	glTexParameteri( GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
+	glTexParameteri( GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR );
+	glTexImage3D( GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, LayerWidth, LayerHeight, numLayers, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL );
+	glBindTexture( GL_TEXTURE_2D_ARRAY, 0 );
+
+	GLint drawFramebuffer, readFramebuffer;
+	glGetIntegerv( GL_DRAW_FRAMEBUFFER_BINDING, &drawFramebuffer );
+	glGetIntegerv( GL_READ_FRAMEBUFFER_BINDING, &readFramebuffer );
+	GLuint framebuffers[2];
+	glGenFramebuffers( 2, framebuffers );
+	glBindFramebuffer( GL_READ_FRAMEBUFFER, framebuffers[0] );
+	glBindFramebuffer( GL_DRAW_FRAMEBUFFER, framebuffers[1] );
+	for( int i = 0; i < numLayers; i++ )
+	{
+		glFramebufferTexture2D( GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, Textures[i], 0 );
+		glFramebufferTextureLayer( GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, LayerTexture, 0, i );
+		glBlitFramebuffer( 0, 0, widths[i], heights[i],  0, 0, LayerWidth, LayerHeight, GL_COLOR_BUFFER_BIT, GL_LINEAR );
+	}
+	glBindFramebuffer( GL_READ_FRAMEBUFFER, readFramebuffer );
+	glBindFramebuffer( GL_DRAW_FRAMEBUFFER, drawFramebuffer );
+	glDeleteFramebuffers( 2, framebuffers );
+	GLDEBUG_CHECK( "GeometryPool::UploadTextures" );
+}
+
+#endif		// #ifndef GEOMETRYPOOL_CPP
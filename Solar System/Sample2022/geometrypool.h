@@ -0,0 +1,141 @@
+#ifndef GEOMETRYPOOL_H
+#define GEOMETRYPOOL_H
+
+#include <stdio.h>
+#include <vector>
+#include <map>
+
+#include "glew.h"
+#include <GL/gl.h>
+
+#include "glm/glm.hpp"
+
+#include "frustum.cpp"
+#include "mesh.cpp"
+#include "osusurface.cpp"
+#include "pipeline.cpp"
+#include "streambuffer.cpp"
+
+
+// a geometry pool -- every mesh's vertices and indices in one big vertex buffer and one big
+// index buffer, so that a whole frame's worth of objects can be drawn with one glMultiDrawElementsIndirect( ):
+//
+//	AddMesh( ) appends a mesh's vertices and indices to the pool's and returns its number
+//	AddTexture( ) puts a texture into a layer of the pool's 2d texture array (every layer is the
+//	size of the biggest texture added) and returns the layer, so each object can have its own
+//	texture without a bind
+//	the buffers and the array are (re)made by the first Draw( ) after something was added,
+//	so everything should be added up front
+//
+//	every frame, each object is Submit( )ed with its world matrix and texture layer, and Draw( ):
+//		throws away the objects whose bounding spheres are outside the view frustum
+//		writes a DrawElementsIndirectCommand for each one left into a stream buffer (see
+//		streambuffer.h), and its world matrix and layer into another, which the shader reads
+//		as a buffer texture
+//		draws them all with one glMultiDrawElementsIndirect( ) and the pipeline's "POOLED" shader,
+//		which finds its object's data with gl_DrawIDARB -- or, without GL_ARB_shader_draw_parameters,
+//		with an instance attribute that each command's baseInstance points at
+//	so the number of gl calls is the same however many objects there are
+//
+//	the objects are drawn with the pipeline's modelview matrix (the viewing transformation)
+//	times their world matrices, and with its lights, material, and current color --
+//	pool meshes have no colors of their own
+//	in the fixed-function pipeline, or without glMultiDrawElementsIndirect( ) (before gl 4.3),
+//	Draw( ) draws them one at a time instead
+//
+//	use:
+//		GeometryPool Pool;
+//		int sphere = Pool.AddMesh( surface );			// once for each mesh
+//		int earth = Pool.AddTexture( EarthTex );		// once for each texture
+//		...
+//		Pool.Begin( );
+//		Pool.Submit( sphere, world, earth );			// for each object
+//		Pool.Draw( );
+
+const int POOL_NO_TEXTURE = -1;
+
+// what glMultiDrawElementsIndirect( ) reads for each draw:
+
+struct DrawElementsIndirectCommand
+{
+	GLuint		Count;
+	GLuint		InstanceCount;
+	GLuint		FirstIndex;
+	GLint		BaseVertex;
+	GLuint		BaseInstance;
+};
+
+struct PoolVertex
+{
+	float		x, y, z;
+	float		nx, ny, nz;
+	float		s, t;
+};
+
+class GeometryPool
+{
+  private:
+	struct PoolMesh
+	{
+		GLuint		FirstIndex, NumIndices;
+		GLint		BaseVertex;
+		float		Center[3], Radius;	// the bounding sphere
+	};
+
+	struct PoolObject
+	{
+		int		Mesh;
+		int		Layer;
+		glm::mat4	World;
+	};
+
+	std::vector<PoolVertex>	Vertices;
+	std::vector<GLuint>	Indices;		// each mesh's start at 0, BaseVertex says where it really is
+	std::vector<PoolMesh>	Meshes;
+	bool			MeshesChanged;		// since the buffers were made
+	GLuint			VertexArray;
+	GLuint			VertexBuffer;
+	GLuint			IndexBuffer;
+
+	std::vector<GLuint>	Textures;		// the texture in each layer
+	std::map<GLuint,int>	Layers;			// ... and the other way
+	bool			TexturesChanged;	// since the array was made
+	GLuint			LayerTexture;		// GL_TEXTURE_2D_ARRAY
+	int			LayerWidth, LayerHeight;
+
+	std::vector<PoolObject>		Objects;	// submitted this frame
+	std::vector<int>		Visible;	// the ones that survived culling
+	std::vector<float>		CullX, CullY, CullZ, CullR;
+	std::vector<unsigned char>	CullVisible;
+
+	StreamBuffer		Commands;		// a DrawElementsIndirectCommand per visible object
+	StreamBuffer		DrawData;		// 5 vec4s per visible object, see pipeline.vert
+	GLuint			DrawTexture;		// the buffer texture that reads DrawData
+	GLuint			DrawIndexBuffer;	// 0, 1, 2, ..., for the baseInstance way
+	int			NumDrawIndices;
+
+	int			NumCalls;		// gl draw calls, in the last Draw( )
+	bool			Indirect;		// did it use glMultiDrawElementsIndirect( )?
+	double			SubmitUs;		// how long Draw( ) took on the cpu
+
+	void	Cull( );
+	void	DrawOneAtATime( );
+	void	UploadMeshes( );
+	void	UploadTextures( );
+
+  public:
+		GeometryPool( );
+
+	int	AddMesh( const struct SurfaceMesh & );
+	int	AddMesh( const MeshVertex *, int, const GLuint *, int );
+	int	AddTexture( GLuint );
+	void	Begin( );
+	void	Draw( );
+	int	GetNumDrawn( );
+	int	GetNumMeshes( );
+	int	GetNumObjects( );
+	void	PrintStats( FILE * );
+	void	Submit( int, const glm::mat4 &, int = POOL_NO_TEXTURE );
+};
+
+#endif		// #ifndef GEOMETRYPOOL_H
@@ -28,7 +28,7 @@
 
 #pragma once
 
-#include "glm/glm.hpp"
+#include "../glm.hpp"
 
 #if(!(GLM_ARCH & GLM_ARCH_SSE2))
 #	error "SSE2 instructions not supported or enabled"
@@ -0,0 +1,496 @@
+#ifndef GLSTATE_CPP
+#define GLSTATE_CPP
+
+#include "glstate.h"
+
+#include <math.h>
+#include <string.h>
+
+
+GLStateCache	GLState;
+
+
+// how many floats a glLight( ) or glMaterial( ) parameter has:
+
+static int
+GLStateCount( GLenum pname )
+{
+	switch( pname )
+	{
+		case GL_POSITION:
+		case GL_AMBIENT:
+		case GL_DIFFUSE:
+		case GL_SPECULAR:
+		case GL_EMISSION:
+		case GL_AMBIENT_AND_DIFFUSE:
+			return 4;
+
+		case GL_SPOT_DIRECTION:
+			return 3;
+
+		default:
+			return 1;
+	}
+}
+
+
+GLStateCache::GLStateCache( )
+{
+	Verify = false;
+	ListMode = 0;
+	Invalidate( );
+	ResetCounters( );
+}
+
+
+// forget everything -- the next call of each kind will be made:
+
+void
+GLStateCache::Invalidate( )
+{
+	Enables.clear( );
+	Textures.clear( );
+	EnvMode = -1;
+	Lights.clear( );
+	Materials.clear( );
+}
+
+
+// make a display list -- until EndList( ), every call goes into the list, and the shadow is left alone:
+
+void
+GLStateCache::BeginList( GLuint list, GLenum mode )
+{
+	glNewList( list, mode );
+	ListMode = mode;
+}
+
+
+// a list that was also executed changed gl's state without the shadow knowing how:
+
+void
+GLStateCache::EndList( )
+{
+	glEndList( );
+	if( ListMode == GL_COMPILE_AND_EXECUTE )
+		Invalidate( );
+	ListMode = 0;
+}
+
+
+// is a display list being made, so calls must be passed straight through?
+
+bool
+GLStateCache::IsRecording( )
+{
+	if( ListMode != 0 )
+		return true;
+	if( ! Verify )
+		return false;
+
+	GLint list = 0;
+	glGetIntegerv( GL_LIST_INDEX, &list );
+	if( list == 0 )
+		return false;
+	fprintf( stderr, "GLState: display list %d was started with glNewList( ) -- use GLState.BeginList( ) instead\n", list );
+	Mismatches++;
+	return true;
+}
+
+
+void
+GLStateCache::ResetCounters( )
+{
+	Issued = Elided = Mismatches = 0;
+}
+
+
+void
+GLStateCache::SetVerify( bool verify )
+{
+	Verify = verify;
+}
+
+
+bool
+GLStateCache::Same( const Value &shadow, const float *v, int n )
+{
+	for( int i = 0; i < n; i++ )
+	{
+		if( shadow.v[i] != v[i] )
+			return false;
+	}
+	return true;
+}
+
+
+bool
+GLStateCache::SameMatrix( const Value &shadow, const float *m )
+{
+	return memcmp( shadow.m, m, 16*sizeof(float) ) == 0;
+}
+
+
+// what the driver hands back has been through its own arithmetic, so only compare it loosely:
+
+bool
+GLStateCache::Close( const float *a, const float *b, int n )
+{
+	for( int i = 0; i < n; i++ )
+	{
+		if( fabsf( a[i] - b[i] ) > 1.e-4f * ( 1.f + fabsf( a[i] ) ) )
+			return false;
+	}
+	return true;
+}
+
+
+void
+GLStateCache::Mismatch( const char *what, GLenum a, GLenum b )
+{
+	Mismatches++;
+	fprintf( stderr, "GLState: the %s shadow for 0x%04x 0x%04x was wrong -- something changed it without going through GLState\n",
+		what, a, b );
+}
+
+
+// gl keeps light positions and spot directions in eye coordinates:
+// (only SetVerify( ) needs them that way, to compare with what gl has)
+
+void
+GLStateCache::ToEye( GLenum pname, const float *v, const float *m, float *eye )
+{
+	if( pname == GL_POSITION )
+	{
+		for( int i = 0; i < 4; i++ )
+			eye[i] = m[i]*v[0] + m[4+i]*v[1] + m[8+i]*v[2] + m[12+i]*v[3];
+	}
+	else
+	{
+		for( int i = 0; i < 3; i++ )
+			eye[i] = m[i]*v[0] + m[4+i]*v[1] + m[8+i]*v[2];
+	}
+}
+
+
+bool
+GLStateCache::IsColorMaterialOn( )
+{
+	std::map<GLenum,bool>::iterator it = Enables.find( GL_COLOR_MATERIAL );
+	return it != Enables.end( )  &&  it->second;
+}
+
+
+void
+GLStateCache::Enable( GLenum cap )
+{
+	Set( cap, true );
+}
+
+
+void
+GLStateCache::Disable( GLenum cap )
+{
+	Set( cap, false );
+}
+
+
+void
+GLStateCache::Set( GLenum cap, bool on )
+{
+	if( IsRecording( ) )
+	{
+		if( on )
+			glEnable( cap );
+		else
+			glDisable( cap );
+		Issued++;
+		return;
+	}
+
+	std::map<GLenum,bool>::iterator it = Enables.find( cap );
+	if( it != Enables.end( )  &&  it->second == on )
+	{
+		if( ! Verify  ||  ( glIsEnabled( cap ) != GL_FALSE ) == on )
+		{
+			Elided++;
+			return;
+		}
+		Mismatch( "enable", cap, 0 );
+	}
+
+	if( on )
+		glEnable( cap );
+	else
+		glDisable( cap );
+	Enables[cap] = on;
+	Issued++;
+
+	// while color material is on, glColor( ) rewrites the material, so what was known about it is gone:
+
+	if( cap == GL_COLOR_MATERIAL )
+		Materials.clear( );
+}
+
+
+void
+GLStateCache::BindTexture( GLenum target, GLuint texture )
+{
+	if( IsRecording( ) )
+	{
+		glBindTexture( target, texture );
+		Issued++;
+		return;
+	}
+
+	std::map<GLenum,GLuint>::iterator it = Textures.find( target );
+	if( it != Textures.end( )  &&  it->second == texture )
+	{
+		GLenum binding = 0;
+		switch( target )
+		{
+			case GL_TEXTURE_1D:		binding = GL_TEXTURE_BINDING_1D;	break;
+			case GL_TEXTURE_2D:		binding = GL_TEXTURE_BINDING_2D;	break;
+			case GL_TEXTURE_3D:		binding = GL_TEXTURE_BINDING_3D;	break;
+			case GL_TEXTURE_CUBE_MAP:	binding = GL_TEXTURE_BINDING_CUBE_MAP;	break;
+		}
+
+		bool ok = true;
+		if( Verify  &&  binding != 0 )
+		{
+			GLint unit, bound;
+			glGetIntegerv( GL_ACTIVE_TEXTURE, &unit );
+			glGetIntegerv( binding, &bound );
+			if( unit != GL_TEXTURE0  ||  (GLuint)bound != texture )
+			{
+				Mismatch( "texture", target, texture );
+				ok = false;
+			}
+		}
+		if( ok )
+		{
+			Elided++;
+			return;
+		}
+	}
+
+	glBindTexture( target, texture );
+	Textures[target] = texture;
+	Issued++;
+}
+
+
+void
+GLStateCache::TexEnvMode( GLint mode )
+{
+	if( IsRecording( ) )
+	{
+		glTexEnvi( GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, mode );
+		Issued++;
+		return;
+	}
+
+	if( EnvMode == mode )
+	{
+		GLint now = mode;
+		if( Verify )
+			glGetTexEnviv( GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, &now );
+		if( now == mode )
+		{
+			Elided++;
+			return;
+		}
+		Mismatch( "texture environment", GL_TEXTURE_ENV_MODE, mode );
+	}
+
+	glTexEnvi( GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, mode );
+	EnvMode = mode;
+	Issued++;
+}
+
+
+void
+GLStateCache::Light( GLenum light, GLenum pname, float f )
+{
+	Light( light, pname, &f );
+}
+
+
+// modelview is the matrix that positions and spot directions are given under (16 floats, as
+// glGetFloatv( GL_MODELVIEW_MATRIX ) would give it) -- if it is NULL, they are always sent:
+
+void
+GLStateCache::Light( GLenum light, GLenum pname, const float *v, const float *modelview )
+{
+	if( IsRecording( ) )
+	{
+		glLightfv( light, pname, v );
+		Issued++;
+		return;
+	}
+
+	int n = GLStateCount( pname );
+	bool positional = ( pname == GL_POSITION  ||  pname == GL_SPOT_DIRECTION );
+
+	std::pair<GLenum,GLenum> key( light, pname );
+	std::map<std::pair<GLenum,GLenum>,Value>::iterator it = Lights.find( key );
+	if( it != Lights.end( )  &&  Same( it->second, v, n )  &&  ( ! positional  ||  ( modelview != NULL  &&  SameMatrix( it->second, modelview ) ) ) )
+	{
+		float now[4], expected[4];
+		if( Verify )
+		{
+			glGetLightfv( light, pname, now );
+			if( positional )
+				ToEye( pname, v, modelview, expected );
+			else
+				memcpy( expected, v, n*sizeof(float) );
+		}
+		if( ! Verify  ||  Close( expected, now, n ) )
+		{
+			Elided++;
+			return;
+		}
+		Mismatch( "light", light, pname );
+	}
+
+	glLightfv( light, pname, v );
+	Issued++;
+	if( positional  &&  modelview == NULL )
+	{
+		Lights.erase( key );
+		return;
+	}
+	Value &shadow = Lights[key];
+	for( int i = 0; i < n; i++ )
+		shadow.v[i] = v[i];
+	if( positional )
+		memcpy( shadow.m, modelview, 16*sizeof(float) );
+}
+
+
+void
+GLStateCache::Material( GLenum face, GLenum pname, float f )
+{
+	Material( face, pname, &f );
+}
+
+
+// GL_FRONT_AND_BACK and GL_AMBIENT_AND_DIFFUSE are kept as the separate values they set,
+// but are still sent as one call:
+
+void
+GLStateCache::Material( GLenum face, GLenum pname, const float *v )
+{
+	if( IsRecording( ) )
+	{
+		glMaterialfv( face, pname, v );
+		Issued++;
+		return;
+	}
+
+	GLenum faces[2], pnames[2];
+	int nf = 0, np = 0;
+	if( face == GL_FRONT  ||  face == GL_FRONT_AND_BACK )
+		faces[nf++] = GL_FRONT;
+	if( face == GL_BACK  ||  face == GL_FRONT_AND_BACK )
+		faces[nf++] = GL_BACK;
+	if( pname == GL_AMBIENT_AND_DIFFUSE )
+	{
+		pnames[np++] = GL_AMBIENT;
+		pnames[np++] = GL_DIFFUSE;
+	}
+	else
+		pnames[np++] = pname;
+	int n = GLStateCount( pname );
+
+	bool colorMaterial = IsColorMaterialOn( );
+	if( ! colorMaterial )
+	{
+		bool same = true;
+		for( int f = 0; f < nf  &&  same; f++ )
+		{
+			for( int p = 0; p < np  &&  same; p++ )
+			{
+				std::map<std::pair<GLenum,GLenum>,Value>::iterator it =
+					Materials.find( std::pair<GLenum,GLenum>( faces[f], pnames[p] ) );
+				same = it != Materials.end( )  &&  Same( it->second, v, n );
+			}
+		}
+
+		if( same  &&  Verify )
+		{
+			for( int f = 0; f < nf  &&  same; f++ )
+			{
+				for( int p = 0; p < np  &&  same; p++ )
+				{
+					float now[4];
+					glGetMaterialfv( faces[f], pnames[p], now );
+					if( ! Close( v, now, n ) )
+					{
+						Mismatch( "material", faces[f], pnames[p] );
+						same = false;
+					}
+				}
+			}
+		}
+
+		if( same )
+		{
+			Elided++;
+			return;
+		}
+	}
+
+	glMaterialfv( face, pname, v );
+	Issued++;
+	for( int f = 0; f < nf; f++ )
+	{
+		for( int p = 0; p < np; p++ )
+		{
+			std::pair<GLenum,GLenum> key( faces[f], pnames[p] );
+			if( colorMaterial )
+				Materials.erase( key );
+			else
+			{
+				Value &shadow = Materials[key];
+				for( int i = 0; i < n; i++ )
+					shadow.v[i] = v[i];
+			}
+		}
+	}
+}
+
+
+int
+GLStateCache::GetCallsElided( )
+{
+	return Elided;
+}
+
+
+int
+GLStateCache::GetCallsIssued( )
+{
+	return Issued;
+}
+
+
+int
+GLStateCache::GetMismatches( )
+{
+	return Mismatches;
+}
+
+
+// what it has done since the last ResetCounters( ):
+
+void
+GLStateCache::PrintStats( FILE *fp )
+{
+	fprintf( fp, "GLState: %d calls made, %d skipped", Issued, Elided );
+	if( Verify )
+		fprintf( fp, ", %d shadow mismatches", Mismatches );
+	fprintf( fp, "\n" );
+}
+
+#endif		// #ifndef GLSTATE_CPP
@@ -0,0 +1,101 @@
+#ifndef GLSTATE_H
+#define GLSTATE_H
+
+#include <stdio.h>
+#include <map>
+#include <utility>
+
+#include "glew.h"
+#include <GL/gl.h>
+
+
+// a shadow copy of the fixed-function state, so that setting something to what it already is
+// costs a compare instead of a trip into the driver:
+//
+//	Display( ) sets the same enables, texture environment, light, and materials every frame,
+//	and usually several times a frame -- going through GLState, only the calls that really
+//	change something get made
+//
+//	the cache only knows about calls that go through it -- anything set behind its back
+//	(a display list, glPopAttrib( ) of something that was changed through the cache, a direct
+//	gl call) makes the shadow wrong, so call Invalidate( ) after code like that
+//	a display list that calls through the cache (SetMaterial( ), say) must be made with
+//	BeginList( )/EndList( ) instead of glNewList( )/glEndList( ) -- in between, every call goes
+//	straight into the list, since skipping one would leave it out of the list, and the shadow is
+//	left alone, since compiling a list does not change gl's state
+//	(with SetVerify( true ), a list made with glNewList( ) is noticed, and complained about)
+//	SetVerify( true ) checks the shadow against the driver every time a call is skipped,
+//	and reports (and fixes) any place where they disagree
+//
+//	things that are tracked:
+//		glEnable( )/glDisable( )
+//		glBindTexture( ) on texture unit 0 (the one the fixed-function code uses)
+//		glTexEnv( GL_TEXTURE_ENV_MODE )
+//		glLight( ) -- positions and spot directions are compared as they were given, along with the
+//			modelview matrix that was current then (gl keeps them in eye coordinates, so the same
+//			position under a different modelview is a different light) -- the caller passes that
+//			matrix in, since asking gl for it would cost more than the call it saves; without one,
+//			they are always sent
+//		glMaterial( ) -- but not while GL_COLOR_MATERIAL is on, since glColor( ) changes them then
+//
+//	use:
+//		GLState.Enable( GL_LIGHTING );
+//		GLState.TexEnvMode( GL_MODULATE );
+//		GLState.BindTexture( GL_TEXTURE_2D, MarsTex );
+//		...
+//		GLState.PrintStats( stderr );		// what it saved
+//		GLState.ResetCounters( );
+
+class GLStateCache
+{
+  private:
+	struct Value
+	{
+		float		v[4];
+		float		m[16];		// the modelview a light position or spot direction was given with
+	};
+
+	std::map<GLenum,bool>			Enables;
+	std::map<GLenum,GLuint>			Textures;	// by target
+	GLint					EnvMode;	// -1 means not known
+	std::map<std::pair<GLenum,GLenum>,Value>	Lights;		// by ( light, pname )
+	std::map<std::pair<GLenum,GLenum>,Value>	Materials;	// by ( GL_FRONT or GL_BACK, pname )
+
+	GLenum	ListMode;		// GL_COMPILE or GL_COMPILE_AND_EXECUTE between BeginList( ) and EndList( ), 0 otherwise
+	bool	Verify;
+	int	Issued, Elided, Mismatches;
+
+	bool	Close( const float *, const float *, int );
+	bool	IsColorMaterialOn( );
+	bool	IsRecording( );
+	void	Mismatch( const char *, GLenum, GLenum );
+	bool	Same( const Value &, const float *, int );
+	bool	SameMatrix( const Value &, const float * );
+	void	ToEye( GLenum, const float *, const float *, float * );
+
+  public:
+		GLStateCache( );
+
+	void	BeginList( GLuint, GLenum );
+	void	BindTexture( GLenum, GLuint );
+	void	Disable( GLenum );
+	void	Enable( GLenum );
+	void	EndList( );
+	int	GetCallsElided( );
+	int	GetCallsIssued( );
+	int	GetMismatches( );
+	void	Invalidate( );
+	void	Light( GLenum, GLenum, const float *, const float * = NULL );
+	void	Light( GLenum, GLenum, float );
+	void	Material( GLenum, GLenum, const float * );
+	void	Material( GLenum, GLenum, float );
+	void	PrintStats( FILE * );
+	void	ResetCounters( );
+	void	Set( GLenum, bool );
+	void	SetVerify( bool );
+	void	TexEnvMode( GLint );
+};
+
+extern GLStateCache	GLState;
+
+#endif		// #ifndef GLSTATE_H
@@ -0,0 +1,85 @@
+// make this 120 for the mac:
+#version 330 compatibility
+
+// the grid has no vertex attributes -- each vertex is found from gl_VertexID,
+// which includes the base vertex that picks the tile:
+
+uniform int	uTileSize;		// cells on a side of each tile
+uniform int	uTilesX;		// tiles in x
+uniform int	uNX, uNZ;		// cells in the whole grid
+uniform vec3	uOrigin;		// where the grid starts
+uniform float	uDX, uDZ;		// change in x and z between the points
+uniform int	uLighting;		// != 0 means GL_LIGHTING is on
+
+// there is no fragment shader, so the fixed-function fragment stage does fog
+// and texturing with what is written here
+
+void
+main( )
+{
+	int vertsPerTile = ( uTileSize + 1 ) * ( uTileSize + 1 );
+	int tile  = gl_VertexID / vertsPerTile;
+	int local = gl_VertexID - tile * vertsPerTile;
+	int ix = ( tile % uTilesX ) * uTileSize  +  local % ( uTileSize + 1 );
+	int iz = ( tile / uTilesX ) * uTileSize  +  local / ( uTileSize + 1 );
+
+	// the tiles along the far edges can hang over -- squash those vertices onto the edge:
+
+	ix = min( ix, uNX );
+	iz = min( iz, uNZ );
+
+	vec4 vertex = vec4( uOrigin.x + uDX * float(ix), uOrigin.y, uOrigin.z + uDZ * float(iz), 1. );
+	vec4 ECposition = gl_ModelViewMatrix * vertex;
+	gl_Position = gl_ModelViewProjectionMatrix * vertex;
+	gl_FogFragCoord = abs( ECposition.z );
+	gl_TexCoord[0] = vec4( float(ix) / float(uNX), float(iz) / float(uNZ), 0., 1. );
+
+	if( uLighting == 0 )
+	{
+		gl_FrontColor = gl_Color;
+		gl_BackColor  = gl_Color;
+		return;
+	}
+
+	// the same per-vertex lighting the fixed-function pipeline does for GL_LIGHT0:
+
+	vec3 N = normalize( gl_NormalMatrix * vec3( 0., 1., 0. ) );
+	vec4 color = gl_FrontLightModelProduct.sceneColor;
+
+	vec3 L;
+	float atten = 1.;
+	if( gl_LightSource[0].position.w == 0. )
+	{
+		L = normalize( gl_LightSource[0].position.xyz );
+	}
+	else
+	{
+		vec3 toLight = gl_LightSource[0].position.xyz - ECposition.xyz;
+		float dist = length( toLight );
+		L = toLight / dist;
+		atten = 1. / ( gl_LightSource[0].constantAttenuation +
+				gl_LightSource[0].linearAttenuation * dist +
+				gl_LightSource[0].quadraticAttenuation * dist * dist );
+		if( gl_LightSource[0].spotCutoff != 180. )
+		{
+			float spot = dot( -L, normalize( gl_LightSource[0].spotDirection ) );
+			if( spot < gl_LightSource[0].spotCosCutoff )
+				atten = 0.;
+			else
+				atten *= pow( spot, gl_LightSource[0].spotExponent );
+		}
+	}
+
+	float nl = max( dot( N, L ), 0. );
+	color += atten * gl_FrontLightProduct[0].ambient;
+	color += atten * nl * gl_FrontLightProduct[0].diffuse;
+	if( nl > 0. )
+	{
+		vec3 H = normalize( L + vec3( 0., 0., 1. ) );
+		color += atten * pow( max( dot( N, H ), 0. ), gl_FrontMaterial.shininess ) * gl_FrontLightProduct[0].specular;
+	}
+
+	color.a = gl_FrontMaterial.diffuse.a;
+	gl_FrontColor = clamp( color, 0., 1. );
+	gl_BackColor  = gl_FrontColor;
+}
@@ -0,0 +1,394 @@
+#include "linebatch.h"
+
+#include <math.h>
+#include <stddef.h>
+
+
+// the glut stroke font, pulled out of glut once so that text can go into the batch:
+
+static bool			GlyphsCaptured = false;
+static std::vector<float>	GlyphLines[128];		// x0,y0, x1,y1 for each line, in font units
+static float			GlyphAdvance[128];
+
+
+LineBatch::LineBatch( )
+{
+	NowLayer = 0;
+	NowColor[0] = NowColor[1] = NowColor[2] = NowColor[3] = 255;
+	StripStart = -1;
+	Open = false;
+	PixelsPerUnit = 1.;
+	IsOrtho = false;
+	NumSegments = 0;
+
+	Layer layer;
+	layer.Width = 1.;
+	Layers.push_back( layer );
+}
+
+
+// start a new frame's worth of lines:
+
+void
+LineBatch::Begin( )
+{
+	Vertices.clear( );
+	for( int i = 0; i < (int)Layers.size( ); i++ )
+		Layers[i].Indices.clear( );
+	NowLayer = 0;
+	NowColor[0] = NowColor[1] = NowColor[2] = NowColor[3] = 255;
+	StripStart = -1;
+	Open = true;
+
+	// what it takes to figure out how big a circle is on the screen:
+
+	float proj[16];
+	GLint viewport[4];
+	Pipeline.GetFloatv( GL_MODELVIEW_MATRIX, ModelView );
+	Pipeline.GetFloatv( GL_PROJECTION_MATRIX, proj );
+	glGetIntegerv( GL_VIEWPORT, viewport );
+	PixelsPerUnit = 0.5f * fabsf( proj[5] ) * (float)viewport[3];
+	IsOrtho = proj[11] == 0.;
+}
+
+
+void
+LineBatch::SetColor( float r, float g, float b, float a )
+{
+	float rgba[4] = { r, g, b, a };
+	for( int i = 0; i < 4; i++ )
+	{
+		float c = rgba[i];
+		if( c < 0. )	c = 0.;
+		if( c > 1. )	c = 1.;
+		NowColor[i] = (GLubyte)( 255.f * c + 0.5f );
+	}
+}
+
+
+void
+LineBatch::SetColor( const float rgb[3] )
+{
+	SetColor( rgb[0], rgb[1], rgb[2] );
+}
+
+
+// lines of different widths go into different layers, each of which is one draw:
+
+void
+LineBatch::SetLineWidth( float width )
+{
+	for( int i = 0; i < (int)Layers.size( ); i++ )
+	{
+		if( Layers[i].Width == width )
+		{
+			NowLayer = i;
+			return;
+		}
+	}
+
+	Layer layer;
+	layer.Width = width;
+	Layers.push_back( layer );
+	NowLayer = (int)Layers.size( ) - 1;
+}
+
+
+void
+LineBatch::BeginStrip( )
+{
+	StripStart = (int)Vertices.size( );
+}
+
+
+void
+LineBatch::Vertex( float x, float y, float z )
+{
+	if( StripStart < 0 )
+		StripStart = (int)Vertices.size( );
+
+	LineVertex v;
+	v.r = NowColor[0];
+	v.g = NowColor[1];
+	v.b = NowColor[2];
+	v.a = NowColor[3];
+	v.x = x;
+	v.y = y;
+	v.z = z;
+	Vertices.push_back( v );
+
+	GLuint last = (GLuint)Vertices.size( ) - 1;
+	if( (int)last > StripStart )
+	{
+		Layers[NowLayer].Indices.push_back( last - 1 );
+		Layers[NowLayer].Indices.push_back( last );
+	}
+}
+
+
+void
+LineBatch::EndStrip( )
+{
+	StripStart = -1;
+}
+
+
+// like EndStrip( ), but joins the last vertex back to the first, as GL_LINE_LOOP does:
+
+void
+LineBatch::EndLoop( )
+{
+	int last = (int)Vertices.size( ) - 1;
+	if( StripStart >= 0  &&  last - StripStart >= 2 )
+	{
+		Layers[NowLayer].Indices.push_back( (GLuint)last );
+		Layers[NowLayer].Indices.push_back( (GLuint)StripStart );
+	}
+	StripStart = -1;
+}
+
+
+// a circle in the XZ plane, with only as many segments as it needs to look round
+// (so that no segment is more than about half a pixel away from the real circle):
+
+void
+LineBatch::AddCircle( float cx, float cy, float cz, float radius )
+{
+	const int MINSEGS =  12;
+	const int MAXSEGS = 512;
+
+	// the modelview matrix can have a scale in it:
+	float *m = ModelView;
+	float scale = sqrtf( m[0]*m[0] + m[1]*m[1] + m[2]*m[2] );
+	float r = scale * fabsf( radius );
+	float pixels = r * PixelsPerUnit;
+	if( ! IsOrtho )
+	{
+		// use the closest the circle can get to the eye:
+		float ze = -( m[2]*cx + m[6]*cy + m[10]*cz + m[14] );
+		float dist = ze - r;
+		pixels = dist > 0.001f * r ? pixels / dist : 1.e+6f;
+	}
+
+	int numSegs = (int)ceilf( (float)M_PI * sqrtf( pixels ) );
+	if( numSegs < MINSEGS )		numSegs = MINSEGS;
+	if( numSegs > MAXSEGS )		numSegs = MAXSEGS;
+
+	// step around the circle with a rotation rather than calling cos( ) and sin( ) every time:
+
+	float dang = 2.f * (float)M_PI / (float)numSegs;
+	float c = cosf( dang );
+	float s = sinf( dang );
+	float x = radius;
+	float z = 0.;
+	BeginStrip( );
+	for( int i = 0; i < numSegs; i++ )
+	{
+		Vertex( cx + x, cy, cz + z );
+		float xnew = c*x - s*z;
+		z = s*x + c*z;
+		x = xnew;
+	}
+	EndLoop( );
+}
+
+
+// the same as DoStrokeString( ): the text sits in the XY plane starting at x,y,z, ht tall:
+
+void
+LineBatch::AddStrokeString( float x, float y, float z, float ht, const char *s )
+{
+	CaptureGlyphs( );
+
+	float sf = ht / ( 119.05f + 33.33f );
+	float pen = 0.;
+	for( ; *s != '\0'; s++ )
+	{
+		int c = *s & 0x7f;
+		std::vector<float> &lines = GlyphLines[c];
+		for( int i = 0; i+3 < (int)lines.size( ); i += 4 )
+		{
+			BeginStrip( );
+				Vertex( x + sf*( pen + lines[i+0] ), y + sf*lines[i+1], z );
+				Vertex( x + sf*( pen + lines[i+2] ), y + sf*lines[i+3], z );
+			EndStrip( );
+		}
+		pen += GlyphAdvance[c];
+	}
+}
+
+
+// draw each character once in feedback mode and keep the lines it makes:
+// (the projection is set up so that window coordinates are font units, offset by HALF)
+
+void
+LineBatch::CaptureGlyphs( )
+{
+	if( GlyphsCaptured )
+		return;
+	GlyphsCaptured = true;
+
+	const float HALF = 200.;
+	std::vector<GLfloat> feedback( 8192 );
+
+	glPushAttrib( GL_VIEWPORT_BIT | GL_TRANSFORM_BIT );
+	glViewport( 0, 0, (GLsizei)( 2.*HALF ), (GLsizei)( 2.*HALF ) );
+	glMatrixMode( GL_PROJECTION );
+	glPushMatrix( );
+	glLoadIdentity( );
+	glOrtho( -HALF, HALF,   -HALF, HALF,   -1., 1. );
+	glMatrixMode( GL_MODELVIEW );
+	glPushMatrix( );
+
+	for( int c = ' '; c < 127; c++ )
+	{
+		glLoadIdentity( );
+		glFeedbackBuffer( (GLsizei)feedback.size( ), GL_2D, &feedback[0] );
+		glRenderMode( GL_FEEDBACK );
+		glutStrokeCharacter( GLUT_STROKE_ROMAN, c );
+		int n = glRenderMode( GL_RENDER );
+		if( n < 0 )
+		{
+			fprintf( stderr, "LineBatch: feedback buffer overflow for character '%c'\n", c );
+			n = 0;
+		}
+
+		for( int i = 0; i < n; )
+		{
+			int token = (int)feedback[i++];
+			switch( token )
+			{
+				case GL_LINE_TOKEN:
+				case GL_LINE_RESET_TOKEN:
+					for( int k = 0; k < 4; k++ )
+						GlyphLines[c].push_back( feedback[i+k] - HALF );
+					i += 4;
+					break;
+
+				case GL_POLYGON_TOKEN:
+					i += 1 + 2 * (int)feedback[i];
+					break;
+
+				case GL_PASS_THROUGH_TOKEN:
+					i += 1;
+					break;
+
+				default:		// points, bitmaps, and pixels have one vertex
+					i += 2;
+			}
+		}
+		GlyphAdvance[c] = (float)glutStrokeWidth( GLUT_STROKE_ROMAN, c );
+	}
+
+	glPopMatrix( );
+	glMatrixMode( GL_PROJECTION );
+	glPopMatrix( );
+	glPopAttrib( );
+}
+
+
+void
+LineBatch::Draw( )
+{
+	Open = false;
+	NumSegments = 0;
+	if( Vertices.empty( ) )
+		return;
+
+	AllIndices.clear( );
+	for( int i = 0; i < (int)Layers.size( ); i++ )
+		AllIndices.insert( AllIndices.end( ), Layers[i].Indices.begin( ), Layers[i].Indices.end( ) );
+	if( AllIndices.empty( ) )
+		return;
+	NumSegments = (int)AllIndices.size( ) / 2;
+
+	// write both into this frame's part of their stream buffers -- no new storage, and no
+	// waiting for last frame's draw to finish with the old:
+
+	GLsizeiptr vertexBytes = Vertices.size( )*sizeof(LineVertex);
+	GLsizeiptr indexBytes = AllIndices.size( )*sizeof(GLuint);
+	if( vertexBytes > VertexStream.GetRegionSize( ) )
+		VertexStream.Init( GL_ARRAY_BUFFER, 2*vertexBytes, 16, "LineBatch vertices" );
+	if( indexBytes > IndexStream.GetRegionSize( ) )
+		IndexStream.Init( GL_ELEMENT_ARRAY_BUFFER, 2*indexBytes, 16, "LineBatch indices" );
+	VertexStream.BeginFrame( );
+	IndexStream.BeginFrame( );
+	GLintptr vertexOffset = VertexStream.Push( &Vertices[0], vertexBytes );
+	GLintptr indexOffset = IndexStream.Push( &AllIndices[0], indexBytes );
+
+	glBindBuffer( GL_ARRAY_BUFFER, VertexStream.GetBuffer( ) );
+	glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, IndexStream.GetBuffer( ) );
+
+	glPushAttrib( GL_ENABLE_BIT | GL_LINE_BIT | GL_CURRENT_BIT );	// the color array leaves the current color undefined
+	bool core = Pipeline.Begin( true );				// lines are never lit or textured
+	if( core )
+	{
+		// the same vertices, as the attributes that the pipeline's shader reads:
+
+		glEnableVertexAttribArray( MESH_POSITION );
+		glVertexAttribPointer( MESH_POSITION, 3, GL_FLOAT, GL_FALSE, sizeof(LineVertex), (GLvoid *)( vertexOffset + offsetof( LineVertex, x ) ) );
+		glEnableVertexAttribArray( MESH_COLOR );
+		glVertexAttribPointer( MESH_COLOR, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(LineVertex), (GLvoid *)( vertexOffset + offsetof( LineVertex, r ) ) );
+	}
+	else
+	{
+		glDisable( GL_LIGHTING );
+		glDisable( GL_TEXTURE_2D );
+	}
+	glPushClientAttrib( GL_CLIENT_VERTEX_ARRAY_BIT );
+	if( ! core )
+		glInterleavedArrays( GL_C4UB_V3F, 0, (GLvoid *)vertexOffset );
+
+	size_t offset = 0;			// in indices
+	for( int i = 0; i < (int)Layers.size( ); i++ )
+	{
+		GLsizei count = (GLsizei)Layers[i].Indices.size( );
+		if( count == 0 )
+			continue;
+		glLineWidth( Layers[i].Width );
+		glDrawElements( GL_LINES, count, GL_UNSIGNED_INT, (GLvoid *)( indexOffset + offset*sizeof(GLuint) ) );
+		offset += count;
+	}
+
+	glPopClientAttrib( );
+	if( core )
+	{
+		glDisableVertexAttribArray( MESH_POSITION );
+		glDisableVertexAttribArray( MESH_COLOR );
+		Pipeline.End( );
+	}
+	glPopAttrib( );
+	glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, 0 );
+	glBindBuffer( GL_ARRAY_BUFFER, 0 );
+	VertexStream.EndFrame( );
+	IndexStream.EndFrame( );
+}
+
+
+int
+LineBatch::GetNumSegments( )
+{
+	return NumSegments;
+}
+
+
+int
+LineBatch::GetNumVertices( )
+{
+	return (int)Vertices.size( );
+}
+
+
+bool
+LineBatch::IsOpen( )
+{
+	return Open;
+}
+
+
+void
+LineBatch::PrintStats( FILE *fp )
+{
+	VertexStream.PrintStats( fp );
+	IndexStream.PrintStats( fp );
+}
@@ -0,0 +1,90 @@
+#ifndef LINEBATCH_H
+#define LINEBATCH_H
+
+#include <stdio.h>
+#include <vector>
+
+#include "glew.h"
+#include <GL/gl.h>
+#include "glut.h"
+
+#include "pipeline.cpp"
+#include "streambuffer.cpp"
+
+
+// collects all of a frame's lines -- orbits, axes, stroke text -- and draws them together:
+//
+//	polylines are added the same way they would be drawn with glBegin( GL_LINE_STRIP ),
+//	but they go into one vertex array and one GL_LINES index array instead of being drawn
+//	Draw( ) writes both into stream buffers and draws each line width with a single
+//	glDrawElements( ), so the cost stays the same however many lines there are
+//
+//	everything is in the coordinates of the modelview matrix that is current (in Pipeline) when
+//	Begin( ) and Draw( ) are called -- those two need to be the same
+//
+//	use:
+//		Lines.Begin( );
+//		Lines.SetColor( 1., 1., 1. );
+//		Lines.AddCircle( 0., 0., 0., radius );		// segments picked from its size on the screen
+//		Lines.BeginStrip( );
+//			Lines.Vertex( ... );
+//		Lines.EndStrip( );
+//		Lines.AddStrokeString( x, y, z, ht, "Mars" );
+//		Lines.Draw( );
+//
+//	IsOpen( ) says whether it is between Begin( ) and Draw( ), for code that can also draw right away
+
+struct LineVertex
+{
+	GLubyte		r, g, b, a;			// the layout of GL_C4UB_V3F
+	float		x, y, z;
+};
+
+class LineBatch
+{
+  private:
+	struct Layer
+	{
+		float			Width;
+		std::vector<GLuint>	Indices;	// pairs, for GL_LINES
+	};
+
+	std::vector<LineVertex>	Vertices;
+	std::vector<Layer>	Layers;			// one per line width
+	int			NowLayer;
+	GLubyte			NowColor[4];
+	int			StripStart;		// first vertex of the strip being added, -1 if none
+	bool			Open;			// between Begin( ) and Draw( )
+
+	float			ModelView[16];		// from Begin( ), for sizing circles
+	float			PixelsPerUnit;		// screen size of 1 unit at a distance of 1
+	bool			IsOrtho;
+
+	StreamBuffer		VertexStream;		// grown to fit the biggest frame so far
+	StreamBuffer		IndexStream;
+	std::vector<GLuint>	AllIndices;		// every layer's indices, back to back
+	int			NumSegments;		// in the last Draw( )
+
+	static void		CaptureGlyphs( );
+
+  public:
+		LineBatch( );
+
+	void	AddCircle( float, float, float, float );
+	void	AddStrokeString( float, float, float, float, const char * );
+	void	Begin( );
+	void	BeginStrip( );
+	void	Draw( );
+	void	EndLoop( );
+	void	EndStrip( );
+	int	GetNumSegments( );
+	int	GetNumVertices( );
+	bool	IsOpen( );
+	void	PrintStats( FILE * );
+	void	SetColor( float, float, float, float = 1. );
+	void	SetColor( const float [3] );
+	void	SetLineWidth( float );
+	void	Vertex( float, float, float );
+};
+
+#endif		// #ifndef LINEBATCH_H
@@ -6,6 +6,9 @@
 #include <GL/gl.h>
 
 #include <vector>
+#include <map>
+
+#include "osusurface.cpp"
 
 
 // delimiters for parsing the obj file:
@@ -42,8 +45,12 @@ void	ReadObjVTN( char *, int *, int *, int * );
 
 
 
+// read an obj file into a mesh, which can then go into a Mesh's buffers:
+// (corners that use the same v/t/n share a vertex -- corners without a normal get the
+// face's normal, so they cannot)
+
 int
-LoadObjFile( char *name )
+LoadObjFile( char *name, struct SurfaceMesh *mesh )
 {
 	char *cmd;		// the command string
 	char *str;		// argument string
@@ -60,6 +67,8 @@ LoadObjFile( char *name )
 	struct Normal sn;
 	struct TextureCoord st;
 
+	std::map< std::pair<int,std::pair<int,int> >, GLuint > shared;	// v,t,n -> index in mesh
+
 
 	// open the input file:
 
@@ -78,8 +87,6 @@ LoadObjFile( char *name )
 	float ymax = -ymin;
 	float zmax = -zmin;
 
-	glBegin( GL_TRIANGLES );
-
 	for( ; ; )
 	{
 		char *line = ReadRestOfLine( fp );
@@ -287,24 +294,51 @@ LoadObjFile( char *name )
 				v02[2] = v2->z - v0->z;
 				Cross( v01, v02, norm );
 				Unit( norm, norm );
-				glNormal3fv( norm );
 
 				for( int vtx = 0; vtx < 3 ; vtx++ )
 				{
-					if( vertices[ vv[vtx] ].t != 0 )
+					struct face *f = &vertices[ vv[vtx] ];
+					std::pair<int,std::pair<int,int> > key( f->v, std::pair<int,int>( f->t, f->n ) );
+					if( f->n != 0 )
+					{
+						std::map< std::pair<int,std::pair<int,int> >, GLuint >::iterator pos = shared.find( key );
+						if( pos != shared.end( ) )
+						{
+							mesh->Indices.push_back( pos->second );
+							continue;
+						}
+					}
+
+					struct SurfaceVertex p;
+					p.s = p.t = 0.;
+					if( f->t != 0 )
 					{
-						struct TextureCoord *tp = &TextureCoords[ vertices[ vv[vtx] ].t - 1 ];
-						glTexCoord2f( tp->s, tp->t );
+						struct TextureCoord *tp = &TextureCoords[ f->t - 1 ];
+						p.s = tp->s;
+						p.t = tp->t;
 					}
 
-					if( vertices[ vv[vtx] ].n != 0 )
+					p.nx = norm[0];
+					p.ny = norm[1];
+					p.nz = norm[2];
+					if( f->n != 0 )
 					{
-						struct Normal *np = &Normals[ vertices[ vv[vtx] ].n - 1 ];
-						glNormal3f( np->nx, np->ny, np->nz );
+						struct Normal *np = &Normals[ f->n - 1 ];
+						p.nx = np->nx;
+						p.ny = np->ny;
+						p.nz = np->nz;
 					}
 
-					struct Vertex *vp = &Vertices[ vertices[ vv[vtx] ].v - 1 ];
-					glVertex3f( vp->x, vp->y, vp->z );
+					struct Vertex *vp = &Vertices[ f->v - 1 ];
+					p.x = vp->x;
+					p.y = vp->y;
+					p.z = vp->z;
+
+					GLuint index = (GLuint)mesh->Vertices.size( );
+					mesh->Vertices.push_back( p );
+					mesh->Indices.push_back( index );
+					if( f->n != 0 )
+						shared[key] = index;
 				}
 			}
 			continue;
@@ -318,7 +352,6 @@ LoadObjFile( char *name )
 
 	}
 
-	glEnd();
 	fclose( fp );
 
 	fprintf( stderr, "Obj file range: [%8.3f,%8.3f,%8.3f] -> [%8.3f,%8.3f,%8.3f]\n",
@@ -332,6 +365,19 @@ LoadObjFile( char *name )
 }
 
 
+// the original way -- draw the obj file's triangles right now, usually into a display list:
+
+int
+LoadObjFile( char *name )
+{
+	struct SurfaceMesh mesh;
+	int status = LoadObjFile( name, &mesh );
+	if( status == 0 )
+		mesh.Draw( );
+	return status;
+}
+
+
 
 char *
 ReadRestOfLine( FILE *fp )
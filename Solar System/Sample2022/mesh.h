@@ -0,0 +1,134 @@
+#ifndef MESH_H
+#define MESH_H
+
+#include <stdio.h>
+#include <vector>
+
+#include "glew.h"
+#include <GL/gl.h>
+
+#include "osusurface.cpp"
+
+
+// geometry that lives in buffer objects instead of display lists:
+//
+//	a Mesh is built on the cpu -- either a vertex at a time, like glBegin( )/glEnd( ), or from
+//	a SurfaceMesh that OsuSphere( ), OsuCone( ), OsuTorus( ), or LoadObjFile( ) filled in --
+//	and then Upload( ) copies it into a vertex buffer and an index buffer that a vertex array
+//	object points to, and Draw( ) is one glDrawElements( )
+//
+//	the attributes go in as the usual gl_Vertex, gl_Normal, gl_Color, and gl_MultiTexCoord0 arrays,
+//	and also as generic attributes at the locations below (the same ones nvidia aliases them to,
+//	so the two never fight) -- so a Mesh draws with the fixed-function pipeline, with a
+//	compatibility shader, or with a shader that uses layout( location = ... )
+//
+//	MESH_INTERLEAVED puts each vertex's attributes next to each other, which is usually fastest to draw
+//	MESH_SOA puts all of the positions together, then all of the normals, etc., so that
+//	UpdatePositions( ) can rewrite just the positions
+//
+//	a mesh can also be made ahead of time, into a header of MeshVertex and index arrays,
+//	by meshheader (see meshheader.cpp, in Project 2) -- UploadEmbedded( ) then copies those arrays into the
+//	buffers exactly as they are, so the mesh costs nothing on the cpu when the program starts
+//
+//	Upload( ) and UploadEmbedded( ) also find a sphere and a box around the vertices, for frustum
+//	and occlusion culling -- UpdatePositions( ) grows them if the new positions stick out
+//
+//	InstanceAttribute( ) adds an attribute that comes from another buffer, one value per instance
+//	instead of one per vertex, for a shader drawn with DrawInstanced( ) -- it goes in the same
+//	vertex array object, so Draw( ) and DrawInstanced( ) do not have to set it up every time
+//
+//	use:
+//		Mesh Horse;
+//		Horse.Color( 1., 1., 0. );
+//		Horse.Vertex( x0, y0, z0 );  Horse.Vertex( x1, y1, z1 );  Horse.Vertex( x2, y2, z2 );
+//		...
+//		Horse.Upload( );
+//		...
+//		Horse.Draw( );
+
+const GLuint MESH_POSITION = 0;
+const GLuint MESH_NORMAL   = 2;
+const GLuint MESH_COLOR    = 3;
+const GLuint MESH_TEXCOORD = 8;
+
+// one vertex of a mesh made ahead of time by meshheader -- the same layout that
+// Upload( ) makes for MESH_INTERLEAVED when there are normals, texture coordinates, and colors:
+
+struct MeshVertex
+{
+	float		x, y, z;
+	float		nx, ny, nz;
+	float		s, t;
+	unsigned char	r, g, b, a;
+};
+
+enum MeshLayout
+{
+	MESH_INTERLEAVED,
+	MESH_SOA
+};
+
+class Mesh
+{
+  private:
+	std::vector<float>	Positions;		// 3 per vertex
+	std::vector<float>	Normals;		// 3 per vertex
+	std::vector<float>	TexCoords;		// 2 per vertex
+	std::vector<GLubyte>	Colors;			// 4 per vertex
+	std::vector<GLuint>	Indices;		// if empty, the vertices are used in order
+
+	float			NowNormal[3];		// what the next Vertex( ) gets, like glNormal3f( ) etc.
+	float			NowTexCoord[2];
+	GLubyte			NowColor[4];
+	bool			HasNormals, HasTexCoords, HasColors;
+	GLenum			Topology;
+
+	MeshLayout		Layout;
+	GLuint			VertexArray;
+	GLuint			VertexBuffer;
+	GLuint			IndexBuffer;
+	GLenum			IndexType;
+	GLsizei			NumIndices;
+	int			NumVertices;		// what is in the buffers now
+	GLsizei			Stride;
+	size_t			PositionOffset, NormalOffset, TexCoordOffset, ColorOffset;
+	size_t			GpuBytes;
+	float			BoundCenter[3];		// the bounding sphere
+	float			BoundRadius;
+	float			BoundMin[3], BoundMax[3];	// the bounding box
+
+	static size_t		TotalGpuBytes;		// over every Mesh, for profiling
+
+	void	FitBound( const GLubyte *, int, size_t );
+	void	GrowBound( const float *, int );
+	void	UploadBuffers( const GLvoid *, size_t, const GLvoid *, size_t, GLenum );
+	void	UploadEmbedded( const MeshVertex *, int, const GLvoid *, int, GLenum );
+
+  public:
+		Mesh( );
+
+	void	AddSurface( const struct SurfaceMesh & );
+	void	Clear( );
+	void	Color( float, float, float, float = 1. );
+	void	Draw( );
+	void	DrawInstanced( int );
+	void	InstanceAttribute( GLuint, int, GLuint, GLsizei, size_t );
+	void	GetBoundingBox( float [3], float [3] );
+	void	GetBoundingSphere( float [3], float * );
+	size_t	GetGpuBytes( );
+	int	GetNumTriangles( );
+	int	GetNumVertices( );
+	void	Normal( float, float, float );
+	void	SetTopology( GLenum );
+	void	TexCoord( float, float );
+	void	Triangle( int, int, int );
+	void	UpdatePositions( int, int, const float * );
+	void	Upload( MeshLayout = MESH_INTERLEAVED, GLenum = GL_STATIC_DRAW );
+	void	UploadEmbedded( const MeshVertex *, int, const GLushort *, int );
+	void	UploadEmbedded( const MeshVertex *, int, const GLuint *, int );
+	int	Vertex( float, float, float );
+
+	static size_t	GetTotalGpuBytes( );
+};
+
+#endif		// #ifndef MESH_H
@@ -0,0 +1,328 @@
+#ifndef PICKER_CPP
+#define PICKER_CPP
+
+#include "picker.h"
+
+#include <math.h>
+#include <chrono>
+#include <thread>
+
+#include "glm/glm.hpp"
+#include "glm/gtc/type_ptr.hpp"
+
+
+// a ray in a mesh's coordinates, tested against its triangles (Moller-Trumbore, both sides):
+
+struct PickTriangleRay : public BvhRay
+{
+	const float *	Xyz;
+	const GLuint *	Indices;
+	int		Triangle;
+
+	bool
+	HitItem( int triangle )
+	{
+		const float *p0 = &Xyz[ 3*Indices[3*triangle+0] ];
+		const float *p1 = &Xyz[ 3*Indices[3*triangle+1] ];
+		const float *p2 = &Xyz[ 3*Indices[3*triangle+2] ];
+		float e1[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+		float e2[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+		float p[3] = { Direction[1]*e2[2] - Direction[2]*e2[1], Direction[2]*e2[0] - Direction[0]*e2[2], Direction[0]*e2[1] - Direction[1]*e2[0] };
+		float det = e1[0]*p[0] + e1[1]*p[1] + e1[2]*p[2];
+		if( fabsf( det ) < 1.e-12f )
+			return false;			// edge-on
+		float inv = 1.f / det;
+		float s[3] = { Origin[0] - p0[0], Origin[1] - p0[1], Origin[2] - p0[2] };
+		float u = ( s[0]*p[0] + s[1]*p[1] + s[2]*p[2] ) * inv;
+		if( u < 0.  ||  u > 1. )
+			return false;
+		float q[3] = { s[1]*e1[2] - s[2]*e1[1], s[2]*e1[0] - s[0]*e1[2], s[0]*e1[1] - s[1]*e1[0] };
+		float v = ( Direction[0]*q[0] + Direction[1]*q[1] + Direction[2]*q[2] ) * inv;
+		if( v < 0.  ||  u + v > 1. )
+			return false;
+		float t = ( e2[0]*q[0] + e2[1]*q[1] + e2[2]*q[2] ) * inv;
+		if( t < 0.  ||  t > TMax )
+			return false;
+		TMax = t;
+		Triangle = triangle;
+		return true;
+	}
+};
+
+
+// a ray in world coordinates, tested against the objects -- each one it reaches, it goes into
+// that object's coordinates and down its mesh's bvh:
+// (the direction is not normalized in there, so t means the same thing on both sides)
+
+struct PickObjectRay : public BvhRay
+{
+	Picker *	Owner;
+	int		Object, Triangle;
+	int		NodesBelow, TrianglesTested, ObjectsEntered;
+
+	bool
+	HitItem( int object )
+	{
+		Picker::PickMesh &mesh = Owner->Meshes[ Owner->ObjectMeshes[object] ];
+		if( mesh.Indices.empty( ) )
+			return false;
+		ObjectsEntered++;
+
+		glm::mat4 inverse = glm::inverse( glm::make_mat4( &Owner->Worlds[16*object] ) );
+		glm::vec4 o = inverse * glm::vec4( Origin[0], Origin[1], Origin[2], 1. );
+		glm::vec4 d = inverse * glm::vec4( Direction[0], Direction[1], Direction[2], 0. );
+		const float origin[3] = { o.x, o.y, o.z };
+		const float direction[3] = { d.x, d.y, d.z };
+
+		PickTriangleRay ray;
+		ray.Set( origin, direction, TMax );
+		ray.Xyz = &mesh.Xyz[0];
+		ray.Indices = &mesh.Indices[0];
+		ray.Triangle = -1;
+		bool hit = mesh.Triangles.Trace( ray );
+		NodesBelow += ray.NodesVisited;
+		TrianglesTested += ray.ItemsTested;
+		if( ! hit )
+			return false;
+		TMax = ray.TMax;
+		Object = object;
+		Triangle = ray.Triangle;
+		return true;
+	}
+};
+
+
+Picker::Picker( )
+{
+	Moved = false;
+	NumBuilt = -1;
+	NumThreads = (int)std::thread::hardware_concurrency( );
+	if( NumThreads < 1 )
+		NumThreads = 1;
+	NodesVisited = TrianglesTested = ObjectsEntered = 0;
+	RefitMs = TraceUs = 0.;
+}
+
+
+// a mesh's triangles -- numVertices positions, stride bytes apart, and numIndices indices, 3 per triangle:
+// returns the number to give AddObject( )
+
+int
+Picker::AddMesh( const float *xyz, size_t stride, int numVertices, const GLuint *indices, int numIndices )
+{
+	int index = (int)Meshes.size( );
+	Meshes.push_back( PickMesh( ) );
+	PickMesh &mesh = Meshes.back( );
+
+	mesh.Xyz.resize( 3*numVertices );
+	for( int i = 0; i < numVertices; i++ )
+	{
+		const float *p = (const float *)( (const unsigned char *)xyz + i*stride );
+		for( int k = 0; k < 3; k++ )
+		{
+			mesh.Xyz[3*i+k] = p[k];
+			if( i == 0  ||  p[k] < mesh.Min[k] )	mesh.Min[k] = p[k];
+			if( i == 0  ||  p[k] > mesh.Max[k] )	mesh.Max[k] = p[k];
+		}
+	}
+	if( numVertices == 0 )
+	{
+		for( int k = 0; k < 3; k++ )
+			mesh.Min[k] = mesh.Max[k] = 0.;
+	}
+
+	int numTriangles = numIndices / 3;
+	mesh.Indices.assign( indices, indices + 3*numTriangles );
+
+	std::vector<float> bmin( 3*numTriangles ), bmax( 3*numTriangles );
+	for( int t = 0; t < numTriangles; t++ )
+	{
+		for( int v = 0; v < 3; v++ )
+		{
+			const float *p = &mesh.Xyz[ 3*mesh.Indices[3*t+v] ];
+			for( int k = 0; k < 3; k++ )
+			{
+				if( v == 0  ||  p[k] < bmin[3*t+k] )	bmin[3*t+k] = p[k];
+				if( v == 0  ||  p[k] > bmax[3*t+k] )	bmax[3*t+k] = p[k];
+			}
+		}
+	}
+	mesh.Triangles.SetThreads( NumThreads );
+	mesh.Triangles.Build( numTriangles, bmin.data( ), bmax.data( ) );
+	return index;
+}
+
+
+int
+Picker::AddMesh( const struct SurfaceMesh &surface )
+{
+	if( surface.Vertices.empty( )  ||  surface.Indices.empty( ) )
+		return AddMesh( NULL, 0, 0, NULL, 0 );
+	return AddMesh( &surface.Vertices[0].x, sizeof(struct SurfaceVertex), (int)surface.Vertices.size( ),
+		&surface.Indices[0], (int)surface.Indices.size( ) );
+}
+
+
+// a copy of mesh, placed by world (NULL = where it is):
+// returns the object's number, which is what a PickHit says was hit
+
+int
+Picker::AddObject( int mesh, const float world[16] )
+{
+	int object = (int)ObjectMeshes.size( );
+	ObjectMeshes.push_back( mesh );
+	Worlds.resize( 16*( object + 1 ) );
+	ObjectMin.resize( 3*( object + 1 ) );
+	ObjectMax.resize( 3*( object + 1 ) );
+	SetWorld( object, world );
+	return object;
+}
+
+
+// sort the objects into a new bvh, where they are now:
+// (Pick( ) does this itself if objects have been added or taken away since the last one)
+
+void
+Picker::Build( )
+{
+	Objects.SetThreads( NumThreads );
+	Objects.Build( GetNumObjects( ), ObjectMin.data( ), ObjectMax.data( ) );
+	NumBuilt = GetNumObjects( );
+	Moved = false;
+}
+
+
+// get rid of every object (the meshes are kept):
+
+void
+Picker::ClearObjects( )
+{
+	ObjectMeshes.clear( );
+	Worlds.clear( );
+	ObjectMin.clear( );
+	ObjectMax.clear( );
+	NumBuilt = -1;
+}
+
+
+// the box around the object in world coordinates -- the box around its mesh, with each of the
+// world matrix's columns adding its reach in each direction:
+
+void
+Picker::FitObject( int object )
+{
+	const PickMesh &mesh = Meshes[ ObjectMeshes[object] ];
+	const float *m = &Worlds[16*object];
+	float c[3], e[3];
+	for( int k = 0; k < 3; k++ )
+	{
+		c[k] = 0.5f * ( mesh.Min[k] + mesh.Max[k] );
+		e[k] = 0.5f * ( mesh.Max[k] - mesh.Min[k] );
+	}
+	for( int row = 0; row < 3; row++ )
+	{
+		float center = m[12+row] + m[row] * c[0] + m[4+row] * c[1] + m[8+row] * c[2];
+		float reach = fabsf( m[row] ) * e[0] + fabsf( m[4+row] ) * e[1] + fabsf( m[8+row] ) * e[2];
+		ObjectMin[3*object+row] = center - reach;
+		ObjectMax[3*object+row] = center + reach;
+	}
+}
+
+
+int
+Picker::GetNumObjects( )
+{
+	return (int)ObjectMeshes.size( );
+}
+
+
+// what is under window position (x,y) -- in pixels, with y up from the bottom, like gl's --
+// with the projection and modelview matrices and the viewport it was drawn with:
+// returns false if there is nothing there
+
+bool
+Picker::Pick( float x, float y, const float projection[16], const float modelview[16], const int viewport[4], PickHit &hit )
+{
+	glm::mat4 inverse = glm::inverse( glm::make_mat4( projection ) * glm::make_mat4( modelview ) );
+	float nx = 2.f * ( x - (float)viewport[0] ) / (float)viewport[2] - 1.f;
+	float ny = 2.f * ( y - (float)viewport[1] ) / (float)viewport[3] - 1.f;
+	glm::vec4 n = inverse * glm::vec4( nx, ny, -1., 1. );
+	glm::vec4 f = inverse * glm::vec4( nx, ny,  1., 1. );
+	n /= n.w;
+	f /= f.w;
+
+	const float origin[3] = { n.x, n.y, n.z };
+	const float direction[3] = { f.x - n.x, f.y - n.y, f.z - n.z };
+	return Trace( origin, direction, hit );
+}
+
+
+void
+Picker::PrintStats( FILE *fp )
+{
+	fprintf( fp, "Picker: %d meshes, %d objects ; last pick: bvh fit in %.3f ms, traced in %.1f us -- %d nodes, %d objects entered, %d triangles tested\n",
+		(int)Meshes.size( ), GetNumObjects( ), RefitMs, TraceUs, NodesVisited, ObjectsEntered, TrianglesTested );
+}
+
+
+// how many threads each Build( ) may use:
+
+void
+Picker::SetThreads( int threads )
+{
+	NumThreads = threads < 1  ?  1  :  threads;
+}
+
+
+// move an object (NULL = back to where its mesh is):
+
+void
+Picker::SetWorld( int object, const float world[16] )
+{
+	float *m = &Worlds[16*object];
+	for( int i = 0; i < 16; i++ )
+		m[i] = world != NULL  ?  world[i]  :  ( i % 5 == 0  ?  1.f  :  0.f );
+	FitObject( object );
+	Moved = true;
+}
+
+
+// the nearest thing on the segment from origin to origin+direction:
+// returns false if there is nothing there
+
+bool
+Picker::Trace( const float origin[3], const float direction[3], PickHit &hit )
+{
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now( );
+	RefitMs = 0.;
+	if( NumBuilt != GetNumObjects( ) )
+		Build( );
+	else if( Moved )
+	{
+		Objects.Refit( ObjectMin.data( ), ObjectMax.data( ) );
+		Moved = false;
+	}
+	std::chrono::steady_clock::time_point traced = std::chrono::steady_clock::now( );
+	RefitMs = std::chrono::duration<double, std::milli>( traced - start ).count( );
+
+	PickObjectRay ray;
+	ray.Set( origin, direction, 1. );
+	ray.Owner = this;
+	ray.Object = ray.Triangle = -1;
+	ray.NodesBelow = ray.TrianglesTested = ray.ObjectsEntered = 0;
+	bool found = Objects.Trace( ray );
+
+	NodesVisited = ray.NodesVisited + ray.NodesBelow;
+	TrianglesTested = ray.TrianglesTested;
+	ObjectsEntered = ray.ObjectsEntered;
+	TraceUs = std::chrono::duration<double, std::micro>( std::chrono::steady_clock::now( ) - traced ).count( );
+
+	hit.Object = ray.Object;
+	hit.Triangle = ray.Triangle;
+	hit.T = ray.TMax;
+	for( int k = 0; k < 3; k++ )
+		hit.Point[k] = origin[k] + ray.TMax * direction[k];
+	return found;
+}
+
+#endif		// #ifndef PICKER_CPP
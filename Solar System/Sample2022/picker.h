@@ -0,0 +1,96 @@
+#ifndef PICKER_H
+#define PICKER_H
+
+#include <stdio.h>
+#include <vector>
+
+#include "glew.h"
+#include <GL/gl.h>
+
+#include "bvh.cpp"
+#include "osusurface.cpp"
+
+
+// mouse picking -- what is under the cursor, found on the cpu by following a ray through the scene,
+// instead of reading anything back from the gpu, so it is cheap, and the same every time:
+//
+//	a mesh is added once, and gets a bvh of its triangles, in its own coordinates
+//	an object is a mesh placed in the world by a world matrix -- the objects get a bvh of their own,
+//	of the boxes around them in world coordinates
+//	so a ray goes down the objects' bvh, and at each object it reaches, into that object's
+//	coordinates and down its mesh's bvh -- many objects can share one mesh, and only the
+//	objects' bvh has to change when they move
+//
+//	SetWorld( ) moves an object -- the next Pick( ) refits the objects' bvh to where they went,
+//	which is cheap, but if they wander far from where they were, Build( ) should be done again
+//
+//	the hit says which object, which of its mesh's triangles, and where
+//	Trace( ) does the same for any ray, given as a segment: origin + t*direction, t from 0. to 1.
+//	objects and meshes are known by the numbers AddObject( ) and AddMesh( ) returned
+//
+//	use:
+//		Picker Picking;
+//		int sphere = Picking.AddMesh( surface );		// once for each mesh
+//		Picking.AddObject( sphere, world );			// once for each object
+//		Picking.Build( );
+//		...
+//		Picking.SetWorld( object, world );			// for each one that moved
+//		PickHit hit;
+//		if( Picking.Pick( x, y, projection, modelview, viewport, hit ) )	// y up from the bottom, like gl
+//			...hit.Object...
+
+struct PickHit
+{
+	int		Object;
+	int		Triangle;
+	float		T;			// how far along the ray, 0. at the near plane to 1. at the far plane
+	float		Point[3];		// where, in world coordinates
+};
+
+class Picker
+{
+	friend struct PickObjectRay;
+
+  private:
+	struct PickMesh
+	{
+		std::vector<float>	Xyz;			// 3 per vertex
+		std::vector<GLuint>	Indices;		// 3 per triangle
+		float			Min[3], Max[3];		// around all of it
+		Bvh			Triangles;
+	};
+
+	std::vector<PickMesh>	Meshes;
+
+	// the objects -- entry i of each is object i's:
+
+	std::vector<int>	ObjectMeshes;
+	std::vector<float>	Worlds;			// 16 per object, column-major
+	std::vector<float>	ObjectMin, ObjectMax;	// 3 per object, the boxes around them in world coordinates
+	Bvh			Objects;
+	bool			Moved;			// since the objects' bvh was last fit
+	int			NumBuilt;		// how many objects there were when it was built
+
+	int	NumThreads;			// the most each Build( ) may use
+	int	NodesVisited, TrianglesTested, ObjectsEntered;	// by the last Pick( )
+	double	RefitMs, TraceUs;
+
+	void	FitObject( int );
+
+  public:
+		Picker( );
+
+	int	AddMesh( const float *, size_t, int, const GLuint *, int );
+	int	AddMesh( const struct SurfaceMesh & );
+	int	AddObject( int, const float [16] );
+	void	Build( );
+	void	ClearObjects( );
+	int	GetNumObjects( );
+	bool	Pick( float, float, const float [16], const float [16], const int [4], PickHit & );
+	void	PrintStats( FILE * );
+	void	SetThreads( int );
+	void	SetWorld( int, const float [16] );
+	bool	Trace( const float [3], const float [3], PickHit & );
+};
+
+#endif		// #ifndef PICKER_H
@@ -0,0 +1,838 @@
+#ifndef PIPELINE_CPP
+#define PIPELINE_CPP
+
+#include "pipeline.h"
+
+#include <math.h>
+#include <string.h>
+#include <string>
+
+#include "glm/gtc/type_ptr.hpp"
+
+
+RenderPipeline	Pipeline;
+
+
+RenderPipeline::RenderPipeline( )
+{
+	Mode = WantMode = PIPELINE_FIXED_FUNCTION;
+	CanDoCore = false;
+	DrawIds = -1;
+	PerFragment = false;
+	OwnsMatrices = false;
+	NowProgram = NULL;
+	State = 1;
+
+	// everything starts out the way gl starts out:
+
+	NowMatrixMode = GL_MODELVIEW;
+	ModelView.push_back( glm::mat4( 1. ) );
+	Projection.push_back( glm::mat4( 1. ) );
+
+	Lighting = Texturing = ColorMaterial = FogOn = false;
+	ShadeModelMode = GL_SMOOTH;
+	TexEnv = GL_MODULATE;
+	NowColor = glm::vec4( 1., 1., 1., 1. );
+
+	for( int i = 0; i < PIPELINE_LIGHTS; i++ )
+	{
+		PipelineLight &l = Lights[i];
+		l.On = false;
+		l.Position = glm::vec4( 0., 0., 1., 0. );
+		l.Ambient = glm::vec4( 0., 0., 0., 1. );
+		l.Diffuse = l.Specular = ( i == 0  ?  glm::vec4( 1., 1., 1., 1. )  :  glm::vec4( 0., 0., 0., 1. ) );
+		l.SpotDirection = glm::vec3( 0., 0., -1. );
+		l.SpotExponent = 0.;
+		l.SpotCutoff = 180.;
+		l.Attenuation = glm::vec3( 1., 0., 0. );
+	}
+	SceneAmbient = glm::vec4( 0.2, 0.2, 0.2, 1. );
+
+	MatAmbient  = glm::vec4( 0.2, 0.2, 0.2, 1. );
+	MatDiffuse  = glm::vec4( 0.8, 0.8, 0.8, 1. );
+	MatSpecular = glm::vec4( 0., 0., 0., 1. );
+	MatEmission = glm::vec4( 0., 0., 0., 1. );
+	MatShininess = 0.;
+
+	FogMode = GL_EXP;
+	FogDensity = 1.;
+	FogStart = 0.;
+	FogEnd = 1.;
+	FogColor = glm::vec4( 0., 0., 0., 0. );
+}
+
+
+// start building the shaders -- a window must be open to do this:
+// (every variant Begin( ) can ask for is started now, and built while the fixed-function pipeline draws,
+// so nothing has to wait for a compile in the middle of a frame -- the pooled ones are started by
+// Poll( ), once it knows whether they can use gl_DrawIDARB)
+
+void
+RenderPipeline::Init( )
+{
+	Programs.Init( "pipeline.vert", "pipeline.frag" );
+	Building.clear( );
+	Building.push_back( Programs.Get( "POOLED DRAW_ID" ) );		// whether this one builds says whether gl_DrawIDARB can be used
+	for( int i = 0; i < 4; i++ )
+	{
+		Building.push_back( Programs.Get( Defines( ( i & 1 ) != 0, ( i & 2 ) != 0, false, false ).c_str( ) ) );
+		Building.push_back( Programs.Get( Defines( ( i & 1 ) != 0, ( i & 2 ) != 0, true, false ).c_str( ) ) );
+	}
+}
+
+
+// once a frame -- see how the shaders Init( ) started are coming along, without waiting for them,
+// and switch to the core pipeline when they are all ready, if SetMode( ) asked for it:
+
+void
+RenderPipeline::Poll( )
+{
+	GLSLProgram::PollPending( );
+	if( Building.empty( ) )
+		return;
+	for( int i = 0; i < (int)Building.size( ); i++ )
+	{
+		if( ! Building[i]->IsReady( ) )
+			return;
+	}
+
+	// now it is known which pooled variants to build:
+
+	if( DrawIds < 0 )
+	{
+		DrawIds = Programs.Get( "POOLED DRAW_ID" )->IsValid( )  ?  1  :  0;
+		if( DrawIds == 0 )
+			fprintf( stderr, "Pipeline: no GL_ARB_shader_draw_parameters -- pooled draws find their objects with an instance attribute\n" );
+		Building.clear( );
+		for( int i = 0; i < 4; i++ )
+			Building.push_back( Programs.Get( Defines( ( i & 1 ) != 0, ( i & 2 ) != 0, false, true ).c_str( ) ) );
+		return;
+	}
+
+	Building.clear( );
+	CanDoCore = true;
+	for( int i = 0; i < 4; i++ )
+		CanDoCore = CanDoCore  &&  Programs.Get( Defines( ( i & 1 ) != 0, ( i & 2 ) != 0, false, false ).c_str( ) )->IsValid( );
+
+	if( ! CanDoCore )
+	{
+		fprintf( stderr, "Pipeline: pipeline.vert and pipeline.frag did not build -- only the fixed-function pipeline can be used\n" );
+		WantMode = PIPELINE_FIXED_FUNCTION;
+	}
+	else if( WantMode == PIPELINE_CORE )
+		SetMode( PIPELINE_CORE );
+}
+
+
+int
+RenderPipeline::GetMode( )
+{
+	return Mode;
+}
+
+
+bool
+RenderPipeline::IsCore( )
+{
+	return Mode == PIPELINE_CORE;
+}
+
+
+// switching to the fixed-function pipeline hands gl the matrices that were kept here --
+// everything else gets set again by the next Display( )
+// asking for the core pipeline while its shaders are still being built switches to it when Poll( ) sees them ready:
+
+void
+RenderPipeline::SetMode( int mode )
+{
+	if( mode == PIPELINE_CORE  &&  ! CanDoCore )
+	{
+		if( ! Building.empty( ) )
+			WantMode = mode;
+		else
+			fprintf( stderr, "Pipeline: the core pipeline is not available -- was Init( ) called?\n" );
+		return;
+	}
+	WantMode = mode;
+	if( mode == Mode )
+		return;
+
+	Mode = mode;
+	if( Mode == PIPELINE_FIXED_FUNCTION )
+	{
+		glMatrixMode( GL_PROJECTION );
+		glLoadMatrixf( glm::value_ptr( Projection.back( ) ) );
+		glMatrixMode( GL_MODELVIEW );
+		glLoadMatrixf( glm::value_ptr( ModelView.back( ) ) );
+		glMatrixMode( NowMatrixMode );
+	}
+}
+
+
+void
+RenderPipeline::SetPerFragmentLighting( bool perFragment )
+{
+	PerFragment = perFragment;
+}
+
+
+void
+RenderPipeline::OwnMatrices( bool owns )
+{
+	OwnsMatrices = owns;
+}
+
+
+void
+RenderPipeline::Changed( )
+{
+	State++;
+}
+
+
+// the capabilities that the shader does itself:
+
+bool
+RenderPipeline::IsEmulated( GLenum cap )
+{
+	if( cap >= GL_LIGHT0  &&  cap < GL_LIGHT0 + 8 )
+		return true;
+
+	switch( cap )
+	{
+		case GL_LIGHTING:
+		case GL_TEXTURE_2D:
+		case GL_FOG:
+		case GL_COLOR_MATERIAL:
+		case GL_NORMALIZE:
+			return true;
+
+		default:
+			return false;
+	}
+}
+
+
+void
+RenderPipeline::Enable( GLenum cap )
+{
+	Set( cap, true );
+}
+
+
+void
+RenderPipeline::Disable( GLenum cap )
+{
+	Set( cap, false );
+}
+
+
+void
+RenderPipeline::Set( GLenum cap, bool on )
+{
+	if( IsEmulated( cap ) )
+	{
+		int light = (int)cap - GL_LIGHT0;
+		if( light >= 0  &&  light < PIPELINE_LIGHTS )
+			Lights[light].On = on;
+		else if( cap == GL_LIGHTING )
+			Lighting = on;
+		else if( cap == GL_TEXTURE_2D )
+			Texturing = on;
+		else if( cap == GL_FOG )
+			FogOn = on;
+		else if( cap == GL_COLOR_MATERIAL )
+			ColorMaterial = on;
+		Changed( );
+
+		if( Mode == PIPELINE_CORE )
+			return;
+	}
+
+	GLState.Set( cap, on );
+}
+
+
+// binding a texture is the same in both pipelines:
+
+void
+RenderPipeline::BindTexture( GLenum target, GLuint texture )
+{
+	GLState.BindTexture( target, texture );
+}
+
+
+void
+RenderPipeline::Color( float r, float g, float b, float a )
+{
+	NowColor = glm::vec4( r, g, b, a );
+	if( Mode == PIPELINE_FIXED_FUNCTION )
+		glColor4f( r, g, b, a );
+}
+
+
+void
+RenderPipeline::ShadeModel( GLenum mode )
+{
+	ShadeModelMode = mode;
+	if( Mode == PIPELINE_FIXED_FUNCTION )
+		glShadeModel( mode );
+}
+
+
+void
+RenderPipeline::TexEnvMode( GLint mode )
+{
+	if( mode != TexEnv )
+	{
+		TexEnv = mode;
+		Changed( );
+	}
+	if( Mode == PIPELINE_FIXED_FUNCTION )
+		GLState.TexEnvMode( mode );
+}
+
+
+void
+RenderPipeline::Light( GLenum light, GLenum pname, float f )
+{
+	Light( light, pname, &f );
+}
+
+
+// like gl, positions and spot directions are transformed by the modelview matrix right now:
+
+void
+RenderPipeline::Light( GLenum light, GLenum pname, const float *v )
+{
+	int i = (int)light - GL_LIGHT0;
+	if( i >= 0  &&  i < PIPELINE_LIGHTS )
+	{
+		PipelineLight &l = Lights[i];
+		switch( pname )
+		{
+			case GL_POSITION:
+				l.Position = ModelView.back( ) * glm::vec4( v[0], v[1], v[2], v[3] );
+				break;
+
+			case GL_SPOT_DIRECTION:
+				l.SpotDirection = glm::mat3( ModelView.back( ) ) * glm::vec3( v[0], v[1], v[2] );
+				break;
+
+			case GL_AMBIENT:		l.Ambient  = glm::make_vec4( v );	break;
+			case GL_DIFFUSE:		l.Diffuse  = glm::make_vec4( v );	break;
+			case GL_SPECULAR:		l.Specular = glm::make_vec4( v );	break;
+			case GL_SPOT_EXPONENT:		l.SpotExponent = v[0];			break;
+			case GL_SPOT_CUTOFF:		l.SpotCutoff = v[0];			break;
+			case GL_CONSTANT_ATTENUATION:	l.Attenuation.x = v[0];			break;
+			case GL_LINEAR_ATTENUATION:	l.Attenuation.y = v[0];			break;
+			case GL_QUADRATIC_ATTENUATION:	l.Attenuation.z = v[0];			break;
+		}
+		Changed( );
+	}
+
+	if( Mode == PIPELINE_FIXED_FUNCTION )
+		GLState.Light( light, pname, v, OwnsMatrices  ?  glm::value_ptr( ModelView.back( ) )  :  NULL );
+}
+
+
+void
+RenderPipeline::Material( GLenum face, GLenum pname, float f )
+{
+	Material( face, pname, &f );
+}
+
+
+// two-sided lighting is never on, so only the front material matters to the shader:
+
+void
+RenderPipeline::Material( GLenum face, GLenum pname, const float *v )
+{
+	if( face == GL_FRONT  ||  face == GL_FRONT_AND_BACK )
+	{
+		switch( pname )
+		{
+			case GL_AMBIENT:		MatAmbient = glm::make_vec4( v );		break;
+			case GL_DIFFUSE:		MatDiffuse = glm::make_vec4( v );		break;
+			case GL_AMBIENT_AND_DIFFUSE:	MatAmbient = MatDiffuse = glm::make_vec4( v );	break;
+			case GL_SPECULAR:		MatSpecular = glm::make_vec4( v );		break;
+			case GL_EMISSION:		MatEmission = glm::make_vec4( v );		break;
+			case GL_SHININESS:		MatShininess = v[0];				break;
+		}
+		Changed( );
+	}
+
+	if( Mode == PIPELINE_FIXED_FUNCTION )
+		GLState.Material( face, pname, v );
+}
+
+
+void
+RenderPipeline::Fogi( GLenum pname, GLint i )
+{
+	if( pname == GL_FOG_MODE )
+	{
+		FogMode = i;
+		Changed( );
+	}
+	if( Mode == PIPELINE_FIXED_FUNCTION )
+		glFogi( pname, i );
+}
+
+
+void
+RenderPipeline::Fogf( GLenum pname, float f )
+{
+	switch( pname )
+	{
+		case GL_FOG_MODE:	FogMode = (GLint)f;	break;
+		case GL_FOG_DENSITY:	FogDensity = f;		break;
+		case GL_FOG_START:	FogStart = f;		break;
+		case GL_FOG_END:	FogEnd = f;		break;
+	}
+	Changed( );
+	if( Mode == PIPELINE_FIXED_FUNCTION )
+		glFogf( pname, f );
+}
+
+
+void
+RenderPipeline::Fogfv( GLenum pname, const float *v )
+{
+	if( pname == GL_FOG_COLOR )
+	{
+		FogColor = glm::make_vec4( v );
+		Changed( );
+		if( Mode == PIPELINE_FIXED_FUNCTION )
+			glFogfv( pname, v );
+	}
+	else
+		Fogf( pname, v[0] );
+}
+
+
+// the matrices -- always kept here, and also handed to gl when it is doing the drawing:
+
+glm::mat4 &
+RenderPipeline::Top( )
+{
+	return NowMatrixMode == GL_PROJECTION  ?  Projection.back( )  :  ModelView.back( );
+}
+
+
+void
+RenderPipeline::MatrixMode( GLenum mode )
+{
+	NowMatrixMode = mode;
+	if( Mode == PIPELINE_FIXED_FUNCTION )
+		glMatrixMode( mode );
+}
+
+
+void
+RenderPipeline::PushMatrix( )
+{
+	std::vector<glm::mat4> &stack = ( NowMatrixMode == GL_PROJECTION  ?  Projection  :  ModelView );
+	stack.push_back( stack.back( ) );
+	if( Mode == PIPELINE_FIXED_FUNCTION )
+		glPushMatrix( );
+}
+
+
+void
+RenderPipeline::PopMatrix( )
+{
+	std::vector<glm::mat4> &stack = ( NowMatrixMode == GL_PROJECTION  ?  Projection  :  ModelView );
+	if( stack.size( ) > 1 )
+		stack.pop_back( );
+	else
+		fprintf( stderr, "Pipeline: PopMatrix( ) with nothing pushed\n" );
+	if( Mode == PIPELINE_FIXED_FUNCTION )
+		glPopMatrix( );
+}
+
+
+void
+RenderPipeline::LoadIdentity( )
+{
+	Top( ) = glm::mat4( 1. );
+	if( Mode == PIPELINE_FIXED_FUNCTION )
+		glLoadIdentity( );
+}
+
+
+void
+RenderPipeline::LoadMatrix( const glm::mat4 &m )
+{
+	Top( ) = m;
+	if( Mode == PIPELINE_FIXED_FUNCTION )
+		glLoadMatrixf( glm::value_ptr( m ) );
+}
+
+
+void
+RenderPipeline::LoadMatrix( const float *m )
+{
+	LoadMatrix( glm::make_mat4( m ) );
+}
+
+
+void
+RenderPipeline::MultMatrix( const glm::mat4 &m )
+{
+	Top( ) = Top( ) * m;
+	if( Mode == PIPELINE_FIXED_FUNCTION )
+		glMultMatrixf( glm::value_ptr( m ) );
+}
+
+
+void
+RenderPipeline::Rotate( float degrees, float x, float y, float z )
+{
+	Top( ) = glm::rotate( Top( ), glm::radians( degrees ), glm::vec3( x, y, z ) );
+	if( Mode == PIPELINE_FIXED_FUNCTION )
+		glRotatef( degrees, x, y, z );
+}
+
+
+void
+RenderPipeline::Scale( float x, float y, float z )
+{
+	Top( ) = glm::scale( Top( ), glm::vec3( x, y, z ) );
+	if( Mode == PIPELINE_FIXED_FUNCTION )
+		glScalef( x, y, z );
+}
+
+
+void
+RenderPipeline::Translate( float x, float y, float z )
+{
+	Top( ) = glm::translate( Top( ), glm::vec3( x, y, z ) );
+	if( Mode == PIPELINE_FIXED_FUNCTION )
+		glTranslatef( x, y, z );
+}
+
+
+void
+RenderPipeline::LookAt( float ex, float ey, float ez,  float lx, float ly, float lz,  float ux, float uy, float uz )
+{
+	Top( ) = Top( ) * glm::lookAt( glm::vec3( ex, ey, ez ), glm::vec3( lx, ly, lz ), glm::vec3( ux, uy, uz ) );
+	if( Mode == PIPELINE_FIXED_FUNCTION )
+		gluLookAt( ex, ey, ez,  lx, ly, lz,  ux, uy, uz );
+}
+
+
+void
+RenderPipeline::Ortho( float left, float right, float bottom, float top, float zNear, float zFar )
+{
+	Top( ) = Top( ) * glm::ortho( left, right, bottom, top, zNear, zFar );
+	if( Mode == PIPELINE_FIXED_FUNCTION )
+		glOrtho( left, right, bottom, top, zNear, zFar );
+}
+
+
+void
+RenderPipeline::Ortho2D( float left, float right, float bottom, float top )
+{
+	Top( ) = Top( ) * glm::ortho( left, right, bottom, top, -1.f, 1.f );
+	if( Mode == PIPELINE_FIXED_FUNCTION )
+		gluOrtho2D( left, right, bottom, top );
+}
+
+
+void
+RenderPipeline::Perspective( float fovy, float aspect, float zNear, float zFar )
+{
+	Top( ) = Top( ) * glm::perspective( glm::radians( fovy ), aspect, zNear, zFar );
+	if( Mode == PIPELINE_FIXED_FUNCTION )
+		gluPerspective( fovy, aspect, zNear, zFar );
+}
+
+
+// what code that used to ask gl for its matrices should ask instead:
+// (in the fixed-function pipeline, gl is asked, since someone might have changed them directly)
+
+void
+RenderPipeline::GetFloatv( GLenum pname, float *v )
+{
+	if( Mode == PIPELINE_CORE  &&  pname == GL_MODELVIEW_MATRIX )
+		memcpy( v, glm::value_ptr( ModelView.back( ) ), 16*sizeof(float) );
+	else if( Mode == PIPELINE_CORE  &&  pname == GL_PROJECTION_MATRIX )
+		memcpy( v, glm::value_ptr( Projection.back( ) ), 16*sizeof(float) );
+	else
+		glGetFloatv( pname, v );
+}
+
+
+// get ready to draw something -- in the core pipeline, this binds the shader and gives it the state
+// unlit is for things like lines, which are never lit or textured
+// instanced is for DrawInstanced( ), whose shader reads a world matrix per instance
+// pooled is for GeometryPool::Draw( ), whose shader reads a world matrix and a texture layer per draw
+// returns false in the fixed-function pipeline, where there is nothing to do:
+
+bool
+RenderPipeline::Begin( bool unlit, bool instanced, bool pooled )
+{
+	if( Mode != PIPELINE_CORE )
+		return false;
+
+	NowProgram = Programs.Get( Defines( ShadeModelMode == GL_FLAT, PerFragment, instanced, pooled ).c_str( ) );
+	NowProgram->Use( );
+	UploadState( NowProgram, unlit );
+
+	// what a mesh without colors or normals gets, like the current glColor( ) and glNormal( ):
+
+	glVertexAttrib4fv( MESH_COLOR, glm::value_ptr( NowColor ) );
+	glVertexAttrib3f( MESH_NORMAL, 0., 0., 1. );
+	return true;
+}
+
+
+// the variant of the shaders that draws this way:
+
+std::string
+RenderPipeline::Defines( bool flat, bool perFragment, bool instanced, bool pooled )
+{
+	std::string defines;
+	if( flat )
+		defines += "FLAT ";
+	if( perFragment )
+		defines += "PER_FRAGMENT ";
+	if( instanced )
+		defines += "INSTANCED ";
+	if( pooled )
+		defines += CanDrawIds( )  ?  "POOLED DRAW_ID"  :  "POOLED";
+	return defines;
+}
+
+
+// can the "POOLED" shader use gl_DrawIDARB? (Poll( ) finds out, before the core pipeline is ever used)
+
+bool
+RenderPipeline::CanDrawIds( )
+{
+	return DrawIds == 1;
+}
+
+
+void
+RenderPipeline::End( )
+{
+	if( NowProgram != NULL )
+		NowProgram->UnUse( );
+	NowProgram = NULL;
+}
+
+
+void
+RenderPipeline::Draw( Mesh *mesh )
+{
+	bool core = Begin( );
+	mesh->Draw( );
+	if( core )
+		End( );
+}
+
+
+// every instance of a mesh, each with its own world matrix:
+// returns false in the fixed-function pipeline, which has to draw them one at a time instead
+
+bool
+RenderPipeline::DrawInstanced( Mesh *mesh, int instances )
+{
+	if( ! Begin( false, true ) )
+		return false;
+	mesh->DrawInstanced( instances );
+	End( );
+	return true;
+}
+
+
+// a program's uniform handles -- looked up once, the first time it draws:
+
+RenderPipeline::PipelineUniforms &
+RenderPipeline::GetUniforms( GLSLProgram *p )
+{
+	std::map<GLSLProgram *, PipelineUniforms>::iterator it = Uploaded.find( p );
+	if( it != Uploaded.end( ) )
+		return it->second;
+
+	PipelineUniforms &u = Uploaded[p];
+	u.State = 0;				// State starts at 1, so the first draw sends everything
+	u.ModelView     = p->GetUniform<glm::mat4>( "uModelView" );
+	u.Projection    = p->GetUniform<glm::mat4>( "uProjection" );
+	u.NormalMatrix  = p->GetUniform<glm::mat3>( "uNormalMatrix" );
+	u.Lighting      = p->GetUniform<int>( "uLighting" );
+	u.Texturing     = p->GetUniform<int>( "uTexturing" );
+
+	u.LightOn       = p->GetUniform<int>( "uLightOn" );
+	u.LightPosition = p->GetUniform<glm::vec4>( "uLightPosition" );
+	u.LightAmbient  = p->GetUniform<glm::vec4>( "uLightAmbient" );
+	u.LightDiffuse  = p->GetUniform<glm::vec4>( "uLightDiffuse" );
+	u.LightSpecular = p->GetUniform<glm::vec4>( "uLightSpecular" );
+	u.SpotDirection = p->GetUniform<glm::vec3>( "uSpotDirection" );
+	u.SpotExponent  = p->GetUniform<float>( "uSpotExponent" );
+	u.SpotCutoff    = p->GetUniform<float>( "uSpotCutoff" );
+	u.Attenuation   = p->GetUniform<glm::vec3>( "uAttenuation" );
+	u.SceneAmbient  = p->GetUniform<glm::vec4>( "uSceneAmbient" );
+
+	u.ColorMaterial = p->GetUniform<int>( "uColorMaterial" );
+	u.MatAmbient    = p->GetUniform<glm::vec4>( "uMatAmbient" );
+	u.MatDiffuse    = p->GetUniform<glm::vec4>( "uMatDiffuse" );
+	u.MatSpecular   = p->GetUniform<glm::vec4>( "uMatSpecular" );
+	u.MatEmission   = p->GetUniform<glm::vec4>( "uMatEmission" );
+	u.MatShininess  = p->GetUniform<float>( "uMatShininess" );
+
+	u.TexUnit       = p->GetUniform<int>( "uTexUnit" );
+	u.TexLayers     = p->GetUniform<int>( "uTexLayers" );
+	u.Draws         = p->GetUniform<int>( "uDraws" );
+	u.TexReplace    = p->GetUniform<int>( "uTexReplace" );
+
+	u.FogMode       = p->GetUniform<int>( "uFogMode" );
+	u.FogColor      = p->GetUniform<glm::vec4>( "uFogColor" );
+	u.FogDensity    = p->GetUniform<float>( "uFogDensity" );
+	u.FogStart      = p->GetUniform<float>( "uFogStart" );
+	u.FogEnd        = p->GetUniform<float>( "uFogEnd" );
+	return u;
+}
+
+
+// the matrices go with every draw, but the lights, material, and fog are only sent
+// the first time a program is used after one of them was set:
+// (a program that is still being built draws with the fallback, and has nothing to look up yet)
+
+void
+RenderPipeline::UploadState( GLSLProgram *p, bool unlit )
+{
+	if( ! p->IsReady( ) )
+		return;
+
+	PipelineUniforms &u = GetUniforms( p );
+	glm::mat4 &mv = ModelView.back( );
+	u.ModelView.Set( mv );
+	u.Projection.Set( Projection.back( ) );
+	u.NormalMatrix.Set( glm::transpose( glm::inverse( glm::mat3( mv ) ) ) );
+	u.Lighting.Set( ( Lighting  &&  ! unlit ) ? 1 : 0 );
+	u.Texturing.Set( ( Texturing  &&  ! unlit ) ? 1 : 0 );
+
+	if( u.State == State )
+		return;
+	u.State = State;
+
+	int on[PIPELINE_LIGHTS];
+	glm::vec4 position[PIPELINE_LIGHTS], ambient[PIPELINE_LIGHTS], diffuse[PIPELINE_LIGHTS], specular[PIPELINE_LIGHTS];
+	glm::vec3 direction[PIPELINE_LIGHTS], attenuation[PIPELINE_LIGHTS];
+	float exponent[PIPELINE_LIGHTS], cutoff[PIPELINE_LIGHTS];
+	for( int i = 0; i < PIPELINE_LIGHTS; i++ )
+	{
+		on[i] = Lights[i].On ? 1 : 0;
+		position[i] = Lights[i].Position;
+		ambient[i] = Lights[i].Ambient;
+		diffuse[i] = Lights[i].Diffuse;
+		specular[i] = Lights[i].Specular;
+		direction[i] = Lights[i].SpotDirection;
+		attenuation[i] = Lights[i].Attenuation;
+		exponent[i] = Lights[i].SpotExponent;
+		cutoff[i] = Lights[i].SpotCutoff;
+	}
+	u.LightOn.Set( on, PIPELINE_LIGHTS );
+	u.LightPosition.Set( position, PIPELINE_LIGHTS );
+	u.LightAmbient.Set( ambient, PIPELINE_LIGHTS );
+	u.LightDiffuse.Set( diffuse, PIPELINE_LIGHTS );
+	u.LightSpecular.Set( specular, PIPELINE_LIGHTS );
+	u.SpotDirection.Set( direction, PIPELINE_LIGHTS );
+	u.SpotExponent.Set( exponent, PIPELINE_LIGHTS );
+	u.SpotCutoff.Set( cutoff, PIPELINE_LIGHTS );
+	u.Attenuation.Set( attenuation, PIPELINE_LIGHTS );
+	u.SceneAmbient.Set( SceneAmbient );
+
+	u.ColorMaterial.Set( ColorMaterial ? 1 : 0 );
+	u.MatAmbient.Set( MatAmbient );
+	u.MatDiffuse.Set( MatDiffuse );
+	u.MatSpecular.Set( MatSpecular );
+	u.MatEmission.Set( MatEmission );
+	u.MatShininess.Set( MatShininess );
+
+	u.TexUnit.Set( 0 );
+	u.TexLayers.Set( PIPELINE_LAYERS_UNIT );
+	u.Draws.Set( PIPELINE_DRAWS_UNIT );
+	u.TexReplace.Set( TexEnv == GL_REPLACE ? 1 : 0 );
+
+	int fog = 0;
+	if( FogOn )
+	{
+		switch( FogMode )
+		{
+			case GL_LINEAR:	fog = 1;	break;
+			case GL_EXP:	fog = 2;	break;
+			case GL_EXP2:	fog = 3;	break;
+		}
+	}
+	u.FogMode.Set( fog );
+	u.FogColor.Set( FogColor );
+	u.FogDensity.Set( FogDensity );
+	u.FogStart.Set( FogStart );
+	u.FogEnd.Set( FogEnd );
+}
+
+
+// draw the same frame with both pipelines and compare them:
+//	draw( ) draws one frame into the back buffer, without swapping
+//	returns the fraction of the pixels where some component differs by more than tolerance (0-255),
+//	or -1. if the core pipeline is not there to compare
+
+float
+RenderPipeline::SelfCheck( void (*draw)( ), int tolerance )
+{
+	if( ! CanDoCore )
+	{
+		fprintf( stderr, "Pipeline: the core pipeline is not available, so there is nothing to check\n" );
+		return -1.;
+	}
+
+	int was = Mode;
+	GLint viewport[4];
+	std::vector<GLubyte> images[2];
+	GLboolean doubleBuffered = GL_FALSE;
+	glGetBooleanv( GL_DOUBLEBUFFER, &doubleBuffered );
+	GLint framebuffer = 0;
+	glGetIntegerv( GL_READ_FRAMEBUFFER_BINDING, &framebuffer );	// drawing into a texture reads from it instead
+	for( int pass = 0; pass < 2; pass++ )
+	{
+		SetMode( pass == 0  ?  PIPELINE_FIXED_FUNCTION  :  PIPELINE_CORE );
+		( *draw )( );
+
+		glGetIntegerv( GL_VIEWPORT, viewport );
+		images[pass].resize( 4 * viewport[2] * viewport[3] );
+		if( framebuffer == 0 )
+			glReadBuffer( doubleBuffered ? GL_BACK : GL_FRONT );
+		glPixelStorei( GL_PACK_ALIGNMENT, 1 );
+		glReadPixels( viewport[0], viewport[1], viewport[2], viewport[3], GL_RGBA, GL_UNSIGNED_BYTE, &images[pass][0] );
+	}
+	SetMode( was );
+
+	int numPixels = viewport[2] * viewport[3];
+	int different = 0;
+	int worst = 0;
+	for( int i = 0; i < numPixels; i++ )
+	{
+		int most = 0;
+		for( int c = 0; c < 3; c++ )
+		{
+			int d = abs( (int)images[0][4*i+c] - (int)images[1][4*i+c] );
+			if( d > most )
+				most = d;
+		}
+		if( most > tolerance )
+			different++;
+		if( most > worst )
+			worst = most;
+	}
+
+	float fraction = numPixels > 0  ?  (float)different / (float)numPixels  :  0.f;
+	fprintf( stderr, "Pipeline: core vs. fixed-function -- %d of %d pixels (%.2f%%) differ by more than %d, the worst by %d\n",
+		different, numPixels, 100.f * fraction, tolerance, worst );
+	return fraction;
+}
+
+#endif		// #ifndef PIPELINE_CPP
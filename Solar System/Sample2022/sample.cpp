@@ -1,6 +1,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <ctype.h>
+#include <algorithm>
 
 #define _USE_MATH_DEFINES
 #include <math.h>
@@ -96,6 +97,46 @@ enum Projections
 	PERSP
 };
 
+// the pipeline menu:
+
+enum PipelineChoices
+{
+	FIXED_FUNCTION,
+	CORE,
+	CORE_PER_PIXEL,
+	SELF_CHECK
+};
+
+// the scene graph menu -- how many moons each planet gets:
+
+enum SceneChoices
+{
+	SCENE_PLANETS,
+	SCENE_MOONS,
+	SCENE_STRESS
+};
+
+struct SceneSize
+{
+	int	Moons;			// per planet
+	int	Satellites;		// per moon
+};
+
+const SceneSize SceneSizes[ ] =
+{
+	{    0, 0 },		// SCENE_PLANETS
+	{  250, 4 },		// SCENE_MOONS:   2,000 moons,  8,000 satellites, about 20,000 nodes
+	{ 1250, 4 },		// SCENE_STRESS: 10,000 moons, 40,000 satellites, about 100,000 nodes
+};
+
+// the sun and the planets -- the moons and satellites are made up by MakeSolarSystem( ):
+
+const char *SCENEFILE = "solarsystem.txt";
+
+// how often the scene graph reports how it is doing, in frames:
+
+const int SCENE_REPORT = 100;
+
 // which button:
 
 enum ButtonVals
@@ -186,7 +227,6 @@ const int MS_PER_CYCLE = 10000;		// 10000 milliseconds = 10 seconds
 // non-constant global variables:
 
 int		ActiveButton;			// current button that is down
-GLuint	AxesList;				// list to hold the axes
 int		AxesOn;					// != 0 means to draw the axes
 GLuint	BoxList;				// object display list
 GLuint	CyList;					// object display list
@@ -194,9 +234,12 @@ int		DebugOn;				// != 0 means to print debugging info
 int		DepthCueOn;				// != 0 means to use intensity depth cueing
 int		DepthBufferOn;			// != 0 means to use the z-buffer
 int		DepthFightingOn;		// != 0 means to force the creation of z-fighting
+int		Frozen;					// != 0 means the animation is stopped
 int		MainWindow;				// window id for main graphics window
 int		NowColor;				// index into Colors[ ]
+int		NowScene;				// SCENE_PLANETS, SCENE_MOONS, or SCENE_STRESS
 int		NowProjection;		// ORTHO or PERSP
+int		PipelineCheck;			// != 0 means to compare the two pipelines on the next Display( )
 float	Scale;					// scaling factor
 int		ShadowsOn;				// != 0 means to turn shadows on
 float	Time;					// used for animation, this has a value between 0. and 1.
@@ -207,6 +250,7 @@ float	Xrot, Yrot;				// rotation angles in degrees
 // function prototypes:
 
 void	Animate( );
+void	CaptureFrame( int );
 void	Display( );
 void	DoAxesMenu( int );
 void	DoColorMenu( int );
@@ -215,18 +259,27 @@ void	DoDepthFightingMenu( int );
 void	DoDepthMenu( int );
 void	DoDebugMenu( int );
 void	DoMainMenu( int );
+void	DoPipelineMenu( int );
 void	DoProjectMenu( int );
+void	DoSceneMenu( int );
 void	DoRasterString( float, float, float, char * );
 void	DoStrokeString( float, float, float, float, char * );
+void	DrawScene( );
 float	ElapsedSeconds( );
+void	FitMoonTree( bool );
 void	InitGraphics( );
 void	InitLists( );
 void	InitMenus( );
 void	Keyboard( unsigned char, int, int );
+GLuint	LoadTexture( const char * );
+void	MakeSolarSystem( int, int );
 void	MouseButton( int, int, int, int );
 void	MouseMotion( int, int );
+void	PickBody( int, int );
+void	PrepareFrame( int );
 void	Reset( );
 void	Resize( int, int );
+void	UpdateSolarSystem( int );
 void	Visibility( int );
 
 void			Axes( float );
@@ -235,21 +288,16 @@ void			Cross(float[3], float[3], float[3]);
 float			Dot(float [3], float [3]);
 float			Unit(float [3], float [3]);
 float			Unit(float [3]);
+float			Ranf( float, float );
 
 int		catDL;
 int		duckDL;
 int		bunnyDL;
-int		GridDL;
 int		colorNum;
 int		lightType;
 
-int		SphereDL, MarsDL, VenusDL, EarthDL, JupiterDL, SaturnDL, UranusDL, NeptuneDL, MercuryDL, SunDL;	// display lists
-GLuint		MarsTex, VenusTex, EarthTex, JupiterTex, SaturnTex, UranusTex, NeptuneTex, MercuryTex, SunTex;		// texture object
-int		me_SphereDL, v_SphereDL, e_SphereDL, ma_SphereDL, j_SphereDL, s_SphereDL, u_SphereDL, n_SphereDL, su_SphereDL;
-int		Mer_C, Ven_C, Ear_C, Jup_C, Sat_C, Ura_C, Nep_C, Mar_C;
-
 int		textureMode = 1;
-int		lightingMode = 1;
+int		lightingMode = 2;
 int		texMode = 1;
 
 
@@ -298,6 +346,8 @@ MulArray3(float factor, float a, float b, float c )
 
 // these are here for when you need them -- just uncomment the ones you need:
 
+#include "gldebug.cpp"
+#include "glstate.cpp"
 #include "setmaterial.cpp"
 #include "setlight.cpp"
 #include "osusphere.cpp"
@@ -307,8 +357,97 @@ MulArray3(float factor, float a, float b, float c )
 #include "loadobjfile.cpp"
 #include "keytime.cpp"
 #include "glslprogram.cpp"
+#include "grid.cpp"
+#include "linebatch.cpp"
+#include "geometrypool.cpp"
+#include "pipeline.cpp"
+#include "scenegraph.cpp"
+#include "bodies.cpp"
+#include "picker.cpp"
+#include "spheretree.cpp"
+#include "streambuffer.cpp"
+#include "frameworker.cpp"
 #include "CarouselHorse0.10.550"
 
+Grid		Floor;				// the floor
+LineBatch	Lines;				// the axes, orbits, and stroke text, drawn together
+GeometryPool	Pool;				// the planets, all in one draw
+int		PoolPlanet;			// Pool's copy of PlanetMesh
+Mesh		PlanetMesh;			// a unit sphere that every planet is a scaled copy of
+Mesh		MoonMesh;			// a coarser one for the moons and satellites, which are drawn as instances
+
+// the bodies -- the sun, the planets, and their moons and satellites -- and the scene graph that
+// places them -- each body hangs from an orbit node that turns around what it goes around:
+
+BodyStore		Bodies;
+std::vector<int>	LitBodies;		// the planets, drawn through the geometry pool
+std::vector<int>	LitLayers;		// ... and the pool's texture layer for each
+std::vector<int>	GlowingBodies;		// the sun
+std::vector<int>	RingBodies;		// the ones whose orbits are drawn
+SceneGraph		Solar;
+float			SceneTime;		// the Time the scene graph was last moved to
+int			ReportFrames;
+int			ReportStartMs;
+
+// frustum culling -- the moons and satellites are culled by a tree of their bounding spheres, and
+// the sun, the planets, and the orbits one at a time:
+
+Frustum			View;			// in world coordinates, as of the frame being prepared
+SphereTree		MoonTree;		// by instance
+std::vector<int>	VisibleMoons;
+StreamBuffer		MoonStream;		// their world matrices, written straight in every frame
+
+// picking -- a left click that does not drag picks the body under the cursor, with the matrices
+// and the viewport that Display( ) last drew with:
+
+Picker			Picking;		// object i is body i
+int			PickPlanetMesh;		// Picking's copies of PlanetMesh's and MoonMesh's triangles
+int			PickMoonMesh;
+int			Picked;			// the body, or NO_BODY
+int			ClickX, ClickY;		// where the left button went down
+float			PickProjection[16], PickModelview[16];
+int			PickViewport[4];
+
+// the frame pipeline -- the worker moves the scene graph, culls, and sorts the next frame into a
+// packet while Display( ) draws this one from the other packet (see frameworker.h)
+// while a packet is being prepared, the worker owns Solar, MoonTree, View, and the scene report --
+// anything on the gl thread that uses them has to Frames.Wait( ) first:
+
+struct BodyDraw
+{
+	int		Body;
+	int		Layer;			// in Pool's texture array
+	float		Depth;			// in front of the eye, to sort by
+	glm::mat4	World;
+};
+
+struct FramePacket
+{
+	// captured on the gl thread, by CaptureFrame( ):
+
+	float			Time;
+	glm::mat4		Projection, Modelview;
+	int			Picked;
+	int			Debug;
+	int			Scene;
+	int			Ms;			// glut's elapsed time, for the scene report
+
+	// prepared on the worker, by PrepareFrame( ) -- each list in the order to draw it:
+
+	std::vector<BodyDraw>	Planets;		// front to back
+	std::vector<BodyDraw>	Suns;
+	std::vector<glm::mat4>	Moons;			// front to back
+	std::vector<std::pair<float,int> >	MoonOrder;	// (depth, instance), to sort them
+	std::vector<glm::vec4>	Orbits;			// center and radius of each one in view
+	bool			HasRing;		// around the picked body
+	glm::vec4		Ring;
+	bool			Report;			// the worker printed the scene report, so the gl thread prints its part
+};
+
+FramePacket		Packets[FRAME_PACKETS];
+FrameWorker		Frames;
+int			NowPacket;		// the one being drawn
+
 
 // main program:
 
@@ -338,6 +477,11 @@ main( int argc, char *argv[ ] )
 
 	InitMenus( );
 
+	// start the worker that gets each frame ready while the one before it is drawn:
+	// (unless there is only the one processor to run them both on)
+
+	Frames.Start( CaptureFrame, PrepareFrame, std::thread::hardware_concurrency( ) != 1 );
+
 	// draw the scene once and wait for some interaction:
 	// (this will never return)
 
@@ -389,20 +533,72 @@ Display( )
 	// set which window we want to do the graphics into:
 	glutSetWindow( MainWindow );
 
+	// the core pipeline's shaders are built in the background -- it is switched to when they are ready:
+
+	Pipeline.Poll( );
+
+	// the packet the worker got ready while the last frame was drawn -- it starts on the next one now:
+
+	NowPacket = Frames.Next( );
+
+	// the self-check draws the frame once with each pipeline first, and says how different they are:
+
+	if( PipelineCheck != 0 )
+	{
+		PipelineCheck = 0;
+		Pipeline.SelfCheck( DrawScene );
+	}
+
+	DrawScene( );
+
+	// swap the double-buffered framebuffers:
+
+	glutSwapBuffers( );
+
+	if( DebugOn != 0 )
+	{
+		GLState.PrintStats( stderr );
+		GLDEBUG_PRINT( stderr );
+	}
+
+	// be sure the graphics buffer has been sent:
+	// note: be sure to use glFlush( ) here, not glFinish( ) !
+
+	glFlush( );
+}
+
+
+// draw one frame into the back buffer, with whichever pipeline is on:
+
+void
+DrawScene( )
+{
+	// each part of the frame is a debug group, so gl debuggers show where the time and the errors went:
+	// (in a GLDEBUG build only -- see gldebug.h)
+
+	GLDEBUG_PUSH( "Setup" );
+
 	// erase the background:
 	glDrawBuffer( GL_BACK );
 	glClear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT );
 
-	glEnable( GL_DEPTH_TEST );
+	// the enables, texture environment, light, and materials all go through the pipeline, and from
+	// there the state cache, which skips the ones that are already set -- in debug mode, it also
+	// checks itself against gl:
+
+	GLState.SetVerify( DebugOn != 0 );
+	GLState.ResetCounters( );
+
+	Pipeline.Enable( GL_DEPTH_TEST );
 #ifdef DEMO_DEPTH_BUFFER
 	if( DepthBufferOn == 0 )
-		glDisable( GL_DEPTH_TEST );
+		Pipeline.Disable( GL_DEPTH_TEST );
 #endif
 
 
 	// specify shading to be flat:
 
-	glShadeModel( GL_FLAT );
+	Pipeline.ShadeModel( GL_FLAT );
 
 	// set the viewport to be a square centered in the window:
 
@@ -412,227 +608,203 @@ Display( )
 	GLint xl = ( vx - v ) / 2;
 	GLint yb = ( vy - v ) / 2;
 	glViewport( xl, yb,  v, v );
+	PickViewport[0] = xl;
+	PickViewport[1] = yb;
+	PickViewport[2] = PickViewport[3] = v;
 
 
-	// set the viewing volume:
-	// remember that the Z clipping  values are given as DISTANCES IN FRONT OF THE EYE
-	// USE gluOrtho2D( ) IF YOU ARE DOING 2D !
-
-	glMatrixMode( GL_PROJECTION );
-	glLoadIdentity( );
-	if( NowProjection == ORTHO )
-		glOrtho( -2.f, 2.f,     -2.f, 2.f,     0.1f, 1000.f );
-	else
-		gluPerspective( 70.f, 1.f,	0.1f, 1000.f );
-
-	// place the objects into the scene:
-
-	glMatrixMode( GL_MODELVIEW );
-	glLoadIdentity( );
+	// the viewing volume and the viewing transformation are the ones the packet was culled with
+	// (see CaptureFrame( )):
 
-	// set the eye position, look-at position, and up-vector:
-
-	gluLookAt( 2.f, 2.f, 4.f,     0.f, 0.f, 0.f,     0.f, 1.f, 0.f );
-
-	// rotate the scene:
-
-	glRotatef( (GLfloat)Yrot, 0.f, 1.f, 0.f );
-	glRotatef( (GLfloat)Xrot, 1.f, 0.f, 0.f );
-
-	// uniformly scale the scene:
-
-	if( Scale < MINSCALE )
-		Scale = MINSCALE;
-	glScalef( (GLfloat)Scale, (GLfloat)Scale, (GLfloat)Scale );
+	const FramePacket &packet = Packets[NowPacket];
+	Pipeline.MatrixMode( GL_PROJECTION );
+	Pipeline.LoadMatrix( packet.Projection );
+	Pipeline.MatrixMode( GL_MODELVIEW );
+	Pipeline.LoadMatrix( packet.Modelview );
+	for( int i = 0; i < 16; i++ )
+	{
+		PickProjection[i] = glm::value_ptr( packet.Projection )[i];
+		PickModelview[i] = glm::value_ptr( packet.Modelview )[i];
+	}
 
 	// set the fog parameters:
 
 	if( DepthCueOn != 0 )
 	{
-		glFogi( GL_FOG_MODE, FOGMODE );
-		glFogfv( GL_FOG_COLOR, FOGCOLOR );
-		glFogf( GL_FOG_DENSITY, FOGDENSITY );
-		glFogf( GL_FOG_START, FOGSTART );
-		glFogf( GL_FOG_END, FOGEND );
-		glEnable( GL_FOG );
+		Pipeline.Fogi( GL_FOG_MODE, FOGMODE );
+		Pipeline.Fogfv( GL_FOG_COLOR, FOGCOLOR );
+		Pipeline.Fogf( GL_FOG_DENSITY, FOGDENSITY );
+		Pipeline.Fogf( GL_FOG_START, FOGSTART );
+		Pipeline.Fogf( GL_FOG_END, FOGEND );
+		Pipeline.Enable( GL_FOG );
 	}
 	else
 	{
-		glDisable( GL_FOG );
+		Pipeline.Disable( GL_FOG );
 	}
 
 	// possibly draw the axes:
 
+	// (they go into the line batch, which is drawn with the orbits below)
+
+	Lines.Begin( );
 	if( AxesOn != 0 )
 	{
-		glColor3fv( &Colors[NowColor][0] );
-		glCallList( AxesList );
+		Lines.SetColor( &Colors[NowColor][0] );
+		Lines.SetLineWidth( AXES_WIDTH );
+		Axes( 1.5 );
+		Lines.SetLineWidth( 1. );
 	}
 
-	// since we are using glScalef( ), be sure the normals get unitized:
+	// since we are using Pipeline.Scale( ), be sure the normals get unitized:
 
-	glEnable( GL_NORMALIZE );
+	Pipeline.Enable( GL_NORMALIZE );
 
 
 	// draw the box object by calling up its display list:
 
 	//glCallList( BoxList );
 
-	float radius = 2.0;
-	float theta = 0.f;
-	float deltaTheta = 0.01f;
-
-	float x = radius * cos(45 * Time);
-	float z = radius * sin(45 * Time);
-
 	float r = 1.;
 	float g = 1.;
 	float b = 0.3;
 
-	//glCallList( GridDL );
+	//SetMaterial( 0.6f, 0.6f, 0.6f, 30.f );
+	//Floor.Draw( );
 
 	// Texture Stuff -------------------------------------------------------------------------------------
 	if ( textureMode == 1 )
-		glEnable(GL_TEXTURE_2D);
+		Pipeline.Enable(GL_TEXTURE_2D);
 	else
-		glDisable(GL_TEXTURE_2D);
+		Pipeline.Disable(GL_TEXTURE_2D);
 
 
 	GLfloat ambientColor[] = { 0, 0, 0, 1.0f };
 	GLfloat diffuseColor[] = { r, g, b, 1.0f };
 	GLfloat specularColor[] = { 1.0f, 1.0f, 1.0f, 1.0f };  
 
-	glLightfv(GL_LIGHT0, GL_AMBIENT, ambientColor);
-	glLightfv(GL_LIGHT0, GL_DIFFUSE, diffuseColor);
-	glLightfv(GL_LIGHT0, GL_SPECULAR, specularColor);
+	Pipeline.Light(GL_LIGHT0, GL_AMBIENT, ambientColor);
+	Pipeline.Light(GL_LIGHT0, GL_DIFFUSE, diffuseColor);
+	Pipeline.Light(GL_LIGHT0, GL_SPECULAR, specularColor);
 	GLfloat lightPosition[] = { 0.0f, 0.0f, 0.0f, 1.0f };
-	glLightfv(GL_LIGHT0, GL_POSITION, lightPosition);
+	Pipeline.Light(GL_LIGHT0, GL_POSITION, lightPosition);
 
-	glEnable(GL_LIGHT0);
+	Pipeline.Enable(GL_LIGHT0);
 	SetPointLight(GL_LIGHT0, 0, 0, 0, r, g, b);
-	lightingMode = 2;
 	if (lightingMode == 1)
 	{
-		glDisable(GL_LIGHTING);
-		glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_REPLACE);
+		Pipeline.Disable(GL_LIGHTING);
+		Pipeline.TexEnvMode(GL_REPLACE);
 	}
 	else
 	{
-		glEnable(GL_LIGHTING);
-		glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+		Pipeline.Enable(GL_LIGHTING);
+		Pipeline.TexEnvMode(GL_MODULATE);
 	}
 
-	float theta2 = 90 + Time * (360.f);
-
-	// Calculate the angle based on time and speed
-	float angle = -6 * Time;
-
-	// Calculate the position of the horse on the circle
-	x = 2. * cos(angle);
-	z = 2. * sin(angle);
-
-	// Calculate the horse's orientation angle (to make it face forward)
-	//float horseAngle = 360 * Time;
-
-	float slow_time = Time * 5;
-	float radius_scale = -0.5;
-	float slow_time_2 = Time * 0.01;
-
-	// Call the display list with the updated translation
-	glPushMatrix(); // Push the current matrix
-	glRotatef(360.f * slow_time, 0, 1, 0); // Rotation around the sun
-	glTranslatef(0., 0., (0.35f * radius_scale) - 1);
-	glRotatef(360.f * slow_time_2, 0, 1, 0);// Rotation around its own axis
-	glCallList(MercuryDL); // Render the horse
-	glPopMatrix(); // Restore the previous matrix
-
-	// Call the display list with the updated translation
-	glPushMatrix(); // Push the current matrix
-	glRotatef(360.f * slow_time * 0.39, 0, 1, 0);
-	glTranslatef(0., 0., 0.67f * radius_scale -1);
-	glRotatef(360.f * slow_time_2 * 1.507, 0, 1, 0);// Rotation around its own axis
-	glCallList(VenusDL); // Render the horse
-	glPopMatrix(); // Restore the previous matrix
-
-	// Call the display list with the updated translation
-	glPushMatrix(); // Push the current matrix
-	glRotatef(360.f * slow_time * 0.24, 0, 1, 0);
-	glTranslatef(0., 0., 0.92f * radius_scale -1);
-	glRotatef(360.f * slow_time_2 * 176, 0, 1, 0);// Rotation around its own axis
-	glCallList(EarthDL); // Render the horse
-	glPopMatrix(); // Restore the previous matrix
-
-	// Call the display list with the updated translation
-	glPushMatrix(); // Push the current matrix
-	glRotatef(360.f * slow_time * 0.12, 0, 1, 0);
-	glTranslatef(0., 0., 1.41f * radius_scale -1);
-	glRotatef(360.f * slow_time_2 * 176, 0, 1, 0);// Rotation around its own axis
-	glCallList(MarsDL); // Render the horse
-	glPopMatrix(); // Restore the previous matrix
-
-	// Call the display list with the updated translation
-	glPushMatrix(); // Push the current matrix
-	glRotatef(360.f * slow_time * 0.02, 0, 1, 0);
-	glTranslatef(0., 0., 4.83f * radius_scale -1);
-	glRotatef(360.f * slow_time_2 * 426.5, 0, 1, 0);// Rotation around its own axis
-	glCallList(JupiterDL); // Render the horse
-	glPopMatrix(); // Restore the previous matrix
-
-	// Call the display list with the updated translation
-	glPushMatrix(); // Push the current matrix
-	glRotatef(360.f * slow_time * 0.0082, 0, 1, 0);
-	glTranslatef(0., 0., 8.90f * radius_scale -1);
-	glRotatef(360.f * slow_time_2 * 394.6, 0, 1, 0);// Rotation around its own axis
-	glCallList(SaturnDL); // Render the horse
-	glPopMatrix(); // Restore the previous matrix
-
-	// Call the display list with the updated translation
-	glPushMatrix(); // Push the current matrix
-	glRotatef(360.f * slow_time * 0.003, 0, 1, 0);
-	glTranslatef(0., 0., 17.87f * radius_scale -1);
-	glRotatef(360.f * slow_time_2 * 238.6, 0, 1, 0);// Rotation around its own axis
-	glCallList(UranusDL); // Render the horse
-	glPopMatrix(); // Restore the previous matrix
-
-	// Call the display list with the updated translation
-	glPushMatrix(); // Push the current matrix
-	glRotatef(360.f * slow_time * 0.0015, 0, 1, 0);
-	glTranslatef(0., 0., 27.98f * radius_scale -1);
-	glRotatef(360.f * slow_time_2 * 262.3, 0, 1, 0);// Rotation around its own axis
-	glCallList(NeptuneDL); // Render the horse
-	glPopMatrix(); // Restore the previous matrix
+	GLDEBUG_POP( );
 
-	glDisable(GL_LIGHTING);
-	glPushMatrix();
-	glColor3f(1.0, 1.0, 1.0);  // Set the color to white
-	glCallList(Mer_C);
-	glCallList(Ven_C);
-	glCallList(Ear_C);
-	glCallList(Mar_C);
-	glCallList(Jup_C);
-	glCallList(Ura_C);
-	glCallList(Nep_C);
-	glCallList(Sat_C);
-	glPopMatrix();
-	glEnable(GL_LIGHTING);
+	// the planets go into the geometry pool, which draws them all with one call:
+	// (the worker already moved them, culled them, and sorted them front to back)
 
-	glDisable(GL_LIGHTING);
-	glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_REPLACE);
+	GLDEBUG_PUSH( "Planets" );
+	Pool.Begin( );
+	for( int i = 0; i < (int)packet.Planets.size( ); i++ )
+		Pool.Submit( PoolPlanet, packet.Planets[i].World, packet.Planets[i].Layer );
+	Pool.Draw( );
+	if( DebugOn != 0 )
+		Pool.PrintStats( stderr );
+	GLDEBUG_POP( );
 
-	// Call the display list with the updated translation
-	glPushMatrix(); // Push the current matrix
-	//glRotatef(360.f * slow_time * 0.0015, 0, 1, 0);
-	glCallList(SunDL); // Render the horse
-	glPopMatrix(); // Restore the previous matrix
+	// the moons and satellites are all instances of one mesh -- the ones the worker found in view
+	// are copied into this frame's part of the stream buffer, and the instance attributes pointed
+	// at wherever that is
+	// the fixed-function pipeline cannot read instance attributes, so it gets them one at a time:
 
-	glDisable(GL_TEXTURE_2D);
-	glDisable(GL_LIGHTING);
+	int numVisible = (int)packet.Moons.size( );
+	if( numVisible > 0 )
+	{
+		GLDEBUG_PUSH( "Moons" );
+		Pipeline.Disable( GL_TEXTURE_2D );
+		if( Pipeline.IsCore( ) )
+		{
+			GLsizeiptr bytes = numVisible * sizeof(glm::mat4);
+			if( bytes > MoonStream.GetRegionSize( ) )
+				MoonStream.Init( GL_ARRAY_BUFFER, 2*bytes, 16, "moon instances" );
+			MoonStream.BeginFrame( );
+			GLintptr offset = MoonStream.Push( packet.Moons.data( ), bytes );
+			for( int col = 0; col < 4; col++ )
+				MoonMesh.InstanceAttribute( 10 + col, 4, MoonStream.GetBuffer( ), sizeof(glm::mat4), offset + col * sizeof(glm::vec4) );
+			Pipeline.DrawInstanced( &MoonMesh, numVisible );
+			MoonStream.EndFrame( );
+		}
+		else
+		{
+			for( int i = 0; i < numVisible; i++ )
+			{
+				Pipeline.PushMatrix( );
+				Pipeline.MultMatrix( packet.Moons[i] );
+				Pipeline.Draw( &MoonMesh );
+				Pipeline.PopMatrix( );
+			}
+		}
+		if( textureMode == 1 )
+			Pipeline.Enable( GL_TEXTURE_2D );
+		GLDEBUG_POP( );
+	}
 
-	glPushMatrix();
+	// the orbits, and everything else in the line batch, in one draw:
+
+	GLDEBUG_PUSH( "Orbits" );
+	Lines.SetColor( 1., 1., 1. );
+	for( int i = 0; i < (int)packet.Orbits.size( ); i++ )
+	{
+		const glm::vec4 &orbit = packet.Orbits[i];
+		Lines.AddCircle( orbit.x, orbit.y, orbit.z, orbit.w );
+	}
+
+	// a ring around the picked body:
+
+	if( packet.HasRing )
+	{
+		Lines.SetColor( 1., 1., 0. );
+		Lines.AddCircle( packet.Ring.x, packet.Ring.y, packet.Ring.z, packet.Ring.w );
+	}
+	Lines.Draw( );
+	GLDEBUG_POP( );
+
+	GLDEBUG_PUSH( "Sun" );
+
+	Pipeline.Disable(GL_LIGHTING);
+	Pipeline.TexEnvMode(GL_REPLACE);
+
+	// the sun is the same sphere as the planets:
+	for( int i = 0; i < (int)packet.Suns.size( ); i++ )
+	{
+		int body = packet.Suns[i].Body;
+		Pipeline.PushMatrix(); // Push the current matrix
+		Pipeline.MultMatrix( packet.Suns[i].World );
+		Pipeline.BindTexture(GL_TEXTURE_2D, Bodies.GetTexture( body ));
+		Pipeline.Draw( Bodies.GetMesh( body ) );
+		Pipeline.PopMatrix(); // Restore the previous matrix
+	}
+	if( DebugOn != 0 )
+		Lines.PrintStats( stderr );
+	if( DebugOn != 0  ||  packet.Report )
+	{
+		MoonStream.PrintStats( stderr );
+		Frames.PrintStats( stderr );
+	}
+	GLDEBUG_POP( );
+
+	Pipeline.Disable(GL_TEXTURE_2D);
+	Pipeline.Disable(GL_LIGHTING);
+
+	Pipeline.PushMatrix();
 	//SetPointLight(GL_LIGHT1, 0.f, 10.f, 0.f, 1.0f, 1.0f, 1.0f);
-	glEnable(GL_LIGHT0);
-	glPopMatrix();
-	glEnable(GL_LIGHTING);
+	Pipeline.Enable(GL_LIGHT0);
+	Pipeline.PopMatrix();
+	Pipeline.Enable(GL_LIGHTING);
 
 	/*
 	glPushMatrix();
@@ -655,10 +827,10 @@ Display( )
 #ifdef DEMO_Z_FIGHTING
 	if( DepthFightingOn != 0 )
 	{
-		glPushMatrix( );
-			glRotatef( 90.f,   0.f, 1.f, 0.f );
+		Pipeline.PushMatrix( );
+			Pipeline.Rotate( 90.f,   0.f, 1.f, 0.f );
 			glCallList( BoxList );
-		glPopMatrix( );
+		Pipeline.PopMatrix( );
 	}
 #endif
 
@@ -668,8 +840,9 @@ Display( )
 	// a good use for thefirst one might be to have your name on the screen
 	// a good use for the second one might be to have vertex numbers on the screen alongside each vertex
 
-	glDisable( GL_DEPTH_TEST );
-	glColor3f( 0.f, 1.f, 1.f );
+	GLDEBUG_PUSH( "Overlay" );
+	Pipeline.Disable( GL_DEPTH_TEST );
+	Pipeline.Color( 0.f, 1.f, 1.f );
 	//DoRasterString( 0.f, 1.f, 0.f, (char *)"Text That Moves" );
 
 
@@ -683,23 +856,137 @@ Display( )
 	// the modelview matrix is reset to identity as we don't
 	// want to transform these coordinates
 
-	glDisable( GL_DEPTH_TEST );
-	glMatrixMode( GL_PROJECTION );
-	glLoadIdentity( );
-	gluOrtho2D( 0.f, 100.f,     0.f, 100.f );
-	glMatrixMode( GL_MODELVIEW );
-	glLoadIdentity( );
-	glColor3f( 1.f, 1.f, 1.f );
+	Pipeline.Disable( GL_DEPTH_TEST );
+	Pipeline.MatrixMode( GL_PROJECTION );
+	Pipeline.LoadIdentity( );
+	Pipeline.Ortho2D( 0.f, 100.f,     0.f, 100.f );
+	Pipeline.MatrixMode( GL_MODELVIEW );
+	Pipeline.LoadIdentity( );
+	Pipeline.Color( 1.f, 1.f, 1.f );
 	//DoRasterString( 5.f, 5.f, 0.f, (char *)"Text That Doesn't" );
+	GLDEBUG_POP( );
+}
 
-	// swap the double-buffered framebuffers:
 
-	glutSwapBuffers( );
+// copy what the worker will need to prepare a frame into its packet -- on the gl thread, from Next( ):
+// (everything the mouse, the keyboard, and the menus change that the frame depends on)
 
-	// be sure the graphics buffer has been sent:
-	// note: be sure to use glFlush( ) here, not glFinish( ) !
+void
+CaptureFrame( int which )
+{
+	FramePacket &packet = Packets[which];
+	packet.Time = Time;
+	packet.Picked = Picked;
+	packet.Debug = DebugOn;
+	packet.Scene = NowScene;
+	packet.Ms = glutGet( GLUT_ELAPSED_TIME );
+
+	// the viewing volume:
+	// remember that the Z clipping  values are given as DISTANCES IN FRONT OF THE EYE
 
-	glFlush( );
+	if( NowProjection == ORTHO )
+		packet.Projection = glm::ortho( -2.f, 2.f,     -2.f, 2.f,     0.1f, 1000.f );
+	else
+		packet.Projection = glm::perspective( glm::radians( 70.f ), 1.f,	0.1f, 1000.f );
+
+	// the eye position, look-at position, and up-vector, then the rotation and the uniform scale:
+
+	if( Scale < MINSCALE )
+		Scale = MINSCALE;
+	glm::mat4 modelview = glm::lookAt( glm::vec3( 2., 2., 4. ), glm::vec3( 0., 0., 0. ), glm::vec3( 0., 1., 0. ) );
+	modelview = glm::rotate( modelview, glm::radians( Yrot ), glm::vec3( 0., 1., 0. ) );
+	modelview = glm::rotate( modelview, glm::radians( Xrot ), glm::vec3( 1., 0., 0. ) );
+	packet.Modelview = glm::scale( modelview, glm::vec3( Scale, Scale, Scale ) );
+}
+
+
+// move the scene to the packet's time, and put what is in view into its draw lists -- on the worker:
+
+static bool
+NearerFirst( const BodyDraw &a, const BodyDraw &b )
+{
+	return a.Depth < b.Depth;
+}
+
+void
+PrepareFrame( int which )
+{
+	FramePacket &packet = Packets[which];
+	UpdateSolarSystem( which );
+
+	View.FromMatrices( glm::value_ptr( packet.Projection ), glm::value_ptr( packet.Modelview ) );
+	View.ResetCounters( );
+
+	// the planets and the sun -- the same unit sphere, scaled:
+
+	packet.Planets.clear( );
+	packet.Suns.clear( );
+	for( int k = 0; k < 2; k++ )
+	{
+		std::vector<int> &bodies = k == 0  ?  LitBodies  :  GlowingBodies;
+		for( int i = 0; i < (int)bodies.size( ); i++ )
+		{
+			BodyDraw draw;
+			draw.Body = bodies[i];
+			draw.World = Solar.GetWorld( Bodies.GetNode( draw.Body ) );
+			const float center[3] = { draw.World[3].x, draw.World[3].y, draw.World[3].z };
+			if( ! View.SphereVisible( center, glm::length( glm::vec3( draw.World[0] ) ) ) )
+				continue;
+			draw.Layer = k == 0  ?  LitLayers[i]  :  POOL_NO_TEXTURE;
+			draw.Depth = -( packet.Modelview * draw.World[3] ).z;
+			( k == 0  ?  packet.Planets  :  packet.Suns ).push_back( draw );
+		}
+	}
+	std::sort( packet.Planets.begin( ), packet.Planets.end( ), NearerFirst );
+
+	// the moons and satellites that the sphere tree says might be in view, front to back:
+
+	packet.Moons.clear( );
+	packet.MoonOrder.clear( );
+	int numVisible = Solar.GetNumInstances( ) > 0  ?  MoonTree.Cull( View, VisibleMoons )  :  0;
+	for( int i = 0; i < numVisible; i++ )
+	{
+		const glm::mat4 &world = Solar.GetInstanceWorld( VisibleMoons[i] );
+		packet.MoonOrder.push_back( std::pair<float,int>( -( packet.Modelview * world[3] ).z, VisibleMoons[i] ) );
+	}
+	std::sort( packet.MoonOrder.begin( ), packet.MoonOrder.end( ) );
+	for( int i = 0; i < numVisible; i++ )
+		packet.Moons.push_back( Solar.GetInstanceWorld( packet.MoonOrder[i].second ) );
+
+	// the orbits:
+	// (an orbit is drawn flat, around where its body's parent is, at the distance the parent's scale makes it)
+
+	packet.Orbits.clear( );
+	for( int i = 0; i < (int)RingBodies.size( ); i++ )
+	{
+		int body = RingBodies[i];
+		int parent = Bodies.GetParent( body );
+		float center[3] = { 0., 0., 0. };
+		float orbit = Bodies.GetDistance( body );
+		if( parent != NO_BODY )
+		{
+			const glm::mat4 &world = Solar.GetWorld( Bodies.GetNode( parent ) );
+			center[0] = world[3].x;
+			center[1] = world[3].y;
+			center[2] = world[3].z;
+			orbit *= glm::length( glm::vec3( world[0] ) );
+		}
+		if( View.SphereVisible( center, orbit ) )
+			packet.Orbits.push_back( glm::vec4( center[0], center[1], center[2], orbit ) );
+	}
+
+	packet.HasRing = packet.Picked != NO_BODY;
+	if( packet.HasRing )
+	{
+		const glm::mat4 &world = Solar.GetWorld( Bodies.GetNode( packet.Picked ) );
+		packet.Ring = glm::vec4( glm::vec3( world[3] ), 1.5f * glm::length( glm::vec3( world[0] ) ) );
+	}
+
+	if( packet.Debug != 0 )
+	{
+		View.PrintStats( stderr, "sun, planets, and orbits" );
+		MoonTree.PrintStats( stderr );
+	}
 }
 
 
@@ -803,6 +1090,35 @@ DoProjectMenu( int id )
 }
 
 
+void
+DoPipelineMenu( int id )
+{
+	if( id == SELF_CHECK )
+		PipelineCheck = 1;
+	else
+	{
+		Pipeline.SetMode( id == FIXED_FUNCTION  ?  PIPELINE_FIXED_FUNCTION  :  PIPELINE_CORE );
+		Pipeline.SetPerFragmentLighting( id == CORE_PER_PIXEL );
+	}
+
+	glutSetWindow( MainWindow );
+	glutPostRedisplay( );
+}
+
+
+void
+DoSceneMenu( int id )
+{
+	NowScene = id;
+	MakeSolarSystem( SceneSizes[id].Moons, SceneSizes[id].Satellites );
+	if( id != SCENE_PLANETS )
+		fprintf( stderr, "Scene graph: %d nodes, %d of them moons and satellites\n", Solar.GetNumNodes( ), Solar.GetNumInstances( ) );
+
+	glutSetWindow( MainWindow );
+	glutPostRedisplay( );
+}
+
+
 // use glut to display a string of characters using a raster font:
 
 void
@@ -818,21 +1134,39 @@ DoRasterString( float x, float y, float z, char *s )
 }
 
 
-// use glut to display a string of characters using a stroke font:
+// use glut's stroke font to display a string of characters:
+// (between Lines.Begin( ) and Lines.Draw( ), the strokes go into the line batch, and the text is
+// placed in the coordinates the batch is drawn in -- anywhere else, it is drawn right away)
 
 void
 DoStrokeString( float x, float y, float z, float ht, char *s )
 {
-	glPushMatrix( );
-		glTranslatef( (GLfloat)x, (GLfloat)y, (GLfloat)z );
+	if( Lines.IsOpen( ) )
+	{
+		Lines.AddStrokeString( x, y, z, ht, s );
+		return;
+	}
+
+	// the core pipeline does not keep gl's own matrices, so glut would draw it in the wrong place:
+
+	if( Pipeline.IsCore( ) )
+	{
+		Lines.Begin( );
+		Lines.AddStrokeString( x, y, z, ht, s );
+		Lines.Draw( );
+		return;
+	}
+
+	Pipeline.PushMatrix( );
+		Pipeline.Translate( (GLfloat)x, (GLfloat)y, (GLfloat)z );
 		float sf = ht / ( 119.05f + 33.33f );
-		glScalef( (GLfloat)sf, (GLfloat)sf, (GLfloat)sf );
+		Pipeline.Scale( (GLfloat)sf, (GLfloat)sf, (GLfloat)sf );
 		char c;			// one character to print
 		for( ; ( c = *s ) != '\0'; s++ )
 		{
 			glutStrokeCharacter( GLUT_STROKE_ROMAN, c );
 		}
-	glPopMatrix( );
+	Pipeline.PopMatrix( );
 }
 
 
@@ -892,6 +1226,17 @@ InitMenus( )
 	glutAddMenuEntry( "Orthographic",  ORTHO );
 	glutAddMenuEntry( "Perspective",   PERSP );
 
+	int pipelinemenu = glutCreateMenu( DoPipelineMenu );
+	glutAddMenuEntry( "Fixed-Function",		FIXED_FUNCTION );
+	glutAddMenuEntry( "Core (Shaders)",		CORE );
+	glutAddMenuEntry( "Core, Per-Pixel Lighting",	CORE_PER_PIXEL );
+	glutAddMenuEntry( "Self-Check",			SELF_CHECK );
+
+	int scenemenu = glutCreateMenu( DoSceneMenu );
+	glutAddMenuEntry( "Planets Only",			SCENE_PLANETS );
+	glutAddMenuEntry( "2,000 Moons, 8,000 Satellites",	SCENE_MOONS );
+	glutAddMenuEntry( "10,000 Moons, 40,000 Satellites",	SCENE_STRESS );
+
 	int mainmenu = glutCreateMenu( DoMainMenu );
 	glutAddSubMenu(   "Axes",          axesmenu);
 	glutAddSubMenu(   "Axis Colors",   colormenu);
@@ -906,6 +1251,8 @@ InitMenus( )
 
 	glutAddSubMenu(   "Depth Cue",     depthcuemenu);
 	glutAddSubMenu(   "Projection",    projmenu );
+	glutAddSubMenu(   "Pipeline",      pipelinemenu );
+	glutAddSubMenu(   "Scene Graph",   scenemenu );
 	glutAddMenuEntry( "Reset",         RESET );
 	glutAddSubMenu(   "Debug",         debugmenu);
 	glutAddMenuEntry( "Quit",          QUIT );
@@ -936,6 +1283,10 @@ InitGraphics( )
 	glutInitWindowPosition( 0, 0 );
 	glutInitWindowSize( INIT_WINDOW_SIZE, INIT_WINDOW_SIZE );
 
+	// in a GLDEBUG build, ask for a context that reports its errors through a callback:
+
+	GLDEBUG_CONTEXT( );
+
 	// open the window and set its title:
 
 	MainWindow = glutCreateWindow( WINDOWTITLE );
@@ -995,8 +1346,8 @@ InitGraphics( )
 	glutIdleFunc( Animate );
 
 	// init the glew package (a window must be open to do this):
+	// (on every platform -- the pipeline, the stream buffers, the geometry pool and the line batch all come through glew's entry points)
 
-#ifdef WIN32
 	GLenum err = glewInit( );
 	if( err != GLEW_OK )
 	{
@@ -1005,188 +1356,18 @@ InitGraphics( )
 	else
 		fprintf( stderr, "GLEW initialized OK\n" );
 	fprintf( stderr, "Status: Using GLEW %s\n", glewGetString(GLEW_VERSION));
-#endif
 
-	// all other setups go here, such as GLSLProgram and KeyTime setups:
+	GLDEBUG_INIT( );
 
-	// Texture Init
+	// start the shaders for the core pipeline -- the fixed-function one is used until the menu says otherwise
+	// (and until they are ready):
 
-	//int v_width, v_height;
-	//unsigned char* venus_texture = BmpToTexture("venus.bmp", &v_width, &v_height);
-	//int level = 0, ncomps = 3, border = 0;
-	//glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-	//glTexImage2D(GL_TEXTURE_2D, level, ncomps, v_width, v_height, border, GL_RGB, GL_UNSIGNED_BYTE, venus_texture);
+	Pipeline.Init( );
+	Pipeline.OwnMatrices( true );		// every matrix in Display( ) goes through the pipeline
 
-	// Mars Texture -----------------------------------------------------------------------------------------------
+	// all other setups go here, such as GLSLProgram and KeyTime setups:
 
-	int m_width, m_height;
-	char* file = (char*)"mars.bmp";
-	unsigned char* texture = BmpToTexture(file, &m_width, &m_height);
-	if (texture == NULL)
-		fprintf(stderr, "Cannot open texture '%s'\n", file);
-	else
-		fprintf(stderr, "Opened '%s': width = %d ; height = %d\n", file, m_width, m_height);
-
-	glGenTextures(1, &MarsTex);
-	glBindTexture(GL_TEXTURE_2D, MarsTex);
-	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-	glTexImage2D(GL_TEXTURE_2D, 0, 3, m_width, m_height, 0, GL_RGB, GL_UNSIGNED_BYTE, texture);
-
-	// Venus Texture -----------------------------------------------------------------------------------------------
-
-	int v_width, v_height;
-	char* file_v = (char*)"venus.bmp";
-	unsigned char* texture_v = BmpToTexture(file_v, &v_width, &v_height);
-	if (texture_v == NULL)
-		fprintf(stderr, "Cannot open texture '%s'\n", file_v);
-	else
-		fprintf(stderr, "Opened '%s': width = %d ; height = %d\n", file_v, v_width, v_height);
-
-	glGenTextures(1, &VenusTex);
-	glBindTexture(GL_TEXTURE_2D, VenusTex);
-	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-	glTexImage2D(GL_TEXTURE_2D, 0, 3, v_width, v_height, 0, GL_RGB, GL_UNSIGNED_BYTE, texture_v);
-
-	// Earth Texture -----------------------------------------------------------------------------------------------
-
-	int e_width, e_height;
-	char* e_file = (char*)"earth.bmp";
-	unsigned char* e_texture = BmpToTexture(e_file, &e_width, &e_height);
-	if (e_texture == NULL)
-		fprintf(stderr, "Cannot open texture '%s'\n", e_file);
-	else
-		fprintf(stderr, "Opened '%s': width = %d ; height = %d\n", e_file, e_width, e_height);
-
-	glGenTextures(1, &EarthTex);
-	glBindTexture(GL_TEXTURE_2D, EarthTex);
-	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-	glTexImage2D(GL_TEXTURE_2D, 0, 3, e_width, e_height, 0, GL_RGB, GL_UNSIGNED_BYTE, e_texture);
-
-	// Jupiter Texture -----------------------------------------------------------------------------------------------
-
-	int j_width, j_height;
-	char* j_file = (char*)"jupiter.bmp";
-	unsigned char* j_texture = BmpToTexture(j_file, &j_width, &j_height);
-	if (j_texture == NULL)
-		fprintf(stderr, "Cannot open texture '%s'\n", j_file);
-	else
-		fprintf(stderr, "Opened '%s': width = %d ; height = %d\n", j_file, j_width, j_height);
-
-	glGenTextures(1, &JupiterTex);
-	glBindTexture(GL_TEXTURE_2D, JupiterTex);
-	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-	glTexImage2D(GL_TEXTURE_2D, 0, 3, j_width, j_height, 0, GL_RGB, GL_UNSIGNED_BYTE, j_texture);
-
-	// Saturn Texture -----------------------------------------------------------------------------------------------
-
-	int s_width, s_height;
-	char* s_file = (char*)"saturn.bmp";
-	unsigned char* s_texture = BmpToTexture(s_file, &s_width, &s_height);
-	if (s_texture == NULL)
-		fprintf(stderr, "Cannot open texture '%s'\n", s_file);
-	else
-		fprintf(stderr, "Opened '%s': width = %d ; height = %d\n", s_file, s_width, s_height);
-
-	glGenTextures(1, &SaturnTex);
-	glBindTexture(GL_TEXTURE_2D, SaturnTex);
-	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-	glTexImage2D(GL_TEXTURE_2D, 0, 3, s_width, s_height, 0, GL_RGB, GL_UNSIGNED_BYTE, s_texture);
-
-	// Uranus Texture -----------------------------------------------------------------------------------------------
-
-	int u_width, u_height;
-	char* u_file = (char*)"uranus.bmp";
-	unsigned char* u_texture = BmpToTexture(u_file, &u_width, &u_height);
-	if (j_texture == NULL)
-		fprintf(stderr, "Cannot open texture '%s'\n", j_file);
-	else
-		fprintf(stderr, "Opened '%s': width = %d ; height = %d\n", u_file, u_width, u_height);
-
-	glGenTextures(1, &UranusTex);
-	glBindTexture(GL_TEXTURE_2D, UranusTex);
-	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-	glTexImage2D(GL_TEXTURE_2D, 0, 3, u_width, u_height, 0, GL_RGB, GL_UNSIGNED_BYTE, u_texture);
-
-	// Neptune Texture -----------------------------------------------------------------------------------------------
-
-	int n_width, n_height;
-	char* n_file = (char*)"neptune.bmp";
-	unsigned char* n_texture = BmpToTexture(n_file, &n_width, &n_height);
-	if (n_texture == NULL)
-		fprintf(stderr, "Cannot open texture '%s'\n", n_file);
-	else
-		fprintf(stderr, "Opened '%s': width = %d ; height = %d\n", n_file, n_width, n_height);
-
-	glGenTextures(1, &NeptuneTex);
-	glBindTexture(GL_TEXTURE_2D, NeptuneTex);
-	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-	glTexImage2D(GL_TEXTURE_2D, 0, 3, n_width, n_height, 0, GL_RGB, GL_UNSIGNED_BYTE, n_texture);
-
-	// Mercury Texture -----------------------------------------------------------------------------------------------
-
-	int me_width, me_height;
-	char* me_file = (char*)"mercury.bmp";
-	unsigned char* me_texture = BmpToTexture(me_file, &me_width, &me_height);
-	if (me_texture == NULL)
-		fprintf(stderr, "Cannot open texture '%s'\n", me_file);
-	else
-		fprintf(stderr, "Opened '%s': width = %d ; height = %d\n", me_file, me_width, me_height);
-
-	glGenTextures(1, &MercuryTex);
-	glBindTexture(GL_TEXTURE_2D, MercuryTex);
-	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-	glTexImage2D(GL_TEXTURE_2D, 0, 3, me_width, me_height, 0, GL_RGB, GL_UNSIGNED_BYTE, me_texture);
-
-	// Sun Texture -----------------------------------------------------------------------------------------------
-
-	int su_width, su_height;
-	char* su_file = (char*)"sun.bmp";
-	unsigned char* su_texture = BmpToTexture(su_file, &su_width, &su_height);
-	if (su_texture == NULL)
-		fprintf(stderr, "Cannot open texture '%s'\n", su_file);
-	else
-		fprintf(stderr, "Opened '%s': width = %d ; height = %d\n", su_file, su_width, su_height);
-
-	glGenTextures(1, &SunTex);
-	glBindTexture(GL_TEXTURE_2D, SunTex);
-	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-	glTexImage2D(GL_TEXTURE_2D, 0, 3, su_width, su_height, 0, GL_RGB, GL_UNSIGNED_BYTE, su_texture);
+	// the textures are loaded with the scene file, by MakeSolarSystem( )
 }
 
 
@@ -1218,287 +1399,35 @@ InitLists( )
 	
 	// Create the grid:
 
-	GridDL = glGenLists(1);
-	glNewList(GridDL, GL_COMPILE);
-	SetMaterial(0.6f, 0.6f, 0.6f, 30.f);
-	glNormal3f(0., 1., 0.);
-	for (int i = 0; i < NZ; i++)
-	{
-		glBegin(GL_QUAD_STRIP);
-		for (int j = 0; j < NX; j++)
-		{
-			// YGRID = 0
-			glVertex3f(X0 + DX * (float)j, 0, Z0 + DZ * (float)(i + 0));
-			glVertex3f(X0 + DX * (float)j, 0, Z0 + DZ * (float)(i + 1));
-		}
-		glEnd();
-	}
-	glEndList();
-
-	float base_radius = 0.08;
-	float planet_scale = 4;
-
-	SphereDL = glGenLists(1);
-	glNewList(SphereDL, GL_COMPILE);
-	OsuSphere(base_radius, 100 , 100 );
-	glEndList();
-
-	me_SphereDL = glGenLists(1);
-	glNewList(me_SphereDL, GL_COMPILE);
-	OsuSphere(base_radius, 100, 100);
-	glEndList();
-
-	v_SphereDL = glGenLists(1);
-	glNewList(v_SphereDL, GL_COMPILE);
-	OsuSphere(base_radius*2.48, 100, 100);
-	glEndList();
-	
-	e_SphereDL = glGenLists(1);
-	glNewList(e_SphereDL, GL_COMPILE);
-	OsuSphere(base_radius*2.61, 100, 100);
-	glEndList();
-
-	ma_SphereDL = glGenLists(1);
-	glNewList(ma_SphereDL, GL_COMPILE);
-	OsuSphere(base_radius*1.39, 100, 100);
-	glEndList();
-
-	j_SphereDL = glGenLists(1);
-	glNewList(j_SphereDL, GL_COMPILE);
-	OsuSphere(base_radius*28.66, 100, 100);
-	glEndList();
-
-	s_SphereDL = glGenLists(1);
-	glNewList(s_SphereDL, GL_COMPILE);
-	OsuSphere(base_radius*23.87, 100, 100);
-	glEndList();
-
-	u_SphereDL = glGenLists(1);
-	glNewList(u_SphereDL, GL_COMPILE);
-	OsuSphere(base_radius*10.4, 100, 100);
-	glEndList();
-
-	n_SphereDL = glGenLists(1);
-	glNewList(n_SphereDL, GL_COMPILE);
-	OsuSphere(base_radius*10.09, 100, 100);
-	glEndList();
-
-	su_SphereDL = glGenLists(1);
-	glNewList(su_SphereDL, GL_COMPILE);
-	OsuSphere(1, 100, 100);
-	glEndList();
-
-	MarsDL = glGenLists(1);
-	glNewList(MarsDL, GL_COMPILE);
-	glBindTexture(GL_TEXTURE_2D, MarsTex);	// MarsTex must have already been created when this is called
-	glPushMatrix();
-		glScalef(0.53f, 0.53f, 0.53f);	// scale of mars sphere, from the table
-		glCallList(ma_SphereDL);		// a dl can call another dl that has been previously created
-		glPopMatrix();
-	glEndList();
-
-	VenusDL = glGenLists(1);
-	glNewList(VenusDL, GL_COMPILE);
-	glBindTexture(GL_TEXTURE_2D, VenusTex);	// MarsTex must have already been created when this is called
-	glPushMatrix();
-	glScalef(0.53f, 0.53f, 0.53f);	// scale of mars sphere, from the table
-	glCallList(v_SphereDL);		// a dl can call another dl that has been previously created
-	glPopMatrix();
-	glEndList();
-
-	EarthDL = glGenLists(1);
-	glNewList(EarthDL, GL_COMPILE);
-	glBindTexture(GL_TEXTURE_2D, EarthTex);	// MarsTex must have already been created when this is called
-	glPushMatrix();
-	glScalef(0.53f, 0.53f, 0.53f);	// scale of mars sphere, from the table
-	glCallList(e_SphereDL);		// a dl can call another dl that has been previously created
-	glPopMatrix();
-	glEndList();
-
-	JupiterDL = glGenLists(1);
-	glNewList(JupiterDL, GL_COMPILE);
-	glBindTexture(GL_TEXTURE_2D, JupiterTex);	// MarsTex must have already been created when this is called
-	glPushMatrix();
-	glScalef(0.53f, 0.53f, 0.53f);	// scale of mars sphere, from the table
-	glCallList(j_SphereDL);		// a dl can call another dl that has been previously created
-	glPopMatrix();
-	glEndList();
-
-	SaturnDL = glGenLists(1);
-	glNewList(SaturnDL, GL_COMPILE);
-	glBindTexture(GL_TEXTURE_2D, SaturnTex);	// MarsTex must have already been created when this is called
-	glPushMatrix();
-	glScalef(0.53f, 0.53f, 0.53f);	// scale of mars sphere, from the table
-	glCallList(s_SphereDL);		// a dl can call another dl that has been previously created
-	glPopMatrix();
-	glEndList();
-
-	UranusDL = glGenLists(1);
-	glNewList(UranusDL, GL_COMPILE);
-	glBindTexture(GL_TEXTURE_2D, UranusTex);	// MarsTex must have already been created when this is called
-	glPushMatrix();
-	glScalef(0.53f, 0.53f, 0.53f);	// scale of mars sphere, from the table
-	glCallList(u_SphereDL);		// a dl can call another dl that has been previously created
-	glPopMatrix();
-	glEndList();
-
-	NeptuneDL = glGenLists(1);
-	glNewList(NeptuneDL, GL_COMPILE);
-	glBindTexture(GL_TEXTURE_2D, NeptuneTex);	// MarsTex must have already been created when this is called
-	glPushMatrix();
-	glScalef(0.53f, 0.53f, 0.53f);	// scale of mars sphere, from the table
-	glCallList(n_SphereDL);		// a dl can call another dl that has been previously created
-	glPopMatrix();
-	glEndList();
-
-	MercuryDL = glGenLists(1);
-	glNewList(MercuryDL, GL_COMPILE);
-	glBindTexture(GL_TEXTURE_2D, MercuryTex);	// MarsTex must have already been created when this is called
-	glPushMatrix();
-	glScalef(0.53f, 0.53f, 0.53f);	// scale of mars sphere, from the table
-	glCallList(me_SphereDL);		// a dl can call another dl that has been previously created
-	glPopMatrix();
-	glEndList();
-
-	SunDL = glGenLists(1);
-	glNewList(SunDL, GL_COMPILE);
-	glBindTexture(GL_TEXTURE_2D, SunTex);	// MarsTex must have already been created when this is called
-	glPushMatrix();
-	glScalef(0.53f, 0.53f, 0.53f);	// scale of mars sphere, from the table
-	glCallList(su_SphereDL);		// a dl can call another dl that has been previously created
-	glPopMatrix();
-	glEndList();
-
-
-	// Circles for orbit --------------------------------------------
-
-	Mer_C = glGenLists(1);
-	glNewList(Mer_C, GL_COMPILE);
-	radius = (0.35f * 0.5) + 1;
-
-	glBegin(GL_LINE_LOOP);
-	for (int i = 0; i < 100; ++i) {
-		float theta = 2.0f * 3.1415926f * float(i) / float(100);
-		float x = radius * cosf(theta);
-		float z = radius * sinf(theta);
-		glVertex3f(x, 0, z);
-	}
-	glEnd();
-
-	glEndList();
-
-	Ven_C = glGenLists(1);
-	glNewList(Ven_C, GL_COMPILE);
-	radius = 0.67f * 0.5 + 1;
-
-	glBegin(GL_LINE_LOOP);
-	for (int i = 0; i < 100; ++i) {
-		float theta = 2.0f * 3.1415926f * float(i) / float(100);
-		float x = radius * cosf(theta);
-		float z = radius * sinf(theta);
-		glVertex3f(x, 0, z);
-	}
-	glEnd();
-
-	glEndList();
-
-	Ear_C = glGenLists(1);
-	glNewList(Ear_C, GL_COMPILE);
-	radius = 0.92f * 0.5 + 1;
-
-	glBegin(GL_LINE_LOOP);
-	for (int i = 0; i < 100; ++i) {
-		float theta = 2.0f * 3.1415926f * float(i) / float(100);
-		float x = radius * cosf(theta);
-		float z = radius * sinf(theta);
-		glVertex3f(x, 0, z);
-	}
-	glEnd();
-
-	glEndList();
-
-	Mar_C = glGenLists(1);
-	glNewList(Mar_C, GL_COMPILE);
-	radius = 1.41f * 0.5 + 1;
-
-	glBegin(GL_LINE_LOOP);
-	for (int i = 0; i < 100; ++i) {
-		float theta = 2.0f * 3.1415926f * float(i) / float(100);
-		float x = radius * cosf(theta);
-		float z = radius * sinf(theta);
-		glVertex3f(x, 0, z);
-	}
-	glEnd();
-
-	glEndList();
-
-	Jup_C = glGenLists(1);
-	glNewList(Jup_C, GL_COMPILE);
-	radius = 4.83f * 0.5 + 1;
+	// (the grid is tiled and drawn by the vertex shader, so it does not need a display list)
 
-	glBegin(GL_LINE_LOOP);
-	for (int i = 0; i < 100; ++i) {
-		float theta = 2.0f * 3.1415926f * float(i) / float(100);
-		float x = radius * cosf(theta);
-		float z = radius * sinf(theta);
-		glVertex3f(x, 0, z);
-	}
-	glEnd();
+	Floor.Init( X0, Z0, XSIDE, ZSIDE, NX, NZ );
 
-	glEndList();
+	// the planets are drawn from the geometry pool's copy of the sphere:
 
-	Sat_C = glGenLists(1);
-	glNewList(Sat_C, GL_COMPILE);
-	radius = 8.90f * 0.5 + 1;
+	struct SurfaceMesh sphere;
+	OsuSphere( 1., 100, 100, &sphere );
+	PlanetMesh.AddSurface( sphere );
+	PlanetMesh.Upload( );
+	PoolPlanet = Pool.AddMesh( sphere );
 
-	glBegin(GL_LINE_LOOP);
-	for (int i = 0; i < 100; ++i) {
-		float theta = 2.0f * 3.1415926f * float(i) / float(100);
-		float x = radius * cosf(theta);
-		float z = radius * sinf(theta);
-		glVertex3f(x, 0, z);
-	}
-	glEnd();
+	// the sun is drawn from PlanetMesh too, so it works in both pipelines
 
-	glEndList();
+	// the moons and satellites are instances of a coarser sphere:
 
-	Ura_C = glGenLists(1);
-	glNewList(Ura_C, GL_COMPILE);
-	radius = 17.87f * 0.5 + 1;
+	struct SurfaceMesh moon;
+	OsuSphere( 1., 12, 12, &moon );
+	MoonMesh.AddSurface( moon );
+	MoonMesh.Upload( );
 
-	glBegin(GL_LINE_LOOP);
-	for (int i = 0; i < 100; ++i) {
-		float theta = 2.0f * 3.1415926f * float(i) / float(100);
-		float x = radius * cosf(theta);
-		float z = radius * sinf(theta);
-		glVertex3f(x, 0, z);
-	}
-	glEnd();
+	// picking does not read anything back from the gpu, so it has its own copies of their triangles:
 
-	glEndList();
+	PickPlanetMesh = Picking.AddMesh( sphere );
+	PickMoonMesh = Picking.AddMesh( moon );
 
-	Nep_C = glGenLists(1);
-	glNewList(Nep_C, GL_COMPILE);
-	radius = 27.98f * 0.5 + 1;
 
-	glBegin(GL_LINE_LOOP);
-	for (int i = 0; i < 100; ++i) {
-		float theta = 2.0f * 3.1415926f * float(i) / float(100);
-		float x = radius * cosf(theta);
-		float z = radius * sinf(theta);
-		glVertex3f(x, 0, z);
-	}
-	glEnd();
-
-	glEndList();
-	// create the axes:
-
-	AxesList = glGenLists( 1 );
-	glNewList( AxesList, GL_COMPILE );
-		glLineWidth( AXES_WIDTH );
-			Axes( 1.5 );
-		glLineWidth( 1. );
-	glEndList( );
+	// the orbit rings and the axes are not display lists any more --
+	// Display( ) puts them into the line batch every frame
 }
 
 
@@ -1578,6 +1507,15 @@ Keyboard( unsigned char c, int x, int y )
 				textureMode = 1;
 			}
 			break;
+		case 'f':
+		case 'F':
+			Frozen = ! Frozen;
+			if( Frozen )
+				glutIdleFunc( NULL );
+			else
+				glutIdleFunc( Animate );
+			break;
+
 		case 'l':
 		case 'L':
 			if (lightingMode == 1)
@@ -1606,6 +1544,105 @@ Keyboard( unsigned char c, int x, int y )
 }
 
 
+// load a bmp file into a texture object, for BodyStore::LoadTextures( ):
+// (a file that cannot be read makes an empty texture, so that whatever uses it is still drawn)
+
+GLuint
+LoadTexture( const char *file )
+{
+	int width, height;
+	unsigned char *texture = BmpToTexture( (char *)file, &width, &height );
+	if( texture == NULL )
+		fprintf( stderr, "Cannot open texture '%s'\n", file );
+	else
+		fprintf( stderr, "Opened '%s': width = %d ; height = %d\n", file, width, height );
+
+	GLuint tex;
+	glGenTextures( 1, &tex );
+	glBindTexture( GL_TEXTURE_2D, tex );
+	GLDEBUG_LABEL( GL_TEXTURE, tex, file );
+	glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
+	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT );
+	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT );
+	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
+	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR );
+	if( texture != NULL )
+	{
+		glTexImage2D( GL_TEXTURE_2D, 0, 3, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, texture );
+		delete [ ] texture;
+	}
+	GLDEBUG_CHECK( "LoadTexture" );
+	return tex;
+}
+
+
+// build the scene -- the sun and planets from the scene file, each planet with moons moons,
+// each with satellites satellites:
+// (the moons are scattered, but the same way every time)
+
+void
+MakeSolarSystem( int moons, int satellites )
+{
+	Frames.Discard( );		// the worker is done with the old one, and the packet it has ready is out of date
+	Solar.Clear( );
+	Bodies.Clear( );
+	Bodies.Load( SCENEFILE, &PlanetMesh );
+	Bodies.LoadTextures( LoadTexture );
+	srand( 1 );
+
+	// a moon is in its planet's units, and a satellite in its moon's,
+	// so how far out they are and how big they are is in radii of what they go around:
+
+	std::vector<int> planets;
+	Bodies.Select( 0, BODY_GLOWS, planets );
+	for( int i = 0; i < (int)planets.size( ); i++ )
+	{
+		for( int m = 0; m < moons; m++ )
+		{
+			float rate = Ranf( 2.f, 10.f );
+			float phase = Ranf( 0.f, 1.f );
+			float tilt = Ranf( -30.f, 30.f );
+			float distance = Ranf( 1.5f, 4.f );
+			float radius = Ranf( 0.05f, 0.15f );
+			int moon = Bodies.AddBody( NULL, planets[i], distance, radius, &MoonMesh, BODY_INSTANCED );
+			Bodies.SetOrbit( moon, rate, phase, tilt );
+
+			for( int k = 0; k < satellites; k++ )
+			{
+				rate = Ranf( 20.f, 40.f );
+				phase = Ranf( 0.f, 1.f );
+				tilt = Ranf( -90.f, 90.f );
+				distance = Ranf( 1.5f, 2.5f );
+				int satellite = Bodies.AddBody( NULL, moon, distance, 0.3f, &MoonMesh, BODY_INSTANCED );
+				Bodies.SetOrbit( satellite, rate, phase, tilt );
+			}
+		}
+	}
+
+	Bodies.Build( Solar );
+	Bodies.Select( 0, BODY_INSTANCED | BODY_GLOWS, LitBodies );
+	Bodies.Select( BODY_GLOWS, BODY_INSTANCED, GlowingBodies );
+	Bodies.Select( BODY_RING, 0, RingBodies );
+	LitLayers.resize( LitBodies.size( ) );
+	for( int i = 0; i < (int)LitBodies.size( ); i++ )
+		LitLayers[i] = Pool.AddTexture( Bodies.GetTexture( LitBodies[i] ) );
+
+	SceneTime = -1.;
+	Bodies.Move( Solar, 0. );
+	Solar.Update( );
+	FitMoonTree( true );
+	ReportFrames = 0;
+
+	// every body is a pickable object, with the same number:
+
+	Picking.ClearObjects( );
+	for( int i = 0; i < Bodies.GetNumBodies( ); i++ )
+		Picking.AddObject( Bodies.GetMesh( i ) == &MoonMesh  ?  PickMoonMesh  :  PickPlanetMesh, &Solar.GetWorld( Bodies.GetNode( i ) )[0][0] );
+	Picking.Build( );
+	Picked = NO_BODY;
+}
+
+
 // called when the mouse button transitions down or up:
 
 void
@@ -1656,10 +1693,17 @@ MouseButton( int button, int state, int x, int y )
 		Xmouse = x;
 		Ymouse = y;
 		ActiveButton |= b;		// set the proper bit
+		if( b == LEFT )
+		{
+			ClickX = x;
+			ClickY = y;
+		}
 	}
 	else
 	{
 		ActiveButton &= ~b;		// clear the proper bit
+		if( b == LEFT  &&  x == ClickX  &&  y == ClickY )
+			PickBody( x, y );
 	}
 
 	glutSetWindow(MainWindow);
@@ -1700,6 +1744,48 @@ MouseMotion( int x, int y )
 }
 
 
+// pick the body under window position (x,y), which is glut's, with y down from the top:
+// (the picking bvh is refit to where the bodies are now first -- the worker is a frame ahead, so
+// that is where they are drawn next)
+
+void
+PickBody( int x, int y )
+{
+	Frames.Wait( );			// so the worker is not moving the scene graph
+	for( int i = 0; i < Bodies.GetNumBodies( ); i++ )
+		Picking.SetWorld( i, &Solar.GetWorld( Bodies.GetNode( i ) )[0][0] );
+
+	PickHit hit;
+	int height = glutGet( GLUT_WINDOW_HEIGHT );
+	if( Picking.Pick( (float)x + 0.5f, (float)( height - 1 - y ) + 0.5f, PickProjection, PickModelview, PickViewport, hit ) )
+	{
+		// a moon or a satellite does not have a name, so it is called after the body it goes around:
+
+		Picked = hit.Object;
+		int named = Picked;
+		int levels = 0;
+		while( Bodies.GetName( named )[0] == '\0'  &&  Bodies.GetParent( named ) != NO_BODY )
+		{
+			named = Bodies.GetParent( named );
+			levels++;
+		}
+		fprintf( stderr, "Picked %s%s%s (body %d), triangle %d, at (%.3f, %.3f, %.3f)\n",
+			levels >= 2 ? "a satellite of a moon of " : "", levels == 1 ? "a moon of " : "", Bodies.GetName( named ),
+			Picked, hit.Triangle, hit.Point[0], hit.Point[1], hit.Point[2] );
+	}
+	else
+	{
+		Picked = NO_BODY;
+		fprintf( stderr, "Picked nothing\n" );
+	}
+	if( DebugOn != 0 )
+		Picking.PrintStats( stderr );
+
+	glutSetWindow( MainWindow );
+	glutPostRedisplay( );
+}
+
+
 // reset the transformations and the colors:
 // this only sets the global variables --
 // the glut main loop is responsible for redrawing the scene
@@ -1717,7 +1803,81 @@ Reset( )
 	ShadowsOn = 0;
 	NowColor = YELLOW;
 	NowProjection = PERSP;
+	PipelineCheck = 0;
 	Xrot = Yrot = 0.;
+	DoSceneMenu( SCENE_PLANETS );
+}
+
+
+// put each moon's and satellite's bounding sphere, in world coordinates, into the sphere tree --
+// build = true sorts them into a new tree (when the scene graph is made), otherwise the
+// tree is only refit to where they went:
+
+void
+FitMoonTree( bool build )
+{
+	int n = Solar.GetNumInstances( );
+	float c[3], r;
+	MoonMesh.GetBoundingSphere( c, &r );
+
+	std::vector<float> x( n ), y( n ), z( n ), radii( n );
+	for( int i = 0; i < n; i++ )
+	{
+		const glm::mat4 &world = Solar.GetInstanceWorld( i );
+		glm::vec4 center = world * glm::vec4( c[0], c[1], c[2], 1. );
+		x[i] = center.x;
+		y[i] = center.y;
+		z[i] = center.z;
+		radii[i] = r * glm::length( glm::vec3( world[0] ) );		// the scales are uniform
+		if( ! build )
+			MoonTree.SetSphere( i, x[i], y[i], z[i], radii[i] );
+	}
+	if( build )
+		MoonTree.Build( n, x.data( ), y.data( ), z.data( ), radii.data( ) );
+	else
+		MoonTree.Refit( );
+}
+
+
+// move the scene graph to where the packet's Time says everything is -- on the worker:
+// (if Time has not changed -- the animation is frozen -- nothing is marked dirty, and Update( )
+// does not recompute anything)
+
+void
+UpdateSolarSystem( int which )
+{
+	FramePacket &packet = Packets[which];
+	if( packet.Time != SceneTime )
+	{
+		SceneTime = packet.Time;
+		Bodies.Move( Solar, packet.Time );
+	}
+	Solar.Update( );
+	if( Solar.GetNumInstances( ) > 0  &&  Solar.GetNodesUpdated( ) > 0 )
+		FitMoonTree( false );
+
+	if( packet.Debug != 0 )
+	{
+		Bodies.PrintStats( stderr );
+		Solar.PrintStats( stderr );
+	}
+
+	packet.Report = false;
+	if( packet.Scene != SCENE_PLANETS )
+	{
+		int ms = packet.Ms;
+		if( ReportFrames == 0 )
+			ReportStartMs = ms;
+		if( ++ReportFrames > SCENE_REPORT )
+		{
+			fprintf( stderr, "%.2f ms/frame -- ", (double)( ms - ReportStartMs ) / (double)SCENE_REPORT );
+			Bodies.PrintStats( stderr );
+			Solar.PrintStats( stderr );
+			MoonTree.PrintStats( stderr );
+			packet.Report = true;
+			ReportFrames = 0;
+		}
+	}
 }
 
 
@@ -1786,72 +1946,72 @@ const float LENFRAC = 0.10f;
 // fraction of length to use as start location of the characters:
 const float BASEFRAC = 1.10f;
 
-//	Draw a set of 3D axes:
+//	Add a set of 3D axes to the line batch:
 //	(length is the axis length in world coordinates)
 
 void
 Axes( float length )
 {
-	glBegin( GL_LINE_STRIP );
-		glVertex3f( length, 0., 0. );
-		glVertex3f( 0., 0., 0. );
-		glVertex3f( 0., length, 0. );
-	glEnd( );
-	glBegin( GL_LINE_STRIP );
-		glVertex3f( 0., 0., 0. );
-		glVertex3f( 0., 0., length );
-	glEnd( );
+	Lines.BeginStrip( );
+		Lines.Vertex( length, 0., 0. );
+		Lines.Vertex( 0., 0., 0. );
+		Lines.Vertex( 0., length, 0. );
+	Lines.EndStrip( );
+	Lines.BeginStrip( );
+		Lines.Vertex( 0., 0., 0. );
+		Lines.Vertex( 0., 0., length );
+	Lines.EndStrip( );
 
 	float fact = LENFRAC * length;
 	float base = BASEFRAC * length;
 
-	glBegin( GL_LINE_STRIP );
+	Lines.BeginStrip( );
 		for( int i = 0; i < 4; i++ )
 		{
 			int j = xorder[i];
 			if( j < 0 )
 			{
 				
-				glEnd( );
-				glBegin( GL_LINE_STRIP );
+				Lines.EndStrip( );
+				Lines.BeginStrip( );
 				j = -j;
 			}
 			j--;
-			glVertex3f( base + fact*xx[j], fact*xy[j], 0.0 );
+			Lines.Vertex( base + fact*xx[j], fact*xy[j], 0.0 );
 		}
-	glEnd( );
+	Lines.EndStrip( );
 
-	glBegin( GL_LINE_STRIP );
+	Lines.BeginStrip( );
 		for( int i = 0; i < 5; i++ )
 		{
 			int j = yorder[i];
 			if( j < 0 )
 			{
 				
-				glEnd( );
-				glBegin( GL_LINE_STRIP );
+				Lines.EndStrip( );
+				Lines.BeginStrip( );
 				j = -j;
 			}
 			j--;
-			glVertex3f( fact*yx[j], base + fact*yy[j], 0.0 );
+			Lines.Vertex( fact*yx[j], base + fact*yy[j], 0.0 );
 		}
-	glEnd( );
+	Lines.EndStrip( );
 
-	glBegin( GL_LINE_STRIP );
+	Lines.BeginStrip( );
 		for( int i = 0; i < 6; i++ )
 		{
 			int j = zorder[i];
 			if( j < 0 )
 			{
 				
-				glEnd( );
-				glBegin( GL_LINE_STRIP );
+				Lines.EndStrip( );
+				Lines.BeginStrip( );
 				j = -j;
 			}
 			j--;
-			glVertex3f( 0.0, fact*zy[j], base + fact*zx[j] );
+			Lines.Vertex( 0.0, fact*zy[j], base + fact*zx[j] );
 		}
-	glEnd( );
+	Lines.EndStrip( );
 
 }
 
@@ -1986,3 +2146,15 @@ Unit( float v[3] )
 	}
 	return dist;
 }
+
+
+// a random number between low and high:
+
+float
+Ranf( float low, float high )
+{
+	float r = (float) rand( );		// 0 - RAND_MAX
+	float t = r / (float) RAND_MAX;		// 0. - 1.
+
+	return low + t * ( high - low );
+}
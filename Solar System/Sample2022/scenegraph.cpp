@@ -0,0 +1,287 @@
+#ifndef SCENEGRAPH_CPP
+#define SCENEGRAPH_CPP
+
+#include "scenegraph.h"
+
+#include <chrono>
+
+#if( GLM_ARCH & GLM_ARCH_SSE2 )
+#include "glm/gtx/simd_mat4.hpp"
+#endif
+
+
+SceneGraph::SceneGraph( )
+{
+	Reorder = false;
+	NodesUpdated = 0;
+	UpdateMs = 0.;
+}
+
+
+// add a node under parent (a node that AddNode( ) returned, or SCENE_ROOT):
+// returns the new node, which starts out with no translation, no rotation, and a scale of 1.
+
+int
+SceneGraph::AddNode( int parent, bool instance )
+{
+	if( parent != SCENE_ROOT  &&  ( parent < 0  ||  parent >= (int)SlotOf.size( ) ) )
+	{
+		fprintf( stderr, "SceneGraph::AddNode: there is no node %d to be the parent\n", parent );
+		parent = SCENE_ROOT;
+	}
+
+	// it goes on the end for now -- Update( ) puts it in its breadth-first place:
+
+	int slot = (int)Parents.size( );
+	Parents.push_back( parent == SCENE_ROOT  ?  SCENE_ROOT  :  SlotOf[parent] );
+	Translations.push_back( glm::vec3( 0., 0., 0. ) );
+	Rotations.push_back( glm::quat( 1., 0., 0., 0. ) );
+	Scales.push_back( glm::vec3( 1., 1., 1. ) );
+	Dirty.push_back( 1 );
+	Moved.push_back( 0 );
+	Worlds.push_back( glm::mat4( 1. ) );
+	InstanceOf.push_back( instance  ?  (int)Instances.size( )  :  -1 );
+	if( instance )
+		Instances.push_back( glm::mat4( 1. ) );
+
+	int node = (int)SlotOf.size( );
+	SlotOf.push_back( slot );
+	NodeOf.push_back( node );
+	Reorder = true;
+	return node;
+}
+
+
+// get rid of every node:
+
+void
+SceneGraph::Clear( )
+{
+	Parents.clear( );
+	Translations.clear( );
+	Rotations.clear( );
+	Scales.clear( );
+	Dirty.clear( );
+	Moved.clear( );
+	Worlds.clear( );
+	InstanceOf.clear( );
+	NodeOf.clear( );
+	SlotOf.clear( );
+	Instances.clear( );
+	Reorder = false;
+}
+
+
+// the world matrix of the i-th instance, as of the last Update( ):
+
+const glm::mat4 &
+SceneGraph::GetInstanceWorld( int i )
+{
+	return Instances[i];
+}
+
+
+int
+SceneGraph::GetNumInstances( )
+{
+	return (int)Instances.size( );
+}
+
+
+int
+SceneGraph::GetNumNodes( )
+{
+	return (int)SlotOf.size( );
+}
+
+
+int
+SceneGraph::GetNodesUpdated( )
+{
+	return NodesUpdated;
+}
+
+
+// a node's world matrix, as of the last Update( ):
+
+const glm::mat4 &
+SceneGraph::GetWorld( int node )
+{
+	return Worlds[ SlotOf[node] ];
+}
+
+
+void
+SceneGraph::PrintStats( FILE *fp )
+{
+	fprintf( fp, "SceneGraph: %d nodes, %d updated in %.3f ms ; %d instances\n",
+		GetNumNodes( ), NodesUpdated, UpdateMs, GetNumInstances( ) );
+}
+
+
+void
+SceneGraph::SetRotation( int node, float degrees, float ax, float ay, float az )
+{
+	SetRotation( node, glm::angleAxis( glm::radians( degrees ), glm::normalize( glm::vec3( ax, ay, az ) ) ) );
+}
+
+
+void
+SceneGraph::SetRotation( int node, const glm::quat &q )
+{
+	int slot = SlotOf[node];
+	Rotations[slot] = q;
+	Dirty[slot] = 1;
+}
+
+
+void
+SceneGraph::SetScale( int node, float s )
+{
+	SetScale( node, s, s, s );
+}
+
+
+void
+SceneGraph::SetScale( int node, float sx, float sy, float sz )
+{
+	int slot = SlotOf[node];
+	Scales[slot] = glm::vec3( sx, sy, sz );
+	Dirty[slot] = 1;
+}
+
+
+void
+SceneGraph::SetTranslation( int node, float tx, float ty, float tz )
+{
+	int slot = SlotOf[node];
+	Translations[slot] = glm::vec3( tx, ty, tz );
+	Dirty[slot] = 1;
+}
+
+
+// put the slots in breadth-first order:
+// (the instance slots are given out again in the same order, so that nodes at the same depth,
+// which tend to change together, are next to each other in the instance buffer too)
+
+void
+SceneGraph::Sort( )
+{
+	int n = (int)Parents.size( );
+
+	// each slot's children, in the order they were added:
+
+	std::vector<int> first( n + 1, 0 );
+	for( int s = 0; s < n; s++ )
+	{
+		if( Parents[s] != SCENE_ROOT )
+			first[ Parents[s] + 1 ]++;
+	}
+	for( int s = 0; s < n; s++ )
+		first[s+1] += first[s];
+	std::vector<int> children( first[n] );
+	std::vector<int> fill( first.begin( ), first.end( ) - 1 );
+	for( int s = 0; s < n; s++ )
+	{
+		if( Parents[s] != SCENE_ROOT )
+			children[ fill[ Parents[s] ]++ ] = s;
+	}
+
+	// the roots, then everything below them, one level at a time:
+
+	std::vector<int> order;
+	order.reserve( n );
+	for( int s = 0; s < n; s++ )
+	{
+		if( Parents[s] == SCENE_ROOT )
+			order.push_back( s );
+	}
+	for( int head = 0; head < (int)order.size( ); head++ )
+	{
+		int s = order[head];
+		for( int c = first[s]; c < first[s+1]; c++ )
+			order.push_back( children[c] );
+	}
+
+	std::vector<int> newSlot( n );
+	for( int i = 0; i < n; i++ )
+		newSlot[ order[i] ] = i;
+
+	std::vector<int> parents( n ), instanceOf( n ), nodeOf( n );
+	std::vector<glm::vec3> translations( n ), scales( n );
+	std::vector<glm::quat> rotations( n );
+	int instances = 0;
+	for( int i = 0; i < n; i++ )
+	{
+		int s = order[i];
+		parents[i] = Parents[s] == SCENE_ROOT  ?  SCENE_ROOT  :  newSlot[ Parents[s] ];
+		translations[i] = Translations[s];
+		rotations[i] = Rotations[s];
+		scales[i] = Scales[s];
+		instanceOf[i] = InstanceOf[s] < 0  ?  -1  :  instances++;
+		nodeOf[i] = NodeOf[s];
+		SlotOf[ nodeOf[i] ] = i;
+	}
+	Parents.swap( parents );
+	Translations.swap( translations );
+	Rotations.swap( rotations );
+	Scales.swap( scales );
+	InstanceOf.swap( instanceOf );
+	NodeOf.swap( nodeOf );
+
+	// everything has to be computed again, in its new place:
+
+	Dirty.assign( n, 1 );
+	Reorder = false;
+}
+
+
+// compute the world matrix of every node that moved:
+
+void
+SceneGraph::Update( )
+{
+	if( Reorder )
+		Sort( );
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now( );
+
+	int n = (int)Parents.size( );
+	NodesUpdated = 0;
+	for( int i = 0; i < n; i++ )
+	{
+		int p = Parents[i];
+		bool moved = Dirty[i] != 0  ||  ( p != SCENE_ROOT  &&  Moved[p] != 0 );
+		Moved[i] = moved ? 1 : 0;
+		if( ! moved )
+			continue;
+		Dirty[i] = 0;
+		NodesUpdated++;
+
+		// T * R * S, put straight into the columns:
+
+		glm::mat3 r = glm::mat3_cast( Rotations[i] );
+		const glm::vec3 &s = Scales[i];
+		glm::mat4 local( glm::vec4( r[0] * s.x, 0. ), glm::vec4( r[1] * s.y, 0. ), glm::vec4( r[2] * s.z, 0. ),
+				 glm::vec4( Translations[i], 1. ) );
+
+		if( p == SCENE_ROOT )
+			Worlds[i] = local;
+		else
+		{
+#if( GLM_ARCH & GLM_ARCH_SSE2 )
+			Worlds[i] = glm::mat4_cast( glm::simdMat4( Worlds[p] ) * glm::simdMat4( local ) );
+#else
+			Worlds[i] = Worlds[p] * local;
+#endif
+		}
+
+		int k = InstanceOf[i];
+		if( k >= 0 )
+			Instances[k] = Worlds[i];
+	}
+
+	UpdateMs = std::chrono::duration<double, std::milli>( std::chrono::steady_clock::now( ) - start ).count( );
+}
+
+#endif		// #ifndef SCENEGRAPH_CPP
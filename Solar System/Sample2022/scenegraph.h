@@ -0,0 +1,99 @@
+#ifndef SCENEGRAPH_H
+#define SCENEGRAPH_H
+
+#include <stdio.h>
+#include <vector>
+
+#include "glew.h"
+#include <GL/gl.h>
+
+#include "glm/glm.hpp"
+#include "glm/gtc/quaternion.hpp"
+
+
+// a transform hierarchy -- planet, moon, satellite, ... -- instead of a chain of
+// PushMatrix( ), Rotate( ), Translate( ), and PopMatrix( ) for every object, every frame:
+//
+//	each node has a parent and a local translation, rotation, and scale, and its world matrix is
+//	its parent's world matrix * T * R * S -- the same thing the matrix stack computed
+//	Update( ) computes every world matrix in one pass over the nodes, which are kept in
+//	breadth-first order (the root nodes, then all of their children, then all of theirs, ...),
+//	so a parent is always done before its children, and in separate arrays for the translations,
+//	rotations, etc., which the pass reads straight through from front to back
+//	the multiplies use glm's simdMat4 (SSE2) when the compiler has it, and plain glm::mat4 if not
+//
+//	setting a node's translation, rotation, or scale marks it dirty -- a node is only recomputed
+//	if it is dirty or its parent was recomputed, so a subtree that did not move costs Update( )
+//	one test per node
+//
+//	a node made with instance = true also gets an instance slot: GetInstanceWorld( ) is its world
+//	matrix, and the instances' matrices are kept together, in slot order, so the ones to be drawn
+//	can be copied straight into a stream buffer (see streambuffer.h) for Mesh::InstanceAttribute( )
+//	and DrawInstanced( )
+//	a node that is only there to move its children (like an orbit) should not be an instance
+//	the rotations are quaternions, so only uniform scales keep the normals right in a shader
+//	that uses mat3( world ) on them
+//
+//	use:
+//		SceneGraph Solar;
+//		int orbit = Solar.AddNode( SCENE_ROOT, false );		// once
+//		int earth = Solar.AddNode( orbit, false );
+//		int moon = Solar.AddNode( earth, true );
+//		Solar.SetTranslation( earth, 0., 0., -1.5 );
+//		Solar.SetScale( earth, 0.1 );
+//		...
+//		Solar.SetRotation( orbit, 360.f*Time, 0., 1., 0. );	// every frame
+//		Solar.Update( );
+//		Pipeline.PushMatrix( );
+//			Pipeline.MultMatrix( Solar.GetWorld( earth ) );
+//			Pipeline.Draw( &Planet );
+//		Pipeline.PopMatrix( );
+//		...copy Solar.GetInstanceWorld( i ) for each moon into a stream buffer...
+//		Pipeline.DrawInstanced( &Moon, Solar.GetNumInstances( ) );
+
+const int SCENE_ROOT = -1;			// the "parent" of a node that has none
+
+class SceneGraph
+{
+  private:
+	// by slot, in breadth-first order:
+
+	std::vector<int>		Parents;		// slot of the parent, or SCENE_ROOT
+	std::vector<glm::vec3>		Translations;
+	std::vector<glm::quat>		Rotations;
+	std::vector<glm::vec3>		Scales;
+	std::vector<unsigned char>	Dirty;			// the local transform changed
+	std::vector<unsigned char>	Moved;			// the world matrix changed in this Update( )
+	std::vector<glm::mat4>		Worlds;
+	std::vector<int>		InstanceOf;		// instance slot, or -1
+	std::vector<int>		NodeOf;			// the node that is in each slot
+
+	std::vector<int>		SlotOf;			// by node
+	std::vector<glm::mat4>		Instances;		// by instance slot
+	bool				Reorder;		// a node was added since the last Update( )
+
+	int				NodesUpdated;		// by the last Update( )
+	double				UpdateMs;
+
+	void	Sort( );
+
+  public:
+		SceneGraph( );
+
+	int			AddNode( int, bool );
+	void			Clear( );
+	const glm::mat4 &	GetInstanceWorld( int );
+	int			GetNumInstances( );
+	int			GetNumNodes( );
+	int			GetNodesUpdated( );
+	const glm::mat4 &	GetWorld( int );
+	void			PrintStats( FILE * );
+	void			SetRotation( int, float, float, float, float );
+	void			SetRotation( int, const glm::quat & );
+	void			SetScale( int, float );
+	void			SetScale( int, float, float, float );
+	void			SetTranslation( int, float, float, float );
+	void			Update( );
+};
+
+#endif		// #ifndef SCENEGRAPH_H
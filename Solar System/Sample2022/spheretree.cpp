@@ -0,0 +1,261 @@
+#ifndef SPHERETREE_CPP
+#define SPHERETREE_CPP
+
+#include "spheretree.h"
+
+#include <math.h>
+#include <algorithm>
+
+
+SphereTree::SphereTree( )
+{
+	NodesVisited = Accepted = Rejected = LeafTests = NumVisible = 0;
+	Visible.resize( SPHERETREE_LEAF );
+}
+
+
+// make the tree for n spheres -- object i is at (x[i],y[i],z[i]) with radius r[i]:
+
+void
+SphereTree::Build( int n, const float *x, const float *y, const float *z, const float *r )
+{
+	X.assign( x, x + n );
+	Y.assign( y, y + n );
+	Z.assign( z, z + n );
+	R.assign( r, r + n );
+	Ids.resize( n );
+	for( int i = 0; i < n; i++ )
+		Ids[i] = i;
+
+	Nodes.clear( );
+	if( n > 0 )
+		BuildNode( 0, n );
+
+	PlaceOf.resize( n );
+	for( int i = 0; i < n; i++ )
+		PlaceOf[ Ids[i] ] = i;
+
+	Refit( );
+}
+
+
+// the node for the spheres from first to first+count-1 -- they are split in half at the
+// middle of whichever direction they are most spread out in:
+
+int
+SphereTree::BuildNode( int first, int count )
+{
+	int index = (int)Nodes.size( );
+	Nodes.push_back( TreeNode( ) );
+	Nodes[index].First = first;
+	Nodes[index].Count = count;
+	Nodes[index].Left = Nodes[index].Right = -1;
+	if( count <= SPHERETREE_LEAF )
+		return index;
+
+	float lo[3] = { X[first], Y[first], Z[first] };
+	float hi[3] = { X[first], Y[first], Z[first] };
+	for( int i = first + 1; i < first + count; i++ )
+	{
+		float c[3] = { X[i], Y[i], Z[i] };
+		for( int k = 0; k < 3; k++ )
+		{
+			if( c[k] < lo[k] )	lo[k] = c[k];
+			if( c[k] > hi[k] )	hi[k] = c[k];
+		}
+	}
+	int axis = 0;
+	if( hi[1] - lo[1] > hi[axis] - lo[axis] )	axis = 1;
+	if( hi[2] - lo[2] > hi[axis] - lo[axis] )	axis = 2;
+	const std::vector<float> &key = axis == 0  ?  X  :  ( axis == 1  ?  Y  :  Z );
+
+	std::vector<int> order( count );
+	for( int i = 0; i < count; i++ )
+		order[i] = first + i;
+	int half = count / 2;
+	std::nth_element( order.begin( ), order.begin( ) + half, order.end( ),
+		[&key]( int a, int b ) { return key[a] < key[b]; } );
+
+	std::vector<float> x( count ), y( count ), z( count ), r( count );
+	std::vector<int> ids( count );
+	for( int i = 0; i < count; i++ )
+	{
+		x[i] = X[ order[i] ];
+		y[i] = Y[ order[i] ];
+		z[i] = Z[ order[i] ];
+		r[i] = R[ order[i] ];
+		ids[i] = Ids[ order[i] ];
+	}
+	std::copy( x.begin( ), x.end( ), X.begin( ) + first );
+	std::copy( y.begin( ), y.end( ), Y.begin( ) + first );
+	std::copy( z.begin( ), z.end( ), Z.begin( ) + first );
+	std::copy( r.begin( ), r.end( ), R.begin( ) + first );
+	std::copy( ids.begin( ), ids.end( ), Ids.begin( ) + first );
+
+	int left = BuildNode( first, half );
+	int right = BuildNode( first + half, count - half );
+	Nodes[index].Left = left;
+	Nodes[index].Right = right;
+	return index;
+}
+
+
+// the numbers of the objects that might be visible go into visible:
+// returns how many there are
+
+int
+SphereTree::Cull( const Frustum &frustum, std::vector<int> &visible )
+{
+	visible.clear( );
+	NodesVisited = Accepted = Rejected = LeafTests = NumVisible = 0;
+	if( Nodes.empty( ) )
+		return 0;
+
+	Stack.clear( );
+	Stack.push_back( 0 );
+	while( ! Stack.empty( ) )
+	{
+		const TreeNode &node = Nodes[ Stack.back( ) ];
+		Stack.pop_back( );
+		NodesVisited++;
+
+		int where = frustum.ClassifySphere( node.Center, node.Radius );
+		if( where == FRUSTUM_OUTSIDE )
+		{
+			Rejected += node.Count;
+		}
+		else if( where == FRUSTUM_INSIDE )
+		{
+			visible.insert( visible.end( ), Ids.begin( ) + node.First, Ids.begin( ) + node.First + node.Count );
+			Accepted += node.Count;
+		}
+		else if( node.Left < 0 )
+		{
+			int f = node.First;
+			frustum.SpheresVisible( node.Count, &X[f], &Y[f], &Z[f], &R[f], &Visible[0] );
+			for( int k = 0; k < node.Count; k++ )
+			{
+				if( Visible[k] )
+					visible.push_back( Ids[f+k] );
+			}
+			LeafTests += node.Count;
+		}
+		else
+		{
+			Stack.push_back( node.Right );
+			Stack.push_back( node.Left );
+		}
+	}
+	NumVisible = (int)visible.size( );
+	return NumVisible;
+}
+
+
+// a leaf's sphere is centered in the box around its spheres' centers, and just reaches the farthest one:
+
+void
+SphereTree::FitLeaf( TreeNode &node )
+{
+	int f = node.First;
+	float lo[3] = { X[f], Y[f], Z[f] };
+	float hi[3] = { X[f], Y[f], Z[f] };
+	for( int i = f + 1; i < f + node.Count; i++ )
+	{
+		float c[3] = { X[i], Y[i], Z[i] };
+		for( int k = 0; k < 3; k++ )
+		{
+			if( c[k] < lo[k] )	lo[k] = c[k];
+			if( c[k] > hi[k] )	hi[k] = c[k];
+		}
+	}
+	for( int k = 0; k < 3; k++ )
+		node.Center[k] = 0.5f * ( lo[k] + hi[k] );
+
+	node.Radius = 0.;
+	for( int i = f; i < f + node.Count; i++ )
+	{
+		float dx = X[i] - node.Center[0];
+		float dy = Y[i] - node.Center[1];
+		float dz = Z[i] - node.Center[2];
+		float reach = sqrtf( dx*dx + dy*dy + dz*dz ) + R[i];
+		if( reach > node.Radius )
+			node.Radius = reach;
+	}
+}
+
+
+// the smallest sphere that holds both children's:
+
+void
+SphereTree::FitParent( TreeNode &node, const TreeNode &a, const TreeNode &b )
+{
+	float d[3] = { b.Center[0] - a.Center[0], b.Center[1] - a.Center[1], b.Center[2] - a.Center[2] };
+	float dist = sqrtf( d[0]*d[0] + d[1]*d[1] + d[2]*d[2] );
+	if( dist + b.Radius <= a.Radius )
+	{
+		for( int k = 0; k < 3; k++ )
+			node.Center[k] = a.Center[k];
+		node.Radius = a.Radius;
+	}
+	else if( dist + a.Radius <= b.Radius )
+	{
+		for( int k = 0; k < 3; k++ )
+			node.Center[k] = b.Center[k];
+		node.Radius = b.Radius;
+	}
+	else
+	{
+		node.Radius = 0.5f * ( dist + a.Radius + b.Radius );
+		float t = ( node.Radius - a.Radius ) / dist;
+		for( int k = 0; k < 3; k++ )
+			node.Center[k] = a.Center[k] + t * d[k];
+	}
+}
+
+
+int
+SphereTree::GetNumSpheres( )
+{
+	return (int)Ids.size( );
+}
+
+
+// what the last Cull( ) did:
+
+void
+SphereTree::PrintStats( FILE *fp )
+{
+	fprintf( fp, "SphereTree: %d of %d visible -- %d nodes visited, %d taken whole, %d thrown away whole, %d tested in leaves\n",
+		NumVisible, GetNumSpheres( ), NodesVisited, Accepted, Rejected, LeafTests );
+}
+
+
+// fit the node spheres to where the spheres are now, children first:
+
+void
+SphereTree::Refit( )
+{
+	for( int i = (int)Nodes.size( ) - 1; i >= 0; i-- )
+	{
+		TreeNode &node = Nodes[i];
+		if( node.Left < 0 )
+			FitLeaf( node );
+		else
+			FitParent( node, Nodes[node.Left], Nodes[node.Right] );
+	}
+}
+
+
+// object id moved (or changed size) -- Refit( ) makes the tree fit again:
+
+void
+SphereTree::SetSphere( int id, float x, float y, float z, float r )
+{
+	int place = PlaceOf[id];
+	X[place] = x;
+	Y[place] = y;
+	Z[place] = z;
+	R[place] = r;
+}
+
+#endif		// #ifndef SPHERETREE_CPP
@@ -0,0 +1,69 @@
+#ifndef SPHERETREE_H
+#define SPHERETREE_H
+
+#include <stdio.h>
+#include <vector>
+
+#include "frustum.cpp"
+
+
+// a bounding volume hierarchy of spheres, for frustum culling a lot of objects at once:
+//
+//	each object is a bounding sphere, known by the number it was given to Build( ) with
+//	Build( ) sorts them into a binary tree -- each node's sphere holds its two children's, and each
+//	leaf holds up to SPHERETREE_LEAF objects -- so that Cull( ) can throw away a whole subtree that
+//	is outside the frustum, and take a whole subtree that is inside it, with one test
+//	the objects in a leaf that straddles the frustum are tested together with
+//	Frustum::SpheresVisible( ), which does 4 at a time
+//
+//	objects that move get SetSphere( ) and then one Refit( ), which grows and shrinks the
+//	node spheres to fit without changing the tree -- that is cheap, but if the objects wander
+//	far from where they were when it was built, the tree gets loose and Build( ) should be done again
+//
+//	use:
+//		SphereTree Moons;
+//		Moons.Build( n, x, y, z, r );			// once
+//		...
+//		Moons.SetSphere( i, x, y, z, r );		// for each one that moved
+//		Moons.Refit( );
+//		std::vector<int> visible;
+//		Moons.Cull( view, visible );			// the numbers of the ones to draw
+
+const int SPHERETREE_LEAF = 8;
+
+class SphereTree
+{
+  private:
+	struct TreeNode
+	{
+		float		Center[3];
+		float		Radius;
+		int		First, Count;		// the objects under it, in tree order
+		int		Left, Right;		// children, or -1 for a leaf
+	};
+
+	std::vector<TreeNode>		Nodes;			// parents before their children
+	std::vector<float>		X, Y, Z, R;		// the spheres, in tree order
+	std::vector<int>		Ids;			// which object is at each place in tree order
+	std::vector<int>		PlaceOf;		// by object
+	std::vector<unsigned char>	Visible;		// for SpheresVisible( )
+	std::vector<int>		Stack;
+
+	int	NodesVisited, Accepted, Rejected, LeafTests, NumVisible;	// by the last Cull( )
+
+	int	BuildNode( int, int );
+	void	FitLeaf( TreeNode & );
+	void	FitParent( TreeNode &, const TreeNode &, const TreeNode & );
+
+  public:
+		SphereTree( );
+
+	void	Build( int, const float *, const float *, const float *, const float * );
+	int	Cull( const Frustum &, std::vector<int> & );
+	int	GetNumSpheres( );
+	void	PrintStats( FILE * );
+	void	Refit( );
+	void	SetSphere( int, float, float, float, float );
+};
+
+#endif		// #ifndef SPHERETREE_H
@@ -0,0 +1,80 @@
+#ifndef STREAMBUFFER_H
+#define STREAMBUFFER_H
+
+#include <stdio.h>
+#include <vector>
+
+#include "glew.h"
+#include <GL/gl.h>
+
+
+// a buffer for data that is new every frame -- instance matrices, line vertices, uniform blocks --
+// that the cpu writes straight into, without glBufferData( ) or glBufferSubData( ) ever making the
+// driver find new storage or wait for the gpu:
+//
+//	the buffer is STREAM_FRAMES regions, one per frame, used round and round
+//	if glBufferStorage( ) is there, the whole buffer is mapped once, persistently and coherently,
+//	so Allocate( ) hands back a pointer into the gpu's copy and writing it is all there is to do
+//	EndFrame( ) puts a fence after the frame's draws, and BeginFrame( ) waits on the fence of the
+//	region it is about to reuse -- so with the gpu fewer than STREAM_FRAMES frames behind, it never
+//	waits at all, and the stall counter says if it ever did
+//
+//	without glBufferStorage( ), Allocate( ) hands back a pointer into a copy on the cpu, and Flush( )
+//	copies what was written into an unsynchronized mapping of the region -- the fences still say
+//	when that is safe
+//
+//	an offset that Allocate( ) or Push( ) returns is from the start of the whole buffer, so it
+//	moves from frame to frame -- whatever reads the data has to be pointed at it each time
+//
+//	use:
+//		StreamBuffer Instances;
+//		Instances.Init( GL_ARRAY_BUFFER, 1024*sizeof(glm::mat4), 16, "Instances" );	// once
+//		...
+//		Instances.BeginFrame( );
+//		GLintptr offset;
+//		glm::mat4 *m = (glm::mat4 *) Instances.Allocate( n*sizeof(glm::mat4), &offset );
+//		...fill in m[0] to m[n-1]...
+//		Instances.Flush( );				// before drawing from it
+//		...point the instance attributes at Instances.GetBuffer( ), offset, and draw...
+//		Instances.EndFrame( );
+
+const int STREAM_FRAMES = 3;		// how many frames the gpu might be behind
+
+class StreamBuffer
+{
+  private:
+	GLenum			Target;
+	GLuint			Buffer;
+	const char *		Name;			// for messages and the debug label
+	GLubyte *		Mapped;			// NULL if the buffer could not be persistently mapped
+	std::vector<GLubyte>	Staging;		// where Allocate( ) points if it could not
+	GLsizeiptr		RegionSize;		// each frame gets this much
+	GLint			Alignment;		// of everything Allocate( ) hands out
+	int			NowRegion;
+	GLsizeiptr		Used;			// of this frame's region
+	GLsizeiptr		Flushed;		// how much of that Flush( ) has copied
+	GLsync			Fences[STREAM_FRAMES];
+
+	int			Frames;
+	int			Stalls;			// frames that had to wait for the gpu
+	double			StallMs;		// how long they waited, altogether
+	int			Overflows;		// Allocate( )s that did not fit
+	GLsizeiptr		MostUsed;		// in any one frame
+
+  public:
+		StreamBuffer( );
+
+	void *		Allocate( GLsizeiptr, GLintptr * );
+	void		BeginFrame( );
+	void		EndFrame( );
+	void		Flush( );
+	GLuint		GetBuffer( );
+	GLsizeiptr	GetRegionSize( );
+	int		GetStalls( );
+	void		Init( GLenum, GLsizeiptr, GLint = 16, const char * = "StreamBuffer" );
+	bool		IsPersistent( );
+	void		PrintStats( FILE * );
+	GLintptr	Push( const void *, GLsizeiptr );
+};
+
+#endif		// #ifndef STREAMBUFFER_H